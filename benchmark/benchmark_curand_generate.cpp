@@ -52,11 +52,15 @@ template<typename T>
 void run_benchmark(const cli::Parser&    parser,
                    const rng_type_t      rng_type,
                    cudaStream_t          stream,
-                   generate_func_type<T> generate_func)
+                   generate_func_type<T> generate_func,
+                   const std::string&    distribution,
+                   const std::string&    engine,
+                   const double          lambda = 0.f)
 {
     const size_t size = parser.get<size_t>("size");
     const size_t trials = parser.get<size_t>("trials");
     const size_t offset = parser.get<size_t>("offset");
+    const std::string format = parser.get<std::string>("format");
 
     T * data;
     CUDA_CALL(cudaMalloc(reinterpret_cast<void**>(&data), size * sizeof(T)));
@@ -105,14 +109,39 @@ void run_benchmark(const cli::Parser&    parser,
     CUDA_CALL(cudaEventDestroy(stop));
     CUDA_CALL(cudaEventDestroy(start));
 
-    std::cout << std::fixed << std::setprecision(3) << "      "
-              << "Throughput = " << std::setw(8)
-              << (trials * size * sizeof(T)) / (elapsed / 1e3 * (1 << 30))
-              << " GB/s, Samples = " << std::setw(8)
-              << (trials * size) / (elapsed / 1e3 * (1 << 30))
-              << " GSample/s, AvgTime (1 trial) = " << std::setw(8) << elapsed / trials
-              << " ms, Time (all) = " << std::setw(8) << elapsed << " ms, Size = " << size
-              << std::endl;
+    if (format.compare("csv") == 0)
+    {
+        std::cout << std::fixed << std::setprecision(3)
+                  << engine << ","
+                  << distribution << ","
+                  << (trials * size * sizeof(T)) /
+                        (elapsed / 1e3 * (1 << 30)) << ","
+                  << (trials * size) /
+                        (elapsed / 1e3 * (1 << 30)) << ","
+                  << elapsed / trials << ","
+                  << elapsed << ","
+                  << size << ",";
+        if (distribution.compare("poisson") == 0)
+        {
+             std::cout << lambda;
+        }
+        std::cout << std::endl;
+    }
+    else
+    {
+        if (format.compare("console") != 0)
+        {
+            std::cout << "Unknown format specified (must be either console or csv).  Defaulting to console output." << std::endl;
+        }
+        std::cout << std::fixed << std::setprecision(3) << "      "
+                  << "Throughput = " << std::setw(8)
+                  << (trials * size * sizeof(T)) / (elapsed / 1e3 * (1 << 30))
+                  << " GB/s, Samples = " << std::setw(8)
+                  << (trials * size) / (elapsed / 1e3 * (1 << 30))
+                  << " GSample/s, AvgTime (1 trial) = " << std::setw(8) << elapsed / trials
+                  << " ms, Time (all) = " << std::setw(8) << elapsed << " ms, Size = " << size
+                  << std::endl;
+    }
 
     CURAND_CALL(curandDestroyGenerator(generator));
     CUDA_CALL(cudaFree(data));
@@ -121,6 +150,7 @@ void run_benchmark(const cli::Parser&    parser,
 void run_benchmarks(const cli::Parser& parser,
                     const rng_type_t   rng_type,
                     const std::string& distribution,
+                    const std::string& engine,
                     cudaStream_t       stream)
 {
     if (distribution == "uniform-uint")
@@ -132,7 +162,9 @@ void run_benchmarks(const cli::Parser& parser,
                                         rng_type,
                                         stream,
                                         [](curandGenerator_t gen, unsigned int* data, size_t size)
-                                        { return curandGenerate(gen, data, size); });
+                                        { return curandGenerate(gen, data, size); },
+                                        distribution,
+                                        engine);
         }
     }
     if (distribution == "uniform-long-long")
@@ -145,7 +177,9 @@ void run_benchmarks(const cli::Parser& parser,
                 rng_type,
                 stream,
                 [](curandGenerator_t gen, unsigned long long* data, size_t size)
-                { return curandGenerateLongLong(gen, data, size); });
+                { return curandGenerateLongLong(gen, data, size); },
+                distribution,
+                engine);
         }
     }
     if (distribution == "uniform-float")
@@ -154,7 +188,9 @@ void run_benchmarks(const cli::Parser& parser,
                              rng_type,
                              stream,
                              [](curandGenerator_t gen, float* data, size_t size)
-                             { return curandGenerateUniform(gen, data, size); });
+                             { return curandGenerateUniform(gen, data, size); },
+                             distribution,
+                             engine);
     }
     if (distribution == "uniform-double")
     {
@@ -162,7 +198,9 @@ void run_benchmarks(const cli::Parser& parser,
                               rng_type,
                               stream,
                               [](curandGenerator_t gen, double* data, size_t size)
-                              { return curandGenerateUniformDouble(gen, data, size); });
+                              { return curandGenerateUniformDouble(gen, data, size); },
+                              distribution,
+                              engine);
     }
     if (distribution == "normal-float")
     {
@@ -170,7 +208,9 @@ void run_benchmarks(const cli::Parser& parser,
                              rng_type,
                              stream,
                              [](curandGenerator_t gen, float* data, size_t size)
-                             { return curandGenerateNormal(gen, data, size, 0.0f, 1.0f); });
+                             { return curandGenerateNormal(gen, data, size, 0.0f, 1.0f); },
+                             distribution,
+                             engine);
     }
     if (distribution == "normal-double")
     {
@@ -178,7 +218,9 @@ void run_benchmarks(const cli::Parser& parser,
                               rng_type,
                               stream,
                               [](curandGenerator_t gen, double* data, size_t size)
-                              { return curandGenerateNormalDouble(gen, data, size, 0.0, 1.0); });
+                              { return curandGenerateNormalDouble(gen, data, size, 0.0, 1.0); },
+                              distribution,
+                              engine);
     }
     if (distribution == "log-normal-float")
     {
@@ -186,7 +228,9 @@ void run_benchmarks(const cli::Parser& parser,
                              rng_type,
                              stream,
                              [](curandGenerator_t gen, float* data, size_t size)
-                             { return curandGenerateLogNormal(gen, data, size, 0.0f, 1.0f); });
+                             { return curandGenerateLogNormal(gen, data, size, 0.0f, 1.0f); },
+                             distribution,
+                             engine);
     }
     if (distribution == "log-normal-double")
     {
@@ -194,21 +238,30 @@ void run_benchmarks(const cli::Parser& parser,
                               rng_type,
                               stream,
                               [](curandGenerator_t gen, double* data, size_t size)
-                              { return curandGenerateLogNormalDouble(gen, data, size, 0.0, 1.0); });
+                              { return curandGenerateLogNormalDouble(gen, data, size, 0.0, 1.0); },
+                              distribution,
+                              engine);
     }
     if (distribution == "poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
+        const std::string format = parser.get<std::string>("format");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
+            if (format.compare("console") == 0)
+            {
+                std::cout << "    " << "lambda "
+                     << std::fixed << std::setprecision(1) << lambda << std::endl;
+            }
             run_benchmark<unsigned int>(
                 parser,
                 rng_type,
                 stream,
                 [lambda](curandGenerator_t gen, unsigned int* data, size_t size)
-                { return curandGeneratePoisson(gen, data, size, lambda); });
+                { return curandGeneratePoisson(gen, data, size, lambda); },
+                distribution,
+                engine,
+                lambda);
         }
     }
 }
@@ -265,6 +318,7 @@ int main(int argc, char *argv[])
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::string>("format", "format", {"console"}, "output format: console or csv");
     parser.run_and_exit_if_error();
 
     std::vector<std::string> engines;
@@ -318,6 +372,17 @@ int main(int argc, char *argv[])
     cudaStream_t stream;
     CUDA_CALL(cudaStreamCreate(&stream));
 
+    std::string format = parser.get<std::string>("format");
+    bool console_output = format.compare("console") == 0 ? true : false;
+
+    if (!console_output)
+    {
+        std::cout << "Engine,Distribution,Throughput,Samples,AvgTime (1 Trial),Time(all),Size,Lambda"
+                  << std::endl;
+        std::cout << ",,GB/s,GSample/s,ms),ms),values,"
+                  << std::endl;
+    }
+
     for (auto engine : engines)
     {
         rng_type_t rng_type = CURAND_RNG_PSEUDO_XORWOW;
@@ -345,14 +410,23 @@ int main(int argc, char *argv[])
             exit(1);
         }
 
-        std::cout << engine << ":" << std::endl;
+        if (console_output)
+        {
+            std::cout << engine << ":" << std::endl;
+        }
 
         for (auto distribution : distributions)
         {
-            std::cout << "  " << distribution << ":" << std::endl;
-            run_benchmarks(parser, rng_type, distribution, stream);
+            if (console_output)
+            {
+                std::cout << "  " << distribution << ":" << std::endl;
+            }
+            run_benchmarks(parser, rng_type, distribution, engine, stream);
+        }
+        if (console_output)
+        {
+            std::cout << std::endl;
         }
-        std::cout << std::endl;
     }
 
     CUDA_CALL(cudaStreamDestroy(stream));
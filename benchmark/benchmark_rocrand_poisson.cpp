@@ -0,0 +1,368 @@
+// Copyright (c) 2017-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Sweeps lambda for each Poisson generation method on the executing
+// device, so the crossover lambdas in rocrand_poisson.h (see
+// ROCRAND_LAMBDA_THRESHOLD_SMALL and ROCRAND_LAMBDA_THRESHOLD_HUGE) can
+// be picked per architecture from measurements instead of the compiled
+// compromises. Each device method - Knuth, rejection, normal
+// approximation and iterative inversion - is forced for every lambda of
+// the sweep regardless of the thresholds, and the library's table-based
+// host path (rocrand_generate_poisson) is measured alongside for
+// comparison. After the sweep the tool reports where the fastest method
+// changes.
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+enum poisson_method
+{
+    method_knuth,
+    method_rejection,
+    method_normal,
+    method_inversion,
+    method_table // the library's host path, not a device function
+};
+
+const char * method_names[] = {"knuth", "rejection", "normal", "inversion", "table"};
+
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void init_kernel(rocrand_state_philox4x32_10 * states,
+                 const unsigned long long seed,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(seed, state_id, offset, &state);
+    states[state_id] = state;
+}
+
+template<int Method>
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void poisson_kernel(rocrand_state_philox4x32_10 * states,
+                    unsigned int * data,
+                    const size_t values_per_thread,
+                    const double lambda)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride = gridDim.x * blockDim.x;
+
+    rocrand_state_philox4x32_10 state = states[state_id];
+    size_t index = state_id;
+    for(size_t i = 0; i < values_per_thread; i++)
+    {
+        unsigned int value;
+        if (Method == method_knuth)
+        {
+            value = rocrand_device::detail::poisson_distribution_small<
+                rocrand_state_philox4x32_10>(state, lambda);
+        }
+        else if (Method == method_rejection)
+        {
+            value = rocrand_device::detail::poisson_distribution_large<
+                rocrand_state_philox4x32_10>(state, lambda);
+        }
+        else if (Method == method_normal)
+        {
+            value = rocrand_device::detail::poisson_distribution_huge<
+                rocrand_state_philox4x32_10>(state, lambda);
+        }
+        else
+        {
+            value = rocrand_device::detail::poisson_distribution_itr<
+                rocrand_state_philox4x32_10>(state, lambda);
+        }
+        data[index] = value;
+        index += stride;
+    }
+    states[state_id] = state;
+}
+
+struct sweep_point
+{
+    int    method;
+    double lambda;
+    double ms_per_launch;
+    double gsamples;
+};
+
+template<int Method>
+void run_device_sweep(hipStream_t stream,
+                      const size_t size,
+                      const size_t trials,
+                      const std::vector<double>& lambdas,
+                      std::vector<sweep_point>& points)
+{
+    const size_t threads = 256;
+    const size_t blocks = 512;
+    const size_t values_per_thread = std::max<size_t>(1, size / (threads * blocks));
+    const size_t generated = blocks * threads * values_per_thread;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&data), generated * sizeof(unsigned int)));
+    rocrand_state_philox4x32_10 * states;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&states),
+                        blocks * threads * sizeof(rocrand_state_philox4x32_10)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(init_kernel),
+        dim3(blocks), dim3(threads), 0, 0,
+        states, 12345ULL, 6789ULL
+    );
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for (double lambda : lambdas)
+    {
+        // Warm-up
+        for (size_t i = 0; i < 5; i++)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(poisson_kernel<Method>),
+                dim3(blocks), dim3(threads), 0, stream,
+                states, data, values_per_thread, lambda
+            );
+            HIP_CHECK(hipGetLastError());
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+        HIP_CHECK(hipEventRecord(start, stream));
+        for (size_t i = 0; i < trials; i++)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(poisson_kernel<Method>),
+                dim3(blocks), dim3(threads), 0, stream,
+                states, data, values_per_thread, lambda
+            );
+        }
+        HIP_CHECK(hipEventRecord(stop, stream));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        sweep_point point;
+        point.method = Method;
+        point.lambda = lambda;
+        point.ms_per_launch = elapsed / trials;
+        point.gsamples = (trials * generated) / (elapsed / 1e3 * (1 << 30));
+        points.push_back(point);
+    }
+
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(data));
+}
+
+void run_table_sweep(hipStream_t stream,
+                     const size_t size,
+                     const size_t trials,
+                     const std::vector<double>& lambdas,
+                     std::vector<sweep_point>& points)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    for (double lambda : lambdas)
+    {
+        // Warm-up; the first call also builds the distribution table,
+        // which is a one-time cost the sweep should not charge
+        for (size_t i = 0; i < 5; i++)
+        {
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+        HIP_CHECK(hipEventRecord(start, stream));
+        for (size_t i = 0; i < trials; i++)
+        {
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+        }
+        HIP_CHECK(hipEventRecord(stop, stream));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        sweep_point point;
+        point.method = method_table;
+        point.lambda = lambda;
+        point.ms_per_launch = elapsed / trials;
+        point.gsamples = (trials * size) / (elapsed / 1e3 * (1 << 30));
+        points.push_back(point);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+// Returns the fastest device method for the lambda, ignoring the table
+// path: the thresholds in rocrand_poisson.h only choose between the
+// device methods
+int fastest_device_method(const std::vector<sweep_point>& points, const double lambda)
+{
+    int best = -1;
+    double best_gsamples = 0.0;
+    for (const sweep_point& point : points)
+    {
+        if (point.lambda == lambda && point.method != method_table
+            && point.gsamples > best_gsamples)
+        {
+            best = point.method;
+            best_gsamples = point.gsamples;
+        }
+    }
+    return best;
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 32, "number of values per launch");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials per point");
+    parser.set_optional<std::vector<double>>("lambda", "lambda",
+        {1.0, 2.0, 4.0, 8.0, 16.0, 32.0, 48.0, 64.0, 96.0, 128.0, 256.0, 512.0,
+         1000.0, 2000.0, 4000.0, 8000.0, 16000.0},
+        "space-separated list of lambdas to sweep");
+    parser.set_optional<std::string>("format", "format", {"console"},
+        "output format: console or csv");
+    parser.run_and_exit_if_error();
+
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+    std::vector<double> lambdas = parser.get<std::vector<double>>("lambda");
+    std::sort(lambdas.begin(), lambdas.end());
+    const std::string format = parser.get<std::string>("format");
+    const bool console_output = format.compare("csv") != 0;
+
+    int version;
+    rocrand_get_version(&version);
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    std::cout << "benchmark_rocrand_poisson" << std::endl;
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    std::vector<sweep_point> points;
+    run_device_sweep<method_knuth>(stream, size, trials, lambdas, points);
+    run_device_sweep<method_rejection>(stream, size, trials, lambdas, points);
+    run_device_sweep<method_normal>(stream, size, trials, lambdas, points);
+    run_device_sweep<method_inversion>(stream, size, trials, lambdas, points);
+    run_table_sweep(stream, size, trials, lambdas, points);
+
+    HIP_CHECK(hipStreamDestroy(stream));
+
+    if (console_output)
+    {
+        std::cout << std::setw(12) << std::left << "method" << std::right
+                  << std::setw(12) << "lambda"
+                  << std::setw(12) << "GSample/s"
+                  << std::setw(12) << "ms/launch"
+                  << std::endl;
+        for (const sweep_point& point : points)
+        {
+            std::cout << std::fixed << std::setprecision(3)
+                      << std::setw(12) << std::left << method_names[point.method] << std::right
+                      << std::setw(12) << point.lambda
+                      << std::setw(12) << point.gsamples
+                      << std::setw(12) << point.ms_per_launch
+                      << std::endl;
+        }
+        std::cout << std::endl;
+
+        // Report where the fastest device method changes; these are the
+        // measured crossovers for the thresholds in rocrand_poisson.h
+        for (size_t i = 1; i < lambdas.size(); i++)
+        {
+            const int before = fastest_device_method(points, lambdas[i - 1]);
+            const int after = fastest_device_method(points, lambdas[i]);
+            if (before != after && before >= 0 && after >= 0)
+            {
+                std::cout << "fastest method changes from " << method_names[before]
+                          << " to " << method_names[after]
+                          << " between lambda " << lambdas[i - 1]
+                          << " and " << lambdas[i]
+                          << " on " << props.name << std::endl;
+            }
+        }
+    }
+    else
+    {
+        std::cout << "method,lambda,GSample/s,avg-ms" << std::endl;
+        for (const sweep_point& point : points)
+        {
+            std::cout << method_names[point.method] << ","
+                      << point.lambda << ","
+                      << point.gsamples << ","
+                      << point.ms_per_launch
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,371 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Replays a recorded call trace against the host API and reports
+// host-side latency percentiles per call class, so that per-call
+// overhead regressions (interleaved sizes, stream switching, repeated
+// parameter changes) show up, which the steady-state single-size
+// benchmarks cannot see.
+//
+// Trace format: one call per line, '#' starts a comment.
+//
+//   <engine> <distribution> <size> <stream> [<lambda>]
+//
+// e.g.
+//
+//   philox uniform-float 1048576 0
+//   philox normal-float 4096 1
+//   xorwow poisson 65536 0 10.5
+//
+// <engine> and <distribution> use the same names as the other
+// benchmarks; <stream> is a small non-negative stream index. Calls to
+// the same engine share one generator; a stream index change is
+// replayed as rocrand_set_stream.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+struct trace_call
+{
+    std::string engine;
+    std::string distribution;
+    size_t      size;
+    size_t      stream;
+    double      lambda;
+};
+
+static rocrand_rng_type engine_rng_type(const std::string& engine)
+{
+    if (engine == "xorwow")
+        return ROCRAND_RNG_PSEUDO_XORWOW;
+    else if (engine == "mrg31k3p")
+        return ROCRAND_RNG_PSEUDO_MRG31K3P;
+    else if (engine == "mrg32k3a")
+        return ROCRAND_RNG_PSEUDO_MRG32K3A;
+    else if (engine == "philox")
+        return ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    else if (engine == "threefry2x32")
+        return ROCRAND_RNG_PSEUDO_THREEFRY2_32_20;
+    else if (engine == "threefry2x64")
+        return ROCRAND_RNG_PSEUDO_THREEFRY2_64_20;
+    else if (engine == "threefry4x32")
+        return ROCRAND_RNG_PSEUDO_THREEFRY4_32_20;
+    else if (engine == "threefry4x64")
+        return ROCRAND_RNG_PSEUDO_THREEFRY4_64_20;
+    else if (engine == "sobol32")
+        return ROCRAND_RNG_QUASI_SOBOL32;
+    else if (engine == "scrambled_sobol32")
+        return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+    else if (engine == "sobol64")
+        return ROCRAND_RNG_QUASI_SOBOL64;
+    else if (engine == "scrambled_sobol64")
+        return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
+    else if (engine == "mtgp32")
+        return ROCRAND_RNG_PSEUDO_MTGP32;
+    else if (engine == "lfsr113")
+        return ROCRAND_RNG_PSEUDO_LFSR113;
+#ifndef USE_HIP_CPU
+    else if (engine == "mt19937")
+        return ROCRAND_RNG_PSEUDO_MT19937;
+#endif
+    std::cout << "Wrong engine name: " << engine << std::endl;
+    exit(1);
+}
+
+static rocrand_status replay_call(rocrand_generator generator,
+                                  const trace_call& call,
+                                  void * data)
+{
+    const std::string& d = call.distribution;
+    if (d == "uniform-uint")
+        return rocrand_generate(generator,
+                                static_cast<unsigned int *>(data), call.size);
+    else if (d == "uniform-float")
+        return rocrand_generate_uniform(generator,
+                                        static_cast<float *>(data), call.size);
+    else if (d == "uniform-double")
+        return rocrand_generate_uniform_double(generator,
+                                               static_cast<double *>(data), call.size);
+    else if (d == "normal-float")
+        return rocrand_generate_normal(generator,
+                                       static_cast<float *>(data), call.size, 0.0f, 1.0f);
+    else if (d == "normal-double")
+        return rocrand_generate_normal_double(generator,
+                                              static_cast<double *>(data), call.size, 0.0, 1.0);
+    else if (d == "log-normal-float")
+        return rocrand_generate_log_normal(generator,
+                                           static_cast<float *>(data), call.size, 0.0f, 1.0f);
+    else if (d == "log-normal-double")
+        return rocrand_generate_log_normal_double(generator,
+                                                  static_cast<double *>(data), call.size, 0.0, 1.0);
+    else if (d == "poisson")
+        return rocrand_generate_poisson(generator,
+                                        static_cast<unsigned int *>(data), call.size, call.lambda);
+    std::cout << "Wrong distribution name: " << d << std::endl;
+    exit(1);
+}
+
+static std::vector<trace_call> read_trace(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cout << "Cannot open trace file: " << path << std::endl;
+        exit(1);
+    }
+
+    std::vector<trace_call> trace;
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(file, line))
+    {
+        line_number++;
+        const size_t comment = line.find('#');
+        if (comment != std::string::npos)
+        {
+            line = line.substr(0, comment);
+        }
+
+        std::istringstream s(line);
+        trace_call call;
+        call.lambda = 10.0;
+        if (!(s >> call.engine))
+        {
+            continue; // blank line
+        }
+        if (!(s >> call.distribution >> call.size >> call.stream))
+        {
+            std::cout << "Malformed trace line " << line_number << ": " << line << std::endl;
+            exit(1);
+        }
+        s >> call.lambda;
+        trace.push_back(call);
+    }
+    return trace;
+}
+
+static double percentile(std::vector<double>& sorted, double p)
+{
+    const size_t index = static_cast<size_t>(p * (sorted.size() - 1));
+    return sorted[index];
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_required<std::string>("trace", "trace", "path of the call trace to replay");
+    parser.set_optional<size_t>("trials", "trials", 10, "number of trace replays measured");
+    parser.set_optional<std::string>("format", "format", {"console"}, "output format: console or csv");
+    parser.run_and_exit_if_error();
+
+    const std::string trace_path = parser.get<std::string>("trace");
+    const size_t trials = parser.get<size_t>("trials");
+    const std::string format = parser.get<std::string>("format");
+    const bool console_output = format.compare("csv") != 0;
+
+    const std::vector<trace_call> trace = read_trace(trace_path);
+    if (trace.empty())
+    {
+        std::cout << "Trace is empty: " << trace_path << std::endl;
+        exit(1);
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    if (console_output)
+    {
+        std::cout << "benchmark_rocrand_trace_replay" << std::endl;
+        std::cout << "rocRAND: " << version << " ";
+        std::cout << "Runtime: " << runtime_version << " ";
+        std::cout << "Device: " << props.name;
+        std::cout << std::endl;
+        std::cout << "Trace: " << trace_path << " (" << trace.size() << " calls)";
+        std::cout << std::endl << std::endl;
+    }
+
+    // One shared output buffer large enough for any call
+    size_t max_bytes = 0;
+    size_t stream_count = 0;
+    for (const trace_call& call : trace)
+    {
+        max_bytes = std::max(max_bytes, call.size * sizeof(double));
+        stream_count = std::max(stream_count, call.stream + 1);
+    }
+    void * data;
+    HIP_CHECK(hipMalloc(&data, max_bytes));
+
+    std::vector<hipStream_t> streams(stream_count);
+    for (hipStream_t& stream : streams)
+    {
+        HIP_CHECK(hipStreamCreate(&stream));
+    }
+
+    // Calls to the same engine share one generator so that stream and
+    // parameter switches are replayed as they happened
+    std::map<std::string, rocrand_generator> generators;
+    std::map<std::string, size_t> current_streams;
+    for (const trace_call& call : trace)
+    {
+        if (generators.find(call.engine) == generators.end())
+        {
+            rocrand_generator generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, engine_rng_type(call.engine)));
+            generators[call.engine] = generator;
+            current_streams[call.engine] = 0;
+        }
+    }
+
+    // Latencies in microseconds keyed by call class
+    std::map<std::string, std::vector<double>> latencies;
+
+    // First replay warms up and is not recorded
+    for (size_t trial = 0; trial < trials + 1; trial++)
+    {
+        const bool warm_up = trial == 0;
+        for (const trace_call& call : trace)
+        {
+            rocrand_generator generator = generators[call.engine];
+            if (current_streams[call.engine] != call.stream)
+            {
+                ROCRAND_CHECK(rocrand_set_stream(generator, streams[call.stream]));
+                current_streams[call.engine] = call.stream;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            ROCRAND_CHECK(replay_call(generator, call, data));
+            const auto stop = std::chrono::steady_clock::now();
+
+            if (!warm_up)
+            {
+                std::ostringstream key;
+                key << call.engine << "," << call.distribution << "," << call.size;
+                latencies[key.str()].push_back(
+                    std::chrono::duration<double, std::micro>(stop - start).count());
+            }
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    if (console_output)
+    {
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::setw(48) << std::left << "call class (engine,distribution,size)"
+                  << std::right
+                  << std::setw(8) << "calls"
+                  << std::setw(12) << "mean us"
+                  << std::setw(12) << "p50 us"
+                  << std::setw(12) << "p90 us"
+                  << std::setw(12) << "p99 us"
+                  << std::setw(12) << "max us"
+                  << std::endl;
+    }
+    else
+    {
+        std::cout << "Engine,Distribution,Size,Calls,Mean,P50,P90,P99,Max" << std::endl;
+    }
+
+    for (auto& entry : latencies)
+    {
+        std::vector<double>& samples = entry.second;
+        std::sort(samples.begin(), samples.end());
+        const double mean =
+            std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+
+        if (console_output)
+        {
+            std::cout << std::setw(48) << std::left << entry.first << std::right;
+        }
+        else
+        {
+            std::cout << entry.first << ",";
+        }
+        std::cout << std::fixed << std::setprecision(3);
+        if (console_output)
+        {
+            std::cout << std::setw(8) << samples.size()
+                      << std::setw(12) << mean
+                      << std::setw(12) << percentile(samples, 0.5)
+                      << std::setw(12) << percentile(samples, 0.9)
+                      << std::setw(12) << percentile(samples, 0.99)
+                      << std::setw(12) << samples.back()
+                      << std::endl;
+        }
+        else
+        {
+            std::cout << samples.size() << ","
+                      << mean << ","
+                      << percentile(samples, 0.5) << ","
+                      << percentile(samples, 0.9) << ","
+                      << percentile(samples, 0.99) << ","
+                      << samples.back()
+                      << std::endl;
+        }
+    }
+
+    for (auto& entry : generators)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(entry.second));
+    }
+    for (hipStream_t stream : streams)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+    HIP_CHECK(hipFree(data));
+
+    return 0;
+}
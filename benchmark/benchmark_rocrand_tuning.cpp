@@ -0,0 +1,441 @@
+// Copyright (c) 2017-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Sweeps block size and values-per-thread for each device-side engine
+// and annotates every measured point against the executing device's
+// roofline, so launch parameters for kernels that embed a rocRAND
+// engine can be picked per architecture without hand profiling.
+//
+// Unlike benchmark_rocrand_kernel, which measures one launch
+// configuration per run, this tool measures the whole matrix in one go
+// and classifies each point as launch-, bandwidth- or ALU-bound from
+// the per-launch time and the fraction of peak memory bandwidth it
+// reaches. The sweep covers the engines that are initialized with a
+// plain rocrand_init(seed, subsequence, offset) call plus lfsr113;
+// mtgp32 (fixed 256-thread blocks) and the sobol engines
+// (dimension-structured grids) have no free block-size axis to sweep.
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+template<typename GeneratorState>
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void init_kernel(GeneratorState * states,
+                 const unsigned long long seed,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    GeneratorState state;
+    rocrand_init(seed, state_id, offset, &state);
+    states[state_id] = state;
+}
+
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void init_kernel(rocrand_state_lfsr113 * states,
+                 const unsigned long long /* seed */,
+                 const unsigned long long /* offset */)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    rocrand_state_lfsr113 state;
+    rocrand_init(uint4{ROCRAND_LFSR113_DEFAULT_SEED_X,
+                       ROCRAND_LFSR113_DEFAULT_SEED_Y,
+                       ROCRAND_LFSR113_DEFAULT_SEED_Z,
+                       ROCRAND_LFSR113_DEFAULT_SEED_W},
+                 state_id,
+                 &state);
+    states[state_id] = state;
+}
+
+template<typename GeneratorState>
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void generate_kernel(GeneratorState * states,
+                     unsigned int * data,
+                     const size_t values_per_thread)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride = gridDim.x * blockDim.x;
+
+    GeneratorState state = states[state_id];
+    size_t index = state_id;
+    for(size_t i = 0; i < values_per_thread; i++)
+    {
+        data[index] = rocrand(&state);
+        index += stride;
+    }
+    states[state_id] = state;
+}
+
+struct sweep_point
+{
+    std::string engine;
+    size_t      block_size;
+    size_t      values_per_thread;
+    size_t      blocks;
+    double      ms_per_launch;
+    double      gbs;
+    double      gsamples;
+};
+
+template<typename GeneratorState>
+void run_sweep(const std::string& engine,
+               hipStream_t stream,
+               const size_t size,
+               const size_t trials,
+               const std::vector<size_t>& block_sizes,
+               const std::vector<size_t>& values_per_thread,
+               std::vector<sweep_point>& points)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+
+    for (size_t threads : block_sizes)
+    {
+        for (size_t vpt : values_per_thread)
+        {
+            // The grid is derived from the fixed problem size so that
+            // every point of the matrix moves the same number of bytes
+            const size_t blocks = size / (threads * vpt);
+            if (blocks == 0)
+            {
+                continue;
+            }
+
+            GeneratorState * states;
+            HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&states),
+                                blocks * threads * sizeof(GeneratorState)));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(init_kernel),
+                dim3(blocks), dim3(threads), 0, 0,
+                states, 12345ULL, 6789ULL
+            );
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Warm-up
+            for (size_t i = 0; i < 5; i++)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(generate_kernel),
+                    dim3(blocks), dim3(threads), 0, stream,
+                    states, data, vpt
+                );
+                HIP_CHECK(hipGetLastError());
+            }
+            HIP_CHECK(hipDeviceSynchronize());
+
+            hipEvent_t start, stop;
+            HIP_CHECK(hipEventCreate(&start));
+            HIP_CHECK(hipEventCreate(&stop));
+            HIP_CHECK(hipEventRecord(start, stream));
+            for (size_t i = 0; i < trials; i++)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(generate_kernel),
+                    dim3(blocks), dim3(threads), 0, stream,
+                    states, data, vpt
+                );
+            }
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+            float elapsed;
+            HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+            HIP_CHECK(hipEventDestroy(start));
+            HIP_CHECK(hipEventDestroy(stop));
+            HIP_CHECK(hipFree(states));
+
+            const size_t generated = blocks * threads * vpt;
+            sweep_point point;
+            point.engine = engine;
+            point.block_size = threads;
+            point.values_per_thread = vpt;
+            point.blocks = blocks;
+            point.ms_per_launch = elapsed / trials;
+            point.gbs = (trials * generated * sizeof(unsigned int)) /
+                            (elapsed / 1e3 * (1 << 30));
+            point.gsamples = (trials * generated) /
+                                 (elapsed / 1e3 * (1 << 30));
+            points.push_back(point);
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+const std::vector<std::string> all_engines = {"xorwow",
+                                              "mrg31k3p",
+                                              "mrg32k3a",
+                                              "philox",
+                                              "threefry2x32",
+                                              "threefry2x64",
+                                              "threefry4x32",
+                                              "threefry4x64",
+                                              "lfsr113"};
+
+// Per-launch times below this are dominated by launch overhead, so the
+// throughput of such a point says nothing about the engine itself
+const double launch_bound_ms = 0.02;
+
+// Points reaching this fraction of the device's peak memory bandwidth
+// cannot go faster by spending more ALU cycles per byte
+const double bandwidth_bound_fraction = 0.6;
+
+const char * classify(const sweep_point& point, const double peak_bandwidth_gbs)
+{
+    if (point.ms_per_launch < launch_bound_ms)
+    {
+        return "launch";
+    }
+    if (point.gbs >= bandwidth_bound_fraction * peak_bandwidth_gbs)
+    {
+        return "bandwidth";
+    }
+    return "alu";
+}
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 128, "number of values per launch");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials per point");
+    parser.set_optional<std::vector<size_t>>("block-sizes", "block-sizes",
+        {64, 128, 256, 512, 1024}, "space-separated list of block sizes to sweep");
+    parser.set_optional<std::vector<size_t>>("values-per-thread", "values-per-thread",
+        {1, 2, 4, 8, 16, 32}, "space-separated list of values generated per thread to sweep");
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"all"}, engine_desc.c_str());
+    parser.set_optional<std::string>("format", "format", {"json"}, "output format: json or console");
+    parser.run_and_exit_if_error();
+
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+    const auto values_per_thread = parser.get<std::vector<size_t>>("values-per-thread");
+    const std::string format = parser.get<std::string>("format");
+    const bool console_output = format.compare("console") == 0;
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+
+    int version;
+    rocrand_get_version(&version);
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::vector<size_t> block_sizes;
+    for (size_t threads : parser.get<std::vector<size_t>>("block-sizes"))
+    {
+        if (threads <= static_cast<size_t>(props.maxThreadsPerBlock))
+        {
+            block_sizes.push_back(threads);
+        }
+    }
+
+    // Theoretical peaks from the device properties; the ALU peak is a
+    // coarse one-32-bit-op-per-lane-per-clock estimate, good enough to
+    // tell which side of the roofline a point sits on
+    const double peak_bandwidth_gbs =
+        2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8.0) / 1e9;
+    const double peak_giops =
+        static_cast<double>(props.clockRate) * 1e3 *
+        props.multiProcessorCount * props.warpSize / 1e9;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    std::vector<sweep_point> points;
+    for (auto engine : engines)
+    {
+        if (engine == "xorwow")
+        {
+            run_sweep<rocrand_state_xorwow>(engine, stream, size, trials,
+                                            block_sizes, values_per_thread, points);
+        }
+        else if (engine == "mrg31k3p")
+        {
+            run_sweep<rocrand_state_mrg31k3p>(engine, stream, size, trials,
+                                              block_sizes, values_per_thread, points);
+        }
+        else if (engine == "mrg32k3a")
+        {
+            run_sweep<rocrand_state_mrg32k3a>(engine, stream, size, trials,
+                                              block_sizes, values_per_thread, points);
+        }
+        else if (engine == "philox")
+        {
+            run_sweep<rocrand_state_philox4x32_10>(engine, stream, size, trials,
+                                                   block_sizes, values_per_thread, points);
+        }
+        else if (engine == "threefry2x32")
+        {
+            run_sweep<rocrand_state_threefry2x32_20>(engine, stream, size, trials,
+                                                     block_sizes, values_per_thread, points);
+        }
+        else if (engine == "threefry2x64")
+        {
+            run_sweep<rocrand_state_threefry2x64_20>(engine, stream, size, trials,
+                                                     block_sizes, values_per_thread, points);
+        }
+        else if (engine == "threefry4x32")
+        {
+            run_sweep<rocrand_state_threefry4x32_20>(engine, stream, size, trials,
+                                                     block_sizes, values_per_thread, points);
+        }
+        else if (engine == "threefry4x64")
+        {
+            run_sweep<rocrand_state_threefry4x64_20>(engine, stream, size, trials,
+                                                     block_sizes, values_per_thread, points);
+        }
+        else if (engine == "lfsr113")
+        {
+            run_sweep<rocrand_state_lfsr113>(engine, stream, size, trials,
+                                             block_sizes, values_per_thread, points);
+        }
+        else
+        {
+            std::cout << "Wrong engine name: " << engine << std::endl;
+            exit(1);
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+
+    if (console_output)
+    {
+        std::cout << "benchmark_rocrand_tuning" << std::endl;
+        std::cout << "rocRAND: " << version << " ";
+        std::cout << "Runtime: " << runtime_version << " ";
+        std::cout << "Device: " << props.name;
+        std::cout << std::endl;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "Peak bandwidth: " << peak_bandwidth_gbs << " GB/s, "
+                  << "peak ALU (estimate): " << peak_giops << " GIOPS"
+                  << std::endl << std::endl;
+        std::cout << std::setw(16) << std::left << "engine" << std::right
+                  << std::setw(8) << "threads"
+                  << std::setw(6) << "vpt"
+                  << std::setw(10) << "blocks"
+                  << std::setw(12) << "GB/s"
+                  << std::setw(12) << "GSample/s"
+                  << std::setw(12) << "ms/launch"
+                  << std::setw(10) << "peak %"
+                  << std::setw(12) << "bound"
+                  << std::endl;
+        for (const sweep_point& point : points)
+        {
+            std::cout << std::fixed << std::setprecision(3)
+                      << std::setw(16) << std::left << point.engine << std::right
+                      << std::setw(8) << point.block_size
+                      << std::setw(6) << point.values_per_thread
+                      << std::setw(10) << point.blocks
+                      << std::setw(12) << point.gbs
+                      << std::setw(12) << point.gsamples
+                      << std::setw(12) << point.ms_per_launch
+                      << std::setw(10) << 100.0 * point.gbs / peak_bandwidth_gbs
+                      << std::setw(12) << classify(point, peak_bandwidth_gbs)
+                      << std::endl;
+        }
+    }
+    else
+    {
+        if (format.compare("json") != 0)
+        {
+            std::cout << "Unknown format specified (must be either json or console).  Defaulting to json output." << std::endl;
+        }
+        std::cout << std::fixed << std::setprecision(6);
+        std::cout << "{" << std::endl;
+        std::cout << "  \"device\": \"" << props.name << "\"," << std::endl;
+        std::cout << "  \"rocrand_version\": " << version << "," << std::endl;
+        std::cout << "  \"runtime_version\": " << runtime_version << "," << std::endl;
+        std::cout << "  \"peak_bandwidth_gbs\": " << peak_bandwidth_gbs << "," << std::endl;
+        std::cout << "  \"peak_giops_estimate\": " << peak_giops << "," << std::endl;
+        std::cout << "  \"size\": " << size << "," << std::endl;
+        std::cout << "  \"trials\": " << trials << "," << std::endl;
+        std::cout << "  \"points\": [" << std::endl;
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            const sweep_point& point = points[i];
+            std::cout << "    {"
+                      << "\"engine\": \"" << point.engine << "\", "
+                      << "\"block_size\": " << point.block_size << ", "
+                      << "\"values_per_thread\": " << point.values_per_thread << ", "
+                      << "\"blocks\": " << point.blocks << ", "
+                      << "\"gbs\": " << point.gbs << ", "
+                      << "\"gsamples\": " << point.gsamples << ", "
+                      << "\"ms_per_launch\": " << point.ms_per_launch << ", "
+                      << "\"fraction_of_peak_bandwidth\": "
+                      << point.gbs / peak_bandwidth_gbs << ", "
+                      << "\"bound\": \"" << classify(point, peak_bandwidth_gbs) << "\"}"
+                      << (i + 1 < points.size() ? "," : "")
+                      << std::endl;
+        }
+        std::cout << "  ]" << std::endl;
+        std::cout << "}" << std::endl;
+    }
+
+    return 0;
+}
@@ -29,6 +29,9 @@
 #include "rocrand/rocrand_discrete_types.h"
 #include "rocrand/rocrand_hip_cpu.h"
 
+#include <stdio.h>
+
+#include <hip/hip_bfloat16.h>
 #include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
 #include <hip/hip_vector_types.h>
@@ -42,6 +45,21 @@
 typedef struct rocrand_generator_base_type * rocrand_generator;
 /// \endcond
 
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND random number generator pool (opaque)
+typedef struct rocrand_generator_pool_st * rocrand_generator_pool;
+/// \endcond
+
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND generation-to-host streaming pipeline (opaque)
+typedef struct rocrand_stream_st * rocrand_stream;
+/// \endcond
+
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND generator partitioned across several devices (opaque)
+typedef struct rocrand_generator_multi_gpu_st * rocrand_generator_multi_gpu;
+/// \endcond
+
 /// \cond ROCRAND_DOCS_TYPEDEFS
 /// rocRAND half type (derived from HIP)
 typedef __half half;
@@ -68,7 +86,9 @@ typedef enum rocrand_status {
                                               ///< or pointer is misaligned (see rocrand_generate_normal())
     ROCRAND_STATUS_DOUBLE_PRECISION_REQUIRED = 106, ///< GPU does not have double precision
     ROCRAND_STATUS_LAUNCH_FAILURE = 107, ///< Kernel launch failure
-    ROCRAND_STATUS_INTERNAL_ERROR = 108 ///< Internal library error
+    ROCRAND_STATUS_INTERNAL_ERROR = 108, ///< Internal library error
+    ROCRAND_STATUS_SELF_TEST_FAILED = 109, ///< Generated output did not match its reference
+    ROCRAND_STATUS_NOT_READY = 110 ///< Asynchronous work has not completed yet (see rocrand_query())
 } rocrand_status;
 
 /**
@@ -92,11 +112,25 @@ typedef enum rocrand_rng_type
     = 410, ///< ThreeFry 32 bit state size 4 pseudorandom generator
     ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
     = 411, ///< ThreeFry 64 bit state size 4 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PCG64            = 412, ///< PCG64 (XSL-RR) pseudorandom generator
+    ROCRAND_RNG_PSEUDO_XOSHIRO256PP     = 413, ///< XOSHIRO256++ pseudorandom generator
+    ROCRAND_RNG_PSEUDO_CHACHA20         = 414, ///< ChaCha20 cryptographically-strong pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7     = 415, ///< Reduced-round PHILOX-4x32-7 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_13  = 416, ///< Reduced-round THREEFRY-4x64-13 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_SQUARES32        = 417, ///< Squares counter-based pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10    = 418, ///< PHILOX-4x64-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_WELL19937        = 419, ///< WELL19937c pseudorandom generator
+    ROCRAND_RNG_PSEUDO_ADAPTIVE
+    = 420, ///< Hybrid generator routing between PHILOX-4x32-10 and MTGP32 by fill size
     ROCRAND_RNG_QUASI_DEFAULT           = 500, ///< Default quasirandom generator
     ROCRAND_RNG_QUASI_SOBOL32           = 501, ///< Sobol32 quasirandom generator
     ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502, ///< Scrambled Sobol32 quasirandom generator
     ROCRAND_RNG_QUASI_SOBOL64           = 504, ///< Sobol64 quasirandom generator
-    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 505 ///< Scrambled Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 505, ///< Scrambled Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL32_OWEN      = 506, ///< Owen-scrambled Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_HALTON            = 507, ///< Halton quasirandom generator
+    ROCRAND_RNG_QUASI_LATTICE           = 508, ///< Rank-1 lattice sequence quasirandom generator
+    ROCRAND_RNG_TAPE                    = 600 ///< Tape-replay generator serving a pre-generated tape file
 
 } rocrand_rng_type;
 
@@ -110,9 +144,139 @@ typedef enum rocrand_ordering
     ROCRAND_ORDERING_PSEUDO_SEEDED  = 102, ///< Fast lower quality pseudorandom results
     ROCRAND_ORDERING_PSEUDO_LEGACY  = 103, ///< Legacy ordering for pseudorandom results
     ROCRAND_ORDERING_PSEUDO_DYNAMIC = 104, ///< Adjust to the device executing the generator
-    ROCRAND_ORDERING_QUASI_DEFAULT  = 201 ///< n-dimensional ordering for quasirandom results
+    ROCRAND_ORDERING_PSEUDO_FASTEST = 105, ///< Fastest generation, results are not reproducible
+    ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+    = 106, ///< Results do not depend on the launch configuration
+    ROCRAND_ORDERING_QUASI_DEFAULT = 201 ///< n-dimensional ordering for quasirandom results
 } rocrand_ordering;
 
+/**
+ * \brief rocRAND output layout of quasi-random generators
+ */
+typedef enum rocrand_quasi_layout
+{
+    ROCRAND_QUASI_LAYOUT_DIMENSION_MAJOR = 300, ///< Each dimension's points are contiguous (default)
+    ROCRAND_QUASI_LAYOUT_POINT_MAJOR     = 301, ///< All dimensions of a point are contiguous
+    ROCRAND_QUASI_LAYOUT_BLOCKED = 302, ///< Dimension-major within L2-sized tiles of points
+    ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED
+    = 303 ///< Blocked with the dimension count padded to a power of two
+} rocrand_quasi_layout;
+
+/**
+ * \brief rocRAND math accuracy modes
+ */
+typedef enum rocrand_math_mode
+{
+    ROCRAND_MATH_PRECISE = 600, ///< Full-precision device math functions (default)
+    ROCRAND_MATH_FAST    = 601 ///< Fast, lower-accuracy device math functions
+} rocrand_math_mode;
+
+/**
+ * \brief rocRAND methods for generating normally distributed values
+ */
+typedef enum rocrand_normal_method
+{
+    ROCRAND_NORMAL_METHOD_BOX_MULLER = 700, ///< Box-Muller transformation (default)
+    ROCRAND_NORMAL_METHOD_ZIGGURAT   = 701, ///< 256-layer ziggurat rejection sampling
+    ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR
+    = 702, ///< Marsaglia polar rejection sampling (no trigonometry; double precision)
+    ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT
+    = 703 ///< Double outputs computed with the single-precision transform (reduced accuracy)
+} rocrand_normal_method;
+
+/**
+ * \brief rocRAND launch error reporting modes
+ */
+typedef enum rocrand_error_mode
+{
+    ROCRAND_ERRORS_IMMEDIATE
+    = 800, ///< Launch errors are checked after every generation call (default)
+    ROCRAND_ERRORS_DEFERRED = 801 ///< Launch errors surface at rocrand_query_status()
+} rocrand_error_mode;
+
+/**
+ * \brief rocRAND per-generator statistics
+ *
+ * Filled by rocrand_get_statistics(). Collection is off by default and
+ * enabled per generator with rocrand_set_statistics_enabled().
+ */
+typedef struct rocrand_stats_st
+{
+    unsigned long long kernel_launches; ///< Number of generation kernel launches
+    unsigned long long bytes_generated; ///< Total bytes written by generation kernels
+    unsigned long long reallocations;   ///< Internal device memory reallocations
+    double             kernel_time_ms;  ///< Accumulated kernel time in milliseconds,
+                                        ///< measured with HIP events
+} rocrand_stats;
+
+/**
+ * \brief First four moments of a generated sample
+ *
+ * Filled by rocrand_generate_statistics(). The variance is the second
+ * central moment; skewness and kurtosis are the standardized third and
+ * fourth central moments (the kurtosis is not the excess kurtosis).
+ */
+typedef struct rocrand_moments_st
+{
+    double mean;     ///< Sample mean
+    double variance; ///< Sample variance
+    double skewness; ///< Standardized third central moment
+    double kurtosis; ///< Standardized fourth central moment
+} rocrand_moments;
+
+/**
+ * \brief Kind of a generation call described by rocrand_call_descriptor.
+ *
+ * Each value names one of the generation functions of the host API.
+ */
+typedef enum rocrand_call_kind
+{
+    ROCRAND_CALL_UNIFORM_INT        = 0,  ///< rocrand_generate()
+    ROCRAND_CALL_UNIFORM_LONG_LONG  = 1,  ///< rocrand_generate_long_long()
+    ROCRAND_CALL_UNIFORM_CHAR       = 2,  ///< rocrand_generate_char()
+    ROCRAND_CALL_UNIFORM_SHORT      = 3,  ///< rocrand_generate_short()
+    ROCRAND_CALL_UNIFORM_FLOAT      = 4,  ///< rocrand_generate_uniform()
+    ROCRAND_CALL_UNIFORM_DOUBLE     = 5,  ///< rocrand_generate_uniform_double()
+    ROCRAND_CALL_UNIFORM_HALF       = 6,  ///< rocrand_generate_uniform_half()
+    ROCRAND_CALL_NORMAL_FLOAT       = 7,  ///< rocrand_generate_normal()
+    ROCRAND_CALL_NORMAL_DOUBLE      = 8,  ///< rocrand_generate_normal_double()
+    ROCRAND_CALL_NORMAL_HALF        = 9,  ///< rocrand_generate_normal_half()
+    ROCRAND_CALL_LOG_NORMAL_FLOAT   = 10, ///< rocrand_generate_log_normal()
+    ROCRAND_CALL_LOG_NORMAL_DOUBLE  = 11, ///< rocrand_generate_log_normal_double()
+    ROCRAND_CALL_LOG_NORMAL_HALF    = 12, ///< rocrand_generate_log_normal_half()
+    ROCRAND_CALL_POISSON            = 13, ///< rocrand_generate_poisson()
+    ROCRAND_CALL_EXPONENTIAL_FLOAT  = 14, ///< rocrand_generate_exponential()
+    ROCRAND_CALL_EXPONENTIAL_DOUBLE = 15, ///< rocrand_generate_exponential_double()
+    ROCRAND_CALL_UNIFORM_BF16       = 16, ///< rocrand_generate_uniform_bf16()
+    ROCRAND_CALL_NORMAL_BF16        = 17  ///< rocrand_generate_normal_bf16()
+} rocrand_call_kind;
+
+/**
+ * \brief Describes one generation call for rocrand_warmup().
+ */
+typedef struct rocrand_call_descriptor_st
+{
+    rocrand_call_kind kind;   ///< Generation function the call uses
+    size_t            size;   ///< Number of values the call generates
+    double            lambda; ///< Lambda of the Poisson or exponential
+                              ///< distribution, ignored by other kinds
+} rocrand_call_descriptor;
+
+/**
+ * \brief Describes one output buffer of rocrand_generate_multi().
+ */
+typedef struct rocrand_multi_descriptor_st
+{
+    void *            data;   ///< Destination buffer of the fill
+    rocrand_call_kind kind;   ///< Distribution and value type of the fill
+    double            mean;   ///< Mean of the normal distribution,
+                              ///< ignored by other kinds
+    double            stddev; ///< Standard deviation of the normal
+                              ///< distribution, ignored by other kinds
+    double            lambda; ///< Lambda of the exponential distribution,
+                              ///< ignored by other kinds
+} rocrand_multi_descriptor;
+
 // Host API function
 
 /**
@@ -132,10 +296,22 @@ typedef enum rocrand_ordering
  * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
  * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
  * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_PCG64
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO256PP
+ * - ROCRAND_RNG_PSEUDO_CHACHA20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_13
+ * - ROCRAND_RNG_PSEUDO_SQUARES32
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_WELL19937
+ * - ROCRAND_RNG_PSEUDO_ADAPTIVE
  * - ROCRAND_RNG_QUASI_SOBOL32
  * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
  * - ROCRAND_RNG_QUASI_SOBOL64
  * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ * - ROCRAND_RNG_QUASI_SOBOL32_OWEN
+ * - ROCRAND_RNG_QUASI_HALTON
+ * - ROCRAND_RNG_QUASI_LATTICE
  *
  * \param generator - Pointer to generator
  * \param rng_type - Type of generator to create
@@ -152,247 +328,648 @@ rocrand_status ROCRANDAPI
 rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type);
 
 /**
- * \brief Destroys random number generator.
+ * \brief Creates a new random number generator that generates on the host.
  *
- * Destroys random number generator and frees related memory.
+ * Creates a new random number generator of type \p rng_type that runs its
+ * generation loops on the host CPU, parallelized with OpenMP when the
+ * library is built with it, instead of launching HIP kernels. The
+ * generator can therefore be used on nodes without a HIP device, and the
+ * output buffers passed to the generate calls must be host-accessible.
  *
- * \param generator - Generator to be destroyed
+ * The generated sequences are bit-identical to the sequences of a device
+ * generator of the same type and seed using the
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT ordering, which is the
+ * ordering the created generator is set to. Host generation is supported
+ * for counter-based engines, which can position their state at any output
+ * index in constant time:
+ *
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if generator was destroyed successfully \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p rng_type does not support host generation \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_destroy_generator(rocrand_generator generator);
+rocrand_create_generator_host(rocrand_generator * generator, rocrand_rng_type rng_type);
 
 /**
- * \brief Generates uniformly distributed 32-bit unsigned integers.
+ * \brief Creates a new random number generator seeded from system entropy.
  *
- * Generates \p n uniformly distributed 32-bit unsigned integers and
- * saves them to \p output_data.
+ * Creates a new random number generator of type \p rng_type like
+ * rocrand_create_generator(), and seeds it with a 64-bit value read from
+ * the operating system's entropy source. The seed that was used is
+ * returned in \p seed when \p seed is not NULL, so it can be logged and
+ * passed to rocrand_set_seed() later to reproduce the run. Quasi-random
+ * types have no seed and are returned in their initial state.
  *
- * Generated numbers are between \p 0 and \p 2^32, including \p 0 and
- * excluding \p 2^32.
+ * Values for \p rng_type are the same as for rocrand_create_generator().
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of 32-bit unsigned integers to generate
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param seed - Pointer to the returned seed, or NULL if the seed does not
+ *        need to be reported
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the entropy source could not be read \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ *
  */
-rocrand_status ROCRANDAPI
-rocrand_generate(rocrand_generator generator,
-                 unsigned int * output_data, size_t n);
+rocrand_status ROCRANDAPI rocrand_create_generator_entropy_seeded(rocrand_generator*  generator,
+                                                                  rocrand_rng_type    rng_type,
+                                                                  unsigned long long* seed);
 
 /**
- * \brief Generates uniformly distributed 64-bit unsigned integers.
+ * \brief Creates a new random number generator with stream-ordered setup.
  *
- * Generates \p n uniformly distributed 64-bit unsigned integers and
- * saves them to \p output_data.
+ * Creates a new random number generator of type \p rng_type like
+ * rocrand_create_generator(), sets its stream to \p stream and enqueues
+ * its initialization there instead of leaving it to the first
+ * generation call. For ROCRAND_RNG_PSEUDO_MT19937 the host-side engine
+ * build runs inside a host callback on the stream, so the call returns
+ * after enqueuing and the setup overlaps whatever the host does next;
+ * for the other types the initialization runs like
+ * rocrand_initialize_generator() would run it.
  *
- * Generated numbers are between \p 0 and \p 2^64, including \p 0 and
- * excluding \p 2^64.
+ * Generation calls on the returned generator are ordered behind the
+ * initialization by the stream; do not change the generator's stream or
+ * seed before the initialization has completed (for example with
+ * hipStreamSynchronize()).
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of 64-bit unsigned integers to generate
+ * Values for \p rng_type are the same as for rocrand_create_generator().
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param stream - Stream the setup is enqueued on, NULL for the default
+ * stream
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_TYPE_ERROR if the generator can't natively generate 64-bit random numbers \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_VERSION_MISMATCH if the header file version does not match the
+ *   dynamically linked library version \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if an initialization kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ *
  */
-rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       generator,
-                                                     unsigned long long int* output_data,
-                                                     size_t                  n);
-
-/**
-* \brief Generates uniformly distributed 8-bit unsigned integers.
-*
-* Generates \p n uniformly distributed 8-bit unsigned integers and
-* saves them to \p output_data.
-*
-* Generated numbers are between \p 0 and \p 2^8, including \p 0 and
-* excluding \p 2^8.
-*
-* \param generator - Generator to use
-* \param output_data - Pointer to memory to store generated numbers
-* \param n - Number of 8-bit unsigned integers to generate
-*
-* \return
-* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
-* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
-* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
-* of used quasi-random generator \n
-* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
-*/
-rocrand_status ROCRANDAPI
-rocrand_generate_char(rocrand_generator generator,
-                      unsigned char * output_data, size_t n);
+rocrand_status ROCRANDAPI rocrand_create_generator_async(rocrand_generator* generator,
+                                                         rocrand_rng_type   rng_type,
+                                                         hipStream_t        stream);
 
 /**
-* \brief Generates uniformly distributed 16-bit unsigned integers.
-*
-* Generates \p n uniformly distributed 16-bit unsigned integers and
-* saves them to \p output_data.
-*
-* Generated numbers are between \p 0 and \p 2^16, including \p 0 and
-* excluding \p 2^16.
-*
-* \param generator - Generator to use
-* \param output_data - Pointer to memory to store generated numbers
-* \param n - Number of 16-bit unsigned integers to generate
-*
-* \return
-* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
-* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
-* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
-* of used quasi-random generator \n
-* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
-*/
-rocrand_status ROCRANDAPI
-rocrand_generate_short(rocrand_generator generator,
-                       unsigned short * output_data, size_t n);
+ * \brief Forks a generator into a new generator on disjoint subsequences.
+ *
+ * Creates a new generator of the same type as \p parent with the same
+ * seed, offset, ordering, stream, math mode, normal method and
+ * antithetic setting, and skips it ahead to a block of 2^48
+ * subsequences that no generator in the process has been assigned
+ * before. The counter-based engines place every subsequence on a
+ * disjoint slice of the period, so the clone's output can never overlap
+ * the output of \p parent, of any other clone, or of the generator
+ * \p parent was itself cloned from - no offset arithmetic is needed in
+ * the caller. Cloning costs no more than creating a generator; the
+ * engines reach any subsequence in constant time through their
+ * subsequence constructor argument, so fork-per-task schemes are cheap
+ * even for thousands of tasks.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7 and ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * the generators that expose constant-cost subsequence skips. The block
+ * numbering allows 65535 clones per process; later calls fail with
+ * ROCRAND_STATUS_OUT_OF_RANGE.
+ *
+ * \param parent - Generator to fork
+ * \param child - Pointer to the new generator
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if \p parent wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the type of \p parent does not support cloning \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the process ran out of clone blocks \n
+ * - ROCRAND_STATUS_SUCCESS if the clone was created successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_clone_generator(rocrand_generator  parent,
+                                                  rocrand_generator* child);
 
 /**
- * \brief Generates uniformly distributed \p float values.
+ * \brief Writes a pre-generated random tape to a file.
  *
- * Generates \p n uniformly distributed 32-bit floating-point values
- * and saves them to \p output_data.
- *
- * Generated numbers are between \p 0.0f and \p 1.0f, excluding \p 0.0f and
- * including \p 1.0f.
+ * Generates \p n_bytes of raw output with \p generator and writes them
+ * to the file at \p path behind a fixed binary header that records the
+ * generator type, its seed, \p n_bytes and the ROCRAND_VERSION of the
+ * writing library. The payload is the byte-exact stream
+ * rocrand_generate() would have produced, generated and copied out in
+ * chunks, so tapes larger than device memory can be written. The file
+ * is replayed with rocrand_create_tape_generator().
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>float</tt>s to generate
+ * \param generator - Generator to record
+ * \param path - Path of the tape file to write
+ * \param n_bytes - Payload size to record, a multiple of 4
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the chunk buffers could not be
+ * allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p path is NULL or \p n_bytes is zero
+ * or not a multiple of 4 \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the file could not be written \n
+ * - ROCRAND_STATUS_SUCCESS if the tape was successfully written \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform(rocrand_generator generator,
-                         float * output_data, size_t n);
+rocrand_write_tape(rocrand_generator generator, const char * path, size_t n_bytes);
 
 /**
- * \brief Generates uniformly distributed double-precision floating-point values.
+ * \brief Creates a generator replaying a pre-generated random tape.
+ *
+ * Opens the tape file at \p path written by rocrand_write_tape() and
+ * returns a generator of type ROCRAND_RNG_TAPE that serves
+ * rocrand_generate() and the other raw integer generate calls from it.
+ * On POSIX systems the file is memory-mapped and advised into the page
+ * cache on creation, so the generate calls copy host-to-device from
+ * resident pages; on Windows the payload is read into a host buffer up
+ * front. Either way the served stream is the recorded bytes independent
+ * of the library version that wrote them. A generate call that would read past
+ * the end of the tape fails with ROCRAND_STATUS_OUT_OF_RANGE and writes
+ * nothing; rocrand_set_offset() repositions the tape at a 32-bit value
+ * index. Typed distribution calls are not supported and return
+ * ROCRAND_STATUS_TYPE_ERROR.
  *
- * Generates \p n uniformly distributed 64-bit double-precision floating-point
- * values and saves them to \p output_data.
+ * \param generator - Pointer to generator
+ * \param path - Path of the tape file to replay
  *
- * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
- * including \p 1.0.
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the file could not be mapped \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the file is not a tape file or is
+ * truncated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the file could not be opened \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_tape_generator(rocrand_generator * generator, const char * path);
+
+/**
+ * \brief Destroys random number generator.
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>double</tt>s to generate
+ * Destroys random number generator and frees related memory.
+ *
+ * \param generator - Generator to be destroyed
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_SUCCESS if generator was destroyed successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform_double(rocrand_generator generator,
-                                double * output_data, size_t n);
+rocrand_destroy_generator(rocrand_generator generator);
 
 /**
- * \brief Generates uniformly distributed half-precision floating-point values.
+ * \brief Creates a pool of random number generators of one type.
  *
- * Generates \p n uniformly distributed 16-bit half-precision floating-point
- * values and saves them to \p output_data.
+ * Creates a pool that recycles generators of type \p rng_type and returns
+ * it in \p pool. Generators acquired from the pool with
+ * rocrand_acquire_generator() keep their device allocations when they are
+ * returned with rocrand_release_generator(), so acquiring a recycled
+ * generator only reseeds it instead of constructing a new one.
  *
- * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
- * including \p 1.0.
+ * Values for \p rng_type are the same as for rocrand_create_generator().
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>half</tt>s to generate
+ * \param pool - Pointer to pool
+ * \param rng_type - Type of the generators in the pool
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pool is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if pool was created successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform_half(rocrand_generator generator,
-                              half * output_data, size_t n);
+rocrand_create_generator_pool(rocrand_generator_pool * pool, rocrand_rng_type rng_type);
 
 /**
- * \brief Generates normally distributed \p float values.
+ * \brief Destroys a generator pool.
  *
- * Generates \p n normally distributed distributed 32-bit floating-point
- * values and saves them to \p output_data.
+ * Destroys the pool and all generators currently held by it. Generators
+ * that are still acquired are not destroyed; they must be destroyed with
+ * rocrand_destroy_generator() by the caller.
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>float</tt>s to generate
- * \param mean - Mean value of normal distribution
- * \param stddev - Standard deviation value of normal distribution
+ * \param pool - Pool to be destroyed
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_NOT_CREATED if the pool wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if pool was destroyed successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_normal(rocrand_generator generator,
-                        float * output_data, size_t n,
-                        float mean, float stddev);
+rocrand_destroy_generator_pool(rocrand_generator_pool pool);
 
 /**
- * \brief Generates normally distributed \p double values.
+ * \brief Acquires a generator from a pool.
  *
- * Generates \p n normally distributed 64-bit double-precision floating-point
- * numbers and saves them to \p output_data.
+ * Takes a generator from \p pool, seeds it with \p seed, and returns it
+ * in \p generator. A recycled generator is reused when one is available,
+ * otherwise a new generator is created. Reseeding is the only work done
+ * on a recycled generator; generator types that do not have a seed are
+ * returned in their initial state and \p seed is ignored.
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>double</tt>s to generate
- * \param mean - Mean value of normal distribution
- * \param stddev - Standard deviation value of normal distribution
+ * The acquired generator is used like any other generator and is given
+ * back to the pool with rocrand_release_generator().
+ *
+ * \param pool - Pool to acquire from
+ * \param generator - Pointer to generator
+ * \param seed - New seed value
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_NOT_CREATED if the pool wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p generator is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if a generator was acquired successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_normal_double(rocrand_generator generator,
-                               double * output_data, size_t n,
-                               double mean, double stddev);
+rocrand_acquire_generator(rocrand_generator_pool pool,
+                          rocrand_generator * generator,
+                          unsigned long long seed);
 
 /**
-* \brief Generates normally distributed \p half values.
-*
-* Generates \p n normally distributed 16-bit half-precision floating-point
-* numbers and saves them to \p output_data.
+ * \brief Returns a generator to its pool.
+ *
+ * Returns \p generator to \p pool so a later rocrand_acquire_generator()
+ * call can reuse it together with its device allocations. The generator
+ * must have been acquired from a pool of the same generator type.
+ *
+ * \param pool - Pool to return the generator to
+ * \param generator - Generator to be returned
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the pool or the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not match the pool \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_release_generator(rocrand_generator_pool pool, rocrand_generator generator);
+
+/**
+ * \brief Creates a generator whose sequence is partitioned across devices.
+ *
+ * Creates one logical generator backed by a per-device generator and a
+ * per-device stream on each of the \p n_devices devices in \p devices.
+ * Every fill splits into per-device extents of one logical sequence
+ * with offset arithmetic on the shared counter, so the concatenated
+ * output equals what a single-device generator of the same seed would
+ * produce. The same device may appear several times to hold several
+ * shards.
+ *
+ * Only ROCRAND_RNG_PSEUDO_PHILOX4_32_10 is supported: a counter-based
+ * engine can place every shard at an exact value position without
+ * walking state.
+ *
+ * \param generator - Pointer to the multi-device generator
+ * \param rng_type - Type of the generator to create
+ * \param devices - Host array of \p n_devices HIP device ids
+ * \param n_devices - Number of devices (and shards)
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p generator or \p devices is NULL,
+ * \p n_devices is zero, or a device id is invalid \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p rng_type is not supported \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_multi_gpu(rocrand_generator_multi_gpu * generator,
+                                   rocrand_rng_type rng_type,
+                                   const int * devices,
+                                   unsigned int n_devices);
+
+/**
+ * \brief Destroys a multi-device generator.
+ *
+ * Destroys the per-device generators and streams and the logical
+ * generator itself.
+ *
+ * \param generator - Multi-device generator to destroy
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_generator_multi_gpu(rocrand_generator_multi_gpu generator);
+
+/**
+ * \brief Sets the seed of a multi-device generator.
+ *
+ * Sets the seed of every per-device generator to \p seed and resets the
+ * logical sequence to its start.
+ *
+ * \param generator - Multi-device generator to modify
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_seed_multi_gpu(rocrand_generator_multi_gpu generator, unsigned long long seed);
+
+/**
+ * \brief Sets the sequence position of a multi-device generator.
+ *
+ * Moves the logical sequence to \p offset; the next fill starts there,
+ * like rocrand_set_offset() on a single-device generator.
+ *
+ * \param generator - Multi-device generator to modify
+ * \param offset - Absolute position in the sequence, in values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the offset was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_offset_multi_gpu(rocrand_generator_multi_gpu generator, unsigned long long offset);
+
+/**
+ * \brief Generates one logical fill across all devices.
+ *
+ * Fills buffer k, which must reside on device k of the generator, with
+ * <tt>sizes[k]</tt> uniformly distributed 32-bit <tt>unsigned int</tt>
+ * values. The shards are consecutive extents of the logical sequence in
+ * device order, so concatenating the buffers yields exactly the values
+ * a single-device generator of the same seed would produce at the same
+ * position. The launches run concurrently on the per-device streams;
+ * the call returns after all of them have completed.
+ *
+ * \param generator - Multi-device generator to use
+ * \param outputs - Host array of per-device output pointers
+ * \param sizes - Host array of per-device fill sizes, in values; a size
+ * of zero skips the device
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p outputs or \p sizes is NULL, or an
+ * output pointer is NULL while its size is not zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multi_gpu(rocrand_generator_multi_gpu generator,
+                           unsigned int * const * outputs,
+                           const size_t * sizes);
+
+/**
+ * \brief Fills \p output_data with uniformly distributed 32-bit
+ * unsigned integers using the process-wide default generator.
+ *
+ * Generates \p n values as rocrand_generate() would and launches the
+ * generation on \p stream. The call is backed by a per-device default
+ * generator of type ROCRAND_RNG_PSEUDO_PHILOX4_32_10, created lazily
+ * on the first rocrand_fill_* call made on the device current at the
+ * time of the call and kept for the lifetime of the process. The
+ * default generators use the default seed, so consecutive fills on one
+ * device continue one sequence; call sites needing seeding, offsets or
+ * another generator type should create their own generator.
+ *
+ * The rocrand_fill_* calls are thread-safe: concurrent fills on the
+ * same device are serialized on the default generator.
+ *
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the default generator could not
+ *   be created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the current device could not be
+ *   queried \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_fill(unsigned int * output_data, size_t n, hipStream_t stream);
+
+/**
+ * \brief Fills \p output_data with uniformly distributed \p float values
+ * using the process-wide default generator.
+ *
+ * Generates \p n values as rocrand_generate_uniform() would, backed by
+ * the per-device default generator described at rocrand_fill().
+ *
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of floats to generate
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return See rocrand_fill()
+ */
+rocrand_status ROCRANDAPI
+rocrand_fill_uniform(float * output_data, size_t n, hipStream_t stream);
+
+/**
+ * \brief Fills \p output_data with uniformly distributed \p double values
+ * using the process-wide default generator.
+ *
+ * Generates \p n values as rocrand_generate_uniform_double() would,
+ * backed by the per-device default generator described at
+ * rocrand_fill().
+ *
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of doubles to generate
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return See rocrand_fill()
+ */
+rocrand_status ROCRANDAPI
+rocrand_fill_uniform_double(double * output_data, size_t n, hipStream_t stream);
+
+/**
+ * \brief Fills \p output_data with normally distributed \p float values
+ * using the process-wide default generator.
+ *
+ * Generates \p n values as rocrand_generate_normal() would, backed by
+ * the per-device default generator described at rocrand_fill().
+ *
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of floats to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return See rocrand_fill()
+ */
+rocrand_status ROCRANDAPI
+rocrand_fill_normal(float * output_data, size_t n,
+                    float mean, float stddev, hipStream_t stream);
+
+/**
+ * \brief Fills \p output_data with normally distributed \p double values
+ * using the process-wide default generator.
+ *
+ * Generates \p n values as rocrand_generate_normal_double() would,
+ * backed by the per-device default generator described at
+ * rocrand_fill().
+ *
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of doubles to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return See rocrand_fill()
+ */
+rocrand_status ROCRANDAPI
+rocrand_fill_normal_double(double * output_data, size_t n,
+                           double mean, double stddev, hipStream_t stream);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0 and \p 2^32, including \p 0 and
+ * excluding \p 2^32.
+ *
+ * With ROCRAND_RNG_PSEUDO_PHILOX4_32_10 the destination may also be
+ * pinned host, managed, or plain pageable host memory; the placement is
+ * detected automatically. Pinned and managed destinations are written
+ * directly by the generation kernels without a staging copy, and the
+ * fill is asynchronous as for device memory. Pageable destinations are
+ * staged through an internal device buffer and the call returns only
+ * once the values are in the buffer.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate(rocrand_generator generator,
+                 unsigned int * output_data, size_t n);
+
+/**
+ * \brief Generates 32-bit unsigned integers at an absolute position of
+ * the sequence, without consuming generator state.
+ *
+ * Generates the \p n uniformly distributed 32-bit unsigned integers
+ * that positions [\p offset, \p offset + \p n) of the generator's
+ * sequence hold and saves them to \p output_data. The position is
+ * relative to the configured start of the sequence (seed and
+ * rocrand_set_offset()), not to the values generated so far, and the
+ * call does not advance the generator, so it composes with neither
+ * previous nor later rocrand_generate() calls: generating the same
+ * range twice returns the same values. Several host threads can
+ * therefore fill disjoint regions of one logical sequence through one
+ * generator without cloning or locking it, and a failed fill can
+ * simply be retried. All calls launch on the generator's stream, and
+ * statistics are not collected for them.
+ *
+ * Positioning costs one constant-cost counter skip, so the function is
+ * supported by the counter-based generator types (Philox, Threefry and
+ * the other types rocrand_skipahead() lists).
+ *
+ * \param generator - Generator to use
+ * \param offset - Absolute position of the first generated value
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not support
+ *   positional generation \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p offset does not fall on an output
+ *   boundary of the generator's native output width \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_at(rocrand_generator generator, unsigned long long offset,
+                    unsigned int * output_data, size_t n);
+
+/**
+ * \brief Generates one 32-bit unsigned integer per element of a seed
+ * array, without consuming generator state.
+ *
+ * For every i in [0, \p n), draws \p output_data[i] from the random
+ * stream that \p seeds[i] keys, positioned at the generator's offset
+ * (rocrand_set_offset(), 0 by default). Value i depends only on
+ * \p seeds[i] and the offset — not on the generator's seed, the values
+ * generated so far, or the position of i in the fill — so reordering
+ * the seed array reorders the outputs with it, and equal seeds produce
+ * equal values. This addresses elements by a user-chosen key instead
+ * of by sequence position; use rocrand_generate_at() to address by
+ * position.
+ *
+ * Each element initializes a fresh engine from its seed, which is a
+ * constant-cost operation for the counter-based generator types
+ * (Philox and Threefry variants) and the other types
+ * rocrand_generate_at() supports. The call launches on the generator's
+ * stream and does not advance the generator.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param seeds - Pointer to \p n seeds in device memory, one per value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not support
+ *   seed-array generation \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_seeded(rocrand_generator generator,
+                        unsigned int * output_data, size_t n,
+                        const unsigned long long * seeds);
+
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0 and \p 2^64, including \p 0 and
+ * excluding \p 2^64.
+ *
+ * Generators with native 64-bit output (Sobol64 family, ThreeFry 64 bit
+ * variants) are used directly; 32-bit pseudo-random engines combine two
+ * engine outputs per value inside the generation kernel.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_TYPE_ERROR if the generator can't generate 64-bit random numbers \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       generator,
+                                                     unsigned long long int* output_data,
+                                                     size_t                  n);
+
+/**
+* \brief Generates uniformly distributed 8-bit unsigned integers.
+*
+* Generates \p n uniformly distributed 8-bit unsigned integers and
+* saves them to \p output_data.
+*
+* Generated numbers are between \p 0 and \p 2^8, including \p 0 and
+* excluding \p 2^8.
 *
 * \param generator - Generator to use
 * \param output_data - Pointer to memory to store generated numbers
-* \param n - Number of <tt>half</tt>s to generate
-* \param mean - Mean value of normal distribution
-* \param stddev - Standard deviation value of normal distribution
+* \param n - Number of 8-bit unsigned integers to generate
 *
 * \return
 * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
@@ -402,249 +979,2861 @@ rocrand_generate_normal_double(rocrand_generator generator,
 * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
 */
 rocrand_status ROCRANDAPI
-rocrand_generate_normal_half(rocrand_generator generator,
-                             half * output_data, size_t n,
-                             half mean, half stddev);
+rocrand_generate_char(rocrand_generator generator,
+                      unsigned char * output_data, size_t n);
+
+/**
+* \brief Generates uniformly distributed 16-bit unsigned integers.
+*
+* Generates \p n uniformly distributed 16-bit unsigned integers and
+* saves them to \p output_data.
+*
+* Generated numbers are between \p 0 and \p 2^16, including \p 0 and
+* excluding \p 2^16.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of 16-bit unsigned integers to generate
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_short(rocrand_generator generator,
+                       unsigned short * output_data, size_t n);
+
+/**
+* \brief Generates a densely packed stream of uniform \p bit_width -bit symbols.
+*
+* Generates \p n uniformly distributed \p bit_width -bit symbols and
+* saves them to \p output_data packed contiguously: symbol \p i occupies
+* bits [<tt>i * bit_width</tt>, <tt>(i + 1) * bit_width</tt>) of the
+* output, counting bits from the least significant bit of the first
+* byte. No repacking pass is needed on the host.
+*
+* Contiguously packed uniform symbols are exactly \p bit_width -bit
+* slices of a uniform bit stream, so the call writes the generator's
+* (uniformized) raw output directly and consumes every generated bit.
+* \p output_data must hold
+* ceil(<tt>n * bit_width</tt> / 8) bytes; unused bits of the
+* last byte hold unspecified random values.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store the packed symbols
+* \param n - Number of symbols to generate
+* \param bit_width - Width of one symbol in bits, between 1 and 32
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_OUT_OF_RANGE if \p bit_width is not in [1, 32] \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if the packed size is not a multiple
+* of the dimension of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_bits(rocrand_generator generator,
+                      void * output_data, size_t n, unsigned int bit_width);
+
+/**
+ * \brief Generates uniformly distributed \p float values.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values
+ * and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0f and \p 1.0f, excluding \p 0.0f and
+ * including \p 1.0f.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform(rocrand_generator generator,
+                         float * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p float values in stream partitions.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values and
+ * saves them to \p output_data, splitting the fill into \p num_streams
+ * contiguous extents with one kernel launch per extent on the
+ * corresponding stream of \p streams. Each launch's engine is skipped
+ * to the exact sequence position of its extent, and the extents hold
+ * the same values as \p num_streams rocrand_generate_uniform() calls of
+ * the same sizes. The generator's stream waits on all extents, so work
+ * queued on it afterwards sees the whole fill; the partition streams
+ * themselves can overlap the extents with each other and with unrelated
+ * work.
+ *
+ * Only the counter-based generator types (Philox, Threefry) support
+ * partitioned generation; their launches carry a private engine copy,
+ * so extents share no device state.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param streams - Host pointer to \p num_streams streams to launch on
+ * \param num_streams - Number of partitions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p streams is NULL or \p num_streams
+ * is zero \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support partitioned
+ * generation \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if joining the partition streams failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_partitioned(rocrand_generator generator,
+                                     float * output_data, size_t n,
+                                     const hipStream_t * streams,
+                                     unsigned int num_streams);
+
+/**
+ * \brief Generates uniformly distributed \p float values into many buffers.
+ *
+ * Fills \p n_buffers separate output buffers with uniformly distributed
+ * 32-bit floating-point values in a single call and a single kernel
+ * launch; buffer \p b receives <tt>sizes[b]</tt> values. The buffers
+ * hold the same values as \p n_buffers sequential
+ * rocrand_generate_uniform() calls of the same sizes, so a caller that
+ * fills many small buffers per step pays the host-side call and launch
+ * overhead once per batch instead of once per buffer.
+ *
+ * \p buffers and \p sizes are host arrays; the buffers they describe
+ * are in device memory (host memory for generators created with
+ * rocrand_create_generator_host()). A buffer of size zero is skipped.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param buffers - Host array of \p n_buffers output buffer pointers
+ * \param sizes - Host array of \p n_buffers buffer sizes, in <tt>float</tt>s
+ * \param n_buffers - Number of buffers to fill
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p buffers or \p sizes is NULL or
+ * \p n_buffers is zero \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the descriptor memory could not
+ * be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_batched(rocrand_generator generator,
+                                 float * const * buffers,
+                                 const size_t * sizes,
+                                 unsigned int n_buffers);
+
+/**
+ * \brief Generates uniformly distributed 32-bit integers into many buffers.
+ *
+ * Fills \p n_buffers separate output buffers with uniformly distributed
+ * 32-bit <tt>unsigned int</tt> values in a single call and a single
+ * kernel launch; buffer \p b receives <tt>sizes[b]</tt> values. A
+ * caller that fills many small buffers per step pays the host-side call
+ * and launch overhead once per batch instead of once per buffer.
+ *
+ * \p buffers and \p sizes are host arrays; the buffers they describe
+ * are in device memory (host memory for generators created with
+ * rocrand_create_generator_host()). A buffer of size zero is skipped.
+ *
+ * For ROCRAND_RNG_PSEUDO_PHILOX4_32_10 the buffers hold the same values
+ * as \p n_buffers sequential rocrand_generate() calls of the same
+ * sizes. For ROCRAND_RNG_PSEUDO_XORWOW the values are not the same
+ * values sequential calls would produce, but every value is consumed
+ * from the engines exactly once, so no values repeat between the
+ * buffers.
+ *
+ * \param generator - Generator to use
+ * \param buffers - Host array of \p n_buffers output buffer pointers
+ * \param sizes - Host array of \p n_buffers buffer sizes, in values
+ * \param n_buffers - Number of buffers to fill
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p buffers or \p sizes is NULL,
+ * \p n_buffers is zero, or a buffer pointer is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the descriptor memory could not
+ * be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       unsigned int * const * buffers,
+                       const size_t * sizes,
+                       unsigned int n_buffers);
+
+/**
+ * \brief Generates uniformly distributed double-precision floating-point values.
+ *
+ * Generates \p n uniformly distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double(rocrand_generator generator,
+                                double * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed half-precision floating-point values.
+ *
+ * Generates \p n uniformly distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>half</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              half * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed bfloat16 floating-point values.
+ *
+ * Generates \p n uniformly distributed 16-bit bfloat16 floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>hip_bfloat16</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bf16(rocrand_generator generator,
+                              hip_bfloat16 * output_data, size_t n);
+
+/**
+ * \brief Generates independently scrambled replicates of a quasi-random point set.
+ *
+ * Generates \p n_replicates copies of the next \p n uniformly distributed
+ * <tt>float</tt>s of the quasi-random sequence, each scrambled with the
+ * corresponding seed from \p seeds, and saves them to \p output_data.
+ * Replicate \p i occupies <tt>output_data[i * n]</tt> to
+ * <tt>output_data[(i + 1) * n - 1]</tt> and equals what a generator seeded
+ * with <tt>seeds[i]</tt> would produce from the same offset.
+ *
+ * All replicates are generated in one kernel launch, so the direction
+ * vectors are only read once per block; for randomized quasi-Monte Carlo
+ * estimators this is considerably faster than one generate call per
+ * scramble. The generator's offset advances by \p n / dimensions points,
+ * as for a single rocrand_generate_uniform() call.
+ *
+ * Only ROCRAND_RNG_QUASI_SOBOL32_OWEN generators support this function,
+ * as the other quasi-random generator types have no per-seed scrambling.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate per replicate
+ * \param n_replicates - Number of replicates to generate
+ * \param seeds - Host pointer to \p n_replicates scramble seeds
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data or \p seeds is NULL, or
+ * \p n_replicates is zero \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not of type
+ * ROCRAND_RNG_QUASI_SOBOL32_OWEN \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory for the seeds could not be
+ * allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_quasi_replicates(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  unsigned int n_replicates,
+                                  const unsigned long long * seeds);
+
+/**
+ * \brief Generates the same uniformly distributed points as float and double.
+ *
+ * Generates the next \p n points of the quasi-random sequence and saves
+ * them to both \p float_output_data, converted to <tt>float</tt>, and
+ * \p double_output_data, converted to <tt>double</tt>. Both views hold
+ * the same points of the sequence and each equals what a separate
+ * rocrand_generate_uniform() or rocrand_generate_uniform_double() call
+ * from the same offset would produce, but the integer sequence is only
+ * generated once. The generator's offset advances as for a single
+ * generate call.
+ *
+ * Only ROCRAND_RNG_QUASI_SOBOL32 generators support this function.
+ *
+ * \param generator - Generator to use
+ * \param float_output_data - Pointer to memory to store the float view
+ * \param double_output_data - Pointer to memory to store the double view
+ * \param n - Number of values to generate into each view
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p float_output_data or
+ * \p double_output_data is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not of type
+ * ROCRAND_RNG_QUASI_SOBOL32 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_float_double(rocrand_generator generator,
+                                      float * float_output_data,
+                                      double * double_output_data,
+                                      size_t n);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers from a range.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers between
+ * \p lo and \p hi, including \p lo and excluding \p hi, and saves them to
+ * \p output_data.
+ *
+ * Values are mapped to the range with Lemire's multiply-shift technique
+ * inside the generation kernel, so the output is free of modulo bias.
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int_range(rocrand_generator generator,
+                                   unsigned int * output_data, size_t n,
+                                   unsigned int lo, unsigned int hi);
+
+/**
+ * \brief Generates uniformly distributed floats from a range.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values
+ * between \p lo and \p hi, excluding \p lo and including \p hi, and
+ * saves them to \p output_data.
+ *
+ * The affine scale into the range is applied inside the generation
+ * kernel while the converted value is still in a register, so the call
+ * costs the same bandwidth as rocrand_generate_uniform() instead of a
+ * follow-up scaling pass over the buffer.
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param lo - Lower bound of the range (exclusive)
+ * \param hi - Upper bound of the range (inclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range(rocrand_generator generator,
+                               float * output_data, size_t n,
+                               float lo, float hi);
+
+/**
+ * \brief Generates uniformly distributed doubles from a range.
+ *
+ * Generates \p n uniformly distributed 64-bit floating-point values
+ * between \p lo and \p hi, excluding \p lo and including \p hi, and
+ * saves them to \p output_data. The scale is applied in-register like
+ * rocrand_generate_uniform_range().
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param lo - Lower bound of the range (exclusive)
+ * \param hi - Upper bound of the range (inclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range_double(rocrand_generator generator,
+                                      double * output_data, size_t n,
+                                      double lo, double hi);
+
+/**
+ * \brief Generates uniformly distributed halfs from a range.
+ *
+ * Generates \p n uniformly distributed 16-bit half-precision
+ * floating-point values between \p lo and \p hi, excluding \p lo and
+ * including \p hi, and saves them to \p output_data. The scale is
+ * applied in-register in single precision before the conversion to
+ * half, like rocrand_generate_uniform_range().
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>half</tt>s to generate
+ * \param lo - Lower bound of the range (exclusive)
+ * \param hi - Upper bound of the range (inclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range_half(rocrand_generator generator,
+                                    half * output_data, size_t n,
+                                    half lo, half hi);
+
+/**
+ * \brief Generates uniformly distributed 8-bit integers from a range.
+ *
+ * Generates \p n uniformly distributed 8-bit signed integers between
+ * \p lo and \p hi, including both bounds, and saves them to
+ * \p output_data. Each 32- or 64-bit engine output is sliced into four
+ * or eight values, so a dither fill runs at a fraction of the bandwidth
+ * of generating floats and quantizing them.
+ *
+ * For ranges that do not divide the 8-bit input space the mapping is
+ * biased by at most one part in 256 per value.
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 8-bit integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (inclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is greater than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int8(rocrand_generator generator,
+                              signed char * output_data, size_t n,
+                              signed char lo, signed char hi);
+
+/**
+ * \brief Generates packed uniformly distributed 4-bit integers from a range.
+ *
+ * Generates <tt>2 * n</tt> uniformly distributed 4-bit signed integers
+ * between \p lo and \p hi, including both bounds, and saves them packed
+ * two per byte to the \p n bytes at \p output_data. The first value of
+ * a pair occupies the low nibble of its byte, and values are stored as
+ * two's complement nibbles. Each 32- or 64-bit engine output is sliced
+ * into eight or sixteen values.
+ *
+ * For ranges that do not divide the 4-bit input space the mapping is
+ * biased by at most one part in 16 per value.
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of bytes to generate, each holding two values
+ * \param lo - Lower bound of the range (inclusive), at least -8
+ * \param hi - Upper bound of the range (inclusive), at most 7
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is greater than \p hi, or the
+ * bounds do not fit in a signed 4-bit value \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int4_packed(rocrand_generator generator,
+                                     unsigned char * output_data, size_t n,
+                                     signed char lo, signed char hi);
+
+/**
+ * \brief Generates normally distributed \p float values.
+ *
+ * Generates \p n normally distributed distributed 32-bit floating-point
+ * values and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p float values as consecutive
+ * (x, y) pairs.
+ *
+ * Generates \p n_vectors pairs of normally distributed 32-bit
+ * floating-point values and saves them to \p output_data as
+ * \p n_vectors consecutive (x, y) pairs (2 * \p n_vectors
+ * <tt>float</tt>s in total, \p float2 layout). The components of a pair
+ * are the two outputs of one Box-Muller transform, written with the
+ * aligned vector stores of the generation kernel, so no separate
+ * interleave pass is needed.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated pairs
+ * \param n_vectors - Number of pairs to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if 2 * \p n_vectors is not a multiple
+ * of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_float2(rocrand_generator generator,
+                               float * output_data, size_t n_vectors,
+                               float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p float values as consecutive
+ * (x, y, z, w) quadruples.
+ *
+ * Generates \p n_vectors quadruples of normally distributed 32-bit
+ * floating-point values and saves them to \p output_data as
+ * \p n_vectors consecutive (x, y, z, w) quadruples (4 * \p n_vectors
+ * <tt>float</tt>s in total, \p float4 layout). The components of a
+ * quadruple are the outputs of two Box-Muller transforms, written with
+ * the aligned vector stores of the generation kernel, so no separate
+ * interleave pass is needed.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated quadruples
+ * \param n_vectors - Number of quadruples to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if 4 * \p n_vectors is not a multiple
+ * of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_float4(rocrand_generator generator,
+                               float * output_data, size_t n_vectors,
+                               float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p double values.
+ *
+ * Generates \p n normally distributed 64-bit double-precision floating-point
+ * numbers and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double mean, double stddev);
+
+/**
+* \brief Generates normally distributed \p half values.
+*
+* Generates \p n normally distributed 16-bit half-precision floating-point
+* numbers and saves them to \p output_data.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of <tt>half</tt>s to generate
+* \param mean - Mean value of normal distribution
+* \param stddev - Standard deviation value of normal distribution
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             half * output_data, size_t n,
+                             half mean, half stddev);
+
+/**
+* \brief Generates normally distributed \p hip_bfloat16 values.
+*
+* Generates \p n normally distributed 16-bit bfloat16 floating-point
+* numbers and saves them to \p output_data.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of <tt>hip_bfloat16</tt>s to generate
+* \param mean - Mean value of normal distribution
+* \param stddev - Standard deviation value of normal distribution
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_bf16(rocrand_generator generator,
+                             hip_bfloat16 * output_data, size_t n,
+                             hip_bfloat16 mean, hip_bfloat16 stddev);
+
+/**
+ * \brief Generates log-normally distributed \p float values.
+ *
+ * Generates \p n log-normally distributed 32-bit floating-point values
+ * and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal(rocrand_generator generator,
+                            float * output_data, size_t n,
+                            float mean, float stddev);
+
+/**
+ * \brief Generates log-normally distributed \p double values.
+ *
+ * Generates \p n log-normally distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double(rocrand_generator generator,
+                                   double * output_data, size_t n,
+                                   double mean, double stddev);
+
+/**
+* \brief Generates log-normally distributed \p half values.
+*
+* Generates \p n log-normally distributed 16-bit half-precision floating-point
+* values and saves them to \p output_data.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of <tt>half</tt>s to generate
+* \param mean - Mean value of log normal distribution
+* \param stddev - Standard deviation value of log normal distribution
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_half(rocrand_generator generator,
+                                 half * output_data, size_t n,
+                                 half mean, half stddev);
+
+/**
+ * \brief Generates exponentially distributed \p float values.
+ *
+ * Generates \p n exponentially distributed 32-bit floating-point values
+ * with rate \p lambda and saves them to \p output_data.
+ *
+ * The inverse CDF transform is applied in-register inside the generation
+ * kernel, so no intermediate uniform buffer is written.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param lambda - Rate parameter of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda);
+
+/**
+ * \brief Generates exponentially distributed \p double values.
+ *
+ * Generates \p n exponentially distributed 64-bit floating-point values
+ * with rate \p lambda and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param lambda - Rate parameter of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda);
+
+/**
+ * \brief Generates Cauchy distributed \p float values.
+ *
+ * Generates \p n Cauchy distributed 32-bit floating-point values
+ * with median \p median and scale \p sigma, and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param median - Median of the Cauchy distribution
+ * \param sigma - Scale parameter of the Cauchy distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p sigma is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float median, float sigma);
+
+/**
+ * \brief Generates Cauchy distributed \p double values.
+ *
+ * Generates \p n Cauchy distributed 64-bit floating-point values
+ * with median \p median and scale \p sigma, and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param median - Median of the Cauchy distribution
+ * \param sigma - Scale parameter of the Cauchy distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p sigma is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double median, double sigma);
+
+/**
+ * \brief Generates Weibull distributed \p float values.
+ *
+ * Generates \p n Weibull distributed 32-bit floating-point values
+ * with shape \p shape and scale \p scale, and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param shape - Shape parameter of the Weibull distribution
+ * \param scale - Scale parameter of the Weibull distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull(rocrand_generator generator,
+                         float * output_data, size_t n,
+                         float shape, float scale);
+
+/**
+ * \brief Generates Weibull distributed \p double values.
+ *
+ * Generates \p n Weibull distributed 64-bit floating-point values
+ * with shape \p shape and scale \p scale, and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param shape - Shape parameter of the Weibull distribution
+ * \param scale - Scale parameter of the Weibull distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not greater than zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull_double(rocrand_generator generator,
+                                double * output_data, size_t n,
+                                double shape, double scale);
+
+/**
+ * \brief Generates truncated normally distributed \p float values.
+ *
+ * Generates \p n normally distributed 32-bit floating-point values
+ * truncated to the range [\p lo, \p hi] and saves them to \p output_data.
+ *
+ * Values outside the range are rejected and regenerated inside the
+ * generation kernel, so no over-generation or host-side compaction
+ * pass is needed.
+ *
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean of the underlying normal distribution
+ * \param stddev - Standard deviation of the underlying normal distribution
+ * \param lo - Lower truncation bound
+ * \param hi - Upper truncation bound
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lo, float hi);
+
+/**
+ * \brief Generates truncated normally distributed \p double values.
+ *
+ * Generates \p n normally distributed 64-bit floating-point values
+ * truncated to the range [\p lo, \p hi] and saves them to \p output_data.
+ *
+ * Supported by all pseudo-random generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean of the underlying normal distribution
+ * \param stddev - Standard deviation of the underlying normal distribution
+ * \param lo - Lower truncation bound
+ * \param hi - Upper truncation bound
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lo is not smaller than \p hi \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_TYPE_ERROR if the generator is a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lo, double hi);
+
+/**
+ * \brief Generates correlated (multivariate) normally distributed \p float vectors.
+ *
+ * Generates \p n_vectors vectors of \p dim correlated normally distributed
+ * 32-bit floating-point values and saves them contiguously to \p output_data
+ * (vector-major layout, \p n_vectors * \p dim values in total).
+ *
+ * The lower triangular Cholesky factor of the desired covariance matrix is
+ * applied to the standard normal variates inside the generation kernel, so
+ * the output buffer is written in a single pass. \p cholesky_factor must
+ * point to a row-major \p dim x \p dim matrix in device memory.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators and dimensions
+ * up to 32.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n_vectors - Number of vectors to generate
+ * \param dim - Dimension of each vector
+ * \param cholesky_factor - Lower triangular Cholesky factor in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dim is zero or greater than 32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data,
+                                     size_t n_vectors, unsigned int dim,
+                                     const float * cholesky_factor);
+
+/**
+ * \brief Generates Dirichlet-distributed \p float vectors.
+ *
+ * Generates \p n_vectors vectors of \p k components drawn from the
+ * Dirichlet distribution with concentration parameters \p alphas and
+ * saves them contiguously to \p output_data (vector-major layout,
+ * \p n_vectors * \p k values in total). \p alphas must point to \p k
+ * positive <tt>float</tt>s in device memory.
+ *
+ * Each vector's \p k gamma draws are generated with the Marsaglia-Tsang
+ * method, kept in registers and normalized before the single store, so
+ * a Dirichlet fill costs the same bandwidth as a plain \p float fill
+ * (no intermediate gamma buffer or normalization pass).
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7 generators and dimensions up to 32.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n_vectors - Number of vectors to generate
+ * \param k - Number of components per vector
+ * \param alphas - Concentration parameters in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p k is zero or greater than 32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_dirichlet(rocrand_generator generator,
+                           float * output_data,
+                           size_t n_vectors, unsigned int k,
+                           const float * alphas);
+
+/**
+ * \brief Generates normally distributed \p floats into a pitched matrix.
+ *
+ * Fills the payload of a column-major \p rows x \p cols matrix whose
+ * columns are \p pitch elements apart (the leading dimension, >= \p rows)
+ * with normally distributed 32-bit floating-point values. Element (i, j)
+ * is stored at <tt>output_data[j * pitch + i]</tt>; the padding between
+ * the columns is neither read nor written, so one launch fills the matrix
+ * without wasting bandwidth on the padding or looping over the columns.
+ *
+ * Element (i, j) receives the value its dense index <tt>j * rows + i</tt>
+ * receives from an index-mapped fill, and the generator state advances
+ * exactly as a dense fill of \p rows * \p cols values would, so pitched
+ * and dense calls can be mixed freely. Under
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT (and for generators created
+ * with rocrand_create_generator_host()) dense fills use the same mapping,
+ * and the payload matches rocrand_generate_normal() of \p rows * \p cols
+ * values exactly.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the matrix to fill
+ * \param rows - Number of rows of the payload
+ * \param cols - Number of columns of the payload
+ * \param pitch - Distance between the starts of consecutive columns, in elements
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is smaller than \p rows \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_2d(rocrand_generator generator,
+                           float * output_data,
+                           size_t rows, size_t cols, size_t pitch,
+                           float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p doubles into a pitched matrix.
+ *
+ * Fills the payload of a column-major \p rows x \p cols matrix whose
+ * columns are \p pitch elements apart (the leading dimension, >= \p rows)
+ * with normally distributed 64-bit floating-point values. The layout,
+ * value mapping and state accounting follow
+ * rocrand_generate_normal_2d().
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to the matrix to fill
+ * \param rows - Number of rows of the payload
+ * \param cols - Number of columns of the payload
+ * \param pitch - Distance between the starts of consecutive columns, in elements
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is smaller than \p rows \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                  double * output_data,
+                                  size_t rows, size_t cols, size_t pitch,
+                                  double mean, double stddev);
+
+/**
+ * \brief Generates Brownian motion paths using the Brownian-bridge construction.
+ *
+ * Generates \p n_paths discrete Brownian motion paths over the time grid
+ * \p times and saves them to \p output_data, path i occupying elements
+ * <tt>output_data[i * n_steps]</tt> to
+ * <tt>output_data[i * n_steps + n_steps - 1]</tt> (the path values at
+ * times[0] to times[n_steps - 1]; every path starts from 0 at time 0).
+ * \p times is a host array of \p n_steps strictly increasing positive
+ * times, and \p n_steps can be at most 64.
+ *
+ * The paths are built with the Brownian-bridge construction: the
+ * terminal value is drawn first and the grid is then bisected so that
+ * construction step k consumes dimension k of a quasi-random point.
+ * The lowest dimensions therefore carry the largest variances of the
+ * path, which concentrates the low-discrepancy structure of the
+ * sequence where it matters most. The whole construction runs inside
+ * the generation kernel with each path held in registers, so no
+ * separate reordering pass over the output is needed. The bridge
+ * coefficients are computed on the host and cached; consecutive calls
+ * over the same time grid reuse them.
+ *
+ * The call sets the generator to \p n_steps dimensions and advances the
+ * sequence by \p n_paths points.
+ *
+ * Supported for ROCRAND_RNG_QUASI_SOBOL32 and
+ * ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated paths
+ * \param n_paths - Number of paths to generate
+ * \param n_steps - Number of time steps per path, at most 64
+ * \param times - Host array of \p n_steps strictly increasing positive times
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n_steps is zero or greater than 64,
+ *   or \p times is not strictly increasing and positive \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                 float * output_data,
+                                 size_t n_paths,
+                                 unsigned int n_steps,
+                                 const float * times);
+
+/**
+ * \brief Generates uniformly distributed 2D unit vectors.
+ *
+ * Generates \p n_vectors directions uniformly distributed on the unit
+ * circle and saves them to \p output_data as \p n_vectors consecutive
+ * (x, y) pairs (2 * \p n_vectors <tt>float</tt>s in total, \p float2
+ * layout). The conversion from engine output to direction runs inside
+ * the generation kernel, so the vectors are written in a single pass
+ * with no separate transform kernel.
+ *
+ * Unit vector generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n_vectors - Number of vectors to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_unit_vector2(rocrand_generator generator,
+                              float * output_data, size_t n_vectors);
+
+/**
+ * \brief Generates uniformly distributed 3D unit vectors.
+ *
+ * Generates \p n_vectors directions uniformly distributed on the unit
+ * sphere and saves them to \p output_data as \p n_vectors consecutive
+ * (x, y, z, 0) quadruples (4 * \p n_vectors <tt>float</tt>s in total);
+ * the fourth component is zero padding that keeps the stores aligned
+ * \p float4 stores. The conversion from engine output to direction runs
+ * inside the generation kernel, so the vectors are written in a single
+ * pass with no separate transform kernel.
+ *
+ * Unit vector generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n_vectors - Number of vectors to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_unit_vector3(rocrand_generator generator,
+                              float * output_data, size_t n_vectors);
+
+/**
+ * \brief Generates uniformly distributed 4D unit vectors.
+ *
+ * Generates \p n_vectors directions uniformly distributed on the unit
+ * 3-sphere and saves them to \p output_data as \p n_vectors consecutive
+ * (x, y, z, w) quadruples (4 * \p n_vectors <tt>float</tt>s in total,
+ * \p float4 layout). The conversion from engine output to direction
+ * runs inside the generation kernel, so the vectors are written in a
+ * single pass with no separate transform kernel.
+ *
+ * Unit vector generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n_vectors - Number of vectors to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_unit_vector4(rocrand_generator generator,
+                              float * output_data, size_t n_vectors);
+
+/**
+ * \brief Generates gamma-distributed \p float values.
+ *
+ * Generates \p n gamma-distributed 32-bit floating-point values
+ * and saves them to \p output_data.
+ *
+ * Values are generated with the Marsaglia-Tsang rejection method fused into
+ * the generation kernel, consuming engine outputs in-register.
+ * Gamma generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param shape - Shape parameter of gamma distribution
+ * \param scale - Scale parameter of gamma distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale);
+
+/**
+ * \brief Generates gamma-distributed \p double values.
+ *
+ * Generates \p n gamma-distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * Gamma generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param shape - Shape parameter of gamma distribution
+ * \param scale - Scale parameter of gamma distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers with per-element rates.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and saves
+ * them to \p output_data. The rate of the value at index \p i is read from
+ * <tt>lambdas[i]</tt>, so \p n samples with heterogeneous rates are
+ * produced by a single kernel launch instead of one call per rate.
+ *
+ * The sampling method is selected per element by the magnitude of its
+ * lambda: Knuth's product method below 64, Atkinson's rejection method up
+ * to 4000, and the normal approximation above. All lambdas must be
+ * positive; out-of-range elements produce unspecified values.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambdas - Device array of \p n lambdas, one per generated value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data, size_t n,
+                               const double * lambdas);
+
+/**
+ * \brief Generates a random permutation of the integers [0, \p n).
+ *
+ * Writes a random permutation of the integers 0, 1, ..., \p n - 1 to
+ * \p output_data in a single pass, with no sort. The permutation is a
+ * keyed Feistel bijection over the output indexes (the round keys are
+ * drawn from the generator's sequence), so it is reproducible per seed
+ * and a new permutation is produced by every call.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store the permutation
+ * \param n - Number of elements to permute, at most 2^32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n is greater than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the permutation was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data, size_t n);
+
+/**
+ * \brief Samples \p k of \p n items without replacement.
+ *
+ * Writes the indexes of \p k items drawn without replacement from
+ * 0, 1, ..., \p n - 1 to \p output_data. If \p weights is NULL the
+ * sample is uniform and is produced in a single kernel launch of O(k)
+ * work, as a prefix of a keyed Feistel permutation of the indexes. If
+ * \p weights points at \p n positive doubles in device memory, item
+ * \p i is selected with probability proportional to <tt>weights[i]</tt>
+ * following the exponential-keys scheme of Efraimidis and Spirakis:
+ * every item draws an exponential key at its weight's rate and the
+ * \p k smallest keys are selected with a sort-free radix walk, without
+ * the candidate set leaving the device.
+ *
+ * The order of the written indexes carries no meaning. The selected set
+ * is reproducible per seed and a fresh sample is produced by every call.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store the \p k selected indexes
+ * \param k - Number of items to sample
+ * \param n - Number of items to sample from, at most 2^32
+ * \param weights - Device array of \p n positive selection weights, or
+ * NULL for a uniform sample
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the key scratch memory could not
+ * be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p k is greater than \p n or \p n is
+ * greater than 2^32 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the sample was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   unsigned int * output_data,
+                                   size_t k, size_t n,
+                                   const double * weights);
+
+/**
+ * \brief Generates a Latin hypercube sample.
+ *
+ * Generates a Latin hypercube design of \p n_samples points in
+ * \p n_dims dimensions and stores it dimension-major in \p data:
+ * coordinate \p d of point \p i is <tt>data[d * n_samples + i]</tt>.
+ * Every one-dimensional projection of the design hits each of the
+ * \p n_samples equal-width strata of (0, 1] exactly once; point \p i
+ * takes the value <tt>(perm_d(i) + u) / n_samples</tt> in dimension
+ * \p d, where <tt>perm_d</tt> is a keyed Feistel permutation of the
+ * stratum indexes and \p u is a fresh uniform jitter. The permutations
+ * are evaluated in place per element, so the design is produced in a
+ * single kernel launch without a sort or shuffle pass.
+ *
+ * The design is reproducible per seed and a fresh design is produced by
+ * every call.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param data - Pointer to memory to store the \p n_samples * \p n_dims
+ * coordinates, dimension-major
+ * \param n_samples - Number of points, at most 2^32
+ * \param n_dims - Number of dimensions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the key scratch memory could not
+ * be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n_samples is greater than 2^32 or
+ * \p n_dims is zero \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the design was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                 float * data,
+                                 size_t n_samples, size_t n_dims);
+
+/**
+ * \brief Generates a bit-packed Bernoulli mask.
+ *
+ * Generates \p n_bits Bernoulli draws of probability \p p and packs them
+ * into \p mask_words, 32 mask bits per word: bit \p i of the mask is
+ * <tt>mask_words[i / 32] >> (i % 32) & 1</tt> and is 1 with probability
+ * \p p. The unused high bits of a partial last word are zero. A packed
+ * mask costs one bit of bandwidth per draw instead of the uniform output
+ * plus byte mask of thresholding rocrand_generate_uniform(); each bit
+ * compares one engine value against the threshold in-register, so \p p
+ * is resolved to 2^-32.
+ *
+ * Supported for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators.
+ *
+ * \param generator - Generator to use
+ * \param mask_words - Pointer to memory to store the mask, at least
+ * (\p n_bits + 31) / 32 32-bit words
+ * \param n_bits - Number of mask bits to generate
+ * \param p - Probability of each bit being 1, in [0; 1]
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0; 1] \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the mask was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_packed(rocrand_generator generator,
+                                  unsigned int * mask_words,
+                                  size_t n_bits, float p);
+
+/**
+ * \brief Generates 32-bit unsigned integers from a discrete distribution.
+ *
+ * Generates \p n 32-bit unsigned integers distributed according to
+ * \p discrete_distribution and saves them to \p output_data. The
+ * distribution must have been created with
+ * rocrand_create_discrete_distribution() or
+ * rocrand_create_discrete_distribution_device(); its tables are read
+ * directly from device memory during generation.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution was null \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_discrete(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          rocrand_discrete_distribution discrete_distribution);
+
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers with
+ * \p t trials and success probability \p probability and saves them to
+ * \p output_data.
+ *
+ * For small numbers of trials an exact histogram is precomputed once per
+ * (\p t, \p probability) pair and sampled with the alias method; for large
+ * numbers of trials the normal approximation with continuity correction is
+ * evaluated in the generation kernel without any table reads.
+ * Binomial generation is supported by pseudo-random generators only.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param t - Number of trials of the binomial distribution
+ * \param probability - Success probability of a single trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p t is zero or \p probability is
+ * outside (0; 1) \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int t, double probability);
+
+/**
+ * \brief Initializes the generator's state on GPU or host.
+ *
+ * Initializes the generator's state on GPU or host. User it not
+ * required to call this function before using a generator.
+ *
+ * If rocrand_initialize() was not called for a generator, it will be
+ * automatically called by functions which generates random numbers like
+ * rocrand_generate(), rocrand_generate_uniform() etc.
+ *
+ * \param generator - Generator to initialize
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator);
+
+/**
+ * \brief Runs every code path of the described calls once.
+ *
+ * Executes each call described in \p calls once into an internal
+ * scratch buffer on the generator's stream and discards the results.
+ * This initializes the generator's state, builds the Poisson
+ * distribution tables for the given lambdas and loads all involved
+ * kernels, so that later calls with the same distribution, type and
+ * size combinations hit only steady-state code.
+ *
+ * Normal and log-normal warm-up calls use mean 0 and standard
+ * deviation 1; the distribution parameters do not change the code path
+ * taken. The function synchronizes with the device before returning.
+ *
+ * After a warm-up covering every call the application intends to
+ * record, those calls allocate no memory and can be captured into a
+ * hipGraph with hipStreamBeginCapture(). Note that replaying the graph
+ * repeats the captured kernel launches as-is: generators which keep
+ * their engine states in device memory (for example XORWOW, MRG32K3A,
+ * MTGP32, LFSR113 and MT19937) advance them in place, so every replay
+ * produces fresh values, while generators whose state enters the
+ * kernel by value (Philox4x32-10 and ThreeFry) replay the captured
+ * values unchanged. For Philox4x32-10, enabling
+ * rocrand_set_resident_states() moves the state into device memory and
+ * makes replayed fills advance the sequence as well.
+ *
+ * \param generator - Generator to warm up
+ * \param calls - Array of \p n call descriptors
+ * \param n - Number of descriptors, may be zero to initialize
+ * the generator's state only
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p calls is NULL while \p n is not zero,
+ * if a descriptor's kind is not a rocrand_call_kind value, or if a Poisson
+ * descriptor's lambda is non-positive \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the scratch buffer could not be
+ * allocated \n
+ * - any error returned by the described generation functions \n
+ * - ROCRAND_STATUS_SUCCESS if all calls were run successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_warmup(rocrand_generator generator,
+               const rocrand_call_descriptor * calls,
+               size_t n);
+
+/**
+ * \brief Measures the generator's throughput in place.
+ *
+ * Fills an internal scratch buffer of \p size 32-bit values with
+ * rocrand_generate() \p n_trials times and returns in \p gbps_out the
+ * measured throughput in gigabytes per second, timed with HIP events.
+ * One additional untimed call is made first so lazy state
+ * initialization and internal reallocations do not count against the
+ * steady-state rate. The function synchronizes with the device and
+ * advances the generator's sequence by (\p n_trials + 1) * \p size
+ * values.
+ *
+ * \param generator - Generator to measure
+ * \param size - Number of 32-bit values generated per trial
+ * \param n_trials - Number of timed generation calls
+ * \param gbps_out - Pointer to memory to store the measured throughput
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size or \p n_trials is zero or
+ * \p gbps_out is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the scratch buffer could not be
+ * allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the timing events failed \n
+ * - ROCRAND_STATUS_SUCCESS if the throughput was successfully measured \n
+ */
+rocrand_status ROCRANDAPI rocrand_benchmark_generator(rocrand_generator generator,
+                                                      size_t size,
+                                                      unsigned int n_trials,
+                                                      double * gbps_out);
+
+/**
+ * \brief Checks the generator type's output against references.
+ *
+ * Runs a known-answer self-test for the type of \p generator, intended
+ * for service start-up to catch driver or compiler regressions that
+ * corrupt sequences without raising errors. Two freshly created
+ * generators with the default seed must produce identical blocks, a
+ * position-weighted digest of the block computed on the device must
+ * match the digest the host compiler computes from the transferred
+ * block, and for generator types with a host generation path
+ * (currently Philox 4x32-10) the device block under
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT must match the block the
+ * host computes from the same engine code.
+ *
+ * The test runs on internal generators and buffers; the state of
+ * \p generator is not changed. The function synchronizes with the
+ * device and typically completes in milliseconds.
+ *
+ * \param generator - Generator whose type is tested
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the test buffers could not be
+ * allocated \n
+ * - ROCRAND_STATUS_SELF_TEST_FAILED if any block or digest did not match
+ * its reference \n
+ * - any error returned by the generation functions the test runs \n
+ * - ROCRAND_STATUS_SUCCESS if all checks passed \n
+ */
+rocrand_status ROCRANDAPI rocrand_self_test(rocrand_generator generator);
+
+/**
+ * \brief Predicts the generator's throughput for a call shape.
+ *
+ * Returns in \p bytes_per_sec the expected sustained throughput of
+ * generation calls of \p size values of the distribution described by
+ * \p kind, from a model with two parameters: a fixed per-call overhead
+ * and a bandwidth roofline. The first query on a generator fits the
+ * parameters from a small and a large in-place measurement (see
+ * rocrand_benchmark_generator) on an internal generator of the same
+ * type, which costs a few milliseconds and does not advance the
+ * caller's sequence; later queries are pure arithmetic.
+ *
+ * The model is calibrated on the raw 32-bit generation path and maps
+ * other kinds by their output byte width, so distributions with
+ * significant extra compute per value (e.g. Poisson) run below the
+ * prediction on compute-limited devices.
+ *
+ * \param generator - Random number generator
+ * \param kind - Distribution of the predicted calls
+ * \param size - Number of values per predicted call
+ * \param bytes_per_sec - Pointer to memory to store the prediction
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size is zero, \p kind is not a
+ * rocrand_call_kind value, or \p bytes_per_sec is NULL \n
+ * - any error returned by the calibration measurements \n
+ * - ROCRAND_STATUS_SUCCESS if the prediction was successfully returned \n
+ */
+rocrand_status ROCRANDAPI rocrand_get_expected_throughput(rocrand_generator generator,
+                                                          rocrand_call_kind kind,
+                                                          size_t size,
+                                                          double * bytes_per_sec);
+
+/**
+ * \brief Fills several buffers with one kernel launch.
+ *
+ * Fills each of the \p n_fills buffers described in \p fills with \p n
+ * values of its distribution in a single launch. The kernel applies the
+ * distributions to successive outputs of the same engines, so a
+ * simulation step that needs one buffer of each of a few distributions
+ * pays one launch instead of one per buffer.
+ *
+ * The supported kinds are ROCRAND_CALL_UNIFORM_INT,
+ * ROCRAND_CALL_UNIFORM_FLOAT, ROCRAND_CALL_UNIFORM_DOUBLE,
+ * ROCRAND_CALL_NORMAL_FLOAT, ROCRAND_CALL_NORMAL_DOUBLE,
+ * ROCRAND_CALL_EXPONENTIAL_FLOAT and ROCRAND_CALL_EXPONENTIAL_DOUBLE.
+ * The values are not the same values sequential single-buffer calls
+ * would produce, but every value is consumed from the engines exactly
+ * once, so no values repeat between the buffers.
+ *
+ * Only implemented for ROCRAND_RNG_PSEUDO_XORWOW.
+ *
+ * \param generator - Random number generator
+ * \param fills - Array of \p n_fills buffer descriptors
+ * \param n_fills - Number of buffers to fill
+ * \param n - Number of values to generate into each buffer
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not implement
+ *   multi-buffer generation \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p fills is NULL while \p n_fills is
+ *   not zero, if a descriptor's kind is not supported, if a descriptor's
+ *   buffer is NULL, or if an exponential descriptor's lambda is
+ *   non-positive \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the descriptor upload buffer
+ *   could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if all buffers were filled successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multi(rocrand_generator generator,
+                       const rocrand_multi_descriptor * fills,
+                       unsigned int n_fills,
+                       size_t n);
+
+/**
+ * \brief Sets the current stream for kernel launches.
+ *
+ * Sets the current stream for all kernel launches of the generator.
+ * All functions will use this stream.
+ *
+ * \param generator - Generator to modify
+ * \param stream - Stream to use or NULL for default stream
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+
+/**
+ * \brief Records an event after the generator's enqueued work.
+ *
+ * Records \p event on the generator's stream. Because the stream runs
+ * in order, the event completes exactly when every fill enqueued on
+ * \p generator before this call has completed, so downstream work can
+ * wait on the fills it needs (hipStreamWaitEvent()) or poll for them
+ * (hipEventQuery()) without synchronizing the whole stream. The call
+ * composes with every rocrand_generate*() function: generate, then
+ * record.
+ *
+ * \p event must have been created with hipEventCreate() and is owned by
+ * the caller.
+ *
+ * \param generator - Generator whose enqueued work to mark
+ * \param event - Event to record
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if recording the event failed \n
+ * - ROCRAND_STATUS_SUCCESS if the event was recorded successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_record_event(rocrand_generator generator, hipEvent_t event);
+
+/**
+ * \brief Queries whether the generator's enqueued work has completed.
+ *
+ * Returns without blocking: ROCRAND_STATUS_SUCCESS if every fill
+ * enqueued on \p generator has completed, ROCRAND_STATUS_NOT_READY if
+ * work is still running. Equivalent to polling the generator's stream;
+ * to wait for or poll one specific fill among several, record an event
+ * after it with rocrand_record_event() instead.
+ *
+ * \param generator - Generator to query
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_NOT_READY if enqueued work has not completed yet \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if querying the stream failed \n
+ * - ROCRAND_STATUS_SUCCESS if all enqueued work has completed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_query(rocrand_generator generator);
+
+/// \brief Custom device allocation callback (see rocrand_set_allocator()).
+/// Returns a device pointer to \p size bytes, or NULL on failure.
+typedef void * (*rocrand_alloc_func)(size_t size, void * user_data);
+
+/// \brief Custom device deallocation callback (see rocrand_set_allocator()).
+/// Frees a pointer previously returned by the paired allocation callback;
+/// never called with NULL.
+typedef void (*rocrand_free_func)(void * ptr, void * user_data);
+
+/**
+ * \brief Routes internal device allocations through caller callbacks.
+ *
+ * Installs process-wide callbacks through which all internal device
+ * allocations of the library (generator states, distribution tables,
+ * scratch buffers) are made, so rocRAND memory comes from the same pool
+ * as the rest of the application - for example a framework's caching
+ * allocator - instead of raw hipMalloc() calls. \p user_data is passed
+ * through to every callback invocation. Passing NULL for both callbacks
+ * restores the default hipMalloc()/hipFree() behavior.
+ *
+ * The callbacks must be installed before any generator or discrete
+ * distribution is created and must stay valid, and must not be changed,
+ * while any exists: memory is freed through the callbacks that were
+ * installed when it was allocated.
+ *
+ * \param alloc_fn - Allocation callback, or NULL with \p free_fn NULL
+ * \param free_fn - Deallocation callback, or NULL with \p alloc_fn NULL
+ * \param user_data - Opaque pointer passed to every callback invocation
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if exactly one of \p alloc_fn and
+ * \p free_fn is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the callbacks were installed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(rocrand_alloc_func alloc_fn,
+                      rocrand_free_func free_fn,
+                      void * user_data);
+
+/**
+ * \brief Sets the seed of a pseudo-random number generator.
+ *
+ * Sets the seed of the pseudo-random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * For an MRG32K3a or MRG31K3p generator the seed value can't be zero. If \p seed is
+ * equal to zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A or ROCRAND_RNG_PSEUDO_MRG31K3P,
+ * value \p 12345 is used as seed instead.
+ *
+ * For a LFSR113 generator seed values must be larger than 1, 7, 15,
+ * 127. The \p seed upper and lower 32 bits used as first and
+ * second seed value. If those values smaller than 2 and/or 8, those
+ * are increased with 1 and/or 7.
+ *
+ * For a ROCRAND_RNG_QUASI_SOBOL32_OWEN generator the seed selects the
+ * random Owen permutation applied to the point set; other quasi-random
+ * generators do not accept a seed.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator
+ *   other than ROCRAND_RNG_QUASI_SOBOL32_OWEN \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+
+/**
+ * \brief Sets the seeds of a pseudo-random number generator.
+ *
+ * Sets the seed of the pseudo-random number generator. Currently only for LFSR113
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * Only usable for LFSR113.
+ *
+ * For a LFSR113 generator seed values must be bigger than 1, 7, 15,
+ * 127. If those values smaller, than the requested minimum values [2, 8, 16, 128], then
+ * it will be increased with the minimum values minus 1 [1, 7, 15, 127].
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_seed_uint4(rocrand_generator generator, uint4 seed);
+
+/**
+ * \brief Sets the offset of a random number generator.
+ *
+ * Sets the absolute offset of the random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed.
+ *
+ * Absolute offset cannot be set if generator's type is
+ * ROCRAND_RNG_PSEUDO_LFSR113.
+ *
+ * For ROCRAND_RNG_PSEUDO_MTGP32 the offset applies to each engine's own
+ * output sequence and is applied by stepping the state on the device
+ * during initialization, so the cost is linear in \p offset.
+ *
+ * \param generator - Random number generator
+ * \param offset - New absolute offset
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
+ * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_LFSR113
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+
+/**
+ * \brief Skips ahead in the sequence of a random number generator.
+ *
+ * Advances the generator by \p n values from its current position, as
+ * if \p n values had been generated and discarded. Unlike
+ * rocrand_set_offset(), which positions the generator relative to the
+ * start of the sequence and resets its state, this call composes with
+ * previous generate calls.
+ *
+ * The skip has logarithmic cost in \p n: counter-based generators
+ * (Philox, Threefry) advance their counter directly, and the
+ * quasi-random Sobol generators re-derive their state with the
+ * Gray-code skip at the next generate call, while the Halton and
+ * lattice generators compute values directly from the point index.
+ * Worker startup cost in
+ * distributed settings therefore does not scale with the skipped
+ * distance. For quasi-random generators \p n counts points, i.e. values
+ * per dimension.
+ *
+ * Generator types that do not support offsets (MTGP32, LFSR113,
+ * MT19937) and generators whose state lives in a per-thread device
+ * array (XORWOW, MRG31K3P, MRG32K3A) do not support this function; for
+ * the latter use rocrand_set_offset() before the first generate call.
+ *
+ * \param generator - Random number generator
+ * \param n - Number of values to skip
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support skipping ahead \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was advanced successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_skipahead(rocrand_generator generator, unsigned long long n);
+
+/**
+ * \brief Assigns a rank its own disjoint slice of a generator's sequence.
+ *
+ * Positions the generator on the part of the sequence that belongs to
+ * \p rank out of \p n_ranks, so that generators created with the same
+ * seed on different ranks of a distributed run draw from
+ * non-overlapping streams without hand-computed offset arithmetic.
+ * Call it once per rank, directly after creating and seeding the
+ * generator.
+ *
+ * Philox generators place each rank on the engine's native subsequence
+ * (2^66 values apart for ROCRAND_RNG_PSEUDO_PHILOX4_32_10 and
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, 2^130 values for
+ * ROCRAND_RNG_PSEUDO_PHILOX4_64_10), so the ranks cannot overlap no
+ * matter how much they draw and \p draws_per_rank_hint is ignored. All
+ * other generator types supported by rocrand_set_offset() split the
+ * 2^64-value offset space into equal per-rank slices;
+ * \p draws_per_rank_hint larger than a slice is rejected because the
+ * next rank's stream would overlap it, and a rank that generates more
+ * values than the hint promised loses the disjointness guarantee. For
+ * quasi-random generators the slices count points, i.e. values per
+ * dimension.
+ *
+ * \param generator - Random number generator
+ * \param rank - Index of the calling rank, less than \p n_ranks
+ * \param n_ranks - Total number of ranks sharing the sequence
+ * \param draws_per_rank_hint - Upper bound on the values each rank will generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n_ranks is zero, \p rank is not
+ * less than \p n_ranks, or \p draws_per_rank_hint does not fit in a
+ * rank's slice \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support offsets \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was positioned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_partition_sequence(rocrand_generator generator,
+                           unsigned int rank, unsigned int n_ranks,
+                           unsigned long long draws_per_rank_hint);
+
+/**
+ * \brief Enables or disables concurrent generation on a generator.
+ *
+ * Host generators are single-threaded by default; two threads calling a
+ * generation function on one generator race on its internal state.
+ * While concurrent generation is enabled, generation calls from
+ * different threads claim disjoint ranges of the generator's sequence
+ * with a lock-free counter, so N threads can fill N buffers
+ * concurrently and the union of the outputs is the same prefix of the
+ * sequence a single thread would produce. Which thread receives which
+ * range depends on the order in which the calls arrive. All calls
+ * launch on the generator's stream. Disabling the mode folds the
+ * claimed ranges back into the generator, so sequential generation
+ * continues where the concurrent fills ended.
+ *
+ * Concurrent generation is supported by the counter-based generator
+ * types (Philox, Threefry), whose state advances by a constant-cost
+ * skip. Statistics are not collected for concurrent calls, and
+ * rocrand_generate_poisson() and the binomial generation keep their
+ * single-threaded requirement because of their host-side parameter
+ * caches. Other configuration calls (seed, offset, ordering, stream)
+ * must not run concurrently with generation.
+ *
+ * \param generator - Random number generator
+ * \param enabled - Non-zero to enable concurrent generation, zero to disable it
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support concurrent generation \n
+ * - ROCRAND_STATUS_SUCCESS if the setting was changed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_concurrent_generation(rocrand_generator generator, unsigned int enabled);
+
+/**
+ * \brief Enables or disables resident engine states on a generator.
+ *
+ * By default the counter-based generators pass their engine state into
+ * every generation kernel by value and replay the consumed values on
+ * the host afterwards. While resident states are enabled, per-thread
+ * engine states live in device memory and generation calls advance
+ * them in place, so each call is a single launch whose arguments carry
+ * only a pointer and no host-side sequence bookkeeping runs. Workloads
+ * issuing very many small generation calls trade the per-call overhead
+ * for one state array in device memory.
+ *
+ * Each resident thread draws consecutive values from its own
+ * subsequence of the seed's stream, so fills made in this mode receive
+ * different values than the default mode, reproducible for a given
+ * seed and offset. The generator's regular sequence is not consumed by
+ * resident fills; disabling the mode resumes it where it was left.
+ * Changing the seed, offset or ordering reinitializes the resident
+ * states. Concurrent generation and
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT are defined in terms of
+ * the regular sequence and take precedence while enabled.
+ *
+ * Only implemented for ROCRAND_RNG_PSEUDO_PHILOX4_32_10.
+ *
+ * \param generator - Random number generator
+ * \param enabled - Non-zero to enable resident states, zero to disable them
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not implement
+ *   resident states \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the state array could not be
+ *   allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the states could not be initialized \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was changed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_resident_states(rocrand_generator generator, unsigned int enabled);
+
+/**
+ * \brief Returns the size of the device memory workspace of a generator.
+ *
+ * Returns in \p size the number of bytes of device memory the generator
+ * needs for its internal state under its current configuration. The
+ * size can change when the configuration changes, for example when
+ * ROCRAND_ORDERING_PSEUDO_DYNAMIC adjusts the state array to the
+ * executing device.
+ *
+ * Workspaces are supported by the generator types that keep persistent
+ * state arrays in device memory: XORWOW, MRG31K3P, MRG32K3A, MTGP32,
+ * LFSR113 and MT19937. The counter-based and quasirandom types keep no
+ * such state and return ROCRAND_STATUS_TYPE_ERROR.
+ *
+ * \param generator - Random number generator
+ * \param size - Pointer to memory to store the workspace size in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was null \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not use a workspace \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI rocrand_get_workspace_size(rocrand_generator generator, size_t * size);
+
+/**
+ * \brief Places the internal state of a generator in caller memory.
+ *
+ * Moves the generator's internal device allocations into the
+ * caller-provided device memory at \p workspace, which must be at least
+ * rocrand_get_workspace_size() bytes and suitably aligned for any type
+ * (as returned by hipMalloc). Callers that suballocate generator state
+ * from their own arena make generator use allocation-free after
+ * creation. The generator's state is reset and reinitialized in the
+ * workspace on the next generation call.
+ *
+ * The caller keeps ownership of the memory and must keep it alive until
+ * the generator is destroyed or the workspace is replaced. Passing a
+ * null \p workspace returns the generator to memory it allocates and
+ * owns itself.
+ *
+ * The Poisson and binomial distribution tables are not part of the
+ * workspace; their sizes depend on the distribution parameters and they
+ * remain internally managed.
+ *
+ * \param generator - Random number generator
+ * \param workspace - Pointer to device memory, or NULL
+ * \param size - Size of the memory at \p workspace in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size is smaller than the workspace size \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not use a workspace \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated while
+ *   returning to an internal allocation \n
+ * - ROCRAND_STATUS_SUCCESS if the workspace was successfully set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_workspace(rocrand_generator generator, void * workspace, size_t size);
+
+/**
+ * \brief Returns the size of a state checkpoint of a generator.
+ *
+ * Returns in \p size the number of bytes rocrand_save_state() writes
+ * for \p generator. Supported for ROCRAND_RNG_PSEUDO_MT19937, whose
+ * engine states are expensive to rebuild from a seed; the other
+ * generators initialize quickly enough that re-creating them is not a
+ * bottleneck.
+ *
+ * \param generator - Random number generator
+ * \param size - Pointer to memory to store the checkpoint size in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type does not support
+ *   checkpoints \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI rocrand_get_state_size(rocrand_generator generator, size_t * size);
+
+/**
+ * \brief Saves a checkpoint of a generator's state.
+ *
+ * Copies the complete engine states of \p generator into the
+ * caller-provided memory at \p state, which may be host or device
+ * memory of at least rocrand_get_state_size() bytes. The generator is
+ * initialized first if it has not generated yet, so a checkpoint taken
+ * right after creation captures the freshly seeded states. Work
+ * previously queued on the generator's stream completes before the
+ * states are read, and the buffer is ready when the call returns.
+ *
+ * A checkpoint restored with rocrand_load_state() continues the
+ * sequence exactly where the checkpoint was taken, so a job can
+ * snapshot the state once and skip the expensive seed-and-jump-ahead
+ * initialization on every resume. The checkpoint is specific to the
+ * generator type and library version.
+ *
+ * \param generator - Random number generator
+ * \param state - Pointer to memory to store the checkpoint in
+ * \param size - Size of the memory at \p state in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL or \p size is
+ *   smaller than the checkpoint size \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type does not support
+ *   checkpoints \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully saved \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state, size_t size);
+
+/**
+ * \brief Restores a generator's state from a checkpoint.
+ *
+ * Copies a checkpoint written by rocrand_save_state() from \p state
+ * (host or device memory) into \p generator's engine states with a
+ * single copy, replacing the initialization from the seed. The
+ * generator must be of the same type as the one the checkpoint was
+ * saved from. After the call the generator continues the sequence
+ * exactly where the checkpoint was taken; the generator's recorded seed
+ * is not consulted, and calling rocrand_set_seed() afterwards discards
+ * the restored states.
+ *
+ * \param generator - Random number generator
+ * \param state - Pointer to the checkpoint to restore
+ * \param size - Size of the memory at \p state in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL or \p size is
+ *   smaller than the checkpoint size \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type does not support
+ *   checkpoints \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully restored \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state, size_t size);
+
+/**
+ * \brief Returns the device memory footprint of a generator.
+ *
+ * Returns in \p state_bytes the device memory holding the generator's
+ * engine states, which carries the sequence position and cannot be
+ * released without destroying the generator, and in \p reclaimable_bytes
+ * the device memory held by caches that can be released with
+ * rocrand_trim() and rebuilt on demand - currently the binomial
+ * distribution tables. Poisson tables are shared by all generators of
+ * the process and are not part of any generator's footprint. Either
+ * pointer may be NULL if only the other value is of interest.
+ *
+ * \param generator - Random number generator
+ * \param state_bytes - Pointer to memory to store the state size, or NULL
+ * \param reclaimable_bytes - Pointer to memory to store the reclaimable
+ * size, or NULL
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudorandom
+ * generator \n
+ * - ROCRAND_STATUS_SUCCESS if the sizes were successfully returned \n
+ */
+rocrand_status ROCRANDAPI rocrand_get_memory_info(rocrand_generator generator,
+                                                  size_t * state_bytes,
+                                                  size_t * reclaimable_bytes);
+
+/**
+ * \brief Releases the reclaimable device memory of a generator.
+ *
+ * Releases the cached device memory reported in \p reclaimable_bytes by
+ * rocrand_get_memory_info(). The caches are rebuilt the next time a
+ * generation call needs them, so trimming does not change any generated
+ * sequence; the engine states and the sequence position are untouched.
+ *
+ * \param generator - Random number generator
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudorandom
+ * generator \n
+ * - ROCRAND_STATUS_SUCCESS if the memory was successfully released \n
+ */
+rocrand_status ROCRANDAPI rocrand_trim(rocrand_generator generator);
+
+/**
+ * \brief Opens a pipelined generation-to-host stream on a generator.
+ *
+ * Opens a pipeline that delivers the generator's 32-bit sequence to the
+ * host in chunks of \p chunk_size values. The pipeline double-buffers
+ * in device memory: while one chunk copies to \p host_sink on an
+ * internal copy stream, the next chunk is generated on the generator's
+ * stream, so generation and copies overlap without any event chaining
+ * by the caller. \p host_sink must hold \p chunk_size unsigned ints and
+ * should be allocated with hipHostMalloc() for the copies to be
+ * asynchronous.
+ *
+ * The pipeline generates ahead through the generator, so while a stream
+ * is open the generator must not be used directly and its sequence
+ * position includes chunks that have not been read yet. Closing the
+ * stream leaves the generator after the last generated chunk.
+ *
+ * \param stream - Pointer to the stream to open
+ * \param generator - Random number generator
+ * \param host_sink - Host memory the chunks are delivered to
+ * \param chunk_size - Number of 32-bit values per chunk
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stream or \p host_sink was null or
+ *   \p chunk_size was zero \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the device buffers could not be
+ *   allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the pipeline could not be set up \n
+ * - ROCRAND_STATUS_SUCCESS if the stream was successfully opened \n
+ */
+rocrand_status ROCRANDAPI rocrand_stream_open(rocrand_stream * stream,
+                                              rocrand_generator generator,
+                                              unsigned int * host_sink,
+                                              size_t chunk_size);
+
+/**
+ * \brief Reads the next chunk of a generation-to-host stream.
+ *
+ * Delivers the next chunk of the sequence to the sink buffer the stream
+ * was opened with. The call returns once the sink is valid; generation
+ * of the following chunk proceeds asynchronously while the caller
+ * consumes the sink, and the sink is overwritten by the next read.
+ *
+ * \param stream - Stream opened with rocrand_stream_open()
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the stream wasn't opened \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the copy or an event failed \n
+ * - ROCRAND_STATUS_SUCCESS if the chunk was successfully delivered \n
+ */
+rocrand_status ROCRANDAPI rocrand_stream_read(rocrand_stream stream);
 
 /**
- * \brief Generates log-normally distributed \p float values.
+ * \brief Closes a generation-to-host stream.
  *
- * Generates \p n log-normally distributed 32-bit floating-point values
- * and saves them to \p output_data.
+ * Waits for in-flight generation and copies, then releases the device
+ * buffers and the internal copy stream. The generator itself is not
+ * destroyed and can be used directly again.
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>float</tt>s to generate
- * \param mean - Mean value of log normal distribution
- * \param stddev - Standard deviation value of log normal distribution
+ * \param stream - Stream opened with rocrand_stream_open()
  *
  * \return
- * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_NOT_CREATED if the stream wasn't opened \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if synchronization failed \n
+ * - ROCRAND_STATUS_SUCCESS if the stream was successfully closed \n
  */
-rocrand_status ROCRANDAPI
-rocrand_generate_log_normal(rocrand_generator generator,
-                            float * output_data, size_t n,
-                            float mean, float stddev);
+rocrand_status ROCRANDAPI rocrand_stream_close(rocrand_stream stream);
 
 /**
- * \brief Generates log-normally distributed \p double values.
+ * \brief Enables speculative pre-generation on a generator.
+ *
+ * Workloads that fill the same number of values every step leave the
+ * generator idle between the fills. With prefetching enabled the
+ * generator produces the next chunks of its 32-bit sequence ahead of
+ * time into two internal device buffers, on an internal stream created
+ * at the lowest priority so the refills only occupy the device when the
+ * step's own kernels leave it idle. A rocrand_generate() call of
+ * exactly \p n values is then served by a device-to-device copy of a
+ * chunk generated ahead and triggers the refill of the buffer it
+ * consumed, so the generation cost is hidden behind the compute between
+ * the calls; rocrand_acquire_buffer() skips even the copy.
+ *
+ * The cache generates ahead through the generator, so its sequence
+ * position runs two chunks in front of the values consumed so far.
+ * rocrand_generate() calls of a different size stay correct but
+ * continue the sequence after the chunks generated ahead, and the other
+ * generation calls of the library must not run concurrently with a
+ * refill; synchronize the internal stream (hipDeviceSynchronize() or
+ * disabling prefetching) before mixing them in. Calling with \p n of
+ * zero disables prefetching and waits for the refills in flight;
+ * calling with a new size restarts the cache with that size.
  *
- * Generates \p n log-normally distributed 64-bit double-precision floating-point
- * values and saves them to \p output_data.
- *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>double</tt>s to generate
- * \param mean - Mean value of log normal distribution
- * \param stddev - Standard deviation value of log normal distribution
+ * \param generator - Random number generator
+ * \param n - Number of 32-bit values generated ahead per chunk, or zero
+ * to disable prefetching
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the device buffers could not be
+ *   allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the internal stream or the events
+ *   could not be set up \n
+ * - ROCRAND_STATUS_SUCCESS if prefetching was successfully changed \n
  */
-rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_double(rocrand_generator generator,
-                                   double * output_data, size_t n,
-                                   double mean, double stddev);
+rocrand_status ROCRANDAPI rocrand_set_prefetch(rocrand_generator generator, size_t n);
 
 /**
-* \brief Generates log-normally distributed \p half values.
-*
-* Generates \p n log-normally distributed 16-bit half-precision floating-point
-* values and saves them to \p output_data.
-*
-* \param generator - Generator to use
-* \param output_data - Pointer to memory to store generated numbers
-* \param n - Number of <tt>half</tt>s to generate
-* \param mean - Mean value of log normal distribution
-* \param stddev - Standard deviation value of log normal distribution
-*
-* \return
-* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
-* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
-* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
-* of used quasi-random generator \n
-* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
-*/
-rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_half(rocrand_generator generator,
-                                 half * output_data, size_t n,
-                                 half mean, half stddev);
+ * \brief Hands out a chunk generated ahead without copying it.
+ *
+ * Returns in \p output_data the internal device buffer holding the next
+ * chunk of the sequence of \p generator, generated ahead as configured
+ * with rocrand_set_prefetch(), and triggers the refill a matching
+ * rocrand_generate() call would; kernels launched on the generator's
+ * stream read the values without the device-to-device copy. The buffer
+ * stays valid until the second following rocrand_generate() or
+ * rocrand_acquire_buffer() call on the generator, and reads of it must
+ * be enqueued on the generator's stream before the next of those calls,
+ * which recycles the buffer behind the work enqueued so far.
+ *
+ * \param generator - Random number generator
+ * \param output_data - Set to the device buffer holding the next chunk
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data was null or
+ *   prefetching was not enabled with rocrand_set_prefetch() \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the handoff could not be ordered
+ *   behind the refill \n
+ * - ROCRAND_STATUS_SUCCESS if the chunk was successfully handed out \n
+ */
+rocrand_status ROCRANDAPI rocrand_acquire_buffer(rocrand_generator generator,
+                                                 unsigned int ** output_data);
 
 /**
- * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ * \brief Sets the ordering of a random number generator.
  *
- * Generates \p n Poisson-distributed 32-bit unsigned integers and
- * saves them to \p output_data.
+ * Sets the ordering of the results of a random number generator.
  *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of 32-bit unsigned integers to generate
- * \param lambda - lambda for the Poisson distribution
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed.
+ *
+ * \param generator - Random number generator
+ * \param order - New ordering of results
+ *
+ * The ordering choices for pseudorandom sequences are
+ * ROCRAND_ORDERING_PSEUDO_DEFAULT,
+ * ROCRAND_ORDERING_PSEUDO_LEGACY,
+ * ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+ * ROCRAND_ORDERING_PSEUDO_FASTEST and
+ * ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+ * The default ordering is ROCRAND_ORDERING_PSEUDO_DEFAULT, which is equal to
+ * ROCRAND_ORDERING_PSEUDO_LEGACY for now.
+ * With ROCRAND_ORDERING_PSEUDO_DYNAMIC the generator picks its launch
+ * configuration from the occupancy of the device executing it instead of
+ * built-in block counts, so the generated sequences may differ between
+ * devices.
+ * ROCRAND_ORDERING_PSEUDO_FASTEST additionally allows the generator to
+ * distribute work in whatever way is fastest on the executing device,
+ * dropping the bookkeeping that keeps the sequence layout deterministic.
+ * No value of the underlying sequences is ever repeated, but results are
+ * not reproducible between runs, devices or library versions.
+ * With ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT every output index maps
+ * to a fixed position in the engine sequence, so the results are
+ * bit-identical for any launch configuration and the launch may still be
+ * tuned to the executing device. Only the counter-based generator types
+ * (Philox, Threefry), whose engines skip to a sequence position at
+ * constant cost, accept this ordering.
+ *
+ * For quasirandom sequences there is only one ordering, ROCRAND_ORDERING_QUASI_DEFAULT.
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
- * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the ordering is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was successfully set \n
+ * - ROCRAND_STATUS_TYPE_ERROR if generator's type is not valid
  */
-rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda);
+rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
 
 /**
- * \brief Initializes the generator's state on GPU or host.
+ * \brief Sets the math accuracy mode of the generator.
+ *
+ * Under ROCRAND_MATH_FAST the single-precision normal and log-normal
+ * distributions are computed with the fast device math intrinsics
+ * (\p __logf, \p __expf) instead of the full-precision functions, which
+ * is considerably cheaper on architectures without fast transcendental
+ * hardware for the precise forms. The produced values follow the same
+ * distribution but individual values may differ from the precise mode
+ * by a few ulps, so sequences generated under the two modes are not
+ * bit-identical.
+ *
+ * The mode only affects generation on the device; host generators and
+ * double-precision output always use full precision. The default mode
+ * is ROCRAND_MATH_PRECISE. The mode may be changed between generation
+ * calls and does not reset the generator's state.
  *
- * Initializes the generator's state on GPU or host. User it not
- * required to call this function before using a generator.
+ * \param generator - Random number generator
+ * \param mode - Math accuracy mode, ROCRAND_MATH_PRECISE or ROCRAND_MATH_FAST
  *
- * If rocrand_initialize() was not called for a generator, it will be
- * automatically called by functions which generates random numbers like
- * rocrand_generate(), rocrand_generate_uniform() etc.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the mode is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully set \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_math_mode(rocrand_generator  generator,
+                                                rocrand_math_mode mode);
+
+/**
+ * \brief Sets the method used for generating normally distributed values.
+ *
+ * Under ROCRAND_NORMAL_METHOD_ZIGGURAT single-precision normal values
+ * are drawn with 256-layer ziggurat rejection sampling instead of the
+ * Box-Muller transformation: the common case costs a table lookup, one
+ * compare and one multiply where Box-Muller pays a sincos, a logarithm
+ * and a square root per pair, which is considerably cheaper when normal
+ * fills are ALU-bound. The tables are built and uploaded to the device
+ * once per process on first use and shared by all generators.
+ *
+ * Two further methods trade differently for double-precision output,
+ * where Box-Muller pays its sincos and logarithm in FP64 and is severely
+ * rate-limited on architectures with reduced FP64 throughput.
+ * ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR replaces the trigonometry with
+ * polar rejection sampling: only a logarithm, a square root and a
+ * division remain in FP64 and rejected candidates are refreshed
+ * in-register, so every output still consumes a fixed amount of engine
+ * output. ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT computes the transform
+ * in single precision and widens the result; the values are exactly
+ * normally distributed but carry only float accuracy (about 2^-24),
+ * which many accuracy-tolerant simulations accept for the FP64-unit
+ * bypass.
+ *
+ * All methods produce normally distributed values but consume engine
+ * output differently, so their sequences are not bit-identical. The
+ * ziggurat method affects single-precision and the two methods above
+ * double-precision normal generation on the device; log-normal and
+ * half-precision output, host generators, the MRG-based and the
+ * quasi-random generators always use their default method. The default
+ * is ROCRAND_NORMAL_METHOD_BOX_MULLER unless the tuning table shipped
+ * with the library (see ROCRAND_TUNING_FILE) names a different default
+ * for the device architecture; an explicit call to this function always
+ * takes precedence. The method may be changed between generation calls
+ * and does not reset the generator's state.
  *
- * \param generator - Generator to initialize
+ * \param generator - Random number generator
+ * \param method - Generation method
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the method is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the method was successfully set \n
  */
-rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator);
+rocrand_status ROCRANDAPI rocrand_set_normal_method(rocrand_generator     generator,
+                                                    rocrand_normal_method method);
 
 /**
- * \brief Sets the current stream for kernel launches.
- *
- * Sets the current stream for all kernel launches of the generator.
- * All functions will use this stream.
+ * \brief Enables or disables antithetic variates generation.
+ *
+ * In antithetic mode every generation call pairs each value with its
+ * antithetic mate, produced from the complemented engine output, and
+ * writes the pairs next to each other:
+ * (x_0, anti(x_0), x_1, anti(x_1), ...). The coupling is applied to the
+ * uniforms underlying each distribution (u is paired with 1 - u), so
+ * for distributions generated by inversion - uniform, exponential,
+ * Cauchy, Weibull, log-normal via inverse CDF - the mate is the exact
+ * reflection of the value. The mate costs no additional engine output,
+ * so the engines do half the work per generated value, and no separate
+ * pass over the buffer is needed to form the pairs.
+ *
+ * The mode applies to the single-buffer generation functions of all
+ * distributions. It is not supported for the quasi-random generators,
+ * whose dimension assignment requires one value per engine output, nor
+ * for the MRG-based generators. The mode may be changed between
+ * generation calls and does not reset the generator's state; note that
+ * enabling it changes how engine output maps to positions in the
+ * output buffer.
  *
- * \param generator - Generator to modify
- * \param stream - Stream to use or NULL for default stream
+ * \param generator - Random number generator
+ * \param enabled - Nonzero to enable antithetic mode, zero to disable it
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random or
+ *   MRG-based generator \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully set \n
  */
-rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+rocrand_status ROCRANDAPI rocrand_set_antithetic(rocrand_generator generator,
+                                                 unsigned int      enabled);
 
 /**
- * \brief Sets the seed of a pseudo-random number generator.
+ * \brief Sets how kernel launch errors of the generator are reported.
  *
- * Sets the seed of the pseudo-random number generator.
+ * By default (ROCRAND_ERRORS_IMMEDIATE) every generation call polls the
+ * runtime for a launch error before it returns. The poll costs a runtime
+ * call per generation call, which is measurable for workloads issuing
+ * many small fills. With ROCRAND_ERRORS_DEFERRED the poll is skipped and
+ * generation calls return after enqueuing their kernels; accumulated
+ * launch errors surface at the next rocrand_query_status() call. Errors
+ * that are detected while a call is set up on the host - invalid sizes,
+ * allocation failures, initialization failures - are still reported
+ * immediately by the call itself in both modes.
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * The mode may be changed between generation calls and does not reset
+ * the generator's state.
  *
- * For an MRG32K3a or MRG31K3p generator the seed value can't be zero. If \p seed is
- * equal to zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A or ROCRAND_RNG_PSEUDO_MRG31K3P,
- * value \p 12345 is used as seed instead.
+ * \param generator - Random number generator
+ * \param mode - Error reporting mode
  *
- * For a LFSR113 generator seed values must be larger than 1, 7, 15,
- * 127. The \p seed upper and lower 32 bits used as first and
- * second seed value. If those values smaller than 2 and/or 8, those
- * are increased with 1 and/or 7.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the mode is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was successfully set \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_error_mode(rocrand_generator  generator,
+                                                 rocrand_error_mode mode);
+
+/**
+ * \brief Waits for the generator's pending work and reports its status.
  *
- * \param generator - Pseudo-random number generator
- * \param seed - New seed value
+ * Synchronizes the stream of the generator and returns whether the
+ * kernels enqueued by earlier generation calls completed successfully.
+ * This is the collection point for launch errors deferred with
+ * ROCRAND_ERRORS_DEFERRED, and may also be used in the default mode as
+ * an explicit synchronization that reports asynchronous execution
+ * failures. Querying clears the recorded error state.
+ *
+ * \param generator - Random number generator
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
- * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel of the generator failed
+ *   to launch or to complete \n
+ * - ROCRAND_STATUS_SUCCESS if all pending work completed successfully \n
  */
-rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+rocrand_status ROCRANDAPI rocrand_query_status(rocrand_generator generator);
 
 /**
- * \brief Sets the seeds of a pseudo-random number generator.
+ * \brief Enables or disables the persistent generation mode of the generator.
+ *
+ * In persistent mode the generator keeps a long-running kernel resident
+ * on an internal stream. Uniform \p unsigned \p int, uniform \p float,
+ * uniform \p double and normal \p float fills are then published to the
+ * kernel through a ring buffer in pinned host memory instead of each
+ * launching a grid, which removes the launch cost from workloads that
+ * make very many generation calls of the same shape. On devices with
+ * cooperative launch support the resident kernel is a cooperative grid
+ * sized to the device's occupancy, with a grid-wide synchronization
+ * separating consecutive fills, so fills of any size are served at
+ * full-device bandwidth and every thread keeps its engine state in
+ * registers from one fill to the next; other devices serve the ring
+ * with a single resident block. Other distributions and types keep
+ * using regular kernel launches, which stay valid while the mode is
+ * enabled because the resident kernel draws from its own set of
+ * engines. For the same reason enabling the mode changes which
+ * subsequences the routed fills are generated from, so their values do
+ * not reproduce the values of regular launches.
+ *
+ * Fills published through the ring do not appear on the generator's
+ * stream; use rocrand_persistent_fence() to wait for their completion.
+ * Disabling the mode drains the ring and ends the resident kernel.
+ * The mode is only implemented for ROCRAND_RNG_PSEUDO_XORWOW.
  *
- * Sets the seed of the pseudo-random number generator. Currently only for LFSR113
+ * \param generator - Random number generator
+ * \param enabled - Non-zero to enable persistent mode, zero to disable it
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not implement
+ *   persistent mode \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the ring or the kernel's engines
+ *   could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the resident kernel could not be
+ *   launched \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was changed successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_persistent_mode(rocrand_generator generator,
+                                                      unsigned int      enabled);
+
+/**
+ * \brief Waits for all fills published in persistent mode to complete.
  *
- * Only usable for LFSR113.
+ * Returns when every generation call routed through the persistent
+ * ring of \p generator has written its output and the output is
+ * globally visible. Returns immediately when persistent mode is not
+ * enabled. Work launched on the generator's stream is not waited for.
  *
- * For a LFSR113 generator seed values must be bigger than 1, 7, 15,
- * 127. If those values smaller, than the requested minimum values [2, 8, 16, 128], then
- * it will be increased with the minimum values minus 1 [1, 7, 15, 127].
+ * \param generator - Random number generator
  *
- * \param generator - Pseudo-random number generator
- * \param seed - New seed value
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not implement
+ *   persistent mode \n
+ * - ROCRAND_STATUS_SUCCESS if all published fills have completed \n
+ */
+rocrand_status ROCRANDAPI rocrand_persistent_fence(rocrand_generator generator);
+
+/**
+ * \brief Enables or disables statistics collection for a generator.
+ *
+ * Statistics collection is off by default. When enabled, every
+ * generation call updates the launch and byte counters and records a
+ * pair of HIP events around the kernel; the events are pooled and never
+ * synchronized, so collection is cheap enough to stay enabled in
+ * production.
+ *
+ * \param generator - Random number generator
+ * \param enabled - Non-zero to enable collection, zero to disable it
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
- * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ * - ROCRAND_STATUS_SUCCESS if the setting was changed successfully \n
  */
-rocrand_status ROCRANDAPI rocrand_set_seed_uint4(rocrand_generator generator, uint4 seed);
+rocrand_status ROCRANDAPI
+rocrand_set_statistics_enabled(rocrand_generator generator, unsigned int enabled);
 
 /**
- * \brief Sets the offset of a random number generator.
+ * \brief Returns the statistics collected for a generator.
  *
- * Sets the absolute offset of the random number generator.
+ * Returns in \p stats the statistics collected since collection was
+ * enabled with rocrand_set_statistics_enabled(): the number of
+ * generation kernel launches, the bytes they generated, the internal
+ * device memory reallocations, and the accumulated kernel time. Kernel
+ * time is harvested from completed HIP events only and this call does
+ * not synchronize, so launches still in flight are counted but not yet
+ * included in the time.
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's seed.
+ * \param generator - Random number generator
+ * \param stats - Pointer to memory to store the statistics
  *
- * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MTGP32 or
- * ROCRAND_RNG_PSEUDO_LFSR113.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats was null \n
+ * - ROCRAND_STATUS_SUCCESS if the statistics were successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_statistics(rocrand_generator generator, rocrand_stats * stats);
+
+/**
+ * \brief Enables or disables profiler range annotations for a generator.
+ *
+ * When enabled, every generation call on \p generator pushes a roctx
+ * range named after the call and the generator type (for example
+ * "rocrand_generate_normal [xorwow]") around the kernels and copies it
+ * issues, so an attached profiler such as rocprof with --roctx-trace
+ * attributes the work to readable names instead of mangled kernel
+ * template instantiations. The roctx entry points are loaded from
+ * libroctx64 the first time they are needed; when that library is not
+ * present the flag is accepted and no ranges are emitted, so the
+ * setting is safe to leave enabled.
  *
  * \param generator - Random number generator
- * \param offset - New absolute offset
+ * \param enabled - Non-zero to enable the annotations, zero to disable them
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
- * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MTGP32 or
- * ROCRAND_RNG_PSEUDO_LFSR113
+ * - ROCRAND_STATUS_SUCCESS if the setting was changed successfully \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+rocrand_set_profiling(rocrand_generator generator, unsigned int enabled);
 
 /**
- * \brief Sets the ordering of a random number generator.
+ * \brief Writes the generator's per-launch latency histogram.
+ *
+ * Writes to \p out a histogram of the kernel times of the generation
+ * launches made while statistics collection was enabled with
+ * rocrand_set_statistics_enabled(). The buckets double in width
+ * (HDR-style), so a handful of slow launches stays visible next to
+ * millions of fast ones; times come from the same pooled HIP events
+ * the statistics use and are harvested without synchronizing, so
+ * launches still in flight are reported as such and appear in the
+ * histogram on a later call. Comparing the histogram against observed
+ * call latencies separates slow kernels from queueing delays.
  *
- * Sets the ordering of the results of a random number generator.
+ * \param generator - Random number generator
+ * \param out - Stream to write the histogram to
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's seed.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p out was null \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was successfully written \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_dump_latency_histogram(rocrand_generator generator, FILE * out);
+
+/**
+ * \brief Starts or stops logging the generator's calls to a file.
+ *
+ * While a log is open, every generation call on \p generator made
+ * through rocrand_generate(), rocrand_generate_uniform(),
+ * rocrand_generate_uniform_double(), rocrand_generate_normal(),
+ * rocrand_generate_normal_double(), rocrand_generate_log_normal(),
+ * rocrand_generate_log_normal_double() or rocrand_generate_poisson()
+ * appends one line in the trace format benchmark_rocrand_trace_replay
+ * reads, and seed and offset changes are appended as comments that
+ * rocrand_replay() honors. Comparing the logs of two runs shows the
+ * first diverging call; replaying a log reproduces the exact state
+ * evolution of the recorded generator.
+ *
+ * Passing NULL closes the current log. The log is also closed when the
+ * generator is destroyed. Distribution parameters other than lambda
+ * are not recorded; they do not change how the state advances.
  *
  * \param generator - Random number generator
- * \param order - New ordering of results
+ * \param path - File to write the log to, or NULL to stop logging
  *
- * The ordering choices for pseudorandom sequences are
- * ROCRAND_ORDERING_PSEUDO_DEFAULT and
- * ROCRAND_ORDERING_PSEUDO_LEGACY.
- * The default ordering is ROCRAND_ORDERING_PSEUDO_DEFAULT, which is equal to
- * ROCRAND_ORDERING_PSEUDO_LEGACY for now.
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the file could not be opened \n
+ * - ROCRAND_STATUS_SUCCESS if logging was started or stopped \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_log(rocrand_generator generator, const char * path);
+
+/**
+ * \brief Re-executes a recorded call log.
  *
- * For quasirandom sequences there is only one ordering, ROCRAND_ORDERING_QUASI_DEFAULT.
+ * Reads the file written by rocrand_set_log() (or a hand-written trace
+ * in the same format) and re-executes its calls into an internal
+ * scratch buffer: one generator is created per engine named in the
+ * log, recorded seed and offset changes are applied, and the calls run
+ * in recorded order on the default stream. Replay stops at the first
+ * failing call and returns its status, so bisecting a log that
+ * reproduces a problem narrows it to one call.
+ *
+ * \param path - File to replay
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p path was NULL or the file
+ * contains a malformed line or an unknown engine or distribution \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the file could not be opened \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the scratch buffer could not
+ * be allocated \n
+ * - any error returned by the replayed calls \n
+ * - ROCRAND_STATUS_SUCCESS if the whole log was replayed \n
+ */
+rocrand_status ROCRANDAPI rocrand_replay(const char * path);
+
+/**
+ * \brief Computes the moments of a uniform sample without storing it.
+ *
+ * Runs the generation loop of a uniform float fill of \p n values but
+ * reduces the values into their first four moments on the device, so no
+ * n-element buffer is allocated or written. The reduced values are
+ * exactly the values a rocrand_generate_uniform() call of size \p n
+ * would produce, and the generator advances as if that call had been
+ * made.
+ *
+ * Only implemented for ROCRAND_RNG_PSEUDO_PHILOX4_32_10.
+ *
+ * \param generator - Random number generator
+ * \param n - Sample size
+ * \param moments - Pointer to memory to store the moments
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if the ordering is not valid \n
- * - ROCRAND_STATUS_SUCCESS if the ordering was successfully set \n
- * - ROCRAND_STATUS_TYPE_ERROR if generator's type is not valid
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator's type does not implement
+ *   moment reduction \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p moments was null \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the moments were successfully returned \n
  */
-rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
+rocrand_status ROCRANDAPI
+rocrand_generate_statistics(rocrand_generator generator, size_t n, rocrand_moments * moments);
 
 /**
  * \brief Set the number of dimensions of a quasi-random number generator.
  *
  * Set the number of dimensions of a quasi-random number generator.
- * Supported values of \p dimensions are 1 to 20000.
+ * Supported values of \p dimensions are 1 to 20000, except for
+ * ROCRAND_RNG_QUASI_SOBOL32 generators, which construct direction
+ * vectors for further dimensions on demand and accept any non-zero
+ * value. Crossing 20000 dimensions for the first time computes the
+ * additional direction vectors on the host, which takes a few seconds.
+ * ROCRAND_RNG_QUASI_HALTON and ROCRAND_RNG_QUASI_LATTICE generators
+ * derive their per-dimension constants on demand and also accept any
+ * non-zero value.
  *
  * - This operation resets the generator's internal state.
  * - This operation does not change the generator's offset.
@@ -662,6 +3851,51 @@ rocrand_status ROCRANDAPI
 rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                               unsigned int dimensions);
 
+/**
+ * \brief Set the output layout of a quasi-random number generator.
+ *
+ * Selects how generate calls lay out multi-dimensional output. With the
+ * default ROCRAND_QUASI_LAYOUT_DIMENSION_MAJOR each dimension's points
+ * are contiguous; with ROCRAND_QUASI_LAYOUT_POINT_MAJOR all dimensions
+ * of a point are contiguous, so consumers reading points as structures
+ * need no transpose. The generated values are the same in both layouts.
+ *
+ * Point-major generation computes every value independently instead of
+ * walking each dimension sequentially, so it is somewhat slower than
+ * dimension-major generation, but considerably faster than a separate
+ * transpose pass.
+ *
+ * With ROCRAND_QUASI_LAYOUT_BLOCKED consecutive points are grouped into
+ * tiles sized to fit the device's L2 cache, and within a tile each
+ * dimension's values are contiguous: with a tile width of w points,
+ * dimension d of point i is at
+ * (i / w) * w * dimensions + d * w + (i % w). All dimensions of one
+ * point then span a single cache-resident tile instead of the whole
+ * buffer, so consumers gathering many dimensions per point stop being
+ * bound by the gather. ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED additionally
+ * pads the dimension count to the next power of two in the layout (the
+ * padding values are never written), so tile strides are powers of two
+ * and point addresses need no multiplications. With padding the length
+ * of a generate call must be a multiple of the padded dimension count
+ * and produces length divided by the padded count points.
+ *
+ * Only ROCRAND_RNG_QUASI_SOBOL32 generators support this function.
+ *
+ * - This operation does not reset the generator's internal state.
+ *
+ * \param generator - Quasi-random number generator
+ * \param layout - Output layout
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p layout is not a valid layout \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support output layouts \n
+ * - ROCRAND_STATUS_SUCCESS if the layout was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_quasi_random_generator_layout(rocrand_generator generator,
+                                          rocrand_quasi_layout layout);
+
 /**
  * \brief Returns the version number of the library.
  *
@@ -719,6 +3953,36 @@ rocrand_create_discrete_distribution(const double * probabilities,
                                      unsigned int offset,
                                      rocrand_discrete_distribution * discrete_distribution);
 
+/**
+ * \brief Construct the histogram for a custom discrete distribution
+ * from device memory.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as probabilities. Unlike
+ * rocrand_create_discrete_distribution(), \p probabilities must point to
+ * device memory, and the histogram is constructed by a kernel without
+ * copying the probabilities to the host.
+ *
+ * \param probabilities - probabilities of the the distribution in device memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p probabilities or \p discrete_distribution
+ * pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the construction kernel failed to launch \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_device(const double * probabilities,
+                                            unsigned int size,
+                                            unsigned int offset,
+                                            rocrand_discrete_distribution * discrete_distribution);
+
 /**
  * \brief Destroy the histogram array for a discrete distribution.
  *
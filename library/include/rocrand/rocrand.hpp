@@ -33,6 +33,7 @@
     #include <sstream>
     #include <string>
     #include <type_traits>
+    #include <vector>
 
 namespace rocrand_cpp {
 
@@ -246,15 +247,16 @@ private:
 ///
 /// \brief Produces random floating-point values uniformly distributed on the interval (0, 1].
 ///
-/// \tparam RealType - type of generated values. Only \p float, \p double and \p half types are supported.
+/// \tparam RealType - type of generated values. Only \p float, \p double, \p half and \p hip_bfloat16 types are supported.
 template<class RealType = float>
 class uniform_real_distribution
 {
     static_assert(
         std::is_same<float, RealType>::value
         || std::is_same<double, RealType>::value
-        || std::is_same<half, RealType>::value,
-        "Only float, double, and half types are supported in uniform_real_distribution"
+        || std::is_same<half, RealType>::value
+        || std::is_same<hip_bfloat16, RealType>::value,
+        "Only float, double, half, and hip_bfloat16 types are supported in uniform_real_distribution"
     );
 
 public:
@@ -342,21 +344,28 @@ private:
     {
         return rocrand_generate_uniform_half(g.m_generator, output, size);
     }
+
+    template<class Generator>
+    rocrand_status generate(Generator& g, hip_bfloat16 * output, size_t size)
+    {
+        return rocrand_generate_uniform_bf16(g.m_generator, output, size);
+    }
 };
 
 /// \class normal_distribution
 ///
 /// \brief Produces random numbers according to a normal distribution.
 ///
-/// \tparam RealType - type of generated values. Only \p float, \p double and \p half types are supported.
+/// \tparam RealType - type of generated values. Only \p float, \p double, \p half and \p hip_bfloat16 types are supported.
 template<class RealType = float>
 class normal_distribution
 {
     static_assert(
         std::is_same<float, RealType>::value
         || std::is_same<double, RealType>::value
-        || std::is_same<half, RealType>::value,
-        "Only float, double and half types are supported in normal_distribution"
+        || std::is_same<half, RealType>::value
+        || std::is_same<hip_bfloat16, RealType>::value,
+        "Only float, double, half, and hip_bfloat16 types are supported in normal_distribution"
     );
 
 public:
@@ -534,6 +543,14 @@ private:
         );
     }
 
+    template<class Generator>
+    rocrand_status generate(Generator& g, hip_bfloat16 * output, size_t size)
+    {
+        return rocrand_generate_normal_bf16(
+            g.m_generator, output, size, this->mean(), this->stddev()
+        );
+    }
+
     param_type m_params;
 };
 
@@ -1096,6 +1113,156 @@ template<unsigned long long DefaultSeed>
 constexpr typename philox4x32_10_engine<DefaultSeed>::seed_type philox4x32_10_engine<DefaultSeed>::default_seed;
 /// \endcond
 
+/// \brief Reduced-round variant of the Philox engine using 7 rounds.
+///
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// Philox4x32-7 still passes BigCrush; the three dropped rounds trade
+/// statistical margin for throughput.
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x32_DEFAULT_SEED>
+class philox4x32_7_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    philox4x32_7_engine(seed_type   seed_value   = DefaultSeed,
+                        offset_type offset_value = 0,
+                        order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    philox4x32_7_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~philox4x32_7_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_32_7;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x32_7_engine<DefaultSeed>::seed_type
+    philox4x32_7_engine<DefaultSeed>::default_seed;
+/// \endcond
+
 /// \brief Pseudorandom number engine based XORWOW algorithm.
 ///
 /// xorwow_engine is a xorshift pseudorandom
@@ -1963,51 +2130,35 @@ template<unsigned long long DefaultSeed>
 constexpr typename mt19937_engine<DefaultSeed>::seed_type mt19937_engine<DefaultSeed>::default_seed;
 /// \endcond
 
-/// \brief Sobol's quasi-random sequence generator
+/// \brief Random number engine based on the WELL19937c algorithm.
 ///
-/// sobol32_engine is quasi-random number engine which produced Sobol sequences.
-/// This implementation supports generating sequences in up to 20,000 dimensions.
-/// The engine produces random unsigned integers on the interval [0, 2^32 - 1].
-template<unsigned int DefaultNumDimensions = 1>
-class sobol32_engine
+/// well19937 is a random number engine based on the WELL19937c algorithm
+/// as proposed in "Improved Long-Period Generators Based on Linear Recurrences
+/// Modulo 2". It produces high quality random numbers of type \p unsigned \p int
+/// on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = 0ULL>
+class well19937_engine
 {
 public:
     /// \copydoc philox4x32_10_engine::result_type
     typedef unsigned int result_type;
-    /// \copydoc philox4x32_10_engine::order_type
-    typedef rocrand_ordering order_type;
-    /// \copydoc philox4x32_10_engine::offset_type
-    typedef unsigned long long offset_type;
-    /// \typedef dimensions_num_type
-    /// Quasi-random number engine type for number of dimensions.
-    ///
-    /// See also dimensions()
-    typedef unsigned int dimensions_num_type;
-    /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
-    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
 
     /// \brief Constructs the pseudo-random number engine.
     ///
-    /// \param num_of_dimensions - number of dimensions to use in the initialization of the internal state, see also dimensions()
-    /// \param offset_value - number of internal states that should be skipped, see also offset()
-    /// \param order_value - ordering of the sequences generated by the engine, see also order()
-    ///
-    /// See also: rocrand_create_generator()
-    sobol32_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
-                   offset_type         offset_value      = 0,
-                   order_type          order_value       = ROCRAND_ORDERING_QUASI_DEFAULT)
+    /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
+    well19937_engine(seed_type seed_value = DefaultSeed)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
         try
         {
-            this->order(order_value);
-            if(offset_value > 0)
-            {
-                this->offset(offset_value);
-            }
-            this->dimensions(num_of_dimensions);
+            this->seed(seed_value);
         }
         catch(...)
         {
@@ -2017,8 +2168,7 @@ public:
     }
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
-    sobol32_engine(rocrand_generator& generator)
-        : m_generator(generator)
+    well19937_engine(rocrand_generator& generator) : m_generator(generator)
     {
         if(generator == NULL)
         {
@@ -2027,67 +2177,218 @@ public:
         generator = NULL;
     }
 
+    well19937_engine(const well19937_engine&) = delete;
+
+    well19937_engine(well19937_engine&&) = delete;
+
+    well19937_engine& operator=(const well19937_engine&) = delete;
+
+    well19937_engine& operator=(well19937_engine&&) = delete;
+
     /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
-    ~sobol32_engine() noexcept(false)
+    ~well19937_engine() noexcept(false)
     {
         rocrand_status status = rocrand_destroy_generator(m_generator);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
     }
 
     /// \copydoc philox4x32_10_engine::stream()
     void stream(hipStream_t value)
     {
         rocrand_status status = rocrand_set_stream(m_generator, value);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
     }
 
-    /// \copydoc philox4x32_10_engine::order()
-    void order(order_type value)
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
     {
-        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS)
             throw rocrand_cpp::error(status);
     }
 
-    /// \copydoc philox4x32_10_engine::offset()
-    void offset(offset_type value)
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
     {
-        rocrand_status status = rocrand_set_offset(this->m_generator, value);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
     }
 
-    /// \brief Set the number of dimensions of a quasi-random number generator.
-    ///
-    /// Supported values of \p dimensions are 1 to 20000.
-    ///
-    /// - This operation resets the generator's internal state.
-    /// - This operation does not change the generator's offset.
-    ///
-    /// \param value - Number of dimensions
-    ///
-    /// See also: rocrand_set_quasi_random_generator_dimensions()
-    void dimensions(dimensions_num_type value)
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
     {
-        rocrand_status status =
-            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        return 0;
     }
 
-    /// \brief Fills \p output with uniformly distributed random integer values.
-    ///
-    /// Generates \p size random integer values uniformly distributed
-    /// on the interval [0, 2^32 - 1], and stores them into the device memory
-    /// referenced by \p output pointer.
-    ///
-    /// \param output - Pointer to device memory to store results
-    /// \param size - Number of values to generate
-    ///
-    /// Requirements:
-    /// * The device memory pointed by \p output must have been previously allocated
-    /// and be large enough to store at least \p size values of \p IntType type.
-    /// * \p size must be a multiple of the engine's number of dimensions.
-    ////
-    /// See also: rocrand_generate()
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_MT19937;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename well19937_engine<DefaultSeed>::seed_type
+    well19937_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Sobol's quasi-random sequence generator
+///
+/// sobol32_engine is quasi-random number engine which produced Sobol sequences.
+/// This implementation supports generating sequences in up to 20,000 dimensions.
+/// The engine produces random unsigned integers on the interval [0, 2^32 - 1].
+template<unsigned int DefaultNumDimensions = 1>
+class sobol32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \typedef dimensions_num_type
+    /// Quasi-random number engine type for number of dimensions.
+    ///
+    /// See also dimensions()
+    typedef unsigned int dimensions_num_type;
+    /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
+    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+
+    /// \brief Constructs the pseudo-random number engine.
+    ///
+    /// \param num_of_dimensions - number of dimensions to use in the initialization of the internal state, see also dimensions()
+    /// \param offset_value - number of internal states that should be skipped, see also offset()
+    /// \param order_value - ordering of the sequences generated by the engine, see also order()
+    ///
+    /// See also: rocrand_create_generator()
+    sobol32_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
+                   offset_type         offset_value      = 0,
+                   order_type          order_value       = ROCRAND_ORDERING_QUASI_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        try
+        {
+            this->order(order_value);
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->dimensions(num_of_dimensions);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    sobol32_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~sobol32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Set the number of dimensions of a quasi-random number generator.
+    ///
+    /// Supported values of \p dimensions are 1 to 20000.
+    ///
+    /// - This operation resets the generator's internal state.
+    /// - This operation does not change the generator's offset.
+    ///
+    /// \param value - Number of dimensions
+    ///
+    /// See also: rocrand_set_quasi_random_generator_dimensions()
+    void dimensions(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Fills \p output with uniformly distributed random integer values.
+    ///
+    /// Generates \p size random integer values uniformly distributed
+    /// on the interval [0, 2^32 - 1], and stores them into the device memory
+    /// referenced by \p output pointer.
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// Requirements:
+    /// * The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p IntType type.
+    /// * \p size must be a multiple of the engine's number of dimensions.
+    ////
+    /// See also: rocrand_generate()
     template<class Generator>
     void operator()(result_type * output, size_t size)
     {
@@ -3272,9 +3573,1190 @@ constexpr typename threefry4x64_20_engine<DefaultSeed>::seed_type
     threefry4x64_20_engine<DefaultSeed>::default_seed;
 /// \endcond
 
+/// \brief Reduced-round variant of the 4 state 64-bit ThreeFry engine using 13 rounds.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval [0; 2^64 - 1].
+/// The dropped rounds trade statistical margin for throughput.
+template<unsigned long long DefaultSeed = 0>
+class threefry4x64_13_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    threefry4x64_13_engine(seed_type   seed_value   = DefaultSeed,
+                           offset_type offset_value = 0,
+                           order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    threefry4x64_13_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~threefry4x64_13_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_THREEFRY4_64_13;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename threefry4x64_13_engine<DefaultSeed>::seed_type
+    threefry4x64_13_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on PCG64 (XSL-RR).
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the
+/// interval [0; 2^64 - 1].
+template<unsigned long long DefaultSeed = ROCRAND_PCG64_DEFAULT_SEED>
+class pcg64_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    pcg64_engine(seed_type   seed_value   = DefaultSeed,
+                           offset_type offset_value = 0,
+                           order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    pcg64_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~pcg64_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PCG64;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename pcg64_engine<DefaultSeed>::seed_type
+    pcg64_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on xoshiro256++.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the
+/// interval [0; 2^64 - 1].
+template<unsigned long long DefaultSeed = ROCRAND_XOSHIRO256PP_DEFAULT_SEED>
+class xoshiro256pp_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    xoshiro256pp_engine(seed_type   seed_value   = DefaultSeed,
+                        offset_type offset_value = 0,
+                        order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    xoshiro256pp_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~xoshiro256pp_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_XOSHIRO256PP;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename xoshiro256pp_engine<DefaultSeed>::seed_type
+    xoshiro256pp_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the ChaCha20 stream cipher.
+///
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// The generated numbers are the ChaCha20 key stream for the key derived from
+/// the seed, so they are computationally indistinguishable from uniform for an
+/// observer who does not know the seed.
+template<unsigned long long DefaultSeed = ROCRAND_CHACHA20_DEFAULT_SEED>
+class chacha20_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    chacha20_engine(seed_type   seed_value   = DefaultSeed,
+                    offset_type offset_value = 0,
+                    order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    chacha20_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~chacha20_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_CHACHA20;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename chacha20_engine<DefaultSeed>::seed_type
+    chacha20_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the Squares counter-based generator.
+///
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// Each number is computed directly from a 64-bit counter and a key derived
+/// from the seed, so the engine state is minimal and skipping ahead costs a
+/// single addition.
+template<unsigned long long DefaultSeed = ROCRAND_SQUARES32_DEFAULT_SEED>
+class squares32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    squares32_engine(seed_type   seed_value   = DefaultSeed,
+                     offset_type offset_value = 0,
+                     order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    squares32_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~squares32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_SQUARES32;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename squares32_engine<DefaultSeed>::seed_type
+    squares32_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the counter-based Philox4x64-10 algorithm.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval [0; 2^64 - 1].
+/// The four 64-bit outputs of each counter block feed 64-bit consumers directly,
+/// without pairing two 32-bit draws.
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x64_DEFAULT_SEED>
+class philox4x64_10_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    philox4x64_10_engine(seed_type   seed_value   = DefaultSeed,
+                         offset_type offset_value = 0,
+                         order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    philox4x64_10_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~philox4x64_10_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x64_10_engine<DefaultSeed>::seed_type
+    philox4x64_10_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Hybrid engine that routes each generation by its size.
+///
+/// adaptive_engine owns a Philox 4x32-10 engine and an MTGP32 engine and
+/// forwards every generation to the one expected to be faster for the
+/// requested size; the crossover is calibrated on first use. It produces
+/// high quality random numbers of type \p unsigned \p int on the interval
+/// [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = 0ULL>
+class adaptive_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    adaptive_engine(seed_type   seed_value   = DefaultSeed,
+                    offset_type offset_value = 0,
+                    order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    adaptive_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~adaptive_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_ADAPTIVE;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename adaptive_engine<DefaultSeed>::seed_type
+    adaptive_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Host-side adaptor satisfying UniformRandomBitGenerator over a
+/// rocRAND pseudo-random number engine.
+///
+/// The adaptor fills an internal host buffer through the engine's regular
+/// device generation path and hands out single values from it, refilling
+/// the buffer when it runs empty. This lets host \p &lt;random&gt;-consuming
+/// code (\p std::shuffle, the standard distributions) draw individual
+/// values at amortized device fill cost.
+///
+/// Values are consumed in generation order, so consecutive draws continue
+/// the engine's sequence exactly like one large fill would.
+///
+/// \tparam Engine - type of the underlying pseudo-random number engine,
+/// for example \ref rocrand_cpp::philox4x32_10
+///
+/// Example:
+/// \code
+/// #include <rocrand/rocrand.hpp>
+/// #include <algorithm>
+///
+/// int main()
+/// {
+///     std::vector<int> v(100000);
+///     // ...
+///     rocrand_cpp::host_buffered_engine<rocrand_cpp::philox4x32_10> engine;
+///     std::shuffle(v.begin(), v.end(), engine);
+/// }
+/// \endcode
+template<class Engine>
+class host_buffered_engine
+{
+public:
+    /// \typedef engine_type
+    /// Type of the underlying pseudo-random number engine.
+    typedef Engine engine_type;
+    /// \typedef result_type
+    /// Type of values generated by the random number engine.
+    typedef typename Engine::result_type result_type;
+    /// \typedef seed_type
+    /// Pseudo-random number engine seed type definition.
+    typedef typename Engine::seed_type seed_type;
+    /// \brief The default number of values generated per device fill.
+    static constexpr size_t default_buffer_size = 1 << 20;
+
+    /// \brief Constructs the adaptor and its underlying engine.
+    ///
+    /// \param seed_value - seed value to use in the initialization of the engine's internal state
+    /// \param buffer_size - number of values generated per device fill, must be greater than 0
+    ///
+    /// See also: rocrand_cpp::philox4x32_10_engine::philox4x32_10_engine()
+    host_buffered_engine(seed_type seed_value  = Engine::default_seed,
+                         size_t    buffer_size = default_buffer_size)
+        : m_engine(seed_value), m_buffer(buffer_size), m_device_buffer(NULL),
+          // An exhausted buffer triggers a fill on the first draw
+          m_index(buffer_size)
+    {
+        if(buffer_size == 0)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_OUT_OF_RANGE);
+        }
+        hipError_t error
+            = hipMalloc(&m_device_buffer, buffer_size * sizeof(result_type));
+        if(error != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_ALLOCATION_FAILED);
+        }
+    }
+
+    host_buffered_engine(const host_buffered_engine&) = delete;
+    host_buffered_engine& operator=(const host_buffered_engine&) = delete;
+
+    /// Destructs the adaptor and its underlying engine.
+    ~host_buffered_engine()
+    {
+        (void)hipFree(m_device_buffer);
+    }
+
+    /// \brief Sets the seed of the underlying pseudo-random number engine.
+    ///
+    /// Values still buffered from the previous sequence are discarded.
+    ///
+    /// \param value - New seed value
+    ///
+    /// See also: rocrand_cpp::philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        m_engine.seed(value);
+        m_index = m_buffer.size();
+    }
+
+    /// \brief Returns the next value of the engine's sequence.
+    ///
+    /// When the internal buffer is exhausted, it is refilled with
+    /// \p buffer_size values through the engine's device generation path.
+    result_type operator()()
+    {
+        if(m_index == m_buffer.size())
+        {
+            this->fill();
+        }
+        return m_buffer[m_index++];
+    }
+
+    /// Returns the smallest possible value that can be generated by the engine.
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// Returns the largest possible value that can be generated by the engine.
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /// Returns type of the rocRAND pseudo-random number generator associated with the engine.
+    static constexpr rocrand_rng_type type()
+    {
+        return Engine::type();
+    }
+
+private:
+    void fill()
+    {
+        uniform_int_distribution<result_type> dist;
+        dist(m_engine, m_device_buffer, m_buffer.size());
+        hipError_t error = hipMemcpy(m_buffer.data(),
+                                     m_device_buffer,
+                                     m_buffer.size() * sizeof(result_type),
+                                     hipMemcpyDeviceToHost);
+        if(error != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        }
+        m_index = 0;
+    }
+
+    Engine m_engine;
+    std::vector<result_type> m_buffer;
+    result_type * m_device_buffer;
+    size_t m_index;
+};
+
+/// \cond
+template<class Engine>
+constexpr size_t host_buffered_engine<Engine>::default_buffer_size;
+/// \endcond
+
 /// \typedef philox4x32_10;
 /// \brief Typedef of rocrand_cpp::philox4x32_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
 typedef philox4x32_10_engine<> philox4x32_10;
+/// \typedef philox4x32_7;
+/// \brief Typedef of rocrand_cpp::philox4x32_7_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
+typedef philox4x32_7_engine<> philox4x32_7;
+/// \typedef philox4x64_10;
+/// \brief Typedef of rocrand_cpp::philox4x64_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x64_DEFAULT_SEED).
+typedef philox4x64_10_engine<> philox4x64_10;
 /// \typedef xorwow
 /// \brief Typedef of \p rocrand_cpp::xorwow_engine PRNG engine with default seed (#ROCRAND_XORWOW_DEFAULT_SEED).
 typedef xorwow_engine<> xorwow;
@@ -3294,6 +4776,9 @@ typedef lfsr113_engine<> lfsr113;
 /// \typedef mt19937
 /// \brief Typedef of \p rocrand_cpp::mt19937_engine PRNG engine with default seed (0).
 typedef mt19937_engine<> mt19937;
+/// \typedef well19937
+/// \brief Typedef of \p rocrand_cpp::well19937_engine PRNG engine with default seed (0).
+typedef well19937_engine<> well19937;
 /// \typedef threefry2x32
 /// \brief Typedef of \p rocrand_cpp::threefry2x32_20_engine PRNG engine with default seed (0).
 typedef threefry2x32_20_engine<> threefry2x32;
@@ -3306,6 +4791,24 @@ typedef threefry4x32_20_engine<> threefry4x32;
 /// \typedef threefry4x64
 /// \brief Typedef of \p rocrand_cpp::threefry4x64_20_engine PRNG engine with default seed (0).
 typedef threefry4x64_20_engine<> threefry4x64;
+/// \typedef threefry4x64_13
+/// \brief Typedef of \p rocrand_cpp::threefry4x64_13_engine PRNG engine with default seed (0).
+typedef threefry4x64_13_engine<> threefry4x64_13;
+/// \typedef pcg64
+/// \brief Typedef of \p rocrand_cpp::pcg64_engine PRNG engine with default seed (#ROCRAND_PCG64_DEFAULT_SEED).
+typedef pcg64_engine<> pcg64;
+/// \typedef xoshiro256pp
+/// \brief Typedef of \p rocrand_cpp::xoshiro256pp_engine PRNG engine with default seed (#ROCRAND_XOSHIRO256PP_DEFAULT_SEED).
+typedef xoshiro256pp_engine<> xoshiro256pp;
+/// \typedef chacha20
+/// \brief Typedef of \p rocrand_cpp::chacha20_engine PRNG engine with default seed (#ROCRAND_CHACHA20_DEFAULT_SEED).
+typedef chacha20_engine<> chacha20;
+/// \typedef squares32
+/// \brief Typedef of \p rocrand_cpp::squares32_engine PRNG engine with default seed (#ROCRAND_SQUARES32_DEFAULT_SEED).
+typedef squares32_engine<> squares32;
+/// \typedef adaptive
+/// \brief Typedef of \p rocrand_cpp::adaptive_engine PRNG engine with default seed (0).
+typedef adaptive_engine<> adaptive;
 /// \typedef sobol32
 /// \brief Typedef of \p rocrand_cpp::sobol32_engine QRNG engine with default number of dimensions (1).
 typedef sobol32_engine<> sobol32;
@@ -0,0 +1,344 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_CHACHA20_H_
+#define ROCRAND_CHACHA20_H_
+
+#ifndef FQUALIFIERS
+    #define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand/rocrand_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_CHACHA20_DEFAULT_SEED
+ * \brief Default seed for CHACHA20 PRNG.
+ */
+#define ROCRAND_CHACHA20_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+
+class chacha20_engine
+{
+public:
+    struct chacha20_state
+    {
+        // 256-bit key, expanded from the 64-bit seed
+        unsigned int key[8];
+        // Block counter; every block yields 16 values
+        unsigned long long counter;
+        // Nonce words, used as the subsequence selector
+        unsigned long long nonce;
+        // Current output block
+        unsigned int result[16];
+        // Position inside the current block
+        unsigned int substate;
+
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float        boxmuller_float; // normally distributed float
+        double       boxmuller_double; // normally distributed double
+#endif
+    };
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2 ^ 68 numbers long.
+    FQUALIFIERS chacha20_engine(const unsigned long long seed        = 0,
+                                const unsigned long long subsequence = 0,
+                                const unsigned long long offset      = 0)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 2 ^ 68 numbers long.
+    FQUALIFIERS void seed(const unsigned long long seed        = 0,
+                          const unsigned long long subsequence = 0,
+                          const unsigned long long offset      = 0)
+    {
+        // Expand the 64-bit seed into the 256-bit key with splitmix64
+        // so that nearby seeds produce unrelated keys
+        unsigned long long x = seed;
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z = z ^ (z >> 31);
+            m_state.key[2 * i]     = static_cast<unsigned int>(z);
+            m_state.key[2 * i + 1] = static_cast<unsigned int>(z >> 32);
+        }
+        m_state.counter  = 0;
+        m_state.nonce    = subsequence;
+        m_state.substate = 0;
+
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+#endif
+
+        this->discard_impl(offset);
+        this->chacha20_rounds();
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    /// The skip has constant cost: only the block counter is advanced
+    /// before the next block is computed.
+    FQUALIFIERS void discard(unsigned long long offset)
+    {
+        this->discard_impl(offset);
+        this->chacha20_rounds();
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences,
+    /// a subsequence consisting of 2 ^ 68 random numbers. Each
+    /// subsequence keys its blocks with a distinct nonce, so the skip
+    /// has constant cost.
+    FQUALIFIERS void discard_subsequence(unsigned long long subsequence)
+    {
+        m_state.nonce += subsequence;
+        this->chacha20_rounds();
+    }
+
+    FQUALIFIERS unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS unsigned int next()
+    {
+        unsigned int ret = m_state.result[m_state.substate];
+        m_state.substate++;
+        if(m_state.substate == 16)
+        {
+            m_state.substate = 0;
+            m_state.counter++;
+            this->chacha20_rounds();
+        }
+        return ret;
+    }
+
+protected:
+    /// Computes the output block for the current counter and nonce
+    /// (the ChaCha20 block function).
+    FQUALIFIERS void chacha20_rounds()
+    {
+        unsigned int x[16];
+
+        // "expand 32-byte k"
+        x[0] = 0x61707865U;
+        x[1] = 0x3320646EU;
+        x[2] = 0x79622D32U;
+        x[3] = 0x6B206574U;
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            x[4 + i] = m_state.key[i];
+        }
+        ::rocrand_device::detail::split_ull(x[12], x[13], m_state.counter);
+        ::rocrand_device::detail::split_ull(x[14], x[15], m_state.nonce);
+
+        #pragma unroll
+        for(unsigned int round_idx = 0; round_idx < 10; round_idx++)
+        {
+            // Column round
+            quarter_round(x[0], x[4], x[8], x[12]);
+            quarter_round(x[1], x[5], x[9], x[13]);
+            quarter_round(x[2], x[6], x[10], x[14]);
+            quarter_round(x[3], x[7], x[11], x[15]);
+            // Diagonal round
+            quarter_round(x[0], x[5], x[10], x[15]);
+            quarter_round(x[1], x[6], x[11], x[12]);
+            quarter_round(x[2], x[7], x[8], x[13]);
+            quarter_round(x[3], x[4], x[9], x[14]);
+        }
+
+        m_state.result[0] = x[0] + 0x61707865U;
+        m_state.result[1] = x[1] + 0x3320646EU;
+        m_state.result[2] = x[2] + 0x79622D32U;
+        m_state.result[3] = x[3] + 0x6B206574U;
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            m_state.result[4 + i] = x[4 + i] + m_state.key[i];
+        }
+        unsigned int lo, hi;
+        ::rocrand_device::detail::split_ull(lo, hi, m_state.counter);
+        m_state.result[12] = x[12] + lo;
+        m_state.result[13] = x[13] + hi;
+        ::rocrand_device::detail::split_ull(lo, hi, m_state.nonce);
+        m_state.result[14] = x[14] + lo;
+        m_state.result[15] = x[15] + hi;
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    /// Does not calculate new values (or update <tt>m_state.result</tt>).
+    FQUALIFIERS void discard_impl(unsigned long long offset)
+    {
+        // Adjust offset for subset
+        m_state.substate += offset & 15;
+        unsigned long long counter_offset = offset / 16;
+        counter_offset += m_state.substate < 16 ? 0 : 1;
+        m_state.substate += m_state.substate < 16 ? 0 : -16;
+        // Discard blocks
+        m_state.counter += counter_offset;
+    }
+
+    FQUALIFIERS static void quarter_round(unsigned int& a,
+                                          unsigned int& b,
+                                          unsigned int& c,
+                                          unsigned int& d)
+    {
+        a += b; d ^= a; d = rotl(d, 16);
+        c += d; b ^= c; b = rotl(b, 12);
+        a += b; d ^= a; d = rotl(d, 8);
+        c += d; b ^= c; b = rotl(b, 7);
+    }
+
+    FQUALIFIERS static unsigned int rotl(const unsigned int x, const unsigned int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+protected:
+    // State
+    chacha20_state m_state;
+
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<chacha20_engine>;
+#endif
+
+}; // chacha20_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::chacha20_engine rocrand_state_chacha20;
+/// \endcond
+
+/**
+ * \brief Initializes CHACHA20 state.
+ *
+ * Initializes the CHACHA20 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS void rocrand_init(const unsigned long long seed,
+                              const unsigned long long subsequence,
+                              const unsigned long long offset,
+                              rocrand_state_chacha20*  state)
+{
+    *state = rocrand_state_chacha20(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using CHACHA20 generator in \p state.
+ * State is incremented by one position.
+ *
+ * The values are the key stream of the ChaCha20 stream cipher keyed by the
+ * seed, so the output of one subsequence is computationally indistinguishable
+ * from uniform for an observer who does not know the seed.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand(rocrand_state_chacha20* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates CHACHA20 state to skip ahead by \p offset elements.
+ *
+ * Updates the CHACHA20 state in \p state to skip ahead by \p offset elements.
+ * The skip has constant cost: only the block counter is advanced.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead(unsigned long long offset, rocrand_state_chacha20* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates CHACHA20 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the CHACHA20 \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^68 numbers long. The skip has constant cost: each
+ * subsequence keys its blocks with a distinct nonce.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead_subsequence(unsigned long long subsequence,
+                                       rocrand_state_chacha20* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates CHACHA20 state to skip ahead by \p sequence sequences.
+ *
+ * Updates the CHACHA20 \p state skipping \p sequence sequences ahead.
+ * For CHACHA20 each sequence is 2^68 numbers long (equal to the size
+ * of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead_sequence(unsigned long long sequence, rocrand_state_chacha20* state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_CHACHA20_H_
+
+/** @} */ // end of group rocranddevice
@@ -105,6 +105,132 @@ unsigned long long mad_u64_u32(const unsigned int x, const unsigned int y, const
   #endif
 }
 
+#if __HIP_DEVICE_COMPILE__ && \
+    ( defined(__gfx1010__) || \
+      defined(__gfx1011__) || \
+      defined(__gfx1012__) || \
+      defined(__gfx1030__) || \
+      defined(__gfx1031__) || \
+      defined(__gfx1032__) || \
+      defined(__gfx1033__) || \
+      defined(__gfx1034__) || \
+      defined(__gfx1035__) || \
+      defined(__gfx1036__) || \
+      defined(__gfx1100__) || \
+      defined(__gfx1101__) || \
+      defined(__gfx1102__) || \
+      defined(__gfx1103__) )
+  #if !defined(ROCRAND_MRG_INTEGER_SCALING)
+    #define ROCRAND_MRG_INTEGER_SCALING
+  #endif
+#endif
+
+// The three functions below scale MRG engine outputs in integer arithmetic.
+// Consumer architectures run double precision at a small fraction of the
+// integer rate, so on them (see ROCRAND_MRG_INTEGER_SCALING above) the MRG
+// generators scale their outputs with these instead of the double-precision
+// multiplies. The integer path reproduces the double path bit for bit
+// (verified exhaustively over the full output ranges of both engines), so
+// the generated sequences do not depend on which path was compiled in.
+
+// Rounds the product of \p v and \p c53, the 53-bit mantissa of a scaling
+// constant, to 53 significant bits (to nearest, ties to even) exactly as
+// the double-precision multiply does. \p shift receives the number of bits
+// the product was scaled down by.
+FQUALIFIERS
+unsigned long long mrg_mul_round_53(const unsigned int v,
+                                    const unsigned long long c53,
+                                    unsigned int * shift)
+{
+    const unsigned long long hi = v * (c53 >> 32);
+    const unsigned long long lo = v * (c53 & 0xFFFFFFFFULL);
+    const unsigned long long p_lo = (hi << 32) + lo;
+    const unsigned long long p_hi = (hi >> 32) + (p_lo < lo ? 1ULL : 0ULL);
+
+    const unsigned int t = p_hi != 0
+        ? 64u + (63u - __builtin_clzll(p_hi))
+        : 63u - __builtin_clzll(p_lo);
+    if(t <= 52)
+    {
+        *shift = 0;
+        return p_lo;
+    }
+    const unsigned int sh = t - 52;
+    unsigned long long keep = (p_lo >> sh) | (p_hi << (64 - sh));
+    const unsigned long long rem = p_lo & ((1ULL << sh) - 1);
+    const unsigned long long half = 1ULL << (sh - 1);
+    if(rem > half || (rem == half && (keep & 1)))
+    {
+        keep++;
+        if(keep == (1ULL << 53))
+        {
+            keep >>= 1;
+            *shift = sh + 1;
+            return keep;
+        }
+    }
+    *shift = sh;
+    return keep;
+}
+
+// trunc(v * c) for a scaling constant c = c53 * 2^-unit_shift whose
+// products stay below 2^32
+FQUALIFIERS
+unsigned int mrg_scale_to_uint(const unsigned int v,
+                               const unsigned long long c53,
+                               const unsigned int unit_shift)
+{
+    if(v == 0)
+    {
+        return 0;
+    }
+    unsigned int sh;
+    const unsigned long long keep = mrg_mul_round_53(v, c53, &sh);
+    return static_cast<unsigned int>(keep >> (unit_shift - sh));
+}
+
+// (float)(v * c) for v > 0 and a scaling constant c = c53 * 2^(e - 53)
+// whose products are normal as floats: the 53-bit intermediate is rounded
+// again to a 24-bit mantissa, matching the double-to-float conversion
+FQUALIFIERS
+float mrg_scale_to_float(const unsigned int v,
+                         const unsigned long long c53,
+                         const int e)
+{
+    unsigned int sh;
+    const unsigned long long keep = mrg_mul_round_53(v, c53, &sh);
+    unsigned int t = 63u - __builtin_clzll(keep);
+    int expo = e - 53 + static_cast<int>(sh);
+    unsigned int m24;
+    if(t > 23)
+    {
+        const unsigned int sh2 = t - 23;
+        m24 = static_cast<unsigned int>(keep >> sh2);
+        const unsigned long long rem = keep & ((1ULL << sh2) - 1);
+        const unsigned long long half = 1ULL << (sh2 - 1);
+        if(rem > half || (rem == half && (m24 & 1)))
+        {
+            m24++;
+            if(m24 == (1u << 24))
+            {
+                m24 >>= 1;
+                expo++;
+            }
+        }
+        expo += sh2;
+        t = 23;
+    }
+    else
+    {
+        m24 = static_cast<unsigned int>(keep);
+    }
+    const unsigned int bits = ((127u + t + expo) << 23)
+        | ((m24 << (23 - t)) & ((1u << 23) - 1));
+    float out;
+    __builtin_memcpy(&out, &bits, sizeof(out));
+    return out;
+}
+
 // This helps access fields of engine's internal state which
 // saves floats and doubles generated using the Box–Muller transform
 template<typename Engine>
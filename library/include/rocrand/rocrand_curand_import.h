@@ -0,0 +1,170 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_CURAND_IMPORT_H_
+#define ROCRAND_CURAND_IMPORT_H_
+
+#ifndef FQUALIFIERS
+    #define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_xorwow.h"
+
+// Checkpoint blobs live in host memory, so unlike the generation functions
+// these converters must be callable from host code as well.
+#define ROCRAND_IMPORT_QUALIFIERS inline __host__ __device__
+
+namespace rocrand_device
+{
+namespace detail
+{
+
+// Field-for-field mirror of curandStateXORWOW as laid out by curand_kernel.h.
+// The layout is part of cuRAND's checkpoint ABI and has been stable since
+// CUDA 5; \p v holds the xorshift words and \p d the Weyl sequence value.
+struct curand_state_xorwow_layout
+{
+    unsigned int d;
+    unsigned int v[5];
+    int          boxmuller_flag;
+    int          boxmuller_flag_double;
+    float        boxmuller_extra;
+    double       boxmuller_extra_double;
+};
+
+static_assert(sizeof(curand_state_xorwow_layout) == 48,
+              "curandStateXORWOW mirror does not match the expected 48-byte layout");
+
+// Field-for-field mirror of curandStatePhilox4_32_10. \p ctr and \p key are
+// the Philox inputs, \p output the block computed for the current counter
+// and \p state the index of the next word to hand out from that block.
+struct curand_state_philox4x32_10_layout
+{
+    uint4        ctr;
+    uint4        output;
+    uint2        key;
+    unsigned int state;
+    int          boxmuller_flag;
+    int          boxmuller_flag_double;
+    float        boxmuller_extra;
+    double       boxmuller_extra_double;
+};
+
+static_assert(sizeof(curand_state_philox4x32_10_layout) == 64,
+              "curandStatePhilox4_32_10 mirror does not match the expected 64-byte layout");
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Converts cuRAND XORWOW states into rocRAND XORWOW states.
+ *
+ * Reinterprets \p src as an array of \p n <tt>curandStateXORWOW</tt> values
+ * (for example a checkpoint blob read back from disk) and writes the
+ * equivalent \p rocrand_state_xorwow values to \p dst. Both libraries
+ * implement Marsaglia's XORWOW with the same xorshift words and Weyl
+ * increment, so an imported state continues the sequence exactly where the
+ * cuRAND state left off; the banked Box-Muller values are carried over as
+ * well, so a pending second normal output is not lost.
+ *
+ * \p src and \p dst may point to host or device memory, but must both be
+ * directly addressable from the calling side and must not overlap.
+ *
+ * \param src - Pointer to \p n packed <tt>curandStateXORWOW</tt> values
+ * \param dst - Pointer to \p n \p rocrand_state_xorwow values to initialize
+ * \param n - Number of states to convert
+ */
+ROCRAND_IMPORT_QUALIFIERS
+void rocrand_import_curand_state_xorwow(const void*           src,
+                                        rocrand_state_xorwow* dst,
+                                        const size_t          n)
+{
+    typedef rocrand_state_xorwow::xorwow_state state_type;
+    static_assert(sizeof(rocrand_state_xorwow) == sizeof(state_type),
+                  "engine must hold nothing but its state");
+
+    const rocrand_device::detail::curand_state_xorwow_layout* in
+        = static_cast<const rocrand_device::detail::curand_state_xorwow_layout*>(src);
+    state_type* out = reinterpret_cast<state_type*>(dst);
+
+    for(size_t i = 0; i < n; i++)
+    {
+        out[i].d = in[i].d;
+        for(unsigned int j = 0; j < 5; j++)
+        {
+            out[i].x[j] = in[i].v[j];
+        }
+        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+        out[i].boxmuller_float_state  = static_cast<unsigned int>(in[i].boxmuller_flag);
+        out[i].boxmuller_double_state = static_cast<unsigned int>(in[i].boxmuller_flag_double);
+        out[i].boxmuller_float        = in[i].boxmuller_extra;
+        out[i].boxmuller_double       = in[i].boxmuller_extra_double;
+        #endif
+    }
+}
+
+/**
+ * \brief Converts cuRAND Philox4x32-10 states into rocRAND Philox4x32-10
+ * states.
+ *
+ * Reinterprets \p src as an array of \p n <tt>curandStatePhilox4_32_10</tt>
+ * values and writes the equivalent \p rocrand_state_philox4x32_10 values to
+ * \p dst. Counter, key, the output block computed for the current counter
+ * and the sub-state index within that block transfer one-to-one, so the
+ * imported state resumes the sequence at the exact word where the cuRAND
+ * state stopped. The banked Box-Muller values are carried over as well.
+ *
+ * \p src and \p dst may point to host or device memory, but must both be
+ * directly addressable from the calling side and must not overlap.
+ *
+ * \param src - Pointer to \p n packed <tt>curandStatePhilox4_32_10</tt> values
+ * \param dst - Pointer to \p n \p rocrand_state_philox4x32_10 values to initialize
+ * \param n - Number of states to convert
+ */
+ROCRAND_IMPORT_QUALIFIERS
+void rocrand_import_curand_state_philox4x32_10(const void*                  src,
+                                               rocrand_state_philox4x32_10* dst,
+                                               const size_t                 n)
+{
+    typedef rocrand_state_philox4x32_10::philox4x32_state state_type;
+    static_assert(sizeof(rocrand_state_philox4x32_10) == sizeof(state_type),
+                  "engine must hold nothing but its state");
+
+    const rocrand_device::detail::curand_state_philox4x32_10_layout* in
+        = static_cast<const rocrand_device::detail::curand_state_philox4x32_10_layout*>(src);
+    state_type* out = reinterpret_cast<state_type*>(dst);
+
+    for(size_t i = 0; i < n; i++)
+    {
+        out[i].counter  = in[i].ctr;
+        out[i].result   = in[i].output;
+        out[i].key      = in[i].key;
+        out[i].substate = in[i].state;
+        #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+        out[i].boxmuller_float_state  = static_cast<unsigned int>(in[i].boxmuller_flag);
+        out[i].boxmuller_double_state = static_cast<unsigned int>(in[i].boxmuller_flag_double);
+        out[i].boxmuller_float        = in[i].boxmuller_extra;
+        out[i].boxmuller_double       = in[i].boxmuller_extra_double;
+        #endif
+    }
+}
+
+#endif // ROCRAND_CURAND_IMPORT_H_
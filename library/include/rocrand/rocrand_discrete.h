@@ -27,20 +27,25 @@
 
 #include <math.h>
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_discrete_types.h"
 #include "rocrand/rocrand_normal.h"
@@ -151,6 +156,68 @@ FQUALIFIERS unsigned int discrete_cdf(const unsigned long long int            r,
  *  @{
  */
 
+/**
+ * \brief Stages the alias table of a discrete distribution into block-shared memory.
+ *
+ * Copies the \p probability and \p alias arrays of \p discrete_distribution
+ * into \p shared_probability and \p shared_alias cooperatively with all
+ * threads of the block, and returns a distribution that samples from the
+ * staged copies. In kernels that draw many samples per block from the same
+ * distribution this removes the per-sample global memory traffic of the
+ * alias table. If the table does not fit into the shared buffers (its size
+ * exceeds \p capacity), or the distribution has no alias table, the returned
+ * distribution keeps reading from global memory.
+ *
+ * All threads of the block must call this function. The returned distribution
+ * is only usable by threads of the same block, and only while the shared
+ * buffers are not reused for other purposes. The staging benefits generators
+ * that sample with the alias method (Philox, MRG, XORWOW); the CDF used by
+ * the other generators is left in global memory.
+ *
+ * \param discrete_distribution - Related discrete distribution
+ * \param shared_probability - Block-shared memory for at least \p capacity <tt>double</tt> values
+ * \param shared_alias - Block-shared memory for at least \p capacity <tt>unsigned int</tt> values
+ * \param capacity - Number of table entries the shared buffers can hold
+ *
+ * \return Distribution reading the staged table, to be passed to rocrand_discrete()
+ */
+FQUALIFIERS
+rocrand_discrete_distribution_st
+rocrand_discrete_block_stage(const rocrand_discrete_distribution discrete_distribution,
+                             double * shared_probability,
+                             unsigned int * shared_alias,
+                             const unsigned int capacity)
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+    rocrand_discrete_distribution_st staged = *discrete_distribution;
+    if(staged.size > capacity || staged.probability == NULL || staged.alias == NULL)
+    {
+        // Fall back to sampling from global memory
+        return staged;
+    }
+
+    const unsigned int flat_id
+        = (threadIdx.z * blockDim.y + threadIdx.y) * blockDim.x + threadIdx.x;
+    const unsigned int block_size = blockDim.x * blockDim.y * blockDim.z;
+
+    for(unsigned int k = flat_id; k < staged.size; k += block_size)
+    {
+        shared_probability[k] = staged.probability[k];
+        shared_alias[k] = staged.alias[k];
+    }
+    __syncthreads();
+
+    staged.probability = shared_probability;
+    staged.alias = shared_alias;
+    return staged;
+    #else
+    (void)shared_probability;
+    (void)shared_alias;
+    (void)capacity;
+    return *discrete_distribution;
+    #endif
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -211,6 +278,28 @@ FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_mrg31k3p*             st
     return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using MRG31k3p generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS uint4 rocrand_discrete4(rocrand_state_mrg31k3p*             state,
+                                    const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4{rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+                 rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+                 rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+                 rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)};
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -229,6 +318,30 @@ unsigned int rocrand_discrete(rocrand_state_mrg32k3a * state, const rocrand_disc
     return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using MRG32k3a generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_mrg32k3a * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -247,6 +360,30 @@ unsigned int rocrand_discrete(rocrand_state_xorwow * state, const rocrand_discre
     return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using XORWOW generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_xorwow * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -357,6 +494,29 @@ unsigned int rocrand_discrete(rocrand_state_lfsr113*              state,
     return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using LFSR113 generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_lfsr113*              state,
+                        const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4{rocrand_device::detail::discrete_cdf(u4.x, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.y, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.z, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.w, *discrete_distribution)};
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -411,6 +571,28 @@ FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_threefry4x32_20*      st
     return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using ThreeFry generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS uint4 rocrand_discrete4(rocrand_state_threefry4x32_20*      state,
+                                    const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4{rocrand_device::detail::discrete_cdf(u4.x, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.y, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.z, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.w, *discrete_distribution)};
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -429,6 +611,140 @@ FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_threefry4x64_20*      st
     return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_philox4x64_10*        state,
+                                          const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using ThreeFry generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS uint4 rocrand_discrete4(rocrand_state_threefry4x64_20*      state,
+                                    const rocrand_discrete_distribution discrete_distribution)
+{
+    const ulonglong4 u4 = rocrand4(state);
+    return uint4{rocrand_device::detail::discrete_cdf(u4.x, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.y, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.z, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.w, *discrete_distribution)};
+}
+
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS uint4 rocrand_discrete4(rocrand_state_philox4x64_10*        state,
+                                    const rocrand_discrete_distribution discrete_distribution)
+{
+    const ulonglong4 u4 = rocrand4(state);
+    return uint4{rocrand_device::detail::discrete_cdf(u4.x, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.y, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.z, *discrete_distribution),
+                 rocrand_device::detail::discrete_cdf(u4.w, *discrete_distribution)};
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using PCG64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_pcg64 * state,
+                                          const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using XOSHIRO256++ generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_xoshiro256pp * state,
+                                          const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using ChaCha20 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_chacha20*      state,
+                                          const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SQUARES32 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS unsigned int rocrand_discrete(rocrand_state_squares32*      state,
+                                          const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_DISCRETE_H_
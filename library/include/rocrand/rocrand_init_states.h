@@ -0,0 +1,289 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#ifndef ROCRAND_INIT_STATES_H_
+#define ROCRAND_INIT_STATES_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand/rocrand_chacha20.h"
+#include "rocrand/rocrand_common.h"
+#include "rocrand/rocrand_lfsr113.h"
+#include "rocrand/rocrand_mrg31k3p.h"
+#include "rocrand/rocrand_mrg32k3a.h"
+#include "rocrand/rocrand_pcg64.h"
+#include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
+#include "rocrand/rocrand_squares32.h"
+#include "rocrand/rocrand_threefry2x32_20.h"
+#include "rocrand/rocrand_threefry2x64_20.h"
+#include "rocrand/rocrand_threefry4x32_20.h"
+#include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
+
+#include <rocrand/rocrand.h>
+
+namespace rocrand_device {
+namespace detail {
+
+static constexpr unsigned int init_states_threads = 256;
+
+// One thread per state: thread i becomes subsequence i, and the state
+// array is written with one coalesced store per struct member row
+template<class StateType>
+ROCRAND_KERNEL __launch_bounds__(init_states_threads)
+void init_states_kernel(StateType * states, const size_t n,
+                        const unsigned long long seed,
+                        const unsigned long long offset)
+{
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    if(state_id < n)
+    {
+        StateType state;
+        rocrand_init(seed, state_id, offset, &state);
+        states[state_id] = state;
+    }
+}
+
+ROCRAND_KERNEL __launch_bounds__(init_states_threads)
+void init_states_lfsr113_kernel(rocrand_state_lfsr113 * states, const size_t n,
+                                const uint4 seed)
+{
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    if(state_id < n)
+    {
+        rocrand_state_lfsr113 state;
+        rocrand_init(seed, static_cast<unsigned int>(state_id), &state);
+        states[state_id] = state;
+    }
+}
+
+// The skip-ahead engines use the block-cooperative init: the jump
+// matrices are staged into shared memory once per block, so tail
+// threads past n still take part in the staging and only skip the store
+
+ROCRAND_KERNEL __launch_bounds__(init_states_threads)
+void init_states_xorwow_kernel(rocrand_state_xorwow * states, const size_t n,
+                               const unsigned long long seed,
+                               const unsigned long long offset)
+{
+    __shared__ unsigned int shared_jump_matrix[XORWOW_SIZE];
+
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    rocrand_state_xorwow state;
+    rocrand_init_block(seed, state_id, offset, &state, shared_jump_matrix);
+    if(state_id < n)
+    {
+        states[state_id] = state;
+    }
+}
+
+ROCRAND_KERNEL __launch_bounds__(init_states_threads)
+void init_states_mrg31k3p_kernel(rocrand_state_mrg31k3p * states, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long offset)
+{
+    __shared__ unsigned int shared_jump_matrices[18];
+
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    rocrand_state_mrg31k3p state;
+    rocrand_init_block(seed, state_id, offset, &state, shared_jump_matrices);
+    if(state_id < n)
+    {
+        states[state_id] = state;
+    }
+}
+
+ROCRAND_KERNEL __launch_bounds__(init_states_threads)
+void init_states_mrg32k3a_kernel(rocrand_state_mrg32k3a * states, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long offset)
+{
+    __shared__ unsigned long long shared_jump_matrices[18];
+
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    rocrand_state_mrg32k3a state;
+    rocrand_init_block(seed, state_id, offset, &state, shared_jump_matrices);
+    if(state_id < n)
+    {
+        states[state_id] = state;
+    }
+}
+
+template<class Kernel, class StateType, class Seed>
+__host__ inline
+rocrand_status launch_init_states(Kernel kernel, StateType * states, size_t n,
+                                  Seed seed, unsigned long long offset,
+                                  hipStream_t stream)
+{
+    if(states == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    const unsigned int blocks
+        = static_cast<unsigned int>((n + init_states_threads - 1) / init_states_threads);
+    hipLaunchKernelGGL(kernel, dim3(blocks), dim3(init_states_threads), 0, stream,
+                       states, n, seed, offset);
+    if(hipGetLastError() != hipSuccess)
+    {
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Initializes an array of device generator states.
+ *
+ * Launches a kernel on \p stream that initializes the \p n states at
+ * \p states, assigning subsequence <tt>i</tt> at \p offset to state
+ * <tt>i</tt>, exactly as one call to rocrand_init() per state. One
+ * thread initializes one state, so the setup parallelizes across the
+ * whole array instead of serializing skip-ahead in the caller.
+ *
+ * Works with every pseudo-random state type whose rocrand_init() takes
+ * a seed, a subsequence, and an offset. MTGP32 keeps its dedicated
+ * rocrand_make_state_mtgp32() setup, and the quasi-random states need
+ * direction vectors per dimension instead of subsequences. The XORWOW,
+ * MRG31K3P and MRG32K3A overloads stage the skip-ahead matrices in
+ * block-shared memory via rocrand_init_block().
+ *
+ * The launch is asynchronous; the states are ready once \p stream
+ * synchronizes.
+ *
+ * \param states - Pointer to device memory for \p n states
+ * \param n - Number of states to initialize
+ * \param seed - Value to use as a seed
+ * \param offset - Absolute offset into each subsequence
+ * \param stream - Stream to launch the initialization kernel on
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p states is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the initialization was launched \n
+ */
+template<class StateType>
+__host__ inline
+rocrand_status rocrand_init_states(StateType * states, size_t n,
+                                   unsigned long long seed,
+                                   unsigned long long offset = 0,
+                                   hipStream_t stream = 0)
+{
+    return rocrand_device::detail::launch_init_states(
+        HIP_KERNEL_NAME(rocrand_device::detail::init_states_kernel<StateType>),
+        states, n, seed, offset, stream);
+}
+
+/// \cond
+__host__ inline
+rocrand_status rocrand_init_states(rocrand_state_xorwow * states, size_t n,
+                                   unsigned long long seed,
+                                   unsigned long long offset = 0,
+                                   hipStream_t stream = 0)
+{
+    return rocrand_device::detail::launch_init_states(
+        HIP_KERNEL_NAME(rocrand_device::detail::init_states_xorwow_kernel),
+        states, n, seed, offset, stream);
+}
+
+__host__ inline
+rocrand_status rocrand_init_states(rocrand_state_mrg31k3p * states, size_t n,
+                                   unsigned long long seed,
+                                   unsigned long long offset = 0,
+                                   hipStream_t stream = 0)
+{
+    return rocrand_device::detail::launch_init_states(
+        HIP_KERNEL_NAME(rocrand_device::detail::init_states_mrg31k3p_kernel),
+        states, n, seed, offset, stream);
+}
+
+__host__ inline
+rocrand_status rocrand_init_states(rocrand_state_mrg32k3a * states, size_t n,
+                                   unsigned long long seed,
+                                   unsigned long long offset = 0,
+                                   hipStream_t stream = 0)
+{
+    return rocrand_device::detail::launch_init_states(
+        HIP_KERNEL_NAME(rocrand_device::detail::init_states_mrg32k3a_kernel),
+        states, n, seed, offset, stream);
+}
+/// \endcond
+
+/**
+ * \brief Initializes an array of LFSR113 device generator states.
+ *
+ * Behaves like the generic rocrand_init_states(), with the uint4 seed
+ * and subsequence-only positioning of the LFSR113 rocrand_init().
+ *
+ * \param states - Pointer to device memory for \p n states
+ * \param n - Number of states to initialize
+ * \param seed - Value to use as a seed
+ * \param stream - Stream to launch the initialization kernel on
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p states is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the initialization was launched \n
+ */
+__host__ inline
+rocrand_status rocrand_init_states(rocrand_state_lfsr113 * states, size_t n,
+                                   uint4 seed,
+                                   hipStream_t stream = 0)
+{
+    using namespace rocrand_device::detail;
+    if(states == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    const unsigned int blocks
+        = static_cast<unsigned int>((n + init_states_threads - 1) / init_states_threads);
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(init_states_lfsr113_kernel),
+                       dim3(blocks), dim3(init_states_threads), 0, stream,
+                       states, n, seed);
+    if(hipGetLastError() != hipSuccess)
+    {
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_INIT_STATES_H_
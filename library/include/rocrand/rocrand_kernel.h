@@ -25,26 +25,35 @@
 #define FQUALIFIERS __forceinline__ __device__
 #endif // FQUALIFIERS
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_common.h"
+#include "rocrand/rocrand_curand_import.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
+#include "rocrand/rocrand_stateless.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_uniform.h"
 #include "rocrand/rocrand_normal.h"
 #include "rocrand/rocrand_log_normal.h"
 #include "rocrand/rocrand_poisson.h"
 #include "rocrand/rocrand_discrete.h"
+#include "rocrand/rocrand_stochastic_round.h"
+#include "rocrand/rocrand_init_states.h"
 
 #endif // ROCRAND_KERNEL_H_
@@ -0,0 +1,564 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_KERNEL_HPP_
+#define ROCRAND_KERNEL_HPP_
+
+// At least C++11 required
+#if defined(__cplusplus) && __cplusplus >= 201103L
+
+    #ifndef FQUALIFIERS
+        #define FQUALIFIERS __forceinline__ __device__
+    #endif // FQUALIFIERS
+
+    #include "rocrand/rocrand_kernel.h"
+
+    #include <cstddef>
+    #include <iterator>
+    #include <type_traits>
+
+namespace rocrand_cpp
+{
+
+/// \rocrand_internal \addtogroup rocranddevicecpp
+/// @{
+
+/// \brief Device-side counterparts of the rocrand_cpp distributions.
+///
+/// The classes in this namespace wrap the rocRAND device functions
+/// (rocrand_uniform(), rocrand_normal(), ...) in distribution objects
+/// modelled after the C++ standard library distributions. Unlike the
+/// classes in ::rocrand_cpp, which fill device memory through a host-side
+/// generator, these objects are used inside kernels and produce one value
+/// per call from a device engine state. The engine is selected at
+/// compile time by the state type passed to \p operator(), so the same
+/// template kernel can be instantiated for different engines and
+/// distributions without code changes or indirect calls.
+namespace device
+{
+
+/// \class uniform_real_distribution
+///
+/// \brief Produces random floating-point values uniformly distributed on the interval (0, 1].
+///
+/// \tparam RealType - type of generated values. Only \p float and \p double types are supported.
+template<class RealType = float>
+class uniform_real_distribution
+{
+    static_assert(std::is_same<float, RealType>::value || std::is_same<double, RealType>::value,
+                  "Only float and double types are supported in uniform_real_distribution");
+
+public:
+    /// See RealType.
+    typedef RealType result_type;
+
+    /// Default constructor
+    FQUALIFIERS uniform_real_distribution() {}
+
+    /// Resets distribution's internal state if there is any.
+    FQUALIFIERS void reset() {}
+
+    /// Returns the smallest possible value that can be generated.
+    FQUALIFIERS RealType min() const
+    {
+        if(std::is_same<float, RealType>::value)
+        {
+            return static_cast<RealType>(ROCRAND_2POW32_INV);
+        }
+        return static_cast<RealType>(ROCRAND_2POW32_INV_DOUBLE);
+    }
+
+    /// Returns the largest possible value that can be generated.
+    FQUALIFIERS RealType max() const
+    {
+        return 1.0;
+    }
+
+    /// \brief Returns one uniformly distributed random floating-point value
+    /// from the interval (0, 1].
+    ///
+    /// \param state - Engine state to use
+    template<class StateType>
+    FQUALIFIERS RealType operator()(StateType& state)
+    {
+        return this->generate(state, RealType());
+    }
+
+    /// Returns \c true if the distribution is the same as \p other.
+    FQUALIFIERS bool operator==(const uniform_real_distribution<RealType>& other) const
+    {
+        (void)other;
+        return true;
+    }
+
+    /// Returns \c true if the distribution is different from \p other.
+    FQUALIFIERS bool operator!=(const uniform_real_distribution<RealType>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    template<class StateType>
+    FQUALIFIERS float generate(StateType& state, float)
+    {
+        return rocrand_uniform(&state);
+    }
+
+    template<class StateType>
+    FQUALIFIERS double generate(StateType& state, double)
+    {
+        return rocrand_uniform_double(&state);
+    }
+};
+
+/// \class normal_distribution
+///
+/// \brief Produces random numbers according to a normal distribution.
+///
+/// \tparam RealType - type of generated values. Only \p float and \p double types are supported.
+template<class RealType = float>
+class normal_distribution
+{
+    static_assert(std::is_same<float, RealType>::value || std::is_same<double, RealType>::value,
+                  "Only float and double types are supported in normal_distribution");
+
+public:
+    /// See RealType.
+    typedef RealType result_type;
+
+    /// \brief Constructs a new distribution object.
+    /// \param mean - A mean distribution parameter
+    /// \param stddev - A standard deviation distribution parameter
+    FQUALIFIERS normal_distribution(RealType mean = 0.0, RealType stddev = 1.0)
+        : m_mean(mean), m_stddev(stddev)
+    {}
+
+    /// Resets distribution's internal state if there is any.
+    FQUALIFIERS void reset() {}
+
+    /// \brief Returns the mean distribution parameter.
+    ///
+    /// The mean specifies the location of the peak. The default value is 0.0.
+    FQUALIFIERS RealType mean() const
+    {
+        return m_mean;
+    }
+
+    /// \brief Returns the standard deviation distribution parameter.
+    ///
+    /// The default value is 1.0.
+    FQUALIFIERS RealType stddev() const
+    {
+        return m_stddev;
+    }
+
+    /// \brief Returns one random floating-point value distributed according
+    /// to a normal distribution.
+    ///
+    /// \param state - Engine state to use
+    template<class StateType>
+    FQUALIFIERS RealType operator()(StateType& state)
+    {
+        return m_mean + m_stddev * this->generate(state, RealType());
+    }
+
+    /// \brief Returns \c true if the distribution is the same as \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator==(const normal_distribution<RealType>& other) const
+    {
+        return m_mean == other.m_mean && m_stddev == other.m_stddev;
+    }
+
+    /// \brief Returns \c true if the distribution is different from \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator!=(const normal_distribution<RealType>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    template<class StateType>
+    FQUALIFIERS float generate(StateType& state, float)
+    {
+        return rocrand_normal(&state);
+    }
+
+    template<class StateType>
+    FQUALIFIERS double generate(StateType& state, double)
+    {
+        return rocrand_normal_double(&state);
+    }
+
+    RealType m_mean;
+    RealType m_stddev;
+};
+
+/// \class lognormal_distribution
+///
+/// \brief Produces positive random numbers according to a log-normal distribution.
+///
+/// \tparam RealType - type of generated values. Only \p float and \p double types are supported.
+template<class RealType = float>
+class lognormal_distribution
+{
+    static_assert(std::is_same<float, RealType>::value || std::is_same<double, RealType>::value,
+                  "Only float and double types are supported in lognormal_distribution");
+
+public:
+    /// See RealType.
+    typedef RealType result_type;
+
+    /// \brief Constructs a new distribution object.
+    /// \param m - A mean distribution parameter
+    /// \param s - A standard deviation distribution parameter
+    FQUALIFIERS lognormal_distribution(RealType m = 0.0, RealType s = 1.0) : m_mean(m), m_stddev(s)
+    {}
+
+    /// Resets distribution's internal state if there is any.
+    FQUALIFIERS void reset() {}
+
+    /// \brief Returns the mean distribution parameter.
+    ///
+    /// The mean specifies the location of the peak. The default value is 0.0.
+    FQUALIFIERS RealType m() const
+    {
+        return m_mean;
+    }
+
+    /// \brief Returns the standard deviation distribution parameter.
+    ///
+    /// The default value is 1.0.
+    FQUALIFIERS RealType s() const
+    {
+        return m_stddev;
+    }
+
+    /// \brief Returns one random floating-point value distributed according
+    /// to a log-normal distribution.
+    ///
+    /// \param state - Engine state to use
+    template<class StateType>
+    FQUALIFIERS RealType operator()(StateType& state)
+    {
+        return this->generate(state, RealType());
+    }
+
+    /// \brief Returns \c true if the distribution is the same as \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator==(const lognormal_distribution<RealType>& other) const
+    {
+        return m_mean == other.m_mean && m_stddev == other.m_stddev;
+    }
+
+    /// \brief Returns \c true if the distribution is different from \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator!=(const lognormal_distribution<RealType>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    template<class StateType>
+    FQUALIFIERS float generate(StateType& state, float)
+    {
+        return rocrand_log_normal(&state, m_mean, m_stddev);
+    }
+
+    template<class StateType>
+    FQUALIFIERS double generate(StateType& state, double)
+    {
+        return rocrand_log_normal_double(&state, m_mean, m_stddev);
+    }
+
+    RealType m_mean;
+    RealType m_stddev;
+};
+
+/// \class poisson_distribution
+///
+/// \brief Produces random non-negative integer values distributed according to a Poisson distribution.
+///
+/// \tparam IntType - type of generated values. Only \p unsigned \p int type is supported.
+template<class IntType = unsigned int>
+class poisson_distribution
+{
+    static_assert(std::is_same<unsigned int, IntType>::value,
+                  "Only unsigned int type is supported in poisson_distribution");
+
+public:
+    /// See IntType.
+    typedef IntType result_type;
+
+    /// \brief Constructs a new distribution object.
+    /// \param mean - A mean distribution parameter
+    FQUALIFIERS poisson_distribution(double mean = 1.0) : m_mean(mean) {}
+
+    /// Resets distribution's internal state if there is any.
+    FQUALIFIERS void reset() {}
+
+    /// \brief Returns the mean distribution parameter.
+    ///
+    /// The mean (also known as lambda) is the average number
+    /// of events per interval. The default value is 1.0.
+    FQUALIFIERS double mean() const
+    {
+        return m_mean;
+    }
+
+    /// \brief Returns one random non-negative integer value distributed
+    /// according to a Poisson distribution.
+    ///
+    /// \param state - Engine state to use
+    template<class StateType>
+    FQUALIFIERS IntType operator()(StateType& state)
+    {
+        return rocrand_poisson(&state, m_mean);
+    }
+
+    /// \brief Returns \c true if the distribution is the same as \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator==(const poisson_distribution<IntType>& other) const
+    {
+        return m_mean == other.m_mean;
+    }
+
+    /// \brief Returns \c true if the distribution is different from \p other.
+    ///
+    /// Two distribution are equal, if their parameters are equal.
+    FQUALIFIERS bool operator!=(const poisson_distribution<IntType>& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    double m_mean;
+};
+
+} // end namespace device
+
+/// \class random_iterator
+///
+/// \brief Read-only random-access iterator producing random values lazily
+/// at dereference.
+///
+/// A counting-iterator-style adaptor over the counter-based device engines:
+/// position \p i dereferences to the value \p Distribution produces from
+/// \p Engine seeded at subsequence \p i. Passing the iterator to a
+/// rocThrust or rocPRIM algorithm lets the algorithm consume random values
+/// in-register, so no intermediate buffer is generated and read back.
+///
+/// Each position draws from its own subsequence of the engine, so
+/// distributions that consume more than one engine output per value (such
+/// as \p device::normal_distribution) stay independent across positions.
+/// \p Engine must be a counter-based state type whose constructor reaches a
+/// subsequence in constant time (\p rocrand_state_philox4x32_10 and the
+/// Threefry state types); a recurrence-based engine would make every
+/// dereference pay for a sequential skip.
+///
+/// The iterator holds only the seed, the distribution's parameters and its
+/// position, so it is trivially copyable into kernel arguments.
+/// Dereferencing runs device code; to construct iterators on the host for
+/// a rocThrust pipeline, define \p FQUALIFIERS as
+/// <tt>__forceinline__ __host__ __device__</tt> before including this file.
+///
+/// \tparam Engine - counter-based device state type
+/// \tparam Distribution - distribution from \p rocrand_cpp::device applied
+/// to the engine output
+template<class Engine, class Distribution>
+class random_iterator
+{
+public:
+    /// Type of the values the iterator produces.
+    typedef typename Distribution::result_type value_type;
+    /// Values are computed at dereference, so references are by value.
+    typedef value_type reference;
+    /// See \p value_type; no object persists to point to.
+    typedef const value_type* pointer;
+    /// Type of the distance between two iterators.
+    typedef std::ptrdiff_t difference_type;
+    /// The iterator supports random access.
+    typedef std::random_access_iterator_tag iterator_category;
+
+    /// \brief Constructs an iterator at position \p index.
+    ///
+    /// \param seed - Seed of the underlying engine
+    /// \param distribution - Distribution applied to the engine output
+    /// \param index - Position of the iterator in the sequence
+    FQUALIFIERS explicit random_iterator(unsigned long long seed         = 0,
+                                         Distribution       distribution = Distribution(),
+                                         difference_type    index        = 0)
+        : m_seed(seed), m_distribution(distribution), m_index(index)
+    {}
+
+    /// Returns the value at the iterator's position.
+    FQUALIFIERS value_type operator*() const
+    {
+        Engine engine(m_seed, static_cast<unsigned long long>(m_index), 0);
+        Distribution distribution(m_distribution);
+        return distribution(engine);
+    }
+
+    /// Returns the value \p n positions after the iterator's position.
+    FQUALIFIERS value_type operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    /// Advances the iterator by one position.
+    FQUALIFIERS random_iterator& operator++()
+    {
+        m_index++;
+        return *this;
+    }
+
+    /// Advances the iterator by one position.
+    FQUALIFIERS random_iterator operator++(int)
+    {
+        random_iterator old = *this;
+        m_index++;
+        return old;
+    }
+
+    /// Moves the iterator back by one position.
+    FQUALIFIERS random_iterator& operator--()
+    {
+        m_index--;
+        return *this;
+    }
+
+    /// Moves the iterator back by one position.
+    FQUALIFIERS random_iterator operator--(int)
+    {
+        random_iterator old = *this;
+        m_index--;
+        return old;
+    }
+
+    /// Advances the iterator by \p n positions.
+    FQUALIFIERS random_iterator& operator+=(difference_type n)
+    {
+        m_index += n;
+        return *this;
+    }
+
+    /// Moves the iterator back by \p n positions.
+    FQUALIFIERS random_iterator& operator-=(difference_type n)
+    {
+        m_index -= n;
+        return *this;
+    }
+
+    /// Returns an iterator \p n positions after this one.
+    FQUALIFIERS random_iterator operator+(difference_type n) const
+    {
+        random_iterator result = *this;
+        result += n;
+        return result;
+    }
+
+    /// Returns an iterator \p n positions before this one.
+    FQUALIFIERS random_iterator operator-(difference_type n) const
+    {
+        random_iterator result = *this;
+        result -= n;
+        return result;
+    }
+
+    /// Returns the distance between \p other and this iterator.
+    FQUALIFIERS difference_type operator-(const random_iterator& other) const
+    {
+        return m_index - other.m_index;
+    }
+
+    /// Returns \c true if both iterators are at the same position.
+    FQUALIFIERS bool operator==(const random_iterator& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    /// Returns \c true if the iterators are at different positions.
+    FQUALIFIERS bool operator!=(const random_iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// Returns \c true if this iterator precedes \p other.
+    FQUALIFIERS bool operator<(const random_iterator& other) const
+    {
+        return m_index < other.m_index;
+    }
+
+    /// Returns \c true if \p other precedes this iterator.
+    FQUALIFIERS bool operator>(const random_iterator& other) const
+    {
+        return other < *this;
+    }
+
+    /// Returns \c true if this iterator does not follow \p other.
+    FQUALIFIERS bool operator<=(const random_iterator& other) const
+    {
+        return !(other < *this);
+    }
+
+    /// Returns \c true if \p other does not follow this iterator.
+    FQUALIFIERS bool operator>=(const random_iterator& other) const
+    {
+        return !(*this < other);
+    }
+
+private:
+    unsigned long long m_seed;
+    Distribution       m_distribution;
+    difference_type    m_index;
+};
+
+/// Returns an iterator \p n positions after \p it.
+template<class Engine, class Distribution>
+FQUALIFIERS random_iterator<Engine, Distribution>
+    operator+(typename random_iterator<Engine, Distribution>::difference_type n,
+              const random_iterator<Engine, Distribution>& it)
+{
+    return it + n;
+}
+
+/// \brief Constructs a \p random_iterator at position 0, deducing the
+/// distribution type from the argument.
+///
+/// \param seed - Seed of the underlying engine
+/// \param distribution - Distribution applied to the engine output
+template<class Engine, class Distribution>
+FQUALIFIERS random_iterator<Engine, Distribution>
+    make_random_iterator(unsigned long long seed, Distribution distribution)
+{
+    return random_iterator<Engine, Distribution>(seed, distribution);
+}
+
+/// @} // end of group rocranddevicecpp
+
+} // end namespace rocrand_cpp
+
+#endif // #if defined(__cplusplus) && __cplusplus >= 201103L
+
+#endif // ROCRAND_KERNEL_HPP_
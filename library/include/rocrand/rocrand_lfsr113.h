@@ -55,6 +55,18 @@ public:
     {
         uint4 z;
         uint4 subsequence;
+
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+#endif
     };
 
     /// Initializes the internal state of the PRNG using
@@ -82,6 +94,11 @@ public:
 
         reset_start_subsequence();
         discard_subsequence(subsequence);
+
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+#endif
     }
 
     /// Advances the internal state to skip one number.
@@ -128,6 +145,19 @@ public:
         return (m_state.z.x ^ m_state.z.y ^ m_state.z.z ^ m_state.z.w);
     }
 
+    FQUALIFIERS
+    uint4 next4()
+    {
+        // The recurrence is sequential, but producing four outputs per
+        // call keeps the state in registers across the updates and lets
+        // callers consume the values as one vector
+        const unsigned int x = next();
+        const unsigned int y = next();
+        const unsigned int z = next();
+        const unsigned int w = next();
+        return uint4{x, y, z, w};
+    }
+
 protected:
     /// Resets the state to the start of the current subsequence.
     FQUALIFIERS
@@ -208,6 +238,10 @@ protected:
 protected:
     lfsr113_state m_state;
 
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<lfsr113_engine>;
+#endif
+
 }; // lfsr113_engine class
 
 } // end namespace rocrand_device
@@ -255,6 +289,24 @@ unsigned int rocrand(rocrand_state_lfsr113* state)
     return state->next();
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using LFSR113 generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_lfsr113* state)
+{
+    return state->next4();
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_LFSR113_H_
@@ -32,20 +32,25 @@
 
 #include <math.h>
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_normal.h"
 
@@ -797,6 +802,9 @@ double rocrand_log_normal_double(rocrand_state_scrambled_sobol64* state, double
  *
  * Generates and returns a log-normally distributed \p float value using LFSR113
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -804,12 +812,25 @@ double rocrand_log_normal_double(rocrand_state_scrambled_sobol64* state, double
  *
  * \return Log-normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 FQUALIFIERS
 float rocrand_log_normal(rocrand_state_lfsr113* state, float mean, float stddev)
 {
-    float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_lfsr113> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
@@ -840,6 +861,9 @@ float2 rocrand_log_normal2(rocrand_state_lfsr113* state, float mean, float stdde
  *
  * Generates and returns a log-normally distributed \p double value using LFSR113
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -847,12 +871,28 @@ float2 rocrand_log_normal2(rocrand_state_lfsr113* state, float mean, float stdde
  *
  * \return Log-normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 FQUALIFIERS
 double rocrand_log_normal_double(rocrand_state_lfsr113* state, double mean, double stddev)
 {
-    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
-    return exp(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_lfsr113> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
@@ -886,6 +926,9 @@ double2 rocrand_log_normal_double2(rocrand_state_lfsr113* state, double mean, do
  *
  * Generates and returns a log-normally distributed \p float value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -893,12 +936,26 @@ double2 rocrand_log_normal_double2(rocrand_state_lfsr113* state, double mean, do
  *
  * \return Log-normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float
     rocrand_log_normal(rocrand_state_threefry2x32_20* state, double mean, double stddev)
 {
-    float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x32_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
@@ -930,6 +987,9 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry2x32_20* state,
  *
  * Generates and returns a log-normally distributed \p double value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -937,12 +997,29 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry2x32_20* state,
  *
  * \return Log-normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double
     rocrand_log_normal_double(rocrand_state_threefry2x32_20* state, double mean, double stddev)
 {
-    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
-    return exp(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x32_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
@@ -977,6 +1054,9 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry2x32_20* st
  *
  * Generates and returns a log-normally distributed \p float value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -984,12 +1064,26 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry2x32_20* st
  *
  * \return Log-normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float
     rocrand_log_normal(rocrand_state_threefry2x64_20* state, double mean, double stddev)
 {
-    float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
@@ -1021,6 +1115,9 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry2x64_20* state,
  *
  * Generates and returns a log-normally distributed \p double value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -1028,12 +1125,29 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry2x64_20* state,
  *
  * \return Log-normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double
     rocrand_log_normal_double(rocrand_state_threefry2x64_20* state, double mean, double stddev)
 {
-    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
-    return exp(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
@@ -1068,6 +1182,9 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry2x64_20* st
  *
  * Generates and returns a log-normally distributed \p float value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -1075,12 +1192,26 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry2x64_20* st
  *
  * \return Log-normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float
     rocrand_log_normal(rocrand_state_threefry4x32_20* state, double mean, double stddev)
 {
-    float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
@@ -1112,6 +1243,9 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry4x32_20* state,
  *
  * Generates and returns a log-normally distributed \p double value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -1119,12 +1253,29 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry4x32_20* state,
  *
  * \return Log-normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double
     rocrand_log_normal_double(rocrand_state_threefry4x32_20* state, double mean, double stddev)
 {
-    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
-    return exp(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
@@ -1159,6 +1310,9 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry4x32_20* st
  *
  * Generates and returns a log-normally distributed \p float value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -1166,12 +1320,61 @@ FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry4x32_20* st
  *
  * \return Log-normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float
     rocrand_log_normal(rocrand_state_threefry4x64_20* state, double mean, double stddev)
 {
-    float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using Philox
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS float
+    rocrand_log_normal(rocrand_state_philox4x64_10* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
@@ -1198,11 +1401,39 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry4x64_20* state,
     return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
 }
 
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using Philox
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_philox4x64_10* state,
+                                       float                        mean,
+                                       float                        stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
 /**
  * \brief Returns a log-normally distributed \p double value.
  *
  * Generates and returns a log-normally distributed \p double value using ThreeFry
  * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -1210,28 +1441,555 @@ FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_threefry4x64_20* state,
  *
  * \return Log-normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double
     rocrand_log_normal_double(rocrand_state_threefry4x64_20* state, double mean, double stddev)
 {
-    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
-    return exp(mean + (stddev * r));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
 }
 
 /**
- * \brief Returns two log-normally distributed \p double values.
+ * \brief Returns a log-normally distributed \p double value.
  *
- * Generates and returns two log-normally distributed \p double values using Threefry
- * generator in \p state, and increments position of the generator by two.
+ * Generates and returns a log-normally distributed \p double value using Philox
+ * generator in \p state, and increments position of the generator by one.
  * The function uses the Box-Muller transform method to generate two normally distributed
- * values, transforms them to log-normally distributed values, and returns both.
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
  * \param stddev - Standard deviation of the related log-normal distribution
  *
- * \return Two log-normally distributed \p double values as \p double2
+ * \return Log-normally distributed \p double value
  */
-FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry4x64_20* state,
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS double
+    rocrand_log_normal_double(rocrand_state_philox4x64_10* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Threefry
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_threefry4x64_20* state,
+                                               double                         mean,
+                                               double                         stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Philox
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_philox4x64_10* state,
+                                               double                       mean,
+                                               double                       stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using PCG64
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_log_normal(rocrand_state_pcg64 * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_pcg64> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using PCG64
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_pcg64 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using PCG64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_log_normal_double(rocrand_state_pcg64 * state,
+                                             double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_pcg64> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using PCG64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_pcg64 * state,
+                                               double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_log_normal(rocrand_state_xoshiro256pp * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xoshiro256pp> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_xoshiro256pp * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_log_normal_double(rocrand_state_xoshiro256pp * state,
+                                             double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xoshiro256pp> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_xoshiro256pp * state,
+                                               double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using ChaCha20
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+FQUALIFIERS float
+    rocrand_log_normal(rocrand_state_chacha20* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_chacha20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+
+FQUALIFIERS float
+    rocrand_log_normal(rocrand_state_squares32* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_squares32>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using THREEFRY
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_chacha20* state,
+                                       float                          mean,
+                                       float                          stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using THREEFRY
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_log_normal2(rocrand_state_squares32* state,
+                                       float                          mean,
+                                       float                          stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using ChaCha20
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+FQUALIFIERS double
+    rocrand_log_normal_double(rocrand_state_chacha20* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_chacha20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+
+FQUALIFIERS double
+    rocrand_log_normal_double(rocrand_state_squares32* state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_squares32>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using ChaCha20
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_chacha20* state,
+                                               double                         mean,
+                                               double                         stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using SQUARES32
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_log_normal_double2(rocrand_state_squares32* state,
                                                double                         mean,
                                                double                         stddev)
 {
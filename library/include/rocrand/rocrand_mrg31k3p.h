@@ -36,6 +36,10 @@
 #define ROCRAND_MRG31K3P_NORM_DOUBLE (4.656612875245796923e-10) // 1 / ROCRAND_MRG31K3P_M1
 #define ROCRAND_MRG31K3P_UINT32_NORM \
     (2.000000001396983862) // UINT32_MAX / (ROCRAND_MRG31K3P_M1 - 1)
+// 53-bit mantissas of ROCRAND_MRG31K3P_NORM_DOUBLE (x 2^-83) and
+// ROCRAND_MRG31K3P_UINT32_NORM (x 2^-51), for integer output scaling
+#define ROCRAND_MRG31K3P_NORM_MANTISSA (0x10000000200000ULL)
+#define ROCRAND_MRG31K3P_UINT32_NORM_MANTISSA (0x10000000300000ULL)
 
 /** \rocrand_internal \addtogroup rocranddevice
  *
@@ -81,8 +85,7 @@ public:
     /// seed value \p seed, goes to \p subsequence -th subsequence,
     /// and skips \p offset random numbers.
     ///
-    /// New seed value should not be zero. If \p seed_value is equal
-    /// zero, value \p ROCRAND_MRG31K3P_DEFAULT_SEED is used instead.
+    /// Any seed value, including zero, is expanded to a valid state.
     ///
     /// A subsequence is 2^72 numbers long.
     FQUALIFIERS mrg31k3p_engine(const unsigned long long seed,
@@ -92,30 +95,46 @@ public:
         this->seed(seed, subsequence, offset);
     }
 
+    /// Initializes the internal state of the PRNG like the constructor
+    /// above, but cooperatively with all threads of the block: the
+    /// skip-ahead matrices are staged through \p shared_jump_matrices
+    /// (18 elements of block-shared memory) instead of being read from
+    /// device memory by every thread separately. All threads of the block
+    /// must reach this constructor; \p seed, \p subsequence, and \p offset
+    /// may differ between threads.
+    ///
+    /// A subsequence is 2^72 numbers long.
+    FQUALIFIERS mrg31k3p_engine(const unsigned long long seed,
+                                const unsigned long long subsequence,
+                                const unsigned long long offset,
+                                unsigned int*            shared_jump_matrices)
+    {
+        this->seed_state(seed);
+#if defined(__HIP_DEVICE_COMPILE__)
+    #ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+    #endif
+        this->jump_block(subsequence, d_mrg31k3p_A1P72, d_mrg31k3p_A2P72, shared_jump_matrices);
+        this->jump_block(offset, d_mrg31k3p_A1, d_mrg31k3p_A2, shared_jump_matrices);
+#else
+        (void)shared_jump_matrices;
+        this->restart(subsequence, offset);
+#endif
+    }
+
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
     /// and \p offset random numbers.
     ///
-    /// New seed value should not be zero. If \p seed_value is equal
-    /// zero, value \p ROCRAND_MRG31K3P_DEFAULT_SEED is used instead.
+    /// Any seed value, including zero, is expanded to a valid state.
     ///
     /// A subsequence is 2^72 numbers long.
     FQUALIFIERS void seed(unsigned long long       seed_value,
                           const unsigned long long subsequence,
                           const unsigned long long offset)
     {
-        if(seed_value == 0)
-        {
-            seed_value = ROCRAND_MRG31K3P_DEFAULT_SEED;
-        }
-        unsigned int x = static_cast<unsigned int>(seed_value ^ 0x55555555U);
-        unsigned int y = static_cast<unsigned int>((seed_value >> 32) ^ 0xAAAAAAAAU);
-        m_state.x1[0]  = mod_mul_m1(x, seed_value);
-        m_state.x1[1]  = mod_mul_m1(y, seed_value);
-        m_state.x1[2]  = mod_mul_m1(x, seed_value);
-        m_state.x2[0]  = mod_mul_m2(y, seed_value);
-        m_state.x2[1]  = mod_mul_m2(x, seed_value);
-        m_state.x2[2]  = mod_mul_m2(y, seed_value);
+        this->seed_state(seed_value);
         this->restart(subsequence, offset);
     }
 
@@ -186,6 +205,18 @@ public:
                + (m_state.x1[0] <= m_state.x2[0] ? ROCRAND_MRG31K3P_M1 : 0);
     }
 
+    FQUALIFIERS uint4 next4()
+    {
+        // The recurrence is sequential, but producing four outputs per
+        // call keeps the state in registers across the updates and lets
+        // callers consume the values as one vector
+        const unsigned int x = next();
+        const unsigned int y = next();
+        const unsigned int z = next();
+        const unsigned int w = next();
+        return uint4{x, y, z, w};
+    }
+
 protected:
     // Advances the internal state to skip \p offset numbers.
     FQUALIFIERS void discard_impl(unsigned long long offset)
@@ -198,7 +229,7 @@ protected:
     {
         int i = 0;
 
-        while(subsequence > 0)
+        while(subsequence > 0 && i < 9 * ROCRAND_MRG31K3P_JUMP_MATRICES_COMPILED)
         {
             if(subsequence & 1)
             {
@@ -220,7 +251,7 @@ protected:
     {
         int i = 0;
 
-        while(sequence > 0)
+        while(sequence > 0 && i < 9 * ROCRAND_MRG31K3P_JUMP_MATRICES_COMPILED)
         {
             if(sequence & 1)
             {
@@ -242,7 +273,7 @@ protected:
     {
         int i = 0;
 
-        while(offset > 0)
+        while(offset > 0 && i < 9 * ROCRAND_MRG31K3P_JUMP_MATRICES_COMPILED)
         {
             if(offset & 1)
             {
@@ -265,7 +296,68 @@ protected:
         discard_state(1);
     }
 
+#if defined(__HIP_DEVICE_COMPILE__)
+    // Cooperative version of the discard loops above: all threads of the
+    // block walk the bit planes of their own v in lockstep, and each
+    // plane's pair of 3x3 matrices is staged once into block-shared memory
+    // instead of being read from device memory by every thread.
+    FQUALIFIERS void jump_block(unsigned long long  v,
+                                const unsigned int* A1,
+                                const unsigned int* A2,
+                                unsigned int*       shared_jump_matrices)
+    {
+        const unsigned int flat_id
+            = (threadIdx.z * blockDim.y + threadIdx.y) * blockDim.x + threadIdx.x;
+        const unsigned int block_size = blockDim.x * blockDim.y * blockDim.z;
+
+        int i = 0;
+        // The or-reduction also separates the multiplications of the
+        // previous plane from overwriting the staged matrices below; i is
+        // uniform across the block, so bounding it first keeps the
+        // reduction reached by all threads
+        while(i < 9 * ROCRAND_MRG31K3P_JUMP_MATRICES_COMPILED && __syncthreads_or(v > 0))
+        {
+            for(unsigned int k = flat_id; k < 18; k += block_size)
+            {
+                shared_jump_matrices[k] = k < 9 ? A1[i + k] : A2[i + k - 9];
+            }
+            __syncthreads();
+
+            if(v & 1)
+            {
+                mod_mat_vec_m1(shared_jump_matrices, m_state.x1);
+                mod_mat_vec_m2(shared_jump_matrices + 9, m_state.x2);
+            }
+            v >>= 1;
+            i += 9;
+        }
+    }
+#endif
+
 private:
+    FQUALIFIERS void seed_state(unsigned long long seed_value)
+    {
+        // Expand the seed into six independent words with consecutive
+        // splitmix64 outputs; 1 + (word % (m - 1)) keeps every component
+        // inside [1, m - 1], so any seed (including zero) maps to a
+        // valid, well-distributed state without branching
+        unsigned long long x = seed_value;
+        unsigned long long z[6];
+        for(int i = 0; i < 6; i++)
+        {
+            z[i] = (x += 0x9E3779B97F4A7C15ULL);
+            z[i] = (z[i] ^ (z[i] >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z[i] = (z[i] ^ (z[i] >> 27)) * 0x94D049BB133111EBULL;
+            z[i] = z[i] ^ (z[i] >> 31);
+        }
+        m_state.x1[0] = 1 + static_cast<unsigned int>(z[0] % (ROCRAND_MRG31K3P_M1 - 1));
+        m_state.x1[1] = 1 + static_cast<unsigned int>(z[1] % (ROCRAND_MRG31K3P_M1 - 1));
+        m_state.x1[2] = 1 + static_cast<unsigned int>(z[2] % (ROCRAND_MRG31K3P_M1 - 1));
+        m_state.x2[0] = 1 + static_cast<unsigned int>(z[3] % (ROCRAND_MRG31K3P_M2 - 1));
+        m_state.x2[1] = 1 + static_cast<unsigned int>(z[4] % (ROCRAND_MRG31K3P_M2 - 1));
+        m_state.x2[2] = 1 + static_cast<unsigned int>(z[5] % (ROCRAND_MRG31K3P_M2 - 1));
+    }
+
     FQUALIFIERS void mod_mat_vec_m1(const unsigned int* A, unsigned int* s)
     {
         unsigned long long x[3] = {s[0], s[1], s[2]};
@@ -288,21 +380,11 @@ private:
         s[2] = mod_m2(mod_m2(A[6] * x[0]) + mod_m2(A[7] * x[1]) + mod_m2(A[8] * x[2]));
     }
 
-    FQUALIFIERS unsigned long long mod_mul_m1(unsigned int i, unsigned long long j)
-    {
-        return mod_m1(i * j);
-    }
-
     FQUALIFIERS unsigned long long mod_m1(unsigned long long p)
     {
         return p % ROCRAND_MRG31K3P_M1;
     }
 
-    FQUALIFIERS unsigned long long mod_mul_m2(unsigned int i, unsigned long long j)
-    {
-        return mod_m2(i * j);
-    }
-
     FQUALIFIERS unsigned long long mod_m2(unsigned long long p)
     {
         return p % ROCRAND_MRG31K3P_M2;
@@ -347,6 +429,36 @@ FQUALIFIERS void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_mrg31k3p(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initializes MRG31K3P states cooperatively for a whole block.
+ *
+ * Initializes the MRG31K3P generator \p state with the given
+ * \p seed, \p subsequence, and \p offset like \p rocrand_init, but shares
+ * the skip-ahead matrices between the threads of the block: each pair of
+ * 3x3 matrices is staged once into \p shared_jump_matrices and all threads
+ * multiply from the shared copy, instead of every thread streaming the
+ * matrices from device memory on its own.
+ *
+ * All threads of the block must call this function; \p seed, \p subsequence,
+ * and \p offset may differ between threads. \p shared_jump_matrices must
+ * point to block-shared (\p __shared__) memory with room for at least 18
+ * <tt>unsigned int</tt> values.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ * \param shared_jump_matrices - Pointer to block-shared staging memory
+ */
+FQUALIFIERS void rocrand_init_block(const unsigned long long seed,
+                                    const unsigned long long subsequence,
+                                    const unsigned long long offset,
+                                    rocrand_state_mrg31k3p*  state,
+                                    unsigned int*            shared_jump_matrices)
+{
+    *state = rocrand_state_mrg31k3p(seed, subsequence, offset, shared_jump_matrices);
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -362,7 +474,30 @@ FQUALIFIERS void rocrand_init(const unsigned long long seed,
 FQUALIFIERS unsigned int rocrand(rocrand_state_mrg31k3p* state)
 {
     // next() in [1, ROCRAND_MRG31K3P_M1]
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return rocrand_device::detail::mrg_scale_to_uint(state->next() - 1,
+                                                     ROCRAND_MRG31K3P_UINT32_NORM_MANTISSA,
+                                                     51);
+#else
     return static_cast<unsigned int>((state->next() - 1) * ROCRAND_MRG31K3P_UINT32_NORM);
+#endif
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using MRG31K3P generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS uint4 rocrand4(rocrand_state_mrg31k3p* state)
+{
+    return state->next4();
 }
 
 /**
@@ -41,6 +41,9 @@
 #define ROCRAND_MRG32K3A_A23N 1370589
 #define ROCRAND_MRG32K3A_NORM_DOUBLE (2.3283065498378288e-10) // 1/ROCRAND_MRG32K3A_M1
 #define ROCRAND_MRG32K3A_UINT_NORM (1.000000048661607) // (ROCRAND_MRG32K3A_POW32 - 1)/(ROCRAND_MRG32K3A_M1 - 1)
+// 53-bit mantissa shared by ROCRAND_MRG32K3A_NORM_DOUBLE (x 2^-84)
+// and ROCRAND_MRG32K3A_UINT_NORM (x 2^-52), for integer output scaling
+#define ROCRAND_MRG32K3A_NORM_MANTISSA (0x1000000D10000BULL)
 
 /** \rocrand_internal \addtogroup rocranddevice
  *
@@ -86,8 +89,7 @@ public:
     /// seed value \p seed, goes to \p subsequence -th subsequence,
     /// and skips \p offset random numbers.
     ///
-    /// New seed value should not be zero. If \p seed_value is equal
-    /// zero, value \p ROCRAND_MRG32K3A_DEFAULT_SEED is used instead.
+    /// Any seed value, including zero, is expanded to a valid state.
     ///
     /// A subsequence is 2^76 numbers long.
     FQUALIFIERS
@@ -98,12 +100,40 @@ public:
         this->seed(seed, subsequence, offset);
     }
 
+    /// Initializes the internal state of the PRNG like the constructor
+    /// above, but cooperatively with all threads of the block: the
+    /// skip-ahead matrices are staged through \p shared_jump_matrices
+    /// (18 elements of block-shared memory) instead of being read from
+    /// device memory by every thread separately. All threads of the block
+    /// must reach this constructor; \p seed, \p subsequence, and \p offset
+    /// may differ between threads.
+    ///
+    /// A subsequence is 2^76 numbers long.
+    FQUALIFIERS
+    mrg32k3a_engine(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset,
+                    unsigned long long * shared_jump_matrices)
+    {
+        this->seed_state(seed);
+        #if defined(__HIP_DEVICE_COMPILE__)
+        #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+        this->jump_block(subsequence, d_A1P76, d_A2P76, shared_jump_matrices);
+        this->jump_block(offset, d_A1, d_A2, shared_jump_matrices);
+        #else
+        (void)shared_jump_matrices;
+        this->restart(subsequence, offset);
+        #endif
+    }
+
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
     /// and \p offset random numbers.
     ///
-    /// New seed value should not be zero. If \p seed_value is equal
-    /// zero, value \p ROCRAND_MRG32K3A_DEFAULT_SEED is used instead.
+    /// Any seed value, including zero, is expanded to a valid state.
     ///
     /// A subsequence is 2^76 numbers long.
     FQUALIFIERS
@@ -111,18 +141,7 @@ public:
               const unsigned long long subsequence,
               const unsigned long long offset)
     {
-        if(seed_value == 0)
-        {
-            seed_value = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
-        unsigned int x = (unsigned int) seed_value ^ 0x55555555U;
-        unsigned int y = (unsigned int) ((seed_value >> 32) ^ 0xAAAAAAAAU);
-        m_state.g1[0] = mod_mul_m1(x, seed_value);
-        m_state.g1[1] = mod_mul_m1(y, seed_value);
-        m_state.g1[2] = mod_mul_m1(x, seed_value);
-        m_state.g2[0] = mod_mul_m2(y, seed_value);
-        m_state.g2[1] = mod_mul_m2(x, seed_value);
-        m_state.g2[2] = mod_mul_m2(y, seed_value);
+        this->seed_state(seed_value);
         this->restart(subsequence, offset);
     }
 
@@ -149,6 +168,53 @@ public:
         this->discard_sequence_impl(sequence);
     }
 
+    /// Advances the internal state to skip \p Offset numbers.
+    ///
+    /// Equivalent to <tt>discard(Offset)</tt>, but the skip distance is a
+    /// compile-time constant: the bit-plane loop over the precomputed
+    /// matrix powers is unrolled and folded, so only the matrices that
+    /// \p Offset actually needs are referenced. When \p Offset is a power
+    /// of two (e.g. a grid stride) this collapses to a single pair of
+    /// matrix-vector multiplications.
+    template<unsigned long long Offset>
+    FQUALIFIERS
+    void discard()
+    {
+        #if defined(__HIP_DEVICE_COMPILE__)
+        this->jump_constant<Offset>(d_A1, d_A2);
+        #else
+        this->jump_constant<Offset>(h_A1, h_A2);
+        #endif
+    }
+
+    /// Advances the internal state to skip \p Subsequence subsequences,
+    /// with the skip distance known at compile time like the \p discard
+    /// overload above. A subsequence is 2^76 numbers long.
+    template<unsigned long long Subsequence>
+    FQUALIFIERS
+    void discard_subsequence()
+    {
+        #if defined(__HIP_DEVICE_COMPILE__)
+        this->jump_constant<Subsequence>(d_A1P76, d_A2P76);
+        #else
+        this->jump_constant<Subsequence>(h_A1P76, h_A2P76);
+        #endif
+    }
+
+    /// Advances the internal state to skip \p Sequence sequences,
+    /// with the skip distance known at compile time like the \p discard
+    /// overload above. A sequence is 2^127 numbers long.
+    template<unsigned long long Sequence>
+    FQUALIFIERS
+    void discard_sequence()
+    {
+        #if defined(__HIP_DEVICE_COMPILE__)
+        this->jump_constant<Sequence>(d_A1P127, d_A2P127);
+        #else
+        this->jump_constant<Sequence>(h_A1P127, h_A2P127);
+        #endif
+    }
+
     FQUALIFIERS
     void restart(const unsigned long long subsequence,
                  const unsigned long long offset)
@@ -205,6 +271,19 @@ public:
         return (p1 - p2) + (p1 <= p2 ? ROCRAND_MRG32K3A_M1 : 0);
     }
 
+    FQUALIFIERS
+    uint4 next4()
+    {
+        // The recurrence is sequential, but producing four outputs per
+        // call keeps the state in registers across the updates and lets
+        // callers consume the values as one vector
+        const unsigned int x = next();
+        const unsigned int y = next();
+        const unsigned int z = next();
+        const unsigned int w = next();
+        return uint4{x, y, z, w};
+    }
+
 protected:
     // Advances the internal state to skip \p offset numbers.
     // DOES NOT CALCULATE NEW ULONGLONG
@@ -220,7 +299,7 @@ protected:
     {
         int i = 0;
 
-        while(subsequence > 0) {
+        while(subsequence > 0 && i < 9 * ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED) {
             if (subsequence & 1) {
                 #if defined(__HIP_DEVICE_COMPILE__)
                 mod_mat_vec_m1(d_A1P76 + i, m_state.g1);
@@ -241,7 +320,7 @@ protected:
     {
         int i = 0;
 
-        while(sequence > 0) {
+        while(sequence > 0 && i < 9 * ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED) {
             if (sequence & 1) {
                 #if defined(__HIP_DEVICE_COMPILE__)
                 mod_mat_vec_m1(d_A1P127 + i, m_state.g1);
@@ -263,7 +342,7 @@ protected:
     {
         int i = 0;
 
-        while(offset > 0) {
+        while(offset > 0 && i < 9 * ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED) {
             if (offset & 1) {
                 #if defined(__HIP_DEVICE_COMPILE__)
                 mod_mat_vec_m1(d_A1 + i, m_state.g1);
@@ -286,7 +365,97 @@ protected:
         discard_state(1);
     }
 
+    // Same as the discard loops above, but with v known at compile time.
+    // After unrolling, each bit-plane condition is a constant: planes with
+    // a zero bit disappear entirely, so only the matrices that V actually
+    // needs are referenced and no runtime loop state is kept.
+    template<unsigned long long V>
+    FQUALIFIERS
+    void jump_constant(const unsigned long long * A1,
+                       const unsigned long long * A2)
+    {
+        // With V known at compile time a skip that needs matrices beyond
+        // the compiled subset is diagnosed instead of silently truncated
+        static_assert(ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED >= 64
+                          || (V >> ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED) == 0,
+                      "The skip distance needs jump matrices beyond "
+                      "ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED");
+
+        #pragma unroll
+        for (unsigned int b = 0; b < ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED; b++)
+        {
+            if ((V >> b) & 1)
+            {
+                mod_mat_vec_m1(A1 + b * 9, m_state.g1);
+                mod_mat_vec_m2(A2 + b * 9, m_state.g2);
+            }
+        }
+    }
+
+    #if defined(__HIP_DEVICE_COMPILE__)
+    // Cooperative version of the discard loops above: all threads of the
+    // block walk the bit planes of their own v in lockstep, and each
+    // plane's pair of 3x3 matrices is staged once into block-shared memory
+    // instead of being read from device memory by every thread.
+    FQUALIFIERS
+    void jump_block(unsigned long long v,
+                    const unsigned long long * A1,
+                    const unsigned long long * A2,
+                    unsigned long long * shared_jump_matrices)
+    {
+        const unsigned int flat_id
+            = (threadIdx.z * blockDim.y + threadIdx.y) * blockDim.x + threadIdx.x;
+        const unsigned int block_size = blockDim.x * blockDim.y * blockDim.z;
+
+        int i = 0;
+        // The or-reduction also separates the multiplications of the
+        // previous plane from overwriting the staged matrices below; i is
+        // uniform across the block, so bounding it first keeps the
+        // reduction reached by all threads
+        while (i < 9 * ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED && __syncthreads_or(v > 0))
+        {
+            for (unsigned int k = flat_id; k < 18; k += block_size)
+            {
+                shared_jump_matrices[k] = k < 9 ? A1[i + k] : A2[i + k - 9];
+            }
+            __syncthreads();
+
+            if (v & 1)
+            {
+                mod_mat_vec_m1(shared_jump_matrices, m_state.g1);
+                mod_mat_vec_m2(shared_jump_matrices + 9, m_state.g2);
+            }
+            v >>= 1;
+            i += 9;
+        }
+    }
+    #endif
+
 private:
+    FQUALIFIERS
+    void seed_state(unsigned long long seed_value)
+    {
+        // Expand the seed into six independent words with consecutive
+        // splitmix64 outputs; 1 + (word % (m - 1)) keeps every component
+        // inside [1, m - 1], so any seed (including zero) maps to a
+        // valid, well-distributed state without branching
+        unsigned long long x = seed_value;
+        unsigned long long z[6];
+        for(int i = 0; i < 6; i++)
+        {
+            z[i] = (x += 0x9E3779B97F4A7C15ULL);
+            z[i] = (z[i] ^ (z[i] >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z[i] = (z[i] ^ (z[i] >> 27)) * 0x94D049BB133111EBULL;
+            z[i] = z[i] ^ (z[i] >> 31);
+        }
+        m_state.g1[0] = 1 + static_cast<unsigned int>(z[0] % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g1[1] = 1 + static_cast<unsigned int>(z[1] % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g1[2] = 1 + static_cast<unsigned int>(z[2] % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g2[0] = 1 + static_cast<unsigned int>(z[3] % (ROCRAND_MRG32K3A_M2 - 1));
+        m_state.g2[1] = 1 + static_cast<unsigned int>(z[4] % (ROCRAND_MRG32K3A_M2 - 1));
+        m_state.g2[2] = 1 + static_cast<unsigned int>(z[5] % (ROCRAND_MRG32K3A_M2 - 1));
+    }
+
     FQUALIFIERS
     void mod_mat_vec_m1(const unsigned long long * A,
                         unsigned int * s)
@@ -333,23 +502,6 @@ private:
         s[2] = x[2];
     }
 
-    FQUALIFIERS
-    unsigned long long mod_mul_m1(unsigned int i,
-                                  unsigned long long j)
-    {
-        long long hi, lo, temp1, temp2;
-
-        hi = i / 131072;
-        lo = i - (hi * 131072);
-        temp1 = mod_m1(hi * j) * 131072;
-        temp2 = mod_m1(lo * j);
-        lo = mod_m1(temp1 + temp2);
-
-        if (lo < 0)
-            lo += ROCRAND_MRG32K3A_M1;
-        return lo;
-    }
-
     FQUALIFIERS
     unsigned long long mod_m1(unsigned long long p)
     {
@@ -360,23 +512,6 @@ private:
         return p;
     }
 
-    FQUALIFIERS
-    unsigned long long mod_mul_m2(unsigned int i,
-                                  unsigned long long j)
-    {
-        long long hi, lo, temp1, temp2;
-
-        hi = i / 131072;
-        lo = i - (hi * 131072);
-        temp1 = mod_m2(hi * j) * 131072;
-        temp2 = mod_m2(lo * j);
-        lo = mod_m2(temp1 + temp2);
-
-        if (lo < 0)
-            lo += ROCRAND_MRG32K3A_M2;
-        return lo;
-    }
-
     FQUALIFIERS
     unsigned long long mod_m2(unsigned long long p)
     {
@@ -429,6 +564,37 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_mrg32k3a(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initializes MRG32K3A states cooperatively for a whole block.
+ *
+ * Initializes the MRG32K3A generator \p state with the given
+ * \p seed, \p subsequence, and \p offset like \p rocrand_init, but shares
+ * the skip-ahead matrices between the threads of the block: each pair of
+ * 3x3 matrices is staged once into \p shared_jump_matrices and all threads
+ * multiply from the shared copy, instead of every thread streaming the
+ * matrices from device memory on its own.
+ *
+ * All threads of the block must call this function; \p seed, \p subsequence,
+ * and \p offset may differ between threads. \p shared_jump_matrices must
+ * point to block-shared (\p __shared__) memory with room for at least 18
+ * <tt>unsigned long long</tt> values.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ * \param shared_jump_matrices - Pointer to block-shared staging memory
+ */
+FQUALIFIERS
+void rocrand_init_block(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        rocrand_state_mrg32k3a * state,
+                        unsigned long long * shared_jump_matrices)
+{
+    *state = rocrand_state_mrg32k3a(seed, subsequence, offset, shared_jump_matrices);
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -445,7 +611,31 @@ FQUALIFIERS
 unsigned int rocrand(rocrand_state_mrg32k3a * state)
 {
     // next() in [1, ROCRAND_MRG32K3A_M1]
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return rocrand_device::detail::mrg_scale_to_uint(state->next() - 1,
+                                                     ROCRAND_MRG32K3A_NORM_MANTISSA,
+                                                     52);
+#else
     return static_cast<unsigned int>((state->next() - 1) * ROCRAND_MRG32K3A_UINT_NORM);
+#endif
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using MRG32K3A generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_mrg32k3a * state)
+{
+    return state->next4();
 }
 
 /**
@@ -462,6 +652,27 @@ void skipahead(unsigned long long offset, rocrand_state_mrg32k3a * state)
     return state->discard(offset);
 }
 
+/**
+ * \brief Updates MRG32K3A state to skip ahead by a compile-time \p Offset.
+ *
+ * Updates the MRG32K3A state in \p state to skip ahead by \p Offset elements,
+ * like \p skipahead, but with the skip distance given as a template argument.
+ * The loop over the precomputed matrix powers is resolved at compile time,
+ * so only the matrices that \p Offset actually needs are referenced. Use this
+ * overload when the skip distance is a compile-time constant, for example a
+ * power-of-two grid stride.
+ *
+ * \tparam Offset - Number of elements to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Offset>
+FQUALIFIERS
+void skipahead(rocrand_state_mrg32k3a * state)
+{
+    return state->discard<Offset>();
+}
+
 /**
  * \brief Updates MRG32K3A state to skip ahead by \p subsequence subsequences.
  *
@@ -477,6 +688,25 @@ void skipahead_subsequence(unsigned long long subsequence, rocrand_state_mrg32k3
     return state->discard_subsequence(subsequence);
 }
 
+/**
+ * \brief Updates MRG32K3A state to skip ahead by a compile-time \p Subsequence.
+ *
+ * Updates the MRG32K3A state in \p state to skip ahead by \p Subsequence
+ * subsequences, like \p skipahead_subsequence, but with the skip distance
+ * resolved at compile time as in the \p skipahead overload above.
+ * Each subsequence is 2^76 numbers long.
+ *
+ * \tparam Subsequence - Number of subsequences to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Subsequence>
+FQUALIFIERS
+void skipahead_subsequence(rocrand_state_mrg32k3a * state)
+{
+    return state->discard_subsequence<Subsequence>();
+}
+
 /**
  * \brief Updates MRG32K3A state to skip ahead by \p sequence sequences.
  *
@@ -492,6 +722,25 @@ void skipahead_sequence(unsigned long long sequence, rocrand_state_mrg32k3a * st
     return state->discard_sequence(sequence);
 }
 
+/**
+ * \brief Updates MRG32K3A state to skip ahead by a compile-time \p Sequence.
+ *
+ * Updates the MRG32K3A state in \p state to skip ahead by \p Sequence
+ * sequences, like \p skipahead_sequence, but with the skip distance resolved
+ * at compile time as in the \p skipahead overload above.
+ * Each sequence is 2^127 numbers long.
+ *
+ * \tparam Sequence - Number of sequences to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Sequence>
+FQUALIFIERS
+void skipahead_sequence(rocrand_state_mrg32k3a * state)
+{
+    return state->discard_sequence<Sequence>();
+}
+
 #endif // ROCRAND_MRG32K3A_H_
 
 /** @} */ // end of group rocranddevice
@@ -213,6 +213,25 @@ public:
 #endif
     }
 
+    FQUALIFIERS
+    void copy_state(const mtgp32_engine * m_engine)
+    {
+#if defined(__HIP_DEVICE_COMPILE__) || defined(USE_HIP_CPU)
+        const unsigned int thread_id = threadIdx.x;
+        for(int i = thread_id; i < MTGP_STATE; i += blockDim.x)
+            m_state.status[i] = m_engine->m_state.status[i];
+
+        if (thread_id == 0)
+        {
+            m_state.offset = m_engine->m_state.offset;
+            m_state.id = m_engine->m_state.id;
+        }
+        __syncthreads();
+#else
+        this->m_state = m_engine->m_state;
+#endif
+    }
+
     FQUALIFIERS
     void set_params(mtgp32_params * params)
     {
@@ -259,6 +278,33 @@ public:
 #endif
     }
 
+    /// Advances the internal state by \p n positions without producing
+    /// output. Must be called by all threads of the block; \p n must not
+    /// be greater than the block size.
+    FQUALIFIERS
+    void discard(unsigned int n)
+    {
+#if defined(__HIP_DEVICE_COMPILE__) || defined(USE_HIP_CPU)
+        unsigned int t   = threadIdx.x;
+        int pos = pos_tbl;
+        unsigned int r;
+
+        if (t < n)
+        {
+            r = para_rec(m_state.status[(t + m_state.offset) & MTGP_MASK],
+                         m_state.status[(t + m_state.offset + 1) & MTGP_MASK],
+                         m_state.status[(t + m_state.offset + pos) & MTGP_MASK]);
+            m_state.status[(t + m_state.offset + MTGP_N) & MTGP_MASK] = r;
+        }
+        __syncthreads();
+        if (t == 0)
+            m_state.offset = (m_state.offset + n) & MTGP_MASK;
+        __syncthreads();
+#else
+        (void) n;
+#endif
+    }
+
     FQUALIFIERS
     unsigned int next_single()
     {
@@ -541,6 +587,45 @@ void rocrand_mtgp32_block_copy(rocrand_state_mtgp32 * src, rocrand_state_mtgp32
     dest->copy(src);
 }
 
+/**
+ * \brief Copies the evolving part of a MTGP32 state using block of threads
+ *
+ * Copies only the recurrence state of a MTGP32 state \p src to \p dest
+ * using a block of threads efficiently; the constant parameter tables are
+ * not copied. This is the hand-off half of the persistent-kernel pattern:
+ * the generator is loaded into shared memory once with
+ * \p rocrand_mtgp32_block_copy, stays resident there across the iterations
+ * of a device-side loop, and only the recurrence state is written back when
+ * the kernel ends. The copy cost is then paid once per kernel instead of
+ * once per iteration. Example usage would be:
+ *
+ * \code
+ * __global__
+ * void solver_kernel(hiprandStateMtgp32_t * states, unsigned int iterations, ...)
+ * {
+ *      __shared__ GeneratorState state;
+ *      rocrand_mtgp32_block_copy(&states[blockIdx.x], &state);
+ *
+ *      for(unsigned int iteration = 0; iteration < iterations; iteration++)
+ *      {
+ *          // Sample with rocrand(&state) and run an iteration that
+ *          // previously was a separate kernel launch
+ *      }
+ *
+ *      rocrand_mtgp32_state_copy(&state, &states[blockIdx.x]);
+ * }
+ * \endcode
+ *
+ * \param src - Pointer to a state to copy from
+ * \param dest - Pointer to a state to copy to
+ *
+ */
+FQUALIFIERS
+void rocrand_mtgp32_state_copy(rocrand_state_mtgp32 * src, rocrand_state_mtgp32 * dest)
+{
+    dest->copy_state(src);
+}
+
 /**
  * \brief Changes parameters of a MTGP32 state.
  *
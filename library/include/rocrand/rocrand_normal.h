@@ -32,23 +32,30 @@
 
 #include <math.h>
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_uniform.h"
 
+#include <hip/hip_bfloat16.h>
+
 namespace rocrand_device {
 namespace detail {
 
@@ -142,6 +149,62 @@ __half2 box_muller_half(unsigned short x, unsigned short y)
     #endif
 }
 
+// Generates two pairs of normally distributed halves from two engine
+// words, keeping all arithmetic in packed __half2 operations where
+// supported so the transform runs at packed-math rate.
+FQUALIFIERS
+void box_muller_half4(unsigned int x, unsigned int y, __half2& r1, __half2& r2)
+{
+    #if defined(ROCRAND_HALF_MATH_SUPPORTED)
+    const __half2 u = __half2 {
+        __float2half(ROCRAND_2POW16_INV + (static_cast<unsigned short>(x) * ROCRAND_2POW16_INV)),
+        __float2half(ROCRAND_2POW16_INV + (static_cast<unsigned short>(x >> 16) * ROCRAND_2POW16_INV))
+    };
+    const __half2 v = __half2 {
+        __float2half(ROCRAND_2POW16_INV_2PI + (static_cast<unsigned short>(y) * ROCRAND_2POW16_INV_2PI)),
+        __float2half(ROCRAND_2POW16_INV_2PI + (static_cast<unsigned short>(y >> 16) * ROCRAND_2POW16_INV_2PI))
+    };
+    const __half2 minus_two = __half2 {
+        __float2half(-2.0f),
+        __float2half(-2.0f)
+    };
+    const __half2 s = h2sqrt(__hmul2(minus_two, h2log(u)));
+    const __half2 sn = __hmul2(h2sin(v), s);
+    const __half2 cs = __hmul2(h2cos(v), s);
+    r1 = __half2 { __low2half(sn), __low2half(cs) };
+    r2 = __half2 { __high2half(sn), __high2half(cs) };
+    #else
+    r1 = box_muller_half(
+        static_cast<unsigned short>(x),
+        static_cast<unsigned short>(y)
+    );
+    r2 = box_muller_half(
+        static_cast<unsigned short>(x >> 16),
+        static_cast<unsigned short>(y >> 16)
+    );
+    #endif
+}
+
+// bfloat16 has no device math functions, so the transform runs entirely
+// in float and the results are converted to bfloat16 at the final write
+FQUALIFIERS
+float2 box_muller_bf16(unsigned short x, unsigned short y)
+{
+    float2 r;
+    float u = ROCRAND_2POW16_INV + (x * ROCRAND_2POW16_INV);
+    float v = ROCRAND_2POW16_INV_2PI + (y * ROCRAND_2POW16_INV_2PI);
+    float s = sqrtf(-2.0f * logf(u));
+    #ifdef __HIP_DEVICE_COMPILE__
+        __sincosf(v, &r.x, &r.y);
+        r.x *= s;
+        r.y *= s;
+    #else
+        r.x = sinf(v) * s;
+        r.y = cosf(v) * s;
+    #endif
+    return r;
+}
+
 template<typename state_type>
 FQUALIFIERS float2 mrg_box_muller(unsigned int x, unsigned int y)
 {
@@ -335,6 +398,60 @@ FQUALIFIERS __half2 normal_distribution_half2(unsigned long long v)
                                                      static_cast<unsigned short>(v >> 32));
 }
 
+FQUALIFIERS
+void normal_distribution_half4(unsigned int x, unsigned int y, __half2& r1, __half2& r2)
+{
+    ::rocrand_device::detail::box_muller_half4(x, y, r1, r2);
+}
+
+FQUALIFIERS
+void normal_distribution_half4(unsigned long long v, __half2& r1, __half2& r2)
+{
+    ::rocrand_device::detail::box_muller_half4(
+        static_cast<unsigned int>(v),
+        static_cast<unsigned int>(v >> 32),
+        r1, r2
+    );
+}
+
+FQUALIFIERS
+float2 normal_distribution_bf16_2(unsigned int v)
+{
+    return ::rocrand_device::detail::box_muller_bf16(
+        static_cast<unsigned short>(v),
+        static_cast<unsigned short>(v >> 16)
+    );
+}
+
+FQUALIFIERS float2 normal_distribution_bf16_2(unsigned long long v)
+{
+    return ::rocrand_device::detail::box_muller_bf16(static_cast<unsigned short>(v),
+                                                     static_cast<unsigned short>(v >> 32));
+}
+
+FQUALIFIERS
+void normal_distribution_bf16_4(unsigned int x, unsigned int y, float2& r1, float2& r2)
+{
+    r1 = ::rocrand_device::detail::box_muller_bf16(
+        static_cast<unsigned short>(x),
+        static_cast<unsigned short>(y)
+    );
+    r2 = ::rocrand_device::detail::box_muller_bf16(
+        static_cast<unsigned short>(x >> 16),
+        static_cast<unsigned short>(y >> 16)
+    );
+}
+
+FQUALIFIERS
+void normal_distribution_bf16_4(unsigned long long v, float2& r1, float2& r2)
+{
+    ::rocrand_device::detail::normal_distribution_bf16_4(
+        static_cast<unsigned int>(v),
+        static_cast<unsigned int>(v >> 32),
+        r1, r2
+    );
+}
+
 template<typename state_type>
 FQUALIFIERS float2 mrg_normal_distribution2(unsigned int v1, unsigned int v2)
 {
@@ -357,6 +474,16 @@ FQUALIFIERS __half2 mrg_normal_distribution_half2(unsigned int v)
     );
 }
 
+template<typename state_type>
+FQUALIFIERS float2 mrg_normal_distribution_bf16_2(unsigned int v)
+{
+    v = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(v);
+    return ::rocrand_device::detail::box_muller_bf16(
+        static_cast<unsigned short>(v),
+        static_cast<unsigned short>(v >> 16)
+    );
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -1050,16 +1177,32 @@ double rocrand_normal_double(rocrand_state_scrambled_sobol64* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 FQUALIFIERS
 float rocrand_normal(rocrand_state_lfsr113* state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_lfsr113> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
@@ -1091,16 +1234,35 @@ float2 rocrand_normal2(rocrand_state_lfsr113* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 FQUALIFIERS
 double rocrand_normal_double(rocrand_state_lfsr113* state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_lfsr113> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    bm_helper::save_double(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_LFSR113_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
@@ -1135,15 +1297,29 @@ double2 rocrand_normal_double2(rocrand_state_lfsr113* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float rocrand_normal(rocrand_state_threefry2x32_20* state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x32_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand2(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
@@ -1171,15 +1347,33 @@ FQUALIFIERS float2 rocrand_normal2(rocrand_state_threefry2x32_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double rocrand_normal_double(rocrand_state_threefry2x32_20* state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x32_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand2(state);
+    auto state2 = rocrand2(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1.x, state1.y, state2.x, state2.y});
+    bm_helper::save_double(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
@@ -1211,15 +1405,29 @@ FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_threefry2x32_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float rocrand_normal(rocrand_state_threefry2x64_20* state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand2(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
@@ -1247,15 +1455,29 @@ FQUALIFIERS float2 rocrand_normal2(rocrand_state_threefry2x64_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double rocrand_normal_double(rocrand_state_threefry2x64_20* state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand2(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
@@ -1283,15 +1505,32 @@ FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_threefry2x64_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float rocrand_normal(rocrand_state_threefry4x32_20* state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
@@ -1322,15 +1561,29 @@ FQUALIFIERS float2 rocrand_normal2(rocrand_state_threefry4x32_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS double rocrand_normal_double(rocrand_state_threefry4x32_20* state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
 }
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
@@ -1358,16 +1611,66 @@ FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_threefry4x32_20* state)
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
 FQUALIFIERS float rocrand_normal(rocrand_state_threefry4x64_20* state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
 }
 
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using Philox
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_normal(rocrand_state_philox4x64_10* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
 /**
  * \brief Returns two normally distributed \p float values.
  *
@@ -1391,42 +1694,526 @@ FQUALIFIERS float2 rocrand_normal2(rocrand_state_threefry4x64_20* state)
 }
 
 /**
- * \brief Returns a normally distributed \p double value.
+ * \brief Returns two normally distributed \p float values.
  *
- * Generates and returns a normally distributed \p double value using ThreeFry
- * generator in \p state, and increments position of the generator by one.
+ * Generates and returns two normally distributed \p float values using Philox
+ * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
  *
  * \param state - Pointer to a state to use
  *
- * \return Normally distributed \p double value
+ * \return Two normally distributed \p float value as \p float2
  */
-FQUALIFIERS double rocrand_normal_double(rocrand_state_threefry4x64_20* state)
+FQUALIFIERS float2 rocrand_normal2(rocrand_state_philox4x64_10* state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
 }
 
 /**
- * \brief Returns two normally distributed \p double values.
+ * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns two normally distributed \p double values using ThreeFry
- * generator in \p state, and increments position of the generator by two.
+ * Generates and returns a normally distributed \p double value using ThreeFry
+ * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
- * The function uses the Box-Muller transform method to generate two normally
- * distributed values, and returns both of them.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p double value as \p double2
+ * \return Normally distributed \p double value
  */
-FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_threefry4x64_20* state)
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_normal_double(rocrand_state_threefry4x64_20* state)
 {
-    auto state1 = rocrand(state);
-    auto state2 = rocrand(state);
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20>
+        bm_helper;
 
-    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using Philox
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_normal_double(rocrand_state_philox4x64_10* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using ThreeFry
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_threefry4x64_20* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Philox
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_philox4x64_10* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using PCG64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_normal(rocrand_state_pcg64 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_pcg64> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using PCG64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_normal2(rocrand_state_pcg64 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using PCG64
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_normal_double(rocrand_state_pcg64 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_pcg64> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using PCG64
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_pcg64 * state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_normal(rocrand_state_xoshiro256pp * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xoshiro256pp> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_normal2(rocrand_state_xoshiro256pp * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_normal_double(rocrand_state_xoshiro256pp * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xoshiro256pp> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using XOSHIRO256++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_xoshiro256pp * state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using ChaCha20
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+FQUALIFIERS float rocrand_normal(rocrand_state_chacha20* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_chacha20>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+
+FQUALIFIERS float rocrand_normal(rocrand_state_squares32* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_squares32>
+        bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using ChaCha20
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_normal2(rocrand_state_chacha20* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using SQUARES32
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS float2 rocrand_normal2(rocrand_state_squares32* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using ChaCha20
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+FQUALIFIERS double rocrand_normal_double(rocrand_state_chacha20* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_chacha20>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+
+FQUALIFIERS double rocrand_normal_double(rocrand_state_squares32* state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_squares32>
+        bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using ChaCha20
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_chacha20* state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using SQUARES32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS double2 rocrand_normal_double2(rocrand_state_squares32* state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
 }
 
 /** @} */ // end of group rocranddevice
@@ -0,0 +1,330 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_PCG64_H_
+#define ROCRAND_PCG64_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand/rocrand_common.h"
+
+// PCG64 (XSL-RR variant)
+//
+// O'Neill, M. E.
+// PCG: A Family of Simple Fast Space-Efficient Statistically Good Algorithms
+// for Random Number Generation, 2014
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_PCG64_DEFAULT_SEED
+ * \brief Default seed for PCG64 PRNG.
+ */
+#define ROCRAND_PCG64_DEFAULT_SEED 0xCAFEF00DD15EA5E5ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+
+class pcg64_engine
+{
+public:
+    struct pcg64_state
+    {
+        // 128-bit LCG state in two 64-bit halves
+        unsigned long long state_hi;
+        unsigned long long state_lo;
+
+        #ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+    };
+
+    FQUALIFIERS
+    pcg64_engine() : pcg64_engine(ROCRAND_PCG64_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    pcg64_engine(const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    void seed(const unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        // Standard PCG seeding: start from the increment, mix the
+        // (zero-extended) seed into the state, and advance once
+        m_state.state_hi = increment_hi;
+        m_state.state_lo = increment_lo;
+        add_128(m_state.state_hi, m_state.state_lo, 0ULL, seed_value);
+        step();
+
+        discard_subsequence(subsequence);
+        discard(offset);
+
+        #ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        discard_impl(0ULL, offset);
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        // Discard n * 2^64 samples
+        discard_impl(subsequence, 0ULL);
+    }
+
+    FQUALIFIERS
+    unsigned long long operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned long long next()
+    {
+        step();
+        // XSL-RR output function: xor-fold the halves and rotate by the
+        // top 6 bits of the state
+        const unsigned int rot = static_cast<unsigned int>(m_state.state_hi >> 58);
+        const unsigned long long x = m_state.state_hi ^ m_state.state_lo;
+        return (x >> rot) | (x << ((64u - rot) & 63u));
+    }
+
+protected:
+    // Advances the state by \p delta_hi * 2^64 + \p delta_lo steps in
+    // O(log n) time using F. Brown's LCG jump algorithm: the multiplier
+    // and increment of the n-step transition are accumulated from the
+    // binary digits of n.
+    //
+    // Brown, F. B.
+    // Random Number Generation with Arbitrary Strides, 1994
+    FQUALIFIERS
+    void discard_impl(unsigned long long delta_hi, unsigned long long delta_lo)
+    {
+        unsigned long long acc_mult_hi = 0ULL;
+        unsigned long long acc_mult_lo = 1ULL;
+        unsigned long long acc_plus_hi = 0ULL;
+        unsigned long long acc_plus_lo = 0ULL;
+        unsigned long long cur_mult_hi = multiplier_hi;
+        unsigned long long cur_mult_lo = multiplier_lo;
+        unsigned long long cur_plus_hi = increment_hi;
+        unsigned long long cur_plus_lo = increment_lo;
+        while(delta_hi > 0 || delta_lo > 0)
+        {
+            if(delta_lo & 1)
+            {
+                mul_128(acc_mult_hi, acc_mult_lo, cur_mult_hi, cur_mult_lo);
+                mul_128(acc_plus_hi, acc_plus_lo, cur_mult_hi, cur_mult_lo);
+                add_128(acc_plus_hi, acc_plus_lo, cur_plus_hi, cur_plus_lo);
+            }
+            // cur_plus = (cur_mult + 1) * cur_plus; cur_mult = cur_mult^2
+            unsigned long long mult1_hi = cur_mult_hi;
+            unsigned long long mult1_lo = cur_mult_lo;
+            add_128(mult1_hi, mult1_lo, 0ULL, 1ULL);
+            mul_128(cur_plus_hi, cur_plus_lo, mult1_hi, mult1_lo);
+            mul_128(cur_mult_hi, cur_mult_lo, cur_mult_hi, cur_mult_lo);
+            delta_lo = (delta_lo >> 1) | (delta_hi << 63);
+            delta_hi >>= 1;
+        }
+        // state = acc_mult * state + acc_plus
+        mul_128(m_state.state_hi, m_state.state_lo, acc_mult_hi, acc_mult_lo);
+        add_128(m_state.state_hi, m_state.state_lo, acc_plus_hi, acc_plus_lo);
+    }
+
+    // state = state * multiplier + increment (mod 2^128)
+    FQUALIFIERS
+    void step()
+    {
+        mul_128(m_state.state_hi, m_state.state_lo, multiplier_hi, multiplier_lo);
+        add_128(m_state.state_hi, m_state.state_lo, increment_hi, increment_lo);
+    }
+
+    // (hi, lo) += (bhi, blo) (mod 2^128)
+    FQUALIFIERS
+    static void add_128(unsigned long long& hi, unsigned long long& lo,
+                        const unsigned long long bhi, const unsigned long long blo)
+    {
+        lo += blo;
+        hi += bhi + (lo < blo ? 1ULL : 0ULL);
+    }
+
+    // (hi, lo) *= (bhi, blo) (mod 2^128)
+    FQUALIFIERS
+    static void mul_128(unsigned long long& hi, unsigned long long& lo,
+                        const unsigned long long bhi, const unsigned long long blo)
+    {
+        const unsigned long long ahi = hi;
+        const unsigned long long alo = lo;
+        hi = ahi * blo + alo * bhi + mul_hi_64(alo, blo);
+        lo = alo * blo;
+    }
+
+    // High 64 bits of the full 128-bit product of two 64-bit values
+    FQUALIFIERS
+    static unsigned long long mul_hi_64(const unsigned long long a, const unsigned long long b)
+    {
+        #ifdef __HIP_DEVICE_COMPILE__
+        return __umul64hi(a, b);
+        #else
+        const unsigned long long a_lo = a & 0xFFFFFFFFULL;
+        const unsigned long long a_hi = a >> 32;
+        const unsigned long long b_lo = b & 0xFFFFFFFFULL;
+        const unsigned long long b_hi = b >> 32;
+        const unsigned long long t = a_hi * b_lo + ((a_lo * b_lo) >> 32);
+        const unsigned long long u = a_lo * b_hi + (t & 0xFFFFFFFFULL);
+        return a_hi * b_hi + (t >> 32) + (u >> 32);
+        #endif
+    }
+
+    // 128-bit constants of the PCG64 (XSL-RR) linear congruential step
+    static constexpr unsigned long long multiplier_hi = 2549297995355413924ULL;
+    static constexpr unsigned long long multiplier_lo = 4865540595714422341ULL;
+    static constexpr unsigned long long increment_hi = 6364136223846793005ULL;
+    static constexpr unsigned long long increment_lo = 1442695040888963407ULL;
+
+    // State
+    pcg64_state m_state;
+
+    #ifndef ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<pcg64_engine>;
+    #endif
+
+}; // pcg64_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::pcg64_engine rocrand_state_pcg64;
+/// \endcond
+
+/**
+ * \brief Initializes PCG64 state.
+ *
+ * Initializes the PCG64 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_pcg64 * state)
+{
+    *state = rocrand_state_pcg64(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using PCG64 generator in \p state.
+ * State is incremented by one position.
+ *
+ * PCG64 has a period of 2 ^ 128 numbers.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+FQUALIFIERS
+unsigned long long rocrand(rocrand_state_pcg64 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates PCG64 state to skip ahead by \p offset elements.
+ *
+ * Updates the PCG64 state in \p state to skip ahead by \p offset elements.
+ * The jump costs O(log offset) multiplications, independent of the distance.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_pcg64 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates PCG64 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the PCG64 state in \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_pcg64 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_PCG64_H_
@@ -90,10 +90,11 @@ unsigned int mulhilo32(unsigned int x, unsigned int y, unsigned int& z)
 
 } // end detail namespace
 
-class philox4x32_10_engine
+template<unsigned int Nrounds>
+class philox4x32_engine
 {
 public:
-    struct philox4x32_10_state
+    struct philox4x32_state
     {
         uint4 counter;
         uint4 result;
@@ -114,7 +115,7 @@ public:
     };
 
     FQUALIFIERS
-    philox4x32_10_engine()
+    philox4x32_engine()
     {
         this->seed(ROCRAND_PHILOX4x32_DEFAULT_SEED, 0, 0);
     }
@@ -125,9 +126,9 @@ public:
     ///
     /// A subsequence consists of 2 ^ 66 random numbers.
     FQUALIFIERS
-    philox4x32_10_engine(const unsigned long long seed,
-                         const unsigned long long subsequence,
-                         const unsigned long long offset)
+    philox4x32_engine(const unsigned long long seed,
+                      const unsigned long long subsequence,
+                      const unsigned long long offset)
     {
         this->seed(seed, subsequence, offset);
     }
@@ -152,7 +153,7 @@ public:
     void discard(unsigned long long offset)
     {
         this->discard_impl(offset);
-        this->m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        this->m_state.result = this->philox_rounds(m_state.counter, m_state.key);
     }
 
     /// Advances the internal state to skip \p subsequence subsequences,
@@ -163,7 +164,7 @@ public:
     void discard_subsequence(unsigned long long subsequence)
     {
         this->discard_subsequence_impl(subsequence);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->philox_rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -179,7 +180,7 @@ public:
         #endif
         this->discard_subsequence_impl(subsequence);
         this->discard_impl(offset);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->philox_rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -201,7 +202,7 @@ public:
         {
             m_state.substate = 0;
             this->discard_state();
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            m_state.result = this->philox_rounds(m_state.counter, m_state.key);
         }
         return ret;
     }
@@ -211,7 +212,7 @@ public:
     {
         uint4 ret = m_state.result;
         this->discard_state();
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->philox_rounds(m_state.counter, m_state.key);
         return this->interleave(ret, m_state.result);
     }
 
@@ -293,20 +294,23 @@ protected:
         __builtin_unreachable();
     }
 
-    // 10 Philox4x32 rounds
+    // Nrounds Philox4x32 rounds
     FQUALIFIERS
-    uint4 ten_rounds(uint4 counter, uint2 key)
+    uint4 philox_rounds(uint4 counter, uint2 key)
     {
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 1
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 2
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 3
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 4
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 5
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 6
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 7
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 8
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 9
-        return this->single_round(counter, key);                        // 10
+        static_assert(Nrounds >= 1, "at least one round required");
+
+        // Nrounds is a compile-time constant; unrolling yields the same
+        // straight-line round sequence as the hand-written version
+        #if defined(__HIP_DEVICE_COMPILE__)
+        #pragma unroll
+        #endif
+        for(unsigned int round_idx = 0; round_idx < Nrounds - 1; round_idx++)
+        {
+            counter = this->single_round(counter, key);
+            key     = this->bumpkey(key);
+        }
+        return this->single_round(counter, key);
     }
 
 private:
@@ -337,13 +341,21 @@ private:
 
 protected:
     // State
-    philox4x32_10_state m_state;
+    philox4x32_state m_state;
 
     #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
-    friend struct detail::engine_boxmuller_helper<philox4x32_10_engine>;
+    friend struct detail::engine_boxmuller_helper<philox4x32_engine>;
     #endif
 
-}; // philox4x32_10_engine class
+}; // philox4x32_engine class
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+/// The standard 10-round Philox4x32 engine. Philox4x32-7 passes
+/// BigCrush as well; workloads that can trade statistical margin for
+/// throughput may instantiate \p philox4x32_engine with fewer rounds.
+typedef philox4x32_engine<10> philox4x32_10_engine;
+typedef philox4x32_engine<7>  philox4x32_7_engine;
+/// \endcond
 
 } // end namespace rocrand_device
 
@@ -32,29 +32,47 @@
 
 #include <math.h>
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
+#include "rocrand/rocrand_discrete.h"
 #include "rocrand/rocrand_normal.h"
 #include "rocrand/rocrand_uniform.h"
 
 namespace rocrand_device {
 namespace detail {
 
-constexpr double lambda_threshold_small = 64.0;
-constexpr double lambda_threshold_huge  = 4000.0;
+// Crossover lambdas between the generation methods below. The defaults
+// are compromises across architectures; benchmark_rocrand_poisson
+// measures the real per-method throughput on the executing device, and
+// an application sitting near a crossover can compile with the measured
+// values by defining these macros.
+#ifndef ROCRAND_LAMBDA_THRESHOLD_SMALL
+    #define ROCRAND_LAMBDA_THRESHOLD_SMALL 64.0
+#endif
+#ifndef ROCRAND_LAMBDA_THRESHOLD_HUGE
+    #define ROCRAND_LAMBDA_THRESHOLD_HUGE 4000.0
+#endif
+
+constexpr double lambda_threshold_small = ROCRAND_LAMBDA_THRESHOLD_SMALL;
+constexpr double lambda_threshold_huge  = ROCRAND_LAMBDA_THRESHOLD_HUGE;
 
 template<class State, typename Result_Type = unsigned int>
 FQUALIFIERS Result_Type poisson_distribution_small(State& state, double lambda)
@@ -149,6 +167,23 @@ FQUALIFIERS Result_Type poisson_distribution_huge(State& state, double lambda)
     return static_cast<Result_Type>(round(sqrt(lambda) * n + lambda));
 }
 
+// Batched normal-approximation path for Philox. Box-Muller produces two
+// doubles per call and each call consumes one uint4 engine draw, so four
+// samples use both outputs of two draws instead of discarding half of
+// four
+FQUALIFIERS
+uint4 poisson_distribution_huge4(rocrand_state_philox4x32_10 * state, double lambda)
+{
+    const double sqrt_lambda = sqrt(lambda);
+    const double2 n1 = rocrand_normal_double2(state);
+    const double2 n2 = rocrand_normal_double2(state);
+    return uint4{
+        static_cast<unsigned int>(round(sqrt_lambda * n1.x + lambda)),
+        static_cast<unsigned int>(round(sqrt_lambda * n1.y + lambda)),
+        static_cast<unsigned int>(round(sqrt_lambda * n2.x + lambda)),
+        static_cast<unsigned int>(round(sqrt_lambda * n2.y + lambda))};
+}
+
 template<class State, typename Result_Type = unsigned int>
 FQUALIFIERS Result_Type poisson_distribution(State& state, double lambda)
 {
@@ -253,6 +288,13 @@ unsigned int rocrand_poisson(rocrand_state_philox4x32_10 * state, double lambda)
 FQUALIFIERS
 uint4 rocrand_poisson4(rocrand_state_philox4x32_10 * state, double lambda)
 {
+    // The normal approximation consumes a fixed two draws for four
+    // samples, so it is batched explicitly; the other methods consume a
+    // variable amount of state per sample and cannot share draws
+    if(lambda > rocrand_device::detail::lambda_threshold_huge)
+    {
+        return rocrand_device::detail::poisson_distribution_huge4(state, lambda);
+    }
     return uint4{
         rocrand_device::detail::poisson_distribution<rocrand_state_philox4x32_10*, unsigned int>(
             state,
@@ -506,6 +548,221 @@ FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_threefry4x64_20* state, d
     return rocrand_device::detail::poisson_distribution_inv(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Philox generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_philox4x64_10* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using PCG64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using PCG64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_pcg64 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using XOSHIRO256++ generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using XOSHIRO256++ generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_xoshiro256pp * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using ChaCha20 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using ChaCha20 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_chacha20* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SQUARES32 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SQUARES32 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_poisson(rocrand_state_squares32* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns the table size needed by \p rocrand_poisson_table_init.
+ *
+ * Returns the number of <tt>double</tt> values that a CDF table built with
+ * \p rocrand_poisson_table_init for \p lambda may need at most. It matches
+ * the capacity the host API reserves when it builds Poisson tables; the
+ * probability mass outside this window is below 1e-12.
+ *
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Required table capacity in elements
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson_table_capacity(double lambda)
+{
+    return 2 * static_cast<unsigned int>(16.0 * (2.0 + sqrt(lambda)));
+}
+
+/**
+ * \brief Builds a Poisson CDF table for \p lambda in place on the device.
+ *
+ * Fills \p cdf with the cumulative distribution function of the Poisson
+ * distribution with \p lambda, truncated to the window where probabilities
+ * exceed 1e-12, and points \p discrete_distribution at it. The resulting
+ * distribution samples exactly like a host-built CDF table and can be used
+ * with \p rocrand_poisson_from_table or \p rocrand_discrete.
+ *
+ * Building the table once and sampling it repeatedly is much faster than
+ * \p rocrand_poisson when many values are drawn for the same \p lambda,
+ * and unlike the host API the \p lambda may come from device memory, so a
+ * distinct table per element can be built without host round trips.
+ *
+ * \param lambda - Lambda parameter of the Poisson distribution
+ * \param cdf - Table storage with room for \p capacity <tt>double</tt> values
+ * \param capacity - Size of \p cdf in elements
+ * \param discrete_distribution - Distribution to initialize
+ *
+ * \return \p true if the table was built; \p false if \p capacity is smaller
+ * than \p rocrand_poisson_table_capacity(lambda)
+ */
+FQUALIFIERS
+bool rocrand_poisson_table_init(double lambda,
+                                double * cdf,
+                                unsigned int capacity,
+                                rocrand_discrete_distribution_st * discrete_distribution)
+{
+    const unsigned int capacity_needed = rocrand_poisson_table_capacity(lambda);
+    if (capacity < capacity_needed)
+    {
+        return false;
+    }
+
+    const double p_epsilon = 1e-12;
+    const double log_lambda = log(lambda);
+
+    const int left = static_cast<int>(floor(lambda)) - capacity_needed / 2;
+
+    // Calculate probabilities starting from mean in both directions,
+    // because only a small part of [0, lambda] has non-negligible values
+    // (> p_epsilon).
+
+    int lo = 0;
+    for (int i = capacity_needed / 2; i >= 0; i--)
+    {
+        const double x = left + i;
+        const double pp = exp(x * log_lambda - lgamma(x + 1.0) - lambda);
+        if (pp < p_epsilon)
+        {
+            lo = i + 1;
+            break;
+        }
+        cdf[i] = pp;
+    }
+
+    int hi = capacity_needed - 1;
+    for (int i = capacity_needed / 2 + 1; i < static_cast<int>(capacity_needed); i++)
+    {
+        const double x = left + i;
+        const double pp = exp(x * log_lambda - lgamma(x + 1.0) - lambda);
+        if (pp < p_epsilon)
+        {
+            hi = i - 1;
+            break;
+        }
+        cdf[i] = pp;
+    }
+
+    double sum = 0.0;
+    for (int i = lo; i <= hi; i++)
+    {
+        sum += cdf[i];
+    }
+
+    // Accumulate the normalized probabilities while packing the window to
+    // the front of the table (reads never trail the writes)
+    const double inv_sum = 1.0 / sum;
+    double cumulative = 0.0;
+    for (int i = lo; i <= hi; i++)
+    {
+        cumulative += cdf[i] * inv_sum;
+        cdf[i - lo] = cumulative;
+    }
+
+    discrete_distribution->size = hi - lo + 1;
+    discrete_distribution->offset = left + lo;
+    discrete_distribution->alias = NULL;
+    discrete_distribution->probability = NULL;
+    discrete_distribution->cdf = cdf;
+    return true;
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> from a prebuilt table.
+ *
+ * Generates and returns a Poisson-distributed <tt>unsigned int</tt> by
+ * inverting the CDF table in \p discrete_distribution — built with
+ * \p rocrand_poisson_table_init — with a binary search on one value from
+ * the generator in \p state. State is incremented by one position. The cost
+ * is logarithmic in the table size and independent of lambda, so tables may
+ * differ per thread without divergence penalties of the lambda-dependent
+ * \p rocrand_poisson paths.
+ *
+ * \param state - Pointer to a state of any rocRAND device generator
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+template<class StateType>
+FQUALIFIERS
+unsigned int rocrand_poisson_from_table(StateType * state,
+                                        const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_POISSON_H_
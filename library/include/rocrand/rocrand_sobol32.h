@@ -132,12 +132,17 @@ protected:
     FQUALIFIERS
     void discard_state(unsigned int offset)
     {
+        // The current value is the XOR of the direction vectors selected
+        // by the Gray code of the current index, so it can be updated with
+        // the vectors of the bits where the old and the new Gray codes
+        // differ, instead of being recomputed from all direction vectors.
+        unsigned int delta = m_state.i ^ (m_state.i >> 1);
         m_state.i += offset;
-        const unsigned int g = m_state.i ^ (m_state.i >> 1);
-        m_state.d = 0;
-        for(int i = 0; i < 32; i++)
+        delta ^= m_state.i ^ (m_state.i >> 1);
+        while(delta)
         {
-            m_state.d ^= (g & (1 << i) ? m_state.vectors[i] : 0);
+            m_state.d ^= m_state.vectors[rightmost_zero_bit(~delta)];
+            delta &= delta - 1;
         }
     }
 
@@ -131,12 +131,17 @@ protected:
     FQUALIFIERS
     void discard_state(unsigned long long int offset)
     {
+        // The current value is the XOR of the direction vectors selected
+        // by the Gray code of the current index, so it can be updated with
+        // the vectors of the bits where the old and the new Gray codes
+        // differ, instead of being recomputed from all direction vectors.
+        unsigned long long int delta = m_state.i ^ (m_state.i >> 1ull);
         m_state.i += offset;
-        const unsigned long long int g = m_state.i ^ (m_state.i >> 1ull);
-        m_state.d = 0;
-        for(int i = 0; i < 64; i++)
+        delta ^= m_state.i ^ (m_state.i >> 1ull);
+        while(delta)
         {
-            m_state.d ^= (g & (1ull << i) ? m_state.vectors[i] : 0ull);
+            m_state.d ^= m_state.vectors[rightmost_zero_bit(~delta)];
+            delta &= delta - 1;
         }
     }
 
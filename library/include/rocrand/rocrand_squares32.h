@@ -0,0 +1,254 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_SQUARES32_H_
+#define ROCRAND_SQUARES32_H_
+
+#ifndef FQUALIFIERS
+    #define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand/rocrand_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_SQUARES32_DEFAULT_SEED
+ * \brief Default seed for SQUARES32 PRNG.
+ */
+#define ROCRAND_SQUARES32_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+
+class squares32_engine
+{
+public:
+    struct squares32_state
+    {
+        // Counter; the high 32 bits select the subsequence,
+        // the low 32 bits are the position within it
+        unsigned long long counter;
+        // Key, derived from the 64-bit seed
+        unsigned long long key;
+
+#ifndef ROCRAND_DETAIL_SQUARES32_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float        boxmuller_float; // normally distributed float
+        double       boxmuller_double; // normally distributed double
+#endif
+    };
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2 ^ 32 numbers long.
+    FQUALIFIERS squares32_engine(const unsigned long long seed        = 0,
+                                 const unsigned long long subsequence = 0,
+                                 const unsigned long long offset      = 0)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 2 ^ 32 numbers long.
+    FQUALIFIERS void seed(const unsigned long long seed        = 0,
+                          const unsigned long long subsequence = 0,
+                          const unsigned long long offset      = 0)
+    {
+        // Derive the key from the seed with the splitmix64 finalizer so
+        // that nearby seeds produce unrelated keys; the Squares
+        // generator requires an odd key
+        unsigned long long z = seed + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        m_state.key = (z ^ (z >> 31)) | 1ULL;
+
+        m_state.counter = (subsequence << 32) + offset;
+
+#ifndef ROCRAND_DETAIL_SQUARES32_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+#endif
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    /// The skip has constant cost: every counter value yields one output.
+    FQUALIFIERS void discard(unsigned long long offset)
+    {
+        m_state.counter += offset;
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences,
+    /// a subsequence consisting of 2 ^ 32 random numbers. The skip has
+    /// constant cost.
+    FQUALIFIERS void discard_subsequence(unsigned long long subsequence)
+    {
+        m_state.counter += subsequence << 32;
+    }
+
+    FQUALIFIERS unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS unsigned int next()
+    {
+        return this->squares(m_state.counter++);
+    }
+
+protected:
+    /// Computes the output for counter value \p counter (the four-round
+    /// Squares function of Widynski): two middle-square rounds keyed
+    /// with <tt>counter * key</tt>, two with <tt>counter * key + key</tt>.
+    FQUALIFIERS unsigned int squares(const unsigned long long counter) const
+    {
+        const unsigned long long y = counter * m_state.key;
+        const unsigned long long z = y + m_state.key;
+
+        unsigned long long x = y;
+        x = x * x + y;
+        x = (x >> 32) | (x << 32); // round 1
+        x = x * x + z;
+        x = (x >> 32) | (x << 32); // round 2
+        x = x * x + y;
+        x = (x >> 32) | (x << 32); // round 3
+        return static_cast<unsigned int>((x * x + z) >> 32); // round 4
+    }
+
+protected:
+    // State
+    squares32_state m_state;
+
+#ifndef ROCRAND_DETAIL_SQUARES32_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<squares32_engine>;
+#endif
+
+}; // squares32_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::squares32_engine rocrand_state_squares32;
+/// \endcond
+
+/**
+ * \brief Initializes SQUARES32 state.
+ *
+ * Initializes the SQUARES32 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. Initialization costs a
+ * few arithmetic operations, so per-thread states can be created
+ * cheaply even in kernels that spawn billions of short-lived threads.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS void rocrand_init(const unsigned long long seed,
+                              const unsigned long long subsequence,
+                              const unsigned long long offset,
+                              rocrand_state_squares32* state)
+{
+    *state = rocrand_state_squares32(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using SQUARES32 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand(rocrand_state_squares32* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates SQUARES32 state to skip ahead by \p offset elements.
+ *
+ * Updates the SQUARES32 state in \p state to skip ahead by \p offset elements.
+ * The skip has constant cost: only the counter is advanced.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead(unsigned long long offset, rocrand_state_squares32* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates SQUARES32 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the SQUARES32 \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^32 numbers long. The skip has constant cost.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead_subsequence(unsigned long long subsequence,
+                                       rocrand_state_squares32* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates SQUARES32 state to skip ahead by \p sequence sequences.
+ *
+ * Updates the SQUARES32 \p state skipping \p sequence sequences ahead.
+ * For SQUARES32 each sequence is 2^32 numbers long (equal to the size
+ * of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS void skipahead_sequence(unsigned long long sequence, rocrand_state_squares32* state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_SQUARES32_H_
+
+/** @} */ // end of group rocranddevice
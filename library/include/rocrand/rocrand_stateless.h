@@ -0,0 +1,372 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_STATELESS_H_
+#define ROCRAND_STATELESS_H_
+
+#ifndef FQUALIFIERS
+    #define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_threefry2x32_20.h"
+#include "rocrand/rocrand_threefry2x64_20.h"
+#include "rocrand/rocrand_uniform.h"
+
+// Compile-time evaluation of the counter-based cores needs the relaxed
+// constexpr rules of C++14; with C++11 the *_block and *_at helpers
+// remain callable at run time from host and device code.
+#if __cplusplus >= 201402L
+    #define ROCRAND_CONSTEXPR_14_QUALIFIERS constexpr __host__ __device__
+#else
+    #define ROCRAND_CONSTEXPR_14_QUALIFIERS inline __host__ __device__
+#endif
+
+namespace rocrand_device
+{
+namespace detail
+{
+
+// Exposes the protected Threefry round function as a pure counter hash.
+// The engine state is never seeded or read; the rounds depend only on the
+// counter and key arguments.
+template<class state_value, class value, unsigned int Nrounds>
+class stateless_threefry_hash : private threefry_engine2_base<state_value, value, Nrounds>
+{
+public:
+    FQUALIFIERS state_value operator()(const state_value counter, const state_value key)
+    {
+        return this->threefry_rounds(counter, key);
+    }
+};
+
+FQUALIFIERS uint2 stateless_threefry2x32_20(const unsigned long long seed,
+                                            const unsigned long long index)
+{
+    stateless_threefry_hash<uint2, unsigned int, 20> hash;
+
+    const uint2 key
+        = uint2{static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)};
+    const uint2 counter
+        = uint2{static_cast<unsigned int>(index), static_cast<unsigned int>(index >> 32)};
+    return hash(counter, key);
+}
+
+FQUALIFIERS ulonglong2 stateless_threefry2x64_20(const unsigned long long seed,
+                                                 const unsigned long long index)
+{
+    stateless_threefry_hash<ulonglong2, unsigned long long, 20> hash;
+
+    const ulonglong2 key     = ulonglong2{seed, 0ULL};
+    const ulonglong2 counter = ulonglong2{index, 0ULL};
+    return hash(counter, key);
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns two uniformly distributed random <tt>unsigned int</tt> values
+ * computed directly from a (seed, index) pair.
+ *
+ * Hashes \p index with key \p seed using Threefry-2x32 with 20 rounds and
+ * returns both output words. No state object is needed: every (seed, index)
+ * pair maps to a fixed pair of values, so replaying an index reproduces its
+ * values exactly.
+ *
+ * The output is the full 20-round Threefry-2x32 block, the same function that
+ * backs \p ROCRAND_RNG_PSEUDO_THREEFRY2_32_20; it passes the TestU01 BigCrush
+ * battery.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the value to compute
+ *
+ * \return Two pseudorandom values (32-bit) as an <tt>uint2</tt>
+ */
+FQUALIFIERS uint2 rocrand_stateless2(const unsigned long long seed, const unsigned long long index)
+{
+    return rocrand_device::detail::stateless_threefry2x32_20(seed, index);
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned int</tt> value
+ * computed directly from a (seed, index) pair.
+ *
+ * Hashes \p index with key \p seed using Threefry-2x32 with 20 rounds and
+ * returns the first output word. See \p rocrand_stateless2 for the statistical
+ * properties and for a variant that returns both words of the hash.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the value to compute
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS unsigned int rocrand_stateless(const unsigned long long seed,
+                                           const unsigned long long index)
+{
+    return rocrand_device::detail::stateless_threefry2x32_20(seed, index).x;
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>unsigned long long</tt>
+ * value computed directly from a (seed, index) pair.
+ *
+ * Hashes \p index with key \p seed using Threefry-2x64 with 20 rounds and
+ * returns the first output word. Like \p rocrand_stateless, every
+ * (seed, index) pair maps to a fixed value, and the 20-round Threefry output
+ * passes the TestU01 BigCrush battery.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the value to compute
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+FQUALIFIERS unsigned long long rocrand_stateless_long_long(const unsigned long long seed,
+                                                           const unsigned long long index)
+{
+    return rocrand_device::detail::stateless_threefry2x64_20(seed, index).x;
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range computed directly from a (seed, index) pair.
+ *
+ * Hashes \p index with key \p seed using Threefry-2x32 with 20 rounds and
+ * maps the first output word to a <tt>float</tt> from (0; 1] range using the
+ * same conversion as \p rocrand_uniform.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the value to compute
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range
+ */
+FQUALIFIERS float rocrand_stateless_uniform(const unsigned long long seed,
+                                            const unsigned long long index)
+{
+    return rocrand_device::detail::uniform_distribution(
+        rocrand_device::detail::stateless_threefry2x32_20(seed, index).x);
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range computed directly from a (seed, index) pair.
+ *
+ * Hashes \p index with key \p seed using Threefry-2x32 with 20 rounds and
+ * maps both output words to <tt>float</tt> values from (0; 1] range using the
+ * same conversion as \p rocrand_uniform.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the value to compute
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range
+ */
+FQUALIFIERS float2 rocrand_stateless_uniform2(const unsigned long long seed,
+                                              const unsigned long long index)
+{
+    const uint2 v = rocrand_device::detail::stateless_threefry2x32_20(seed, index);
+    return float2{rocrand_device::detail::uniform_distribution(v.x),
+                  rocrand_device::detail::uniform_distribution(v.y)};
+}
+
+/**
+ * \brief Returns the Philox-4x32 block for a counter and key,
+ * evaluable at compile time.
+ *
+ * Computes the full 10-round Philox-4x32 block for \p counter under
+ * \p key, the same function that backs
+ * \p ROCRAND_RNG_PSEUDO_PHILOX4_32_10. The implementation restates the
+ * engine rounds as plain integer math, so with C++14 or later the call
+ * is \p constexpr and test vectors or shuffled lookup tables can be
+ * baked into the binary without a code generation step.
+ *
+ * \param counter - Counter block to encrypt
+ * \param key - Key to encrypt under
+ *
+ * \return The Philox-4x32-10 output block as an <tt>uint4</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS uint4 rocrand_philox4x32_10_block(uint4 counter, uint2 key)
+{
+    // Mirrors philox4x32_10_engine; ten rounds with a key bump after
+    // each are identical to nine bumped rounds plus a final round
+    for(unsigned int round_idx = 0; round_idx < 10; round_idx++)
+    {
+        const unsigned long long product0
+            = static_cast<unsigned long long>(ROCRAND_PHILOX_M4x32_0) * counter.x;
+        const unsigned long long product1
+            = static_cast<unsigned long long>(ROCRAND_PHILOX_M4x32_1) * counter.z;
+        counter = uint4{static_cast<unsigned int>(product1 >> 32) ^ counter.y ^ key.x,
+                        static_cast<unsigned int>(product1),
+                        static_cast<unsigned int>(product0 >> 32) ^ counter.w ^ key.y,
+                        static_cast<unsigned int>(product0)};
+        key.x += ROCRAND_PHILOX_W32_0;
+        key.y += ROCRAND_PHILOX_W32_1;
+    }
+    return counter;
+}
+
+/**
+ * \brief Returns the Threefry-2x32 block for a counter and key,
+ * evaluable at compile time.
+ *
+ * Computes the full 20-round Threefry-2x32 block for \p counter under
+ * \p key, the same function that backs \p rocrand_stateless2. With
+ * C++14 or later the call is \p constexpr; see
+ * rocrand_philox4x32_10_block().
+ *
+ * \param counter - Counter block to encrypt
+ * \param key - Key to encrypt under
+ *
+ * \return The Threefry-2x32-20 output block as an <tt>uint2</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS uint2 rocrand_threefry2x32_20_block(uint2 counter, uint2 key)
+{
+    // Mirrors threefry_engine2_base<uint2, unsigned int, 20>
+    const int rotations[8] = {13, 15, 26, 6, 17, 29, 16, 24};
+
+    unsigned int ks[3] = {key.x, key.y, SKEIN_KS_PARITY32 ^ key.x ^ key.y};
+    unsigned int x     = counter.x + ks[0];
+    unsigned int y     = counter.y + ks[1];
+
+    for(unsigned int round_idx = 0; round_idx < 20; round_idx++)
+    {
+        const int d = rotations[round_idx & 7u];
+        x += y;
+        y = (y << (d & 31)) | (y >> ((32 - d) & 31));
+        y ^= x;
+
+        if((round_idx & 3u) == 3)
+        {
+            const unsigned int inject_idx = round_idx / 4;
+            x += ks[(1 + inject_idx) % 3];
+            y += ks[(2 + inject_idx) % 3];
+            y += 1 + inject_idx;
+        }
+    }
+
+    return uint2{x, y};
+}
+
+/**
+ * \brief Returns the Threefry-2x64 block for a counter and key,
+ * evaluable at compile time.
+ *
+ * Computes the full 20-round Threefry-2x64 block for \p counter under
+ * \p key, the same function that backs \p rocrand_stateless_long_long.
+ * With C++14 or later the call is \p constexpr; see
+ * rocrand_philox4x32_10_block().
+ *
+ * \param counter - Counter block to encrypt
+ * \param key - Key to encrypt under
+ *
+ * \return The Threefry-2x64-20 output block as an <tt>ulonglong2</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS ulonglong2 rocrand_threefry2x64_20_block(ulonglong2 counter,
+                                                                        ulonglong2 key)
+{
+    // Mirrors threefry_engine2_base<ulonglong2, unsigned long long, 20>
+    const int rotations[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+
+    unsigned long long ks[3] = {key.x, key.y, SKEIN_KS_PARITY64 ^ key.x ^ key.y};
+    unsigned long long x     = counter.x + ks[0];
+    unsigned long long y     = counter.y + ks[1];
+
+    for(unsigned int round_idx = 0; round_idx < 20; round_idx++)
+    {
+        const int d = rotations[round_idx & 7u];
+        x += y;
+        y = (y << (d & 63)) | (y >> ((64 - d) & 63));
+        y ^= x;
+
+        if((round_idx & 3u) == 3)
+        {
+            const unsigned int inject_idx = round_idx / 4;
+            x += ks[(1 + inject_idx) % 3];
+            y += ks[(2 + inject_idx) % 3];
+            y += 1 + inject_idx;
+        }
+    }
+
+    return ulonglong2{x, y};
+}
+
+/**
+ * \brief Returns the Philox-4x32-10 block at an index of a seeded
+ * sequence, evaluable at compile time.
+ *
+ * Places \p seed in the key and \p index in the counter and returns
+ * rocrand_philox4x32_10_block() for them, so
+ * <tt>constexpr auto v = rocrand_philox_at(seed, index);</tt> yields
+ * the block a Philox-4x32-10 engine seeded with \p seed produces for
+ * counter \p index.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Counter value of the block to compute
+ *
+ * \return The Philox-4x32-10 output block as an <tt>uint4</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS uint4 rocrand_philox_at(const unsigned long long seed,
+                                                        const unsigned long long index)
+{
+    return rocrand_philox4x32_10_block(
+        uint4{static_cast<unsigned int>(index), static_cast<unsigned int>(index >> 32), 0, 0},
+        uint2{static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)});
+}
+
+/**
+ * \brief Returns the Threefry-2x32-20 block at an index of a seeded
+ * sequence, evaluable at compile time.
+ *
+ * Uses the (seed, index) mapping of \p rocrand_stateless2, so the
+ * result matches it word for word while being \p constexpr with C++14
+ * or later.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the block to compute
+ *
+ * \return The Threefry-2x32-20 output block as an <tt>uint2</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS uint2 rocrand_threefry_at(const unsigned long long seed,
+                                                          const unsigned long long index)
+{
+    return rocrand_threefry2x32_20_block(
+        uint2{static_cast<unsigned int>(index), static_cast<unsigned int>(index >> 32)},
+        uint2{static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)});
+}
+
+/**
+ * \brief Returns the Threefry-2x64-20 block at an index of a seeded
+ * sequence, evaluable at compile time.
+ *
+ * Uses the (seed, index) mapping of \p rocrand_stateless_long_long, so
+ * the result matches it word for word while being \p constexpr with
+ * C++14 or later.
+ *
+ * \param seed - Value to use as a key
+ * \param index - Index of the block to compute
+ *
+ * \return The Threefry-2x64-20 output block as an <tt>ulonglong2</tt>
+ */
+ROCRAND_CONSTEXPR_14_QUALIFIERS ulonglong2 rocrand_threefry_long_long_at(
+    const unsigned long long seed, const unsigned long long index)
+{
+    return rocrand_threefry2x64_20_block(ulonglong2{index, 0ULL}, ulonglong2{seed, 0ULL});
+}
+
+#endif // ROCRAND_STATELESS_H_
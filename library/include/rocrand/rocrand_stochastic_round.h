@@ -0,0 +1,192 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#ifndef ROCRAND_STOCHASTIC_ROUND_H_
+#define ROCRAND_STOCHASTIC_ROUND_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include <hip/hip_bfloat16.h>
+
+#include "rocrand/rocrand_common.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Stochastically rounds v to bfloat16 using the low 8 bits of r.
+// bfloat16 keeps the float exponent range, so exactly the low 16
+// mantissa bits are dropped for every finite value. The random byte
+// goes into the top 8 of the dropped bits, making the probability of
+// rounding up equal to the dropped fraction quantized to 1/256.
+FQUALIFIERS
+hip_bfloat16 stochastic_round_bf16(float v, unsigned int r)
+{
+    unsigned int bits = __float_as_uint(v);
+    if((bits & 0x7F800000u) == 0x7F800000u)
+    {
+        // Truncate infinities and NaNs without perturbation; keep NaNs
+        // quiet when the payload sits entirely in the dropped bits
+        if((bits & 0x007FFFFFu) != 0)
+        {
+            bits |= 0x00400000u;
+        }
+    }
+    else
+    {
+        // A carry out of the mantissa correctly bumps the exponent,
+        // including rounding the largest magnitudes up to infinity
+        bits += (r & 0xFFu) << 8;
+    }
+    hip_bfloat16 result;
+    result.data = static_cast<unsigned short>(bits >> 16);
+    return result;
+}
+
+// Stochastically rounds v to half using the low 8 bits of r. The byte
+// covers the top 8 of the 13 mantissa bits dropped for normal half
+// results; magnitudes below 2^-14 convert to half subnormals and round
+// with coarser probability resolution.
+FQUALIFIERS
+__half stochastic_round_half(float v, unsigned int r)
+{
+    unsigned int bits = __float_as_uint(v);
+    if((bits & 0x7F800000u) != 0x7F800000u)
+    {
+        bits += (r & 0xFFu) << 5;
+    }
+    return __float2half_rz(__uint_as_float(bits));
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Stochastically rounds a <tt>float</tt> to <tt>bfloat16</tt>.
+ *
+ * Rounds \p v to one of the two neighbouring bfloat16 values, with the
+ * probability of rounding away from zero equal to the position of \p v
+ * between them, quantized to 1/256. Consumes one value from the
+ * generator in \p state; rocrand_stochastic_round_bf16_4() amortizes
+ * one draw over four conversions instead.
+ *
+ * \tparam StateType - rocRAND device generator state type
+ *
+ * \param state - Pointer to a state to use
+ * \param v - Value to round
+ *
+ * \return \p v stochastically rounded to \p hip_bfloat16.
+ */
+template<class StateType>
+FQUALIFIERS
+hip_bfloat16 rocrand_stochastic_round_bf16(StateType * state, float v)
+{
+    const unsigned int r = static_cast<unsigned int>(rocrand(state));
+    return rocrand_device::detail::stochastic_round_bf16(v, r);
+}
+
+/**
+ * \brief Stochastically rounds four <tt>float</tt>s to <tt>bfloat16</tt>.
+ *
+ * Rounds the four values in \p input like
+ * rocrand_stochastic_round_bf16(), spending 8 bits of a single draw
+ * from the generator in \p state on each conversion, and saves the
+ * results to \p output. The position of the generator advances by one.
+ *
+ * \tparam StateType - rocRAND device generator state type
+ *
+ * \param state - Pointer to a state to use
+ * \param input - Values to round
+ * \param output - Rounded \p hip_bfloat16 values
+ */
+template<class StateType>
+FQUALIFIERS
+void rocrand_stochastic_round_bf16_4(StateType * state,
+                                     const float (&input)[4],
+                                     hip_bfloat16 (&output)[4])
+{
+    const unsigned int r = static_cast<unsigned int>(rocrand(state));
+    output[0] = rocrand_device::detail::stochastic_round_bf16(input[0], r);
+    output[1] = rocrand_device::detail::stochastic_round_bf16(input[1], r >> 8);
+    output[2] = rocrand_device::detail::stochastic_round_bf16(input[2], r >> 16);
+    output[3] = rocrand_device::detail::stochastic_round_bf16(input[3], r >> 24);
+}
+
+/**
+ * \brief Stochastically rounds a <tt>float</tt> to <tt>half</tt>.
+ *
+ * Rounds \p v to one of the two neighbouring half values, with the
+ * probability of rounding away from zero equal to the position of \p v
+ * between them, quantized to 1/256 for normal results. Consumes one
+ * value from the generator in \p state;
+ * rocrand_stochastic_round_half_4() amortizes one draw over four
+ * conversions instead.
+ *
+ * \tparam StateType - rocRAND device generator state type
+ *
+ * \param state - Pointer to a state to use
+ * \param v - Value to round
+ *
+ * \return \p v stochastically rounded to \p half.
+ */
+template<class StateType>
+FQUALIFIERS
+__half rocrand_stochastic_round_half(StateType * state, float v)
+{
+    const unsigned int r = static_cast<unsigned int>(rocrand(state));
+    return rocrand_device::detail::stochastic_round_half(v, r);
+}
+
+/**
+ * \brief Stochastically rounds four <tt>float</tt>s to <tt>half</tt>.
+ *
+ * Rounds the four values in \p input like
+ * rocrand_stochastic_round_half(), spending 8 bits of a single draw
+ * from the generator in \p state on each conversion, and saves the
+ * results to \p output. The position of the generator advances by one.
+ *
+ * \tparam StateType - rocRAND device generator state type
+ *
+ * \param state - Pointer to a state to use
+ * \param input - Values to round
+ * \param output - Rounded \p half values
+ */
+template<class StateType>
+FQUALIFIERS
+void rocrand_stochastic_round_half_4(StateType * state,
+                                     const float (&input)[4],
+                                     __half (&output)[4])
+{
+    const unsigned int r = static_cast<unsigned int>(rocrand(state));
+    output[0] = rocrand_device::detail::stochastic_round_half(input[0], r);
+    output[1] = rocrand_device::detail::stochastic_round_half(input[1], r >> 8);
+    output[2] = rocrand_device::detail::stochastic_round_half(input[2], r >> 16);
+    output[3] = rocrand_device::detail::stochastic_round_half(input[3], r >> 24);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_STOCHASTIC_ROUND_H_
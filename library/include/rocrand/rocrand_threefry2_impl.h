@@ -110,6 +110,18 @@ public:
         state_value  key;
         state_value  result;
         unsigned int substate;
+
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float        boxmuller_float; // normally distributed float
+        double       boxmuller_double; // normally distributed double
+#endif
     };
 
     FQUALIFIERS void discard(unsigned long long offset)
@@ -188,6 +200,9 @@ protected:
         X.x += ks[0];
         X.y += ks[1];
 
+        // Nrounds is a compile-time constant; unrolling folds the
+        // rotation table lookups and key injections into immediates
+        #pragma unroll
         for(unsigned int round_idx = 0; round_idx < Nrounds; round_idx++)
         {
             X.x += X.y;
@@ -258,6 +273,11 @@ protected:
 
 protected:
     threefry_state_2 m_state;
+
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+    template<typename Engine>
+    friend struct detail::engine_boxmuller_helper;
+#endif
 }; // threefry_engine2_base class
 
 } // end namespace rocrand_device
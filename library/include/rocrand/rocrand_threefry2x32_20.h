@@ -92,6 +92,11 @@ public:
         m_state.result   = {0U, 0U};
         m_state.substate = 0;
 
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+#endif
+
         m_state.key = {static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)};
 
         this->discard_subsequence_impl(subsequence);
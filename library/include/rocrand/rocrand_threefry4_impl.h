@@ -125,6 +125,18 @@ public:
         state_value  key;
         state_value  result;
         unsigned int substate;
+
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float        boxmuller_float; // normally distributed float
+        double       boxmuller_double; // normally distributed double
+#endif
     };
 
     /// Advances the internal state to skip \p offset numbers.
@@ -207,6 +219,9 @@ protected:
         X.z += ks[2];
         X.w += ks[3];
 
+        // Nrounds is a compile-time constant; unrolling folds the
+        // rotation table lookups and key injections into immediates
+        #pragma unroll
         for(unsigned int round_idx = 0; round_idx < Nrounds; round_idx++)
         {
             int rot_0 = threefry_rotation_array<value>(round_idx & 7u, 0);
@@ -309,6 +324,11 @@ protected:
 
 protected:
     threefry_state_4 m_state;
+
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+    template<typename Engine>
+    friend struct detail::engine_boxmuller_helper;
+#endif
 }; // threefry_engine4_base class
 
 } // end namespace rocrand_device
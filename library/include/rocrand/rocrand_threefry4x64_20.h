@@ -94,6 +94,11 @@ public:
         m_state.result   = {0ULL, 0ULL, 0ULL, 0ULL};
         m_state.substate = 0;
 
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state  = 0;
+        m_state.boxmuller_double_state = 0;
+#endif
+
         this->discard_subsequence_impl(subsequence);
         this->discard(offset);
         m_state.result = this->threefry_rounds(m_state.counter, m_state.key);
@@ -79,7 +79,14 @@ FQUALIFIERS unsigned long long rotl<unsigned long long>(unsigned long long x, in
 template<>
 FQUALIFIERS unsigned int rotl<unsigned int>(unsigned int x, int d)
 {
+#if defined(__HIP_DEVICE_COMPILE__) \
+    && (defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__))
+    // v_alignbit_b32 funnel-shifts the doubled word right, so rotating
+    // left by d is a single instruction instead of two shifts and an or
+    return __builtin_amdgcn_alignbit(x, x, (32 - d) & 31);
+#else
     return (x << (d & 31)) | (x >> ((32 - d) & 31));
+#endif
 };
 
 template<typename value>
@@ -0,0 +1,206 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_TRANSFORM_HPP_
+#define ROCRAND_TRANSFORM_HPP_
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+#include "rocrand/rocrand.h"
+#include "rocrand/rocrand_common.h"
+#include "rocrand/rocrand_stateless.h"
+#include "rocrand/rocrand_uniform.h"
+
+/** \rocrand_internal \addtogroup rocrandhostcpp
+ *
+ * @{
+ */
+
+namespace rocrand_device
+{
+namespace detail
+{
+
+// Applies the functor while the generated words are still in
+// registers; one thread expands one Philox block, so the transformed
+// output is the only global memory traffic of the launch.
+template<class T, class UnaryOp>
+ROCRAND_KERNEL void generate_transformed_kernel(const unsigned long long seed,
+                                                T*                       output,
+                                                const size_t             size,
+                                                UnaryOp                  op)
+{
+    const size_t stride      = static_cast<size_t>(gridDim.x) * blockDim.x;
+    const size_t block_count = (size + 3) / 4;
+    for(size_t b = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; b < block_count;
+        b += stride)
+    {
+        const uint4        v        = rocrand_philox_at(seed, b);
+        const unsigned int words[4] = {v.x, v.y, v.z, v.w};
+        const size_t       base     = 4 * b;
+        for(unsigned int j = 0; j < 4 && base + j < size; j++)
+        {
+            output[base + j] = op(words[j]);
+        }
+    }
+}
+
+template<class T, class UnaryOp>
+ROCRAND_KERNEL void generate_uniform_transformed_kernel(const unsigned long long seed,
+                                                        T*                       output,
+                                                        const size_t             size,
+                                                        UnaryOp                  op)
+{
+    const size_t stride      = static_cast<size_t>(gridDim.x) * blockDim.x;
+    const size_t block_count = (size + 3) / 4;
+    for(size_t b = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x; b < block_count;
+        b += stride)
+    {
+        const float4 v        = uniform_distribution4(rocrand_philox_at(seed, b));
+        const float  words[4] = {v.x, v.y, v.z, v.w};
+        const size_t base     = 4 * b;
+        for(unsigned int j = 0; j < 4 && base + j < size; j++)
+        {
+            output[base + j] = op(words[j]);
+        }
+    }
+}
+
+template<class Kernel, class T, class UnaryOp>
+inline rocrand_status launch_transformed(Kernel                   kernel,
+                                         const unsigned long long seed,
+                                         T*                       output,
+                                         const size_t             size,
+                                         UnaryOp                  op,
+                                         hipStream_t              stream)
+{
+    if(output == NULL && size > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(size == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    constexpr unsigned int threads = 256;
+    constexpr unsigned int max_blocks = 1024;
+    const size_t needed = ((size + 3) / 4 + threads - 1) / threads;
+    const unsigned int blocks
+        = static_cast<unsigned int>(std::min<size_t>(needed, max_blocks));
+
+    hipLaunchKernelGGL(kernel, dim3(blocks), dim3(threads), 0, stream, seed, output, size, op);
+    if(hipGetLastError() != hipSuccess)
+    {
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Generates raw values and applies a device functor to them in
+ * registers.
+ *
+ * Fills \p output with <tt>op(v)</tt> for \p size uniformly distributed
+ * 32-bit unsigned values \p v, computing each value and applying the
+ * functor inside one kernel. The transformed output is written exactly
+ * once and the raw values never leave registers, so post-processing
+ * such as scaling, clamping or repacking costs no second pass over the
+ * buffer.
+ *
+ * The value at index \p i is word <tt>i % 4</tt> of
+ * <tt>rocrand_philox_at(seed, i / 4)</tt>, so the mapping from
+ * (seed, index) to the raw value is fixed: replaying a seed reproduces
+ * the fill, regardless of the grid the kernel runs with. \p op must be
+ * callable from device code with an <tt>unsigned int</tt> argument and
+ * return a value convertible to \p T; it is applied to every generated
+ * value independently. The launch is asynchronous on \p stream like the
+ * generation functions of the C API.
+ *
+ * \param seed - Seed selecting the sequence
+ * \param output - Pointer to device memory to store transformed values
+ * \param size - Number of values to generate
+ * \param op - Device functor applied to every generated value
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output is NULL and \p size is
+ *   not zero \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+template<class T, class UnaryOp>
+rocrand_status rocrand_generate_transformed(const unsigned long long seed,
+                                            T*                       output,
+                                            const size_t             size,
+                                            UnaryOp                  op,
+                                            hipStream_t              stream = 0)
+{
+    return rocrand_device::detail::launch_transformed(
+        HIP_KERNEL_NAME(rocrand_device::detail::generate_transformed_kernel<T, UnaryOp>),
+        seed,
+        output,
+        size,
+        op,
+        stream);
+}
+
+/**
+ * \brief Generates uniformly distributed \p float values and applies a
+ * device functor to them in registers.
+ *
+ * Like rocrand_generate_transformed(), but every raw value is first
+ * mapped to a \p float from (0; 1] range with the same conversion as
+ * \p rocrand_uniform, and \p op receives that \p float. The value at
+ * index \p i is word <tt>i % 4</tt> of
+ * <tt>uniform_distribution4(rocrand_philox_at(seed, i / 4))</tt>.
+ *
+ * \param seed - Seed selecting the sequence
+ * \param output - Pointer to device memory to store transformed values
+ * \param size - Number of values to generate
+ * \param op - Device functor applied to every generated value
+ * \param stream - HIP stream to launch the generation on
+ *
+ * \return See rocrand_generate_transformed()
+ */
+template<class T, class UnaryOp>
+rocrand_status rocrand_generate_uniform_transformed(const unsigned long long seed,
+                                                    T*                       output,
+                                                    const size_t             size,
+                                                    UnaryOp                  op,
+                                                    hipStream_t              stream = 0)
+{
+    return rocrand_device::detail::launch_transformed(
+        HIP_KERNEL_NAME(rocrand_device::detail::generate_uniform_transformed_kernel<T, UnaryOp>),
+        seed,
+        output,
+        size,
+        op,
+        stream);
+}
+
+/** @} */ // end of group rocrandhostcpp
+
+#endif // ROCRAND_TRANSFORM_HPP_
@@ -30,23 +30,30 @@
 #define FQUALIFIERS __forceinline__ __device__
 #endif // FQUALIFIERS
 
+#include "rocrand/rocrand_chacha20.h"
 #include "rocrand/rocrand_lfsr113.h"
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares32.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_common.h"
 
+#include <hip/hip_bfloat16.h>
+
 namespace rocrand_device {
 namespace detail {
 
@@ -168,6 +175,43 @@ __half uniform_distribution_half(unsigned short v)
     return __float2half(ROCRAND_2POW16_INV + (v * ROCRAND_2POW16_INV));
 }
 
+// Packs two uniform halves in (0, 1] from one engine word with integer
+// operations: the low ten bits of each 16-bit lane become the mantissa of
+// a half in [1, 2), and the packed pair is mapped to (0, 1] as 2 - x in a
+// single half2 subtraction. Cheaper than two float conversions; the values
+// are spaced uniformly at 2^-10 instead of gaining extra precision towards
+// zero like the conversion path.
+FQUALIFIERS
+__half2 uniform_distribution_half2(unsigned int v)
+{
+    #if defined(ROCRAND_HALF_MATH_SUPPORTED)
+    const unsigned int bits = (v & 0x03FF03FFU) | 0x3C003C00U;
+    const __half2 h = __half2 {
+        __ushort_as_half(static_cast<unsigned short>(bits)),
+        __ushort_as_half(static_cast<unsigned short>(bits >> 16))
+    };
+    const __half2 two = __half2 {
+        __float2half(2.0f),
+        __float2half(2.0f)
+    };
+    return __hsub2(two, h);
+    #else
+    // Same values computed without half arithmetic: 2 - (1 + m / 1024)
+    return __half2 {
+        __float2half((1024 - (v & 0x3FFU)) * (1.0f / 1024)),
+        __float2half((1024 - ((v >> 16) & 0x3FFU)) * (1.0f / 1024))
+    };
+    #endif
+}
+
+// The same (0, 1] mapping for bfloat16; the value is computed in float
+// and converted at the end, as bfloat16 has no arithmetic of its own
+FQUALIFIERS
+hip_bfloat16 uniform_distribution_bf16(unsigned short v)
+{
+    return hip_bfloat16(ROCRAND_2POW16_INV + (v * ROCRAND_2POW16_INV));
+}
+
 // For an unsigned integer produced by an MRG-based engine, returns a value
 // in range [0, UINT32_MAX].
 template<typename state_type>
@@ -176,13 +220,21 @@ FQUALIFIERS unsigned int mrg_uniform_distribution_uint(unsigned int v) = delete;
 template<>
 FQUALIFIERS unsigned int mrg_uniform_distribution_uint<rocrand_state_mrg31k3p>(unsigned int v)
 {
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return mrg_scale_to_uint(v - 1, ROCRAND_MRG31K3P_UINT32_NORM_MANTISSA, 51);
+#else
     return static_cast<unsigned int>((v - 1) * ROCRAND_MRG31K3P_UINT32_NORM);
+#endif
 }
 
 template<>
 FQUALIFIERS unsigned int mrg_uniform_distribution_uint<rocrand_state_mrg32k3a>(unsigned int v)
 {
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return mrg_scale_to_uint(v - 1, ROCRAND_MRG32K3A_NORM_MANTISSA, 52);
+#else
     return static_cast<unsigned int>((v - 1) * ROCRAND_MRG32K3A_UINT_NORM);
+#endif
 }
 
 // For an unsigned integer produced by an MRG-based engine, returns value between
@@ -193,15 +245,23 @@ FQUALIFIERS float mrg_uniform_distribution(unsigned int v) = delete;
 template<>
 FQUALIFIERS float mrg_uniform_distribution<rocrand_state_mrg31k3p>(unsigned int v)
 {
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return mrg_scale_to_float(v, ROCRAND_MRG31K3P_NORM_MANTISSA, -30);
+#else
     double ret = static_cast<double>(v) * ROCRAND_MRG31K3P_NORM_DOUBLE;
     return static_cast<float>(ret);
+#endif
 }
 
 template<>
 FQUALIFIERS float mrg_uniform_distribution<rocrand_state_mrg32k3a>(unsigned int v)
 {
+#ifdef ROCRAND_MRG_INTEGER_SCALING
+    return mrg_scale_to_float(v, ROCRAND_MRG32K3A_NORM_MANTISSA, -31);
+#else
     double ret = static_cast<double>(v) * ROCRAND_MRG32K3A_NORM_DOUBLE;
     return static_cast<float>(ret);
+#endif
 }
 
 // For an unsigned integer produced by an MRG generator, returns value between
@@ -816,6 +876,23 @@ FQUALIFIERS float rocrand_uniform(rocrand_state_threefry4x64_20* state)
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS float rocrand_uniform(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
 /**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
@@ -836,6 +913,168 @@ FQUALIFIERS double rocrand_uniform_double(rocrand_state_threefry4x64_20* state)
     return rocrand_device::detail::uniform_distribution_double(rocrand(state));
 }
 
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS double rocrand_uniform_double(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS float rocrand_uniform(rocrand_state_pcg64 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS double rocrand_uniform_double(rocrand_state_pcg64 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using XOSHIRO256++ generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS float rocrand_uniform(rocrand_state_xoshiro256pp * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using XOSHIRO256++ generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS double rocrand_uniform_double(rocrand_state_xoshiro256pp * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using ChaCha20 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS float rocrand_uniform(rocrand_state_chacha20* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SQUARES32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS float rocrand_uniform(rocrand_state_squares32* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using ChaCha20 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS double rocrand_uniform_double(rocrand_state_chacha20* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SQUARES32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS double rocrand_uniform_double(rocrand_state_squares32* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_UNIFORM_H_
@@ -25,6 +25,8 @@
 #define FQUALIFIERS __forceinline__ __device__
 #endif // FQUALIFIERS_
 
+#include <type_traits>
+
 #include "rocrand/rocrand_common.h"
 #include "rocrand/rocrand_xorwow_precomputed.h"
 
@@ -68,34 +70,44 @@ void mul_mat_vec_inplace(const unsigned int * m, unsigned int * v)
     copy_vec(v, r);
 }
 
+// The Box–Muller transform requires two inputs to convert uniformly
+// distributed real values [0; 1] to normally distributed real values
+// (with mean = 0, and stddev = 1). Often user wants only one
+// normally distributed number, to save performance and random
+// numbers the 2nd value is saved for future requests. Engines carry the
+// bank as part of their state; the raw engine variant inherits the empty
+// cache instead and stays out of the normal API (see
+// rocrand_state_xorwow_raw).
+struct xorwow_boxmuller_cache
+{
+    unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+    unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+    float boxmuller_float; // normally distributed float
+    double boxmuller_double; // normally distributed double
+};
+
+struct xorwow_no_boxmuller_cache { };
+
 } // end detail namespace
 
-class xorwow_engine
+template<bool UseNormalCache>
+class xorwow_engine_t
 {
 public:
     struct xorwow_state
+        : std::conditional<UseNormalCache,
+                           detail::xorwow_boxmuller_cache,
+                           detail::xorwow_no_boxmuller_cache>::type
     {
         // Weyl sequence value
         unsigned int d;
 
-        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        // The Box–Muller transform requires two inputs to convert uniformly
-        // distributed real values [0; 1] to normally distributed real values
-        // (with mean = 0, and stddev = 1). Often user wants only one
-        // normally distributed number, to save performance and random
-        // numbers the 2nd value is saved for future requests.
-        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
-        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
-        float boxmuller_float; // normally distributed float
-        double boxmuller_double; // normally distributed double
-        #endif
-
         // Xorshift values (160 bits)
         unsigned int x[5];
     };
 
     FQUALIFIERS
-    xorwow_engine() : xorwow_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+    xorwow_engine_t() : xorwow_engine_t(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
 
     /// Initializes the internal state of the PRNG using
     /// seed value \p seed, goes to \p subsequence -th subsequence,
@@ -103,37 +115,47 @@ public:
     ///
     /// A subsequence is 2^67 numbers long.
     FQUALIFIERS
-    xorwow_engine(const unsigned long long seed,
-                  const unsigned long long subsequence,
-                  const unsigned long long offset)
+    xorwow_engine_t(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset)
     {
-        m_state.x[0] = 123456789U;
-        m_state.x[1] = 362436069U;
-        m_state.x[2] = 521288629U;
-        m_state.x[3] = 88675123U;
-        m_state.x[4] = 5783321U;
+        init_state(seed);
 
-        m_state.d = 6615241U;
+        discard_subsequence(subsequence);
+        discard(offset);
 
-        // Constants are arbitrary prime numbers
-        const unsigned int s0 = static_cast<unsigned int>(seed) ^ 0x2c7f967fU;
-        const unsigned int s1 = static_cast<unsigned int>(seed >> 32) ^ 0xa03697cbU;
-        const unsigned int t0 = 1228688033U * s0;
-        const unsigned int t1 = 2073658381U * s1;
-        m_state.x[0] += t0;
-        m_state.x[1] ^= t0;
-        m_state.x[2] += t1;
-        m_state.x[3] ^= t1;
-        m_state.x[4] += t0;
-        m_state.d += t1 + t0;
+        reset_boxmuller(&m_state);
+    }
 
+    /// Initializes the internal state of the PRNG like the constructor
+    /// above, but cooperatively with all threads of the block: the jump
+    /// matrices are staged through \p shared_jump_matrix (XORWOW_SIZE
+    /// elements of block-shared memory) instead of being read from device
+    /// memory by every thread separately. All threads of the block must
+    /// reach this constructor; \p seed, \p subsequence, and \p offset may
+    /// differ between threads.
+    ///
+    /// A subsequence is 2^67 numbers long.
+    FQUALIFIERS
+    xorwow_engine_t(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset,
+                    unsigned int * shared_jump_matrix)
+    {
+        init_state(seed);
+
+        #if defined(__HIP_DEVICE_COMPILE__)
+        jump_block(subsequence, d_xorwow_sequence_jump_matrices, shared_jump_matrix);
+        jump_block(offset, d_xorwow_jump_matrices, shared_jump_matrix);
+        // Apply n steps to Weyl sequence value as well
+        m_state.d += static_cast<unsigned int>(offset) * 362437;
+        #else
+        (void)shared_jump_matrix;
         discard_subsequence(subsequence);
         discard(offset);
-
-        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        m_state.boxmuller_float_state = 0;
-        m_state.boxmuller_double_state = 0;
         #endif
+
+        reset_boxmuller(&m_state);
     }
 
     /// Advances the internal state to skip \p offset numbers.
@@ -165,6 +187,45 @@ public:
         // d has the same value because 2^67 is divisible by 2^32 (d is 32-bit)
     }
 
+    /// Advances the internal state to skip \p Offset numbers.
+    ///
+    /// Equivalent to <tt>discard(Offset)</tt>, but the skip distance is a
+    /// compile-time constant: the digit loop over the precomputed matrix
+    /// powers is unrolled and folded, so only the matrices that \p Offset
+    /// actually needs are referenced. When \p Offset is a power of two
+    /// (e.g. a grid stride) this collapses to the few multiplications of
+    /// its single non-zero digit.
+    template<unsigned long long Offset>
+    FQUALIFIERS
+    void discard()
+    {
+        #ifdef __HIP_DEVICE_COMPILE__
+        jump_constant<Offset>(d_xorwow_jump_matrices);
+        #else
+        jump_constant<Offset>(h_xorwow_jump_matrices);
+        #endif
+
+        // Apply n steps to Weyl sequence value as well
+        m_state.d += static_cast<unsigned int>(Offset) * 362437;
+    }
+
+    /// Advances the internal state to skip \p Subsequence subsequences,
+    /// with the skip distance known at compile time like the \p discard
+    /// overload above. A subsequence is 2^67 numbers long.
+    template<unsigned long long Subsequence>
+    FQUALIFIERS
+    void discard_subsequence()
+    {
+        // Discard n * 2^67 samples
+        #ifdef __HIP_DEVICE_COMPILE__
+        jump_constant<Subsequence>(d_xorwow_sequence_jump_matrices);
+        #else
+        jump_constant<Subsequence>(h_xorwow_sequence_jump_matrices);
+        #endif
+
+        // d has the same value because 2^67 is divisible by 2^32 (d is 32-bit)
+    }
+
     FQUALIFIERS
     unsigned int operator()()
     {
@@ -186,11 +247,86 @@ public:
         return m_state.d + m_state.x[4];
     }
 
+    FQUALIFIERS
+    uint4 next4()
+    {
+        // The recurrence is sequential, but producing four outputs per
+        // call keeps the state in registers across the updates and lets
+        // callers consume the values as one vector
+        const unsigned int x = next();
+        const unsigned int y = next();
+        const unsigned int z = next();
+        const unsigned int w = next();
+        return uint4{x, y, z, w};
+    }
+
 protected:
 
+    FQUALIFIERS
+    void init_state(const unsigned long long seed)
+    {
+        m_state.x[0] = 123456789U;
+        m_state.x[1] = 362436069U;
+        m_state.x[2] = 521288629U;
+        m_state.x[3] = 88675123U;
+        m_state.x[4] = 5783321U;
+
+        m_state.d = 6615241U;
+
+        // Constants are arbitrary prime numbers
+        const unsigned int s0 = static_cast<unsigned int>(seed) ^ 0x2c7f967fU;
+        const unsigned int s1 = static_cast<unsigned int>(seed >> 32) ^ 0xa03697cbU;
+        const unsigned int t0 = 1228688033U * s0;
+        const unsigned int t1 = 2073658381U * s1;
+        m_state.x[0] += t0;
+        m_state.x[1] ^= t0;
+        m_state.x[2] += t1;
+        m_state.x[3] ^= t1;
+        m_state.x[4] += t0;
+        m_state.d += t1 + t0;
+    }
+
+    #if defined(__HIP_DEVICE_COMPILE__)
+    // Cooperative version of jump(): all threads of the block walk the
+    // digit planes of their own v in lockstep, and each plane's matrix is
+    // staged once into block-shared memory instead of being read from
+    // device memory by every thread.
+    FQUALIFIERS
+    void jump_block(unsigned long long v,
+                    const unsigned int jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE],
+                    unsigned int * shared_jump_matrix)
+    {
+        const unsigned int flat_id
+            = (threadIdx.z * blockDim.y + threadIdx.y) * blockDim.x + threadIdx.x;
+        const unsigned int block_size = blockDim.x * blockDim.y * blockDim.z;
+
+        unsigned int mi = 0;
+        // The or-reduction also separates the multiplications of the
+        // previous plane from overwriting the staged matrix below; mi is
+        // uniform across the block, so bounding it first keeps the
+        // reduction reached by all threads
+        while (mi < ROCRAND_XORWOW_JUMP_MATRICES_COMPILED && __syncthreads_or(v > 0))
+        {
+            for (unsigned int k = flat_id; k < XORWOW_SIZE; k += block_size)
+            {
+                shared_jump_matrix[k] = jump_matrices[mi][k];
+            }
+            __syncthreads();
+
+            const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
+            for (unsigned int i = 0; i < is; i++)
+            {
+                detail::mul_mat_vec_inplace(shared_jump_matrix, m_state.x);
+            }
+            mi++;
+            v >>= XORWOW_JUMP_LOG2;
+        }
+    }
+    #endif
+
     FQUALIFIERS
     void jump(unsigned long long v,
-              const unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE])
+              const unsigned int jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE])
     {
         // x~(n + v) = (A^v mod m)x~n mod m
         // The matrix (A^v mod m) can be precomputed for selected values of v.
@@ -204,9 +340,13 @@ protected:
         //   A^(1 * 2^67), A^(4 * 2^67), A^(16 * 2^67)...
         //
         // Intermediate powers can be calculated as multiplication of the powers above.
+        //
+        // When the tables are truncated (see
+        // ROCRAND_XORWOW_JUMP_MATRICES_COMPILED in the precomputed header)
+        // the caller guarantees that v fits in the compiled matrices.
 
         unsigned int mi = 0;
-        while (v > 0)
+        while (v > 0 && mi < ROCRAND_XORWOW_JUMP_MATRICES_COMPILED)
         {
             const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
             for (unsigned int i = 0; i < is; i++)
@@ -218,15 +358,61 @@ protected:
         }
     }
 
+    // Same as jump(), but with v known at compile time. After unrolling,
+    // each plane's digit is a constant: planes with a zero digit disappear
+    // entirely, so only the matrices that V actually needs are referenced
+    // and no runtime loop state is kept.
+    template<unsigned long long V>
+    FQUALIFIERS
+    void jump_constant(const unsigned int jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE])
+    {
+        // With V known at compile time a skip that needs matrices beyond
+        // the compiled subset is diagnosed instead of silently truncated
+        static_assert(XORWOW_JUMP_LOG2 * ROCRAND_XORWOW_JUMP_MATRICES_COMPILED >= 64
+                          || (V >> (XORWOW_JUMP_LOG2 * ROCRAND_XORWOW_JUMP_MATRICES_COMPILED)) == 0,
+                      "The skip distance needs jump matrices beyond "
+                      "ROCRAND_XORWOW_JUMP_MATRICES_COMPILED");
+
+        #pragma unroll
+        for (unsigned int mi = 0; mi < ROCRAND_XORWOW_JUMP_MATRICES_COMPILED; mi++)
+        {
+            const unsigned int is = static_cast<unsigned int>(V >> (mi * XORWOW_JUMP_LOG2))
+                & ((1 << XORWOW_JUMP_LOG2) - 1);
+            for (unsigned int i = 0; i < is; i++)
+            {
+                detail::mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+            }
+        }
+    }
+
+    // Overloads in place of member #ifdefs: the cached state clears its
+    // bank flags, the raw state has nothing to clear and the call folds
+    // away
+    FQUALIFIERS
+    void reset_boxmuller(detail::xorwow_boxmuller_cache * cache)
+    {
+        cache->boxmuller_float_state = 0;
+        cache->boxmuller_double_state = 0;
+    }
+
+    FQUALIFIERS
+    void reset_boxmuller(detail::xorwow_no_boxmuller_cache *) { }
+
 protected:
     // State
     xorwow_state m_state;
 
-    #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-    friend struct detail::engine_boxmuller_helper<xorwow_engine>;
-    #endif
+    friend struct detail::engine_boxmuller_helper<xorwow_engine_t<UseNormalCache>>;
+
+}; // xorwow_engine_t class
 
-}; // xorwow_engine class
+// The historical engine name keeps the Box-Muller cache unless the
+// library opts out of in-state banking
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+typedef xorwow_engine_t<true> xorwow_engine;
+#else
+typedef xorwow_engine_t<false> xorwow_engine;
+#endif
 
 } // end namespace rocrand_device
 
@@ -237,6 +423,7 @@ protected:
 
 /// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
 typedef rocrand_device::xorwow_engine rocrand_state_xorwow;
+typedef rocrand_device::xorwow_engine_t<false> rocrand_state_xorwow_raw;
 /// \endcond
 
 /**
@@ -245,18 +432,60 @@ typedef rocrand_device::xorwow_engine rocrand_state_xorwow;
  * Initializes the XORWOW generator \p state with the given
  * \p seed, \p subsequence, and \p offset.
  *
+ * This and the other XORWOW state functions accept both
+ * \p rocrand_state_xorwow and \p rocrand_state_xorwow_raw. The raw
+ * state omits the banked second Box-Muller output, saving its
+ * registers in kernels that never draw normally distributed values;
+ * the normal and log-normal functions are not available for it.
+ *
  * \param seed - Value to use as a seed
  * \param subsequence - Subsequence to start at
  * \param offset - Absolute offset into subsequence
  * \param state - Pointer to state to initialize
  */
+template<bool UseNormalCache>
 FQUALIFIERS
 void rocrand_init(const unsigned long long seed,
                   const unsigned long long subsequence,
                   const unsigned long long offset,
-                  rocrand_state_xorwow * state)
+                  rocrand_device::xorwow_engine_t<UseNormalCache> * state)
 {
-    *state = rocrand_state_xorwow(seed, subsequence, offset);
+    *state = rocrand_device::xorwow_engine_t<UseNormalCache>(seed, subsequence, offset);
+}
+
+/**
+ * \brief Initializes XORWOW states cooperatively for a whole block.
+ *
+ * Initializes the XORWOW generator \p state with the given
+ * \p seed, \p subsequence, and \p offset like \p rocrand_init, but shares
+ * the skip-ahead jump matrices between the threads of the block: each
+ * matrix is staged once into \p shared_jump_matrix and all threads multiply
+ * from the shared copy, instead of every thread streaming the matrices from
+ * device memory on its own.
+ *
+ * All threads of the block must call this function; \p seed, \p subsequence,
+ * and \p offset may differ between threads. \p shared_jump_matrix must point
+ * to block-shared (\p __shared__) memory with room for at least XORWOW_SIZE
+ * (800) <tt>unsigned int</tt> values.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ * \param shared_jump_matrix - Pointer to block-shared staging memory
+ */
+template<bool UseNormalCache>
+FQUALIFIERS
+void rocrand_init_block(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        rocrand_device::xorwow_engine_t<UseNormalCache> * state,
+                        unsigned int * shared_jump_matrix)
+{
+    *state = rocrand_device::xorwow_engine_t<UseNormalCache>(seed,
+                                                             subsequence,
+                                                             offset,
+                                                             shared_jump_matrix);
 }
 
 /**
@@ -271,12 +500,32 @@ void rocrand_init(const unsigned long long seed,
  *
  * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
  */
+template<bool UseNormalCache>
 FQUALIFIERS
-unsigned int rocrand(rocrand_state_xorwow * state)
+unsigned int rocrand(rocrand_device::xorwow_engine_t<UseNormalCache> * state)
 {
     return state->next();
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using XORWOW generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+template<bool UseNormalCache>
+FQUALIFIERS
+uint4 rocrand4(rocrand_device::xorwow_engine_t<UseNormalCache> * state)
+{
+    return state->next4();
+}
+
 /**
  * \brief Updates XORWOW state to skip ahead by \p offset elements.
  *
@@ -285,12 +534,34 @@ unsigned int rocrand(rocrand_state_xorwow * state)
  * \param offset - Number of elements to skip
  * \param state - Pointer to state to update
  */
+template<bool UseNormalCache>
 FQUALIFIERS
-void skipahead(unsigned long long offset, rocrand_state_xorwow * state)
+void skipahead(unsigned long long offset, rocrand_device::xorwow_engine_t<UseNormalCache> * state)
 {
     return state->discard(offset);
 }
 
+/**
+ * \brief Updates XORWOW state to skip ahead by a compile-time \p Offset.
+ *
+ * Updates the XORWOW state in \p state to skip ahead by \p Offset elements,
+ * like \p skipahead, but with the skip distance given as a template argument.
+ * The loop over the precomputed matrix powers is resolved at compile time,
+ * so only the matrices that \p Offset actually needs are referenced. Use this
+ * overload when the skip distance is a compile-time constant, for example a
+ * power-of-two grid stride.
+ *
+ * \tparam Offset - Number of elements to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Offset, bool UseNormalCache>
+FQUALIFIERS
+void skipahead(rocrand_device::xorwow_engine_t<UseNormalCache> * state)
+{
+    return state->template discard<Offset>();
+}
+
 /**
  * \brief Updates XORWOW state to skip ahead by \p subsequence subsequences.
  *
@@ -300,12 +571,33 @@ void skipahead(unsigned long long offset, rocrand_state_xorwow * state)
  * \param subsequence - Number of subsequences to skip
  * \param state - Pointer to state to update
  */
+template<bool UseNormalCache>
 FQUALIFIERS
-void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow * state)
+void skipahead_subsequence(unsigned long long subsequence,
+                           rocrand_device::xorwow_engine_t<UseNormalCache> * state)
 {
     return state->discard_subsequence(subsequence);
 }
 
+/**
+ * \brief Updates XORWOW state to skip ahead by a compile-time \p Subsequence.
+ *
+ * Updates the XORWOW \p state to skip ahead by \p Subsequence subsequences,
+ * like \p skipahead_subsequence, but with the skip distance resolved at
+ * compile time as in the \p skipahead overload above.
+ * Each subsequence is 2^67 numbers long.
+ *
+ * \tparam Subsequence - Number of subsequences to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Subsequence, bool UseNormalCache>
+FQUALIFIERS
+void skipahead_subsequence(rocrand_device::xorwow_engine_t<UseNormalCache> * state)
+{
+    return state->template discard_subsequence<Subsequence>();
+}
+
 /**
  * \brief Updates XORWOW state to skip ahead by \p sequence sequences.
  *
@@ -315,12 +607,33 @@ void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow
  * \param sequence - Number of sequences to skip
  * \param state - Pointer to state to update
  */
+ template<bool UseNormalCache>
  FQUALIFIERS
- void skipahead_sequence(unsigned long long sequence, rocrand_state_xorwow * state)
+ void skipahead_sequence(unsigned long long sequence,
+                         rocrand_device::xorwow_engine_t<UseNormalCache> * state)
  {
      return state->discard_subsequence(sequence);
  }
 
+/**
+ * \brief Updates XORWOW state to skip ahead by a compile-time \p Sequence.
+ *
+ * Updates the XORWOW \p state skipping \p Sequence sequences ahead, like
+ * \p skipahead_sequence, but with the skip distance resolved at compile time
+ * as in the \p skipahead overload above.
+ * For XORWOW each sequence is 2^67 numbers long (equal to the size of a subsequence).
+ *
+ * \tparam Sequence - Number of sequences to skip
+ *
+ * \param state - Pointer to state to update
+ */
+template<unsigned long long Sequence, bool UseNormalCache>
+FQUALIFIERS
+void skipahead_sequence(rocrand_device::xorwow_engine_t<UseNormalCache> * state)
+{
+    return state->template discard_subsequence<Sequence>();
+}
+
 #endif // ROCRAND_XORWOW_H_
 
 /** @} */ // end of group rocranddevice
@@ -30,7 +30,18 @@
 #define XORWOW_JUMP_MATRICES 32
 #define XORWOW_JUMP_LOG2 2
 
-static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+// Number of skip-ahead matrices compiled into the tables below. Defining
+// a smaller value (directly or through the ROCRAND_XORWOW_JUMP_MATRICES
+// CMake option) drops the matrices for the largest skips from every
+// translation unit including this header, cutting compile time and
+// kernel binary size. Offsets and subsequence counts passed to the
+// engine must then stay below
+// 2^(XORWOW_JUMP_LOG2 * ROCRAND_XORWOW_JUMP_MATRICES_COMPILED).
+#ifndef ROCRAND_XORWOW_JUMP_MATRICES_COMPILED
+    #define ROCRAND_XORWOW_JUMP_MATRICES_COMPILED XORWOW_JUMP_MATRICES
+#endif
+
+static const __device__ unsigned int d_xorwow_jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE] = {
     {
         0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0, 0, 0, 30, 0, 0, 0, 0, 60, 
         0, 0, 0, 0, 120, 0, 0, 0, 0, 240, 0, 0, 0, 0, 480, 0, 0, 0, 0, 960, 0, 0, 0, 0, 1920, 
@@ -65,6 +76,7 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         0, 0, 0, 4194304, 71303168, 0, 0, 0, 8388608, 142606336, 0, 0, 0, 16777216, 285212672, 0, 0, 0, 33554432, 570425344, 0, 0, 0, 67108864, 1140850688, 
         0, 0, 0, 134217728, 2281701376, 0, 0, 0, 268435456, 268435456, 0, 0, 0, 536870912, 536870912, 0, 0, 0, 1073741824, 1073741824, 0, 0, 0, 2147483648, 2147483648, 
     },
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 1
     {
         0, 3, 51, 771, 13107, 0, 6, 102, 1542, 26214, 0, 15, 255, 3855, 65535, 0, 30, 510, 7710, 131070, 0, 60, 1020, 15420, 262140, 
         0, 120, 2040, 30840, 524280, 0, 240, 4080, 61680, 1048560, 0, 480, 8160, 123360, 2097120, 0, 960, 16320, 246720, 4194240, 0, 1920, 32640, 493440, 8388480, 
@@ -99,6 +111,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         4194304, 71303168, 1077936128, 1145044992, 4194304, 8388608, 142606336, 2155872256, 2290089984, 8388608, 16777216, 285212672, 16777216, 285212672, 16777216, 33554432, 570425344, 33554432, 570425344, 33554432, 67108864, 1140850688, 67108864, 1140850688, 67108864, 
         134217728, 2281701376, 134217728, 2281701376, 134217728, 268435456, 268435456, 268435456, 268435456, 268435456, 536870912, 536870912, 536870912, 536870912, 536870912, 1073741824, 1073741824, 1073741824, 1073741824, 1073741824, 2147483648, 2147483648, 2147483648, 2147483648, 2147483648, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 2
     {
         85009117, 335741939, 1412632518, 386859243, 1741437244, 152139416, 403047142, 2556825231, 505087203, 4287193174, 335609039, 336528191, 1425998811, 456920088, 2832198590, 724748988, 3625845630, 1509824181, 3330088197, 2710488401, 1431742057, 1077674236, 1140592489, 2096905276, 3007294393, 
         2863484114, 1081606648, 1207443154, 972585080, 2793363314, 1432000919, 1089470704, 1341132452, 3019109363, 2362285522, 1790260014, 2178941408, 2682264904, 1743251430, 429603751, 359294556, 62915520, 1069562512, 3486502860, 859207501, 3939814584, 125831040, 2139125024, 2678038424, 1718415002, 
@@ -133,6 +147,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         4194304, 78643200, 1091829760, 2745630720, 4194304, 3229614080, 3378511872, 1109917696, 2270035968, 8388608, 1358954496, 1119879168, 1414529024, 513540096, 16777216, 2717908992, 2239758336, 2829058048, 1027080192, 33554432, 1140850688, 184549376, 1363148800, 2054160384, 3288334336, 
         2281701376, 369098752, 2726297600, 4108320768, 2281701376, 268435456, 738197504, 2231369728, 968884224, 3959422976, 536870912, 1476395008, 167772160, 3011510272, 3355443200, 1073741824, 2952790016, 335544320, 1728053248, 2147483648, 2147483648, 1610612736, 3892314112, 503316480, 0, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 3
     {
         1939838472, 1412147404, 166205219, 1757484276, 2905930693, 2345662040, 2845657161, 253454719, 2661974169, 303781080, 4075331504, 31014156, 244538930, 3752264221, 992575155, 219309525, 246620060, 215640989, 4125020723, 2016731730, 3236558869, 297169276, 3293566751, 1867504216, 210423272, 
         2531663658, 499723753, 1730625896, 189236880, 3388575408, 2433358422, 1368961148, 3134096848, 2827836415, 3888822753, 4172043647, 3379360748, 2651760955, 1345081091, 627692776, 189423917, 1927379456, 4004336944, 2995932065, 1882016234, 2551113616, 1576396048, 1299792730, 2151240795, 2154814108, 
@@ -167,6 +183,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         2089025605, 3050632421, 2428784965, 140658149, 4254138368, 1745354889, 711584249, 2746523017, 2551006457, 1100808192, 1494221073, 3422999489, 2696954129, 976716737, 2653421568, 3806331426, 3690047362, 1481392674, 3817015170, 2353004544, 286262340, 2300534532, 4206449732, 15339268, 2894069760, 
         488376456, 1489927688, 1196583048, 652746248, 2214592512, 69904, 1006205200, 2322628880, 1229515024, 2617245696, 3423527456, 1964953120, 4260938272, 386199072, 1744830464, 1342444608, 1069330496, 2138592320, 3185897536, 1073741824, 1342493824, 3780942976, 1771066496, 2189433984, 2147483648, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 4
     {
         1804684571, 2106089606, 1533056158, 2870216110, 3618155659, 3789871366, 4246691682, 3667072763, 1212241769, 3152390668, 2973497449, 2958641966, 2088805328, 717518631, 2401090860, 3606967204, 952637656, 59827581, 1291486682, 1499453515, 2053994857, 563998083, 4094000396, 1163546899, 1003843565, 
         654565639, 1070907026, 4217851863, 426034251, 1721352737, 278404469, 3899800390, 1063362170, 1162348262, 3153545093, 3249996223, 186674553, 2616406148, 3137968354, 1282784965, 1495068058, 3033760361, 2278144523, 3192245769, 719586342, 2602548287, 3386583150, 355354345, 3252815848, 2178056037, 
@@ -201,6 +219,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         4255789547, 2682856590, 12563128, 1397542366, 237149400, 2233707508, 3875573245, 2097374144, 175320773, 4103445984, 4089284323, 3610168130, 3084915964, 680145366, 2571684685, 1132894909, 104640024, 193765521, 2338202907, 895271448, 11499099, 1798066417, 1297412626, 2511347162, 3140535007, 
         2129963538, 700683199, 2609700278, 2953463279, 2290844145, 1871316353, 3993801787, 2219413182, 2954453701, 231283580, 1375331115, 207723994, 1799562537, 2056553564, 2513609799, 3542459627, 3173012714, 3923404932, 217877755, 2095124912, 192024370, 1168134987, 1889598668, 3014873069, 2033573343, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 5
     {
         3465348660, 3623545008, 3505902593, 838034830, 1338018789, 2595329276, 3367746385, 3197935201, 1439351946, 3585085571, 4165798087, 3634792639, 2359485974, 2772582925, 1110186203, 3771562484, 1508694157, 1564641206, 2801985736, 2446107936, 3849126897, 1842973671, 944408104, 2624631280, 2729080685, 
         3737368614, 858809173, 2289802345, 2428186575, 3114742765, 716011303, 3443810690, 814132610, 517432787, 614445393, 2930433345, 291178098, 2117644502, 2749446703, 311745701, 365684723, 1705418876, 2213749318, 4011417220, 1842575651, 988348831, 94258998, 2771150272, 498058526, 1344827813, 
@@ -235,6 +255,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3594351577, 3068232274, 3771730346, 4110519574, 3534704897, 2375277865, 3597780202, 3472676002, 1350276449, 3218248239, 3589255283, 3253132633, 1769885529, 3792812294, 120332643, 1219374788, 3608889019, 2386099811, 858495304, 1284785543, 331370962, 2259419662, 2519864134, 3194739432, 2669074511, 
         2565559140, 3378072004, 2647801475, 265068954, 1464416963, 1232787612, 4160089759, 2510685972, 670300081, 2509357766, 1981891975, 4161588397, 1371924626, 44760868, 634955171, 1187096933, 3324788972, 3576888559, 2801347752, 3730298395, 1702170762, 4206083415, 741409141, 3649731355, 1025429529, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 6
     {
         91444490, 628576944, 4069219862, 2253058925, 492354082, 1191182242, 1565180119, 2257613723, 456055162, 605712223, 953365104, 3104638527, 1133984729, 2662828416, 2134948274, 1921384447, 843719355, 588432962, 1734575434, 2924140067, 483396548, 3848838894, 3155476556, 1760928304, 4168059840, 
         3279827269, 2644461735, 4168565656, 3951563569, 1276805504, 1708974143, 1878547888, 3465220024, 3062086782, 2801401651, 1510428126, 716404149, 1646021208, 3534932385, 1186585561, 651997355, 282914223, 352224857, 3764407517, 1059868753, 1971798134, 978904005, 976413661, 4039544152, 498989693, 
@@ -269,6 +291,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         815689760, 1710961092, 2775607076, 2175058103, 3252688367, 2936890483, 2746319120, 2736754, 1646031035, 2448701214, 2886833213, 3689830606, 3292798106, 300773646, 3125160783, 1247453205, 2746275624, 4011063775, 904135764, 876847374, 366267234, 2541269205, 131376648, 1805948133, 3383589530, 
         2350119829, 2513170439, 4096158499, 4229211520, 2992048272, 1338522080, 1187391335, 2898563453, 2163088451, 1417971677, 2047421551, 902282791, 1143943232, 3568431811, 4059861993, 193362198, 2509297125, 3968551582, 2175686117, 3568936881, 1853177468, 2134063169, 2919389416, 1124914545, 1209806738, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 7
     {
         1199972651, 1035834631, 3177798370, 860834162, 3741677748, 3780327829, 1693730265, 1643429511, 559568669, 2758650294, 647308222, 3901603996, 1778653821, 3618523672, 2154201067, 4261179460, 3285764480, 3334002738, 3215795953, 91368462, 1883994950, 1506873376, 1527780962, 4046354597, 4081676034, 
         2389066602, 1574939945, 427845396, 2714836263, 1259019491, 2493238133, 2584034689, 3151382431, 2171033919, 176883719, 2031844862, 1272380790, 1298975901, 4087222847, 1524000054, 311436877, 3627785554, 1889491722, 2938069193, 2771940687, 2756955968, 4289348777, 263514583, 887207028, 3522902525, 
@@ -303,6 +327,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         137171998, 3239159214, 2258610918, 426724741, 3502660993, 135977383, 429929363, 3984458137, 964026748, 2182019070, 3836562946, 515026869, 359030455, 1301694917, 2300414803, 2364654981, 3804876710, 171119249, 2646785698, 4283509387, 3628087763, 1748227044, 3037141234, 3000413256, 23007314, 
         3598880509, 4160517314, 112205578, 1677675411, 734881643, 2830770338, 3470317145, 3306806569, 2635040943, 2671367560, 3528996498, 3878886478, 3114253828, 2721384408, 3175226991, 1393767271, 2651623266, 3767978376, 1269699398, 1100964192, 4169085845, 2086718107, 1286251099, 764751784, 3006878591, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 8
     {
         2565473087, 1149521056, 3529037691, 630435548, 73598765, 1467331930, 3988027050, 2771962200, 91261543, 980989218, 2227515435, 236831608, 2872772569, 2330469327, 1654035853, 2883791516, 4170143763, 126418114, 127789935, 2114249438, 2933346767, 639483386, 1532399845, 2182422151, 741069317, 
         2376371063, 3398508789, 3828295651, 3963199356, 4156483769, 4206759111, 1266176088, 3210273687, 432131993, 667709537, 874477513, 2304714957, 629309008, 116453438, 3051811727, 3490241985, 3355968243, 2304043871, 2724990029, 1095724699, 2408437363, 1433161037, 3245468546, 2494529842, 4204170637, 
@@ -337,6 +363,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1234485739, 869158554, 245101118, 1724974650, 3851803199, 922411232, 3046280696, 3284392523, 3528264590, 2802364078, 381450957, 1741009694, 4222244451, 102929888, 1668474417, 3881791214, 1429483134, 1938365051, 1023690708, 3333855520, 3238705869, 2602245525, 3059586169, 720438965, 2120786297, 
         453980990, 1048501876, 4060576583, 3537810796, 3892882814, 691572481, 3899584121, 1582529013, 3260326865, 2358704826, 1607030801, 1035900449, 3442507859, 1406737127, 249758705, 1535363329, 893329207, 51912312, 3440532856, 3736385218, 295452658, 2379709553, 1647382020, 2363679860, 2998779887, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 9
     {
         4209102573, 2387104994, 1221484586, 1726143957, 3263877318, 3362559187, 282442925, 2418524976, 3196072648, 3174695999, 2072047145, 2985823503, 2132951745, 2298545297, 2495977670, 1397656146, 2086257884, 3834366725, 3862532368, 3583329522, 1543996818, 2192688115, 3081427696, 2656520743, 8772004, 
         2476324234, 3600148050, 1168683794, 3219143568, 108768238, 1339513738, 447593731, 2742877256, 2488536667, 4189834432, 808657962, 2422880287, 390864786, 3381554683, 760628048, 353395922, 3577556262, 2482413928, 507756643, 839344953, 3505184848, 3945044582, 2414915836, 2313624497, 1832728088, 
@@ -371,6 +399,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1763262792, 2706181276, 538294991, 353565565, 18133995, 1719731406, 3311085516, 2018821960, 300367686, 2628312935, 1151449661, 2178805970, 3288321196, 535051857, 1623270973, 2761151808, 2701048972, 317681607, 2281427601, 719748170, 351452298, 2191958596, 4000232015, 335837771, 4158081521, 
         3779404077, 1998444133, 3849605095, 1532231791, 2930266419, 4203951289, 748423654, 1993082867, 451159852, 488781053, 2438982775, 2222815270, 543209242, 1241562465, 2868868009, 4201052877, 2438841764, 2151708682, 2426958921, 1520654642, 1990098337, 1070792755, 2308394635, 1442389785, 705615044, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 10
     {
         973368008, 1221885324, 2086331970, 2323744198, 280145759, 1795442656, 2984366093, 3532172763, 323888669, 851950179, 4198638255, 899943985, 4087912561, 2935341503, 1443752852, 3991058999, 3547259355, 35779889, 1076308344, 4075444807, 186174448, 3542284780, 660388677, 2777400132, 1092226205, 
         2418702276, 1307933032, 1940510003, 1932005362, 4016036211, 387339882, 2969593895, 3453134349, 1382709098, 1795814140, 1588159469, 1216733801, 2227378121, 2063027627, 582454582, 3364657275, 3466973302, 484564303, 1489261596, 2270291560, 2008178784, 2284268924, 2229317366, 644797709, 1213921542, 
@@ -405,6 +435,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1105681409, 4033144425, 4017983282, 1670425353, 4040882785, 1780687273, 1405678015, 3076115981, 2713472488, 286336494, 3664225263, 502759060, 777620620, 635590826, 132236203, 1866406173, 1235046453, 2859554298, 121814656, 944976320, 1946494170, 2548097575, 415384946, 3934685646, 1507032178, 
         1383654007, 2906269630, 566005756, 3118733139, 2969075870, 1834096359, 3263358416, 1322979710, 904583023, 3582075094, 2298898632, 2491891941, 660351763, 2548592542, 3009200751, 2116595110, 2623212287, 4167133624, 196759529, 3038645579, 1769704552, 1713233322, 2127497999, 3849458221, 3769872265, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 11
     {
         51082211, 3347503176, 3221768777, 2986163981, 3937460013, 1716372908, 4132024211, 3035957293, 1791036224, 4214815056, 1645540011, 2629793790, 3185505897, 1855718954, 495459467, 1728339314, 2318396341, 3396602050, 3273624616, 2625973148, 1762905939, 1706358553, 1088424264, 2764318930, 1026127380, 
         1128004134, 2724553694, 41981087, 2304966004, 1342745986, 3425554050, 3537673465, 752263676, 280905885, 929399589, 4090689526, 2141254732, 1469491656, 2593100469, 1096008340, 3316809312, 1698245188, 1656427920, 3081873338, 1750515301, 3850483440, 4081834419, 1225164947, 1244139942, 1972663124, 
@@ -439,6 +471,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         884423945, 928407281, 4173634172, 1492070114, 2706943441, 1365883971, 3076484301, 744370087, 4004118884, 2199449568, 879458863, 3197725005, 3590586547, 59693002, 3614114662, 1499386564, 2914582708, 3751842429, 947438603, 1986129491, 3747112289, 833777768, 2231649410, 1841607849, 3526253103, 
         3797105813, 1291185911, 3188408549, 3311027691, 3983681758, 2246511800, 1271525377, 2996265908, 2396071405, 902427181, 164636454, 2459631341, 635349368, 463309029, 1409367654, 849052250, 3221786769, 2310288531, 2919204855, 1263130532, 1215722704, 3497322658, 2840687222, 2185004161, 1507335864, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 12
     {
         2052557448, 2879065999, 22933757, 2160014758, 3736092460, 3556641619, 1350613766, 2107757927, 309323868, 3452852627, 3424626316, 545651740, 1935764720, 2349926457, 3546577033, 862046434, 167198649, 338290297, 1145807303, 1571276102, 883549156, 907871968, 638566313, 678764227, 3795356864, 
         3306095271, 1452688488, 621126888, 1838613968, 2054107827, 1785040579, 454879400, 1952849106, 1907701866, 1639495252, 1623968604, 2997422000, 2633878652, 1036670775, 2191465943, 3053533585, 1654709920, 1950620393, 4177745509, 1742007818, 2888573892, 2825965566, 1399790365, 1307674482, 310692416, 
@@ -473,6 +507,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         2469678938, 2885597732, 2715483555, 3566904604, 462585182, 1922457093, 3035264235, 2866504077, 2031456720, 1598555964, 2569915450, 3947972758, 290683210, 2465427488, 3504862176, 793156806, 1722326752, 2706215067, 3818976191, 2007064241, 552144413, 2692866408, 3975075075, 4293828741, 1123460373, 
         960845744, 1855626484, 1876934434, 1343778249, 912185207, 127278206, 4168930635, 340393978, 65814528, 2552086271, 2507474816, 1240220220, 1761964455, 2204917500, 4088965101, 1079310398, 3071460742, 2188549805, 1064733776, 4191719087, 3221046115, 3772395288, 883516842, 2077853840, 229484673, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 13
     {
         448889887, 3508620909, 4164289950, 155254859, 298319697, 980080883, 3500794888, 3974907245, 682778656, 382798811, 1500342771, 3942535492, 1039809505, 2126581011, 561192171, 4046277638, 840733718, 1694555864, 241216466, 4182349979, 2525929010, 386794637, 349755829, 2959959729, 686974318, 
         3243688353, 3911051908, 3917458620, 441833800, 3164548257, 584185450, 450132281, 3528356519, 4275666503, 1317069624, 817077137, 2945430988, 1532878265, 2542155552, 3348614029, 1419611574, 1245233100, 1981161828, 1161647342, 2781439556, 3896025436, 2349200248, 1213899699, 860301545, 1590934964, 
@@ -507,6 +543,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1815949694, 272696290, 1495465483, 3102030383, 3546078241, 3272619595, 759699322, 1161486824, 1146281812, 4194130649, 3936306436, 4077338125, 2127551216, 2995077453, 209698652, 3836657987, 1782152220, 1642490089, 3695579542, 537862234, 1696168156, 4022607, 3642864269, 54404878, 2925910542, 
         3444042482, 1931288691, 2269375687, 614870298, 1139082272, 3672546472, 3255845763, 2987873616, 3436501734, 380553853, 750118352, 750708138, 488564982, 2936846643, 3460652101, 3085496886, 3734224010, 523359404, 2751912206, 3302219188, 2729509827, 1995554251, 2288103059, 3289667468, 2860301591, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 14
     {
         3481653941, 2111903071, 3569014882, 1149634763, 4206972571, 2948781360, 2576820949, 2587099571, 3987042644, 4255777336, 2829594348, 3832744490, 3554499754, 787920018, 695635693, 2746034685, 2078139227, 1144320548, 4020978225, 449503505, 3004993826, 2045843139, 1604631401, 148449881, 457819243, 
         4089112489, 1713441237, 1790909556, 3334464951, 3070008305, 811825474, 4089105370, 708239097, 1494832299, 2074902973, 468898217, 1722559700, 2499754488, 2267939270, 650114709, 549502184, 4040463514, 4228169080, 4094284819, 1599334548, 2992525399, 2107053637, 197348940, 1669884894, 3982326753, 
@@ -541,6 +579,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3085839620, 3184266772, 2359972463, 862934481, 3624479194, 3574284465, 2700143837, 2468083868, 3798800988, 4116964911, 1832002264, 4276154871, 3256889524, 4036954281, 697729046, 886223984, 2196986730, 1157617208, 1995907944, 398452318, 3523714364, 613570866, 2962430983, 1408814780, 892117129, 
         4173164219, 3894076479, 2721348430, 555734931, 1869034419, 336114876, 3142554871, 3349604636, 3450290892, 955122895, 2202902910, 2558366468, 1701182712, 283197682, 1865942385, 2027648778, 2285857699, 880475184, 958651279, 169534250, 3842420528, 1568559789, 2986618464, 2568345525, 3081082692, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 15
     {
         575494427, 2773243709, 4009191487, 3877909663, 2252044261, 1328043370, 1407136778, 3204434425, 3881653592, 1481049819, 2939203697, 889352935, 628666312, 165199023, 2949092155, 1116804589, 998930334, 4144153491, 4191022348, 9022505, 4033326555, 2329569601, 824756145, 3501916851, 1481410328, 
         1970954319, 4022176157, 2356841052, 3783173734, 3649102345, 3205430658, 1460938436, 280282398, 3262135457, 4055383786, 28522973, 1100901182, 4048609665, 994490185, 2888527367, 3591919750, 65093467, 399797207, 3377740861, 3103183487, 3696509979, 866353724, 3847992271, 2821933890, 1491144079, 
@@ -575,6 +615,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         2656602623, 2037214047, 323260312, 3310408133, 4037617529, 137297627, 1236501991, 495817051, 481150309, 3067841968, 3120347176, 714354848, 1554632062, 2522324107, 4274051212, 2180914534, 1261686356, 3569290041, 1801431819, 4286755560, 2749452442, 829235089, 2243153325, 2525168177, 1486881882, 
         585653228, 3288336688, 2734161045, 30430534, 714492313, 2582732426, 595577790, 1463554287, 1949506865, 4210942156, 2008105540, 4055753132, 2530320603, 319064177, 2305067982, 3825716413, 1543867515, 108979478, 3089716545, 2921391708, 2403595525, 3783697766, 2313991047, 3302598706, 1318323763, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 16
     {
         1470380360, 3057428612, 2756676297, 1633786556, 4246459918, 2557524017, 1857180133, 618903690, 2475611092, 2621430634, 2084292404, 1698607774, 1788956972, 3375072220, 1499167056, 1218814632, 3699503479, 588281768, 3603925285, 1187721841, 1307962320, 2562217840, 3882506958, 2387033730, 2097027049, 
         1593669125, 1899433035, 4039983902, 1546854551, 1073191673, 3368453769, 3074694838, 534637095, 1860006723, 3416402670, 802354899, 3998709605, 3944315555, 3454226397, 1648185195, 488532673, 3063734121, 1318974867, 187087202, 200160693, 4170479404, 782764886, 4007973657, 1651636372, 3084151528, 
@@ -609,6 +651,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         533997731, 3919796086, 662975152, 864661066, 1070894403, 1020445801, 1511298602, 4221508348, 3577952702, 4122306502, 2012051572, 1616168260, 2456901413, 2717726537, 840264605, 2687215223, 2174960097, 1239122603, 2890231920, 3365350767, 3998868598, 563137220, 893868530, 3400632172, 1538627830, 
         2812510298, 496662288, 2317289974, 2252393722, 1221289032, 2418100559, 402670890, 1528570045, 3160531718, 1806492066, 3211663975, 3617025598, 3664580463, 1338638297, 341637330, 2097019728, 4031221207, 503636424, 3883416740, 1530237682, 1152125396, 2845384901, 332460372, 457364876, 1738239808, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 17
     {
         1118787884, 1884590246, 1007052798, 3717680750, 1609263052, 2486654530, 2761168910, 163554565, 3928803020, 2632714628, 1386788970, 2621928183, 2855206157, 2989018213, 1836814260, 4197635108, 1030118238, 2789863793, 2063944689, 1647608366, 255485979, 3657534664, 1317185871, 2410074449, 3971156607, 
         907575923, 4132859581, 416269582, 877554291, 633895348, 2236014545, 992386759, 3971362318, 2173597771, 1673339632, 1371742490, 2033574313, 3809530180, 319182848, 1562235776, 463522324, 1482338913, 1816432405, 3278626272, 1335179249, 171265751, 2249118654, 1153849045, 3013179633, 1450352108, 
@@ -643,6 +687,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1318010299, 3950178561, 1078499199, 1176289535, 3875152821, 1984420952, 1134199826, 2944539174, 3667625203, 2034152216, 1648355307, 2376447620, 2967418253, 185143450, 889002925, 3999315013, 661455858, 4026799358, 3626504428, 3544795311, 3642718771, 2467387138, 1034249749, 2051371333, 4251353248, 
         1575036366, 751400924, 2906720214, 1210002606, 916508568, 1728487600, 2478884914, 3081526615, 1867135009, 1955998382, 701713417, 512784398, 1255240210, 3665676113, 1771754697, 4000392442, 3342268855, 2677221913, 369054145, 4011912082, 748537647, 1626721797, 852497405, 168721778, 3091138383, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 18
     {
         3781228998, 1787582256, 838267218, 2710632450, 690892139, 2484870604, 4151302318, 1844787776, 727768263, 1075391038, 1842903369, 2927332301, 3246688068, 1234715005, 2906526190, 3369636401, 3091858538, 3320767682, 920496809, 1406803705, 3163880457, 1540551653, 2733620168, 2588558057, 147277542, 
         803170440, 821275940, 3897549272, 151390608, 951639139, 904639695, 1106545578, 1514893712, 998760135, 2557458623, 4109877399, 578824730, 2174064027, 3352513900, 3206168298, 911932439, 2030004973, 3283902592, 3755877921, 250434692, 352122318, 977153640, 642640734, 2555395772, 2307695537, 
@@ -677,6 +723,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1891106916, 416443047, 3298583974, 1030877276, 2839390034, 4181398645, 1845333999, 3643365079, 1993116780, 1763857175, 1951718545, 3785659537, 4156412284, 4138026128, 3480291142, 54280556, 4169041146, 3130638398, 3236816184, 3559898998, 916420843, 938920758, 3425021599, 1528477728, 3597939783, 
         3516249439, 936528538, 4174817780, 2541489033, 3962368135, 2054336507, 2610093970, 3613025255, 3583905994, 2990129491, 332823408, 2505138276, 3811707598, 373987627, 4263703898, 1668946560, 3213253899, 2673819338, 1631405099, 3127443274, 549232331, 21447814, 1647238011, 3093799993, 1922712395, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 19
     {
         4224788259, 3569487556, 1080137041, 2788623569, 856160888, 2195536417, 3030463035, 2906439247, 896055051, 1967105456, 2093562169, 2919742950, 546374698, 1372591815, 3773616637, 349073007, 1331102855, 3035367896, 1222622311, 2266618592, 74466398, 1140488004, 855606859, 3803728487, 3589743162, 
         2748402856, 1044387368, 1494850922, 2242660891, 3111566003, 2013737074, 163276737, 1526772858, 3047139947, 3150695453, 2583795468, 3628272447, 305282258, 2151108134, 2905708853, 1052800761, 3354632338, 1017036861, 2453680791, 2673902555, 1622154585, 2893733051, 3888482522, 306284440, 3245137245, 
@@ -711,6 +759,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         123465626, 844518179, 1161486362, 2706162053, 2966530827, 4103639053, 1837121393, 909648429, 298619078, 2057042454, 3613272637, 3609349032, 1664428748, 1871510359, 58508710, 1079418100, 3278870121, 3821562746, 16654909, 2530580589, 3361874982, 629910009, 2124761646, 2508133604, 1954315500, 
         3019833617, 141617625, 1653192078, 1541695589, 1223978475, 3875963510, 3028691587, 3450826564, 2185849120, 1956475624, 3053842172, 3550887830, 2672339803, 176823785, 913229929, 681399502, 2256486297, 2881672598, 597153273, 2782767695, 1133158067, 4126077325, 3456027404, 754062201, 4069172986, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 20
     {
         2441935114, 3465447683, 2897229686, 3845380309, 1199633364, 495424232, 2490548037, 581670528, 2467171733, 2200094863, 2163927790, 3895792830, 2097210789, 1606544633, 1305562517, 4072525389, 3256142090, 349440478, 3920932491, 2462464051, 1075951496, 2835763703, 1593198055, 2380945625, 543531323, 
         3182766507, 2927484354, 2877470578, 4153923603, 2443156156, 1168544900, 888955615, 3605412824, 1336677864, 3256116974, 2884036014, 4070749843, 2989661773, 1095584023, 1370834065, 3534389580, 312378113, 3190819203, 1247574926, 2046019470, 3536918510, 1479030180, 847820646, 3992973956, 3827223401, 
@@ -745,6 +795,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3950270431, 2663319810, 3873120593, 2080989388, 2896532502, 3176181708, 1736685126, 4081767288, 3515770288, 1371473598, 1491850178, 4284949727, 2774513541, 1541596000, 3948112869, 2114538326, 2641532252, 1837244955, 2292505300, 3179787565, 639953781, 785902378, 3852544833, 553508260, 23014564, 
         106722100, 2705412979, 3449440367, 950636401, 870804158, 629831074, 424163855, 373653940, 2739378330, 377730945, 418426029, 267367218, 554678849, 4222664331, 3346048120, 1870226737, 2435616108, 3747040233, 698046507, 1671346285, 4127293033, 568612264, 3467142937, 1627988025, 1305525598, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 21
     {
         2246605826, 215030128, 871645668, 3402612852, 423273439, 316965236, 47416561, 1470716454, 2288582385, 2021890755, 2148091363, 167227868, 3085506034, 3365950545, 1170282137, 1345986409, 197195155, 2644113318, 2491271090, 2597072003, 170335901, 2540851884, 2584420407, 3609142920, 3052130502, 
         4018095157, 2850805299, 2777821400, 110647395, 3262987676, 1447103309, 3632575579, 3243210595, 1892770504, 4214485953, 38676169, 2431628817, 2836918800, 272023527, 2825888902, 2794421955, 2354379386, 452404203, 584718212, 1915053836, 1455821656, 4264066935, 1150980581, 3792433350, 3104909316, 
@@ -779,6 +831,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         1275942292, 2687807236, 538129710, 3337005391, 3941968393, 1113153386, 3813628384, 1775835369, 296314749, 1697642748, 3614403315, 1953056095, 2102878063, 3161706344, 2207159580, 3078233525, 3836286614, 886914072, 1884037075, 4135819784, 1616380780, 1672616998, 3879848699, 2277472209, 3933249848, 
         2428044648, 2876076879, 165724720, 2277165385, 1984963196, 1456923194, 2406217222, 3388886718, 47522558, 1903557801, 1959641458, 2325355446, 3251147398, 2266553941, 2243962024, 1420017618, 1791159474, 1793406225, 601509698, 3207357979, 1189285184, 148538800, 2077251302, 3267239327, 2851475997, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 22
     {
         2628162153, 3861478870, 2769884494, 3423483820, 1118276924, 536776894, 3742490940, 550084334, 2441329856, 2604618499, 2308745810, 1178166365, 1345165241, 4039508109, 1246601384, 3843182157, 2200144237, 91750284, 4290064840, 3363597477, 3243492274, 4271100308, 4186328336, 2291901989, 1834723222, 
         372220743, 2190417067, 2624886324, 3567647862, 1591175369, 2278087682, 2461678432, 232820452, 2714694382, 3070258434, 2412655444, 2667664607, 249083056, 4166379751, 1360927521, 2247816079, 3253689753, 1563674427, 1914999382, 2101454952, 1067816947, 1098201917, 4054175236, 1805828534, 1815913104, 
@@ -813,6 +867,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         2065938273, 3277412030, 122636766, 2164055077, 1000638739, 2044933533, 2935604716, 2772787255, 3727331409, 1315627932, 2610657438, 832931652, 452359900, 681035792, 3312648046, 1059435047, 1489639114, 3647631796, 417952902, 731020350, 2847472725, 2779076784, 2674295324, 487600023, 2925909449, 
         3997011591, 3697231318, 967300591, 2310856069, 684710043, 811911286, 4174732177, 1010656728, 702780279, 920081774, 1578296057, 944734808, 2884038169, 2885919611, 2633474915, 2508946673, 3579216621, 656143887, 426108406, 2166202683, 991797657, 706498590, 561168186, 1144619335, 3136206425, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 23
     {
         3600072515, 651444872, 2348224675, 1684848433, 1913333701, 3413467790, 1567802204, 2125206188, 2463158656, 2251055204, 4132590383, 3192977084, 3718261822, 3431519430, 3506690867, 1313208797, 637811069, 12802085, 3456408080, 166617386, 1764224523, 4016338923, 2225367442, 2461647273, 3137989854, 
         373730087, 3013524828, 242949418, 3443491410, 3671816408, 2391000148, 3964107377, 716535366, 1884597979, 3917515811, 3441985401, 2472173593, 4034695117, 2486526143, 1658764329, 1873516415, 884116165, 814992460, 1069506245, 3797556389, 838088473, 2279863068, 1002637017, 4174541774, 644478743, 
@@ -847,6 +903,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3116222066, 1801867255, 2738500841, 1452697246, 733457482, 1680421668, 1035766144, 468847991, 3606474156, 2612692123, 730556693, 859096521, 4005878655, 1138273887, 2182363629, 2710579590, 3345140092, 2562710857, 3859276724, 2318176233, 3964665794, 3295219265, 3037789445, 371545704, 3434130670, 
         3686032092, 19964088, 340386179, 2147090894, 1446742483, 3083526520, 561888846, 2903328518, 1524465288, 360120037, 2031515996, 1516035872, 2752848969, 1094251072, 984159948, 369999653, 864602622, 2402584241, 3028363830, 252580667, 480470405, 3201548259, 2739036185, 2198549891, 1978812013, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 24
     {
         2546657140, 2771792972, 3371698159, 1137313111, 2399264952, 1204642544, 2090179262, 2948712987, 2908027331, 498636511, 2292804841, 1480836858, 2826016727, 196495965, 2168559184, 3910150715, 320076735, 3144753899, 3199094529, 1165806050, 728308199, 2322528104, 2891334400, 561853019, 4161870615, 
         1348321971, 2461357166, 1216229488, 1392766290, 3060494848, 3282469664, 1866493654, 2351421557, 4195620347, 1512242723, 478174598, 1087303780, 471631659, 2599553643, 791527994, 563537164, 1238109907, 3218421602, 133222502, 4182363220, 305688802, 2666439314, 2408520958, 787389550, 4226450542, 
@@ -881,6 +939,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3466154373, 3988139604, 1079368270, 991305574, 898158502, 2898908951, 651161128, 1952607949, 1221528540, 29979722, 3006846808, 2911550178, 2569412437, 1460616937, 2127921978, 3689931108, 950505297, 3469337654, 3180457017, 2316433735, 1464678429, 2867173456, 391248106, 3622065314, 2143251073, 
         860219584, 323835636, 340886643, 1805485977, 109344001, 1537119779, 1795626099, 2568079633, 3048040562, 1204069532, 2488753091, 2160014198, 3132782711, 1266102795, 91252225, 2018366053, 39675212, 979320891, 343397131, 814470367, 366655857, 3287033048, 3379301026, 1566381433, 3431153818, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 25
     {
         2234324389, 1682296894, 3526681456, 3988544681, 1315506584, 1754723911, 3607564438, 3764062195, 3408328234, 2385116969, 3827569659, 4104590721, 2612634189, 1762747544, 1676800931, 1814546108, 2684685172, 1659194343, 3381624140, 2286640580, 688245437, 2593335056, 1657668516, 1161309746, 3390664973, 
         2460564382, 2811435329, 2169200311, 2768093584, 4288309691, 1341061221, 1361417084, 3060155336, 2526021346, 1037055386, 890124736, 2185462193, 765141735, 1841745804, 3562499272, 1437907207, 2127475991, 2845453063, 4007976206, 4160093314, 2717704308, 4193767498, 1667876711, 3477753188, 3150367681, 
@@ -915,6 +975,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         2364069707, 2361723426, 738500028, 1401903990, 1543704261, 2442916222, 1076190609, 1882477803, 740024557, 1591015439, 2730909167, 2723330839, 1637373491, 3777799860, 2921269571, 3698591972, 3997463570, 3877862147, 1912888417, 3365137165, 3465700492, 771243134, 4037723169, 1715894739, 1025821874, 
         1924958945, 3382242859, 121591031, 483980724, 546523388, 2446882279, 856267778, 578739009, 2978085488, 480884914, 966764808, 457039953, 3817520708, 1113646451, 2503896910, 3507840816, 717151671, 4149352573, 1568869830, 395015863, 773165995, 1853682362, 2861368846, 1884368812, 1250092101, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 26
     {
         916910638, 961623451, 1193013401, 1016438484, 4091279871, 287282633, 8590725, 3575333670, 324340905, 3133751747, 2840894649, 2980503178, 1111215768, 2783846375, 72516413, 4158424384, 2184094569, 2305724254, 4057093054, 1407652993, 3105191537, 768505376, 298782270, 993926164, 2694730042, 
         1479658113, 2376490281, 2767906402, 1619969256, 3256472015, 2563843533, 2974784738, 2529307107, 4289918826, 3105587575, 3748950898, 2182744253, 431888679, 3780324902, 2525978209, 54545903, 1688749940, 2394884334, 3477656171, 263834270, 1562965459, 804704330, 4185729868, 138898835, 2113063150, 
@@ -949,6 +1011,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         6448083, 1093882965, 2867500469, 3626379157, 1849073068, 897616501, 604221668, 1020676159, 4083635798, 1716022041, 3671877965, 1738820843, 30077467, 729231767, 3413193248, 207000406, 3854363185, 3302747326, 3293643267, 2101250157, 460131091, 4159442595, 1133391045, 1031215443, 4195487944, 
         45931575, 2922629291, 789302543, 3024994662, 442525623, 2850119076, 838309503, 2585361734, 1020449164, 1623631007, 955374631, 2932467671, 3713639221, 3019179416, 977970472, 1817244230, 3856774853, 1140530868, 886199600, 1218509766, 4001537244, 2840913665, 2133254364, 3332344608, 475291624, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 27
     {
         1854921599, 2655519695, 3124573588, 319882484, 603545603, 4175512633, 141286453, 1183670252, 1789500145, 37351733, 3190829323, 2782782009, 493805446, 1228958246, 2672482554, 2274981421, 2935438833, 3625733677, 3679506394, 687805550, 134516308, 3576789728, 965007022, 1056542222, 2319405423, 
         3944221200, 950102624, 3848192810, 3205299696, 82033760, 1241913280, 1360146137, 1675732327, 2164452797, 3920498715, 2226452641, 3172047212, 1569171738, 2631589480, 2889660225, 2030783667, 2237381973, 2706217212, 3143638386, 1733174225, 1166820137, 3818389960, 193959252, 2793509934, 316291605, 
@@ -983,6 +1047,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         773351497, 1878220007, 3097009802, 1252607159, 1378821846, 2741884614, 178612659, 3656860395, 1259606652, 3942111545, 488406826, 3640897405, 3419000480, 353909713, 2996208477, 2862593073, 108483327, 648472258, 1060249632, 1049865483, 430087518, 1364157854, 3367631180, 251313827, 2374149836, 
         2109357086, 479172068, 464775113, 1806677787, 3488082411, 356035738, 3080424395, 4134646749, 369528743, 1031004516, 2525336414, 4189798138, 3928909462, 568714397, 1681832820, 1753328641, 827357673, 1651960551, 1798317455, 737101952, 3257553606, 400882781, 1473208110, 4134183873, 2193420912, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 28
     {
         2483976489, 2790651795, 3298324523, 3508205426, 2236819708, 917494217, 769620837, 3411018785, 2391335000, 1627061280, 3356773416, 1288706527, 4178910717, 3636299534, 4221874052, 3674654381, 537787012, 4271656840, 185820273, 1160533598, 1862365049, 2550353307, 1392072847, 1870891365, 1517453821, 
         524666025, 3645751565, 2415020247, 3691419894, 2580450642, 2130267479, 3636103610, 562446539, 750696587, 97137475, 3894066051, 2239638596, 3256181120, 3981041836, 774947039, 451287677, 3618957054, 4236303539, 1027744929, 1497195372, 498574915, 2164122779, 582902291, 3040883311, 1626221455, 
@@ -1017,6 +1083,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         353688341, 145655006, 1972100601, 1456042517, 3767579955, 4282066379, 498998655, 4123310742, 1801424182, 777808179, 655425670, 588715641, 2136252742, 1283378143, 639191135, 3132375783, 276649124, 2036776039, 3352396498, 3893441746, 3298373918, 1024178230, 2623051553, 1956117442, 2955394456, 
         2478945776, 3904945720, 769232312, 2168822980, 3715831945, 453874622, 3351529191, 3256151193, 808042625, 1700919462, 1008305347, 1518733915, 3194328753, 2228970756, 2604658038, 1376476152, 2147167203, 2585867511, 445717950, 3595016420, 3673970127, 3640614546, 494944945, 152508312, 4160926899, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 29
     {
         3225674336, 827428943, 2858523441, 2447266124, 1539223637, 2299756421, 776912458, 279091824, 1152725492, 3903457284, 3987010398, 3996115574, 839506039, 3052513014, 28550291, 2597814974, 2328446377, 1961600298, 3695276714, 1334932648, 1141381380, 3025370440, 997698792, 931473445, 3091440507, 
         820119215, 3586778616, 1993126242, 4252838072, 3033829531, 2120026924, 65722921, 746724958, 461423533, 1582298542, 1564918930, 3710935369, 419349792, 3914061713, 2279209938, 770031171, 2062767935, 3373230309, 3582372364, 2025682996, 3352859025, 1262632952, 3140021482, 501370035, 2554730117, 
@@ -1051,6 +1119,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         3037999504, 2857298788, 911046668, 1170775701, 2369720, 3364839261, 1462383461, 181600856, 1315241696, 2861043792, 3549404088, 3974245218, 4141518566, 1195336199, 2291064152, 3287203016, 3867432937, 2593766219, 2114273192, 3716228986, 410286941, 2497285113, 1338500439, 3748757692, 2315519304, 
         545570554, 1519868916, 679216320, 3264840479, 4083041163, 261878334, 2370312122, 1408058272, 1287635274, 3433241543, 3923613754, 2423502603, 3948993135, 1418484161, 230113502, 1766447938, 3101286974, 917358979, 2836128279, 2859079881, 3162688352, 2158281644, 154509481, 2409785274, 3096379437, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 30
     {
         2456954827, 2895978734, 1621803157, 230462381, 4046364119, 716597790, 2031510641, 2208319977, 1107910846, 3379950723, 3628284249, 1393263274, 3842378742, 768116962, 1782906996, 3022943801, 510040722, 2180373447, 1294989632, 1659724107, 953774117, 500296619, 2269873184, 3215368465, 3933601613, 
         2401810535, 3568992417, 617528376, 2437412983, 2921242388, 2311040363, 3695847323, 1609309841, 3222455492, 1108155620, 397599239, 3344183623, 1159383441, 81554651, 4223302962, 2812031899, 2613176831, 2967803832, 3560382993, 670173062, 2361031672, 1745444335, 2067906079, 3019908371, 2662226130, 
@@ -1085,6 +1155,8 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         639602991, 444779318, 2722002973, 3927985419, 1297446054, 298277450, 656022205, 134304205, 3847728042, 3339100423, 407022043, 1282443442, 3173884578, 1417906094, 2364502739, 2158353472, 2402775649, 1807696073, 2837535198, 705887737, 2129202688, 3853676283, 1388329793, 875153687, 2367465660, 
         2763058233, 2500632304, 2196920062, 491306883, 277753357, 3868415380, 324867643, 3654474955, 2569410351, 1128175417, 1853572398, 1133201743, 662085935, 2263514999, 3077768113, 3309730620, 3602394176, 3747458070, 188422725, 813812450, 1502276531, 3909138356, 2766044599, 3760928321, 573108836, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 31
     {
         1240264181, 1624064648, 3039823158, 2013985253, 1473300299, 2762062141, 3273470484, 1889745445, 2516996174, 3190376531, 996186898, 3893981177, 1268272590, 3226095713, 153038465, 2184871198, 3224094011, 2526518401, 1738960059, 1187560605, 4194384320, 2837011297, 3638232350, 367907454, 574009898, 
         1948901330, 60430044, 1569835584, 3160561697, 321792583, 3179087993, 1936928378, 412346905, 4020812489, 2603392174, 3499496781, 1499441233, 1062415256, 1347130973, 1823246794, 3411391800, 4253618056, 1507733072, 1605629518, 1503312494, 8035741, 4038904206, 2408545792, 969543501, 954847087, 
@@ -1119,9 +1191,10 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         4100978724, 2709958834, 574590507, 961767386, 21100886, 753746372, 4072632446, 733729367, 3060214669, 289165105, 426065754, 2036100240, 2172365757, 502856627, 84490194, 2630806596, 1206161269, 1009438449, 569581317, 1836947000, 3125379675, 1756936428, 3772694822, 3670337911, 3020603818, 
         2376224883, 2539951453, 2053395002, 3525193914, 1991480838, 3786481083, 873873707, 1693894743, 2450223985, 754878026, 1943356492, 401524329, 759931885, 611231307, 147950334, 599693701, 3358729722, 3649058074, 906423787, 1333804225, 875187278, 1115838692, 2476325972, 3307226674, 3539078918, 
     },
+#endif
 };
 
-static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+static const unsigned int h_xorwow_jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE] = {
     {
         0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0, 0, 0, 30, 0, 0, 0, 0, 60, 
         0, 0, 0, 0, 120, 0, 0, 0, 0, 240, 0, 0, 0, 0, 480, 0, 0, 0, 0, 960, 0, 0, 0, 0, 1920, 
@@ -1156,6 +1229,7 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         0, 0, 0, 4194304, 71303168, 0, 0, 0, 8388608, 142606336, 0, 0, 0, 16777216, 285212672, 0, 0, 0, 33554432, 570425344, 0, 0, 0, 67108864, 1140850688, 
         0, 0, 0, 134217728, 2281701376, 0, 0, 0, 268435456, 268435456, 0, 0, 0, 536870912, 536870912, 0, 0, 0, 1073741824, 1073741824, 0, 0, 0, 2147483648, 2147483648, 
     },
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 1
     {
         0, 3, 51, 771, 13107, 0, 6, 102, 1542, 26214, 0, 15, 255, 3855, 65535, 0, 30, 510, 7710, 131070, 0, 60, 1020, 15420, 262140, 
         0, 120, 2040, 30840, 524280, 0, 240, 4080, 61680, 1048560, 0, 480, 8160, 123360, 2097120, 0, 960, 16320, 246720, 4194240, 0, 1920, 32640, 493440, 8388480, 
@@ -1190,6 +1264,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         4194304, 71303168, 1077936128, 1145044992, 4194304, 8388608, 142606336, 2155872256, 2290089984, 8388608, 16777216, 285212672, 16777216, 285212672, 16777216, 33554432, 570425344, 33554432, 570425344, 33554432, 67108864, 1140850688, 67108864, 1140850688, 67108864, 
         134217728, 2281701376, 134217728, 2281701376, 134217728, 268435456, 268435456, 268435456, 268435456, 268435456, 536870912, 536870912, 536870912, 536870912, 536870912, 1073741824, 1073741824, 1073741824, 1073741824, 1073741824, 2147483648, 2147483648, 2147483648, 2147483648, 2147483648, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 2
     {
         85009117, 335741939, 1412632518, 386859243, 1741437244, 152139416, 403047142, 2556825231, 505087203, 4287193174, 335609039, 336528191, 1425998811, 456920088, 2832198590, 724748988, 3625845630, 1509824181, 3330088197, 2710488401, 1431742057, 1077674236, 1140592489, 2096905276, 3007294393, 
         2863484114, 1081606648, 1207443154, 972585080, 2793363314, 1432000919, 1089470704, 1341132452, 3019109363, 2362285522, 1790260014, 2178941408, 2682264904, 1743251430, 429603751, 359294556, 62915520, 1069562512, 3486502860, 859207501, 3939814584, 125831040, 2139125024, 2678038424, 1718415002, 
@@ -1224,6 +1300,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         4194304, 78643200, 1091829760, 2745630720, 4194304, 3229614080, 3378511872, 1109917696, 2270035968, 8388608, 1358954496, 1119879168, 1414529024, 513540096, 16777216, 2717908992, 2239758336, 2829058048, 1027080192, 33554432, 1140850688, 184549376, 1363148800, 2054160384, 3288334336, 
         2281701376, 369098752, 2726297600, 4108320768, 2281701376, 268435456, 738197504, 2231369728, 968884224, 3959422976, 536870912, 1476395008, 167772160, 3011510272, 3355443200, 1073741824, 2952790016, 335544320, 1728053248, 2147483648, 2147483648, 1610612736, 3892314112, 503316480, 0, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 3
     {
         1939838472, 1412147404, 166205219, 1757484276, 2905930693, 2345662040, 2845657161, 253454719, 2661974169, 303781080, 4075331504, 31014156, 244538930, 3752264221, 992575155, 219309525, 246620060, 215640989, 4125020723, 2016731730, 3236558869, 297169276, 3293566751, 1867504216, 210423272, 
         2531663658, 499723753, 1730625896, 189236880, 3388575408, 2433358422, 1368961148, 3134096848, 2827836415, 3888822753, 4172043647, 3379360748, 2651760955, 1345081091, 627692776, 189423917, 1927379456, 4004336944, 2995932065, 1882016234, 2551113616, 1576396048, 1299792730, 2151240795, 2154814108, 
@@ -1258,6 +1336,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         2089025605, 3050632421, 2428784965, 140658149, 4254138368, 1745354889, 711584249, 2746523017, 2551006457, 1100808192, 1494221073, 3422999489, 2696954129, 976716737, 2653421568, 3806331426, 3690047362, 1481392674, 3817015170, 2353004544, 286262340, 2300534532, 4206449732, 15339268, 2894069760, 
         488376456, 1489927688, 1196583048, 652746248, 2214592512, 69904, 1006205200, 2322628880, 1229515024, 2617245696, 3423527456, 1964953120, 4260938272, 386199072, 1744830464, 1342444608, 1069330496, 2138592320, 3185897536, 1073741824, 1342493824, 3780942976, 1771066496, 2189433984, 2147483648, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 4
     {
         1804684571, 2106089606, 1533056158, 2870216110, 3618155659, 3789871366, 4246691682, 3667072763, 1212241769, 3152390668, 2973497449, 2958641966, 2088805328, 717518631, 2401090860, 3606967204, 952637656, 59827581, 1291486682, 1499453515, 2053994857, 563998083, 4094000396, 1163546899, 1003843565, 
         654565639, 1070907026, 4217851863, 426034251, 1721352737, 278404469, 3899800390, 1063362170, 1162348262, 3153545093, 3249996223, 186674553, 2616406148, 3137968354, 1282784965, 1495068058, 3033760361, 2278144523, 3192245769, 719586342, 2602548287, 3386583150, 355354345, 3252815848, 2178056037, 
@@ -1292,6 +1372,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         4255789547, 2682856590, 12563128, 1397542366, 237149400, 2233707508, 3875573245, 2097374144, 175320773, 4103445984, 4089284323, 3610168130, 3084915964, 680145366, 2571684685, 1132894909, 104640024, 193765521, 2338202907, 895271448, 11499099, 1798066417, 1297412626, 2511347162, 3140535007, 
         2129963538, 700683199, 2609700278, 2953463279, 2290844145, 1871316353, 3993801787, 2219413182, 2954453701, 231283580, 1375331115, 207723994, 1799562537, 2056553564, 2513609799, 3542459627, 3173012714, 3923404932, 217877755, 2095124912, 192024370, 1168134987, 1889598668, 3014873069, 2033573343, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 5
     {
         3465348660, 3623545008, 3505902593, 838034830, 1338018789, 2595329276, 3367746385, 3197935201, 1439351946, 3585085571, 4165798087, 3634792639, 2359485974, 2772582925, 1110186203, 3771562484, 1508694157, 1564641206, 2801985736, 2446107936, 3849126897, 1842973671, 944408104, 2624631280, 2729080685, 
         3737368614, 858809173, 2289802345, 2428186575, 3114742765, 716011303, 3443810690, 814132610, 517432787, 614445393, 2930433345, 291178098, 2117644502, 2749446703, 311745701, 365684723, 1705418876, 2213749318, 4011417220, 1842575651, 988348831, 94258998, 2771150272, 498058526, 1344827813, 
@@ -1326,6 +1408,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3594351577, 3068232274, 3771730346, 4110519574, 3534704897, 2375277865, 3597780202, 3472676002, 1350276449, 3218248239, 3589255283, 3253132633, 1769885529, 3792812294, 120332643, 1219374788, 3608889019, 2386099811, 858495304, 1284785543, 331370962, 2259419662, 2519864134, 3194739432, 2669074511, 
         2565559140, 3378072004, 2647801475, 265068954, 1464416963, 1232787612, 4160089759, 2510685972, 670300081, 2509357766, 1981891975, 4161588397, 1371924626, 44760868, 634955171, 1187096933, 3324788972, 3576888559, 2801347752, 3730298395, 1702170762, 4206083415, 741409141, 3649731355, 1025429529, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 6
     {
         91444490, 628576944, 4069219862, 2253058925, 492354082, 1191182242, 1565180119, 2257613723, 456055162, 605712223, 953365104, 3104638527, 1133984729, 2662828416, 2134948274, 1921384447, 843719355, 588432962, 1734575434, 2924140067, 483396548, 3848838894, 3155476556, 1760928304, 4168059840, 
         3279827269, 2644461735, 4168565656, 3951563569, 1276805504, 1708974143, 1878547888, 3465220024, 3062086782, 2801401651, 1510428126, 716404149, 1646021208, 3534932385, 1186585561, 651997355, 282914223, 352224857, 3764407517, 1059868753, 1971798134, 978904005, 976413661, 4039544152, 498989693, 
@@ -1360,6 +1444,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         815689760, 1710961092, 2775607076, 2175058103, 3252688367, 2936890483, 2746319120, 2736754, 1646031035, 2448701214, 2886833213, 3689830606, 3292798106, 300773646, 3125160783, 1247453205, 2746275624, 4011063775, 904135764, 876847374, 366267234, 2541269205, 131376648, 1805948133, 3383589530, 
         2350119829, 2513170439, 4096158499, 4229211520, 2992048272, 1338522080, 1187391335, 2898563453, 2163088451, 1417971677, 2047421551, 902282791, 1143943232, 3568431811, 4059861993, 193362198, 2509297125, 3968551582, 2175686117, 3568936881, 1853177468, 2134063169, 2919389416, 1124914545, 1209806738, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 7
     {
         1199972651, 1035834631, 3177798370, 860834162, 3741677748, 3780327829, 1693730265, 1643429511, 559568669, 2758650294, 647308222, 3901603996, 1778653821, 3618523672, 2154201067, 4261179460, 3285764480, 3334002738, 3215795953, 91368462, 1883994950, 1506873376, 1527780962, 4046354597, 4081676034, 
         2389066602, 1574939945, 427845396, 2714836263, 1259019491, 2493238133, 2584034689, 3151382431, 2171033919, 176883719, 2031844862, 1272380790, 1298975901, 4087222847, 1524000054, 311436877, 3627785554, 1889491722, 2938069193, 2771940687, 2756955968, 4289348777, 263514583, 887207028, 3522902525, 
@@ -1394,6 +1480,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         137171998, 3239159214, 2258610918, 426724741, 3502660993, 135977383, 429929363, 3984458137, 964026748, 2182019070, 3836562946, 515026869, 359030455, 1301694917, 2300414803, 2364654981, 3804876710, 171119249, 2646785698, 4283509387, 3628087763, 1748227044, 3037141234, 3000413256, 23007314, 
         3598880509, 4160517314, 112205578, 1677675411, 734881643, 2830770338, 3470317145, 3306806569, 2635040943, 2671367560, 3528996498, 3878886478, 3114253828, 2721384408, 3175226991, 1393767271, 2651623266, 3767978376, 1269699398, 1100964192, 4169085845, 2086718107, 1286251099, 764751784, 3006878591, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 8
     {
         2565473087, 1149521056, 3529037691, 630435548, 73598765, 1467331930, 3988027050, 2771962200, 91261543, 980989218, 2227515435, 236831608, 2872772569, 2330469327, 1654035853, 2883791516, 4170143763, 126418114, 127789935, 2114249438, 2933346767, 639483386, 1532399845, 2182422151, 741069317, 
         2376371063, 3398508789, 3828295651, 3963199356, 4156483769, 4206759111, 1266176088, 3210273687, 432131993, 667709537, 874477513, 2304714957, 629309008, 116453438, 3051811727, 3490241985, 3355968243, 2304043871, 2724990029, 1095724699, 2408437363, 1433161037, 3245468546, 2494529842, 4204170637, 
@@ -1428,6 +1516,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1234485739, 869158554, 245101118, 1724974650, 3851803199, 922411232, 3046280696, 3284392523, 3528264590, 2802364078, 381450957, 1741009694, 4222244451, 102929888, 1668474417, 3881791214, 1429483134, 1938365051, 1023690708, 3333855520, 3238705869, 2602245525, 3059586169, 720438965, 2120786297, 
         453980990, 1048501876, 4060576583, 3537810796, 3892882814, 691572481, 3899584121, 1582529013, 3260326865, 2358704826, 1607030801, 1035900449, 3442507859, 1406737127, 249758705, 1535363329, 893329207, 51912312, 3440532856, 3736385218, 295452658, 2379709553, 1647382020, 2363679860, 2998779887, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 9
     {
         4209102573, 2387104994, 1221484586, 1726143957, 3263877318, 3362559187, 282442925, 2418524976, 3196072648, 3174695999, 2072047145, 2985823503, 2132951745, 2298545297, 2495977670, 1397656146, 2086257884, 3834366725, 3862532368, 3583329522, 1543996818, 2192688115, 3081427696, 2656520743, 8772004, 
         2476324234, 3600148050, 1168683794, 3219143568, 108768238, 1339513738, 447593731, 2742877256, 2488536667, 4189834432, 808657962, 2422880287, 390864786, 3381554683, 760628048, 353395922, 3577556262, 2482413928, 507756643, 839344953, 3505184848, 3945044582, 2414915836, 2313624497, 1832728088, 
@@ -1462,6 +1552,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1763262792, 2706181276, 538294991, 353565565, 18133995, 1719731406, 3311085516, 2018821960, 300367686, 2628312935, 1151449661, 2178805970, 3288321196, 535051857, 1623270973, 2761151808, 2701048972, 317681607, 2281427601, 719748170, 351452298, 2191958596, 4000232015, 335837771, 4158081521, 
         3779404077, 1998444133, 3849605095, 1532231791, 2930266419, 4203951289, 748423654, 1993082867, 451159852, 488781053, 2438982775, 2222815270, 543209242, 1241562465, 2868868009, 4201052877, 2438841764, 2151708682, 2426958921, 1520654642, 1990098337, 1070792755, 2308394635, 1442389785, 705615044, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 10
     {
         973368008, 1221885324, 2086331970, 2323744198, 280145759, 1795442656, 2984366093, 3532172763, 323888669, 851950179, 4198638255, 899943985, 4087912561, 2935341503, 1443752852, 3991058999, 3547259355, 35779889, 1076308344, 4075444807, 186174448, 3542284780, 660388677, 2777400132, 1092226205, 
         2418702276, 1307933032, 1940510003, 1932005362, 4016036211, 387339882, 2969593895, 3453134349, 1382709098, 1795814140, 1588159469, 1216733801, 2227378121, 2063027627, 582454582, 3364657275, 3466973302, 484564303, 1489261596, 2270291560, 2008178784, 2284268924, 2229317366, 644797709, 1213921542, 
@@ -1496,6 +1588,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1105681409, 4033144425, 4017983282, 1670425353, 4040882785, 1780687273, 1405678015, 3076115981, 2713472488, 286336494, 3664225263, 502759060, 777620620, 635590826, 132236203, 1866406173, 1235046453, 2859554298, 121814656, 944976320, 1946494170, 2548097575, 415384946, 3934685646, 1507032178, 
         1383654007, 2906269630, 566005756, 3118733139, 2969075870, 1834096359, 3263358416, 1322979710, 904583023, 3582075094, 2298898632, 2491891941, 660351763, 2548592542, 3009200751, 2116595110, 2623212287, 4167133624, 196759529, 3038645579, 1769704552, 1713233322, 2127497999, 3849458221, 3769872265, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 11
     {
         51082211, 3347503176, 3221768777, 2986163981, 3937460013, 1716372908, 4132024211, 3035957293, 1791036224, 4214815056, 1645540011, 2629793790, 3185505897, 1855718954, 495459467, 1728339314, 2318396341, 3396602050, 3273624616, 2625973148, 1762905939, 1706358553, 1088424264, 2764318930, 1026127380, 
         1128004134, 2724553694, 41981087, 2304966004, 1342745986, 3425554050, 3537673465, 752263676, 280905885, 929399589, 4090689526, 2141254732, 1469491656, 2593100469, 1096008340, 3316809312, 1698245188, 1656427920, 3081873338, 1750515301, 3850483440, 4081834419, 1225164947, 1244139942, 1972663124, 
@@ -1530,6 +1624,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         884423945, 928407281, 4173634172, 1492070114, 2706943441, 1365883971, 3076484301, 744370087, 4004118884, 2199449568, 879458863, 3197725005, 3590586547, 59693002, 3614114662, 1499386564, 2914582708, 3751842429, 947438603, 1986129491, 3747112289, 833777768, 2231649410, 1841607849, 3526253103, 
         3797105813, 1291185911, 3188408549, 3311027691, 3983681758, 2246511800, 1271525377, 2996265908, 2396071405, 902427181, 164636454, 2459631341, 635349368, 463309029, 1409367654, 849052250, 3221786769, 2310288531, 2919204855, 1263130532, 1215722704, 3497322658, 2840687222, 2185004161, 1507335864, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 12
     {
         2052557448, 2879065999, 22933757, 2160014758, 3736092460, 3556641619, 1350613766, 2107757927, 309323868, 3452852627, 3424626316, 545651740, 1935764720, 2349926457, 3546577033, 862046434, 167198649, 338290297, 1145807303, 1571276102, 883549156, 907871968, 638566313, 678764227, 3795356864, 
         3306095271, 1452688488, 621126888, 1838613968, 2054107827, 1785040579, 454879400, 1952849106, 1907701866, 1639495252, 1623968604, 2997422000, 2633878652, 1036670775, 2191465943, 3053533585, 1654709920, 1950620393, 4177745509, 1742007818, 2888573892, 2825965566, 1399790365, 1307674482, 310692416, 
@@ -1564,6 +1660,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         2469678938, 2885597732, 2715483555, 3566904604, 462585182, 1922457093, 3035264235, 2866504077, 2031456720, 1598555964, 2569915450, 3947972758, 290683210, 2465427488, 3504862176, 793156806, 1722326752, 2706215067, 3818976191, 2007064241, 552144413, 2692866408, 3975075075, 4293828741, 1123460373, 
         960845744, 1855626484, 1876934434, 1343778249, 912185207, 127278206, 4168930635, 340393978, 65814528, 2552086271, 2507474816, 1240220220, 1761964455, 2204917500, 4088965101, 1079310398, 3071460742, 2188549805, 1064733776, 4191719087, 3221046115, 3772395288, 883516842, 2077853840, 229484673, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 13
     {
         448889887, 3508620909, 4164289950, 155254859, 298319697, 980080883, 3500794888, 3974907245, 682778656, 382798811, 1500342771, 3942535492, 1039809505, 2126581011, 561192171, 4046277638, 840733718, 1694555864, 241216466, 4182349979, 2525929010, 386794637, 349755829, 2959959729, 686974318, 
         3243688353, 3911051908, 3917458620, 441833800, 3164548257, 584185450, 450132281, 3528356519, 4275666503, 1317069624, 817077137, 2945430988, 1532878265, 2542155552, 3348614029, 1419611574, 1245233100, 1981161828, 1161647342, 2781439556, 3896025436, 2349200248, 1213899699, 860301545, 1590934964, 
@@ -1598,6 +1696,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1815949694, 272696290, 1495465483, 3102030383, 3546078241, 3272619595, 759699322, 1161486824, 1146281812, 4194130649, 3936306436, 4077338125, 2127551216, 2995077453, 209698652, 3836657987, 1782152220, 1642490089, 3695579542, 537862234, 1696168156, 4022607, 3642864269, 54404878, 2925910542, 
         3444042482, 1931288691, 2269375687, 614870298, 1139082272, 3672546472, 3255845763, 2987873616, 3436501734, 380553853, 750118352, 750708138, 488564982, 2936846643, 3460652101, 3085496886, 3734224010, 523359404, 2751912206, 3302219188, 2729509827, 1995554251, 2288103059, 3289667468, 2860301591, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 14
     {
         3481653941, 2111903071, 3569014882, 1149634763, 4206972571, 2948781360, 2576820949, 2587099571, 3987042644, 4255777336, 2829594348, 3832744490, 3554499754, 787920018, 695635693, 2746034685, 2078139227, 1144320548, 4020978225, 449503505, 3004993826, 2045843139, 1604631401, 148449881, 457819243, 
         4089112489, 1713441237, 1790909556, 3334464951, 3070008305, 811825474, 4089105370, 708239097, 1494832299, 2074902973, 468898217, 1722559700, 2499754488, 2267939270, 650114709, 549502184, 4040463514, 4228169080, 4094284819, 1599334548, 2992525399, 2107053637, 197348940, 1669884894, 3982326753, 
@@ -1632,6 +1732,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3085839620, 3184266772, 2359972463, 862934481, 3624479194, 3574284465, 2700143837, 2468083868, 3798800988, 4116964911, 1832002264, 4276154871, 3256889524, 4036954281, 697729046, 886223984, 2196986730, 1157617208, 1995907944, 398452318, 3523714364, 613570866, 2962430983, 1408814780, 892117129, 
         4173164219, 3894076479, 2721348430, 555734931, 1869034419, 336114876, 3142554871, 3349604636, 3450290892, 955122895, 2202902910, 2558366468, 1701182712, 283197682, 1865942385, 2027648778, 2285857699, 880475184, 958651279, 169534250, 3842420528, 1568559789, 2986618464, 2568345525, 3081082692, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 15
     {
         575494427, 2773243709, 4009191487, 3877909663, 2252044261, 1328043370, 1407136778, 3204434425, 3881653592, 1481049819, 2939203697, 889352935, 628666312, 165199023, 2949092155, 1116804589, 998930334, 4144153491, 4191022348, 9022505, 4033326555, 2329569601, 824756145, 3501916851, 1481410328, 
         1970954319, 4022176157, 2356841052, 3783173734, 3649102345, 3205430658, 1460938436, 280282398, 3262135457, 4055383786, 28522973, 1100901182, 4048609665, 994490185, 2888527367, 3591919750, 65093467, 399797207, 3377740861, 3103183487, 3696509979, 866353724, 3847992271, 2821933890, 1491144079, 
@@ -1666,6 +1768,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         2656602623, 2037214047, 323260312, 3310408133, 4037617529, 137297627, 1236501991, 495817051, 481150309, 3067841968, 3120347176, 714354848, 1554632062, 2522324107, 4274051212, 2180914534, 1261686356, 3569290041, 1801431819, 4286755560, 2749452442, 829235089, 2243153325, 2525168177, 1486881882, 
         585653228, 3288336688, 2734161045, 30430534, 714492313, 2582732426, 595577790, 1463554287, 1949506865, 4210942156, 2008105540, 4055753132, 2530320603, 319064177, 2305067982, 3825716413, 1543867515, 108979478, 3089716545, 2921391708, 2403595525, 3783697766, 2313991047, 3302598706, 1318323763, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 16
     {
         1470380360, 3057428612, 2756676297, 1633786556, 4246459918, 2557524017, 1857180133, 618903690, 2475611092, 2621430634, 2084292404, 1698607774, 1788956972, 3375072220, 1499167056, 1218814632, 3699503479, 588281768, 3603925285, 1187721841, 1307962320, 2562217840, 3882506958, 2387033730, 2097027049, 
         1593669125, 1899433035, 4039983902, 1546854551, 1073191673, 3368453769, 3074694838, 534637095, 1860006723, 3416402670, 802354899, 3998709605, 3944315555, 3454226397, 1648185195, 488532673, 3063734121, 1318974867, 187087202, 200160693, 4170479404, 782764886, 4007973657, 1651636372, 3084151528, 
@@ -1700,6 +1804,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         533997731, 3919796086, 662975152, 864661066, 1070894403, 1020445801, 1511298602, 4221508348, 3577952702, 4122306502, 2012051572, 1616168260, 2456901413, 2717726537, 840264605, 2687215223, 2174960097, 1239122603, 2890231920, 3365350767, 3998868598, 563137220, 893868530, 3400632172, 1538627830, 
         2812510298, 496662288, 2317289974, 2252393722, 1221289032, 2418100559, 402670890, 1528570045, 3160531718, 1806492066, 3211663975, 3617025598, 3664580463, 1338638297, 341637330, 2097019728, 4031221207, 503636424, 3883416740, 1530237682, 1152125396, 2845384901, 332460372, 457364876, 1738239808, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 17
     {
         1118787884, 1884590246, 1007052798, 3717680750, 1609263052, 2486654530, 2761168910, 163554565, 3928803020, 2632714628, 1386788970, 2621928183, 2855206157, 2989018213, 1836814260, 4197635108, 1030118238, 2789863793, 2063944689, 1647608366, 255485979, 3657534664, 1317185871, 2410074449, 3971156607, 
         907575923, 4132859581, 416269582, 877554291, 633895348, 2236014545, 992386759, 3971362318, 2173597771, 1673339632, 1371742490, 2033574313, 3809530180, 319182848, 1562235776, 463522324, 1482338913, 1816432405, 3278626272, 1335179249, 171265751, 2249118654, 1153849045, 3013179633, 1450352108, 
@@ -1734,6 +1840,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1318010299, 3950178561, 1078499199, 1176289535, 3875152821, 1984420952, 1134199826, 2944539174, 3667625203, 2034152216, 1648355307, 2376447620, 2967418253, 185143450, 889002925, 3999315013, 661455858, 4026799358, 3626504428, 3544795311, 3642718771, 2467387138, 1034249749, 2051371333, 4251353248, 
         1575036366, 751400924, 2906720214, 1210002606, 916508568, 1728487600, 2478884914, 3081526615, 1867135009, 1955998382, 701713417, 512784398, 1255240210, 3665676113, 1771754697, 4000392442, 3342268855, 2677221913, 369054145, 4011912082, 748537647, 1626721797, 852497405, 168721778, 3091138383, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 18
     {
         3781228998, 1787582256, 838267218, 2710632450, 690892139, 2484870604, 4151302318, 1844787776, 727768263, 1075391038, 1842903369, 2927332301, 3246688068, 1234715005, 2906526190, 3369636401, 3091858538, 3320767682, 920496809, 1406803705, 3163880457, 1540551653, 2733620168, 2588558057, 147277542, 
         803170440, 821275940, 3897549272, 151390608, 951639139, 904639695, 1106545578, 1514893712, 998760135, 2557458623, 4109877399, 578824730, 2174064027, 3352513900, 3206168298, 911932439, 2030004973, 3283902592, 3755877921, 250434692, 352122318, 977153640, 642640734, 2555395772, 2307695537, 
@@ -1768,6 +1876,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1891106916, 416443047, 3298583974, 1030877276, 2839390034, 4181398645, 1845333999, 3643365079, 1993116780, 1763857175, 1951718545, 3785659537, 4156412284, 4138026128, 3480291142, 54280556, 4169041146, 3130638398, 3236816184, 3559898998, 916420843, 938920758, 3425021599, 1528477728, 3597939783, 
         3516249439, 936528538, 4174817780, 2541489033, 3962368135, 2054336507, 2610093970, 3613025255, 3583905994, 2990129491, 332823408, 2505138276, 3811707598, 373987627, 4263703898, 1668946560, 3213253899, 2673819338, 1631405099, 3127443274, 549232331, 21447814, 1647238011, 3093799993, 1922712395, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 19
     {
         4224788259, 3569487556, 1080137041, 2788623569, 856160888, 2195536417, 3030463035, 2906439247, 896055051, 1967105456, 2093562169, 2919742950, 546374698, 1372591815, 3773616637, 349073007, 1331102855, 3035367896, 1222622311, 2266618592, 74466398, 1140488004, 855606859, 3803728487, 3589743162, 
         2748402856, 1044387368, 1494850922, 2242660891, 3111566003, 2013737074, 163276737, 1526772858, 3047139947, 3150695453, 2583795468, 3628272447, 305282258, 2151108134, 2905708853, 1052800761, 3354632338, 1017036861, 2453680791, 2673902555, 1622154585, 2893733051, 3888482522, 306284440, 3245137245, 
@@ -1802,6 +1912,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         123465626, 844518179, 1161486362, 2706162053, 2966530827, 4103639053, 1837121393, 909648429, 298619078, 2057042454, 3613272637, 3609349032, 1664428748, 1871510359, 58508710, 1079418100, 3278870121, 3821562746, 16654909, 2530580589, 3361874982, 629910009, 2124761646, 2508133604, 1954315500, 
         3019833617, 141617625, 1653192078, 1541695589, 1223978475, 3875963510, 3028691587, 3450826564, 2185849120, 1956475624, 3053842172, 3550887830, 2672339803, 176823785, 913229929, 681399502, 2256486297, 2881672598, 597153273, 2782767695, 1133158067, 4126077325, 3456027404, 754062201, 4069172986, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 20
     {
         2441935114, 3465447683, 2897229686, 3845380309, 1199633364, 495424232, 2490548037, 581670528, 2467171733, 2200094863, 2163927790, 3895792830, 2097210789, 1606544633, 1305562517, 4072525389, 3256142090, 349440478, 3920932491, 2462464051, 1075951496, 2835763703, 1593198055, 2380945625, 543531323, 
         3182766507, 2927484354, 2877470578, 4153923603, 2443156156, 1168544900, 888955615, 3605412824, 1336677864, 3256116974, 2884036014, 4070749843, 2989661773, 1095584023, 1370834065, 3534389580, 312378113, 3190819203, 1247574926, 2046019470, 3536918510, 1479030180, 847820646, 3992973956, 3827223401, 
@@ -1836,6 +1948,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3950270431, 2663319810, 3873120593, 2080989388, 2896532502, 3176181708, 1736685126, 4081767288, 3515770288, 1371473598, 1491850178, 4284949727, 2774513541, 1541596000, 3948112869, 2114538326, 2641532252, 1837244955, 2292505300, 3179787565, 639953781, 785902378, 3852544833, 553508260, 23014564, 
         106722100, 2705412979, 3449440367, 950636401, 870804158, 629831074, 424163855, 373653940, 2739378330, 377730945, 418426029, 267367218, 554678849, 4222664331, 3346048120, 1870226737, 2435616108, 3747040233, 698046507, 1671346285, 4127293033, 568612264, 3467142937, 1627988025, 1305525598, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 21
     {
         2246605826, 215030128, 871645668, 3402612852, 423273439, 316965236, 47416561, 1470716454, 2288582385, 2021890755, 2148091363, 167227868, 3085506034, 3365950545, 1170282137, 1345986409, 197195155, 2644113318, 2491271090, 2597072003, 170335901, 2540851884, 2584420407, 3609142920, 3052130502, 
         4018095157, 2850805299, 2777821400, 110647395, 3262987676, 1447103309, 3632575579, 3243210595, 1892770504, 4214485953, 38676169, 2431628817, 2836918800, 272023527, 2825888902, 2794421955, 2354379386, 452404203, 584718212, 1915053836, 1455821656, 4264066935, 1150980581, 3792433350, 3104909316, 
@@ -1870,6 +1984,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         1275942292, 2687807236, 538129710, 3337005391, 3941968393, 1113153386, 3813628384, 1775835369, 296314749, 1697642748, 3614403315, 1953056095, 2102878063, 3161706344, 2207159580, 3078233525, 3836286614, 886914072, 1884037075, 4135819784, 1616380780, 1672616998, 3879848699, 2277472209, 3933249848, 
         2428044648, 2876076879, 165724720, 2277165385, 1984963196, 1456923194, 2406217222, 3388886718, 47522558, 1903557801, 1959641458, 2325355446, 3251147398, 2266553941, 2243962024, 1420017618, 1791159474, 1793406225, 601509698, 3207357979, 1189285184, 148538800, 2077251302, 3267239327, 2851475997, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 22
     {
         2628162153, 3861478870, 2769884494, 3423483820, 1118276924, 536776894, 3742490940, 550084334, 2441329856, 2604618499, 2308745810, 1178166365, 1345165241, 4039508109, 1246601384, 3843182157, 2200144237, 91750284, 4290064840, 3363597477, 3243492274, 4271100308, 4186328336, 2291901989, 1834723222, 
         372220743, 2190417067, 2624886324, 3567647862, 1591175369, 2278087682, 2461678432, 232820452, 2714694382, 3070258434, 2412655444, 2667664607, 249083056, 4166379751, 1360927521, 2247816079, 3253689753, 1563674427, 1914999382, 2101454952, 1067816947, 1098201917, 4054175236, 1805828534, 1815913104, 
@@ -1904,6 +2020,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         2065938273, 3277412030, 122636766, 2164055077, 1000638739, 2044933533, 2935604716, 2772787255, 3727331409, 1315627932, 2610657438, 832931652, 452359900, 681035792, 3312648046, 1059435047, 1489639114, 3647631796, 417952902, 731020350, 2847472725, 2779076784, 2674295324, 487600023, 2925909449, 
         3997011591, 3697231318, 967300591, 2310856069, 684710043, 811911286, 4174732177, 1010656728, 702780279, 920081774, 1578296057, 944734808, 2884038169, 2885919611, 2633474915, 2508946673, 3579216621, 656143887, 426108406, 2166202683, 991797657, 706498590, 561168186, 1144619335, 3136206425, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 23
     {
         3600072515, 651444872, 2348224675, 1684848433, 1913333701, 3413467790, 1567802204, 2125206188, 2463158656, 2251055204, 4132590383, 3192977084, 3718261822, 3431519430, 3506690867, 1313208797, 637811069, 12802085, 3456408080, 166617386, 1764224523, 4016338923, 2225367442, 2461647273, 3137989854, 
         373730087, 3013524828, 242949418, 3443491410, 3671816408, 2391000148, 3964107377, 716535366, 1884597979, 3917515811, 3441985401, 2472173593, 4034695117, 2486526143, 1658764329, 1873516415, 884116165, 814992460, 1069506245, 3797556389, 838088473, 2279863068, 1002637017, 4174541774, 644478743, 
@@ -1938,6 +2056,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3116222066, 1801867255, 2738500841, 1452697246, 733457482, 1680421668, 1035766144, 468847991, 3606474156, 2612692123, 730556693, 859096521, 4005878655, 1138273887, 2182363629, 2710579590, 3345140092, 2562710857, 3859276724, 2318176233, 3964665794, 3295219265, 3037789445, 371545704, 3434130670, 
         3686032092, 19964088, 340386179, 2147090894, 1446742483, 3083526520, 561888846, 2903328518, 1524465288, 360120037, 2031515996, 1516035872, 2752848969, 1094251072, 984159948, 369999653, 864602622, 2402584241, 3028363830, 252580667, 480470405, 3201548259, 2739036185, 2198549891, 1978812013, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 24
     {
         2546657140, 2771792972, 3371698159, 1137313111, 2399264952, 1204642544, 2090179262, 2948712987, 2908027331, 498636511, 2292804841, 1480836858, 2826016727, 196495965, 2168559184, 3910150715, 320076735, 3144753899, 3199094529, 1165806050, 728308199, 2322528104, 2891334400, 561853019, 4161870615, 
         1348321971, 2461357166, 1216229488, 1392766290, 3060494848, 3282469664, 1866493654, 2351421557, 4195620347, 1512242723, 478174598, 1087303780, 471631659, 2599553643, 791527994, 563537164, 1238109907, 3218421602, 133222502, 4182363220, 305688802, 2666439314, 2408520958, 787389550, 4226450542, 
@@ -1972,6 +2092,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3466154373, 3988139604, 1079368270, 991305574, 898158502, 2898908951, 651161128, 1952607949, 1221528540, 29979722, 3006846808, 2911550178, 2569412437, 1460616937, 2127921978, 3689931108, 950505297, 3469337654, 3180457017, 2316433735, 1464678429, 2867173456, 391248106, 3622065314, 2143251073, 
         860219584, 323835636, 340886643, 1805485977, 109344001, 1537119779, 1795626099, 2568079633, 3048040562, 1204069532, 2488753091, 2160014198, 3132782711, 1266102795, 91252225, 2018366053, 39675212, 979320891, 343397131, 814470367, 366655857, 3287033048, 3379301026, 1566381433, 3431153818, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 25
     {
         2234324389, 1682296894, 3526681456, 3988544681, 1315506584, 1754723911, 3607564438, 3764062195, 3408328234, 2385116969, 3827569659, 4104590721, 2612634189, 1762747544, 1676800931, 1814546108, 2684685172, 1659194343, 3381624140, 2286640580, 688245437, 2593335056, 1657668516, 1161309746, 3390664973, 
         2460564382, 2811435329, 2169200311, 2768093584, 4288309691, 1341061221, 1361417084, 3060155336, 2526021346, 1037055386, 890124736, 2185462193, 765141735, 1841745804, 3562499272, 1437907207, 2127475991, 2845453063, 4007976206, 4160093314, 2717704308, 4193767498, 1667876711, 3477753188, 3150367681, 
@@ -2006,6 +2128,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         2364069707, 2361723426, 738500028, 1401903990, 1543704261, 2442916222, 1076190609, 1882477803, 740024557, 1591015439, 2730909167, 2723330839, 1637373491, 3777799860, 2921269571, 3698591972, 3997463570, 3877862147, 1912888417, 3365137165, 3465700492, 771243134, 4037723169, 1715894739, 1025821874, 
         1924958945, 3382242859, 121591031, 483980724, 546523388, 2446882279, 856267778, 578739009, 2978085488, 480884914, 966764808, 457039953, 3817520708, 1113646451, 2503896910, 3507840816, 717151671, 4149352573, 1568869830, 395015863, 773165995, 1853682362, 2861368846, 1884368812, 1250092101, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 26
     {
         916910638, 961623451, 1193013401, 1016438484, 4091279871, 287282633, 8590725, 3575333670, 324340905, 3133751747, 2840894649, 2980503178, 1111215768, 2783846375, 72516413, 4158424384, 2184094569, 2305724254, 4057093054, 1407652993, 3105191537, 768505376, 298782270, 993926164, 2694730042, 
         1479658113, 2376490281, 2767906402, 1619969256, 3256472015, 2563843533, 2974784738, 2529307107, 4289918826, 3105587575, 3748950898, 2182744253, 431888679, 3780324902, 2525978209, 54545903, 1688749940, 2394884334, 3477656171, 263834270, 1562965459, 804704330, 4185729868, 138898835, 2113063150, 
@@ -2040,6 +2164,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         6448083, 1093882965, 2867500469, 3626379157, 1849073068, 897616501, 604221668, 1020676159, 4083635798, 1716022041, 3671877965, 1738820843, 30077467, 729231767, 3413193248, 207000406, 3854363185, 3302747326, 3293643267, 2101250157, 460131091, 4159442595, 1133391045, 1031215443, 4195487944, 
         45931575, 2922629291, 789302543, 3024994662, 442525623, 2850119076, 838309503, 2585361734, 1020449164, 1623631007, 955374631, 2932467671, 3713639221, 3019179416, 977970472, 1817244230, 3856774853, 1140530868, 886199600, 1218509766, 4001537244, 2840913665, 2133254364, 3332344608, 475291624, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 27
     {
         1854921599, 2655519695, 3124573588, 319882484, 603545603, 4175512633, 141286453, 1183670252, 1789500145, 37351733, 3190829323, 2782782009, 493805446, 1228958246, 2672482554, 2274981421, 2935438833, 3625733677, 3679506394, 687805550, 134516308, 3576789728, 965007022, 1056542222, 2319405423, 
         3944221200, 950102624, 3848192810, 3205299696, 82033760, 1241913280, 1360146137, 1675732327, 2164452797, 3920498715, 2226452641, 3172047212, 1569171738, 2631589480, 2889660225, 2030783667, 2237381973, 2706217212, 3143638386, 1733174225, 1166820137, 3818389960, 193959252, 2793509934, 316291605, 
@@ -2074,6 +2200,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         773351497, 1878220007, 3097009802, 1252607159, 1378821846, 2741884614, 178612659, 3656860395, 1259606652, 3942111545, 488406826, 3640897405, 3419000480, 353909713, 2996208477, 2862593073, 108483327, 648472258, 1060249632, 1049865483, 430087518, 1364157854, 3367631180, 251313827, 2374149836, 
         2109357086, 479172068, 464775113, 1806677787, 3488082411, 356035738, 3080424395, 4134646749, 369528743, 1031004516, 2525336414, 4189798138, 3928909462, 568714397, 1681832820, 1753328641, 827357673, 1651960551, 1798317455, 737101952, 3257553606, 400882781, 1473208110, 4134183873, 2193420912, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 28
     {
         2483976489, 2790651795, 3298324523, 3508205426, 2236819708, 917494217, 769620837, 3411018785, 2391335000, 1627061280, 3356773416, 1288706527, 4178910717, 3636299534, 4221874052, 3674654381, 537787012, 4271656840, 185820273, 1160533598, 1862365049, 2550353307, 1392072847, 1870891365, 1517453821, 
         524666025, 3645751565, 2415020247, 3691419894, 2580450642, 2130267479, 3636103610, 562446539, 750696587, 97137475, 3894066051, 2239638596, 3256181120, 3981041836, 774947039, 451287677, 3618957054, 4236303539, 1027744929, 1497195372, 498574915, 2164122779, 582902291, 3040883311, 1626221455, 
@@ -2108,6 +2236,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         353688341, 145655006, 1972100601, 1456042517, 3767579955, 4282066379, 498998655, 4123310742, 1801424182, 777808179, 655425670, 588715641, 2136252742, 1283378143, 639191135, 3132375783, 276649124, 2036776039, 3352396498, 3893441746, 3298373918, 1024178230, 2623051553, 1956117442, 2955394456, 
         2478945776, 3904945720, 769232312, 2168822980, 3715831945, 453874622, 3351529191, 3256151193, 808042625, 1700919462, 1008305347, 1518733915, 3194328753, 2228970756, 2604658038, 1376476152, 2147167203, 2585867511, 445717950, 3595016420, 3673970127, 3640614546, 494944945, 152508312, 4160926899, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 29
     {
         3225674336, 827428943, 2858523441, 2447266124, 1539223637, 2299756421, 776912458, 279091824, 1152725492, 3903457284, 3987010398, 3996115574, 839506039, 3052513014, 28550291, 2597814974, 2328446377, 1961600298, 3695276714, 1334932648, 1141381380, 3025370440, 997698792, 931473445, 3091440507, 
         820119215, 3586778616, 1993126242, 4252838072, 3033829531, 2120026924, 65722921, 746724958, 461423533, 1582298542, 1564918930, 3710935369, 419349792, 3914061713, 2279209938, 770031171, 2062767935, 3373230309, 3582372364, 2025682996, 3352859025, 1262632952, 3140021482, 501370035, 2554730117, 
@@ -2142,6 +2272,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         3037999504, 2857298788, 911046668, 1170775701, 2369720, 3364839261, 1462383461, 181600856, 1315241696, 2861043792, 3549404088, 3974245218, 4141518566, 1195336199, 2291064152, 3287203016, 3867432937, 2593766219, 2114273192, 3716228986, 410286941, 2497285113, 1338500439, 3748757692, 2315519304, 
         545570554, 1519868916, 679216320, 3264840479, 4083041163, 261878334, 2370312122, 1408058272, 1287635274, 3433241543, 3923613754, 2423502603, 3948993135, 1418484161, 230113502, 1766447938, 3101286974, 917358979, 2836128279, 2859079881, 3162688352, 2158281644, 154509481, 2409785274, 3096379437, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 30
     {
         2456954827, 2895978734, 1621803157, 230462381, 4046364119, 716597790, 2031510641, 2208319977, 1107910846, 3379950723, 3628284249, 1393263274, 3842378742, 768116962, 1782906996, 3022943801, 510040722, 2180373447, 1294989632, 1659724107, 953774117, 500296619, 2269873184, 3215368465, 3933601613, 
         2401810535, 3568992417, 617528376, 2437412983, 2921242388, 2311040363, 3695847323, 1609309841, 3222455492, 1108155620, 397599239, 3344183623, 1159383441, 81554651, 4223302962, 2812031899, 2613176831, 2967803832, 3560382993, 670173062, 2361031672, 1745444335, 2067906079, 3019908371, 2662226130, 
@@ -2176,6 +2308,8 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         639602991, 444779318, 2722002973, 3927985419, 1297446054, 298277450, 656022205, 134304205, 3847728042, 3339100423, 407022043, 1282443442, 3173884578, 1417906094, 2364502739, 2158353472, 2402775649, 1807696073, 2837535198, 705887737, 2129202688, 3853676283, 1388329793, 875153687, 2367465660, 
         2763058233, 2500632304, 2196920062, 491306883, 277753357, 3868415380, 324867643, 3654474955, 2569410351, 1128175417, 1853572398, 1133201743, 662085935, 2263514999, 3077768113, 3309730620, 3602394176, 3747458070, 188422725, 813812450, 1502276531, 3909138356, 2766044599, 3760928321, 573108836, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 31
     {
         1240264181, 1624064648, 3039823158, 2013985253, 1473300299, 2762062141, 3273470484, 1889745445, 2516996174, 3190376531, 996186898, 3893981177, 1268272590, 3226095713, 153038465, 2184871198, 3224094011, 2526518401, 1738960059, 1187560605, 4194384320, 2837011297, 3638232350, 367907454, 574009898, 
         1948901330, 60430044, 1569835584, 3160561697, 321792583, 3179087993, 1936928378, 412346905, 4020812489, 2603392174, 3499496781, 1499441233, 1062415256, 1347130973, 1823246794, 3411391800, 4253618056, 1507733072, 1605629518, 1503312494, 8035741, 4038904206, 2408545792, 969543501, 954847087, 
@@ -2210,9 +2344,10 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
         4100978724, 2709958834, 574590507, 961767386, 21100886, 753746372, 4072632446, 733729367, 3060214669, 289165105, 426065754, 2036100240, 2172365757, 502856627, 84490194, 2630806596, 1206161269, 1009438449, 569581317, 1836947000, 3125379675, 1756936428, 3772694822, 3670337911, 3020603818, 
         2376224883, 2539951453, 2053395002, 3525193914, 1991480838, 3786481083, 873873707, 1693894743, 2450223985, 754878026, 1943356492, 401524329, 759931885, 611231307, 147950334, 599693701, 3358729722, 3649058074, 906423787, 1333804225, 875187278, 1115838692, 2476325972, 3307226674, 3539078918, 
     },
+#endif
 };
 
-static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+static const __device__ unsigned int d_xorwow_sequence_jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE] = {
     {
         850664906, 2293210629, 1517805917, 1215500405, 1612415445, 645388200, 824349799, 3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761, 2817264826, 3159462529, 1654848550, 950025444, 3095510002, 4080567211, 4111078399, 3241719305, 2788212779, 4256963770, 2426893717, 
         4190211142, 1420776905, 3780537969, 1102912875, 1657948873, 3354905256, 2519610308, 515777663, 3396785394, 1832603711, 1154211550, 1915690212, 1933919046, 789578337, 337961173, 1359089498, 2249086205, 3417955173, 862571348, 528120760, 1265685672, 1970052076, 3585976752, 3645339918, 312171257, 
@@ -2247,6 +2382,7 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3447798279, 1405733552, 3075862538, 1682808202, 1595154222, 1173705692, 680713285, 2748212230, 568610527, 3434965538, 1114942930, 2835858745, 2575992250, 3243355150, 2127580225, 1855934450, 3915941751, 2228679809, 1514780124, 1506688039, 1033083295, 793807083, 1120681149, 4105670165, 3999570340, 
         2083020131, 1213356023, 3684882757, 3375797774, 3577986103, 2092046164, 2593847443, 1826450612, 367828409, 3198272513, 1941316667, 943707510, 907134807, 2020457947, 1462193665, 2964617539, 4216491663, 2625270800, 2395371467, 3691003028, 3659016793, 2381847054, 3513105567, 3013019506, 2731245927, 
     },
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 1
     {
         1680024716, 2112340059, 3387475367, 2080916186, 1431532386, 3907378472, 2636491350, 2176128529, 2236616671, 3736851460, 2604001339, 3893075234, 3495918635, 4116370522, 1384310379, 3660102574, 2030233939, 2759207091, 49347923, 97526506, 2566932710, 1566181275, 3127827248, 578401670, 1499229308, 
         2581732444, 279715551, 809690877, 1438444015, 878935323, 1495277039, 3417305339, 2858903785, 3074075088, 603749086, 2370669734, 391683868, 3933465331, 2884128106, 1478317876, 1864988335, 2925823809, 4133578805, 218104493, 368652174, 1998600344, 1109346044, 1716435313, 415435111, 91393686, 
@@ -2281,6 +2417,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3373885614, 1132999410, 1097554565, 4089342358, 3239542922, 2451748646, 407290679, 3188103200, 1708016248, 26848241, 2796711130, 3090711568, 4068389322, 3420916085, 3137567033, 2877819818, 22133454, 4629160, 3703695249, 1920151708, 1175452162, 130015299, 3331834713, 1099225384, 689254331, 
         1851083761, 2654970209, 3259297936, 3742819314, 3524284766, 2291819083, 3494031861, 16242889, 3545082774, 1997878108, 777447699, 4244916543, 3508640253, 3782278393, 2107258964, 2139074576, 1383217899, 2337934322, 3181899620, 1285955765, 2989610020, 3326862146, 1168587380, 801203532, 3020809957, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 2
     {
         3810471203, 1017064446, 1595207573, 441087832, 3326746890, 3294064431, 167972517, 3625210015, 1011845006, 2980240819, 1778354660, 3041730987, 1598611350, 2015169745, 2321724978, 3390812967, 2432904511, 113261909, 3957193232, 3806115908, 2965828929, 2035392295, 3500116619, 2881232416, 1672212265, 
         1607201428, 425148945, 1262591961, 2221781268, 4215047456, 2148245850, 2787488981, 1077262192, 2085467561, 3053954888, 3584435116, 3013084787, 287099941, 1290407232, 4078552287, 2658945475, 4251530898, 2403086478, 2884923598, 3545110453, 4105390090, 343200643, 3189888821, 4086304363, 3466483195, 
@@ -2315,6 +2453,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3977128218, 424210327, 2919071615, 2715518134, 64568844, 480972649, 2488797168, 1302817038, 2213995265, 4229997295, 2200797852, 109368057, 3033807022, 1907400078, 645977948, 1410909090, 3700787906, 3375062371, 629087832, 1344281719, 4249981139, 3457543297, 1218556849, 864222854, 1458445945, 
         914545469, 3451164212, 1088025757, 1129933985, 953788883, 2406172924, 170364546, 3505490646, 1027553899, 2864067776, 436854871, 1342782209, 761167471, 2660173631, 4159507498, 4172028400, 2442254644, 2110123720, 2315991253, 873066601, 1725470559, 3831299052, 678672031, 1585431329, 3495750550, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 3
     {
         1998393432, 2665389278, 3989307699, 3267631636, 3861682977, 3243522970, 1243992413, 2200497260, 3821883021, 4187123083, 3451270040, 3044132745, 2101287249, 2340839784, 227040990, 1724350416, 3228881240, 3123386528, 4279362126, 3098224464, 2635534069, 3622906431, 206207480, 1894245533, 2152374527, 
         1011223653, 7271757, 2972858087, 207942127, 3355362797, 2593296740, 174093751, 3713822176, 4212355586, 3335605224, 1171716408, 2867257989, 1522213957, 2016192462, 4229688395, 2174928148, 1468226225, 3938290338, 493240317, 3229423344, 2585475729, 3112454413, 1881171707, 2555908056, 1997546352, 
@@ -2349,6 +2489,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         661024127, 2931754053, 3787840039, 2053363765, 363432336, 112334132, 2871797223, 138911320, 3981126938, 2027332192, 1804730644, 590150270, 641538574, 6802174, 3551446076, 3908480472, 1004531022, 2097228524, 1919074232, 154482247, 121437972, 1215661323, 1178068273, 1097220699, 2823681422, 
         262636065, 2943371149, 1768780720, 3866040605, 1855991583, 3988248086, 629223947, 3380612330, 3552916762, 197596340, 573801686, 2049230598, 2910471867, 2686314264, 1726228846, 3516983332, 726840185, 1241204222, 2237574317, 70568042, 1932610099, 2221862221, 1510378092, 4050391637, 4077539568, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 4
     {
         3872117793, 803220151, 70843412, 1661103032, 1976811457, 2186373604, 564259972, 1475436923, 2260980893, 4245534505, 1075107552, 3692990573, 370098873, 4045905424, 2420395420, 2332395402, 207483321, 622317750, 3004242500, 833623111, 3151161301, 1629139881, 352228793, 2439953368, 3183333619, 
         2703537080, 3218957129, 3164695888, 1741641842, 963394141, 4241612717, 1034476784, 2035880432, 3977821313, 1543311495, 3010014356, 1638490901, 2364265378, 3420329129, 333361555, 1133565821, 1450937015, 616059115, 3216393887, 3041978455, 3990855695, 1238628750, 512746184, 3256670217, 1616316512, 
@@ -2383,6 +2525,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2227278118, 1185927141, 1082173792, 3567361925, 1940465859, 541632942, 1830210248, 3757851982, 775883450, 1666577465, 1004944607, 878440834, 2146344131, 4195798476, 370164841, 3649112729, 37066142, 2311278904, 1935745497, 2304799402, 4107299626, 1348526232, 2473609635, 3284032699, 2374292786, 
         1762329186, 857978496, 1039346432, 2621413355, 29961014, 3582263091, 4268542513, 3890612190, 3096173646, 2026544230, 3856142618, 2347115934, 319800326, 3255916105, 2430273059, 823505311, 874255188, 1401925393, 4203707857, 4259159566, 2606881118, 1978288664, 1447576038, 3860341401, 412510348, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 5
     {
         4052471963, 683640040, 3043876021, 3466644483, 4222418025, 3035140128, 1466027937, 18198088, 3410320851, 3040963721, 488404231, 3157371815, 769336092, 3240417718, 808582581, 2075839263, 835026995, 3123726486, 3284240985, 1898453053, 3606056482, 512836002, 2715428547, 4182302879, 1644882480, 
         3160187826, 390292489, 980889545, 2776206633, 2482799995, 617042280, 3501667414, 689451808, 497018701, 238525753, 3890163301, 896679896, 1544533015, 3412477225, 3116575138, 4250402651, 3990990746, 819056741, 1459334146, 158377590, 3444755752, 8230450, 1378706455, 684191332, 3217423797, 
@@ -2417,6 +2561,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2145343886, 3712441197, 368422910, 1297685674, 4076123901, 26214470, 2948764826, 40503299, 1198194334, 2100063637, 1966331612, 2189582064, 2064696934, 1797550642, 3469793941, 2868963812, 851437659, 240918534, 365060070, 3530600064, 39695324, 1753898837, 1286976449, 3131971360, 2406485219, 
         3365373704, 3224113403, 1651742834, 587601940, 1574206085, 3739575036, 1413669616, 38172232, 293127854, 4126190109, 1891744061, 787878666, 456643669, 4228710325, 2025132037, 1492133135, 3122840937, 969442079, 3272420439, 3836126369, 1877655562, 2766212758, 3867984746, 3348077578, 1841216706, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 6
     {
         1676507466, 1017841240, 2992644565, 476936158, 2468072723, 3113105154, 1154120402, 460889625, 1942263502, 1761593999, 3020908939, 3078194866, 310971889, 1644896012, 3756044556, 3549937583, 3710822994, 3554313733, 2174654326, 4251063242, 2340485150, 950951909, 4288936895, 3744348848, 706644559, 
         1085927825, 1595992020, 3288724966, 1367247946, 2950094970, 3925419886, 2628739022, 2528254629, 3582224789, 3907345559, 3373329273, 4255542251, 1185418446, 4018656113, 2854344020, 1381160022, 3642438773, 4284399225, 935780030, 4142412144, 1263328494, 1154237693, 2684443667, 3067549398, 4253090033, 
@@ -2451,6 +2597,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         1997423206, 477446533, 303090065, 757937082, 1523238256, 3140505311, 1422588701, 3642014639, 1740624195, 1276017154, 3072526193, 3675105122, 1335122682, 4080595263, 2308519420, 3299182769, 1461978532, 3098694217, 2982399822, 3088698511, 586759229, 3548750902, 1449857891, 2866451663, 2525162286, 
         57294602, 4107991297, 1214672265, 2940391280, 4285346034, 3338216759, 737207923, 4264163846, 59219141, 2300024654, 1876616814, 1976543605, 783571061, 1724699622, 1967524469, 1650309916, 3322257631, 3975521122, 273342162, 1156754241, 185315896, 3368133921, 66314655, 4153777915, 3519901897, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 7
     {
         3672467167, 68684525, 1738833632, 3081329135, 2583806115, 2291130512, 503032614, 3658059597, 571493931, 685537959, 3498787788, 422428426, 3879256913, 1173158320, 4000800121, 298972869, 1718342816, 2541691685, 2490502642, 2321452806, 4223212804, 1812334632, 3717655725, 4238191852, 3001307165, 
         2621896355, 2572404999, 3590094954, 760765206, 2293618001, 1392353032, 1733137169, 2674005018, 4067961151, 1505710487, 451078217, 2591688848, 12635611, 507045428, 694822241, 1789383090, 1140183890, 1720695967, 1994318191, 3340349873, 2793804971, 1054433135, 2345087879, 3179939285, 1651968615, 
@@ -2485,6 +2633,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         4285497594, 915263578, 1486882838, 9988613, 829077170, 677216046, 4141828204, 165804609, 1086678519, 2933434608, 1351662802, 2640085040, 2611502932, 2033698714, 2008873254, 3995557835, 1020873906, 67873555, 2230337823, 1263800417, 1148712155, 3985159589, 2979503513, 2854714997, 1539343345, 
         2751484352, 1569100732, 2020758949, 2126757134, 3426641899, 2808587825, 1953320148, 1096398464, 1502907172, 3751230087, 765557661, 765290990, 3056075500, 2040620632, 422573751, 3613558930, 1741145769, 273531216, 837238736, 494297893, 2903251124, 1636782182, 4256592784, 3652746656, 4258393217, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 8
     {
         2657510202, 270297201, 2970166904, 3151626326, 973127447, 1523852613, 598650578, 10289043, 1138773500, 1379558769, 2202575480, 1622690708, 181345079, 228706650, 2807760507, 3061024281, 2310359315, 3094465578, 4062753882, 2744510393, 3844622451, 1759718963, 2393602744, 977540509, 870449791, 
         1484134272, 2838962253, 3079492430, 2617141201, 3744868057, 994295425, 1302594555, 277777192, 1793039043, 1620482692, 2518563014, 1163760339, 2709515777, 4220588138, 531143270, 2528377633, 931694828, 1472659070, 900489303, 3538137811, 3849822545, 1304182427, 2423451948, 587259647, 296795227, 
@@ -2519,6 +2669,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2001895525, 2673649961, 2106555006, 1762053005, 2334552700, 26094213, 1184502058, 2048598709, 4039640450, 1439363714, 1022688817, 1053169108, 170896272, 444231850, 1500204748, 1077470703, 1630597179, 1382588806, 138805391, 1636536505, 3118018426, 3461152216, 2486547351, 2045361316, 2976067436, 
         468876399, 1407419455, 3226137264, 414206328, 1011039713, 3537947031, 2359787831, 258556532, 3615987029, 3372097337, 3586352388, 1056198830, 1852291192, 3888893481, 746156045, 4203877603, 297851145, 2615507398, 1141098641, 1881412583, 3014341741, 2125186797, 229307235, 3476606674, 3553854689, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 9
     {
         3768542219, 2777948797, 3328832678, 3488502819, 2708053041, 2217907094, 2133505056, 2218961277, 2148551748, 1420045625, 1709182366, 1816409641, 3791695288, 4207813971, 22588497, 2211317602, 616238454, 2394270012, 3212896041, 213408768, 2199328374, 3188624050, 811443809, 2818548979, 3150758902, 
         2022548260, 2462701924, 3793704672, 2358080321, 483288372, 450033142, 772942770, 2224873625, 241543410, 312552314, 1268067149, 915918620, 3906238422, 132545832, 3486041298, 2414090506, 3798383292, 2257004699, 130309284, 1158673651, 152325583, 3499865580, 4094273597, 1029041593, 93538481, 
@@ -2553,6 +2705,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         4095583159, 1796641692, 2518000547, 3621187982, 501166402, 2112782420, 1704276185, 2249859782, 3754293422, 1942321901, 1851019104, 240158224, 3181132144, 2281632719, 808029657, 1721710011, 2287207169, 3044484177, 2363339534, 805273402, 3696016147, 3549191229, 3353631259, 2946802391, 383414270, 
         300735554, 471515206, 1907815837, 1576327662, 3825043525, 2817119733, 1973847200, 1398317206, 2221853087, 501440864, 642467132, 494410179, 1191241925, 3549838846, 3621239619, 2640266286, 4140123024, 315957218, 3696758268, 2502777875, 2150738616, 1570099119, 2598276767, 3585886712, 230047417, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 10
     {
         220882755, 630187688, 2600079656, 3103815531, 4259457395, 306940008, 760977254, 558299017, 73879495, 2342545344, 572800511, 3922797738, 3754011306, 698257357, 1274843132, 1455757442, 1014649591, 3205662508, 2997738251, 613949432, 2267018388, 2925762681, 3702061213, 299380602, 1711070497, 
         4140032336, 4134705925, 2836703879, 3776863395, 507121465, 3480792188, 1862887216, 247780795, 2528677869, 2881446422, 271754977, 833498724, 1489102731, 3636156177, 1839744487, 2011839858, 2353400914, 510437606, 561141583, 2979592314, 3844268262, 3011027242, 3113817193, 3491178377, 1448376742, 
@@ -2587,6 +2741,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         170401553, 3456013554, 3395842846, 508189059, 3398715186, 3862791669, 2741070272, 65318715, 1933435210, 4086198650, 3033193928, 1242412691, 3397363281, 3187419149, 1019508117, 562380742, 961415837, 2990412400, 3597720222, 2754100415, 1793508822, 966564784, 1875616532, 394646945, 1386107842, 
         2750810827, 2931007937, 3356489930, 2358364634, 3703772713, 3188884403, 2793590498, 3285138686, 515002680, 521510516, 887213583, 1873460781, 1583027667, 613895001, 557578628, 1892686243, 1974572772, 595831726, 229299738, 3847982294, 448248098, 1493822844, 3326405260, 2752463855, 128616819, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 11
     {
         2014765631, 3938779303, 1811986049, 2101875601, 887194972, 3966228860, 3450775746, 4026039255, 4082308025, 432404123, 3181099213, 1228097256, 2368258457, 2953933351, 2582232464, 1657799516, 3525421629, 3927364159, 978138132, 3603597064, 342571522, 2100072168, 676229632, 2062864895, 3713317279, 
         4255773013, 1179492389, 3501226604, 1641801113, 2066614519, 3303232023, 1717768923, 2333501450, 4246883128, 1655087824, 1547897374, 754215285, 2832638094, 1365153701, 3309513970, 765738141, 1177808869, 324127419, 1171195868, 3494966448, 1714410667, 3645762436, 603810292, 489970006, 3126166124, 
@@ -2621,6 +2777,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3634834949, 2584809384, 3638373352, 2603765126, 3223396315, 4021061386, 2143780551, 248332433, 3654752967, 27201989, 3994156272, 5505477, 4260955724, 1175998822, 2665646240, 866875674, 3569324422, 202962714, 896177244, 3146417201, 1168925859, 2228636445, 105395449, 2567482935, 1301265751, 
         3739617610, 2486939910, 1891847857, 2647840744, 1141826566, 3360553996, 4267671927, 2546157872, 1143297884, 2049385137, 4288036836, 3347190546, 3480408604, 2756408254, 2396048567, 1151717877, 2211243289, 4221659024, 21773193, 1665317870, 3116384869, 3231689469, 3689471824, 1520574310, 463615415, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 12
     {
         2647200400, 1592194261, 1289872755, 2079982087, 3431487085, 1101851783, 3373292799, 2148994262, 2785319928, 3206527339, 2731839331, 1280366172, 1146205735, 2930495205, 2876978398, 3885758458, 2062812458, 2448488486, 192141900, 3861696664, 2677929258, 3606729729, 2920965773, 1156521508, 3168665640, 
         298794036, 957896625, 2606719899, 3699219026, 3120096333, 2531109351, 1920936462, 2848868175, 1406404729, 2956672675, 1376226240, 3667482110, 2551426756, 3433640449, 2603906744, 4217864690, 47671552, 2993859190, 1269153270, 3463588775, 1655126430, 3453916724, 2157890969, 252769449, 1583335064, 
@@ -2655,6 +2813,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2316834456, 1736616135, 1575712778, 370866908, 4256943043, 2805503887, 1099763491, 2473785999, 3215573143, 472701386, 3070116154, 3969279119, 3331310102, 3932945670, 1502564397, 1294139579, 3073834823, 3115143551, 3602082994, 3707103500, 2570195094, 1268510174, 3561337287, 112422529, 1483304061, 
         3712148969, 3729628891, 2741131557, 4035019342, 2395091348, 208448216, 607199897, 4049058939, 3463267226, 3821711834, 1697628853, 691151709, 3014869414, 11610545, 3895793639, 3019679196, 1246664817, 753245113, 2236232962, 4172861179, 4030183420, 2367787106, 2209331085, 4170801007, 3609895913, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 13
     {
         930278208, 223382535, 720499309, 2613473585, 4173439516, 2132019243, 468054579, 1141433627, 1328639101, 3222455434, 4023859457, 892124224, 2940688706, 2894552260, 1595432126, 2558709596, 2057191226, 1116728192, 3767370344, 1457278707, 3171850455, 3733161247, 149922078, 3860652874, 743952057, 
         1024625539, 3982786483, 2077838781, 3713742913, 2790452624, 3014482913, 2928857967, 476371337, 611803300, 3000092437, 57069608, 1554852195, 1406780525, 2288998898, 460131340, 3945168588, 18495216, 547882902, 1624966119, 2229423551, 1492565146, 706052879, 2733955743, 1450476708, 2565285196, 
@@ -2689,6 +2849,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3522587233, 1686032132, 586483076, 1207387616, 3040778905, 2532774045, 3681992451, 1034866888, 4029685195, 3307070989, 2412903766, 3156200186, 2625083166, 4148004113, 1756566287, 2319065855, 2924909429, 3050022486, 2464491722, 1137782196, 2749457821, 790410752, 3511746957, 2277733721, 2871407058, 
         3858561909, 2176119631, 952943025, 2987154266, 120799539, 2862346597, 3689389598, 3329995989, 715438735, 1035277216, 3079684809, 677298106, 2364292665, 4110165256, 4096954153, 356732100, 2361282903, 4050817284, 2010946835, 1824397679, 4087204231, 4178036725, 4197370951, 503070461, 1879838906, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 14
     {
         4117851084, 2941903397, 1156439261, 1922510465, 2925632294, 2272105738, 641404242, 3414739418, 2602896978, 672876430, 1998875331, 1325970749, 1633717408, 3567722815, 2088144733, 95705225, 580635702, 3543633503, 1469889369, 239816045, 2254984383, 1632695776, 2033839470, 4117902893, 509938588, 
         1291002316, 3600816069, 2962644092, 4269959520, 3161890066, 1908855486, 1177948589, 473118979, 3205649854, 2027137481, 227656706, 1485922673, 3380103860, 2080286336, 2588604114, 1727893393, 3602757903, 3126385963, 2101893784, 3058515017, 833779022, 719369683, 3768029740, 1123855192, 2580550821, 
@@ -2723,6 +2885,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         32800830, 324902076, 2365753207, 2251160429, 1692543836, 2920424644, 119047416, 1821685115, 1486296407, 3055580738, 3711421730, 1522703457, 1422399573, 2515073038, 3788816887, 3490575947, 2395299159, 4248373284, 3383561277, 3128107243, 2344292809, 1806504793, 3087395022, 4113720664, 2749262038, 
         395148869, 1331347439, 2682558741, 1253966763, 4204248490, 2083995727, 2717069903, 4144872894, 1857751053, 2166276701, 1419950839, 1145170701, 3225260742, 211743500, 2746391743, 3333387219, 4115426799, 3801457092, 3327614811, 1460971336, 2256342146, 3186427137, 2684216499, 1035644397, 2948948308, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 15
     {
         216975964, 4145824263, 2147471723, 4154469597, 161744273, 1299764439, 3468614543, 4190517158, 4124232403, 754999274, 208153182, 1442063188, 2940825403, 729331312, 2124186505, 1136411459, 1083787490, 442264548, 442338468, 464589685, 3509461223, 4241734851, 370778328, 4003105058, 3163637982, 
         3747133182, 1433548371, 1876378240, 536564977, 1171222160, 3268902719, 2725776746, 1547771137, 2818791461, 4129042013, 2677094853, 1594765197, 1556725424, 569252594, 2640731848, 2947042710, 2633188904, 1640957370, 1806863786, 2803403654, 2632220187, 2740076538, 383549855, 3211856699, 3933793958, 
@@ -2757,6 +2921,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2022522416, 719777136, 417238676, 1865171065, 801820378, 2836941189, 1148226009, 1713866138, 64608707, 1458585813, 3581572089, 2251042907, 1818903516, 3278072806, 2838874249, 2665607605, 3360214955, 2185961451, 410342713, 364484774, 2887998484, 2100888426, 1394314931, 1362560504, 3487221127, 
         3140021092, 3168968161, 1613267484, 290430673, 2588210538, 2493788232, 2641638765, 2971195072, 2749469779, 692014176, 3268150742, 387451740, 461249727, 3579417331, 3738405845, 385445455, 1464799053, 2786433795, 3370371952, 675344511, 4049011269, 2196568686, 4166285481, 2547135972, 119952106, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 16
     {
         2307933966, 145940188, 4247815717, 2995341855, 3245382498, 1213200792, 232910392, 2718014238, 918321585, 3583102265, 3176078796, 937696513, 266558688, 1520650260, 3655025189, 1653323191, 538426778, 491545855, 4064663509, 2788350755, 3941259490, 3471552693, 1851151228, 3279627338, 845228710, 
         29883500, 1503432309, 593880175, 2488716480, 828058076, 3287933183, 3510981973, 3970051135, 3803049980, 898259836, 2890959433, 234437380, 201835406, 1523016285, 2419577439, 2943482079, 4219300984, 1490698759, 533411805, 1644926459, 4097374623, 265292490, 2694560848, 285667083, 1563945375, 
@@ -2791,6 +2957,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         475697670, 539253230, 1256048653, 3819847913, 141216227, 3888391528, 3567424851, 4131097532, 2142453586, 3606575354, 3689715433, 2318212425, 3026095399, 2451038695, 4052322172, 1861782452, 3032216562, 4078403318, 2636775961, 2188864067, 3276459319, 2230349722, 3939784264, 831216291, 2483460713, 
         2571551493, 484276565, 3173595164, 4177831244, 4132249231, 2116763555, 1420812998, 2121017321, 2855491215, 1630144518, 2489688364, 411521312, 3713786536, 4177871972, 690465497, 855092147, 4271606539, 1265108699, 3757106624, 3151574897, 670335437, 3099376310, 3946436509, 1795346235, 4013409945, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 17
     {
         650684252, 2220445579, 537394374, 571322423, 2781663439, 899394682, 364129622, 328438826, 1219862153, 830435885, 3278649457, 3072225531, 2838645991, 3150905380, 1251952499, 1751415553, 2034088483, 1437197870, 1907624878, 1786974150, 4207811086, 768131803, 2713210999, 4004509777, 3510764535, 
         2740991637, 3000313526, 1355959320, 938244439, 4093313692, 2476002145, 835527260, 2084758949, 4223775017, 91645393, 2251723899, 3159477758, 2008655575, 912220875, 1525327655, 2067948386, 2006141522, 450235614, 3945671083, 2852189452, 3804118704, 3302604345, 1712745267, 349281154, 19331179, 
@@ -2825,6 +2993,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2008242014, 1138475935, 3044902216, 1917596533, 2905651936, 3320601534, 1468557693, 4101437636, 374575138, 730079080, 995340259, 1430552870, 3860649629, 541396702, 3413070856, 3052797396, 3591116740, 2811484252, 2464310183, 1597327051, 3288232619, 1564716093, 2838386049, 264313861, 881377066, 
         4165178494, 1069189853, 1045737884, 2072266205, 2700673629, 2338724235, 837702541, 2603464957, 1548182143, 3565539962, 38172869, 1949065935, 3628598166, 2788698071, 3531182193, 1367529788, 3902468811, 1215323634, 1117475027, 3901912129, 2678279671, 597953858, 4082485755, 3696533122, 1078703353, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 18
     {
         590004384, 3025338414, 1764374188, 20686172, 932343559, 1798441768, 1013577341, 4275903797, 853441141, 1065980978, 3665193407, 1555165047, 2962781443, 1822487181, 3329200135, 1527094489, 3805115799, 2252376033, 2137546519, 3632426270, 2439842864, 2525211849, 602876448, 1488163727, 3169015136, 
         832084039, 81097112, 994974428, 1945411347, 1020609213, 2863240894, 1639194881, 3078842449, 1885382385, 2595105518, 3857547190, 3654577058, 3853111480, 2237941224, 625422255, 3292783340, 750206381, 1002246874, 900879607, 820635221, 3318328110, 3980484559, 3924790669, 4260574943, 3658381114, 
@@ -2859,6 +3029,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         1409945926, 3617206544, 2383446356, 3452204096, 615486157, 720696019, 1730134434, 3918468503, 1629431965, 2174079220, 325852294, 234479771, 1490297289, 3579002992, 3538738636, 139386548, 3067789050, 2078261059, 3552654276, 1774602596, 2105142163, 2768099869, 2265044995, 3680536732, 3601322356, 
         2848878442, 1166743022, 3508176959, 2186695985, 550278868, 3324775634, 384537301, 1019044102, 3354263542, 1942540686, 922714337, 3097711558, 3074228403, 3565076630, 3459053081, 4128383906, 1114387332, 2101424539, 1192649508, 58778130, 1651798895, 1752063480, 1728826905, 2225187635, 2463770127, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 19
     {
         1978406995, 576106282, 2238958298, 2073551095, 624788087, 4231569260, 1853272808, 238274694, 2389334758, 410188028, 2293786099, 4243662908, 2317700970, 4050493361, 2348206908, 485250660, 1212732903, 169414736, 292623762, 1602229231, 2466348869, 3063669700, 1872890881, 1887188929, 3447638989, 
         162521682, 1470651713, 4036975255, 3423782623, 4043724693, 1686690883, 2610958712, 35940353, 78593759, 1565950713, 1304303952, 2004267248, 1417268036, 3328228522, 789915977, 2567452041, 3564175714, 1838409932, 1455795236, 22377452, 455201131, 3340286965, 184599544, 4102076073, 4007870762, 
@@ -2893,6 +3065,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3891512282, 1561648319, 2690491944, 3075246584, 3202791012, 315381589, 3645907425, 3532420114, 802256935, 1270128258, 2695868207, 4075358890, 3888212208, 510396943, 3683116722, 3943939501, 146061942, 733291914, 1402325031, 672641124, 2817168601, 2622398925, 3641379870, 2969146913, 4232866548, 
         1694492034, 3065141682, 234404736, 1921499010, 2300706258, 1304904939, 207802178, 2674605425, 2688377241, 2674991105, 2585496531, 2358858923, 2578793432, 3275116043, 228073476, 2936443283, 3713102344, 1629243323, 209348683, 3730808488, 275442226, 223820143, 2365614109, 3017206322, 1906208795, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 20
     {
         1545504510, 1985586093, 2005504076, 2487099791, 2348737867, 2254755902, 3789154730, 3268946922, 99552511, 1369361877, 1888041043, 3105269579, 4044127396, 2380045264, 2970234287, 293292961, 1811276320, 1083136897, 3016497500, 950611584, 2165628367, 4140133899, 2402926185, 990501164, 2185997143, 
         1769871204, 721625457, 567446962, 1695515231, 1848699963, 4163520111, 2316975723, 4268269680, 1021066723, 517434635, 3827063239, 3483118065, 760366769, 3072996795, 3548263896, 2131401627, 4167855065, 410255606, 1992500865, 1322267629, 1599293552, 2389387938, 3721625360, 216375429, 2002236178, 
@@ -2927,6 +3101,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         4195548426, 3641578987, 990686800, 2391278490, 2233755358, 1739784005, 2458544650, 340925249, 2442887806, 3503407512, 3058778909, 3619026333, 2289286518, 1296212011, 3879317178, 1210295163, 3113210467, 1578990986, 641384071, 2437977832, 1689385197, 1323268226, 861337916, 3532905860, 3735971843, 
         2294673483, 1032787575, 1868992735, 4260308791, 2091311463, 2354047234, 1005300697, 29821726, 2790044161, 3154591207, 1370229266, 3464848205, 3855301526, 544374401, 101012897, 4214903025, 1310520049, 14884434, 1438288148, 2118574986, 2360002070, 512167778, 4186534704, 3633828199, 493600836, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 21
     {
         2932801042, 4101748508, 3363559072, 1213475638, 2400369070, 1726749444, 3175844814, 2600020277, 3779799804, 1886667522, 1228105891, 589138388, 3960459504, 450669757, 3773736740, 2107201112, 1437834675, 3618095315, 3662453347, 968349971, 1891706458, 2333451375, 4242907074, 3265111057, 3648168902, 
         4137035018, 105573058, 2075999861, 1053920954, 3768713177, 1836088599, 2015103258, 2649187541, 2717894301, 534937136, 3492326400, 2406499346, 617315838, 1384748442, 519804615, 524657043, 832148261, 156272480, 394759604, 2428809631, 3401589884, 2588359262, 3826333418, 2427993050, 3254067543, 
@@ -2961,6 +3137,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3589621009, 3800806613, 1102108318, 1376914700, 539544394, 799741508, 1192097712, 2894663754, 567276527, 106814343, 3985577014, 422246623, 126568764, 4008211389, 4037889581, 2185357423, 2239644921, 2116447019, 1249715620, 2095747493, 4063243162, 3059330950, 1045571624, 1150656233, 3024439196, 
         3981904623, 1743764595, 4220253496, 3322182853, 2132911849, 2074342674, 198749193, 574306951, 3563262292, 3832626833, 2349475213, 182567249, 1530390173, 2066055611, 2609802571, 1392638962, 1495846580, 2356952332, 4029921749, 1731839848, 527880959, 1204112231, 938004695, 294300378, 1855457892, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 22
     {
         1438083560, 1727969469, 703174449, 1296281193, 1386452240, 3304170302, 3048300096, 277697908, 2675939661, 3382564518, 1639425457, 2210719281, 3173605115, 1685375802, 1317820682, 1960916541, 4230888182, 1924357010, 3322827982, 1663716994, 976583570, 4146230815, 525755678, 3608894680, 1715438458, 
         1519478303, 2845291872, 1115405802, 2468673244, 2289739992, 46988928, 2559411080, 2466723374, 2995303634, 3871022237, 1794652692, 2424766096, 2849910020, 978542234, 1667051478, 3393290740, 1508376445, 4090541488, 1314139749, 1271060027, 3272019878, 4032394060, 757805987, 619143288, 1165760536, 
@@ -2995,6 +3173,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         285960682, 3801150032, 3948820512, 1677682247, 1735541155, 1914753931, 1965156079, 1875233710, 681418791, 2077804400, 1963479724, 2447942398, 269798686, 2740088859, 1974178779, 3373487761, 2879779843, 157827737, 3855390825, 2779173093, 2359181541, 3508102362, 4001266348, 3949912729, 3232414439, 
         472195874, 57835121, 1854343116, 3020785997, 2024437594, 2182964208, 3379376555, 1213864603, 307833006, 1029130725, 545051507, 4001695571, 2258480284, 896286117, 355474524, 2514583184, 2997458384, 3278715462, 1675341954, 3603020014, 2318410671, 2152785892, 4285597912, 35655711, 2087100216, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 23
     {
         1671155, 472949658, 148656515, 1640075411, 930771231, 1601854390, 471598090, 2013359012, 3708325970, 1688441844, 736452516, 100585026, 1154373750, 4029833741, 3409420465, 192349301, 3804215437, 909027311, 2896874106, 3567276364, 1319305666, 3858990362, 3155018279, 3756192170, 3567813642, 
         228734829, 577956164, 2078807284, 1005987081, 1464380935, 112604551, 3865074232, 3776350052, 1112767766, 2947509331, 910887552, 4127297396, 851240323, 3136588838, 1639013085, 1154068086, 639126620, 2501600773, 3174842042, 3456593672, 80596481, 126970446, 2184239961, 1448001095, 689252599, 
@@ -3029,6 +3209,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         797817618, 1736047766, 1537439339, 1422940895, 2210817855, 2888194544, 800138109, 1689425315, 87966703, 3800446188, 137301285, 3334431104, 1776710491, 4010349050, 2577018472, 3083459223, 672158271, 3379478560, 2445459713, 918903140, 2577376693, 273150303, 2300393435, 3529750006, 3941920515, 
         2590879584, 2005940914, 2533952036, 2918638361, 1907638097, 959011520, 1477207871, 2141548481, 2065858781, 3145892196, 3679867589, 1295127682, 1325838381, 3482593404, 1212565985, 3404887017, 709111097, 1714185234, 561489165, 3545430079, 359778601, 3034684349, 2235482356, 2263913966, 1397371482, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 24
     {
         170295791, 2753410803, 2200994594, 14686027, 3460333923, 1523230564, 393272614, 1632665034, 2139771608, 2436912103, 375335282, 667585308, 3651645415, 1403132103, 4146144245, 786890392, 1349234364, 1278024517, 84921263, 3758850381, 4213552796, 2355655048, 1636349912, 172797504, 2490691729, 
         1233059003, 2593048824, 942056581, 953415060, 4250104075, 787552244, 1995239637, 2482815609, 767530774, 773778243, 841396894, 2718419035, 3363828032, 737774143, 4128182656, 2335090807, 1421795969, 2322011430, 2808330380, 2207840656, 1646731611, 492284258, 2339383764, 3439685708, 2316859204, 
@@ -3063,6 +3245,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2359948129, 1158552196, 2094484627, 3077606843, 2119537593, 427023787, 3632076073, 2670551310, 3396099733, 1066081183, 1817788918, 324769315, 656687887, 202117575, 3106428593, 3730407212, 1661316263, 1215084998, 2025391552, 664352483, 1914686594, 9439399, 2548190484, 3127972014, 4008228378, 
         2645735658, 2191361716, 2211450148, 1863406291, 1179298131, 241880428, 2330159770, 3490494273, 1337382890, 747522461, 1060348557, 3618051469, 991193538, 1604905367, 2595102954, 1460144089, 3990194961, 44265425, 896268152, 9333748, 2850675977, 941433385, 2483544989, 3443750079, 2488690792, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 25
     {
         824297644, 239464654, 4133652405, 1611614045, 102133367, 1780659362, 114934718, 3793050817, 3286619856, 1323742990, 3487325492, 468742651, 271433491, 3474195023, 479173886, 3282693508, 978269731, 1826990521, 3664994445, 1943608646, 2356793330, 2228748670, 4238523810, 2467714013, 1732683390, 
         2345218001, 3371637369, 1073602848, 844797255, 3881048480, 509186599, 1399427071, 3815270778, 1505666412, 2616384981, 2990167853, 3716581225, 3063486812, 1568307898, 3262882991, 1455926070, 3011806226, 3803364927, 849372289, 2382885729, 3071102985, 3838244574, 3219174218, 847830757, 1414310383, 
@@ -3097,6 +3281,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2691769282, 3572566918, 2910149226, 3659418019, 2511762503, 3869838339, 1413312151, 1939339596, 801124461, 760477862, 2416958233, 3439465675, 3561763524, 1760392811, 1582406751, 1203071257, 755811399, 2675585013, 1150664766, 3515765747, 3419135844, 2076543342, 1191918544, 3644819073, 2195875022, 
         2909071148, 3385707813, 1151273265, 1467337419, 3570589492, 3742049917, 1609858615, 2964509119, 3747960348, 2825858640, 101501715, 1234710482, 750428334, 2870070395, 416615350, 4054039387, 3807926874, 3035407103, 1644560291, 2490941295, 963796562, 3233132139, 2590859502, 2845243609, 964355909, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 26
     {
         2882980002, 2211288683, 872766101, 3713771728, 1429983118, 2069599564, 827699420, 1288565883, 2985727214, 3873174741, 2138389854, 3915615927, 2759028650, 3120611541, 385953581, 189931252, 2044235060, 4214733958, 1899137741, 1973215178, 494148492, 1550568689, 3646957712, 3764784141, 1114556979, 
         1411407684, 1194906295, 1718808623, 1809627046, 1413570172, 180837718, 2588730975, 1481586714, 2836300053, 1967135375, 4010897189, 3392273121, 3466021198, 1182364160, 1364130321, 1795412556, 330320182, 1165093128, 2125767818, 904192995, 51833064, 232302906, 1834422179, 476731510, 3484170517, 
@@ -3131,6 +3317,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         1933504723, 3110735238, 2333178561, 1577381363, 595257962, 4120745072, 960219089, 2591080970, 3354222743, 47827627, 3759509914, 304815919, 2643673615, 1381570381, 2103367217, 2440936991, 2376721005, 1483630814, 3137202706, 3075255640, 1743649605, 3649754571, 2550788713, 4281983459, 904183710, 
         4243944530, 2742129811, 3363501626, 3670239155, 4233018118, 2615012385, 1420298161, 1251344091, 2172588631, 1243035186, 1724496237, 762022558, 8747231, 334416849, 1219880856, 187900356, 2527057367, 1730455958, 3240238410, 906024910, 2351575735, 4207748622, 936139767, 1984289988, 285939331, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 27
     {
         4246897171, 2217508286, 4117450683, 4110626546, 3753823387, 3977667932, 623718443, 2276396692, 3772091798, 2272323453, 710314822, 3733316262, 1497955597, 700242668, 3582720207, 1247731879, 336477088, 532374143, 1123157198, 123828173, 272472192, 2142741093, 2557920990, 4209595119, 2807266578, 
         1516814248, 4250883502, 1967663703, 215335417, 1252724071, 4267389372, 94668579, 1980152960, 968677393, 1237744359, 63833646, 2488747616, 700459471, 744977323, 40829823, 955400639, 37187948, 53133706, 2014551043, 1664982537, 3342787122, 1549278321, 1245110464, 3424539081, 2180485253, 
@@ -3165,6 +3353,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         2315051975, 157809758, 1148939942, 3060024350, 1464284678, 3209480975, 3961060416, 3481639206, 4113344379, 3475766200, 130581501, 1844026536, 2661594012, 3145812007, 3233175620, 2549419093, 2612966733, 1348260920, 740167863, 226231218, 2631972701, 2148020402, 3399479414, 1074946996, 30872114, 
         1342415612, 1071408471, 1141719547, 332346805, 1473336719, 4207932404, 3668838170, 3154502882, 3892070442, 2812790310, 13931822, 1150258251, 2369539473, 640926011, 2991135002, 2410382633, 548200125, 3977740663, 1245837867, 2378569399, 1561469990, 2437445882, 214387770, 3329587833, 281635893, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 28
     {
         1720103319, 2201367526, 1415072072, 2446588589, 2195586017, 3817930623, 653121934, 2766514657, 765921436, 630082485, 2990883045, 3304472999, 471385134, 4097977544, 3749829028, 3587534772, 1064359851, 800061060, 2844220510, 389838005, 3681318140, 1515923235, 1885079324, 713031018, 1962734763, 
         2288160004, 1983331336, 1247350521, 4208372034, 1444837930, 3549494305, 4169715512, 701313302, 1118275019, 3118975645, 4153969630, 3516491181, 3601057044, 2509222288, 223064937, 899123842, 2574531231, 1386928111, 3790651401, 1300768348, 2038833061, 3736517792, 3850203561, 1679542285, 3391273474, 
@@ -3199,6 +3389,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         3882002482, 3838480186, 823643071, 1244220618, 1227720039, 1343395654, 4277277976, 2612321540, 3013674017, 3658064522, 2573775167, 142767236, 2545708383, 1740478937, 809036862, 1492188594, 1294286248, 1093543858, 2944418375, 2981996479, 4067464923, 3071157685, 1938984450, 81707323, 337713546, 
         1849381296, 3447450393, 3551106302, 3394545269, 3167744716, 1815294624, 3244728913, 2462138247, 2286711732, 3023116169, 707366723, 1314169762, 1511231537, 2227622993, 2876600706, 4271030726, 2020521540, 2966596767, 3964589247, 1291306737, 883851756, 1355819080, 2834319249, 3825063450, 4205423325, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 29
     {
         525214560, 1972466543, 1542775297, 3030388145, 2623763324, 1445252054, 2315649878, 2940376435, 1322155857, 2007925719, 899111545, 3946601974, 720416639, 566341007, 3830971140, 2379218430, 946001131, 324551023, 3792134824, 2419222364, 2507004728, 4050415702, 2934667964, 3435655480, 3738151878, 
         340092998, 429296098, 3804978739, 1547120540, 976306993, 1134820236, 288696971, 292350374, 423348923, 4250561112, 1380146522, 646098313, 3081299572, 3633231429, 2348008746, 3250735726, 3495239618, 1083361876, 2660545988, 97607299, 741626628, 2451882102, 607936604, 1566190301, 3752644837, 
@@ -3233,6 +3425,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         765377308, 961452970, 4247303973, 2233034754, 86997820, 3495561473, 3075957349, 3152032365, 1220657606, 708134514, 26714613, 3749542051, 1640668224, 2252760600, 1635050662, 947216628, 3612773344, 4089189500, 3647048119, 979491227, 4149824933, 3160885292, 2808843788, 998859510, 3903167193, 
         1728999561, 3673946130, 279338980, 2507635299, 1614929524, 302060483, 2874453052, 3798613814, 2013436766, 3514754020, 2923162106, 2658720327, 3498579091, 3292220096, 3796129102, 1907288796, 2820663603, 4276052248, 247755133, 2088596201, 3154955976, 3309397641, 3606171919, 1356791029, 1030266022, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 30
     {
         3868946146, 1938156793, 1877502872, 1408917625, 1549117911, 2465501566, 4218547770, 2942249332, 2731789075, 2366036899, 1312641799, 2243363271, 2238839307, 384814263, 1552361757, 3521369641, 431721717, 3089625732, 1023760034, 53847139, 2240881978, 3178046414, 145135653, 1580878781, 3500228040, 
         3360910006, 3285542950, 3330062556, 2870158227, 1481496810, 4222704363, 2973046526, 435155769, 3234730070, 3306545960, 2539776908, 3991420334, 125389349, 2397544348, 2504790975, 886432257, 1804136430, 1506551086, 219847214, 890282686, 1489840806, 2536942497, 87527661, 1822718904, 3984956867, 
@@ -3267,6 +3461,8 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         1522694503, 3857782840, 4282681349, 2229263718, 4106780914, 125648941, 1933617693, 2971178569, 3537872030, 448962137, 652123777, 2393871920, 3938047691, 244410098, 3110791961, 3122318189, 877378106, 3683644255, 4279094311, 3638987055, 667681197, 1679868535, 1938378101, 1331340184, 734163051, 
         3409564713, 955108672, 3969637663, 156515523, 1871394552, 590275639, 3237133664, 898438533, 2291347006, 644781653, 3575493549, 1206698159, 2484805619, 2931447110, 2411269190, 3866437145, 161562563, 3077166456, 792874130, 3193406610, 2500233218, 596837225, 3667458052, 3239960816, 2271901243, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 31
     {
         3975736867, 2402230281, 4092718962, 3100052505, 3277909563, 2827154828, 1067483357, 3495429909, 426635932, 2702495453, 725679489, 3705541400, 1308182381, 27549785, 3000675918, 2982141597, 1090931027, 755020243, 3986354189, 2529541113, 452574019, 2384876926, 2147764179, 1360907484, 2072364695, 
         3034185952, 2765119653, 3279755577, 3828140333, 582568392, 4228353628, 701214306, 2460043371, 3943376509, 2443090800, 2481277520, 859309333, 2928621220, 1933644685, 3803162893, 3310629548, 2361261213, 790233558, 2517540072, 2823327610, 2952921690, 3295251862, 1089451775, 2637751681, 1648031370, 
@@ -3301,9 +3497,10 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         522606644, 1925230852, 3887440328, 2111843275, 3549473366, 922916775, 2889744544, 2970467682, 3039277863, 990580154, 55435595, 1665634070, 3043418336, 2792050230, 2762503138, 1402344059, 2099263558, 3945248675, 3925566467, 2413979948, 463637252, 3768636616, 3374572388, 2217956879, 791988933, 
         382210765, 1715859444, 3462446413, 971427992, 3255404695, 2001750035, 2214129237, 320812374, 3688098101, 920365480, 2819401059, 2932570681, 3749857130, 523943786, 1271514748, 4078439472, 3501181265, 2475869985, 1797996951, 2300820710, 3994893924, 1739992082, 2475950326, 3780826558, 1018851411, 
     },
+#endif
 };
 
-static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+static const unsigned int h_xorwow_sequence_jump_matrices[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE] = {
     {
         850664906, 2293210629, 1517805917, 1215500405, 1612415445, 645388200, 824349799, 3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761, 2817264826, 3159462529, 1654848550, 950025444, 3095510002, 4080567211, 4111078399, 3241719305, 2788212779, 4256963770, 2426893717, 
         4190211142, 1420776905, 3780537969, 1102912875, 1657948873, 3354905256, 2519610308, 515777663, 3396785394, 1832603711, 1154211550, 1915690212, 1933919046, 789578337, 337961173, 1359089498, 2249086205, 3417955173, 862571348, 528120760, 1265685672, 1970052076, 3585976752, 3645339918, 312171257, 
@@ -3338,6 +3535,7 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3447798279, 1405733552, 3075862538, 1682808202, 1595154222, 1173705692, 680713285, 2748212230, 568610527, 3434965538, 1114942930, 2835858745, 2575992250, 3243355150, 2127580225, 1855934450, 3915941751, 2228679809, 1514780124, 1506688039, 1033083295, 793807083, 1120681149, 4105670165, 3999570340, 
         2083020131, 1213356023, 3684882757, 3375797774, 3577986103, 2092046164, 2593847443, 1826450612, 367828409, 3198272513, 1941316667, 943707510, 907134807, 2020457947, 1462193665, 2964617539, 4216491663, 2625270800, 2395371467, 3691003028, 3659016793, 2381847054, 3513105567, 3013019506, 2731245927, 
     },
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 1
     {
         1680024716, 2112340059, 3387475367, 2080916186, 1431532386, 3907378472, 2636491350, 2176128529, 2236616671, 3736851460, 2604001339, 3893075234, 3495918635, 4116370522, 1384310379, 3660102574, 2030233939, 2759207091, 49347923, 97526506, 2566932710, 1566181275, 3127827248, 578401670, 1499229308, 
         2581732444, 279715551, 809690877, 1438444015, 878935323, 1495277039, 3417305339, 2858903785, 3074075088, 603749086, 2370669734, 391683868, 3933465331, 2884128106, 1478317876, 1864988335, 2925823809, 4133578805, 218104493, 368652174, 1998600344, 1109346044, 1716435313, 415435111, 91393686, 
@@ -3372,6 +3570,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3373885614, 1132999410, 1097554565, 4089342358, 3239542922, 2451748646, 407290679, 3188103200, 1708016248, 26848241, 2796711130, 3090711568, 4068389322, 3420916085, 3137567033, 2877819818, 22133454, 4629160, 3703695249, 1920151708, 1175452162, 130015299, 3331834713, 1099225384, 689254331, 
         1851083761, 2654970209, 3259297936, 3742819314, 3524284766, 2291819083, 3494031861, 16242889, 3545082774, 1997878108, 777447699, 4244916543, 3508640253, 3782278393, 2107258964, 2139074576, 1383217899, 2337934322, 3181899620, 1285955765, 2989610020, 3326862146, 1168587380, 801203532, 3020809957, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 2
     {
         3810471203, 1017064446, 1595207573, 441087832, 3326746890, 3294064431, 167972517, 3625210015, 1011845006, 2980240819, 1778354660, 3041730987, 1598611350, 2015169745, 2321724978, 3390812967, 2432904511, 113261909, 3957193232, 3806115908, 2965828929, 2035392295, 3500116619, 2881232416, 1672212265, 
         1607201428, 425148945, 1262591961, 2221781268, 4215047456, 2148245850, 2787488981, 1077262192, 2085467561, 3053954888, 3584435116, 3013084787, 287099941, 1290407232, 4078552287, 2658945475, 4251530898, 2403086478, 2884923598, 3545110453, 4105390090, 343200643, 3189888821, 4086304363, 3466483195, 
@@ -3406,6 +3606,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3977128218, 424210327, 2919071615, 2715518134, 64568844, 480972649, 2488797168, 1302817038, 2213995265, 4229997295, 2200797852, 109368057, 3033807022, 1907400078, 645977948, 1410909090, 3700787906, 3375062371, 629087832, 1344281719, 4249981139, 3457543297, 1218556849, 864222854, 1458445945, 
         914545469, 3451164212, 1088025757, 1129933985, 953788883, 2406172924, 170364546, 3505490646, 1027553899, 2864067776, 436854871, 1342782209, 761167471, 2660173631, 4159507498, 4172028400, 2442254644, 2110123720, 2315991253, 873066601, 1725470559, 3831299052, 678672031, 1585431329, 3495750550, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 3
     {
         1998393432, 2665389278, 3989307699, 3267631636, 3861682977, 3243522970, 1243992413, 2200497260, 3821883021, 4187123083, 3451270040, 3044132745, 2101287249, 2340839784, 227040990, 1724350416, 3228881240, 3123386528, 4279362126, 3098224464, 2635534069, 3622906431, 206207480, 1894245533, 2152374527, 
         1011223653, 7271757, 2972858087, 207942127, 3355362797, 2593296740, 174093751, 3713822176, 4212355586, 3335605224, 1171716408, 2867257989, 1522213957, 2016192462, 4229688395, 2174928148, 1468226225, 3938290338, 493240317, 3229423344, 2585475729, 3112454413, 1881171707, 2555908056, 1997546352, 
@@ -3440,6 +3642,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         661024127, 2931754053, 3787840039, 2053363765, 363432336, 112334132, 2871797223, 138911320, 3981126938, 2027332192, 1804730644, 590150270, 641538574, 6802174, 3551446076, 3908480472, 1004531022, 2097228524, 1919074232, 154482247, 121437972, 1215661323, 1178068273, 1097220699, 2823681422, 
         262636065, 2943371149, 1768780720, 3866040605, 1855991583, 3988248086, 629223947, 3380612330, 3552916762, 197596340, 573801686, 2049230598, 2910471867, 2686314264, 1726228846, 3516983332, 726840185, 1241204222, 2237574317, 70568042, 1932610099, 2221862221, 1510378092, 4050391637, 4077539568, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 4
     {
         3872117793, 803220151, 70843412, 1661103032, 1976811457, 2186373604, 564259972, 1475436923, 2260980893, 4245534505, 1075107552, 3692990573, 370098873, 4045905424, 2420395420, 2332395402, 207483321, 622317750, 3004242500, 833623111, 3151161301, 1629139881, 352228793, 2439953368, 3183333619, 
         2703537080, 3218957129, 3164695888, 1741641842, 963394141, 4241612717, 1034476784, 2035880432, 3977821313, 1543311495, 3010014356, 1638490901, 2364265378, 3420329129, 333361555, 1133565821, 1450937015, 616059115, 3216393887, 3041978455, 3990855695, 1238628750, 512746184, 3256670217, 1616316512, 
@@ -3474,6 +3678,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2227278118, 1185927141, 1082173792, 3567361925, 1940465859, 541632942, 1830210248, 3757851982, 775883450, 1666577465, 1004944607, 878440834, 2146344131, 4195798476, 370164841, 3649112729, 37066142, 2311278904, 1935745497, 2304799402, 4107299626, 1348526232, 2473609635, 3284032699, 2374292786, 
         1762329186, 857978496, 1039346432, 2621413355, 29961014, 3582263091, 4268542513, 3890612190, 3096173646, 2026544230, 3856142618, 2347115934, 319800326, 3255916105, 2430273059, 823505311, 874255188, 1401925393, 4203707857, 4259159566, 2606881118, 1978288664, 1447576038, 3860341401, 412510348, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 5
     {
         4052471963, 683640040, 3043876021, 3466644483, 4222418025, 3035140128, 1466027937, 18198088, 3410320851, 3040963721, 488404231, 3157371815, 769336092, 3240417718, 808582581, 2075839263, 835026995, 3123726486, 3284240985, 1898453053, 3606056482, 512836002, 2715428547, 4182302879, 1644882480, 
         3160187826, 390292489, 980889545, 2776206633, 2482799995, 617042280, 3501667414, 689451808, 497018701, 238525753, 3890163301, 896679896, 1544533015, 3412477225, 3116575138, 4250402651, 3990990746, 819056741, 1459334146, 158377590, 3444755752, 8230450, 1378706455, 684191332, 3217423797, 
@@ -3508,6 +3714,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2145343886, 3712441197, 368422910, 1297685674, 4076123901, 26214470, 2948764826, 40503299, 1198194334, 2100063637, 1966331612, 2189582064, 2064696934, 1797550642, 3469793941, 2868963812, 851437659, 240918534, 365060070, 3530600064, 39695324, 1753898837, 1286976449, 3131971360, 2406485219, 
         3365373704, 3224113403, 1651742834, 587601940, 1574206085, 3739575036, 1413669616, 38172232, 293127854, 4126190109, 1891744061, 787878666, 456643669, 4228710325, 2025132037, 1492133135, 3122840937, 969442079, 3272420439, 3836126369, 1877655562, 2766212758, 3867984746, 3348077578, 1841216706, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 6
     {
         1676507466, 1017841240, 2992644565, 476936158, 2468072723, 3113105154, 1154120402, 460889625, 1942263502, 1761593999, 3020908939, 3078194866, 310971889, 1644896012, 3756044556, 3549937583, 3710822994, 3554313733, 2174654326, 4251063242, 2340485150, 950951909, 4288936895, 3744348848, 706644559, 
         1085927825, 1595992020, 3288724966, 1367247946, 2950094970, 3925419886, 2628739022, 2528254629, 3582224789, 3907345559, 3373329273, 4255542251, 1185418446, 4018656113, 2854344020, 1381160022, 3642438773, 4284399225, 935780030, 4142412144, 1263328494, 1154237693, 2684443667, 3067549398, 4253090033, 
@@ -3542,6 +3750,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         1997423206, 477446533, 303090065, 757937082, 1523238256, 3140505311, 1422588701, 3642014639, 1740624195, 1276017154, 3072526193, 3675105122, 1335122682, 4080595263, 2308519420, 3299182769, 1461978532, 3098694217, 2982399822, 3088698511, 586759229, 3548750902, 1449857891, 2866451663, 2525162286, 
         57294602, 4107991297, 1214672265, 2940391280, 4285346034, 3338216759, 737207923, 4264163846, 59219141, 2300024654, 1876616814, 1976543605, 783571061, 1724699622, 1967524469, 1650309916, 3322257631, 3975521122, 273342162, 1156754241, 185315896, 3368133921, 66314655, 4153777915, 3519901897, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 7
     {
         3672467167, 68684525, 1738833632, 3081329135, 2583806115, 2291130512, 503032614, 3658059597, 571493931, 685537959, 3498787788, 422428426, 3879256913, 1173158320, 4000800121, 298972869, 1718342816, 2541691685, 2490502642, 2321452806, 4223212804, 1812334632, 3717655725, 4238191852, 3001307165, 
         2621896355, 2572404999, 3590094954, 760765206, 2293618001, 1392353032, 1733137169, 2674005018, 4067961151, 1505710487, 451078217, 2591688848, 12635611, 507045428, 694822241, 1789383090, 1140183890, 1720695967, 1994318191, 3340349873, 2793804971, 1054433135, 2345087879, 3179939285, 1651968615, 
@@ -3576,6 +3786,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         4285497594, 915263578, 1486882838, 9988613, 829077170, 677216046, 4141828204, 165804609, 1086678519, 2933434608, 1351662802, 2640085040, 2611502932, 2033698714, 2008873254, 3995557835, 1020873906, 67873555, 2230337823, 1263800417, 1148712155, 3985159589, 2979503513, 2854714997, 1539343345, 
         2751484352, 1569100732, 2020758949, 2126757134, 3426641899, 2808587825, 1953320148, 1096398464, 1502907172, 3751230087, 765557661, 765290990, 3056075500, 2040620632, 422573751, 3613558930, 1741145769, 273531216, 837238736, 494297893, 2903251124, 1636782182, 4256592784, 3652746656, 4258393217, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 8
     {
         2657510202, 270297201, 2970166904, 3151626326, 973127447, 1523852613, 598650578, 10289043, 1138773500, 1379558769, 2202575480, 1622690708, 181345079, 228706650, 2807760507, 3061024281, 2310359315, 3094465578, 4062753882, 2744510393, 3844622451, 1759718963, 2393602744, 977540509, 870449791, 
         1484134272, 2838962253, 3079492430, 2617141201, 3744868057, 994295425, 1302594555, 277777192, 1793039043, 1620482692, 2518563014, 1163760339, 2709515777, 4220588138, 531143270, 2528377633, 931694828, 1472659070, 900489303, 3538137811, 3849822545, 1304182427, 2423451948, 587259647, 296795227, 
@@ -3610,6 +3822,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2001895525, 2673649961, 2106555006, 1762053005, 2334552700, 26094213, 1184502058, 2048598709, 4039640450, 1439363714, 1022688817, 1053169108, 170896272, 444231850, 1500204748, 1077470703, 1630597179, 1382588806, 138805391, 1636536505, 3118018426, 3461152216, 2486547351, 2045361316, 2976067436, 
         468876399, 1407419455, 3226137264, 414206328, 1011039713, 3537947031, 2359787831, 258556532, 3615987029, 3372097337, 3586352388, 1056198830, 1852291192, 3888893481, 746156045, 4203877603, 297851145, 2615507398, 1141098641, 1881412583, 3014341741, 2125186797, 229307235, 3476606674, 3553854689, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 9
     {
         3768542219, 2777948797, 3328832678, 3488502819, 2708053041, 2217907094, 2133505056, 2218961277, 2148551748, 1420045625, 1709182366, 1816409641, 3791695288, 4207813971, 22588497, 2211317602, 616238454, 2394270012, 3212896041, 213408768, 2199328374, 3188624050, 811443809, 2818548979, 3150758902, 
         2022548260, 2462701924, 3793704672, 2358080321, 483288372, 450033142, 772942770, 2224873625, 241543410, 312552314, 1268067149, 915918620, 3906238422, 132545832, 3486041298, 2414090506, 3798383292, 2257004699, 130309284, 1158673651, 152325583, 3499865580, 4094273597, 1029041593, 93538481, 
@@ -3644,6 +3858,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         4095583159, 1796641692, 2518000547, 3621187982, 501166402, 2112782420, 1704276185, 2249859782, 3754293422, 1942321901, 1851019104, 240158224, 3181132144, 2281632719, 808029657, 1721710011, 2287207169, 3044484177, 2363339534, 805273402, 3696016147, 3549191229, 3353631259, 2946802391, 383414270, 
         300735554, 471515206, 1907815837, 1576327662, 3825043525, 2817119733, 1973847200, 1398317206, 2221853087, 501440864, 642467132, 494410179, 1191241925, 3549838846, 3621239619, 2640266286, 4140123024, 315957218, 3696758268, 2502777875, 2150738616, 1570099119, 2598276767, 3585886712, 230047417, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 10
     {
         220882755, 630187688, 2600079656, 3103815531, 4259457395, 306940008, 760977254, 558299017, 73879495, 2342545344, 572800511, 3922797738, 3754011306, 698257357, 1274843132, 1455757442, 1014649591, 3205662508, 2997738251, 613949432, 2267018388, 2925762681, 3702061213, 299380602, 1711070497, 
         4140032336, 4134705925, 2836703879, 3776863395, 507121465, 3480792188, 1862887216, 247780795, 2528677869, 2881446422, 271754977, 833498724, 1489102731, 3636156177, 1839744487, 2011839858, 2353400914, 510437606, 561141583, 2979592314, 3844268262, 3011027242, 3113817193, 3491178377, 1448376742, 
@@ -3678,6 +3894,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         170401553, 3456013554, 3395842846, 508189059, 3398715186, 3862791669, 2741070272, 65318715, 1933435210, 4086198650, 3033193928, 1242412691, 3397363281, 3187419149, 1019508117, 562380742, 961415837, 2990412400, 3597720222, 2754100415, 1793508822, 966564784, 1875616532, 394646945, 1386107842, 
         2750810827, 2931007937, 3356489930, 2358364634, 3703772713, 3188884403, 2793590498, 3285138686, 515002680, 521510516, 887213583, 1873460781, 1583027667, 613895001, 557578628, 1892686243, 1974572772, 595831726, 229299738, 3847982294, 448248098, 1493822844, 3326405260, 2752463855, 128616819, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 11
     {
         2014765631, 3938779303, 1811986049, 2101875601, 887194972, 3966228860, 3450775746, 4026039255, 4082308025, 432404123, 3181099213, 1228097256, 2368258457, 2953933351, 2582232464, 1657799516, 3525421629, 3927364159, 978138132, 3603597064, 342571522, 2100072168, 676229632, 2062864895, 3713317279, 
         4255773013, 1179492389, 3501226604, 1641801113, 2066614519, 3303232023, 1717768923, 2333501450, 4246883128, 1655087824, 1547897374, 754215285, 2832638094, 1365153701, 3309513970, 765738141, 1177808869, 324127419, 1171195868, 3494966448, 1714410667, 3645762436, 603810292, 489970006, 3126166124, 
@@ -3712,6 +3930,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3634834949, 2584809384, 3638373352, 2603765126, 3223396315, 4021061386, 2143780551, 248332433, 3654752967, 27201989, 3994156272, 5505477, 4260955724, 1175998822, 2665646240, 866875674, 3569324422, 202962714, 896177244, 3146417201, 1168925859, 2228636445, 105395449, 2567482935, 1301265751, 
         3739617610, 2486939910, 1891847857, 2647840744, 1141826566, 3360553996, 4267671927, 2546157872, 1143297884, 2049385137, 4288036836, 3347190546, 3480408604, 2756408254, 2396048567, 1151717877, 2211243289, 4221659024, 21773193, 1665317870, 3116384869, 3231689469, 3689471824, 1520574310, 463615415, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 12
     {
         2647200400, 1592194261, 1289872755, 2079982087, 3431487085, 1101851783, 3373292799, 2148994262, 2785319928, 3206527339, 2731839331, 1280366172, 1146205735, 2930495205, 2876978398, 3885758458, 2062812458, 2448488486, 192141900, 3861696664, 2677929258, 3606729729, 2920965773, 1156521508, 3168665640, 
         298794036, 957896625, 2606719899, 3699219026, 3120096333, 2531109351, 1920936462, 2848868175, 1406404729, 2956672675, 1376226240, 3667482110, 2551426756, 3433640449, 2603906744, 4217864690, 47671552, 2993859190, 1269153270, 3463588775, 1655126430, 3453916724, 2157890969, 252769449, 1583335064, 
@@ -3746,6 +3966,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2316834456, 1736616135, 1575712778, 370866908, 4256943043, 2805503887, 1099763491, 2473785999, 3215573143, 472701386, 3070116154, 3969279119, 3331310102, 3932945670, 1502564397, 1294139579, 3073834823, 3115143551, 3602082994, 3707103500, 2570195094, 1268510174, 3561337287, 112422529, 1483304061, 
         3712148969, 3729628891, 2741131557, 4035019342, 2395091348, 208448216, 607199897, 4049058939, 3463267226, 3821711834, 1697628853, 691151709, 3014869414, 11610545, 3895793639, 3019679196, 1246664817, 753245113, 2236232962, 4172861179, 4030183420, 2367787106, 2209331085, 4170801007, 3609895913, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 13
     {
         930278208, 223382535, 720499309, 2613473585, 4173439516, 2132019243, 468054579, 1141433627, 1328639101, 3222455434, 4023859457, 892124224, 2940688706, 2894552260, 1595432126, 2558709596, 2057191226, 1116728192, 3767370344, 1457278707, 3171850455, 3733161247, 149922078, 3860652874, 743952057, 
         1024625539, 3982786483, 2077838781, 3713742913, 2790452624, 3014482913, 2928857967, 476371337, 611803300, 3000092437, 57069608, 1554852195, 1406780525, 2288998898, 460131340, 3945168588, 18495216, 547882902, 1624966119, 2229423551, 1492565146, 706052879, 2733955743, 1450476708, 2565285196, 
@@ -3780,6 +4002,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3522587233, 1686032132, 586483076, 1207387616, 3040778905, 2532774045, 3681992451, 1034866888, 4029685195, 3307070989, 2412903766, 3156200186, 2625083166, 4148004113, 1756566287, 2319065855, 2924909429, 3050022486, 2464491722, 1137782196, 2749457821, 790410752, 3511746957, 2277733721, 2871407058, 
         3858561909, 2176119631, 952943025, 2987154266, 120799539, 2862346597, 3689389598, 3329995989, 715438735, 1035277216, 3079684809, 677298106, 2364292665, 4110165256, 4096954153, 356732100, 2361282903, 4050817284, 2010946835, 1824397679, 4087204231, 4178036725, 4197370951, 503070461, 1879838906, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 14
     {
         4117851084, 2941903397, 1156439261, 1922510465, 2925632294, 2272105738, 641404242, 3414739418, 2602896978, 672876430, 1998875331, 1325970749, 1633717408, 3567722815, 2088144733, 95705225, 580635702, 3543633503, 1469889369, 239816045, 2254984383, 1632695776, 2033839470, 4117902893, 509938588, 
         1291002316, 3600816069, 2962644092, 4269959520, 3161890066, 1908855486, 1177948589, 473118979, 3205649854, 2027137481, 227656706, 1485922673, 3380103860, 2080286336, 2588604114, 1727893393, 3602757903, 3126385963, 2101893784, 3058515017, 833779022, 719369683, 3768029740, 1123855192, 2580550821, 
@@ -3814,6 +4038,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         32800830, 324902076, 2365753207, 2251160429, 1692543836, 2920424644, 119047416, 1821685115, 1486296407, 3055580738, 3711421730, 1522703457, 1422399573, 2515073038, 3788816887, 3490575947, 2395299159, 4248373284, 3383561277, 3128107243, 2344292809, 1806504793, 3087395022, 4113720664, 2749262038, 
         395148869, 1331347439, 2682558741, 1253966763, 4204248490, 2083995727, 2717069903, 4144872894, 1857751053, 2166276701, 1419950839, 1145170701, 3225260742, 211743500, 2746391743, 3333387219, 4115426799, 3801457092, 3327614811, 1460971336, 2256342146, 3186427137, 2684216499, 1035644397, 2948948308, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 15
     {
         216975964, 4145824263, 2147471723, 4154469597, 161744273, 1299764439, 3468614543, 4190517158, 4124232403, 754999274, 208153182, 1442063188, 2940825403, 729331312, 2124186505, 1136411459, 1083787490, 442264548, 442338468, 464589685, 3509461223, 4241734851, 370778328, 4003105058, 3163637982, 
         3747133182, 1433548371, 1876378240, 536564977, 1171222160, 3268902719, 2725776746, 1547771137, 2818791461, 4129042013, 2677094853, 1594765197, 1556725424, 569252594, 2640731848, 2947042710, 2633188904, 1640957370, 1806863786, 2803403654, 2632220187, 2740076538, 383549855, 3211856699, 3933793958, 
@@ -3848,6 +4074,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2022522416, 719777136, 417238676, 1865171065, 801820378, 2836941189, 1148226009, 1713866138, 64608707, 1458585813, 3581572089, 2251042907, 1818903516, 3278072806, 2838874249, 2665607605, 3360214955, 2185961451, 410342713, 364484774, 2887998484, 2100888426, 1394314931, 1362560504, 3487221127, 
         3140021092, 3168968161, 1613267484, 290430673, 2588210538, 2493788232, 2641638765, 2971195072, 2749469779, 692014176, 3268150742, 387451740, 461249727, 3579417331, 3738405845, 385445455, 1464799053, 2786433795, 3370371952, 675344511, 4049011269, 2196568686, 4166285481, 2547135972, 119952106, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 16
     {
         2307933966, 145940188, 4247815717, 2995341855, 3245382498, 1213200792, 232910392, 2718014238, 918321585, 3583102265, 3176078796, 937696513, 266558688, 1520650260, 3655025189, 1653323191, 538426778, 491545855, 4064663509, 2788350755, 3941259490, 3471552693, 1851151228, 3279627338, 845228710, 
         29883500, 1503432309, 593880175, 2488716480, 828058076, 3287933183, 3510981973, 3970051135, 3803049980, 898259836, 2890959433, 234437380, 201835406, 1523016285, 2419577439, 2943482079, 4219300984, 1490698759, 533411805, 1644926459, 4097374623, 265292490, 2694560848, 285667083, 1563945375, 
@@ -3882,6 +4110,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         475697670, 539253230, 1256048653, 3819847913, 141216227, 3888391528, 3567424851, 4131097532, 2142453586, 3606575354, 3689715433, 2318212425, 3026095399, 2451038695, 4052322172, 1861782452, 3032216562, 4078403318, 2636775961, 2188864067, 3276459319, 2230349722, 3939784264, 831216291, 2483460713, 
         2571551493, 484276565, 3173595164, 4177831244, 4132249231, 2116763555, 1420812998, 2121017321, 2855491215, 1630144518, 2489688364, 411521312, 3713786536, 4177871972, 690465497, 855092147, 4271606539, 1265108699, 3757106624, 3151574897, 670335437, 3099376310, 3946436509, 1795346235, 4013409945, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 17
     {
         650684252, 2220445579, 537394374, 571322423, 2781663439, 899394682, 364129622, 328438826, 1219862153, 830435885, 3278649457, 3072225531, 2838645991, 3150905380, 1251952499, 1751415553, 2034088483, 1437197870, 1907624878, 1786974150, 4207811086, 768131803, 2713210999, 4004509777, 3510764535, 
         2740991637, 3000313526, 1355959320, 938244439, 4093313692, 2476002145, 835527260, 2084758949, 4223775017, 91645393, 2251723899, 3159477758, 2008655575, 912220875, 1525327655, 2067948386, 2006141522, 450235614, 3945671083, 2852189452, 3804118704, 3302604345, 1712745267, 349281154, 19331179, 
@@ -3916,6 +4146,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2008242014, 1138475935, 3044902216, 1917596533, 2905651936, 3320601534, 1468557693, 4101437636, 374575138, 730079080, 995340259, 1430552870, 3860649629, 541396702, 3413070856, 3052797396, 3591116740, 2811484252, 2464310183, 1597327051, 3288232619, 1564716093, 2838386049, 264313861, 881377066, 
         4165178494, 1069189853, 1045737884, 2072266205, 2700673629, 2338724235, 837702541, 2603464957, 1548182143, 3565539962, 38172869, 1949065935, 3628598166, 2788698071, 3531182193, 1367529788, 3902468811, 1215323634, 1117475027, 3901912129, 2678279671, 597953858, 4082485755, 3696533122, 1078703353, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 18
     {
         590004384, 3025338414, 1764374188, 20686172, 932343559, 1798441768, 1013577341, 4275903797, 853441141, 1065980978, 3665193407, 1555165047, 2962781443, 1822487181, 3329200135, 1527094489, 3805115799, 2252376033, 2137546519, 3632426270, 2439842864, 2525211849, 602876448, 1488163727, 3169015136, 
         832084039, 81097112, 994974428, 1945411347, 1020609213, 2863240894, 1639194881, 3078842449, 1885382385, 2595105518, 3857547190, 3654577058, 3853111480, 2237941224, 625422255, 3292783340, 750206381, 1002246874, 900879607, 820635221, 3318328110, 3980484559, 3924790669, 4260574943, 3658381114, 
@@ -3950,6 +4182,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         1409945926, 3617206544, 2383446356, 3452204096, 615486157, 720696019, 1730134434, 3918468503, 1629431965, 2174079220, 325852294, 234479771, 1490297289, 3579002992, 3538738636, 139386548, 3067789050, 2078261059, 3552654276, 1774602596, 2105142163, 2768099869, 2265044995, 3680536732, 3601322356, 
         2848878442, 1166743022, 3508176959, 2186695985, 550278868, 3324775634, 384537301, 1019044102, 3354263542, 1942540686, 922714337, 3097711558, 3074228403, 3565076630, 3459053081, 4128383906, 1114387332, 2101424539, 1192649508, 58778130, 1651798895, 1752063480, 1728826905, 2225187635, 2463770127, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 19
     {
         1978406995, 576106282, 2238958298, 2073551095, 624788087, 4231569260, 1853272808, 238274694, 2389334758, 410188028, 2293786099, 4243662908, 2317700970, 4050493361, 2348206908, 485250660, 1212732903, 169414736, 292623762, 1602229231, 2466348869, 3063669700, 1872890881, 1887188929, 3447638989, 
         162521682, 1470651713, 4036975255, 3423782623, 4043724693, 1686690883, 2610958712, 35940353, 78593759, 1565950713, 1304303952, 2004267248, 1417268036, 3328228522, 789915977, 2567452041, 3564175714, 1838409932, 1455795236, 22377452, 455201131, 3340286965, 184599544, 4102076073, 4007870762, 
@@ -3984,6 +4218,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3891512282, 1561648319, 2690491944, 3075246584, 3202791012, 315381589, 3645907425, 3532420114, 802256935, 1270128258, 2695868207, 4075358890, 3888212208, 510396943, 3683116722, 3943939501, 146061942, 733291914, 1402325031, 672641124, 2817168601, 2622398925, 3641379870, 2969146913, 4232866548, 
         1694492034, 3065141682, 234404736, 1921499010, 2300706258, 1304904939, 207802178, 2674605425, 2688377241, 2674991105, 2585496531, 2358858923, 2578793432, 3275116043, 228073476, 2936443283, 3713102344, 1629243323, 209348683, 3730808488, 275442226, 223820143, 2365614109, 3017206322, 1906208795, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 20
     {
         1545504510, 1985586093, 2005504076, 2487099791, 2348737867, 2254755902, 3789154730, 3268946922, 99552511, 1369361877, 1888041043, 3105269579, 4044127396, 2380045264, 2970234287, 293292961, 1811276320, 1083136897, 3016497500, 950611584, 2165628367, 4140133899, 2402926185, 990501164, 2185997143, 
         1769871204, 721625457, 567446962, 1695515231, 1848699963, 4163520111, 2316975723, 4268269680, 1021066723, 517434635, 3827063239, 3483118065, 760366769, 3072996795, 3548263896, 2131401627, 4167855065, 410255606, 1992500865, 1322267629, 1599293552, 2389387938, 3721625360, 216375429, 2002236178, 
@@ -4018,6 +4254,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         4195548426, 3641578987, 990686800, 2391278490, 2233755358, 1739784005, 2458544650, 340925249, 2442887806, 3503407512, 3058778909, 3619026333, 2289286518, 1296212011, 3879317178, 1210295163, 3113210467, 1578990986, 641384071, 2437977832, 1689385197, 1323268226, 861337916, 3532905860, 3735971843, 
         2294673483, 1032787575, 1868992735, 4260308791, 2091311463, 2354047234, 1005300697, 29821726, 2790044161, 3154591207, 1370229266, 3464848205, 3855301526, 544374401, 101012897, 4214903025, 1310520049, 14884434, 1438288148, 2118574986, 2360002070, 512167778, 4186534704, 3633828199, 493600836, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 21
     {
         2932801042, 4101748508, 3363559072, 1213475638, 2400369070, 1726749444, 3175844814, 2600020277, 3779799804, 1886667522, 1228105891, 589138388, 3960459504, 450669757, 3773736740, 2107201112, 1437834675, 3618095315, 3662453347, 968349971, 1891706458, 2333451375, 4242907074, 3265111057, 3648168902, 
         4137035018, 105573058, 2075999861, 1053920954, 3768713177, 1836088599, 2015103258, 2649187541, 2717894301, 534937136, 3492326400, 2406499346, 617315838, 1384748442, 519804615, 524657043, 832148261, 156272480, 394759604, 2428809631, 3401589884, 2588359262, 3826333418, 2427993050, 3254067543, 
@@ -4052,6 +4290,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3589621009, 3800806613, 1102108318, 1376914700, 539544394, 799741508, 1192097712, 2894663754, 567276527, 106814343, 3985577014, 422246623, 126568764, 4008211389, 4037889581, 2185357423, 2239644921, 2116447019, 1249715620, 2095747493, 4063243162, 3059330950, 1045571624, 1150656233, 3024439196, 
         3981904623, 1743764595, 4220253496, 3322182853, 2132911849, 2074342674, 198749193, 574306951, 3563262292, 3832626833, 2349475213, 182567249, 1530390173, 2066055611, 2609802571, 1392638962, 1495846580, 2356952332, 4029921749, 1731839848, 527880959, 1204112231, 938004695, 294300378, 1855457892, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 22
     {
         1438083560, 1727969469, 703174449, 1296281193, 1386452240, 3304170302, 3048300096, 277697908, 2675939661, 3382564518, 1639425457, 2210719281, 3173605115, 1685375802, 1317820682, 1960916541, 4230888182, 1924357010, 3322827982, 1663716994, 976583570, 4146230815, 525755678, 3608894680, 1715438458, 
         1519478303, 2845291872, 1115405802, 2468673244, 2289739992, 46988928, 2559411080, 2466723374, 2995303634, 3871022237, 1794652692, 2424766096, 2849910020, 978542234, 1667051478, 3393290740, 1508376445, 4090541488, 1314139749, 1271060027, 3272019878, 4032394060, 757805987, 619143288, 1165760536, 
@@ -4086,6 +4326,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         285960682, 3801150032, 3948820512, 1677682247, 1735541155, 1914753931, 1965156079, 1875233710, 681418791, 2077804400, 1963479724, 2447942398, 269798686, 2740088859, 1974178779, 3373487761, 2879779843, 157827737, 3855390825, 2779173093, 2359181541, 3508102362, 4001266348, 3949912729, 3232414439, 
         472195874, 57835121, 1854343116, 3020785997, 2024437594, 2182964208, 3379376555, 1213864603, 307833006, 1029130725, 545051507, 4001695571, 2258480284, 896286117, 355474524, 2514583184, 2997458384, 3278715462, 1675341954, 3603020014, 2318410671, 2152785892, 4285597912, 35655711, 2087100216, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 23
     {
         1671155, 472949658, 148656515, 1640075411, 930771231, 1601854390, 471598090, 2013359012, 3708325970, 1688441844, 736452516, 100585026, 1154373750, 4029833741, 3409420465, 192349301, 3804215437, 909027311, 2896874106, 3567276364, 1319305666, 3858990362, 3155018279, 3756192170, 3567813642, 
         228734829, 577956164, 2078807284, 1005987081, 1464380935, 112604551, 3865074232, 3776350052, 1112767766, 2947509331, 910887552, 4127297396, 851240323, 3136588838, 1639013085, 1154068086, 639126620, 2501600773, 3174842042, 3456593672, 80596481, 126970446, 2184239961, 1448001095, 689252599, 
@@ -4120,6 +4362,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         797817618, 1736047766, 1537439339, 1422940895, 2210817855, 2888194544, 800138109, 1689425315, 87966703, 3800446188, 137301285, 3334431104, 1776710491, 4010349050, 2577018472, 3083459223, 672158271, 3379478560, 2445459713, 918903140, 2577376693, 273150303, 2300393435, 3529750006, 3941920515, 
         2590879584, 2005940914, 2533952036, 2918638361, 1907638097, 959011520, 1477207871, 2141548481, 2065858781, 3145892196, 3679867589, 1295127682, 1325838381, 3482593404, 1212565985, 3404887017, 709111097, 1714185234, 561489165, 3545430079, 359778601, 3034684349, 2235482356, 2263913966, 1397371482, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 24
     {
         170295791, 2753410803, 2200994594, 14686027, 3460333923, 1523230564, 393272614, 1632665034, 2139771608, 2436912103, 375335282, 667585308, 3651645415, 1403132103, 4146144245, 786890392, 1349234364, 1278024517, 84921263, 3758850381, 4213552796, 2355655048, 1636349912, 172797504, 2490691729, 
         1233059003, 2593048824, 942056581, 953415060, 4250104075, 787552244, 1995239637, 2482815609, 767530774, 773778243, 841396894, 2718419035, 3363828032, 737774143, 4128182656, 2335090807, 1421795969, 2322011430, 2808330380, 2207840656, 1646731611, 492284258, 2339383764, 3439685708, 2316859204, 
@@ -4154,6 +4398,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2359948129, 1158552196, 2094484627, 3077606843, 2119537593, 427023787, 3632076073, 2670551310, 3396099733, 1066081183, 1817788918, 324769315, 656687887, 202117575, 3106428593, 3730407212, 1661316263, 1215084998, 2025391552, 664352483, 1914686594, 9439399, 2548190484, 3127972014, 4008228378, 
         2645735658, 2191361716, 2211450148, 1863406291, 1179298131, 241880428, 2330159770, 3490494273, 1337382890, 747522461, 1060348557, 3618051469, 991193538, 1604905367, 2595102954, 1460144089, 3990194961, 44265425, 896268152, 9333748, 2850675977, 941433385, 2483544989, 3443750079, 2488690792, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 25
     {
         824297644, 239464654, 4133652405, 1611614045, 102133367, 1780659362, 114934718, 3793050817, 3286619856, 1323742990, 3487325492, 468742651, 271433491, 3474195023, 479173886, 3282693508, 978269731, 1826990521, 3664994445, 1943608646, 2356793330, 2228748670, 4238523810, 2467714013, 1732683390, 
         2345218001, 3371637369, 1073602848, 844797255, 3881048480, 509186599, 1399427071, 3815270778, 1505666412, 2616384981, 2990167853, 3716581225, 3063486812, 1568307898, 3262882991, 1455926070, 3011806226, 3803364927, 849372289, 2382885729, 3071102985, 3838244574, 3219174218, 847830757, 1414310383, 
@@ -4188,6 +4434,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2691769282, 3572566918, 2910149226, 3659418019, 2511762503, 3869838339, 1413312151, 1939339596, 801124461, 760477862, 2416958233, 3439465675, 3561763524, 1760392811, 1582406751, 1203071257, 755811399, 2675585013, 1150664766, 3515765747, 3419135844, 2076543342, 1191918544, 3644819073, 2195875022, 
         2909071148, 3385707813, 1151273265, 1467337419, 3570589492, 3742049917, 1609858615, 2964509119, 3747960348, 2825858640, 101501715, 1234710482, 750428334, 2870070395, 416615350, 4054039387, 3807926874, 3035407103, 1644560291, 2490941295, 963796562, 3233132139, 2590859502, 2845243609, 964355909, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 26
     {
         2882980002, 2211288683, 872766101, 3713771728, 1429983118, 2069599564, 827699420, 1288565883, 2985727214, 3873174741, 2138389854, 3915615927, 2759028650, 3120611541, 385953581, 189931252, 2044235060, 4214733958, 1899137741, 1973215178, 494148492, 1550568689, 3646957712, 3764784141, 1114556979, 
         1411407684, 1194906295, 1718808623, 1809627046, 1413570172, 180837718, 2588730975, 1481586714, 2836300053, 1967135375, 4010897189, 3392273121, 3466021198, 1182364160, 1364130321, 1795412556, 330320182, 1165093128, 2125767818, 904192995, 51833064, 232302906, 1834422179, 476731510, 3484170517, 
@@ -4222,6 +4470,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         1933504723, 3110735238, 2333178561, 1577381363, 595257962, 4120745072, 960219089, 2591080970, 3354222743, 47827627, 3759509914, 304815919, 2643673615, 1381570381, 2103367217, 2440936991, 2376721005, 1483630814, 3137202706, 3075255640, 1743649605, 3649754571, 2550788713, 4281983459, 904183710, 
         4243944530, 2742129811, 3363501626, 3670239155, 4233018118, 2615012385, 1420298161, 1251344091, 2172588631, 1243035186, 1724496237, 762022558, 8747231, 334416849, 1219880856, 187900356, 2527057367, 1730455958, 3240238410, 906024910, 2351575735, 4207748622, 936139767, 1984289988, 285939331, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 27
     {
         4246897171, 2217508286, 4117450683, 4110626546, 3753823387, 3977667932, 623718443, 2276396692, 3772091798, 2272323453, 710314822, 3733316262, 1497955597, 700242668, 3582720207, 1247731879, 336477088, 532374143, 1123157198, 123828173, 272472192, 2142741093, 2557920990, 4209595119, 2807266578, 
         1516814248, 4250883502, 1967663703, 215335417, 1252724071, 4267389372, 94668579, 1980152960, 968677393, 1237744359, 63833646, 2488747616, 700459471, 744977323, 40829823, 955400639, 37187948, 53133706, 2014551043, 1664982537, 3342787122, 1549278321, 1245110464, 3424539081, 2180485253, 
@@ -4256,6 +4506,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         2315051975, 157809758, 1148939942, 3060024350, 1464284678, 3209480975, 3961060416, 3481639206, 4113344379, 3475766200, 130581501, 1844026536, 2661594012, 3145812007, 3233175620, 2549419093, 2612966733, 1348260920, 740167863, 226231218, 2631972701, 2148020402, 3399479414, 1074946996, 30872114, 
         1342415612, 1071408471, 1141719547, 332346805, 1473336719, 4207932404, 3668838170, 3154502882, 3892070442, 2812790310, 13931822, 1150258251, 2369539473, 640926011, 2991135002, 2410382633, 548200125, 3977740663, 1245837867, 2378569399, 1561469990, 2437445882, 214387770, 3329587833, 281635893, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 28
     {
         1720103319, 2201367526, 1415072072, 2446588589, 2195586017, 3817930623, 653121934, 2766514657, 765921436, 630082485, 2990883045, 3304472999, 471385134, 4097977544, 3749829028, 3587534772, 1064359851, 800061060, 2844220510, 389838005, 3681318140, 1515923235, 1885079324, 713031018, 1962734763, 
         2288160004, 1983331336, 1247350521, 4208372034, 1444837930, 3549494305, 4169715512, 701313302, 1118275019, 3118975645, 4153969630, 3516491181, 3601057044, 2509222288, 223064937, 899123842, 2574531231, 1386928111, 3790651401, 1300768348, 2038833061, 3736517792, 3850203561, 1679542285, 3391273474, 
@@ -4290,6 +4542,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         3882002482, 3838480186, 823643071, 1244220618, 1227720039, 1343395654, 4277277976, 2612321540, 3013674017, 3658064522, 2573775167, 142767236, 2545708383, 1740478937, 809036862, 1492188594, 1294286248, 1093543858, 2944418375, 2981996479, 4067464923, 3071157685, 1938984450, 81707323, 337713546, 
         1849381296, 3447450393, 3551106302, 3394545269, 3167744716, 1815294624, 3244728913, 2462138247, 2286711732, 3023116169, 707366723, 1314169762, 1511231537, 2227622993, 2876600706, 4271030726, 2020521540, 2966596767, 3964589247, 1291306737, 883851756, 1355819080, 2834319249, 3825063450, 4205423325, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 29
     {
         525214560, 1972466543, 1542775297, 3030388145, 2623763324, 1445252054, 2315649878, 2940376435, 1322155857, 2007925719, 899111545, 3946601974, 720416639, 566341007, 3830971140, 2379218430, 946001131, 324551023, 3792134824, 2419222364, 2507004728, 4050415702, 2934667964, 3435655480, 3738151878, 
         340092998, 429296098, 3804978739, 1547120540, 976306993, 1134820236, 288696971, 292350374, 423348923, 4250561112, 1380146522, 646098313, 3081299572, 3633231429, 2348008746, 3250735726, 3495239618, 1083361876, 2660545988, 97607299, 741626628, 2451882102, 607936604, 1566190301, 3752644837, 
@@ -4324,6 +4578,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         765377308, 961452970, 4247303973, 2233034754, 86997820, 3495561473, 3075957349, 3152032365, 1220657606, 708134514, 26714613, 3749542051, 1640668224, 2252760600, 1635050662, 947216628, 3612773344, 4089189500, 3647048119, 979491227, 4149824933, 3160885292, 2808843788, 998859510, 3903167193, 
         1728999561, 3673946130, 279338980, 2507635299, 1614929524, 302060483, 2874453052, 3798613814, 2013436766, 3514754020, 2923162106, 2658720327, 3498579091, 3292220096, 3796129102, 1907288796, 2820663603, 4276052248, 247755133, 2088596201, 3154955976, 3309397641, 3606171919, 1356791029, 1030266022, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 30
     {
         3868946146, 1938156793, 1877502872, 1408917625, 1549117911, 2465501566, 4218547770, 2942249332, 2731789075, 2366036899, 1312641799, 2243363271, 2238839307, 384814263, 1552361757, 3521369641, 431721717, 3089625732, 1023760034, 53847139, 2240881978, 3178046414, 145135653, 1580878781, 3500228040, 
         3360910006, 3285542950, 3330062556, 2870158227, 1481496810, 4222704363, 2973046526, 435155769, 3234730070, 3306545960, 2539776908, 3991420334, 125389349, 2397544348, 2504790975, 886432257, 1804136430, 1506551086, 219847214, 890282686, 1489840806, 2536942497, 87527661, 1822718904, 3984956867, 
@@ -4358,6 +4614,8 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         1522694503, 3857782840, 4282681349, 2229263718, 4106780914, 125648941, 1933617693, 2971178569, 3537872030, 448962137, 652123777, 2393871920, 3938047691, 244410098, 3110791961, 3122318189, 877378106, 3683644255, 4279094311, 3638987055, 667681197, 1679868535, 1938378101, 1331340184, 734163051, 
         3409564713, 955108672, 3969637663, 156515523, 1871394552, 590275639, 3237133664, 898438533, 2291347006, 644781653, 3575493549, 1206698159, 2484805619, 2931447110, 2411269190, 3866437145, 161562563, 3077166456, 792874130, 3193406610, 2500233218, 596837225, 3667458052, 3239960816, 2271901243, 
     },
+#endif
+#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > 31
     {
         3975736867, 2402230281, 4092718962, 3100052505, 3277909563, 2827154828, 1067483357, 3495429909, 426635932, 2702495453, 725679489, 3705541400, 1308182381, 27549785, 3000675918, 2982141597, 1090931027, 755020243, 3986354189, 2529541113, 452574019, 2384876926, 2147764179, 1360907484, 2072364695, 
         3034185952, 2765119653, 3279755577, 3828140333, 582568392, 4228353628, 701214306, 2460043371, 3943376509, 2443090800, 2481277520, 859309333, 2928621220, 1933644685, 3803162893, 3310629548, 2361261213, 790233558, 2517540072, 2823327610, 2952921690, 3295251862, 1089451775, 2637751681, 1648031370, 
@@ -4392,6 +4650,7 @@ static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][
         522606644, 1925230852, 3887440328, 2111843275, 3549473366, 922916775, 2889744544, 2970467682, 3039277863, 990580154, 55435595, 1665634070, 3043418336, 2792050230, 2762503138, 1402344059, 2099263558, 3945248675, 3925566467, 2413979948, 463637252, 3768636616, 3374572388, 2217956879, 791988933, 
         382210765, 1715859444, 3462446413, 971427992, 3255404695, 2001750035, 2214129237, 320812374, 3688098101, 920365480, 2819401059, 2932570681, 3749857130, 523943786, 1271514748, 4078439472, 3501181265, 2475869985, 1797996951, 2300820710, 3994893924, 1739992082, 2475950326, 3780826558, 1018851411, 
     },
+#endif
 };
 
 
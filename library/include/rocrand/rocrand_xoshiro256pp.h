@@ -0,0 +1,324 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO256PP_H_
+#define ROCRAND_XOSHIRO256PP_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand/rocrand_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_XOSHIRO256PP_DEFAULT_SEED
+ * \brief Default seed for XOSHIRO256++ PRNG.
+ */
+#define ROCRAND_XOSHIRO256PP_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+namespace detail {
+
+FQUALIFIERS
+unsigned long long splitmix64(unsigned long long& x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+} // end detail namespace
+
+class xoshiro256pp_engine
+{
+public:
+    struct xoshiro256pp_state
+    {
+        // State words (256 bits)
+        unsigned long long s[4];
+
+        #ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+    };
+
+    FQUALIFIERS
+    xoshiro256pp_engine() : xoshiro256pp_engine(ROCRAND_XOSHIRO256PP_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^128 numbers long. Skipping subsequences uses the
+    /// engine's jump polynomial and costs a fixed number of state updates
+    /// per subsequence; skipping \p offset numbers steps the state value by
+    /// value, so it should be kept small (the engine is meant to run with
+    /// one state per thread, not to jump to distant offsets).
+    FQUALIFIERS
+    xoshiro256pp_engine(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset)
+    {
+        init_state(seed);
+
+        discard_subsequence(subsequence);
+        discard(offset);
+
+        #ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    /// The state is stepped value by value, so the cost is linear
+    /// in \p offset.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        for(unsigned long long i = 0; i < offset; i++)
+        {
+            discard_state();
+        }
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^128 numbers long. Each subsequence costs one
+    /// application of the jump polynomial (a fixed 256 state updates).
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        for(unsigned long long i = 0; i < subsequence; i++)
+        {
+            jump();
+        }
+    }
+
+    FQUALIFIERS
+    unsigned long long operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned long long next()
+    {
+        const unsigned long long result
+            = rotl(m_state.s[0] + m_state.s[3], 23) + m_state.s[0];
+        discard_state();
+        return result;
+    }
+
+protected:
+
+    FQUALIFIERS
+    void init_state(const unsigned long long seed)
+    {
+        // splitmix64 decorrelates nearby seeds and never produces the
+        // all-zero state the recurrence cannot leave
+        unsigned long long x = seed;
+        m_state.s[0] = detail::splitmix64(x);
+        m_state.s[1] = detail::splitmix64(x);
+        m_state.s[2] = detail::splitmix64(x);
+        m_state.s[3] = detail::splitmix64(x);
+    }
+
+    // One step of the xoshiro256 recurrence
+    FQUALIFIERS
+    void discard_state()
+    {
+        const unsigned long long t = m_state.s[1] << 17;
+        m_state.s[2] ^= m_state.s[0];
+        m_state.s[3] ^= m_state.s[1];
+        m_state.s[1] ^= m_state.s[2];
+        m_state.s[0] ^= m_state.s[3];
+        m_state.s[2] ^= t;
+        m_state.s[3] = rotl(m_state.s[3], 45);
+    }
+
+    // Jumps 2^128 numbers ahead with the engine's jump polynomial:
+    // the state transition is linear over GF(2), so the state after
+    // 2^128 steps is the polynomial's GF(2)-combination of the states
+    // along one pass of 256 single steps.
+    FQUALIFIERS
+    void jump()
+    {
+        static const unsigned long long jump_poly[4] = {
+            0x180EC6D33CFD0ABAULL,
+            0xD5A61266F0C9392CULL,
+            0xA9582618E03FC9AAULL,
+            0x39ABDC4529B1661CULL
+        };
+
+        unsigned long long s0 = 0;
+        unsigned long long s1 = 0;
+        unsigned long long s2 = 0;
+        unsigned long long s3 = 0;
+        for(int i = 0; i < 4; i++)
+        {
+            for(int b = 0; b < 64; b++)
+            {
+                if(jump_poly[i] & (1ULL << b))
+                {
+                    s0 ^= m_state.s[0];
+                    s1 ^= m_state.s[1];
+                    s2 ^= m_state.s[2];
+                    s3 ^= m_state.s[3];
+                }
+                discard_state();
+            }
+        }
+        m_state.s[0] = s0;
+        m_state.s[1] = s1;
+        m_state.s[2] = s2;
+        m_state.s[3] = s3;
+    }
+
+    FQUALIFIERS
+    static unsigned long long rotl(const unsigned long long x, const unsigned int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+protected:
+    // State
+    xoshiro256pp_state m_state;
+
+    #ifndef ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<xoshiro256pp_engine>;
+    #endif
+
+}; // xoshiro256pp_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xoshiro256pp_engine rocrand_state_xoshiro256pp;
+/// \endcond
+
+/**
+ * \brief Initialize XOSHIRO256++ state.
+ *
+ * Initializes the XOSHIRO256++ generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_xoshiro256pp * state)
+{
+    *state = rocrand_state_xoshiro256pp(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using XOSHIRO256++ generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+FQUALIFIERS
+unsigned long long rocrand(rocrand_state_xoshiro256pp * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates XOSHIRO256++ state to skip ahead by \p offset elements.
+ *
+ * Updates the XOSHIRO256++ state in \p state to skip ahead by \p offset elements.
+ * The state is stepped value by value, so the cost is linear in \p offset;
+ * use \p skipahead_subsequence to place threads on distant parts of the
+ * sequence.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_xoshiro256pp * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates XOSHIRO256++ state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the XOSHIRO256++ \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^128 numbers long. Each subsequence skipped costs one
+ * application of the engine's jump polynomial (a fixed 256 state updates).
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xoshiro256pp * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates XOSHIRO256++ state to skip ahead by \p sequence sequences.
+ *
+ * Updates the XOSHIRO256++ \p state skipping \p sequence sequences ahead.
+ * For XOSHIRO256++ each sequence is 2^128 numbers long (equal to the size
+ * of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xoshiro256pp * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_XOSHIRO256PP_H_
+
+/** @} */ // end of group rocranddevice
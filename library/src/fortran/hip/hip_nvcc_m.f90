@@ -58,6 +58,43 @@ module hipfor
             type(c_ptr), value :: ptr
             integer(c_int) :: hipFree
         end function
+
+        function hipMemcpyAsync(dst, src, length, dir, stream) bind(C, name = "cudaMemcpyAsync")
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: dst, src
+            integer(c_size_t), value :: length
+            integer(c_int), value :: dir
+            integer(c_size_t), value :: stream
+            integer(c_int) :: hipMemcpyAsync
+        end function
+
+        function hipStreamCreate(stream) bind(C, name = "cudaStreamCreate")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t) :: stream
+            integer(c_int) :: hipStreamCreate
+        end function
+
+        function hipStreamDestroy(stream) bind(C, name = "cudaStreamDestroy")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t), value :: stream
+            integer(c_int) :: hipStreamDestroy
+        end function
+
+        function hipStreamSynchronize(stream) bind(C, name = "cudaStreamSynchronize")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t), value :: stream
+            integer(c_int) :: hipStreamSynchronize
+        end function
+
+        function hipDeviceSynchronize() bind(C, name = "cudaDeviceSynchronize")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: hipDeviceSynchronize
+        end function
     end interface
 
 end module
@@ -33,11 +33,23 @@ module rocrand_m
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 409
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 410
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 411
+    integer, public :: ROCRAND_RNG_PSEUDO_PCG64 = 412
+    integer, public :: ROCRAND_RNG_PSEUDO_XOSHIRO256PP = 413
+    integer, public :: ROCRAND_RNG_PSEUDO_CHACHA20 = 414
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 415
+    integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_64_13 = 416
+    integer, public :: ROCRAND_RNG_PSEUDO_SQUARES32 = 417
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 418
+    integer, public :: ROCRAND_RNG_PSEUDO_WELL19937 = 419
+    integer, public :: ROCRAND_RNG_PSEUDO_ADAPTIVE = 420
     integer, public :: ROCRAND_RNG_QUASI_DEFAULT = 500
     integer, public :: ROCRAND_RNG_QUASI_SOBOL32 = 501
     integer, public :: ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
     integer, public :: ROCRAND_RNG_QUASI_SOBOL64 = 504
     integer, public :: ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 505
+    integer, public :: ROCRAND_RNG_QUASI_SOBOL32_OWEN = 506
+    integer, public :: ROCRAND_RNG_QUASI_HALTON = 507
+    integer, public :: ROCRAND_RNG_QUASI_LATTICE = 508
 
     integer, public :: ROCRAND_STATUS_SUCCESS = 0
     integer, public :: ROCRAND_STATUS_VERSION_MISMATCH  = 100
@@ -0,0 +1,424 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ADAPTIVE_H_
+#define ROCRAND_RNG_ADAPTIVE_H_
+
+#include <limits>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "mtgp32.hpp"
+#include "philox4x32_10.hpp"
+
+// A hybrid generator that owns two underlying engines and routes every
+// generation to the one expected to be faster for the requested size:
+// Philox 4x32-10 is counter-based and wins small fills because a launch
+// carries no engine state, while MTGP32 reaches higher throughput on large
+// fills. The crossover is calibrated with a short micro-benchmark the first
+// time the generator is initialized; when timing is not possible the
+// built-in default crossover is kept. The two engines use unrelated
+// recurrences, so their sequences are independent even though they share
+// the seed and offset.
+class rocrand_adaptive : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_ADAPTIVE>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_ADAPTIVE>;
+
+    rocrand_adaptive(unsigned long long seed   = 0,
+                     unsigned long long offset = 0,
+                     rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                     hipStream_t        stream = 0)
+        : base_type(order, seed, offset, stream)
+        , m_small(seed, offset, order, stream)
+        , m_large(seed, offset, order, stream)
+        , m_size_threshold(default_size_threshold)
+        , m_calibrated(false)
+    {
+    }
+
+    void reset()
+    {
+        m_small.reset();
+        m_large.reset();
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_small.set_seed(seed);
+        m_large.set_seed(seed);
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_small.set_offset(offset);
+        m_large.set_offset(offset);
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order = order;
+        m_small.set_order(order);
+        m_large.set_order(order);
+    }
+
+    void set_stream(hipStream_t stream)
+    {
+        m_small.set_stream(stream);
+        m_large.set_stream(stream);
+        base_type::set_stream(stream);
+    }
+
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states. Only the MTGP32 engine keeps heavy state;
+    // the Philox engine is counter-based.
+    size_t get_workspace_size() const
+    {
+        return m_large.get_workspace_size();
+    }
+
+    rocrand_status set_workspace(void * ptr, size_t size)
+    {
+        return m_large.set_workspace(ptr, size);
+    }
+
+    rocrand_status init()
+    {
+        rocrand_status status;
+
+        if(!m_calibrated)
+        {
+            status = calibrate();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
+        status = m_small.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return m_large.init();
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        if(data_size >= m_size_threshold)
+        {
+            status = m_large.generate(data, data_size, distribution);
+        }
+        else
+        {
+            status = m_small.generate(data, data_size, distribution);
+        }
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size()
+            + m_small.get_reclaimable_memory_size()
+            + m_large.get_reclaimable_memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+        m_small.trim();
+        m_large.trim();
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Times both engines on a few geometrically spaced fill sizes and sets
+    // the threshold to the smallest probed size on which MTGP32 is at least
+    // as fast as Philox. Calibration is best effort: when the device memory
+    // or the events needed for timing are not available, the built-in
+    // crossover is kept and generation proceeds normally.
+    rocrand_status calibrate()
+    {
+        m_size_threshold = default_size_threshold;
+        m_calibrated = true;
+
+        unsigned int * probe_data;
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&probe_data),
+                     probe_size_max * sizeof(unsigned int)) != hipSuccess)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipEvent_t start;
+        hipEvent_t stop;
+        if(hipEventCreate(&start) != hipSuccess)
+        {
+            rocrand_host::detail::device_free(probe_data);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            hipEventDestroy(start);
+            rocrand_host::detail::device_free(probe_data);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // When MTGP32 never wins a probe, all fills go to Philox
+        m_size_threshold = std::numeric_limits<size_t>::max();
+        for(size_t size = probe_size_min; size <= probe_size_max; size *= 4)
+        {
+            float small_ms;
+            float large_ms;
+            if(!time_generate(m_small, probe_data, size, start, stop, small_ms)
+               || !time_generate(m_large, probe_data, size, start, stop, large_ms))
+            {
+                m_size_threshold = default_size_threshold;
+                break;
+            }
+            if(large_ms <= small_ms)
+            {
+                m_size_threshold = size;
+                break;
+            }
+        }
+
+        hipEventDestroy(stop);
+        hipEventDestroy(start);
+        rocrand_host::detail::device_free(probe_data);
+
+        // The probes consumed values from both engines; reset them so that
+        // the user-visible sequences still start at the seeded state.
+        m_small.reset();
+        m_large.reset();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class Generator>
+    bool time_generate(Generator& engine, unsigned int * data, size_t size,
+                       hipEvent_t start, hipEvent_t stop, float& milliseconds)
+    {
+        // Warm-up launch, also hides one-time engine initialization
+        if(engine.generate(data, size) != ROCRAND_STATUS_SUCCESS)
+            return false;
+        if(hipEventRecord(start, m_stream) != hipSuccess)
+            return false;
+        if(engine.generate(data, size) != ROCRAND_STATUS_SUCCESS)
+            return false;
+        if(hipEventRecord(stop, m_stream) != hipSuccess)
+            return false;
+        if(hipEventSynchronize(stop) != hipSuccess)
+            return false;
+        return hipEventElapsedTime(&milliseconds, start, stop) == hipSuccess;
+    }
+
+    // Crossover used when the micro-benchmark cannot run
+    static constexpr size_t default_size_threshold = 1 << 17;
+    // Fill sizes probed by the micro-benchmark
+    static constexpr size_t probe_size_min = 1 << 12;
+    static constexpr size_t probe_size_max = 1 << 22;
+
+    rocrand_philox4x32_10 m_small;
+    rocrand_mtgp32        m_large;
+
+    // Fills of at least this many values go to the MTGP32 engine
+    size_t m_size_threshold;
+    bool m_calibrated;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_ADAPTIVE_H_
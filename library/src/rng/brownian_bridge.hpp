@@ -0,0 +1,116 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_BROWNIAN_BRIDGE_H_
+#define ROCRAND_RNG_BROWNIAN_BRIDGE_H_
+
+#include <cmath>
+#include <vector>
+
+#include <rocrand/rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Host-side plan of the Brownian-bridge construction over a time grid.
+// Step k of the construction sets the path value at index nodes[k] from
+// the already known values at its interval endpoints:
+//
+//   W[node] = left_weight * W[left] + right_weight * W[right] + stddev * z_k
+//
+// where z_k is the k-th standard normal of the point. Step 0 sets the
+// terminal value and the remaining steps bisect the intervals breadth
+// first, so the lowest-numbered normals carry the largest variances —
+// the ordering the bridge construction exists for. An endpoint index
+// equal to n_steps stands for time zero, where the path is fixed at 0.
+//
+// The three index arrays are packed as [node | left | right] and the
+// three coefficient arrays as [left_weight | right_weight | stddev], so
+// the kernels stage the whole plan with two loads.
+struct brownian_bridge_plan
+{
+    std::vector<unsigned int> nodes;
+    std::vector<float>        values;
+};
+
+// Builds the construction plan for \p n_steps strictly increasing
+// positive times. Returns ROCRAND_STATUS_OUT_OF_RANGE for an invalid
+// grid.
+inline rocrand_status build_brownian_bridge_plan(const float * times,
+                                                 unsigned int n_steps,
+                                                 brownian_bridge_plan& plan)
+{
+    if(times[0] <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    for(unsigned int i = 1; i < n_steps; i++)
+    {
+        if(times[i] <= times[i - 1])
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+
+    plan.nodes.assign(3 * n_steps, n_steps);
+    plan.values.assign(3 * n_steps, 0.0f);
+
+    // The terminal value is drawn first, unconditionally
+    plan.nodes[0] = n_steps - 1;
+    plan.values[2 * n_steps] = std::sqrt(times[n_steps - 1]);
+
+    // Bisect the intervals breadth first; -1 stands for time zero
+    std::vector<std::pair<int, int>> intervals;
+    intervals.push_back(std::make_pair(-1, static_cast<int>(n_steps) - 1));
+    unsigned int k = 1;
+    for(size_t head = 0; head < intervals.size(); head++)
+    {
+        const int l = intervals[head].first;
+        const int r = intervals[head].second;
+        if(r - l <= 1)
+        {
+            continue;
+        }
+        const int m = (l + r + 1) / 2;
+
+        const float tl = l < 0 ? 0.0f : times[l];
+        const float tm = times[m];
+        const float tr = times[r];
+        const float span = tr - tl;
+
+        plan.nodes[k] = static_cast<unsigned int>(m);
+        plan.nodes[n_steps + k] = l < 0 ? n_steps : static_cast<unsigned int>(l);
+        plan.nodes[2 * n_steps + k] = static_cast<unsigned int>(r);
+        plan.values[k] = (tr - tm) / span;
+        plan.values[n_steps + k] = (tm - tl) / span;
+        plan.values[2 * n_steps + k] = std::sqrt((tm - tl) * (tr - tm) / span);
+        k++;
+
+        intervals.push_back(std::make_pair(l, m));
+        intervals.push_back(std::make_pair(m, r));
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_BROWNIAN_BRIDGE_H_
@@ -25,6 +25,12 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+#include <cstring>
+#include <mutex>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
 #include <rocrand/rocrand_common.h>
 
 template<class T, unsigned int N>
@@ -33,4 +39,365 @@ struct alignas(sizeof(T) * N) aligned_vec_type
     T data[N];
 };
 
+namespace rocrand_host {
+namespace detail {
+
+// Process-wide device memory hooks installed with
+// rocrand_set_allocator(). Plain pointers, no synchronization: the
+// documented contract is that the hooks are installed before any
+// generator or distribution exists and stay unchanged while any does.
+extern rocrand_alloc_func device_alloc_hook;
+extern rocrand_free_func  device_free_hook;
+extern void *             device_alloc_hook_user_data;
+
+// All internal device allocations go through these two, so an installed
+// allocator sees every byte the library takes
+inline hipError_t device_malloc(void ** ptr, size_t size)
+{
+    if(device_alloc_hook != NULL)
+    {
+        *ptr = device_alloc_hook(size, device_alloc_hook_user_data);
+        return *ptr != NULL ? hipSuccess : hipErrorOutOfMemory;
+    }
+    return hipMalloc(ptr, size);
+}
+
+inline hipError_t device_free(void * ptr)
+{
+    if(device_free_hook != NULL)
+    {
+        if(ptr != NULL)
+        {
+            device_free_hook(ptr, device_alloc_hook_user_data);
+        }
+        return hipSuccess;
+    }
+    return hipFree(ptr);
+}
+
+// Stream-ordered variants for generator state and tables: a blocking
+// hipMalloc/hipFree synchronizes the whole device, so creating or
+// destroying a generator stalls unrelated streams. Ordering the
+// allocation on the generator's stream keeps the hiccup local to it.
+// The pointers are only valid in that stream's order; all uses below
+// either run on the same stream or synchronize it first. Falls back to
+// the blocking calls when the runtime does not support memory pools,
+// and an installed allocator hook keeps precedence.
+inline hipError_t device_malloc_async(void ** ptr, size_t size, hipStream_t stream)
+{
+    if(device_alloc_hook != NULL)
+    {
+        return device_malloc(ptr, size);
+    }
+#if defined(HIP_VERSION) && HIP_VERSION >= 50200000
+    if(hipMallocAsync(ptr, size, stream) == hipSuccess)
+    {
+        return hipSuccess;
+    }
+    // Clear the error of the failed attempt before falling back
+    (void)hipGetLastError();
+#else
+    (void)stream;
+#endif
+    return hipMalloc(ptr, size);
+}
+
+inline hipError_t device_free_async(void * ptr, hipStream_t stream)
+{
+    if(device_free_hook != NULL)
+    {
+        return device_free(ptr);
+    }
+    if(ptr == NULL)
+    {
+        return hipSuccess;
+    }
+#if defined(HIP_VERSION) && HIP_VERSION >= 50200000
+    if(hipFreeAsync(ptr, stream) == hipSuccess)
+    {
+        return hipSuccess;
+    }
+    (void)hipGetLastError();
+#else
+    (void)stream;
+#endif
+    return hipFree(ptr);
+}
+
+// Number of blocks of \p kernel that can be resident at once on the
+// current device. Generators use this to pick their grid under
+// ROCRAND_ORDERING_PSEUDO_DYNAMIC instead of their built-in block
+// counts. Returns 0 if any of the queries fails, in which case callers
+// keep their defaults.
+template<class Kernel>
+inline unsigned int max_resident_blocks(Kernel kernel, unsigned int threads)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        return 0;
+    }
+    int multiprocessor_count;
+    if(hipDeviceGetAttribute(&multiprocessor_count,
+                             hipDeviceAttributeMultiprocessorCount,
+                             device)
+       != hipSuccess)
+    {
+        return 0;
+    }
+    int blocks_per_multiprocessor;
+    if(hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_multiprocessor,
+                                                    kernel,
+                                                    static_cast<int>(threads),
+                                                    0)
+       != hipSuccess)
+    {
+        return 0;
+    }
+    return static_cast<unsigned int>(multiprocessor_count * blocks_per_multiprocessor);
+}
+
+// Shared generation kernel for generators that keep one engine per
+// thread in a device array. An engine type only has to be copyable
+// device state with an operator() returning its raw output word;
+// everything else is provided here once - the aligned vectorized store
+// path with head/tail handling for unaligned or odd-sized fills, and
+// the start_engine_id rotation that keeps the sequence continuous
+// across fills - so store and scheduling optimizations land for every
+// such generator at the same time instead of per engine. The engine
+// count (the grid stride) MUST be a power of two. Generators with
+// engine-specific scheduling (multi-word counter blocks, vec-size
+// batching, dual-engine interleaving) keep a specialized overload next
+// to their class instead.
+template<class Engine, class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_kernel(
+    Engine*            engines,
+    const unsigned int start_engine_id,
+    T*                 data,
+    const size_t       n,
+    Distribution       distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    using vec_type   = aligned_vec_type<T, output_width>;
+    using input_type = decltype(engines[0]());
+
+    const unsigned int id     = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride = gridDim.x * blockDim.x;
+
+    // Stride must be a power of two
+    const unsigned int engine_id = (id + start_engine_id) & (stride - 1);
+    Engine             engine    = engines[engine_id];
+
+    input_type input[input_width];
+    T          output[output_width];
+
+    const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
+    const size_t misalignment = (output_width - uintptr / sizeof(T) % output_width) % output_width;
+    const unsigned int head_size = min(n, misalignment);
+    const unsigned int tail_size = (n - head_size) % output_width;
+    const size_t       vec_n     = (n - head_size) / output_width;
+
+    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
+    size_t    index    = id;
+    while(index < vec_n)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        // Next position
+        index += stride;
+    }
+
+    // Check if we need to save head and tail.
+    // Those numbers should be generated by the thread that would
+    // save next vec_type.
+    if(output_width > 1 && index == vec_n)
+    {
+        // If data is not aligned by sizeof(vec_type)
+        if(head_size > 0)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                if(o < head_size)
+                {
+                    data[o] = output[o];
+                }
+            }
+        }
+
+        if(tail_size > 0)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                if(o < tail_size)
+                {
+                    data[n - tail_size + o] = output[o];
+                }
+            }
+        }
+    }
+
+    // Save engine with its state
+    engines[engine_id] = engine;
+}
+
+// Batching factor for generation kernels that take a ValuesPerThread
+// template parameter: producing several vectors before storing them gives
+// the compiler independent engine updates and stores to overlap. Selected
+// at launch from the fill size so that short fills, where batching would
+// leave part of the remainder to a serial per-vector loop, keep one value
+// per thread. The factor does not change the generated sequence.
+inline unsigned int generate_values_per_thread(size_t vec_n, size_t threads)
+{
+    if(vec_n >= 8 * threads)
+    {
+        return 8;
+    }
+    if(vec_n >= 4 * threads)
+    {
+        return 4;
+    }
+    return 1;
+}
+
+// Largest power of two not greater than \p x (for kernels that compute
+// engine ids with & (stride - 1)).
+inline unsigned int previous_power_of_two(unsigned int x)
+{
+    unsigned int p = 1;
+    while(p * 2 <= x && p * 2 != 0)
+    {
+        p *= 2;
+    }
+    return p;
+}
+
+// Orderings under which generators pick their launch configuration from
+// the occupancy of the executing device instead of built-in constants
+inline bool uses_device_occupancy(rocrand_ordering order)
+{
+    return order == ROCRAND_ORDERING_PSEUDO_DYNAMIC
+           || order == ROCRAND_ORDERING_PSEUDO_FASTEST;
+}
+
+// One output buffer of a batched fill (rocrand_generate_batch()). The
+// host packs these and uploads them in one copy, so the kernel walks
+// the whole batch in a single launch
+struct batch_fill
+{
+    unsigned int * data;
+    size_t size;
+};
+
+// Small pool of pinned host buffers that stages host-to-device copies of
+// distribution tables. Copying through pinned memory lets the transfer run
+// asynchronously on the requested stream instead of blocking the host in
+// hipMemcpy, and the pageable source can be released as soon as the call
+// returns. Like the poisson table registry, the pool is shared by all
+// generators and lives until the process exits.
+class pinned_staging_pool
+{
+public:
+
+    // Copies \p size bytes of pageable host memory at \p src to device
+    // memory at \p dst, ordered on \p stream. Falls back to a plain
+    // synchronous copy when pinned memory or an event cannot be obtained.
+    static hipError_t copy_to_device(void * dst, const void * src, size_t size, hipStream_t stream)
+    {
+        static buffer buffers[pool_size];
+        static unsigned int next = 0;
+        static std::mutex mutex;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        buffer& b = buffers[next];
+        next = (next + 1) % pool_size;
+
+        // Wait until the previous transfer out of this buffer has finished
+        if(b.pending)
+        {
+            if(hipEventSynchronize(b.ready) != hipSuccess)
+            {
+                return fallback(dst, src, size);
+            }
+            b.pending = false;
+        }
+        if(b.capacity < size)
+        {
+            if(b.data != NULL)
+            {
+                hipHostFree(b.data);
+                b.data = NULL;
+                b.capacity = 0;
+            }
+            if(hipHostMalloc(&b.data, size) != hipSuccess)
+            {
+                b.data = NULL;
+                return fallback(dst, src, size);
+            }
+            b.capacity = size;
+        }
+        if(b.ready == NULL
+           && hipEventCreateWithFlags(&b.ready, hipEventDisableTiming) != hipSuccess)
+        {
+            b.ready = NULL;
+            return fallback(dst, src, size);
+        }
+
+        memcpy(b.data, src, size);
+        hipError_t error = hipMemcpyAsync(dst, b.data, size, hipMemcpyHostToDevice, stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipEventRecord(b.ready, stream);
+        if(error != hipSuccess)
+        {
+            // The copy may still be in flight; wait so that the buffer can
+            // be reused safely
+            hipStreamSynchronize(stream);
+            return error;
+        }
+        b.pending = true;
+        return hipSuccess;
+    }
+
+private:
+
+    static constexpr unsigned int pool_size = 4;
+
+    struct buffer
+    {
+        void * data = NULL;
+        size_t capacity = 0;
+        hipEvent_t ready = NULL;
+        bool pending = false;
+    };
+
+    static hipError_t fallback(void * dst, const void * src, size_t size)
+    {
+        return hipMemcpy(dst, src, size, hipMemcpyHostToDevice);
+    }
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 #endif // ROCRAND_RNG_COMMON_H_
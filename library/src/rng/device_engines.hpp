@@ -25,10 +25,14 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+#define ROCRAND_DETAIL_CHACHA20_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_PCG64_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_SQUARES32_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_XOSHIRO256PP_BM_NOT_IN_STATE
 
 #include <rocrand/rocrand_kernel.h>
 
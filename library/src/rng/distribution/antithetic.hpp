@@ -0,0 +1,113 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_ANTITHETIC_H_
+#define ROCRAND_RNG_DISTRIBUTION_ANTITHETIC_H_
+
+#include <type_traits>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+// Wraps an engine-output distribution so that each application also
+// emits the antithetic mate of every value, produced by running the
+// wrapped distribution on the bit-complemented engine outputs. The
+// uniform conversions map a complemented engine value to the reflection
+// 1 - u (up to one ulp of the conversion), so the pairing is the
+// classic antithetic-variates coupling applied to the underlying
+// uniforms and carries through every distribution derived from them.
+// Engine consumption per application is unchanged while the output
+// width doubles, so the engines do half the work per output value and
+// the mates land next to their originals:
+// (x_0, anti(x_0), x_1, anti(x_1), ...).
+
+template<class Distribution>
+struct antithetic_distribution
+{
+    static constexpr unsigned int input_width = Distribution::input_width;
+    static constexpr unsigned int output_width = 2 * Distribution::output_width;
+
+    Distribution dis;
+
+    __host__ __device__
+    antithetic_distribution(Distribution dis)
+        : dis(dis) {}
+
+    template<class Input, class T>
+    __host__ __device__
+    void operator()(const Input (&input)[input_width],
+                    T (&output)[output_width]) const
+    {
+        T direct[Distribution::output_width];
+        dis(input, direct);
+
+        Input reflected[input_width];
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            reflected[i] = ~input[i];
+        }
+        T mates[Distribution::output_width];
+        dis(reflected, mates);
+
+        for(unsigned int i = 0; i < Distribution::output_width; i++)
+        {
+            output[2 * i] = direct[i];
+            output[2 * i + 1] = mates[i];
+        }
+    }
+};
+
+template<class Distribution>
+struct is_antithetic : std::false_type
+{
+};
+
+template<class Distribution>
+struct is_antithetic<antithetic_distribution<Distribution>> : std::true_type
+{
+};
+
+namespace rocrand_host {
+namespace detail {
+
+// Out-of-line target of the antithetic mode branch in the generators'
+// generate() methods. The enable_if pair keeps the wrap from
+// instantiating recursively once the distribution is already wrapped.
+template<class Generator, class T, class Distribution>
+inline typename std::enable_if<!is_antithetic<Distribution>::value, rocrand_status>::type
+generate_antithetic(Generator& generator, T * data, size_t data_size,
+                    Distribution distribution)
+{
+    return generator.generate(data, data_size,
+                              antithetic_distribution<Distribution>(distribution));
+}
+
+template<class Generator, class T, class Distribution>
+inline typename std::enable_if<is_antithetic<Distribution>::value, rocrand_status>::type
+generate_antithetic(Generator&, T *, size_t, Distribution)
+{
+    // Unreachable: the mode branch is taken for unwrapped distributions only
+    return ROCRAND_STATUS_INTERNAL_ERROR;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_ANTITHETIC_H_
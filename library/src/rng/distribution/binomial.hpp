@@ -0,0 +1,238 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include <climits>
+#include <algorithm>
+#include <vector>
+
+#include <rocrand/rocrand.h>
+
+#include "discrete.hpp"
+
+// Number of trials up to which the exact histogram (alias table or CDF) is
+// used. Above it the table construction cost and size outweigh the accuracy
+// gain and the normal approximation with continuity correction is used
+// instead (n * p * (1 - p) is large enough there for any p that leaves
+// non-negligible probabilities).
+static constexpr unsigned int binomial_histogram_threshold = 4096;
+
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class rocrand_binomial_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
+{
+public:
+
+    typedef rocrand_discrete_distribution_base<Method, IsHostSide> base;
+
+    rocrand_binomial_distribution()
+        : base() { }
+
+    rocrand_binomial_distribution(unsigned int t, double p)
+        : rocrand_binomial_distribution()
+    {
+        set_params(t, p);
+    }
+
+    __host__ __device__
+    ~rocrand_binomial_distribution() { }
+
+    void set_params(unsigned int t, double p, hipStream_t stream = 0)
+    {
+        std::vector<double> probs(t + 1);
+
+        calculate_probabilities(probs, t, p);
+
+        this->init(probs, this->size, this->offset, stream);
+    }
+
+protected:
+
+    void calculate_probabilities(std::vector<double>& probs, const unsigned int t,
+                                 const double p)
+    {
+        const double p_epsilon = 1e-12;
+        const double log_p = std::log(p);
+        const double log_q = std::log1p(-p);
+        const double log_t_fact = std::lgamma(t + 1.0);
+
+        // As with Poisson, only a narrow band around the mean carries
+        // non-negligible probability; trim both tails below p_epsilon.
+
+        int lo = 0;
+        int hi = static_cast<int>(t);
+        for (int k = 0; k <= static_cast<int>(t); k++)
+        {
+            probs[k] = std::exp(log_t_fact - std::lgamma(k + 1.0) - std::lgamma(t - k + 1.0)
+                                + k * log_p + (t - k) * log_q);
+        }
+        while (lo < hi && probs[lo] < p_epsilon)
+        {
+            lo++;
+        }
+        while (hi > lo && probs[hi] < p_epsilon)
+        {
+            hi--;
+        }
+
+        for (int k = lo; k <= hi; k++)
+        {
+            probs[k - lo] = probs[k];
+        }
+
+        this->size = hi - lo + 1;
+        this->offset = lo;
+    }
+};
+
+// Handles caching of precomputed tables for the distribution and recomputes
+// them only when the parameters are changed, like poisson_distribution_manager.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class binomial_distribution_manager
+{
+public:
+
+    rocrand_binomial_distribution<Method, IsHostSide> dis;
+
+    binomial_distribution_manager()
+        : trials(0), probability(0.0)
+    { }
+
+    ~binomial_distribution_manager()
+    {
+        dis.deallocate();
+    }
+
+    // The table uploads are issued asynchronously on stream, so kernels
+    // launched on the same stream afterwards see the complete tables
+    // without a host synchronization
+    void set_params(unsigned int new_trials, double new_probability, hipStream_t stream = 0)
+    {
+        const bool changed = trials != new_trials || probability != new_probability;
+        if (changed)
+        {
+            trials = new_trials;
+            probability = new_probability;
+            dis.set_params(trials, probability, stream);
+        }
+    }
+
+    // Bytes of device memory currently held by the cached tables
+    size_t memory_size() const
+    {
+        if (IsHostSide)
+            return 0;
+        size_t bytes = 0;
+        if (dis.probability != NULL)
+            bytes += dis.size * sizeof(double);
+        if (dis.alias != NULL)
+            bytes += dis.size * sizeof(unsigned int);
+        if (dis.cdf != NULL)
+            bytes += dis.size * sizeof(double);
+        return bytes;
+    }
+
+    // Releases the cached tables; they are rebuilt on the next draw
+    // with the same parameters
+    void trim()
+    {
+        dis.deallocate();
+        trials = 0;
+        probability = 0.0;
+    }
+
+private:
+
+    unsigned int trials;
+    double probability;
+};
+
+// Normal approximation with continuity correction for large numbers of
+// trials, evaluated fully in-register (no table reads).
+
+struct binomial_approx_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double mean;
+    const double stddev;
+    const double max_value;
+
+    __host__ __device__
+    binomial_approx_distribution(unsigned int t, double p)
+        : mean(t * p), stddev(sqrt(t * p * (1.0 - p))), max_value(t) {}
+
+    template<class T>
+    __host__ __device__
+    void operator()(const T (&input)[1], unsigned int (&output)[1]) const
+    {
+        const double v = rocrand_device::detail::normal_distribution_double(input[0]);
+        double k = floor(mean + stddev * v + 0.5);
+        k = k < 0.0 ? 0.0 : (k > max_value ? max_value : k);
+        output[0] = static_cast<unsigned int>(k);
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<typename state_type>
+struct mrg_engine_binomial_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    rocrand_binomial_distribution<ROCRAND_DISCRETE_METHOD_ALIAS> dis;
+
+    mrg_engine_binomial_distribution(
+        rocrand_binomial_distribution<ROCRAND_DISCRETE_METHOD_ALIAS> dis)
+        : dis(dis)
+    { }
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        // Remap the MRG-based engine's "raw" output from [1, MRG_M1]
+        // to [0, UINT_MAX] (see mrg_engine_poisson_distribution)
+        unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = dis(v);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_binomial_approx_distribution : binomial_approx_distribution
+{
+    __host__ __device__
+    mrg_engine_binomial_approx_distribution(unsigned int t, double p)
+        : binomial_approx_distribution(t, p) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        const unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        const unsigned int remapped[1] = { v };
+        binomial_approx_distribution::operator()(remapped, output);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
@@ -0,0 +1,211 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
+#define ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Cauchy distribution via inverse CDF: median + sigma * tan(pi * (u - 1/2)).
+
+// Universal
+
+template<class Output, class Input = unsigned int>
+struct cauchy_distribution;
+
+template<>
+struct cauchy_distribution<float, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float median;
+    const float sigma;
+
+    __host__ __device__
+    cauchy_distribution(float median, float sigma)
+        : median(median), sigma(sigma) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = median + sigma * tanf(ROCRAND_PI * (u - 0.5f));
+    }
+};
+
+template<>
+struct cauchy_distribution<double, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double median;
+    const double sigma;
+
+    __host__ __device__
+    cauchy_distribution(double median, double sigma)
+        : median(median), sigma(sigma) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0], input[1]);
+        output[0] = median + sigma * tan(ROCRAND_PI_DOUBLE * (u - 0.5));
+    }
+};
+
+// 64 bit Universal
+
+template<>
+struct cauchy_distribution<float, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float median;
+    const float sigma;
+
+    __host__ __device__ cauchy_distribution(float median, float sigma)
+        : median(median), sigma(sigma)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = median + sigma * tanf(ROCRAND_PI * (u - 0.5f));
+    }
+};
+
+template<>
+struct cauchy_distribution<double, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double median;
+    const double sigma;
+
+    __host__ __device__ cauchy_distribution(double median, double sigma)
+        : median(median), sigma(sigma)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0]);
+        output[0] = median + sigma * tan(ROCRAND_PI_DOUBLE * (u - 0.5));
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_cauchy_distribution;
+
+template<typename state_type>
+struct mrg_engine_cauchy_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float median;
+    const float sigma;
+
+    __host__ __device__ mrg_engine_cauchy_distribution(float median, float sigma)
+        : median(median), sigma(sigma)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]);
+        output[0] = median + sigma * tanf(ROCRAND_PI * (u - 0.5f));
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_cauchy_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double median;
+    const double sigma;
+
+    __host__ __device__ mrg_engine_cauchy_distribution(double median, double sigma)
+        : median(median), sigma(sigma)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        const double u
+            = rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0]);
+        output[0] = median + sigma * tan(ROCRAND_PI_DOUBLE * (u - 0.5));
+    }
+};
+
+// Sobol
+
+template<class T>
+struct sobol_cauchy_distribution;
+
+template<>
+struct sobol_cauchy_distribution<float>
+{
+    const float median;
+    const float sigma;
+
+    __host__ __device__
+    sobol_cauchy_distribution(float median, float sigma)
+        : median(median), sigma(sigma) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ float operator()(const DirectionVectorType x) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(x);
+        return median + sigma * tanf(ROCRAND_PI * (u - 0.5f));
+    }
+};
+
+template<>
+struct sobol_cauchy_distribution<double>
+{
+    const double median;
+    const double sigma;
+
+    __host__ __device__
+    sobol_cauchy_distribution(double median, double sigma)
+        : median(median), sigma(sigma) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ double operator()(const DirectionVectorType x) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(x);
+        return median + sigma * tan(ROCRAND_PI_DOUBLE * (u - 0.5));
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
@@ -27,6 +27,7 @@
 
 #include <rocrand/rocrand.h>
 
+#include "../common.hpp"
 #include "device_distributions.hpp"
 
 // Alias method
@@ -44,6 +45,157 @@ enum rocrand_discrete_method
     ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF
 };
 
+namespace rocrand_host {
+namespace detail {
+
+// Builds the alias table and the CDF from device-resident probabilities.
+// Launched as a single block: the normalization sum, the scaled
+// probabilities, the worklist classification and the CDF prefix sums are
+// all computed cooperatively, one BlockSize-sized tile at a time. Only
+// the worklist pairing of Vose's algorithm is inherently sequential and
+// runs on the leading thread. \p small and \p large are scratch worklists
+// of \p dis.size elements each.
+template<unsigned int BlockSize>
+ROCRAND_KERNEL
+void build_discrete_distribution_kernel(const double * probabilities,
+                                        rocrand_discrete_distribution_st dis,
+                                        unsigned int * small,
+                                        unsigned int * large)
+{
+    const unsigned int tid = threadIdx.x;
+    const unsigned int size = dis.size;
+
+    __shared__ double partial_sums[BlockSize];
+    __shared__ unsigned int partial_counts[BlockSize];
+
+    double sum = 0.0;
+    for(unsigned int i = tid; i < size; i += BlockSize)
+    {
+        sum += probabilities[i];
+    }
+    partial_sums[tid] = sum;
+    __syncthreads();
+    for(unsigned int s = BlockSize / 2; s > 0; s >>= 1)
+    {
+        if(tid < s)
+        {
+            partial_sums[tid] += partial_sums[tid + s];
+        }
+        __syncthreads();
+    }
+    const double inv_sum = 1.0 / partial_sums[0];
+    __syncthreads();
+
+    if(dis.probability != NULL)
+    {
+        // Scaled so that the average bucket weight is 1
+        for(unsigned int i = tid; i < size; i += BlockSize)
+        {
+            dis.probability[i] = probabilities[i] * inv_sum * size;
+        }
+    }
+    __syncthreads();
+
+    if(dis.probability != NULL && dis.alias != NULL)
+    {
+        // Classification is parallel: an inclusive scan of the "large"
+        // flags in each tile yields the worklist slot of every entry, so
+        // the worklists come out in the same deterministic order as the
+        // old serial loop. Every thread tracks the running counts, which
+        // leaves them available to the pairing loop below.
+        unsigned int small_count = 0;
+        unsigned int large_count = 0;
+        for(unsigned int base = 0; base < size; base += BlockSize)
+        {
+            const unsigned int i = base + tid;
+            const bool is_large = i < size && dis.probability[i] >= 1.0;
+            partial_counts[tid] = is_large ? 1 : 0;
+            __syncthreads();
+            for(unsigned int s = 1; s < BlockSize; s <<= 1)
+            {
+                const unsigned int v = tid >= s ? partial_counts[tid - s] : 0;
+                __syncthreads();
+                partial_counts[tid] += v;
+                __syncthreads();
+            }
+            if(i < size)
+            {
+                const unsigned int large_before = partial_counts[tid] - (is_large ? 1 : 0);
+                if(is_large)
+                    large[large_count + large_before] = i;
+                else
+                    small[small_count + (tid - large_before)] = i;
+            }
+            const unsigned int tile_size = min(BlockSize, size - base);
+            const unsigned int tile_large = partial_counts[BlockSize - 1];
+            large_count += tile_large;
+            small_count += tile_size - tile_large;
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            // A popped "small" entry's probability is final; only entries
+            // still on the worklists are updated in place.
+            while(small_count > 0 && large_count > 0)
+            {
+                const unsigned int less = small[--small_count];
+                const unsigned int more = large[--large_count];
+
+                dis.alias[less] = more;
+
+                const double p = (dis.probability[more] + dis.probability[less]) - 1.0;
+                dis.probability[more] = p;
+
+                if(p >= 1.0)
+                    large[large_count++] = more;
+                else
+                    small[small_count++] = more;
+            }
+
+            while(small_count > 0)
+            {
+                dis.probability[small[--small_count]] = 1.0;
+            }
+            while(large_count > 0)
+            {
+                dis.probability[large[--large_count]] = 1.0;
+            }
+        }
+        __syncthreads();
+    }
+
+    if(dis.cdf != NULL)
+    {
+        // Tile-wide inclusive scan with a running carry; all threads
+        // accumulate the same carry, so no extra synchronization point is
+        // needed between tiles beyond reusing the scan buffer
+        double carry = 0.0;
+        for(unsigned int base = 0; base < size; base += BlockSize)
+        {
+            const unsigned int i = base + tid;
+            partial_sums[tid] = i < size ? probabilities[i] * inv_sum : 0.0;
+            __syncthreads();
+            for(unsigned int s = 1; s < BlockSize; s <<= 1)
+            {
+                const double v = tid >= s ? partial_sums[tid - s] : 0.0;
+                __syncthreads();
+                partial_sums[tid] += v;
+                __syncthreads();
+            }
+            if(i < size)
+            {
+                dis.cdf[i] = carry + partial_sums[tid];
+            }
+            carry += partial_sums[BlockSize - 1];
+            __syncthreads();
+        }
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class rocrand_discrete_distribution_base : public rocrand_discrete_distribution_st
 {
@@ -70,9 +222,63 @@ public:
         init(p, size, offset);
     }
 
+    __host__ __device__
+    rocrand_discrete_distribution_base(const rocrand_discrete_distribution_st& dis)
+    {
+        size = dis.size;
+        offset = dis.offset;
+        probability = dis.probability;
+        alias = dis.alias;
+        cdf = dis.cdf;
+    }
+
     __host__ __device__
     ~rocrand_discrete_distribution_base() { }
 
+    // Builds the distribution from probabilities that reside in device
+    // memory, without copying them to the host. Only valid for the
+    // device-side (IsHostSide = false) variant.
+    void init_from_device(const double * probabilities,
+                          const unsigned int size,
+                          const unsigned int offset,
+                          hipStream_t stream = 0)
+    {
+        this->size = size;
+        this->offset = offset;
+
+        deallocate();
+        allocate(stream);
+
+        unsigned int * worklists;
+        hipError_t error
+            = rocrand_host::detail::device_malloc_async(reinterpret_cast<void**>(&worklists),
+                                                        sizeof(unsigned int) * size * 2,
+                                                        stream);
+        if (error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::build_discrete_distribution_kernel<256>),
+            dim3(1), dim3(256), 0, stream,
+            probabilities,
+            static_cast<const rocrand_discrete_distribution_st&>(*this),
+            worklists, worklists + size
+        );
+        if (hipGetLastError() != hipSuccess)
+        {
+            rocrand_host::detail::device_free_async(worklists, stream);
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        error = hipStreamSynchronize(stream);
+        rocrand_host::detail::device_free_async(worklists, stream);
+        if (error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+    }
+
     void deallocate()
     {
         // Explicit deallocation is used because on HCC the object is copied
@@ -97,15 +303,15 @@ public:
         {
             if (probability != NULL)
             {
-                hipFree(probability);
+                rocrand_host::detail::device_free(probability);
             }
             if (alias != NULL)
             {
-                hipFree(alias);
+                rocrand_host::detail::device_free(alias);
             }
             if (cdf != NULL)
             {
-                hipFree(cdf);
+                rocrand_host::detail::device_free(cdf);
             }
         }
         probability = NULL;
@@ -136,25 +342,29 @@ protected:
 
     void init(std::vector<double> p,
               const unsigned int size,
-              const unsigned int offset)
+              const unsigned int offset,
+              hipStream_t stream = 0)
     {
         this->size = size;
         this->offset = offset;
 
         deallocate();
-        allocate();
+        allocate(stream);
         normalize(p);
         if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
         {
-            create_alias_table(p);
+            create_alias_table(p, stream);
         }
         if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
         {
-            create_cdf(p);
+            create_cdf(p, stream);
         }
     }
 
-    void allocate()
+    // Device tables are allocated in \p stream's order; the uploads
+    // that fill them run on the same stream, so no synchronization is
+    // needed in between and other streams are not stalled
+    void allocate(hipStream_t stream = 0)
     {
         if (IsHostSide)
         {
@@ -173,12 +383,14 @@ protected:
             hipError_t error;
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                error = hipMalloc(reinterpret_cast<void**>(&probability), sizeof(double) * size);
+                error = rocrand_host::detail::device_malloc_async(
+                    reinterpret_cast<void**>(&probability), sizeof(double) * size, stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
-                error = hipMalloc(reinterpret_cast<void**>(&alias), sizeof(unsigned int) * size);
+                error = rocrand_host::detail::device_malloc_async(
+                    reinterpret_cast<void**>(&alias), sizeof(unsigned int) * size, stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -186,7 +398,8 @@ protected:
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                error = hipMalloc(reinterpret_cast<void**>(&cdf), sizeof(double) * size);
+                error = rocrand_host::detail::device_malloc_async(
+                    reinterpret_cast<void**>(&cdf), sizeof(double) * size, stream);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -209,7 +422,7 @@ protected:
         }
     }
 
-    void create_alias_table(std::vector<double> p)
+    void create_alias_table(std::vector<double> p, hipStream_t stream = 0)
     {
         std::vector<double> h_probability(size);
         std::vector<unsigned int> h_alias(size);
@@ -264,13 +477,18 @@ protected:
         }
         else
         {
+            // The pool copies out of the vectors before returning, so the
+            // upload may still be in flight on stream when they go out of
+            // scope
             hipError_t error;
-            error = hipMemcpy(probability, h_probability.data(), sizeof(double) * size, hipMemcpyDefault);
+            error = rocrand_host::detail::pinned_staging_pool::copy_to_device(
+                probability, h_probability.data(), sizeof(double) * size, stream);
             if (error != hipSuccess)
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
-            error = hipMemcpy(alias, h_alias.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
+            error = rocrand_host::detail::pinned_staging_pool::copy_to_device(
+                alias, h_alias.data(), sizeof(unsigned int) * size, stream);
             if (error != hipSuccess)
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
@@ -278,7 +496,7 @@ protected:
         }
     }
 
-    void create_cdf(std::vector<double> p)
+    void create_cdf(std::vector<double> p, hipStream_t stream = 0)
     {
         std::vector<double> h_cdf(size);
 
@@ -295,8 +513,8 @@ protected:
         }
         else
         {
-            hipError_t error;
-            error = hipMemcpy(cdf, h_cdf.data(), sizeof(double) * size, hipMemcpyDefault);
+            const hipError_t error = rocrand_host::detail::pinned_staging_pool::copy_to_device(
+                cdf, h_cdf.data(), sizeof(double) * size, stream);
             if (error != hipSuccess)
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
@@ -305,4 +523,28 @@ protected:
     }
 };
 
+template<typename state_type>
+struct mrg_engine_discrete_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> dis;
+
+    __host__ __device__
+    mrg_engine_discrete_distribution(const rocrand_discrete_distribution_st& dis)
+        : dis(dis)
+    { }
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        // The MRG-based engine's "raw" output is in [1, MRG_M1], remap it
+        // to [0, UINT_MAX] as required by the alias method:
+        unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = dis(v);
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_DISCRETE_H_
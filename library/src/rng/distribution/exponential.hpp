@@ -0,0 +1,205 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Exponential distribution via inverse CDF: -log(u) / lambda.
+// The uniform transforms return values in (0, 1], so the logarithm
+// is always finite.
+
+// Universal
+
+template<class Output, class Input = unsigned int>
+struct exponential_distribution;
+
+template<>
+struct exponential_distribution<float, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float lambda;
+
+    __host__ __device__
+    exponential_distribution(float lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = -logf(u) / lambda;
+    }
+};
+
+template<>
+struct exponential_distribution<double, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double lambda;
+
+    __host__ __device__
+    exponential_distribution(double lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0], input[1]);
+        output[0] = -log(u) / lambda;
+    }
+};
+
+// 64 bit Universal
+
+template<>
+struct exponential_distribution<float, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float lambda;
+
+    __host__ __device__ exponential_distribution(float lambda)
+        : lambda(lambda)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = -logf(u) / lambda;
+    }
+};
+
+template<>
+struct exponential_distribution<double, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double lambda;
+
+    __host__ __device__ exponential_distribution(double lambda)
+        : lambda(lambda)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0]);
+        output[0] = -log(u) / lambda;
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_exponential_distribution;
+
+template<typename state_type>
+struct mrg_engine_exponential_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float lambda;
+
+    __host__ __device__ mrg_engine_exponential_distribution(float lambda)
+        : lambda(lambda)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]);
+        output[0] = -logf(u) / lambda;
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_exponential_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double lambda;
+
+    __host__ __device__ mrg_engine_exponential_distribution(double lambda)
+        : lambda(lambda)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        const double u
+            = rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0]);
+        output[0] = -log(u) / lambda;
+    }
+};
+
+// Sobol
+
+template<class T>
+struct sobol_exponential_distribution;
+
+template<>
+struct sobol_exponential_distribution<float>
+{
+    const float lambda;
+
+    __host__ __device__
+    sobol_exponential_distribution(float lambda)
+        : lambda(lambda) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ float operator()(const DirectionVectorType x) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(x);
+        return -logf(u) / lambda;
+    }
+};
+
+template<>
+struct sobol_exponential_distribution<double>
+{
+    const double lambda;
+
+    __host__ __device__
+    sobol_exponential_distribution(double lambda)
+        : lambda(lambda) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ double operator()(const DirectionVectorType x) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(x);
+        return -log(u) / lambda;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
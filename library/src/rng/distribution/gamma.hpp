@@ -0,0 +1,258 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+#define ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Refreshes a rejected candidate in-register so that the rejection loops
+// below consume a fixed number of engine outputs per generated value
+// (required by the fixed input_width of the generate kernels).
+__forceinline__ __host__ __device__
+unsigned int gamma_refresh(unsigned int& w)
+{
+    w = w * 1664525u + 1013904223u;
+    return w;
+}
+
+// Marsaglia-Tsang rejection sampling. The boost step extends the method
+// to shapes smaller than 1: Gamma(a) = Gamma(a + 1) * U^(1/a).
+__forceinline__ __host__ __device__
+float gamma_distribution(unsigned int w0, unsigned int w1, float shape)
+{
+    float boost = 1.0f;
+    float alpha = shape;
+    if(alpha < 1.0f)
+    {
+        unsigned int wb = w1 ^ 0x9E3779B9u;
+        const float u = rocrand_device::detail::uniform_distribution(gamma_refresh(wb));
+        boost = powf(u, 1.0f / alpha);
+        alpha += 1.0f;
+    }
+    const float d = alpha - (1.0f / 3.0f);
+    const float c = 1.0f / sqrtf(9.0f * d);
+    while(true)
+    {
+        const float x  = rocrand_device::detail::normal_distribution(w0);
+        const float cx = 1.0f + c * x;
+        if(cx > 0.0f)
+        {
+            const float v  = cx * cx * cx;
+            const float u  = rocrand_device::detail::uniform_distribution(w1);
+            const float x2 = x * x;
+            // The squeeze check accepts most candidates without logarithms
+            if(u < 1.0f - 0.0331f * x2 * x2)
+                return boost * d * v;
+            if(logf(u) < 0.5f * x2 + d * (1.0f - v + logf(v)))
+                return boost * d * v;
+        }
+        gamma_refresh(w0);
+        gamma_refresh(w1);
+    }
+}
+
+__forceinline__ __host__ __device__
+double gamma_distribution_double(unsigned int w0, unsigned int w1, double shape)
+{
+    double boost = 1.0;
+    double alpha = shape;
+    if(alpha < 1.0)
+    {
+        unsigned int wb = w1 ^ 0x9E3779B9u;
+        const double u = rocrand_device::detail::uniform_distribution_double(gamma_refresh(wb));
+        boost = pow(u, 1.0 / alpha);
+        alpha += 1.0;
+    }
+    const double d = alpha - (1.0 / 3.0);
+    const double c = 1.0 / sqrt(9.0 * d);
+    while(true)
+    {
+        const double x  = rocrand_device::detail::normal_distribution_double(w0);
+        const double cx = 1.0 + c * x;
+        if(cx > 0.0)
+        {
+            const double v  = cx * cx * cx;
+            const double u  = rocrand_device::detail::uniform_distribution_double(w1);
+            const double x2 = x * x;
+            if(u < 1.0 - 0.0331 * x2 * x2)
+                return boost * d * v;
+            if(log(u) < 0.5 * x2 + d * (1.0 - v + log(v)))
+                return boost * d * v;
+        }
+        gamma_refresh(w0);
+        gamma_refresh(w1);
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Universal
+
+template<class Output, class Input = unsigned int, unsigned int MaxInputWidth = 4>
+struct gamma_distribution;
+
+template<unsigned int MaxInputWidth>
+struct gamma_distribution<float, unsigned int, MaxInputWidth>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const float shape;
+    const float scale;
+
+    __host__ __device__
+    gamma_distribution(float shape, float scale)
+        : shape(shape), scale(scale) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], float (&output)[1]) const
+    {
+        output[0] = scale * rocrand_host::detail::gamma_distribution(input[0], input[1], shape);
+    }
+};
+
+template<unsigned int MaxInputWidth>
+struct gamma_distribution<double, unsigned int, MaxInputWidth>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double shape;
+    const double scale;
+
+    __host__ __device__
+    gamma_distribution(double shape, double scale)
+        : shape(shape), scale(scale) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        output[0]
+            = scale * rocrand_host::detail::gamma_distribution_double(input[0], input[1], shape);
+    }
+};
+
+// 64 bit Universal
+
+template<unsigned int MaxInputWidth>
+struct gamma_distribution<float, unsigned long long, MaxInputWidth>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float shape;
+    const float scale;
+
+    __host__ __device__ gamma_distribution(float shape, float scale) : shape(shape), scale(scale)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        const unsigned int w0 = static_cast<unsigned int>(input[0]);
+        const unsigned int w1 = static_cast<unsigned int>(input[0] >> 32);
+        output[0]             = scale * rocrand_host::detail::gamma_distribution(w0, w1, shape);
+    }
+};
+
+template<unsigned int MaxInputWidth>
+struct gamma_distribution<double, unsigned long long, MaxInputWidth>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double shape;
+    const double scale;
+
+    __host__ __device__ gamma_distribution(double shape, double scale) : shape(shape), scale(scale)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        const unsigned int w0 = static_cast<unsigned int>(input[0]);
+        const unsigned int w1 = static_cast<unsigned int>(input[0] >> 32);
+        output[0] = scale * rocrand_host::detail::gamma_distribution_double(w0, w1, shape);
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_gamma_distribution;
+
+template<typename state_type>
+struct mrg_engine_gamma_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const float shape;
+    const float scale;
+
+    __host__ __device__ mrg_engine_gamma_distribution(float shape, float scale)
+        : shape(shape), scale(scale)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], float (&output)[1]) const
+    {
+        // MRG-based engine's "raw" output is in [1, MRG_M1], remap to [0, UINT_MAX]
+        const unsigned int w0
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        const unsigned int w1
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[1]);
+        output[0] = scale * rocrand_host::detail::gamma_distribution(w0, w1, shape);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_gamma_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double shape;
+    const double scale;
+
+    __host__ __device__ mrg_engine_gamma_distribution(double shape, double scale)
+        : shape(shape), scale(scale)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        const unsigned int w0
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        const unsigned int w1
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[1]);
+        output[0] = scale * rocrand_host::detail::gamma_distribution_double(w0, w1, shape);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
@@ -25,6 +25,7 @@
 #include <hip/hip_runtime.h>
 
 #include "device_distributions.hpp"
+#include "normal.hpp"
 
 
 // Universal
@@ -40,14 +41,25 @@ struct log_normal_distribution<float, unsigned int, 4>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    log_normal_distribution(float mean, float stddev,
+                            rocrand_math_mode math_mode = ROCRAND_MATH_PRECISE)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(fast_math)
+        {
+            const float2 v = rocrand_host::detail::box_muller_fast(input[0], input[1]);
+            output[0] = __expf(mean + v.x * stddev);
+            output[1] = __expf(mean + v.y * stddev);
+            return;
+        }
+#endif
         float2 v = rocrand_device::detail::normal_distribution2(input[0], input[1]);
         output[0] = expf(mean + v.x * stddev);
         output[1] = expf(mean + v.y * stddev);
@@ -63,7 +75,8 @@ struct log_normal_distribution<double, unsigned int, 2>
     const double mean;
     const double stddev;
 
-    __host__ __device__ log_normal_distribution(double mean, double stddev)
+    __host__ __device__ log_normal_distribution(double mean, double stddev,
+                                                rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean), stddev(stddev)
     {}
 
@@ -84,7 +97,8 @@ struct log_normal_distribution<double, unsigned int, 4>
     const double stddev;
 
     __host__ __device__
-    log_normal_distribution(double mean, double stddev)
+    log_normal_distribution(double mean, double stddev,
+                            rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -108,7 +122,8 @@ struct log_normal_distribution<__half, unsigned int, 4>
     const __half2 stddev;
 
     __host__ __device__
-    log_normal_distribution(__half mean, __half stddev)
+    log_normal_distribution(__half mean, __half stddev,
+                            rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
@@ -134,14 +149,28 @@ struct log_normal_distribution<float, unsigned long long, 4>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
-    __host__ __device__ log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev)
+    __host__ __device__ log_normal_distribution(float mean, float stddev,
+                                                rocrand_math_mode math_mode
+                                                = ROCRAND_MATH_PRECISE)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST)
     {}
 
     __host__ __device__ void operator()(const unsigned long long (&input)[1],
                                         float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(fast_math)
+        {
+            const float2 v = rocrand_host::detail::box_muller_fast(
+                static_cast<unsigned int>(input[0]),
+                static_cast<unsigned int>(input[0] >> 32));
+            output[0] = __expf(mean + v.x * stddev);
+            output[1] = __expf(mean + v.y * stddev);
+            return;
+        }
+#endif
         float2 v  = rocrand_device::detail::normal_distribution2(input[0]);
         output[0] = expf(mean + v.x * stddev);
         output[1] = expf(mean + v.y * stddev);
@@ -157,7 +186,8 @@ struct log_normal_distribution<double, unsigned long long, 4>
     const double mean;
     const double stddev;
 
-    __host__ __device__ log_normal_distribution(double mean, double stddev)
+    __host__ __device__ log_normal_distribution(double mean, double stddev,
+                                                rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean), stddev(stddev)
     {}
 
@@ -180,7 +210,8 @@ struct log_normal_distribution<__half, unsigned long long, 4>
     const __half2 mean;
     const __half2 stddev;
 
-    __host__ __device__ log_normal_distribution(__half mean, __half stddev)
+    __host__ __device__ log_normal_distribution(__half mean, __half stddev,
+                                                rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean, mean), stddev(stddev, stddev)
     {}
 
@@ -210,14 +241,27 @@ struct mrg_engine_log_normal_distribution<float, state_type>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
-    __host__ __device__ mrg_engine_log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev)
+    __host__ __device__ mrg_engine_log_normal_distribution(float mean, float stddev,
+                                                           rocrand_math_mode math_mode
+                                                           = ROCRAND_MATH_PRECISE)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST)
     {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(fast_math)
+        {
+            const float2 v
+                = rocrand_host::detail::mrg_box_muller_fast<state_type>(input[0], input[1]);
+            output[0] = __expf(mean + v.x * stddev);
+            output[1] = __expf(mean + v.y * stddev);
+            return;
+        }
+#endif
         float2 v = rocrand_device::detail::mrg_normal_distribution2<state_type>(input[0], input[1]);
         output[0] = expf(mean + v.x * stddev);
         output[1] = expf(mean + v.y * stddev);
@@ -233,7 +277,8 @@ struct mrg_engine_log_normal_distribution<double, state_type>
     const double mean;
     const double stddev;
 
-    __host__ __device__ mrg_engine_log_normal_distribution(double mean, double stddev)
+    __host__ __device__ mrg_engine_log_normal_distribution(double mean, double stddev,
+                                                           rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean), stddev(stddev)
     {}
 
@@ -256,7 +301,8 @@ struct mrg_engine_log_normal_distribution<__half, state_type>
     const __half2 mean;
     const __half2 stddev;
 
-    __host__ __device__ mrg_engine_log_normal_distribution(__half mean, __half stddev)
+    __host__ __device__ mrg_engine_log_normal_distribution(__half mean, __half stddev,
+                                                           rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean, mean), stddev(stddev, stddev)
     {}
 
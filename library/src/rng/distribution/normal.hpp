@@ -25,7 +25,92 @@
 #include <hip/hip_runtime.h>
 
 #include "device_distributions.hpp"
+#include "ziggurat.hpp"
 
+namespace rocrand_host {
+namespace detail {
+
+// Box-Muller pair computed with the fast-math device intrinsics, used by
+// the single-precision distributions under ROCRAND_MATH_FAST. Host code
+// has no fast intrinsics and keeps the full-precision form.
+__forceinline__ __host__ __device__
+float2 box_muller_fast(unsigned int x, unsigned int y)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+    float2 result;
+    const float u = ROCRAND_2POW32_INV + (x * ROCRAND_2POW32_INV);
+    const float v = ROCRAND_2POW32_INV_2PI + (y * ROCRAND_2POW32_INV_2PI);
+    const float s = sqrtf(-2.0f * __logf(u));
+    __sincosf(v, &result.x, &result.y);
+    result.x *= s;
+    result.y *= s;
+    return result;
+#else
+    return ::rocrand_device::detail::box_muller(x, y);
+#endif
+}
+
+template<typename state_type>
+__forceinline__ __host__ __device__
+float2 mrg_box_muller_fast(unsigned int x, unsigned int y)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+    float2 result;
+    const float u = ::rocrand_device::detail::mrg_uniform_distribution<state_type>(x);
+    const float v = ::rocrand_device::detail::mrg_uniform_distribution<state_type>(y) * ROCRAND_2PI;
+    const float s = sqrtf(-2.0f * __logf(u));
+    __sincosf(v, &result.x, &result.y);
+    result.x *= s;
+    result.y *= s;
+    return result;
+#else
+    return ::rocrand_device::detail::mrg_box_muller<state_type>(x, y);
+#endif
+}
+
+// Marsaglia polar pair: maps a uniform point in the unit disc to a
+// normal pair with one logarithm, one square root and one division in
+// FP64 and no trigonometry, which makes it the cheapest exact double
+// method on architectures with reduced FP64 rate. Rejected points
+// (about 21.5%) are refreshed in-register with LCG steps (as in
+// truncated_normal below), so every output pair consumes exactly four
+// engine words.
+__forceinline__ __host__ __device__
+double2 marsaglia_polar_double2(uint4 v)
+{
+    while(true)
+    {
+        const unsigned long long ax
+            = (unsigned long long)v.x ^ ((unsigned long long)v.y << (53 - 32));
+        const unsigned long long ay
+            = (unsigned long long)v.z ^ ((unsigned long long)v.w << (53 - 32));
+        const double x = 2.0 * (ax * ROCRAND_2POW53_INV_DOUBLE) - 1.0;
+        const double y = 2.0 * (ay * ROCRAND_2POW53_INV_DOUBLE) - 1.0;
+        const double s = x * x + y * y;
+        if(s < 1.0 && s > 0.0)
+        {
+            const double f = sqrt(-2.0 * log(s) / s);
+            return double2{x * f, y * f};
+        }
+        v.x = v.x * 1664525u + 1013904223u;
+        v.y = v.y * 1664525u + 1013904223u;
+        v.z = v.z * 1664525u + 1013904223u;
+        v.w = v.w * 1664525u + 1013904223u;
+    }
+}
+
+// Accuracy-tiered double path: the Box-Muller transform evaluated in
+// single precision and widened, bypassing the FP64 unit entirely at the
+// cost of float accuracy (about 2^-24) in the result
+__forceinline__ __host__ __device__
+double2 normal_double2_via_float(unsigned int x, unsigned int y)
+{
+    const float2 v = box_muller_fast(x, y);
+    return double2{static_cast<double>(v.x), static_cast<double>(v.y)};
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
 
 // Universal
 
@@ -40,14 +125,47 @@ struct normal_distribution<float, unsigned int, 4>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
+    bool ziggurat = false;
+    rocrand_host::detail::ziggurat_tables zig;
 
     __host__ __device__
-    normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    normal_distribution(float mean, float stddev,
+                        rocrand_math_mode math_mode = ROCRAND_MATH_PRECISE,
+                        rocrand_normal_method method = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST)
+    {
+#if !defined(__HIP_DEVICE_COMPILE__)
+        // The tables live in device memory; when the upload failed the
+        // distribution silently keeps using Box-Muller
+        if(method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            zig = rocrand_host::detail::ziggurat_table_registry::get();
+            ziggurat = zig.kn != NULL;
+        }
+#else
+        (void)method;
+#endif
+    }
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(ziggurat)
+        {
+            output[0] = mean + stddev * rocrand_host::detail::ziggurat_normal(input[0], zig);
+            output[1] = mean + stddev * rocrand_host::detail::ziggurat_normal(input[1], zig);
+            return;
+        }
+        if(fast_math)
+        {
+            const float2 v = rocrand_host::detail::box_muller_fast(input[0], input[1]);
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
+#endif
         float2 v = rocrand_device::detail::normal_distribution2(input[0], input[1]);
         output[0] = mean + v.x * stddev;
         output[1] = mean + v.y * stddev;
@@ -62,12 +180,40 @@ struct normal_distribution<double, unsigned int, 2>
 
     const double mean;
     const double stddev;
-
-    __host__ __device__ normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev)
+    const bool polar;
+    const bool via_float;
+
+    __host__ __device__ normal_distribution(double mean, double stddev,
+                                            rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                                            rocrand_normal_method method
+                                            = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(mean), stddev(stddev),
+          polar(method == ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR),
+          via_float(method == ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT)
     {}
 
     __host__ __device__ void operator()(const unsigned int (&input)[1], double (&output)[1]) const
     {
+        // This width-1 path has a single engine word per output; the
+        // alternative methods derive their extra words with LCG steps
+        if(polar)
+        {
+            const unsigned int w1 = input[0] * 1664525u + 1013904223u;
+            const unsigned int w2 = w1 * 1664525u + 1013904223u;
+            const unsigned int w3 = w2 * 1664525u + 1013904223u;
+            const double2 v = rocrand_host::detail::marsaglia_polar_double2(
+                make_uint4(input[0], w1, w2, w3));
+            output[0] = mean + v.x * stddev;
+            return;
+        }
+        if(via_float)
+        {
+            const unsigned int w1 = input[0] * 1664525u + 1013904223u;
+            const double2 v
+                = rocrand_host::detail::normal_double2_via_float(input[0], w1);
+            output[0] = mean + v.x * stddev;
+            return;
+        }
         double v  = rocrand_device::detail::normal_distribution_double(input[0]);
         output[0] = mean + v * stddev;
     }
@@ -81,14 +227,39 @@ struct normal_distribution<double, unsigned int, 4>
 
     const double mean;
     const double stddev;
+    const bool polar;
+    const bool via_float;
 
     __host__ __device__
-    normal_distribution(double mean, double stddev)
-        : mean(mean), stddev(stddev) {}
+    normal_distribution(double mean, double stddev,
+                        rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                        rocrand_normal_method method = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(mean), stddev(stddev),
+          polar(method == ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR),
+          via_float(method == ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[4], double (&output)[2]) const
     {
+        if(polar)
+        {
+            const double2 v = rocrand_host::detail::marsaglia_polar_double2(
+                make_uint4(input[0], input[1], input[2], input[3]));
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
+        if(via_float)
+        {
+            // Float accuracy needs only one 32-bit word per uniform; the
+            // other two words of the fixed input width go unused so the
+            // engine consumption stays method-independent here
+            const double2 v
+                = rocrand_host::detail::normal_double2_via_float(input[0], input[1]);
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
         double2 v = rocrand_device::detail::normal_distribution_double2(
             make_uint4(input[0], input[1], input[2], input[3])
         );
@@ -100,29 +271,64 @@ struct normal_distribution<double, unsigned int, 4>
 template<>
 struct normal_distribution<__half, unsigned int, 4>
 {
-    static constexpr unsigned int input_width = 1;
-    static constexpr unsigned int output_width = 2;
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 4;
 
     const __half2 mean;
     const __half2 stddev;
 
     __host__ __device__
-    normal_distribution(__half mean, __half stddev)
+    normal_distribution(__half mean, __half stddev,
+                        rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                        rocrand_normal_method = ROCRAND_NORMAL_METHOD_BOX_MULLER)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
-    void operator()(const unsigned int (&input)[1], __half (&output)[2]) const
+    void operator()(const unsigned int (&input)[2], __half (&output)[4]) const
     {
-        __half2 v = rocrand_device::detail::normal_distribution_half2(input[0]);
+        __half2 v1, v2;
+        rocrand_device::detail::normal_distribution_half4(input[0], input[1], v1, v2);
         #if defined(ROCRAND_HALF_MATH_SUPPORTED)
-        *reinterpret_cast<__half2 *>(output) = __hfma2(v, stddev, mean);
+        *reinterpret_cast<__half2 *>(output) = __hfma2(v1, stddev, mean);
+        *reinterpret_cast<__half2 *>(output + 2) = __hfma2(v2, stddev, mean);
         #else
-        output[0] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v)));
-        output[1] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v)));
+        output[0] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v1)));
+        output[1] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v1)));
+        output[2] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v2)));
+        output[3] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v2)));
         #endif
     }
 };
 
+// bfloat16 has no device math, so mean and stddev are kept in float
+// and the outputs are converted only at the final write
+template<>
+struct normal_distribution<hip_bfloat16, unsigned int, 4>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 4;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev,
+                        rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                        rocrand_normal_method = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], hip_bfloat16 (&output)[4]) const
+    {
+        float2 v1, v2;
+        rocrand_device::detail::normal_distribution_bf16_4(input[0], input[1], v1, v2);
+        output[0] = hip_bfloat16(mean + (stddev * v1.x));
+        output[1] = hip_bfloat16(mean + (stddev * v1.y));
+        output[2] = hip_bfloat16(mean + (stddev * v2.x));
+        output[3] = hip_bfloat16(mean + (stddev * v2.y));
+    }
+};
+
 // 64 bit Universal
 
 template<>
@@ -133,13 +339,53 @@ struct normal_distribution<float, unsigned long long, 4>
 
     const float mean;
     const float stddev;
-
-    __host__ __device__ normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev)
-    {}
+    const bool fast_math;
+    bool ziggurat = false;
+    rocrand_host::detail::ziggurat_tables zig;
+
+    __host__ __device__ normal_distribution(float mean, float stddev,
+                                            rocrand_math_mode math_mode = ROCRAND_MATH_PRECISE,
+                                            rocrand_normal_method method
+                                            = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST)
+    {
+#if !defined(__HIP_DEVICE_COMPILE__)
+        if(method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            zig = rocrand_host::detail::ziggurat_table_registry::get();
+            ziggurat = zig.kn != NULL;
+        }
+#else
+        (void)method;
+#endif
+    }
 
     __host__ __device__ void operator()(const unsigned long long (&input)[1],
                                         float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(ziggurat)
+        {
+            output[0] = mean
+                        + stddev
+                              * rocrand_host::detail::ziggurat_normal(
+                                  static_cast<unsigned int>(input[0]), zig);
+            output[1] = mean
+                        + stddev
+                              * rocrand_host::detail::ziggurat_normal(
+                                  static_cast<unsigned int>(input[0] >> 32), zig);
+            return;
+        }
+        if(fast_math)
+        {
+            const float2 v = rocrand_host::detail::box_muller_fast(
+                static_cast<unsigned int>(input[0]),
+                static_cast<unsigned int>(input[0] >> 32));
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
+#endif
         float2 v  = rocrand_device::detail::normal_distribution2(input[0]);
         output[0] = mean + v.x * stddev;
         output[1] = mean + v.y * stddev;
@@ -154,13 +400,41 @@ struct normal_distribution<double, unsigned long long, 4>
 
     const double mean;
     const double stddev;
-
-    __host__ __device__ normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev)
+    const bool polar;
+    const bool via_float;
+
+    __host__ __device__ normal_distribution(double mean, double stddev,
+                                            rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                                            rocrand_normal_method method
+                                            = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(mean), stddev(stddev),
+          polar(method == ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR),
+          via_float(method == ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT)
     {}
 
     __host__ __device__ void operator()(const unsigned long long (&input)[2],
                                         double (&output)[2]) const
     {
+        if(polar)
+        {
+            const double2 v = rocrand_host::detail::marsaglia_polar_double2(
+                make_uint4(static_cast<unsigned int>(input[0]),
+                           static_cast<unsigned int>(input[0] >> 32),
+                           static_cast<unsigned int>(input[1]),
+                           static_cast<unsigned int>(input[1] >> 32)));
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
+        if(via_float)
+        {
+            const double2 v = rocrand_host::detail::normal_double2_via_float(
+                static_cast<unsigned int>(input[0]),
+                static_cast<unsigned int>(input[0] >> 32));
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
         double2 v = rocrand_device::detail::normal_distribution_double2(
             make_ulonglong2(input[0], input[1]));
         output[0] = mean + v.x * stddev;
@@ -172,28 +446,63 @@ template<>
 struct normal_distribution<__half, unsigned long long, 4>
 {
     static constexpr unsigned int input_width  = 1;
-    static constexpr unsigned int output_width = 2;
+    static constexpr unsigned int output_width = 4;
 
     const __half2 mean;
     const __half2 stddev;
 
-    __host__ __device__ normal_distribution(__half mean, __half stddev)
+    __host__ __device__ normal_distribution(__half mean, __half stddev,
+                                            rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                                            rocrand_normal_method
+                                            = ROCRAND_NORMAL_METHOD_BOX_MULLER)
         : mean(mean, mean), stddev(stddev, stddev)
     {}
 
     __host__ __device__ void operator()(const unsigned long long (&input)[1],
-                                        __half (&output)[2]) const
+                                        __half (&output)[4]) const
     {
-        __half2 v = rocrand_device::detail::normal_distribution_half2(input[0]);
+        __half2 v1, v2;
+        rocrand_device::detail::normal_distribution_half4(input[0], v1, v2);
 #if defined(ROCRAND_HALF_MATH_SUPPORTED)
-        *reinterpret_cast<__half2*>(output) = __hfma2(v, stddev, mean);
+        *reinterpret_cast<__half2*>(output) = __hfma2(v1, stddev, mean);
+        *reinterpret_cast<__half2*>(output + 2) = __hfma2(v2, stddev, mean);
 #else
-        output[0] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v)));
-        output[1] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v)));
+        output[0] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v1)));
+        output[1] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v1)));
+        output[2] = __float2half(__low2float(mean) + (__low2float(stddev) * __low2float(v2)));
+        output[3] = __float2half(__low2float(mean) + (__low2float(stddev) * __high2float(v2)));
 #endif
     }
 };
 
+template<>
+struct normal_distribution<hip_bfloat16, unsigned long long, 4>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__ normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev,
+                                            rocrand_math_mode = ROCRAND_MATH_PRECISE,
+                                            rocrand_normal_method
+                                            = ROCRAND_NORMAL_METHOD_BOX_MULLER)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev))
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        hip_bfloat16 (&output)[4]) const
+    {
+        float2 v1, v2;
+        rocrand_device::detail::normal_distribution_bf16_4(input[0], v1, v2);
+        output[0] = hip_bfloat16(mean + (stddev * v1.x));
+        output[1] = hip_bfloat16(mean + (stddev * v1.y));
+        output[2] = hip_bfloat16(mean + (stddev * v2.x));
+        output[3] = hip_bfloat16(mean + (stddev * v2.y));
+    }
+};
+
 // Mrg32k3a
 
 template<class T, typename engine>
@@ -207,14 +516,27 @@ struct mrg_engine_normal_distribution<float, state_type>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
-    __host__ __device__ mrg_engine_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev)
+    __host__ __device__ mrg_engine_normal_distribution(float mean, float stddev,
+                                                       rocrand_math_mode math_mode
+                                                       = ROCRAND_MATH_PRECISE)
+        : mean(mean), stddev(stddev), fast_math(math_mode == ROCRAND_MATH_FAST)
     {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
+#if defined(__HIP_DEVICE_COMPILE__)
+        if(fast_math)
+        {
+            const float2 v
+                = rocrand_host::detail::mrg_box_muller_fast<state_type>(input[0], input[1]);
+            output[0] = mean + v.x * stddev;
+            output[1] = mean + v.y * stddev;
+            return;
+        }
+#endif
         float2 v = rocrand_device::detail::mrg_normal_distribution2<state_type>(input[0], input[1]);
         output[0] = mean + v.x * stddev;
         output[1] = mean + v.y * stddev;
@@ -230,7 +552,8 @@ struct mrg_engine_normal_distribution<double, state_type>
     const double mean;
     const double stddev;
 
-    __host__ __device__ mrg_engine_normal_distribution(double mean, double stddev)
+    __host__ __device__ mrg_engine_normal_distribution(double mean, double stddev,
+                                                       rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean), stddev(stddev)
     {}
 
@@ -253,7 +576,8 @@ struct mrg_engine_normal_distribution<__half, state_type>
     const __half2 mean;
     const __half2 stddev;
 
-    __host__ __device__ mrg_engine_normal_distribution(__half mean, __half stddev)
+    __host__ __device__ mrg_engine_normal_distribution(__half mean, __half stddev,
+                                                       rocrand_math_mode = ROCRAND_MATH_PRECISE)
         : mean(mean, mean), stddev(stddev, stddev)
     {}
 
@@ -270,6 +594,29 @@ struct mrg_engine_normal_distribution<__half, state_type>
     }
 };
 
+template<typename state_type>
+struct mrg_engine_normal_distribution<hip_bfloat16, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__ mrg_engine_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev,
+                                                       rocrand_math_mode = ROCRAND_MATH_PRECISE)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev))
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], hip_bfloat16 (&output)[2]) const
+    {
+        float2 v = rocrand_device::detail::mrg_normal_distribution_bf16_2<state_type>(input[0]);
+        output[0] = hip_bfloat16(mean + (stddev * v.x));
+        output[1] = hip_bfloat16(mean + (stddev * v.y));
+    }
+};
+
 // Mrg32k3a (compatibility API)
 
 template<class T>
@@ -302,6 +649,15 @@ struct mrg_normal_distribution<__half>
     {}
 };
 
+template<>
+struct mrg_normal_distribution<hip_bfloat16>
+    : mrg_engine_normal_distribution<hip_bfloat16, rocrand_state_mrg32k3a>
+{
+    __host__ __device__ mrg_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev)
+        : mrg_engine_normal_distribution(mean, stddev)
+    {}
+};
+
 // Sobol
 
 template<class T>
@@ -368,4 +724,205 @@ struct sobol_normal_distribution<__half>
     }
 };
 
+template<>
+struct sobol_normal_distribution<hip_bfloat16>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    sobol_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__
+    hip_bfloat16 operator()(const DirectionVectorType x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return hip_bfloat16(mean + (v * stddev));
+    }
+};
+
+// Truncated normal
+
+namespace rocrand_host {
+namespace detail {
+
+// Rejection sampling for the normal distribution truncated to [lo, hi].
+// Rejected candidates are refreshed in-register with an LCG step (see
+// gamma.hpp) so that every output consumes exactly one engine word.
+__forceinline__ __host__ __device__
+float truncated_normal(unsigned int w, float mean, float stddev, float lo, float hi)
+{
+    while(true)
+    {
+        const float v = mean + stddev * rocrand_device::detail::normal_distribution(w);
+        if(v >= lo && v <= hi)
+            return v;
+        w = w * 1664525u + 1013904223u;
+    }
+}
+
+__forceinline__ __host__ __device__
+double truncated_normal_double(unsigned int w, double mean, double stddev, double lo, double hi)
+{
+    while(true)
+    {
+        const double v = mean + stddev * rocrand_device::detail::normal_distribution_double(w);
+        if(v >= lo && v <= hi)
+            return v;
+        w = w * 1664525u + 1013904223u;
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+template<class Output, class Input = unsigned int>
+struct truncated_normal_distribution;
+
+template<>
+struct truncated_normal_distribution<float, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float mean;
+    const float stddev;
+    const float lo;
+    const float hi;
+
+    __host__ __device__
+    truncated_normal_distribution(float mean, float stddev, float lo, float hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        output[0] = rocrand_host::detail::truncated_normal(input[0], mean, stddev, lo, hi);
+    }
+};
+
+template<>
+struct truncated_normal_distribution<double, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double mean;
+    const double stddev;
+    const double lo;
+    const double hi;
+
+    __host__ __device__
+    truncated_normal_distribution(double mean, double stddev, double lo, double hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        output[0] = rocrand_host::detail::truncated_normal_double(input[0], mean, stddev, lo, hi);
+    }
+};
+
+template<>
+struct truncated_normal_distribution<float, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float mean;
+    const float stddev;
+    const float lo;
+    const float hi;
+
+    __host__ __device__ truncated_normal_distribution(float mean, float stddev, float lo, float hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        const unsigned int w = static_cast<unsigned int>(input[0] >> 32);
+        output[0] = rocrand_host::detail::truncated_normal(w, mean, stddev, lo, hi);
+    }
+};
+
+template<>
+struct truncated_normal_distribution<double, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double mean;
+    const double stddev;
+    const double lo;
+    const double hi;
+
+    __host__ __device__
+    truncated_normal_distribution(double mean, double stddev, double lo, double hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        const unsigned int w = static_cast<unsigned int>(input[0] >> 32);
+        output[0] = rocrand_host::detail::truncated_normal_double(w, mean, stddev, lo, hi);
+    }
+};
+
+template<class T, typename state_type>
+struct mrg_engine_truncated_normal_distribution;
+
+template<typename state_type>
+struct mrg_engine_truncated_normal_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float mean;
+    const float stddev;
+    const float lo;
+    const float hi;
+
+    __host__ __device__
+    mrg_engine_truncated_normal_distribution(float mean, float stddev, float lo, float hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const unsigned int w
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = rocrand_host::detail::truncated_normal(w, mean, stddev, lo, hi);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_truncated_normal_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double mean;
+    const double stddev;
+    const double lo;
+    const double hi;
+
+    __host__ __device__
+    mrg_engine_truncated_normal_distribution(double mean, double stddev, double lo, double hi)
+        : mean(mean), stddev(stddev), lo(lo), hi(hi)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        const unsigned int w
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = rocrand_host::detail::truncated_normal_double(w, mean, stddev, lo, hi);
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_H_
@@ -23,6 +23,8 @@
 
 #include <climits>
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <rocrand/rocrand.h>
@@ -45,10 +47,13 @@ public:
         set_lambda(lambda);
     }
 
+    rocrand_poisson_distribution(const rocrand_discrete_distribution_st& dis)
+        : base(dis) { }
+
     __host__ __device__
     ~rocrand_poisson_distribution() { }
 
-    void set_lambda(double lambda)
+    void set_lambda(double lambda, hipStream_t stream = 0)
     {
         const size_t capacity =
             2 * static_cast<size_t>(16.0 * (2.0 + std::sqrt(lambda)));
@@ -56,7 +61,7 @@ public:
 
         calculate_probabilities(p, capacity, lambda);
 
-        this->init(p, this->size, this->offset);
+        this->init(p, this->size, this->offset, stream);
     }
 
 protected:
@@ -109,9 +114,101 @@ protected:
     }
 };
 
-// Handles caching of precomputed tables for the distribution and recomputes
-// them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// Process-wide cache of built poisson tables, shared by all generators.
+// Lookups take an atomic snapshot of an immutable entry list, so the
+// common case - the lambda's table was already built by any generator -
+// involves no lock; builders serialize on a mutex only when a lambda is
+// seen for the first time, and each distinct lambda's tables are built
+// exactly once per process. The tables are never freed: they stay valid
+// for every generator until the process exits.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class poisson_distribution_registry
+{
+public:
+
+    using distribution_type = rocrand_poisson_distribution<Method, IsHostSide>;
+
+    // Returns the tables for lambda, building them on first use
+    static distribution_type get(double lambda)
+    {
+        snapshot_type snap = std::atomic_load_explicit(&snapshot(), std::memory_order_acquire);
+        const entry * e = find(*snap, lambda);
+        if (e != NULL)
+        {
+            return distribution_type(e->dis);
+        }
+
+        std::lock_guard<std::mutex> lock(builder_mutex());
+        // Another thread may have built the tables while we waited
+        snap = std::atomic_load_explicit(&snapshot(), std::memory_order_acquire);
+        e = find(*snap, lambda);
+        if (e != NULL)
+        {
+            return distribution_type(e->dis);
+        }
+
+        distribution_type dis;
+        dis.set_lambda(lambda);
+        if (!IsHostSide)
+        {
+            // The table uploads were issued asynchronously on the null
+            // stream; they must be complete before the tables are shared
+            // with generators that consume them on other streams
+            hipStreamSynchronize(0);
+        }
+
+        // Publish a new immutable list; concurrent lookups keep reading
+        // the old snapshot until the store
+        auto next = std::make_shared<std::vector<entry>>(*snap);
+        next->push_back(entry{lambda, dis});
+        std::atomic_store_explicit(&snapshot(),
+                                   snapshot_type(std::move(next)),
+                                   std::memory_order_release);
+        return dis;
+    }
+
+private:
+
+    struct entry
+    {
+        double lambda;
+        rocrand_discrete_distribution_st dis;
+    };
+
+    using snapshot_type = std::shared_ptr<const std::vector<entry>>;
+
+    static const entry * find(const std::vector<entry>& entries, double lambda)
+    {
+        for (const entry& e : entries)
+        {
+            if (e.lambda == lambda)
+            {
+                return &e;
+            }
+        }
+        return NULL;
+    }
+
+    static snapshot_type& snapshot()
+    {
+        static snapshot_type snap = std::make_shared<const std::vector<entry>>();
+        return snap;
+    }
+
+    static std::mutex& builder_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+};
+
+// Handles caching of precomputed tables for the distribution and fetches
+// them from the process-wide registry only when lambda is changed (as
+// these computations, device memory allocations and copying take time).
+// The distributions fetched so far are additionally kept in a small
+// most-recently-used list, so a workload alternating between a handful
+// of lambdas switches with a local copy and never touches the shared
+// registry snapshot again.
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
@@ -123,24 +220,59 @@ public:
         : lambda(0.0)
     { }
 
-    ~poisson_distribution_manager()
-    {
-        dis.deallocate();
-    }
+    // The tables behind dis and the recent list are owned by the
+    // registry and shared with other generators, so they are not
+    // deallocated here
+    ~poisson_distribution_manager() { }
 
     void set_lambda(double new_lambda)
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
+        if (lambda == new_lambda)
+        {
+            return;
+        }
+        lambda = new_lambda;
+
+        for (size_t i = 0; i < recent.size(); i++)
+        {
+            if (recent[i].lambda == new_lambda)
+            {
+                dis = recent[i].dis;
+                if (i != 0)
+                {
+                    const cached hit = recent[i];
+                    recent.erase(recent.begin() + i);
+                    recent.insert(recent.begin(), hit);
+                }
+                return;
+            }
+        }
+
+        dis = poisson_distribution_registry<Method, IsHostSide>::get(new_lambda);
+        recent.insert(recent.begin(), cached{new_lambda, dis});
+        if (recent.size() > max_recent)
         {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
+            // The evicted tables stay valid; the registry keeps them for
+            // the process lifetime and a later fetch finds them there
+            recent.pop_back();
         }
     }
 
 private:
 
+    struct cached
+    {
+        double lambda;
+        rocrand_poisson_distribution<Method, IsHostSide> dis;
+    };
+
+    // Covers workloads rotating through a few dozen lambdas; a linear
+    // scan of this many entries is far below the cost of the registry's
+    // atomic snapshot load
+    static constexpr size_t max_recent = 32;
+
     double lambda;
+    std::vector<cached> recent;
 };
 
 // Mrg32k3a and Mrg31k3p
@@ -108,10 +108,38 @@ struct uniform_distribution<__half, unsigned int>
 
     __host__ __device__
     void operator()(const unsigned int (&input)[1], __half (&output)[2]) const
+    {
+        const __half2 v = rocrand_device::detail::uniform_distribution_half2(input[0]);
+        output[0]       = v.x;
+        output[1]       = v.y;
+    }
+};
+
+template<>
+struct uniform_distribution<hip_bfloat16, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], hip_bfloat16 (&output)[2]) const
     {
         unsigned int v = input[0];
-        output[0] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v));
-        output[1] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v >> 16));
+        output[0] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v));
+        output[1] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> 16));
+    }
+};
+
+template<>
+struct uniform_distribution<unsigned long long, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], unsigned long long (&output)[1]) const
+    {
+        output[0] = (static_cast<unsigned long long>(input[0]) << 32) | input[1];
     }
 };
 
@@ -205,14 +233,539 @@ struct uniform_distribution<__half, unsigned long long>
     static constexpr unsigned int input_width  = 1;
     static constexpr unsigned int output_width = 4;
 
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        __half (&output)[4]) const
+    {
+        const unsigned long long v = input[0];
+        const __half2            lo
+            = rocrand_device::detail::uniform_distribution_half2(static_cast<unsigned int>(v));
+        const __half2 hi
+            = rocrand_device::detail::uniform_distribution_half2(static_cast<unsigned int>(v >> 32));
+        output[0] = lo.x;
+        output[1] = lo.y;
+        output[2] = hi.x;
+        output[3] = hi.y;
+    }
+};
+
+template<>
+struct uniform_distribution<hip_bfloat16, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        hip_bfloat16 (&output)[4]) const
+    {
+        unsigned long long v = input[0];
+        output[0] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v));
+        output[1] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> 16));
+        output[2] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> 32));
+        output[3] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> 48));
+    }
+};
+
+// Bounded integer range
+//
+// Maps raw engine output to uniform integers in [start, start + range)
+// using Lemire's multiply-shift technique. Candidates that fall into the
+// biased low fraction of the 32-bit space are refreshed in-register with
+// an LCG step so that every output consumes exactly one engine word
+// (required by the fixed input_width of the generate kernels).
+
+template<class Input = unsigned int>
+struct uniform_int_range_distribution;
+
+template<>
+struct uniform_int_range_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int start;
+    const unsigned int range;
+    const unsigned int threshold;
+
+    __host__ __device__
+    uniform_int_range_distribution(unsigned int start, unsigned int range)
+        : start(start), range(range), threshold((0u - range) % range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        unsigned int x = input[0];
+        unsigned long long m = static_cast<unsigned long long>(x) * range;
+        while(static_cast<unsigned int>(m) < threshold)
+        {
+            x = x * 1664525u + 1013904223u;
+            m = static_cast<unsigned long long>(x) * range;
+        }
+        output[0] = start + static_cast<unsigned int>(m >> 32);
+    }
+};
+
+template<>
+struct uniform_int_range_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int start;
+    const unsigned int range;
+    const unsigned int threshold;
+
+    __host__ __device__
+    uniform_int_range_distribution(unsigned int start, unsigned int range)
+        : start(start), range(range), threshold((0u - range) % range) {}
+
+    __host__ __device__
+    void operator()(const unsigned long long (&input)[1], unsigned int (&output)[1]) const
+    {
+        unsigned int x = static_cast<unsigned int>(input[0] >> 32);
+        unsigned long long m = static_cast<unsigned long long>(x) * range;
+        while(static_cast<unsigned int>(m) < threshold)
+        {
+            x = x * 1664525u + 1013904223u;
+            m = static_cast<unsigned long long>(x) * range;
+        }
+        output[0] = start + static_cast<unsigned int>(m >> 32);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_int_range_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int start;
+    const unsigned int range;
+    const unsigned int threshold;
+
+    __host__ __device__
+    mrg_engine_uniform_int_range_distribution(unsigned int start, unsigned int range)
+        : start(start), range(range), threshold((0u - range) % range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        unsigned int x
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        unsigned long long m = static_cast<unsigned long long>(x) * range;
+        while(static_cast<unsigned int>(m) < threshold)
+        {
+            x = x * 1664525u + 1013904223u;
+            m = static_cast<unsigned long long>(x) * range;
+        }
+        output[0] = start + static_cast<unsigned int>(m >> 32);
+    }
+};
+
+// Affine-scaled uniform range
+//
+// Applies the [low, high] scale of rocrand_generate_uniform_range()
+// while the converted value is still in a register, so a scaled fill
+// costs the same bandwidth as the plain uniform fill instead of a
+// follow-up read-modify-write pass over the buffer. The bounds behave
+// like the plain conversions: \p low is excluded and \p high included.
+
+template<class Output, class Input = unsigned int>
+struct uniform_range_distribution;
+
+template<>
+struct uniform_range_distribution<float, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    uniform_range_distribution(float low, float high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        output[0] = low + rocrand_device::detail::uniform_distribution(input[0]) * range;
+    }
+};
+
+template<>
+struct uniform_range_distribution<double, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double low;
+    const double range;
+
+    __host__ __device__
+    uniform_range_distribution(double low, double high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        output[0] = low
+            + rocrand_device::detail::uniform_distribution_double(input[0], input[1]) * range;
+    }
+};
+
+template<>
+struct uniform_range_distribution<__half, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    uniform_range_distribution(__half low, __half high)
+        : low(__half2float(low)), range(__half2float(high) - __half2float(low)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], __half (&output)[2]) const
+    {
+        // The (0, 1] mapping of uniform_distribution_half, kept in
+        // float so the scale is applied before the precision drops
+        unsigned int v = input[0];
+        output[0] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v & 0xFFFFu) * ROCRAND_2POW16_INV) * range);
+        output[1] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v >> 16) * ROCRAND_2POW16_INV) * range);
+    }
+};
+
+template<>
+struct uniform_range_distribution<float, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    uniform_range_distribution(float low, float high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        output[0] = low + rocrand_device::detail::uniform_distribution(input[0]) * range;
+    }
+};
+
+template<>
+struct uniform_range_distribution<double, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double low;
+    const double range;
+
+    __host__ __device__
+    uniform_range_distribution(double low, double high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        output[0] = low + rocrand_device::detail::uniform_distribution_double(input[0]) * range;
+    }
+};
+
+template<>
+struct uniform_range_distribution<__half, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    uniform_range_distribution(__half low, __half high)
+        : low(__half2float(low)), range(__half2float(high) - __half2float(low)) {}
+
     __host__ __device__ void operator()(const unsigned long long (&input)[1],
                                         __half (&output)[4]) const
     {
         unsigned long long v = input[0];
-        output[0] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v));
-        output[1] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v >> 16));
-        output[2] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v >> 32));
-        output[3] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v >> 48));
+        output[0] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v & 0xFFFFu) * ROCRAND_2POW16_INV) * range);
+        output[1] = __float2half(
+            low + (ROCRAND_2POW16_INV + ((v >> 16) & 0xFFFFu) * ROCRAND_2POW16_INV) * range);
+        output[2] = __float2half(
+            low + (ROCRAND_2POW16_INV + ((v >> 32) & 0xFFFFu) * ROCRAND_2POW16_INV) * range);
+        output[3] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v >> 48) * ROCRAND_2POW16_INV) * range);
+    }
+};
+
+template<class T, typename state_type>
+struct mrg_engine_uniform_range_distribution;
+
+template<typename state_type>
+struct mrg_engine_uniform_range_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    mrg_engine_uniform_range_distribution(float low, float high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        output[0] = low
+            + rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]) * range;
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_range_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double low;
+    const double range;
+
+    __host__ __device__
+    mrg_engine_uniform_range_distribution(double low, double high)
+        : low(low), range(high - low) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        output[0] = low
+            + rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0])
+                  * range;
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_range_distribution<__half, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    const float low;
+    const float range;
+
+    __host__ __device__
+    mrg_engine_uniform_range_distribution(__half low, __half high)
+        : low(__half2float(low)), range(__half2float(high) - __half2float(low)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], __half (&output)[2]) const
+    {
+        unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v & 0xFFFFu) * ROCRAND_2POW16_INV) * range);
+        output[1] = __float2half(
+            low + (ROCRAND_2POW16_INV + (v >> 16) * ROCRAND_2POW16_INV) * range);
+    }
+};
+
+// Low-bit dither
+//
+// Maps each byte or nibble of raw engine output to a signed integer in
+// [start, start + range) with a multiply-shift, so one 32-bit engine
+// word yields four int8 or eight packed int4 dither values and a fill
+// is limited by the stores into the small output buffer. The 8- and
+// 4-bit multiply-shift is biased by at most one part in 256 and 16 per
+// value for ranges that do not divide the input space, which is
+// irrelevant at dither amplitudes. Packed int4 values are stored as
+// two's complement nibbles, low nibble first.
+
+template<class Input = unsigned int>
+struct uniform_int8_range_distribution;
+
+template<>
+struct uniform_int8_range_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_int8_range_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], signed char (&output)[4]) const
+    {
+        const unsigned int v = input[0];
+        output[0] = static_cast<signed char>(start + static_cast<int>(((v & 0xFFu) * range) >> 8));
+        output[1] = static_cast<signed char>(start + static_cast<int>((((v >> 8) & 0xFFu) * range) >> 8));
+        output[2] = static_cast<signed char>(start + static_cast<int>((((v >> 16) & 0xFFu) * range) >> 8));
+        output[3] = static_cast<signed char>(start + static_cast<int>(((v >> 24) * range) >> 8));
+    }
+};
+
+template<>
+struct uniform_int8_range_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 8;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_int8_range_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        signed char (&output)[8]) const
+    {
+        const unsigned long long v = input[0];
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            const unsigned int b = static_cast<unsigned int>(v >> (8 * i)) & 0xFFu;
+            output[i] = static_cast<signed char>(start + static_cast<int>((b * range) >> 8));
+        }
+    }
+};
+
+template<class Input = unsigned int>
+struct uniform_int4_packed_distribution;
+
+template<>
+struct uniform_int4_packed_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_int4_packed_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned char (&output)[4]) const
+    {
+        const unsigned int v = input[0];
+        output[0] = pack(v);
+        output[1] = pack(v >> 8);
+        output[2] = pack(v >> 16);
+        output[3] = pack(v >> 24);
+    }
+
+private:
+    __host__ __device__
+    unsigned char pack(unsigned int two_nibbles) const
+    {
+        const int a = start + static_cast<int>(((two_nibbles & 0xFu) * range) >> 4);
+        const int b = start + static_cast<int>((((two_nibbles >> 4) & 0xFu) * range) >> 4);
+        return static_cast<unsigned char>((a & 0xF) | ((b & 0xF) << 4));
+    }
+};
+
+template<>
+struct uniform_int4_packed_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 8;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_int4_packed_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        unsigned char (&output)[8]) const
+    {
+        const unsigned long long v = input[0];
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            output[i] = pack(static_cast<unsigned int>(v >> (8 * i)));
+        }
+    }
+
+private:
+    __host__ __device__
+    unsigned char pack(unsigned int two_nibbles) const
+    {
+        const int a = start + static_cast<int>(((two_nibbles & 0xFu) * range) >> 4);
+        const int b = start + static_cast<int>((((two_nibbles >> 4) & 0xFu) * range) >> 4);
+        return static_cast<unsigned char>((a & 0xF) | ((b & 0xF) << 4));
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_int8_range_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    mrg_engine_uniform_int8_range_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], signed char (&output)[4]) const
+    {
+        const unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = static_cast<signed char>(start + static_cast<int>(((v & 0xFFu) * range) >> 8));
+        output[1] = static_cast<signed char>(start + static_cast<int>((((v >> 8) & 0xFFu) * range) >> 8));
+        output[2] = static_cast<signed char>(start + static_cast<int>((((v >> 16) & 0xFFu) * range) >> 8));
+        output[3] = static_cast<signed char>(start + static_cast<int>(((v >> 24) * range) >> 8));
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_int4_packed_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const int start;
+    const unsigned int range;
+
+    __host__ __device__
+    mrg_engine_uniform_int4_packed_distribution(int start, unsigned int range)
+        : start(start), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned char (&output)[4]) const
+    {
+        const unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = pack(v);
+        output[1] = pack(v >> 8);
+        output[2] = pack(v >> 16);
+        output[3] = pack(v >> 24);
+    }
+
+private:
+    __host__ __device__
+    unsigned char pack(unsigned int two_nibbles) const
+    {
+        const int a = start + static_cast<int>(((two_nibbles & 0xFu) * range) >> 4);
+        const int b = start + static_cast<int>((((two_nibbles >> 4) & 0xFu) * range) >> 4);
+        return static_cast<unsigned char>((a & 0xF) | ((b & 0xF) << 4));
     }
 };
 
@@ -266,6 +819,23 @@ struct mrg_engine_uniform_distribution<unsigned short, state_type>
     }
 };
 
+template<typename state_type>
+struct mrg_engine_uniform_distribution<unsigned long long, state_type>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], unsigned long long (&output)[1]) const
+    {
+        const unsigned int hi
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        const unsigned int lo
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[1]);
+        output[0] = (static_cast<unsigned long long>(hi) << 32) | lo;
+    }
+};
+
 template<typename state_type>
 struct mrg_engine_uniform_distribution<float, state_type>
 {
@@ -303,8 +873,25 @@ struct mrg_engine_uniform_distribution<__half, state_type>
     {
         unsigned int v
             = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
-        output[0] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v));
-        output[1] = rocrand_device::detail::uniform_distribution_half(static_cast<short>(v >> 16));
+        const __half2 h = rocrand_device::detail::uniform_distribution_half2(v);
+        output[0]       = h.x;
+        output[1]       = h.y;
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_uniform_distribution<hip_bfloat16, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], hip_bfloat16 (&output)[2]) const
+    {
+        unsigned int v
+            = rocrand_device::detail::mrg_uniform_distribution_uint<state_type>(input[0]);
+        output[0] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v));
+        output[1] = rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> 16));
     }
 };
 
@@ -343,6 +930,11 @@ struct mrg_uniform_distribution<__half>
     : mrg_engine_uniform_distribution<__half, rocrand_state_mrg32k3a>
 {};
 
+template<>
+struct mrg_uniform_distribution<hip_bfloat16>
+    : mrg_engine_uniform_distribution<hip_bfloat16, rocrand_state_mrg32k3a>
+{};
+
 // Sobol
 
 template<class T>
@@ -428,4 +1020,16 @@ struct sobol_uniform_distribution<__half>
     }
 };
 
+template<>
+struct sobol_uniform_distribution<hip_bfloat16>
+{
+    template<class DirectionVectorType>
+    __host__ __device__
+    hip_bfloat16 operator()(const DirectionVectorType v) const
+    {
+        constexpr int bit_shift = ((sizeof(DirectionVectorType) - sizeof(unsigned short)) * 8);
+        return rocrand_device::detail::uniform_distribution_bf16(static_cast<unsigned short>(v >> bit_shift));
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_UNIFORM_H_
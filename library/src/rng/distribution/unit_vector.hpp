@@ -0,0 +1,266 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
+#define ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Uniformly distributed unit vectors, written one whole vector per
+// application: 2D directions from a single angle, 3D directions from a
+// uniform z and an angle (the hat-box mapping), 4D directions by
+// normalizing two Box-Muller pairs. The 3D output is padded to four
+// floats (w = 0), so both the 3D and 4D variants store as float4 and
+// the 2D variant as float2.
+
+// Universal
+
+template<unsigned int Dim, class Input = unsigned int>
+struct unit_vector_distribution;
+
+template<>
+struct unit_vector_distribution<2, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[2]) const
+    {
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = cosf(theta);
+        output[1] = sinf(theta);
+    }
+};
+
+template<>
+struct unit_vector_distribution<3, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], float (&output)[4]) const
+    {
+        const float z = 2.0f * rocrand_device::detail::uniform_distribution(input[0]) - 1.0f;
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::uniform_distribution(input[1]);
+        const float r = sqrtf(fmaxf(1.0f - z * z, 0.0f));
+        output[0] = r * cosf(theta);
+        output[1] = r * sinf(theta);
+        output[2] = z;
+        output[3] = 0.0f;
+    }
+};
+
+template<>
+struct unit_vector_distribution<4, unsigned int>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], float (&output)[4]) const
+    {
+        const float2 p = rocrand_device::detail::normal_distribution2(input[0], input[1]);
+        const float2 q = rocrand_device::detail::normal_distribution2(input[2], input[3]);
+        const float n2 = p.x * p.x + p.y * p.y + q.x * q.x + q.y * q.y;
+        if(n2 > 0.0f)
+        {
+            const float inv = 1.0f / sqrtf(n2);
+            output[0] = p.x * inv;
+            output[1] = p.y * inv;
+            output[2] = q.x * inv;
+            output[3] = q.y * inv;
+        }
+        else
+        {
+            // Both pairs land on the origin only when both Box-Muller
+            // radii are exactly zero; any fixed direction is fair there
+            output[0] = 1.0f;
+            output[1] = 0.0f;
+            output[2] = 0.0f;
+            output[3] = 0.0f;
+        }
+    }
+};
+
+// 64 bit Universal
+
+template<>
+struct unit_vector_distribution<2, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[2]) const
+    {
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = cosf(theta);
+        output[1] = sinf(theta);
+    }
+};
+
+template<>
+struct unit_vector_distribution<3, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[4]) const
+    {
+        // The two uniforms come from the two halves of one 64-bit value
+        const float z = 2.0f * rocrand_device::detail::uniform_distribution(
+            static_cast<unsigned int>(input[0] >> 32)) - 1.0f;
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::uniform_distribution(
+                static_cast<unsigned int>(input[0]));
+        const float r = sqrtf(fmaxf(1.0f - z * z, 0.0f));
+        output[0] = r * cosf(theta);
+        output[1] = r * sinf(theta);
+        output[2] = z;
+        output[3] = 0.0f;
+    }
+};
+
+template<>
+struct unit_vector_distribution<4, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[2],
+                                        float (&output)[4]) const
+    {
+        const float2 p = rocrand_device::detail::normal_distribution2(input[0]);
+        const float2 q = rocrand_device::detail::normal_distribution2(input[1]);
+        const float n2 = p.x * p.x + p.y * p.y + q.x * q.x + q.y * q.y;
+        if(n2 > 0.0f)
+        {
+            const float inv = 1.0f / sqrtf(n2);
+            output[0] = p.x * inv;
+            output[1] = p.y * inv;
+            output[2] = q.x * inv;
+            output[3] = q.y * inv;
+        }
+        else
+        {
+            output[0] = 1.0f;
+            output[1] = 0.0f;
+            output[2] = 0.0f;
+            output[3] = 0.0f;
+        }
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<unsigned int Dim, typename state_type>
+struct mrg_engine_unit_vector_distribution;
+
+template<typename state_type>
+struct mrg_engine_unit_vector_distribution<2, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[2]) const
+    {
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]);
+        output[0] = cosf(theta);
+        output[1] = sinf(theta);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_unit_vector_distribution<3, state_type>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], float (&output)[4]) const
+    {
+        const float z = 2.0f
+            * rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]) - 1.0f;
+        const float theta = 2.0f * ROCRAND_PI
+            * rocrand_device::detail::mrg_uniform_distribution<state_type>(input[1]);
+        const float r = sqrtf(fmaxf(1.0f - z * z, 0.0f));
+        output[0] = r * cosf(theta);
+        output[1] = r * sinf(theta);
+        output[2] = z;
+        output[3] = 0.0f;
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_unit_vector_distribution<4, state_type>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 4;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], float (&output)[4]) const
+    {
+        // Two Box-Muller radii and angles from four uniforms; the
+        // normalization folds into the shared radius, so the squared
+        // radii are split instead of four normals being normalized
+        const float u1
+            = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]);
+        const float u2
+            = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[1]);
+        const float u3
+            = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[2]);
+        const float u4
+            = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[3]);
+        const float a = -2.0f * logf(u1);
+        const float b = -2.0f * logf(u3);
+        const float s = a + b;
+        if(s > 0.0f)
+        {
+            const float ra = sqrtf(a / s);
+            const float rb = sqrtf(b / s);
+            const float phi1 = 2.0f * ROCRAND_PI * u2;
+            const float phi2 = 2.0f * ROCRAND_PI * u4;
+            output[0] = ra * cosf(phi1);
+            output[1] = ra * sinf(phi1);
+            output[2] = rb * cosf(phi2);
+            output[3] = rb * sinf(phi2);
+        }
+        else
+        {
+            output[0] = 1.0f;
+            output[1] = 0.0f;
+            output[2] = 0.0f;
+            output[3] = 0.0f;
+        }
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
@@ -0,0 +1,212 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_WEIBULL_H_
+#define ROCRAND_RNG_DISTRIBUTION_WEIBULL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Weibull distribution via inverse CDF: scale * (-log(u))^(1 / shape).
+// The reciprocal of the shape is precomputed on the host.
+
+// Universal
+
+template<class Output, class Input = unsigned int>
+struct weibull_distribution;
+
+template<>
+struct weibull_distribution<float, unsigned int>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float inv_shape;
+    const float scale;
+
+    __host__ __device__
+    weibull_distribution(float shape, float scale)
+        : inv_shape(1.0f / shape), scale(scale) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = scale * powf(-logf(u), inv_shape);
+    }
+};
+
+template<>
+struct weibull_distribution<double, unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double inv_shape;
+    const double scale;
+
+    __host__ __device__
+    weibull_distribution(double shape, double scale)
+        : inv_shape(1.0 / shape), scale(scale) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0], input[1]);
+        output[0] = scale * pow(-log(u), inv_shape);
+    }
+};
+
+// 64 bit Universal
+
+template<>
+struct weibull_distribution<float, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float inv_shape;
+    const float scale;
+
+    __host__ __device__ weibull_distribution(float shape, float scale)
+        : inv_shape(1.0f / shape), scale(scale)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(input[0]);
+        output[0] = scale * powf(-logf(u), inv_shape);
+    }
+};
+
+template<>
+struct weibull_distribution<double, unsigned long long>
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double inv_shape;
+    const double scale;
+
+    __host__ __device__ weibull_distribution(double shape, double scale)
+        : inv_shape(1.0 / shape), scale(scale)
+    {}
+
+    __host__ __device__ void operator()(const unsigned long long (&input)[1],
+                                        double (&output)[1]) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(input[0]);
+        output[0] = scale * pow(-log(u), inv_shape);
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_weibull_distribution;
+
+template<typename state_type>
+struct mrg_engine_weibull_distribution<float, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float inv_shape;
+    const float scale;
+
+    __host__ __device__ mrg_engine_weibull_distribution(float shape, float scale)
+        : inv_shape(1.0f / shape), scale(scale)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        const float u = rocrand_device::detail::mrg_uniform_distribution<state_type>(input[0]);
+        output[0] = scale * powf(-logf(u), inv_shape);
+    }
+};
+
+template<typename state_type>
+struct mrg_engine_weibull_distribution<double, state_type>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double inv_shape;
+    const double scale;
+
+    __host__ __device__ mrg_engine_weibull_distribution(double shape, double scale)
+        : inv_shape(1.0 / shape), scale(scale)
+    {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        const double u
+            = rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0]);
+        output[0] = scale * pow(-log(u), inv_shape);
+    }
+};
+
+// Sobol
+
+template<class T>
+struct sobol_weibull_distribution;
+
+template<>
+struct sobol_weibull_distribution<float>
+{
+    const float inv_shape;
+    const float scale;
+
+    __host__ __device__
+    sobol_weibull_distribution(float shape, float scale)
+        : inv_shape(1.0f / shape), scale(scale) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ float operator()(const DirectionVectorType x) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(x);
+        return scale * powf(-logf(u), inv_shape);
+    }
+};
+
+template<>
+struct sobol_weibull_distribution<double>
+{
+    const double inv_shape;
+    const double scale;
+
+    __host__ __device__
+    sobol_weibull_distribution(double shape, double scale)
+        : inv_shape(1.0 / shape), scale(scale) {}
+
+    template<class DirectionVectorType>
+    __host__ __device__ double operator()(const DirectionVectorType x) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(x);
+        return scale * pow(-log(u), inv_shape);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_WEIBULL_H_
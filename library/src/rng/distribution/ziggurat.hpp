@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_ZIGGURAT_H_
+#define ROCRAND_RNG_DISTRIBUTION_ZIGGURAT_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "../common.hpp"
+#include "device_distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Device-resident tables of the 256-layer normal ziggurat. kn holds the
+// per-layer acceptance thresholds, wn the layer scale factors and fn the
+// density at the layer edges; r is the start of the tail. NULL pointers
+// mean the tables are not available and callers fall back to Box-Muller.
+struct ziggurat_tables
+{
+    const unsigned int * kn = NULL;
+    const float *        wn = NULL;
+    const float *        fn = NULL;
+    float                r  = 0.0f;
+};
+
+// Refreshes a rejected candidate in-register so that the rejection paths
+// below consume a fixed number of engine outputs per generated value
+// (required by the fixed input_width of the generate kernels).
+__forceinline__ __host__ __device__
+unsigned int ziggurat_refresh(unsigned int& w)
+{
+    w = w * 1664525u + 1013904223u;
+    return w;
+}
+
+// One draw of the Marsaglia-Tsang ziggurat: the common case costs a
+// table lookup, one compare and one multiply; the layer edges and the
+// tail fall through to the rejection paths
+__forceinline__ __host__ __device__
+float ziggurat_normal(const unsigned int u, const ziggurat_tables& t)
+{
+    int          hz = static_cast<int>(u);
+    unsigned int iz = static_cast<unsigned int>(hz) & 255u;
+    unsigned int az = hz < 0 ? 0u - static_cast<unsigned int>(hz)
+                             : static_cast<unsigned int>(hz);
+    if(az < t.kn[iz])
+    {
+        return hz * t.wn[iz];
+    }
+
+    unsigned int w = u;
+    while(true)
+    {
+        const float x = hz * t.wn[iz];
+        if(iz == 0)
+        {
+            // Tail: Marsaglia's exponential wedge beyond r
+            float xx, yy;
+            do
+            {
+                xx = -logf(rocrand_device::detail::uniform_distribution(
+                         ziggurat_refresh(w)))
+                     * (1.0f / t.r);
+                yy = -logf(rocrand_device::detail::uniform_distribution(
+                    ziggurat_refresh(w)));
+            }
+            while(yy + yy < xx * xx);
+            return hz > 0 ? t.r + xx : -(t.r + xx);
+        }
+        if(t.fn[iz]
+               + rocrand_device::detail::uniform_distribution(ziggurat_refresh(w))
+                     * (t.fn[iz - 1] - t.fn[iz])
+           < expf(-0.5f * x * x))
+        {
+            return x;
+        }
+        hz = static_cast<int>(ziggurat_refresh(w));
+        iz = static_cast<unsigned int>(hz) & 255u;
+        az = hz < 0 ? 0u - static_cast<unsigned int>(hz)
+                    : static_cast<unsigned int>(hz);
+        if(az < t.kn[iz])
+        {
+            return hz * t.wn[iz];
+        }
+    }
+}
+
+// Process-wide cache of the uploaded ziggurat tables. The tables are
+// parameter-free, so they are built in double precision and uploaded
+// exactly once per process on first use and shared by all generators;
+// like the poisson tables they are never freed.
+class ziggurat_table_registry
+{
+public:
+    static ziggurat_tables get()
+    {
+        static const ziggurat_tables tables = build_and_upload();
+        return tables;
+    }
+
+private:
+    // Area of the implied bottom layer minus the layer area, as a
+    // function of the tail start; the correct r closes the ziggurat
+    // exactly at the density peak. Returns -1 when r is too small for
+    // the layers to fit at all.
+    static double layers_residual(double r, double (&x)[256])
+    {
+        const double v
+            = r * exp(-0.5 * r * r) + sqrt(M_PI / 2.0) * erfc(r / sqrt(2.0));
+        x[255] = r;
+        for(int i = 254; i >= 1; i--)
+        {
+            const double f = exp(-0.5 * x[i + 1] * x[i + 1]) + v / x[i + 1];
+            if(f >= 1.0)
+            {
+                return -1.0;
+            }
+            x[i] = sqrt(-2.0 * log(f));
+        }
+        return (exp(-0.5 * x[1] * x[1]) + v / x[1]) - 1.0;
+    }
+
+    static ziggurat_tables build_and_upload()
+    {
+        double x[256];
+        double lo = 3.0;
+        double hi = 4.5;
+        for(int it = 0; it < 200; it++)
+        {
+            const double mid = 0.5 * (lo + hi);
+            const double res = layers_residual(mid, x);
+            if(res < 0.0 && res != -1.0)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid;
+            }
+        }
+        const double r = hi;
+        layers_residual(r, x);
+        const double v
+            = r * exp(-0.5 * r * r) + sqrt(M_PI / 2.0) * erfc(r / sqrt(2.0));
+        const double m1 = 2147483648.0;
+        // The base layer is a rectangle of the same area reaching past r
+        const double q = v / exp(-0.5 * r * r);
+
+        unsigned int kn[256];
+        float        wn[256];
+        float        fn[256];
+        kn[0]   = static_cast<unsigned int>((r / q) * m1);
+        kn[1]   = 0;
+        wn[0]   = static_cast<float>(q / m1);
+        wn[255] = static_cast<float>(r / m1);
+        fn[0]   = 1.0f;
+        fn[255] = static_cast<float>(exp(-0.5 * r * r));
+        for(int i = 254; i >= 1; i--)
+        {
+            kn[i + 1] = static_cast<unsigned int>((x[i] / x[i + 1]) * m1);
+            fn[i]     = static_cast<float>(exp(-0.5 * x[i] * x[i]));
+            wn[i]     = static_cast<float>(x[i] / m1);
+        }
+
+        ziggurat_tables tables;
+        unsigned char * ptr;
+        const size_t kn_bytes = sizeof(kn);
+        const size_t wn_bytes = sizeof(wn);
+        const size_t fn_bytes = sizeof(fn);
+        if(device_malloc(reinterpret_cast<void**>(&ptr),
+                         kn_bytes + wn_bytes + fn_bytes)
+           != hipSuccess)
+        {
+            return tables;
+        }
+        if(hipMemcpy(ptr, kn, kn_bytes, hipMemcpyHostToDevice) != hipSuccess
+           || hipMemcpy(ptr + kn_bytes, wn, wn_bytes, hipMemcpyHostToDevice)
+                  != hipSuccess
+           || hipMemcpy(ptr + kn_bytes + wn_bytes, fn, fn_bytes,
+                        hipMemcpyHostToDevice)
+                  != hipSuccess)
+        {
+            device_free(ptr);
+            return tables;
+        }
+
+        tables.kn = reinterpret_cast<const unsigned int *>(ptr);
+        tables.wn = reinterpret_cast<const float *>(ptr + kn_bytes);
+        tables.fn = reinterpret_cast<const float *>(ptr + kn_bytes + wn_bytes);
+        tables.r  = static_cast<float>(r);
+        return tables;
+    }
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_ZIGGURAT_H_
@@ -21,10 +21,17 @@
 #ifndef ROCRAND_RNG_DISTRIBUTIONS_H_
 #define ROCRAND_RNG_DISTRIBUTIONS_H_
 
+#include "distribution/antithetic.hpp"
 #include "distribution/uniform.hpp"
 #include "distribution/normal.hpp"
+#include "distribution/gamma.hpp"
 #include "distribution/log_normal.hpp"
+#include "distribution/exponential.hpp"
+#include "distribution/cauchy.hpp"
+#include "distribution/unit_vector.hpp"
+#include "distribution/weibull.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/binomial.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
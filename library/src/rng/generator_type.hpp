@@ -21,16 +21,319 @@
 #ifndef ROCRAND_RNG_GENERATOR_TYPE_H_
 #define ROCRAND_RNG_GENERATOR_TYPE_H_
 
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <hip/hip_vector_types.h>
 #include <rocrand/rocrand.h>
 
+#include "tuning.hpp"
+
+// Opt-in instrumentation behind rocrand_get_statistics(). Launch and
+// byte counters are plain increments; kernel times are measured with a
+// recycled pool of hipEvent pairs that are harvested with hipEventQuery
+// only, so neither generation nor readout ever synchronizes.
+class rocrand_generator_statistics
+{
+public:
+    rocrand_generator_statistics() {}
+
+    rocrand_generator_statistics(const rocrand_generator_statistics&) = delete;
+    rocrand_generator_statistics& operator=(const rocrand_generator_statistics&) = delete;
+
+    ~rocrand_generator_statistics()
+    {
+        for (const event_pair& pair : m_pending)
+        {
+            hipEventDestroy(pair.start);
+            hipEventDestroy(pair.stop);
+        }
+        for (const event_pair& pair : m_free)
+        {
+            hipEventDestroy(pair.start);
+            hipEventDestroy(pair.stop);
+        }
+    }
+
+    void set_enabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    void begin_launch(hipStream_t stream)
+    {
+        if (!m_enabled)
+            return;
+
+        event_pair pair;
+        if (!m_free.empty())
+        {
+            pair = m_free.back();
+            m_free.pop_back();
+        }
+        else if (m_pending.size() >= s_max_pending)
+        {
+            harvest();
+            if (m_free.empty())
+            {
+                // Timing is best-effort; skipping it keeps the counters
+                // exact without waiting for the device
+                return;
+            }
+            pair = m_free.back();
+            m_free.pop_back();
+        }
+        else if (hipEventCreate(&pair.start) != hipSuccess)
+        {
+            return;
+        }
+        else if (hipEventCreate(&pair.stop) != hipSuccess)
+        {
+            hipEventDestroy(pair.start);
+            return;
+        }
+
+        if (hipEventRecord(pair.start, stream) != hipSuccess)
+        {
+            m_free.push_back(pair);
+            return;
+        }
+        m_current = pair;
+        m_current_recorded = true;
+    }
+
+    void end_launch(size_t bytes, hipStream_t stream)
+    {
+        if (!m_enabled)
+            return;
+
+        m_kernel_launches++;
+        m_bytes_generated += bytes;
+
+        if (m_current_recorded)
+        {
+            if (hipEventRecord(m_current.stop, stream) == hipSuccess)
+            {
+                m_pending.push_back(m_current);
+            }
+            else
+            {
+                m_free.push_back(m_current);
+            }
+            m_current_recorded = false;
+        }
+    }
+
+    void count_reallocation()
+    {
+        if (m_enabled)
+        {
+            m_reallocations++;
+        }
+    }
+
+    void get(rocrand_stats * stats)
+    {
+        harvest();
+        stats->kernel_launches = m_kernel_launches;
+        stats->bytes_generated = m_bytes_generated;
+        stats->reallocations = m_reallocations;
+        stats->kernel_time_ms = m_kernel_time_ms;
+    }
+
+    // Writes the per-launch latency histogram accumulated while
+    // collection was enabled. The buckets double in width, so the tail
+    // stays visible next to the common case without thousands of bins
+    void dump_latency_histogram(std::FILE * out)
+    {
+        harvest();
+        std::fprintf(out,
+                     "rocrand latency histogram: %llu timed launches"
+                     ", %zu still in flight\n",
+                     m_launches_timed,
+                     m_pending.size());
+        for (size_t i = 0; i < s_latency_buckets; i++)
+        {
+            if (m_latency_histogram[i] == 0)
+            {
+                continue;
+            }
+            const unsigned long long lower = i == 0 ? 0 : 1ULL << (i - 1);
+            if (i < s_latency_buckets - 1)
+            {
+                std::fprintf(out,
+                             "[%10llu us, %10llu us) %llu\n",
+                             lower,
+                             1ULL << i,
+                             m_latency_histogram[i]);
+            }
+            else
+            {
+                // The last bucket is open-ended
+                std::fprintf(out, "[%10llu us,        inf) %llu\n",
+                             lower,
+                             m_latency_histogram[i]);
+            }
+        }
+    }
+
+private:
+    struct event_pair
+    {
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    // Accumulates the times of completed launches and recycles their
+    // events; launches still in flight stay pending
+    void harvest()
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_pending.size(); i++)
+        {
+            const event_pair pair = m_pending[i];
+            if (hipEventQuery(pair.stop) == hipSuccess)
+            {
+                float ms;
+                if (hipEventElapsedTime(&ms, pair.start, pair.stop) == hipSuccess)
+                {
+                    m_kernel_time_ms += ms;
+                    m_latency_histogram[latency_bucket(ms)]++;
+                    m_launches_timed++;
+                }
+                m_free.push_back(pair);
+            }
+            else
+            {
+                m_pending[kept++] = pair;
+            }
+        }
+        m_pending.resize(kept);
+    }
+
+    // Bucket i of the histogram covers [2^(i-1), 2^i) microseconds;
+    // bucket 0 collects everything below a microsecond and the last
+    // bucket everything from ~17 seconds up
+    static size_t latency_bucket(float ms)
+    {
+        const double us = static_cast<double>(ms) * 1000.0;
+        size_t bucket = 0;
+        while (bucket < s_latency_buckets - 1 && us >= static_cast<double>(1ULL << bucket))
+        {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    static const size_t s_max_pending = 128;
+    static const size_t s_latency_buckets = 26;
+
+    bool m_enabled = false;
+    bool m_current_recorded = false;
+    event_pair m_current = {};
+    std::vector<event_pair> m_pending;
+    std::vector<event_pair> m_free;
+
+    unsigned long long m_kernel_launches = 0;
+    unsigned long long m_bytes_generated = 0;
+    unsigned long long m_reallocations = 0;
+    double m_kernel_time_ms = 0.0;
+
+    unsigned long long m_launches_timed = 0;
+    unsigned long long m_latency_histogram[s_latency_buckets] = {};
+};
+
 struct rocrand_generator_base_type
 {
-    rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
+    rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type)
+    {
+        // The tuning table may name a per-architecture default method
+        // for normal generation (FP64-weak parts prefer the polar
+        // method); an explicit rocrand_set_normal_method call overrides
+        // it
+        std::string method;
+        if (rocrand_host::detail::tuning_table::instance().lookup_option("normal_method", &method))
+        {
+            if (method == "box_muller")
+            {
+                normal_method = ROCRAND_NORMAL_METHOD_BOX_MULLER;
+            }
+            else if (method == "ziggurat")
+            {
+                normal_method = ROCRAND_NORMAL_METHOD_ZIGGURAT;
+            }
+            else if (method == "marsaglia_polar")
+            {
+                normal_method = ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR;
+            }
+            else if (method == "double_via_float")
+            {
+                normal_method = ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT;
+            }
+        }
+    }
     const rocrand_rng_type rng_type;
 
-    virtual ~rocrand_generator_base_type() {}
+    virtual ~rocrand_generator_base_type()
+    {
+        if (log != NULL)
+        {
+            std::fclose(log);
+        }
+    }
+
+    // Opt-in per-generator statistics (see rocrand_get_statistics)
+    rocrand_generator_statistics statistics;
+
+    // Accuracy/performance trade-off for single-precision normal and
+    // log-normal generation (see rocrand_set_math_mode); generators pass
+    // it to the distributions they construct
+    rocrand_math_mode math_mode = ROCRAND_MATH_PRECISE;
+
+    // Method for normal generation (see rocrand_set_normal_method);
+    // the ziggurat method affects single and the polar/via-float
+    // methods double precision. Passed to the normal distributions
+    // like math_mode
+    rocrand_normal_method normal_method = ROCRAND_NORMAL_METHOD_BOX_MULLER;
+
+    // Pairs every generated value with its antithetic mate (see
+    // rocrand_set_antithetic); generators supporting the mode wrap the
+    // distributions they construct
+    bool antithetic = false;
+
+    // How kernel launch errors surface (see rocrand_set_error_mode):
+    // polled per generation call by default, or deferred to
+    // rocrand_query_status()
+    rocrand_error_mode error_mode = ROCRAND_ERRORS_IMMEDIATE;
+
+    // Post-launch poll used by the generation paths. In deferred mode
+    // the runtime is not queried; the error stays recorded in the
+    // runtime until the next rocrand_query_status()
+    bool launch_failed() const
+    {
+        if (error_mode == ROCRAND_ERRORS_DEFERRED)
+        {
+            return false;
+        }
+        return hipGetLastError() != hipSuccess;
+    }
+
+    // Emits roctx profiler ranges around the API calls made on this
+    // generator (see rocrand_set_profiling); off by default
+    bool profiling = false;
+
+    // Open call log in the replay trace format (see rocrand_set_log);
+    // owned by the generator and closed with it
+    std::FILE * log = NULL;
+
+    // Throughput model fitted lazily by the first
+    // rocrand_get_expected_throughput() call: a fixed per-call overhead
+    // plus a bandwidth roofline
+    bool   throughput_calibrated    = false;
+    double throughput_overhead_s    = 0.0;
+    double throughput_bandwidth_bps = 0.0;
 };
 
 // rocRAND random number generator base class
@@ -21,20 +21,33 @@
 #ifndef ROCRAND_RNG_GENERATORS_H_
 #define ROCRAND_RNG_GENERATORS_H_
 
+#include "adaptive.hpp"
+#include "chacha20.hpp"
+#include "halton.hpp"
+#include "lattice.hpp"
 #include "lfsr113.hpp"
 #include "mrg31k3p.hpp"
 #include "mrg32k3a.hpp"
 #include "mt19937.hpp"
 #include "mtgp32.hpp"
+#include "pcg64.hpp"
 #include "philox4x32_10.hpp"
+#include "philox4x32_7.hpp"
+#include "philox4x64_10.hpp"
 #include "scrambled_sobol32.hpp"
 #include "scrambled_sobol64.hpp"
 #include "sobol32.hpp"
+#include "sobol32_owen.hpp"
 #include "sobol64.hpp"
+#include "squares32.hpp"
+#include "tape.hpp"
 #include "threefry2x32_20.hpp"
 #include "threefry2x64_20.hpp"
 #include "threefry4x32_20.hpp"
+#include "threefry4x64_13.hpp"
 #include "threefry4x64_20.hpp"
+#include "well19937.hpp"
 #include "xorwow.hpp"
+#include "xoshiro256pp.hpp"
 
 #endif // ROCRAND_RNG_GENERATORS_H_
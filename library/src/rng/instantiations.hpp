@@ -0,0 +1,704 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_INSTANTIATIONS_H_
+#define ROCRAND_RNG_INSTANTIATIONS_H_
+
+#include "generators.hpp"
+
+// The generation methods dispatched from the C API are explicitly
+// instantiated in one translation unit per generator (rocrand_<name>.cpp)
+// so that each generator's kernels end up in their own code object and
+// only the device code of the generators a process uses is ever loaded.
+// The declarations below keep rocrand.cpp from instantiating them again.
+
+extern template rocrand_status rocrand_philox4x32_10::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_philox4x32_10::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_philox4x32_10::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_philox4x32_10::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_philox4x32_10::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_philox4x32_10::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_philox4x32_10::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_philox4x32_10::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_philox4x32_10::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x32_10::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_philox4x32_10::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x32_10::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_10::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_10::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_philox4x32_7::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_philox4x32_7::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_philox4x32_7::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_philox4x32_7::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_philox4x32_7::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_philox4x32_7::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_philox4x32_7::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_philox4x32_7::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_philox4x32_7::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x32_7::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_philox4x32_7::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x32_7::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x32_7::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x32_7::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_mrg31k3p::generate<unsigned char, mrg_engine_uniform_distribution<unsigned char, rocrand_device::mrg31k3p_engine>>(unsigned char*, size_t, mrg_engine_uniform_distribution<unsigned char, rocrand_device::mrg31k3p_engine>);
+extern template rocrand_status rocrand_mrg31k3p::generate<unsigned short, mrg_engine_uniform_distribution<unsigned short, rocrand_device::mrg31k3p_engine>>(unsigned short*, size_t, mrg_engine_uniform_distribution<unsigned short, rocrand_device::mrg31k3p_engine>);
+extern template rocrand_status rocrand_mrg31k3p::generate<unsigned int, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg31k3p_engine>>(unsigned int*, size_t, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg31k3p_engine>);
+extern template rocrand_status rocrand_mrg31k3p::generate<unsigned long long, mrg_engine_uniform_distribution<unsigned long long, rocrand_device::mrg31k3p_engine>>(unsigned long long*, size_t, mrg_engine_uniform_distribution<unsigned long long, rocrand_device::mrg31k3p_engine>);
+extern template rocrand_status rocrand_mrg31k3p::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_mrg31k3p::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_mrg31k3p::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_mrg31k3p::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_mrg31k3p::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mrg31k3p::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_mrg31k3p::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mrg31k3p::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg31k3p::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg31k3p::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_mrg32k3a::generate<unsigned char, mrg_engine_uniform_distribution<unsigned char, rocrand_device::mrg32k3a_engine>>(unsigned char*, size_t, mrg_engine_uniform_distribution<unsigned char, rocrand_device::mrg32k3a_engine>);
+extern template rocrand_status rocrand_mrg32k3a::generate<unsigned short, mrg_engine_uniform_distribution<unsigned short, rocrand_device::mrg32k3a_engine>>(unsigned short*, size_t, mrg_engine_uniform_distribution<unsigned short, rocrand_device::mrg32k3a_engine>);
+extern template rocrand_status rocrand_mrg32k3a::generate<unsigned int, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg32k3a_engine>>(unsigned int*, size_t, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg32k3a_engine>);
+extern template rocrand_status rocrand_mrg32k3a::generate<unsigned long long, mrg_engine_uniform_distribution<unsigned long long, rocrand_device::mrg32k3a_engine>>(unsigned long long*, size_t, mrg_engine_uniform_distribution<unsigned long long, rocrand_device::mrg32k3a_engine>);
+extern template rocrand_status rocrand_mrg32k3a::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_mrg32k3a::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_mrg32k3a::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_mrg32k3a::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_mrg32k3a::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mrg32k3a::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_mrg32k3a::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mrg32k3a::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mrg32k3a::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mrg32k3a::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_xorwow::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_xorwow::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_xorwow::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_xorwow::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_xorwow::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_xorwow::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_xorwow::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_xorwow::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_xorwow::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_xorwow::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_xorwow::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xorwow::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xorwow::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_xorwow::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xorwow::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xorwow::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_xorwow::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_xorwow::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xorwow::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xorwow::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_xorwow::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_xorwow::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xorwow::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xorwow::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xorwow::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_xoshiro256pp::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_xoshiro256pp::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_xoshiro256pp::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_xoshiro256pp::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_xoshiro256pp::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_xoshiro256pp::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_xoshiro256pp::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_xoshiro256pp::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_xoshiro256pp::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_xoshiro256pp::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_xoshiro256pp::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_xoshiro256pp::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_xoshiro256pp::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_xoshiro256pp::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_chacha20::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_chacha20::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_chacha20::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_chacha20::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_chacha20::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_chacha20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_chacha20::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_chacha20::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_chacha20::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_chacha20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_chacha20::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_chacha20::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_chacha20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_chacha20::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_chacha20::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_chacha20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_chacha20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_chacha20::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_chacha20::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_chacha20::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_chacha20::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_chacha20::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_chacha20::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_chacha20::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_chacha20::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_mtgp32::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_mtgp32::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_mtgp32::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_mtgp32::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_mtgp32::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_mtgp32::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_mtgp32::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_mtgp32::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_mtgp32::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mtgp32::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_mtgp32::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mtgp32::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mtgp32::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mtgp32::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_mtgp32::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mtgp32::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_mtgp32::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_mtgp32::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mtgp32::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mtgp32::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_lfsr113::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_lfsr113::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_lfsr113::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_lfsr113::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_lfsr113::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_lfsr113::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_lfsr113::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_lfsr113::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_lfsr113::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_lfsr113::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_lfsr113::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lfsr113::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_lfsr113::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lfsr113::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_lfsr113::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lfsr113::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_lfsr113::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_lfsr113::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lfsr113::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lfsr113::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_mt19937::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_mt19937::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_mt19937::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_mt19937::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_mt19937::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_mt19937::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_mt19937::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_mt19937::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_mt19937::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mt19937::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_mt19937::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mt19937::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mt19937::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_mt19937::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mt19937::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mt19937::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_mt19937::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_mt19937::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mt19937::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mt19937::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_mt19937::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_mt19937::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mt19937::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_mt19937::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_mt19937::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_threefry2x32_20::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_threefry2x32_20::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_threefry2x32_20::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_threefry2x32_20::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_threefry2x32_20::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_threefry2x32_20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_threefry2x32_20::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_threefry2x32_20::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_threefry2x32_20::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry2x32_20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_threefry2x32_20::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry2x32_20::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x32_20::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x32_20::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_threefry2x64_20::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_threefry2x64_20::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_threefry2x64_20::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_threefry2x64_20::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_threefry2x64_20::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_threefry2x64_20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_threefry2x64_20::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_threefry2x64_20::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_threefry2x64_20::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry2x64_20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_threefry2x64_20::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry2x64_20::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry2x64_20::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry2x64_20::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_pcg64::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_pcg64::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_pcg64::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_pcg64::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_pcg64::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_pcg64::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_pcg64::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_pcg64::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_pcg64::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_pcg64::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_pcg64::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_pcg64::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_pcg64::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_pcg64::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_pcg64::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_pcg64::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_pcg64::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_pcg64::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_pcg64::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_pcg64::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_pcg64::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_pcg64::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_pcg64::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_pcg64::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_pcg64::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_threefry4x32_20::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_threefry4x32_20::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_threefry4x32_20::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_threefry4x32_20::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_threefry4x32_20::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_threefry4x32_20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_threefry4x32_20::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_threefry4x32_20::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_threefry4x32_20::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x32_20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_threefry4x32_20::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x32_20::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x32_20::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x32_20::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_threefry4x64_20::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_20::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_20::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_20::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_20::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_threefry4x64_20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_threefry4x64_20::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_threefry4x64_20::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_threefry4x64_20::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x64_20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_threefry4x64_20::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x64_20::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_20::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_20::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_threefry4x64_13::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_13::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_13::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_13::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_threefry4x64_13::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_threefry4x64_13::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_threefry4x64_13::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_threefry4x64_13::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_threefry4x64_13::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x64_13::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_threefry4x64_13::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_threefry4x64_13::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_threefry4x64_13::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_threefry4x64_13::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_squares32::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_squares32::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_squares32::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_squares32::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_squares32::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_squares32::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_squares32::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_squares32::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_squares32::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_squares32::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_squares32::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_squares32::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_squares32::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_squares32::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_squares32::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_squares32::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_squares32::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_squares32::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_squares32::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_squares32::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_squares32::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_squares32::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_squares32::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_squares32::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_squares32::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_philox4x64_10::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+extern template rocrand_status rocrand_philox4x64_10::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+extern template rocrand_status rocrand_philox4x64_10::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+extern template rocrand_status rocrand_philox4x64_10::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+extern template rocrand_status rocrand_philox4x64_10::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_philox4x64_10::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_philox4x64_10::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_philox4x64_10::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_philox4x64_10::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x64_10::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_philox4x64_10::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_philox4x64_10::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_philox4x64_10::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_philox4x64_10::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_well19937::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_well19937::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_well19937::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_well19937::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_well19937::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_well19937::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_well19937::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_well19937::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_well19937::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_well19937::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_well19937::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_well19937::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_well19937::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_well19937::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_well19937::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_well19937::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_well19937::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_well19937::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_well19937::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_well19937::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_well19937::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_well19937::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_well19937::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_well19937::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_well19937::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_adaptive::generate<unsigned char, uniform_distribution<unsigned char>>(unsigned char*, size_t, uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_adaptive::generate<unsigned short, uniform_distribution<unsigned short>>(unsigned short*, size_t, uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_adaptive::generate<unsigned int, uniform_distribution<unsigned int>>(unsigned int*, size_t, uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_adaptive::generate<unsigned long long, uniform_distribution<unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_adaptive::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_adaptive::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_adaptive::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_adaptive::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_adaptive::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_adaptive::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_adaptive::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_adaptive::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_adaptive::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_adaptive::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_adaptive::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_adaptive::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+extern template rocrand_status rocrand_adaptive::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+extern template rocrand_status rocrand_adaptive::generate_gamma<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_adaptive::generate_gamma<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_adaptive::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_adaptive::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_adaptive::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_adaptive::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_adaptive::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_adaptive::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_sobol32::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_sobol32::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_sobol32::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_sobol32::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_sobol32::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_sobol32::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_sobol32::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_sobol32::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol32::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_sobol32::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol32::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_sobol32::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_sobol32::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32::generate_weibull<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32::generate_uniform_dual<sobol_uniform_distribution<float>, sobol_uniform_distribution<double>>(float*, double*, size_t, sobol_uniform_distribution<float>, sobol_uniform_distribution<double>);
+
+extern template rocrand_status rocrand_scrambled_sobol32::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_scrambled_sobol32::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_scrambled_sobol32::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol32::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_sobol32_owen::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_sobol32_owen::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_sobol32_owen::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_sobol32_owen::generate_replicates<float, sobol_uniform_distribution<float>>(float*, size_t, unsigned int, const unsigned long long*, sobol_uniform_distribution<float>);
+extern template rocrand_status rocrand_sobol32_owen::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_sobol32_owen::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_sobol32_owen::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_sobol32_owen::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_sobol32_owen::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol32_owen::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_sobol32_owen::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32_owen::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32_owen::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol32_owen::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32_owen::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32_owen::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_sobol32_owen::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_sobol32_owen::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32_owen::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol32_owen::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol32_owen::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_sobol64::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_sobol64::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_sobol64::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_sobol64::generate<unsigned long long, sobol_uniform_distribution<unsigned long long>>(unsigned long long*, size_t, sobol_uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_sobol64::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_sobol64::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_sobol64::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_sobol64::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_sobol64::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol64::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_sobol64::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol64::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol64::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_sobol64::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol64::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol64::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_sobol64::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_sobol64::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol64::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_sobol64::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_sobol64::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_scrambled_sobol64::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_scrambled_sobol64::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_scrambled_sobol64::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_scrambled_sobol64::generate<unsigned long long, sobol_uniform_distribution<unsigned long long>>(unsigned long long*, size_t, sobol_uniform_distribution<unsigned long long>);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_scrambled_sobol64::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_halton::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_halton::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_halton::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_halton::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_halton::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_halton::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_halton::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_halton::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_halton::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_halton::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_halton::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_halton::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_halton::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_halton::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_halton::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_halton::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_halton::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_halton::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_halton::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_halton::generate_weibull<double>(double*, size_t, double, double);
+
+extern template rocrand_status rocrand_lattice::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+extern template rocrand_status rocrand_lattice::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+extern template rocrand_status rocrand_lattice::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+extern template rocrand_status rocrand_lattice::generate_uniform<__half>(__half*, size_t);
+extern template rocrand_status rocrand_lattice::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+extern template rocrand_status rocrand_lattice::generate_uniform<float>(float*, size_t);
+extern template rocrand_status rocrand_lattice::generate_uniform<double>(double*, size_t);
+extern template rocrand_status rocrand_lattice::generate_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_lattice::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+extern template rocrand_status rocrand_lattice::generate_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lattice::generate_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lattice::generate_log_normal<__half>(__half*, size_t, __half, __half);
+extern template rocrand_status rocrand_lattice::generate_log_normal<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lattice::generate_log_normal<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lattice::generate_exponential<float>(float*, size_t, float);
+extern template rocrand_status rocrand_lattice::generate_exponential<double>(double*, size_t, double);
+extern template rocrand_status rocrand_lattice::generate_cauchy<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lattice::generate_cauchy<double>(double*, size_t, double, double);
+extern template rocrand_status rocrand_lattice::generate_weibull<float>(float*, size_t, float, float);
+extern template rocrand_status rocrand_lattice::generate_weibull<double>(double*, size_t, double, double);
+
+#endif // ROCRAND_RNG_INSTANTIATIONS_H_
@@ -0,0 +1,329 @@
+// Copyright (c) 2017-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LATTICE_H_
+#define ROCRAND_RNG_LATTICE_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+#include <vector>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Point \p index of an extensible rank-1 lattice sequence in the
+    // dimension with generating value \p z, as a 32-bit fixed point
+    // fraction. The base-2 radical inverse of the index is a bit
+    // reversal, and the multiplication wraps modulo 2^32, which is
+    // exactly frac() in fixed point, so every value is two instructions
+    __forceinline__ __device__
+    unsigned int lattice_value(const unsigned int index, const unsigned int z)
+    {
+        return __brev(index) * z;
+    }
+
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_lattice_kernel(T * data, const size_t n,
+                                 const unsigned int * generating_vector,
+                                 const unsigned int offset,
+                                 Distribution distribution)
+    {
+        const unsigned int dimension = blockIdx.y;
+        const unsigned int z         = generating_vector[dimension];
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        data += dimension * n;
+
+        for(size_t index = engine_id; index < n; index += stride)
+        {
+            data[index] = distribution(
+                lattice_value(offset + static_cast<unsigned int>(index), z));
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_lattice : public rocrand_generator_type<ROCRAND_RNG_QUASI_LATTICE>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_QUASI_LATTICE>;
+
+    rocrand_lattice(unsigned long long offset = 0,
+                    rocrand_ordering   order  = ROCRAND_ORDERING_QUASI_DEFAULT,
+                    hipStream_t        stream = 0)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_loaded_dimensions(0), m_generating_vector(NULL)
+    {
+        // The generating vector is derived on the host and uploaded
+        // lazily by init(), sized to the dimensions in use
+    }
+
+    ~rocrand_lattice()
+    {
+        rocrand_host::detail::device_free(m_generating_vector);
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    // Advances the sequence by \p n points per dimension from the
+    // current position. Values are computed directly from their index,
+    // so the cost does not scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order       = order;
+        m_initialized = false;
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions)
+    {
+        if(dimensions < 1)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_dimensions = dimensions;
+        m_initialized = false;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_generating_vector();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
+        m_current_offset = static_cast<unsigned int>(m_offset);
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks_x = std::max(
+            1u,
+            std::min(
+                max_blocks,
+                static_cast<uint32_t>((size + threads - 1) / threads)
+            )
+        );
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_lattice_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const unsigned int*>(m_generating_vector), m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        sobol_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Generating value for \p dimension: the output of a 64-bit mix of
+    // the dimension index, forced odd so the multiplication modulo 2^32
+    // is a bijection. A component-by-component search would fix the
+    // point count in advance, which does not fit the open-ended
+    // generate() API, so the vector is derived instead of searched
+    static unsigned int generating_value(const unsigned int dimension)
+    {
+        unsigned long long s = 0x9e3779b97f4a7c15ULL * (dimension + 1);
+        s = (s ^ (s >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        s = (s ^ (s >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<unsigned int>(s >> 32) | 1U;
+    }
+
+    rocrand_status load_generating_vector()
+    {
+        std::vector<unsigned int> host_vector;
+        try
+        {
+            host_vector.reserve(m_dimensions);
+            for(unsigned int dimension = 0; dimension < m_dimensions; dimension++)
+            {
+                host_vector.push_back(generating_value(dimension));
+            }
+        }
+        catch(std::bad_alloc&)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        unsigned int * generating_vector;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&generating_vector),
+                          sizeof(unsigned int) * m_dimensions);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMemcpy(generating_vector,
+                          host_vector.data(),
+                          sizeof(unsigned int) * m_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(generating_vector);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free(m_generating_vector);
+        m_generating_vector = generating_vector;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    bool m_initialized;
+    unsigned int m_dimensions;
+    unsigned int m_current_offset;
+    // Dimensions whose generating values are held on the device
+    unsigned int m_loaded_dimensions;
+    unsigned int * m_generating_vector;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_LATTICE_H_
@@ -58,14 +58,28 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
 
     using vec_type = aligned_vec_type<T, output_width>;
 
-    const unsigned int id     = blockIdx.x * blockDim.x + threadIdx.x;
-    const unsigned int stride = gridDim.x * blockDim.x;
-
-    const unsigned int    engine_id = (id + start_engine_id) & (stride - 1);
-    lfsr113_device_engine engine    = engines[engine_id];
-
-    unsigned int input[input_width];
-    T            output[output_width];
+    // Each thread owns two engines and interleaves their draws: one
+    // LFSR113 draw is a chain of dependent shifts and XORs with no
+    // instruction-level parallelism of its own, so alternating two
+    // independent states hides the latency of each chain behind the
+    // other. The kernel is launched with half as many threads as there
+    // are engines; each thread writes exactly the positions two threads
+    // of a full-size grid would write, so the generated sequence is
+    // unchanged.
+    const unsigned int id      = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int threads = gridDim.x * blockDim.x;
+    // Stride (the engine count) MUST be a power of two
+    const unsigned int stride = threads * 2;
+
+    const unsigned int    engine_id0 = (id + start_engine_id) & (stride - 1);
+    const unsigned int    engine_id1 = (id + threads + start_engine_id) & (stride - 1);
+    lfsr113_device_engine engine0    = engines[engine_id0];
+    lfsr113_device_engine engine1    = engines[engine_id1];
+
+    unsigned int input0[input_width];
+    unsigned int input1[input_width];
+    T            output0[output_width];
+    T            output1[output_width];
 
     const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
     const size_t misalignment = (output_width - uintptr / sizeof(T) % output_width) % output_width;
@@ -74,23 +88,48 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     const size_t       vec_n     = (n - head_size) / output_width;
 
     vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
-    size_t    index    = id;
+    size_t    index0   = id;
+    size_t    index1   = id + threads;
+
+    while(index1 < vec_n)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input0[i] = engine0();
+            input1[i] = engine1();
+        }
+
+        distribution(input0, output0);
+        distribution(input1, output1);
 
-    while(index < vec_n)
+        vec_data[index0] = *reinterpret_cast<vec_type*>(output0);
+        vec_data[index1] = *reinterpret_cast<vec_type*>(output1);
+        index0 += stride;
+        index1 += stride;
+    }
+    // The first engine's position can still be in range when the
+    // second one's is not; at most one more vector is produced here
+    while(index0 < vec_n)
     {
         for(unsigned int i = 0; i < input_width; i++)
         {
-            input[i] = engine();
+            input0[i] = engine0();
         }
 
-        distribution(input, output);
+        distribution(input0, output0);
 
-        vec_data[index] = *reinterpret_cast<vec_type*>(output);
-        index += stride;
+        vec_data[index0] = *reinterpret_cast<vec_type*>(output0);
+        index0 += stride;
     }
 
-    if(output_width > 1 && index == vec_n)
+    // Exactly one engine in the grid lands on vec_n; it generates the
+    // head and tail like in the single-engine kernel
+    if(output_width > 1 && (index0 == vec_n || index1 == vec_n))
     {
+        lfsr113_device_engine& engine = index0 == vec_n ? engine0 : engine1;
+        unsigned int(&input)[input_width]   = index0 == vec_n ? input0 : input1;
+        T(&output)[output_width]            = index0 == vec_n ? output0 : output1;
+
         if(head_size > 0)
         {
             for(unsigned int i = 0; i < input_width; i++)
@@ -128,7 +167,8 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
         }
     }
 
-    engines[engine_id] = engine;
+    engines[engine_id0] = engine0;
+    engines[engine_id1] = engine1;
 }
 } // end namespace detail
 } // namespace rocrand_host
@@ -150,10 +190,13 @@ public:
         , m_engines_initialized(false)
         , m_engines(NULL)
         , m_engines_size(s_threads * s_blocks)
+        , m_dynamic_blocks(0)
+        , m_engines_owned(true)
+        , m_workspace_size(0)
     {
         // Allocate device random number engines
         hipError_t error
-            = hipMalloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
+            = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -162,21 +205,33 @@ public:
 
     ~rocrand_lfsr113()
     {
-        hipFree(m_engines);
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
     }
 
+    /// Changes seed to an expansion of \p seed and resets generator state.
+    ///
+    /// The 64-bit seed is expanded into four independent words with two
+    /// splitmix64 steps, so overlapping or nearby seeds still produce
+    /// unrelated states. OR-ing in the per-component minimum keeps every
+    /// word above the LFSR113 lower bounds without branching.
     void set_seed(unsigned long long seed)
     {
-        uint4 seeds = uint4{static_cast<unsigned int>(seed),
-                            static_cast<unsigned int>(seed >> 16),
-                            static_cast<unsigned int>(seed >> 32),
-                            static_cast<unsigned int>(seed >> 48)};
-
-        if(seeds.x < ROCRAND_LFSR113_DEFAULT_SEED_X)
-            seeds.x += ROCRAND_LFSR113_DEFAULT_SEED_X;
-
-        if(seeds.y < ROCRAND_LFSR113_DEFAULT_SEED_Y)
-            seeds.y += ROCRAND_LFSR113_DEFAULT_SEED_Y;
+        unsigned long long x = seed;
+        unsigned long long z[2];
+        for(int i = 0; i < 2; i++)
+        {
+            z[i] = (x += 0x9E3779B97F4A7C15ULL);
+            z[i] = (z[i] ^ (z[i] >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z[i] = (z[i] ^ (z[i] >> 27)) * 0x94D049BB133111EBULL;
+            z[i] = z[i] ^ (z[i] >> 31);
+        }
+        uint4 seeds = uint4{static_cast<unsigned int>(z[0]) | ROCRAND_LFSR113_DEFAULT_SEED_X,
+                            static_cast<unsigned int>(z[0] >> 32) | ROCRAND_LFSR113_DEFAULT_SEED_Y,
+                            static_cast<unsigned int>(z[1]) | ROCRAND_LFSR113_DEFAULT_SEED_Z,
+                            static_cast<unsigned int>(z[1] >> 32) | ROCRAND_LFSR113_DEFAULT_SEED_W};
 
         m_seed                = seeds;
         m_engines_initialized = false;
@@ -212,15 +267,84 @@ public:
         m_engines_initialized = false;
     }
 
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states under the current configuration; the size
+    // can change when the ordering changes.
+    size_t get_workspace_size()
+    {
+        return sizeof(engine_type) * target_engines_size();
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void* ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * m_engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned       = true;
+                m_workspace_size      = 0;
+                m_engines_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+        m_engines             = static_cast<engine_type*>(ptr);
+        m_engines_size        = target_engines_size();
+        m_workspace_size      = size;
+        m_engines_owned       = false;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if(m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        const size_t engines_size = target_engines_size();
+        if(engines_size != m_engines_size)
+        {
+            if(!m_engines_owned)
+            {
+                // A caller-provided workspace is only resized within
+                // the capacity it was registered with
+                if(sizeof(engine_type) * engines_size > m_workspace_size)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+            }
+            else
+            {
+                rocrand_host::detail::device_free(m_engines);
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+                statistics.count_reallocation();
+            }
+        }
+
         m_start_engine_id = m_offset % m_engines_size;
 
         hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-                           dim3(s_blocks),
+                           dim3(m_engines_size / s_threads),
                            dim3(s_threads),
                            0,
                            m_stream,
@@ -238,13 +362,25 @@ public:
     template<class T, class Distribution = uniform_distribution<T>>
     rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
     {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
         rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        statistics.begin_launch(m_stream);
+
+        // Half as many threads as engines; each thread interleaves two
+        // engines (see generate_kernel)
         hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-                           dim3(s_blocks),
-                           dim3(s_threads),
+                           dim3(m_engines_size / s_threads),
+                           dim3(s_threads / 2),
                            0,
                            m_stream,
                            m_engines,
@@ -253,13 +389,21 @@ public:
                            data_size,
                            distribution);
 
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
         const auto touched_engines
             = (data_size + Distribution::output_width - 1) / Distribution::output_width;
 
-        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        // Under ROCRAND_ORDERING_PSEUDO_FASTEST the deterministic
+        // engine rotation is dropped; engines keep their own state, so
+        // no values repeat, but the sequence layout is not reproducible
+        if(m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -274,17 +418,110 @@ public:
     template<class T>
     rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T* data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T* data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char* data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_uniform_int4_packed(unsigned char* data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         try
@@ -298,16 +535,80 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int* data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Number of engines (and with it the grid) used for generation.
+    // Under ROCRAND_ORDERING_PSEUDO_DYNAMIC and
+    // ROCRAND_ORDERING_PSEUDO_FASTEST it follows the device's
+    // occupancy, rounded down to a power of two because generate_kernel
+    // computes engine ids with & (stride - 1).
+    size_t target_engines_size()
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order))
+        {
+            return s_threads * s_blocks;
+        }
+        if(m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            const unsigned int blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type *, const unsigned int, unsigned int *,
+                                     const size_t, uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<unsigned int, uniform_distribution<unsigned int>>),
+                // Generation blocks run with half of s_threads threads
+                // because every thread carries two engines
+                s_threads / 2);
+            m_dynamic_blocks
+                = blocks == 0 ? s_blocks
+                              : rocrand_host::detail::previous_power_of_two(blocks);
+        }
+        return s_threads * static_cast<size_t>(m_dynamic_blocks);
+    }
+
     bool         m_engines_initialized;
     engine_type* m_engines;
     size_t       m_engines_size;
+    uint32_t     m_dynamic_blocks;
+    // Engine states may live in a caller-provided workspace
+    bool         m_engines_owned;
+    size_t       m_workspace_size;
 
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks  = 512;
 
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     unsigned int m_start_engine_id;
 };
 
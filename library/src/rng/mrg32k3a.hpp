@@ -48,7 +48,7 @@ namespace detail {
         engines[engine_id] = mrg32k3a_device_engine(seed, engine_id, offset + (engine_id < start_engine_id ? 1 : 0));
     }
 
-    template<class T, class Distribution>
+    template<unsigned int ValuesPerThread, class T, class Distribution>
     ROCRAND_KERNEL
     __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
     void generate_kernel(mrg32k3a_device_engine * engines,
@@ -82,6 +82,28 @@ namespace detail {
 
         vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
         size_t index = id;
+        // Each iteration produces ValuesPerThread vectors at strided
+        // positions before storing any of them; the engine is consumed
+        // in the same order as with one value per thread, so the output
+        // does not depend on the batching factor
+        while(index + (ValuesPerThread - 1) * static_cast<size_t>(stride) < vec_n)
+        {
+            vec_type batch[ValuesPerThread];
+            for(unsigned int v = 0; v < ValuesPerThread; v++)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = engine();
+                }
+                distribution(input, output);
+                batch[v] = *reinterpret_cast<vec_type *>(output);
+            }
+            for(unsigned int v = 0; v < ValuesPerThread; v++)
+            {
+                vec_data[index + v * static_cast<size_t>(stride)] = batch[v];
+            }
+            index += ValuesPerThread * static_cast<size_t>(stride);
+        }
         while(index < vec_n)
         {
             for(unsigned int i = 0; i < input_width; i++)
@@ -157,10 +179,13 @@ public:
         , m_engines_initialized(false)
         , m_engines(NULL)
         , m_engines_size(s_threads * s_blocks)
+        , m_dynamic_blocks(0)
+        , m_engines_owned(true)
+        , m_workspace_size(0)
     {
         // Allocate device random number engines
         hipError_t error
-            = hipMalloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
+            = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -173,7 +198,10 @@ public:
 
     ~rocrand_mrg32k3a()
     {
-        hipFree(m_engines);
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
     }
 
     void reset()
@@ -183,14 +211,9 @@ public:
 
     /// Changes seed to \p seed and resets generator state.
     ///
-    /// New seed value should not be zero. If \p seed_value is equal
-    /// zero, value \p ROCRAND_MRG32K3A_DEFAULT_SEED is used instead.
+    /// Any seed value, including zero, is expanded to a valid state.
     void set_seed(unsigned long long seed)
     {
-        if(seed == 0)
-        {
-            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
         m_seed = seed;
         m_engines_initialized = false;
     }
@@ -207,16 +230,85 @@ public:
         m_engines_initialized = false;
     }
 
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states under the current configuration; the size
+    // can change when the ordering changes.
+    size_t get_workspace_size()
+    {
+        return sizeof(engine_type) * target_engines_size();
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void * ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * m_engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned = true;
+                m_workspace_size = 0;
+                m_engines_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+        m_engines = static_cast<engine_type *>(ptr);
+        m_engines_size = target_engines_size();
+        m_workspace_size = size;
+        m_engines_owned = false;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        const size_t engines_size = target_engines_size();
+        if(engines_size != m_engines_size)
+        {
+            if(!m_engines_owned)
+            {
+                // A caller-provided workspace is only resized within
+                // the capacity it was registered with
+                if(sizeof(engine_type) * engines_size > m_workspace_size)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+            }
+            else
+            {
+                rocrand_host::detail::device_free(m_engines);
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+                statistics.count_reallocation();
+            }
+        }
+
         m_start_engine_id = m_offset % m_engines_size;
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
             m_engines, m_start_engine_id, m_seed, m_offset / m_engines_size
         );
         // Check kernel status
@@ -237,13 +329,38 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_start_engine_id, data, data_size, distribution
-        );
+        statistics.begin_launch(m_stream);
+
+        // Batching factor picked from the fill size and the grid in use
+        // on this device; the generated sequence is the same for all
+        const unsigned int values_per_thread = rocrand_host::detail::generate_values_per_thread(
+            data_size / Distribution::output_width, m_engines_size);
+        if(values_per_thread == 8)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<8>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
+        else if(values_per_thread == 4)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<4>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<1>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
         // Generating data_size values will use this many distributions
@@ -251,7 +368,15 @@ public:
             (data_size + Distribution::output_width - 1) /
             Distribution::output_width;
 
-        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        // Under ROCRAND_ORDERING_PSEUDO_FASTEST the deterministic
+        // engine rotation is dropped; engines keep their own state, so
+        // no values repeat, but the sequence layout is not reproducible
+        if (m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
 
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -267,7 +392,16 @@ public:
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
         mrg_engine_normal_distribution<T, rocrand_device::mrg32k3a_engine> distribution(mean,
-                                                                                        stddev);
+                                                                                        stddev,
+                                                                                        math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        mrg_engine_truncated_normal_distribution<T, rocrand_device::mrg32k3a_engine> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
@@ -275,10 +409,96 @@ public:
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
         mrg_engine_log_normal_distribution<T, rocrand_device::mrg32k3a_engine> distribution(mean,
-                                                                                            stddev);
+                                                                                            stddev,
+                                                                                            math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        mrg_engine_exponential_distribution<T, rocrand_device::mrg32k3a_engine> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        mrg_engine_cauchy_distribution<T, rocrand_device::mrg32k3a_engine> distribution(median, sigma);
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        mrg_engine_unit_vector_distribution<2, rocrand_device::mrg32k3a_engine> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        mrg_engine_unit_vector_distribution<3, rocrand_device::mrg32k3a_engine> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        mrg_engine_unit_vector_distribution<4, rocrand_device::mrg32k3a_engine> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        mrg_engine_weibull_distribution<T, rocrand_device::mrg32k3a_engine> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        mrg_engine_gamma_distribution<T, rocrand_device::mrg32k3a_engine> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        mrg_engine_uniform_int_range_distribution<rocrand_device::mrg32k3a_engine> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        mrg_engine_uniform_range_distribution<T, rocrand_device::mrg32k3a_engine> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        mrg_engine_uniform_int8_range_distribution<rocrand_device::mrg32k3a_engine> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        mrg_engine_uniform_int4_packed_distribution<rocrand_device::mrg32k3a_engine> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
@@ -294,10 +514,71 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        mrg_engine_discrete_distribution<rocrand_device::mrg32k3a_engine> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            mrg_engine_binomial_distribution<rocrand_device::mrg32k3a_engine> distribution(
+                m_binomial.dis);
+            return generate(data, data_size, distribution);
+        }
+        mrg_engine_binomial_approx_distribution<rocrand_device::mrg32k3a_engine> distribution(
+            t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Number of engines (and with it the grid) used for generation.
+    // Under ROCRAND_ORDERING_PSEUDO_DYNAMIC and
+    // ROCRAND_ORDERING_PSEUDO_FASTEST it follows the device's
+    // occupancy, rounded down to a power of two because generate_kernel
+    // computes engine ids with & (stride - 1).
+    size_t target_engines_size()
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order))
+        {
+            return s_threads * s_blocks;
+        }
+        if(m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            const unsigned int blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type *, const unsigned int, unsigned int *,
+                                     const size_t, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg32k3a_engine>)>(
+                    rocrand_host::detail::generate_kernel<1, unsigned int, mrg_engine_uniform_distribution<unsigned int, rocrand_device::mrg32k3a_engine>>),
+                s_threads);
+            m_dynamic_blocks
+                = blocks == 0 ? s_blocks
+                              : rocrand_host::detail::previous_power_of_two(blocks);
+        }
+        return s_threads * static_cast<size_t>(m_dynamic_blocks);
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
+    uint32_t m_dynamic_blocks;
+    // Engine states may live in a caller-provided workspace
+    bool m_engines_owned;
+    size_t m_workspace_size;
 
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
@@ -305,6 +586,10 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     // m_seed from base_type
     // m_offset from base_type
 
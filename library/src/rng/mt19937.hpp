@@ -54,6 +54,10 @@
 #define MT_FQUALIFIERS __forceinline__ __device__
 #define MT_FQUALIFIERS_HOST __host__
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 
 #include <rocrand/rocrand.h>
@@ -131,6 +135,22 @@ struct mt19937_engine
         m_state = discard_subsequence_impl(mt19937_jump, m_state);
     }
 
+    /// Advances the internal state to skip \p count subsequences at once using
+    /// the precomputed power-of-two jump polynomials. Equivalent to \p count
+    /// calls of discard_subsequence(): the resulting state may differ in the
+    /// 31 low bits of the oldest element, which the recurrence never reads,
+    /// so the generated sequence is identical.
+    MT_FQUALIFIERS_HOST void discard_subsequences(unsigned int count)
+    {
+        for(unsigned int k = 0; k < mt19937_jumps_pow2_count; k++)
+        {
+            if((count >> k) & 1U)
+            {
+                m_state = discard_subsequence_impl(mt19937_jumps_pow2[k], m_state);
+            }
+        }
+    }
+
     // Generates the next state.
     static MT_FQUALIFIERS_HOST void gen_next(mt19937_state& state)
     {
@@ -659,6 +679,81 @@ private:
     mt19937_octo_state m_state;
 };
 
+namespace
+{
+/// Number of octo engine states staged through shared memory at a time
+/// when loading and storing the generator state. 64 states of 79 words
+/// use about 20 KiB of shared memory.
+static constexpr unsigned int engines_per_chunk = 64;
+static_assert(thread_count % engines_per_chunk == 0,
+              "The block must process a whole number of chunks");
+} // namespace
+
+/// Loads the octo engine owned by this thread. The whole thread block
+/// cooperates: states are staged through shared memory one chunk at a time
+/// so that global memory is read with coalesced accesses instead of one
+/// strided <tt>sizeof(mt19937_octo_engine)</tt> read per thread.
+MT_FQUALIFIERS mt19937_octo_engine load_engine_coalesced(const mt19937_octo_engine* engines,
+                                                         unsigned int*              staging)
+{
+    constexpr unsigned int state_words = sizeof(mt19937_octo_engine) / sizeof(unsigned int);
+
+    const unsigned int* src = reinterpret_cast<const unsigned int*>(engines)
+                              + static_cast<size_t>(blockIdx.x) * blockDim.x * state_words;
+
+    mt19937_octo_engine engine;
+    unsigned int*       dst = reinterpret_cast<unsigned int*>(&engine);
+    for(unsigned int chunk = 0; chunk < thread_count / engines_per_chunk; chunk++)
+    {
+        for(unsigned int i = threadIdx.x; i < engines_per_chunk * state_words; i += blockDim.x)
+        {
+            staging[i] = src[chunk * engines_per_chunk * state_words + i];
+        }
+        __syncthreads();
+        if(threadIdx.x / engines_per_chunk == chunk)
+        {
+            const unsigned int local = threadIdx.x % engines_per_chunk;
+            for(unsigned int i = 0; i < state_words; i++)
+            {
+                dst[i] = staging[local * state_words + i];
+            }
+        }
+        __syncthreads();
+    }
+    return engine;
+}
+
+/// Stores the octo engine owned by this thread; the shared memory mirror
+/// image of load_engine_coalesced().
+MT_FQUALIFIERS void store_engine_coalesced(mt19937_octo_engine*       engines,
+                                           const mt19937_octo_engine& engine,
+                                           unsigned int*              staging)
+{
+    constexpr unsigned int state_words = sizeof(mt19937_octo_engine) / sizeof(unsigned int);
+
+    unsigned int* dst = reinterpret_cast<unsigned int*>(engines)
+                        + static_cast<size_t>(blockIdx.x) * blockDim.x * state_words;
+
+    const unsigned int* src = reinterpret_cast<const unsigned int*>(&engine);
+    for(unsigned int chunk = 0; chunk < thread_count / engines_per_chunk; chunk++)
+    {
+        if(threadIdx.x / engines_per_chunk == chunk)
+        {
+            const unsigned int local = threadIdx.x % engines_per_chunk;
+            for(unsigned int i = 0; i < state_words; i++)
+            {
+                staging[local * state_words + i] = src[i];
+            }
+        }
+        __syncthreads();
+        for(unsigned int i = threadIdx.x; i < engines_per_chunk * state_words; i += blockDim.x)
+        {
+            dst[chunk * engines_per_chunk * state_words + i] = staging[i];
+        }
+        __syncthreads();
+    }
+}
+
 ROCRAND_KERNEL
 __launch_bounds__(thread_count) void init_engines_kernel(mt19937_octo_engine* octo_engines,
                                                          mt19937_engine*      engines)
@@ -701,7 +796,10 @@ ROCRAND_KERNEL __launch_bounds__(thread_count) void generate_kernel(mt19937_octo
     // number of boundary-aligned elements vec_type that is a multiple of thread_per_generator
     const size_t vec_n = (size - head_size) / full_output_width * threads_per_generator;
 
-    mt19937_octo_engine engine = engines[thread_id];
+    __shared__ unsigned int
+        staging[engines_per_chunk * (sizeof(mt19937_octo_engine) / sizeof(unsigned int))];
+
+    mt19937_octo_engine engine = load_engine_coalesced(engines, staging);
 
     // each iteration saves output_width values T as one vec_type.
     // the number of vec_types produced by the loop is a multiple of threads_per_generator
@@ -752,7 +850,7 @@ ROCRAND_KERNEL __launch_bounds__(thread_count) void generate_kernel(mt19937_octo
     }
 
     // save state
-    engines[thread_id] = engine;
+    store_engine_coalesced(engines, engine, staging);
 }
 
 } // end namespace detail
@@ -766,11 +864,21 @@ public:
     using engine_type      = ::rocrand_host::detail::mt19937_engine;
 
     rocrand_mt19937(unsigned long long seed = 0, hipStream_t stream = 0)
-        : base_type(seed, 0, stream), m_engines_initialized(false), m_engines(NULL)
+        : base_type(seed, 0, stream)
+        , m_engines_initialized(false)
+        , m_engines(NULL)
+        , m_engines_owned(true)
+        , m_async_host(NULL)
+        , m_async_device(NULL)
+        , m_async_seed(0)
+        , m_async_pending(false)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(reinterpret_cast<void**>(&m_engines),
-                               threads_per_generator * generator_count * sizeof(octo_engine_type));
+        // Allocate device random number engines; ordered on the
+        // generator's stream so creation does not stall other streams
+        auto error
+            = rocrand_host::detail::device_malloc_async(reinterpret_cast<void**>(&m_engines),
+                               threads_per_generator * generator_count * sizeof(octo_engine_type),
+                               m_stream);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -787,7 +895,20 @@ public:
 
     ~rocrand_mt19937()
     {
-        hipFree(m_engines);
+        if(m_async_host != NULL || m_async_device != NULL)
+        {
+            // The callback and the upload may still be in flight
+            (void)hipStreamSynchronize(m_stream);
+            if(m_async_host != NULL)
+            {
+                (void)hipHostFree(m_async_host);
+            }
+            rocrand_host::detail::device_free_async(m_async_device, m_stream);
+        }
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free_async(m_engines, m_stream);
+        }
     }
 
     void reset()
@@ -808,6 +929,104 @@ public:
         m_engines_initialized = false;
     }
 
+    // Returns the number of bytes of device memory the generator needs
+    // for its octo engine states and the staging buffer used while
+    // initializing them.
+    size_t get_workspace_size() const
+    {
+        return threads_per_generator * generator_count * sizeof(octo_engine_type)
+               + generator_count * sizeof(engine_type);
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void* ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines  = NULL;
+                auto error = rocrand_host::detail::device_malloc_async(
+                                       reinterpret_cast<void**>(&m_engines),
+                                       threads_per_generator * generator_count
+                                           * sizeof(octo_engine_type),
+                                       m_stream);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned       = true;
+                m_engines_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free_async(m_engines, m_stream);
+        }
+        m_engines             = static_cast<octo_engine_type*>(ptr);
+        m_engines_owned       = false;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Returns the number of bytes of a state checkpoint: the octo
+    // engine states hold the generator's complete position, so the
+    // checkpoint is exactly their device array.
+    size_t get_state_size() const
+    {
+        return threads_per_generator * generator_count * sizeof(octo_engine_type);
+    }
+
+    // Copies the engine states into caller-provided memory (host or
+    // device) of at least get_state_size() bytes. The generator is
+    // initialized first if needed, so a checkpoint taken right after
+    // creation snapshots the freshly built states. Work in flight on
+    // the generator's stream completes before the copy, and the copy
+    // itself is synchronous, so the buffer is ready when the call
+    // returns.
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipMemcpy(state, m_engines, get_state_size(), hipMemcpyDefault) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Restores engine states saved by save_state(), replacing the
+    // jump-ahead initialization with a single copy. The restored
+    // generator continues the sequence exactly where the checkpoint was
+    // taken; the recorded seed is not consulted afterwards, and a later
+    // set_seed() discards the restored states.
+    rocrand_status load_state(const void* state)
+    {
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipMemcpy(m_engines, state, get_state_size(), hipMemcpyDefault) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         hipError_t err;
@@ -819,33 +1038,42 @@ public:
 
         // initialize the engines on the host due to high memory requirement
         // for jumping subsequences
-        std::vector<engine_type> h_engines;
-        h_engines.reserve(generator_count);
-        // initialize the first engine with the seed and no skips
-        h_engines.emplace_back(m_seed);
-        for(size_t i = 1; i < generator_count; i++)
-        {
-            // every consecutive engine is one subsequence away from the previous
-            h_engines.push_back(h_engines.back());
-            h_engines[i].discard_subsequence();
-        }
+        std::vector<engine_type> h_engines(generator_count, engine_type(m_seed));
+        seed_host_engines(h_engines.data());
 
+        // a caller-provided workspace already reserves room for the
+        // staging buffer behind the octo engines
         engine_type* d_engines{};
-        err = hipMalloc(reinterpret_cast<void**>(&d_engines),
-                        generator_count * sizeof(engine_type));
-        if(err != hipSuccess)
+        if(m_engines_owned)
+        {
+            err = rocrand_host::detail::device_malloc_async(reinterpret_cast<void**>(&d_engines),
+                            generator_count * sizeof(engine_type), m_stream);
+            if(err != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+        }
+        else
         {
-            return ROCRAND_STATUS_ALLOCATION_FAILED;
+            d_engines = reinterpret_cast<engine_type*>(m_engines
+                                                       + threads_per_generator * generator_count);
         }
 
-        err = hipMemcpy(d_engines,
-                        h_engines.data(),
-                        generator_count * sizeof(engine_type),
-                        hipMemcpyHostToDevice);
+        // On the generator's stream, behind the stream-ordered
+        // allocation; h_engines stays alive until the synchronization
+        // below
+        err = hipMemcpyAsync(d_engines,
+                             h_engines.data(),
+                             generator_count * sizeof(engine_type),
+                             hipMemcpyHostToDevice,
+                             m_stream);
 
         if(err != hipSuccess)
         {
-            hipFree(d_engines);
+            if(m_engines_owned)
+            {
+                rocrand_host::detail::device_free_async(d_engines, m_stream);
+            }
             return ROCRAND_STATUS_INTERNAL_ERROR;
         }
 
@@ -860,14 +1088,93 @@ public:
         err = hipStreamSynchronize(m_stream);
         if(err != hipSuccess)
         {
-            hipFree(d_engines);
+            if(m_engines_owned)
+            {
+                rocrand_host::detail::device_free_async(d_engines, m_stream);
+            }
             return ROCRAND_STATUS_LAUNCH_FAILURE;
         }
 
-        err = hipFree(d_engines);
-        if(err != hipSuccess)
+        if(m_engines_owned)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            err = rocrand_host::detail::device_free_async(d_engines, m_stream);
+            if(err != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Stream-ordered counterpart of init() for asynchronous creation:
+    // the host-side jump chain runs inside a host callback enqueued on
+    // the generator's stream, and the upload and the layout kernel
+    // follow it on the same stream, so the call returns after enqueuing
+    // instead of after the engines are built. Later launches on the
+    // stream are ordered behind the initialization; the staging buffers
+    // stay alive until the generator is destroyed.
+    rocrand_status init_async()
+    {
+        if(m_engines_initialized)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        if(m_async_host == NULL
+           && hipHostMalloc(reinterpret_cast<void**>(&m_async_host),
+                            generator_count * sizeof(engine_type))
+                  != hipSuccess)
+        {
+            // Without the pinned staging the callback has nowhere to
+            // build; fall back to the synchronous path
+            m_async_host = NULL;
+            return init();
+        }
+        if(m_async_device == NULL
+           && rocrand_host::detail::device_malloc_async(reinterpret_cast<void**>(&m_async_device),
+                                                        generator_count * sizeof(engine_type),
+                                                        m_stream)
+                  != hipSuccess)
+        {
+            m_async_device = NULL;
+            return init();
+        }
+
+        // The callback reads the seed it was enqueued with, so a later
+        // set_seed() cannot race with it
+        m_async_seed = m_seed;
+        if(hipLaunchHostFunc(m_stream, seed_host_engines_callback, this) != hipSuccess)
+        {
+            return init();
+        }
+        m_async_pending = true;
+        if(hipMemcpyAsync(m_async_device,
+                          m_async_host,
+                          generator_count * sizeof(engine_type),
+                          hipMemcpyHostToDevice,
+                          m_stream)
+           != hipSuccess)
+        {
+            (void)hipStreamSynchronize(m_stream);
+            m_async_pending = false;
+            return init();
+        }
+
+        hipLaunchKernelGGL(rocrand_host::detail::init_engines_kernel,
+                           dim3(block_count),
+                           dim3(thread_count),
+                           0,
+                           m_stream,
+                           m_engines,
+                           m_async_device);
+        if(launch_failed())
+        {
+            (void)hipStreamSynchronize(m_stream);
+            m_async_pending = false;
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
         }
 
         m_engines_initialized = true;
@@ -878,12 +1185,22 @@ public:
     template<class T, class Distribution = uniform_distribution<T>>
     rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
     {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
         rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        statistics.begin_launch(m_stream);
+
         hipLaunchKernelGGL(rocrand_host::detail::generate_kernel,
                            dim3(block_count),
                            dim3(thread_count),
@@ -895,11 +1212,13 @@ public:
                            distribution);
 
         // check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
         {
             return ROCRAND_STATUS_LAUNCH_FAILURE;
         }
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -913,17 +1232,110 @@ public:
     template<class T>
     rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T* data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T* data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char* data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char* data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         try
@@ -937,9 +1349,101 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int* data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Runs the jump chain over an array of generator_count engines that
+    // all hold the seeded state. Engine i ends up advanced by i
+    // subsequences; building that chain with single jumps is serial, so
+    // it is split across worker threads: every worker jumps directly to
+    // the first subsequence of its range with the precomputed
+    // power-of-two jump polynomials and chains single jumps from there.
+    static void seed_host_engines(engine_type* h_engines)
+    {
+        static_assert(generator_count <= (1U << mt19937_jumps_pow2_count),
+                      "power-of-two jump polynomials cannot reach all engines");
+        const unsigned int worker_count
+            = std::min(std::max(std::thread::hardware_concurrency(), 1U), generator_count);
+        const unsigned int engines_per_worker = (generator_count + worker_count - 1) / worker_count;
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        for(unsigned int w = 0; w < worker_count; w++)
+        {
+            workers.emplace_back(
+                [h_engines, w, engines_per_worker]
+                {
+                    const unsigned int first = w * engines_per_worker;
+                    const unsigned int last
+                        = std::min(first + engines_per_worker, generator_count);
+                    if(first >= last)
+                    {
+                        return;
+                    }
+                    h_engines[first].discard_subsequences(first);
+                    for(unsigned int i = first + 1; i < last; i++)
+                    {
+                        // every consecutive engine is one subsequence away from the previous
+                        h_engines[i] = h_engines[i - 1];
+                        h_engines[i].discard_subsequence();
+                    }
+                });
+        }
+        for(auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Body of the host callback of init_async(); runs on the stream's
+    // callback thread, so it makes no HIP calls
+    static void seed_host_engines_callback(void* user_data)
+    {
+        rocrand_mt19937* self = static_cast<rocrand_mt19937*>(user_data);
+        const engine_type seeded(self->m_async_seed);
+        for(unsigned int i = 0; i < generator_count; i++)
+        {
+            self->m_async_host[i] = seeded;
+        }
+        seed_host_engines(self->m_async_host);
+        self->m_async_pending = false;
+    }
+
     bool              m_engines_initialized;
     octo_engine_type* m_engines;
+    // Engine states may live in a caller-provided workspace
+    bool              m_engines_owned;
+    // Staging of an asynchronous initialization; kept until destruction
+    // because the upload consuming it is only stream-ordered
+    engine_type*       m_async_host;
+    engine_type*       m_async_device;
+    unsigned long long m_async_seed;
+    // Set while the host callback has not run yet
+    volatile bool      m_async_pending;
 
     static constexpr unsigned int generators_per_block = thread_count / threads_per_generator;
     static constexpr unsigned int block_count          = generator_count / generators_per_block;
@@ -949,6 +1453,10 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     // m_seed from base_type
     // m_offset from base_type
 };
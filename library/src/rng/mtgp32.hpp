@@ -71,6 +71,34 @@ namespace detail {
 
     typedef ::rocrand_device::mtgp32_engine mtgp32_device_engine;
 
+    // Advances every engine by offset positions of its own output
+    // sequence. MTGP32 has no published jump polynomials for the 11213
+    // parameter sets, so the state is stepped directly; the recurrence
+    // runs at full block width with no output traffic, so the cost is
+    // linear in offset but bounded by the generator's fill rate.
+    template<unsigned int BlockSize>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void skip_ahead_kernel(mtgp32_device_engine * engines,
+                           const unsigned long long offset)
+    {
+        const unsigned int engine_id = blockIdx.x;
+
+        __shared__ mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        unsigned long long remaining = offset;
+        while(remaining > 0)
+        {
+            const unsigned int n = remaining < BlockSize
+                ? static_cast<unsigned int>(remaining) : BlockSize;
+            engine.discard(n);
+            remaining -= n;
+        }
+
+        engines[engine_id].copy(&engine);
+    }
+
     template<unsigned int BlockSize, class T, class Distribution>
     ROCRAND_KERNEL
     __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
@@ -193,10 +221,16 @@ public:
         , m_engines_initialized(false)
         , m_engines(NULL)
         , m_engines_size(s_blocks)
+        , m_dynamic_blocks(0)
+        , m_engines_owned(true)
+        , m_workspace_size(0)
     {
-        // Allocate device random number engines
+        // Allocate device random number engines; ordered on the
+        // generator's stream so creation does not stall other streams
         hipError_t error
-            = hipMalloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
+            = rocrand_host::detail::device_malloc_async(reinterpret_cast<void**>(&m_engines),
+                                                        sizeof(engine_type) * m_engines_size,
+                                                        m_stream);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -205,7 +239,10 @@ public:
 
     ~rocrand_mtgp32()
     {
-        hipFree(m_engines);
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free_async(m_engines, m_stream);
+        }
     }
 
     void reset()
@@ -235,6 +272,53 @@ public:
         m_engines_initialized = false;
     }
 
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states under the current configuration; the size
+    // can change when the ordering changes.
+    size_t get_workspace_size()
+    {
+        return sizeof(engine_type) * target_engines_size();
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void * ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc_async(
+                                             reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * m_engines_size,
+                                             m_stream);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned = true;
+                m_workspace_size = 0;
+                m_engines_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free_async(m_engines, m_stream);
+        }
+        m_engines = static_cast<engine_type *>(ptr);
+        m_engines_size = target_engines_size();
+        m_workspace_size = size;
+        m_engines_owned = false;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
@@ -242,13 +326,57 @@ public:
 
         rocrand_status status;
 
-        if (m_engines_size > mtgpdc_params_11213_num)
+        const size_t engines_size = target_engines_size();
+        if (engines_size > mtgpdc_params_11213_num)
             return ROCRAND_STATUS_ALLOCATION_FAILED;
 
+        if(engines_size != m_engines_size)
+        {
+            if(!m_engines_owned)
+            {
+                // A caller-provided workspace is only resized within
+                // the capacity it was registered with
+                if(sizeof(engine_type) * engines_size > m_workspace_size)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+            }
+            else
+            {
+                rocrand_host::detail::device_free_async(m_engines, m_stream);
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc_async(
+                                             reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * engines_size,
+                                             m_stream);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+                statistics.count_reallocation();
+            }
+        }
+
+        // The engines were allocated in the stream's order, but
+        // rocrand_make_state_mtgp32 uploads on the null stream; make
+        // the allocation visible to it first
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
         status = rocrand_make_state_mtgp32(m_engines, mtgp32dc_params_fast_11213, m_engines_size, m_seed);
         if(status != ROCRAND_STATUS_SUCCESS)
             return ROCRAND_STATUS_ALLOCATION_FAILED;
 
+        if(m_offset > 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::skip_ahead_kernel<s_threads>),
+                dim3(m_engines_size), dim3(s_threads), 0, m_stream,
+                m_engines, m_offset
+            );
+            // Check kernel status
+            if(hipGetLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -258,19 +386,31 @@ public:
     rocrand_status generate(T * data, size_t data_size,
                             Distribution distribution = Distribution())
     {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
         rocrand_status status = init();
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        statistics.begin_launch(m_stream);
+
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            dim3(m_engines_size), dim3(s_threads), 0, m_stream,
             m_engines, data, data_size, distribution
         );
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -284,17 +424,110 @@ public:
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
@@ -308,10 +541,68 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Number of engines (and with it the grid, as every block runs one
+    // engine) used for generation. Under
+    // ROCRAND_ORDERING_PSEUDO_DYNAMIC and ROCRAND_ORDERING_PSEUDO_FASTEST
+    // it follows the device's occupancy, capped by the number of
+    // precomputed parameter sets since each engine needs its own set.
+    size_t target_engines_size()
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order))
+        {
+            return s_blocks;
+        }
+        if(m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            const unsigned int blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type *, unsigned int *,
+                                     const size_t, uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<s_threads, unsigned int, uniform_distribution<unsigned int>>),
+                s_threads);
+            m_dynamic_blocks
+                = blocks == 0 ? s_blocks
+                              : std::min<uint32_t>(blocks, mtgpdc_params_11213_num);
+        }
+        return m_dynamic_blocks;
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
+    uint32_t m_dynamic_blocks;
+    // Engine states may live in a caller-provided workspace
+    bool m_engines_owned;
+    size_t m_workspace_size;
 
     static constexpr uint32_t s_threads = 256;
     static constexpr uint32_t s_blocks = 512;
@@ -319,6 +610,10 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     // m_seed from base_type
     // m_offset from base_type
 };
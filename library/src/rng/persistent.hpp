@@ -0,0 +1,460 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PERSISTENT_H_
+#define ROCRAND_RNG_PERSISTENT_H_
+
+#include <atomic>
+#include <thread>
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_cooperative_groups.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Fill types the persistent kernel understands; everything else keeps
+// using regular launches (see rocrand_set_persistent_mode)
+enum persistent_op : unsigned int
+{
+    persistent_op_uniform_uint = 0,
+    persistent_op_uniform_float,
+    persistent_op_uniform_double,
+    persistent_op_normal_float
+};
+
+// One enqueued fill. The host writes a descriptor into the ring and
+// publishes it by advancing the tail index; the kernel consumes it and
+// advances the head index when the output is globally visible.
+struct persistent_descriptor
+{
+    void *             data;
+    unsigned long long n;
+    unsigned int       op;
+    float              mean;
+    float              stddev;
+};
+
+// Ring indices and the stop request live in pinned host memory so both
+// sides see each other's updates without synchronizing. head is written
+// by the device only, tail and stop by the host only.
+struct persistent_queue_header
+{
+    volatile unsigned long long head;
+    volatile unsigned long long tail;
+    volatile unsigned int       stop;
+};
+
+template<class Engine>
+ROCRAND_KERNEL
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void persistent_init_kernel(Engine * engines,
+                            unsigned long long seed,
+                            unsigned long long first_engine_id)
+{
+    const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+    engines[engine_id] = Engine(seed, first_engine_id + engine_id, 0);
+}
+
+// Applies one descriptor with loops strided by the caller's rank and
+// size; shared by the single-block and the cooperative grid kernels
+template<class Engine>
+__forceinline__ __device__
+void persistent_apply(Engine& engine,
+                      const persistent_descriptor& desc,
+                      const unsigned long long rank,
+                      const unsigned long long size)
+{
+    if(desc.op == persistent_op_uniform_uint)
+    {
+        unsigned int * data = static_cast<unsigned int *>(desc.data);
+        uniform_distribution<unsigned int> distribution;
+        for(unsigned long long i = rank; i < desc.n; i += size)
+        {
+            const unsigned int input[1] = { engine() };
+            unsigned int output[1];
+            distribution(input, output);
+            data[i] = output[0];
+        }
+    }
+    else if(desc.op == persistent_op_uniform_float)
+    {
+        float * data = static_cast<float *>(desc.data);
+        uniform_distribution<float> distribution;
+        for(unsigned long long i = rank; i < desc.n; i += size)
+        {
+            const unsigned int input[1] = { engine() };
+            float output[1];
+            distribution(input, output);
+            data[i] = output[0];
+        }
+    }
+    else if(desc.op == persistent_op_uniform_double)
+    {
+        double * data = static_cast<double *>(desc.data);
+        uniform_distribution<double> distribution;
+        for(unsigned long long i = rank; i < desc.n; i += size)
+        {
+            const unsigned int input[2] = { engine(), engine() };
+            double output[1];
+            distribution(input, output);
+            data[i] = output[0];
+        }
+    }
+    else if(desc.op == persistent_op_normal_float)
+    {
+        float * data = static_cast<float *>(desc.data);
+        normal_distribution<float> distribution(desc.mean, desc.stddev);
+        for(unsigned long long i = 2 * rank; i < desc.n; i += 2 * size)
+        {
+            const unsigned int input[2] = { engine(), engine() };
+            float output[2];
+            distribution(input, output);
+            data[i] = output[0];
+            if(i + 1 < desc.n)
+            {
+                data[i + 1] = output[1];
+            }
+        }
+    }
+}
+
+// Single-block kernel that stays resident on its own stream and drains
+// fill descriptors from the ring. It exits only after a stop request,
+// and drains any descriptors enqueued before the request first. Used on
+// devices without cooperative launch support.
+template<class Engine>
+ROCRAND_KERNEL
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void persistent_kernel(Engine * engines,
+                       persistent_queue_header * header,
+                       const persistent_descriptor * ring,
+                       const unsigned int capacity)
+{
+    Engine engine = engines[threadIdx.x];
+
+    __shared__ unsigned int run;
+    unsigned long long head = header->head;
+    while(true)
+    {
+        if(threadIdx.x == 0)
+        {
+            // The indices are in host memory; volatile reads keep the
+            // spin observing the host's updates
+            while(header->tail == head && header->stop == 0) {}
+            run = header->tail != head ? 1 : 0;
+        }
+        __syncthreads();
+        if(run == 0)
+        {
+            break;
+        }
+
+        const persistent_descriptor desc = ring[head % capacity];
+        persistent_apply(engine, desc, threadIdx.x, blockDim.x);
+
+        // The output must be visible to the host and to other streams
+        // before the descriptor is retired
+        __threadfence_system();
+        __syncthreads();
+        head++;
+        if(threadIdx.x == 0)
+        {
+            header->head = head;
+        }
+    }
+
+    engines[threadIdx.x] = engine;
+}
+
+// Cooperative variant of persistent_kernel: one resident grid sized to
+// the device's occupancy serves every descriptor, with a grid-wide
+// sync separating the fills, so the queue feeds fills of any size at
+// full-device bandwidth while every thread keeps its engine in
+// registers across them. One thread polls the host-updated indices and
+// broadcasts the run decision through \p run_flag in device memory,
+// the grid-scope counterpart of the shared flag in persistent_kernel;
+// the flag is written before one sync and read after it, and the next
+// write happens after the following sync, so the reads never race.
+template<class Engine>
+ROCRAND_KERNEL
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void persistent_grid_kernel(Engine * engines,
+                            persistent_queue_header * header,
+                            const persistent_descriptor * ring,
+                            const unsigned int capacity,
+                            unsigned int * run_flag)
+{
+    const auto grid = cooperative_groups::this_grid();
+    const unsigned long long rank = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned long long size = gridDim.x * blockDim.x;
+
+    Engine engine = engines[rank];
+
+    unsigned long long head = header->head;
+    while(true)
+    {
+        if(rank == 0)
+        {
+            while(header->tail == head && header->stop == 0) {}
+            *run_flag = header->tail != head ? 1 : 0;
+            __threadfence();
+        }
+        grid.sync();
+        if(*run_flag == 0)
+        {
+            break;
+        }
+
+        const persistent_descriptor desc = ring[head % capacity];
+        persistent_apply(engine, desc, rank, size);
+
+        // The output must be visible to the host and to other streams
+        // before the descriptor is retired
+        __threadfence_system();
+        grid.sync();
+        head++;
+        if(rank == 0)
+        {
+            header->head = head;
+        }
+    }
+
+    engines[rank] = engine;
+}
+
+// Host side of the ring. The queue owns a non-blocking stream with the
+// resident kernel and a dedicated set of engines, so regular launches
+// of the generator keep working while the queue is active.
+template<class Engine>
+class persistent_generator_queue
+{
+public:
+    persistent_generator_queue() {}
+
+    persistent_generator_queue(const persistent_generator_queue&) = delete;
+    persistent_generator_queue& operator=(const persistent_generator_queue&) = delete;
+
+    ~persistent_generator_queue()
+    {
+        stop();
+    }
+
+    bool active() const
+    {
+        return m_active;
+    }
+
+    rocrand_status start(unsigned long long seed,
+                         unsigned long long first_engine_id,
+                         unsigned int threads)
+    {
+        if(m_active)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // On a device with cooperative launch support a grid sized to
+        // the occupancy of the grid kernel serves the queue; otherwise
+        // a single resident block does, as before. A one-block grid
+        // gains nothing over the fallback, so it also takes the
+        // fallback path.
+        unsigned int blocks = 0;
+        int device;
+        int cooperative = 0;
+        if(hipGetDevice(&device) == hipSuccess
+           && hipDeviceGetAttribute(&cooperative,
+                                    hipDeviceAttributeCooperativeLaunch,
+                                    device)
+                  == hipSuccess
+           && cooperative != 0)
+        {
+            blocks = max_resident_blocks(persistent_grid_kernel<Engine>, threads);
+        }
+        if(blocks <= 1)
+        {
+            blocks = 1;
+        }
+
+        if(hipStreamCreateWithFlags(&m_queue_stream, hipStreamNonBlocking)
+           != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipHostMalloc(reinterpret_cast<void**>(&m_header),
+                         sizeof(persistent_queue_header)
+                             + sizeof(persistent_descriptor) * s_capacity)
+           != hipSuccess)
+        {
+            hipStreamDestroy(m_queue_stream);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(device_malloc(reinterpret_cast<void**>(&m_engines),
+                         sizeof(Engine) * blocks * threads)
+           != hipSuccess)
+        {
+            hipHostFree(m_header);
+            hipStreamDestroy(m_queue_stream);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(blocks > 1
+           && device_malloc(reinterpret_cast<void**>(&m_run_flag),
+                            sizeof(unsigned int))
+                  != hipSuccess)
+        {
+            device_free(m_engines);
+            m_engines = NULL;
+            hipHostFree(m_header);
+            hipStreamDestroy(m_queue_stream);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        m_ring = reinterpret_cast<persistent_descriptor *>(m_header + 1);
+        m_header->head = 0;
+        m_header->tail = 0;
+        m_header->stop = 0;
+        m_tail = 0;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(persistent_init_kernel<Engine>),
+            dim3(blocks), dim3(threads), 0, m_queue_stream,
+            m_engines, seed, first_engine_id
+        );
+        if(blocks > 1)
+        {
+            unsigned int capacity = s_capacity;
+            void * args[] = {&m_engines, &m_header, &m_ring, &capacity, &m_run_flag};
+            if(hipLaunchCooperativeKernel(persistent_grid_kernel<Engine>,
+                                          dim3(blocks), dim3(threads),
+                                          args, 0, m_queue_stream)
+               != hipSuccess)
+            {
+                m_header->stop = 1;
+                hipStreamSynchronize(m_queue_stream);
+                release();
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(persistent_kernel<Engine>),
+                dim3(1), dim3(threads), 0, m_queue_stream,
+                m_engines, m_header, m_ring, s_capacity
+            );
+        }
+        if(hipGetLastError() != hipSuccess)
+        {
+            m_header->stop = 1;
+            hipStreamSynchronize(m_queue_stream);
+            release();
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        m_active = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Publishes one fill to the kernel. Spins for a slot when the ring
+    // is full; the kernel drains it on its own stream, so the wait is
+    // bounded by the work already queued.
+    bool enqueue(const persistent_descriptor& desc)
+    {
+        if(!m_active)
+        {
+            return false;
+        }
+        while(m_tail - m_header->head >= s_capacity)
+        {
+            std::this_thread::yield();
+        }
+        m_ring[m_tail % s_capacity] = desc;
+        // The descriptor must be visible before the tail that publishes it
+        std::atomic_thread_fence(std::memory_order_release);
+        m_tail++;
+        m_header->tail = m_tail;
+        return true;
+    }
+
+    // Returns when every enqueued fill has been written and is globally
+    // visible (the kernel fences before retiring a descriptor)
+    void fence()
+    {
+        if(!m_active)
+        {
+            return;
+        }
+        while(m_header->head != m_tail)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    rocrand_status stop()
+    {
+        if(!m_active)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        m_header->stop = 1;
+        if(hipStreamSynchronize(m_queue_stream) != hipSuccess)
+        {
+            release();
+            m_active = false;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        release();
+        m_active = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    void release()
+    {
+        device_free(m_engines);
+        device_free(m_run_flag);
+        hipHostFree(m_header);
+        hipStreamDestroy(m_queue_stream);
+        m_engines = NULL;
+        m_run_flag = NULL;
+        m_header = NULL;
+        m_ring = NULL;
+    }
+
+    static const unsigned int s_capacity = 1024;
+
+    bool m_active = false;
+    hipStream_t m_queue_stream;
+    Engine * m_engines = NULL;
+    unsigned int * m_run_flag = NULL;
+    persistent_queue_header * m_header = NULL;
+    persistent_descriptor * m_ring = NULL;
+    unsigned long long m_tail = 0;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PERSISTENT_H_
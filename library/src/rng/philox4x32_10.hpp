@@ -54,6 +54,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ROCRAND_RNG_PHILOX4X32_10_H_
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand/rocrand.h>
@@ -62,13 +66,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "seeded.hpp"
+#include "tuning.hpp"
 
 namespace rocrand_host {
 namespace detail {
     struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engine
     {
         typedef ::rocrand_device::philox4x32_10_engine base_type;
-        typedef base_type::philox4x32_10_state state_type;
+        typedef base_type::philox4x32_state state_type;
 
         __forceinline__ __device__ __host__
         philox4x32_10_device_engine() { }
@@ -91,12 +97,12 @@ namespace detail {
             uint4 ret = m_state.result;
             if(m_state.substate > 0) {
                 const uint4 next_counter = this->bump_counter(m_state.counter);
-                const uint4 next = this->ten_rounds(next_counter, m_state.key);
+                const uint4 next = this->philox_rounds(next_counter, m_state.key);
                 ret = this->interleave(ret, next);
             }
 
             this->discard_state(leap);
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            m_state.result = this->philox_rounds(m_state.counter, m_state.key);
             return ret;
         }
 
@@ -135,29 +141,29 @@ namespace detail {
         const unsigned int tail_size = (n - head_size) % full_output_width;
         const size_t vec_n = (n - head_size) / full_output_width;
 
-        const unsigned int engine_offset = 4 * thread_id + (thread_id == 0 ? 0 : head_size);
-        engine.discard(engine_offset);
-
-        // If data is not aligned by sizeof(vec_type)
-        if(thread_id == 0 && head_size > 0) {
-            for(unsigned int s = 0; s < output_per_thread; ++s) {
-                if(s * output_width >= head_size) {
-                    break;
-                }
-
-                for(unsigned int i = 0; i < input_width; ++i) {
-                    input[i] = engine();
-                }
-                distribution(input, output[s]);
-
-                for(unsigned int o = 0; o < output_width; ++o) {
-                    if(s * output_width + o < head_size) {
-                        data[s * output_width + o] = output[s][o];
-                    }
+        // The head is served by the first threads, one application each,
+        // instead of a serial loop in thread 0; every application consumes
+        // the engine values the serial loop would have, so the output is
+        // unchanged
+        const unsigned int head_applications = (head_size + output_width - 1) / output_width;
+        if(head_size > 0 && thread_id < head_applications) {
+            philox4x32_10_device_engine head_engine = engine;
+            head_engine.discard(thread_id * input_width);
+            for(unsigned int i = 0; i < input_width; ++i) {
+                input[i] = head_engine();
+            }
+            distribution(input, output[0]);
+            for(unsigned int o = 0; o < output_width; ++o) {
+                if(thread_id * output_width + o < head_size) {
+                    data[thread_id * output_width + o] = output[0][o];
                 }
             }
         }
 
+        const unsigned int engine_offset = 4 * thread_id +
+            (thread_id == 0 ? head_applications * input_width : head_size);
+        engine.discard(engine_offset);
+
         // Save multiple values as one vec_type
         vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
         size_t index = thread_id;
@@ -202,129 +208,2818 @@ namespace detail {
         }
     }
 
-} // end namespace detail
-} // end namespace rocrand_host
+    // Low-latency variant for small fills. Skips the vectorized stores
+    // and the alignment head/tail handling of generate_kernel, which are
+    // pure overhead when the launch latency dominates the fill. Consumes
+    // input_width engine values per distribution application, the same
+    // accounting as generate_kernel, so the host-side discard after the
+    // launch stays correct. Every application consumes the engine values
+    // of its own index, so the output does not depend on the grid shape;
+    // ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT reuses this kernel for
+    // fills of any size.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_small_kernel(philox4x32_10_device_engine engine,
+                               T * data, const size_t n,
+                               Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
 
-class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
-{
-public:
-    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
-    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
 
-    rocrand_philox4x32_10(unsigned long long seed   = 0,
-                          unsigned long long offset = 0,
-                          rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
-                          hipStream_t        stream = 0)
-        : base_type(order, seed, offset, stream), m_engines_initialized(false)
-    {
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const size_t applications = (n + output_width - 1) / output_width;
+
+        engine.discard(input_width * thread_id);
+        size_t index = thread_id;
+        while(index < applications)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < n)
+                {
+                    data[j] = output[o];
+                }
+            }
+            index += stride;
+            engine.discard(input_width * (stride - 1));
+        }
     }
 
-    void reset()
+    // Initializes the resident engines: thread i owns subsequence i + 1
+    // of the seed's stream (subsequence 0 belongs to the by-value
+    // engine), positioned at the generator's offset. Subsequences are
+    // 2^66 values apart, so the threads' draws cannot overlap.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void init_resident_engines_kernel(philox4x32_10_device_engine * engines,
+                                      const unsigned long long seed,
+                                      const unsigned long long offset)
     {
-        m_engines_initialized = false;
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        engines[thread_id] = philox4x32_10_device_engine(seed, 1ULL + thread_id, offset);
     }
 
-    /// Changes seed to \p seed and resets generator state.
-    void set_seed(unsigned long long seed)
+    // Persistent-state variant of generate_small_kernel: the engine is
+    // loaded from device memory and stored back advanced, so the launch
+    // carries only a pointer and the host replays no discard. Each
+    // thread draws consecutive values of its own subsequence instead of
+    // leapfrogging through a shared one, which is what keeps a thread's
+    // state advance independent of the fill size and the other threads.
+    // Threads past the last application return before touching their
+    // state, so small fills only advance the engines they used.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_resident_kernel(philox4x32_10_device_engine * engines,
+                                  T * data, const size_t n,
+                                  Distribution distribution)
     {
-        m_seed = seed;
-        m_engines_initialized = false;
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        const size_t applications = (n + output_width - 1) / output_width;
+        if(thread_id >= applications)
+        {
+            return;
+        }
+
+        philox4x32_10_device_engine engine = engines[thread_id];
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        for(size_t index = thread_id; index < applications; index += stride)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < n)
+                {
+                    data[j] = output[o];
+                }
+            }
+        }
+
+        engines[thread_id] = engine;
     }
 
-    void set_offset(unsigned long long offset)
+    // Pitched fill for column-major matrices with padding between the
+    // columns (pitch > rows, both in elements). Logical element (i, j)
+    // is stored at data[j * pitch + i] and receives the value its dense
+    // index j * rows + i would receive from generate_small_kernel, so
+    // the payload matches an index-mapped dense fill of rows * cols
+    // values while the padding is neither read nor written. Every
+    // application consumes the engine values of its own index, so the
+    // output does not depend on the grid shape.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_2d_kernel(philox4x32_10_device_engine engine,
+                            T * data, const size_t rows, const size_t cols,
+                            const size_t pitch,
+                            Distribution distribution)
     {
-        m_offset = offset;
-        m_engines_initialized = false;
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const size_t n = rows * cols;
+        const size_t applications = (n + output_width - 1) / output_width;
+
+        engine.discard(input_width * thread_id);
+        size_t index = thread_id;
+        while(index < applications)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < n)
+                {
+                    data[(j / rows) * pitch + j % rows] = output[o];
+                }
+            }
+            index += stride;
+            engine.discard(input_width * (stride - 1));
+        }
     }
 
-    void set_order(rocrand_ordering order)
+    // Regenerates the last application of a fill and stores the values
+    // past the end of the output, which generate_kernel and
+    // generate_small_kernel discard. The host side banks them for the
+    // next call instead of wasting them. Launched with a single thread,
+    // with \p engine positioned at the last application; \p used is the
+    // number of its values the fill consumed.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    void generate_remainder_kernel(philox4x32_10_device_engine engine,
+                                   T * remainder, const unsigned int used,
+                                   Distribution distribution)
     {
-        m_order               = order;
-        m_engines_initialized = false;
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        for(unsigned int o = used; o < output_width; o++)
+        {
+            remainder[o - used] = output[o];
+        }
     }
 
-    rocrand_status init()
+    // Generates whole output vectors per thread and applies the lower
+    // triangular Cholesky factor to the normal variates while they are
+    // still in registers, so correlated vectors are produced in a single
+    // pass over the output buffer (no separate trmm-style transform).
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_multivariate_normal_kernel(philox4x32_10_device_engine engine,
+                                             float * data, const size_t n_vectors,
+                                             const unsigned int dim,
+                                             const float * cholesky_factor)
     {
-        if(m_engines_initialized)
-            return ROCRAND_STATUS_SUCCESS;
+        constexpr unsigned int max_dim = 32;
 
-        m_engine = engine_type{m_seed, 0, m_offset};
+        __shared__ float factor[max_dim * max_dim];
+        for(unsigned int i = threadIdx.x; i < dim * dim; i += blockDim.x)
+        {
+            factor[i] = cholesky_factor[i];
+        }
+        __syncthreads();
 
-        m_engines_initialized = true;
-        return ROCRAND_STATUS_SUCCESS;
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        // Box-Muller produces pairs, so odd dimensions discard one value
+        const unsigned int draws_per_vector = (dim + 1) & ~1u;
+
+        for(size_t index = thread_id; index < n_vectors; index += stride)
+        {
+            philox4x32_10_device_engine e = engine;
+            e.discard(index * draws_per_vector);
+
+            float z[max_dim];
+            for(unsigned int i = 0; i < dim; i += 2)
+            {
+                const unsigned int x = e();
+                const unsigned int y = e();
+                const float2 v = rocrand_device::detail::normal_distribution2(x, y);
+                z[i] = v.x;
+                if(i + 1 < dim)
+                {
+                    z[i + 1] = v.y;
+                }
+            }
+
+            float * out = data + index * dim;
+            for(unsigned int r = 0; r < dim; r++)
+            {
+                float sum = 0.0f;
+                for(unsigned int c = 0; c <= r; c++)
+                {
+                    sum += factor[r * dim + c] * z[c];
+                }
+                out[r] = sum;
+            }
+        }
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
+    // Generates whole Dirichlet vectors per thread: the K gamma draws of
+    // a vector stay in registers and are normalized before the single
+    // store, so a Dirichlet vector costs the same bandwidth as a plain
+    // float fill (no separate gamma buffer or normalization pass). Each
+    // component consumes two engine values, like the gamma distribution.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_dirichlet_kernel(philox4x32_10_device_engine engine,
+                                   float * data, const size_t n_vectors,
+                                   const unsigned int k,
+                                   const float * alphas)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        constexpr unsigned int max_dim = 32;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engine, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipGetLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        __shared__ float alpha[max_dim];
+        for(unsigned int i = threadIdx.x; i < k; i += blockDim.x)
+        {
+            alpha[i] = alphas[i];
+        }
+        __syncthreads();
 
-        // Generating data_size values will use this many distributions
-        const auto num_applied_generators =
-            (data_size + Distribution::output_width - 1) /
-            Distribution::output_width * Distribution::input_width;
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t index = thread_id; index < n_vectors; index += stride)
+        {
+            philox4x32_10_device_engine e = engine;
+            e.discard(index * 2 * k);
 
-        m_engine.discard(num_applied_generators);
+            float g[max_dim];
+            float sum = 0.0f;
+            for(unsigned int c = 0; c < k; c++)
+            {
+                const unsigned int w0 = e();
+                const unsigned int w1 = e();
+                g[c] = rocrand_host::detail::gamma_distribution(w0, w1, alpha[c]);
+                sum += g[c];
+            }
 
-        return ROCRAND_STATUS_SUCCESS;
+            float * out = data + index * k;
+            if(sum > 0.0f)
+            {
+                const float inv = 1.0f / sum;
+                for(unsigned int c = 0; c < k; c++)
+                {
+                    out[c] = g[c] * inv;
+                }
+            }
+            else
+            {
+                // All draws can underflow to zero for very small shapes;
+                // the limit distribution concentrates on the vertices,
+                // but a uniform vector is the only safe in-simplex value
+                for(unsigned int c = 0; c < k; c++)
+                {
+                    out[c] = 1.0f / k;
+                }
+            }
+        }
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    // Poisson generation with a per-element rate read from device memory.
+    // Every output selects its sampling method by the magnitude of its
+    // lambda (Knuth's product method below 64, Atkinson's rejection
+    // method up to 4000, the normal approximation above), so the number
+    // of engine values a sample consumes is data-dependent; each output
+    // index therefore draws from its own subsequence instead of a fixed
+    // slice of the main sequence.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_poisson_array_kernel(philox4x32_10_device_engine engine,
+                                       unsigned int * data, const size_t n,
+                                       const double * lambdas)
     {
-        uniform_distribution<T> distribution;
-        return generate(data, data_size, distribution);
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            philox4x32_10_device_engine e = engine;
+            e.discard_subsequence(index);
+            rocrand_state_philox4x32_10 * state = &e;
+            data[index] = rocrand_device::detail::poisson_distribution<
+                rocrand_state_philox4x32_10 *>(state, lambdas[index]);
+        }
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    // Keyed bijection on the smallest power-of-even-bits domain covering
+    // [0, n): a balanced Feistel network whose round function is built
+    // from threefry-style add-rotate-xor mixes (rotation constants of
+    // threefry2x32). Being a bijection, it maps distinct indexes to
+    // distinct values, which is what makes sort-free permutation
+    // generation possible.
+    struct feistel_permutation
     {
-        normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
-    }
+        static constexpr unsigned int rounds = 8;
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+        unsigned int half_bits;
+        unsigned int half_mask;
+        unsigned int keys[rounds];
+
+        __forceinline__ __device__ __host__
+        static unsigned int round_function(unsigned int x, unsigned int key)
+        {
+            unsigned int a = x + key;
+            unsigned int b = ::rocrand_device::rotl<unsigned int>(key, 13) ^ a;
+            a += b;
+            b = ::rocrand_device::rotl<unsigned int>(b, 15) ^ a;
+            a += b;
+            b = ::rocrand_device::rotl<unsigned int>(b, 26) ^ a;
+            return a + b;
+        }
+
+        __forceinline__ __device__ __host__
+        unsigned long long operator()(unsigned long long x) const
+        {
+            unsigned int l = static_cast<unsigned int>(x >> half_bits);
+            unsigned int r = static_cast<unsigned int>(x) & half_mask;
+            for(unsigned int k = 0; k < rounds; k++)
+            {
+                const unsigned int f = round_function(r, keys[k]) & half_mask;
+                const unsigned int l_next = r;
+                r = l ^ f;
+                l = l_next;
+            }
+            return (static_cast<unsigned long long>(l) << half_bits) | r;
+        }
+    };
+
+    // Writes the first k values of a random permutation of [0, n)
+    // without sorting (a random permutation itself for k == n, a uniform
+    // sample without replacement for k < n). The Feistel domain is less
+    // than 4n, so indexes whose image falls outside [0, n) walk the
+    // cycle until it lands inside (a handful of steps in expectation);
+    // the walk preserves bijectivity, so no value of [0, n) is written
+    // twice. Each output index computes its image independently and the
+    // stores are coalesced.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_permutation_kernel(feistel_permutation permutation,
+                                     unsigned int * data, const size_t k,
+                                     const size_t n)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t index = thread_id; index < k; index += stride)
+        {
+            unsigned long long x = index;
+            do
+            {
+                x = permutation(x);
+            }
+            while(x >= n);
+            data[index] = static_cast<unsigned int>(x);
+        }
     }
 
-    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    // Fills a Latin hypercube design: dimension d of sample i takes the
+    // value (pi_d(i) + u) / n_samples, where pi_d is a keyed Feistel
+    // permutation of [0, n_samples) with per-dimension round keys and u
+    // is the jitter inside the assigned stratum. Every element computes
+    // its permutation image and draws its jitter independently, so the
+    // design needs no host-side shuffles and the dimension-major stores
+    // are coalesced.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_latin_hypercube_kernel(philox4x32_10_device_engine engine,
+                                         float * data, const size_t n_samples,
+                                         const size_t n_dims,
+                                         const unsigned int * round_keys,
+                                         const unsigned int half_bits,
+                                         const unsigned int half_mask)
     {
-        try
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+        const size_t n = n_samples * n_dims;
+        const float inv_n = 1.0f / n_samples;
+
+        for(size_t index = thread_id; index < n; index += stride)
         {
-            m_poisson.set_lambda(lambda);
+            const size_t dimension = index / n_samples;
+            const size_t sample    = index % n_samples;
+
+            feistel_permutation permutation;
+            permutation.half_bits = half_bits;
+            permutation.half_mask = half_mask;
+            for(unsigned int r = 0; r < feistel_permutation::rounds; r++)
+            {
+                permutation.keys[r]
+                    = round_keys[dimension * feistel_permutation::rounds + r];
+            }
+
+            unsigned long long x = sample;
+            do
+            {
+                x = permutation(x);
+            }
+            while(x >= n_samples);
+
+            philox4x32_10_device_engine e = engine;
+            e.discard(index);
+            const float u = rocrand_device::detail::uniform_distribution(e());
+
+            data[index] = (static_cast<unsigned int>(x) + u) * inv_n;
         }
-        catch(rocrand_status status)
+    }
+
+    // A-ES (Efraimidis-Spirakis) selection keys are non-negative floats
+    // and the IEEE bit patterns of non-negative floats order the same
+    // way the values do, so the k smallest keys can be located on the
+    // bit patterns one byte at a time.
+    __forceinline__ __device__ __host__
+    unsigned int sample_key_bits(float key)
+    {
+        unsigned int bits;
+        __builtin_memcpy(&bits, &key, sizeof(bits));
+        return bits;
+    }
+
+    // Draws the A-ES selection key of every item: an exponential value
+    // at the rate of the item's weight. The k items with the smallest
+    // keys form a weighted sample without replacement. One engine value
+    // per item, but keys are drawn from per-index subsequences to match
+    // the other array entry points (and the host backend).
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void sample_keys_kernel(philox4x32_10_device_engine engine,
+                            unsigned int * keys, const size_t n,
+                            const double * weights)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t index = thread_id; index < n; index += stride)
         {
-            return status;
+            philox4x32_10_device_engine e = engine;
+            e.discard_subsequence(index);
+            rocrand_state_philox4x32_10 * state = &e;
+            keys[index] = sample_key_bits(static_cast<float>(
+                -log(rocrand_uniform_double(state)) / weights[index]));
         }
-        return generate(data, data_size, m_poisson.dis);
     }
 
-private:
-    bool m_engines_initialized;
+    // One byte of the radix walk that locates the k-th smallest key:
+    // counts, among the keys whose already-fixed high bytes match
+    // \p prefix under \p fixed_mask, how many take each of the 256
+    // values of the byte at \p shift. Blocks count in shared memory and
+    // flush once.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void sample_histogram_kernel(const unsigned int * keys, const size_t n,
+                                 const unsigned int fixed_mask,
+                                 const unsigned int prefix,
+                                 const unsigned int shift,
+                                 unsigned long long * histogram)
+    {
+        __shared__ unsigned int block_histogram[256];
+        for(unsigned int bin = threadIdx.x; bin < 256; bin += blockDim.x)
+        {
+            block_histogram[bin] = 0;
+        }
+        __syncthreads();
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            const unsigned int key = keys[index];
+            if(((key ^ prefix) & fixed_mask) == 0)
+            {
+                atomicAdd(&block_histogram[(key >> shift) & 255u], 1u);
+            }
+        }
+        __syncthreads();
+
+        for(unsigned int bin = threadIdx.x; bin < 256; bin += blockDim.x)
+        {
+            if(block_histogram[bin] > 0)
+            {
+                atomicAdd(&histogram[bin],
+                          static_cast<unsigned long long>(block_histogram[bin]));
+            }
+        }
+    }
+
+    // Packs 32 Bernoulli draws into each output word: every bit compares
+    // one engine value against the threshold in-register, so a mask bit
+    // costs 4 bytes of engine state and 1/8 byte of store instead of the
+    // 4 bytes of uniform output plus 1 byte of mask of the
+    // threshold-a-uniform approach. Each word draws from its own
+    // subsequence (32 values, 8 engine rounds), so the packing does not
+    // depend on the grid shape. The unused high bits of a partial last
+    // word are zero.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_bernoulli_packed_kernel(philox4x32_10_device_engine engine,
+                                          unsigned int * data, const size_t n_bits,
+                                          const unsigned long long threshold)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        const size_t n_words = (n_bits + 31) / 32;
+        for(size_t index = thread_id; index < n_words; index += stride)
+        {
+            philox4x32_10_device_engine e = engine;
+            e.discard_subsequence(index);
+
+            const unsigned int word_bits =
+                index == n_words - 1 && n_bits % 32 != 0
+                    ? static_cast<unsigned int>(n_bits % 32)
+                    : 32u;
+            unsigned int word = 0;
+            for(unsigned int b = 0; b < word_bits; b++)
+            {
+                word |= (static_cast<unsigned long long>(e()) < threshold ? 1u : 0u) << b;
+            }
+            data[index] = word;
+        }
+    }
+
+    // Fills many output buffers in a single launch: element j of buffer
+    // b is the engine value at sequence position prefix[b] + j mapped by
+    // the uniform transform, so the buffers hold the same values as
+    // sequential generate_uniform() calls of the same sizes. Each
+    // element binary-searches its buffer in the prefix sums; a batch is
+    // a handful of buffers, so the search stays in cache.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_uniform_batched_kernel(philox4x32_10_device_engine engine,
+                                         float * const * buffers,
+                                         const unsigned long long * prefix,
+                                         const unsigned int n_buffers)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        const unsigned long long total = prefix[n_buffers];
+        for(unsigned long long index = thread_id; index < total; index += stride)
+        {
+            unsigned int lo = 0;
+            unsigned int hi = n_buffers;
+            while(hi - lo > 1)
+            {
+                const unsigned int mid = (lo + hi) / 2;
+                if(prefix[mid] <= index)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+
+            philox4x32_10_device_engine e = engine;
+            e.discard(index);
+            buffers[lo][index - prefix[lo]] =
+                rocrand_device::detail::uniform_distribution(e());
+        }
+    }
+
+    // Raw 32-bit variant of generate_uniform_batched_kernel for
+    // rocrand_generate_batch(): element j of buffer b is the engine
+    // value at sequence position prefix[b] + j unmapped, so the buffers
+    // hold the same values as sequential generate() calls of the same
+    // sizes.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_batch_kernel(philox4x32_10_device_engine engine,
+                               unsigned int * const * buffers,
+                               const unsigned long long * prefix,
+                               const unsigned int n_buffers)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        const unsigned long long total = prefix[n_buffers];
+        for(unsigned long long index = thread_id; index < total; index += stride)
+        {
+            unsigned int lo = 0;
+            unsigned int hi = n_buffers;
+            while(hi - lo > 1)
+            {
+                const unsigned int mid = (lo + hi) / 2;
+                if(prefix[mid] <= index)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+
+            philox4x32_10_device_engine e = engine;
+            e.discard(index);
+            buffers[lo][index - prefix[lo]] = e();
+        }
+    }
+
+    // Emits the indexes of the selected items: every key strictly below
+    // the k-th smallest (the threshold), plus as many keys equal to it
+    // as the selection still needs. counters[0] assigns output slots,
+    // counters[1] rations the threshold ties; the output order is the
+    // order the atomics resolve in and carries no meaning.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void sample_select_kernel(const unsigned int * keys, const size_t n,
+                              const unsigned int threshold,
+                              const unsigned long long threshold_count,
+                              unsigned long long * counters,
+                              unsigned int * data)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            const unsigned int key = keys[index];
+            if(key < threshold)
+            {
+                data[atomicAdd(&counters[0], 1ull)]
+                    = static_cast<unsigned int>(index);
+            }
+            else if(key == threshold
+                    && atomicAdd(&counters[1], 1ull) < threshold_count)
+            {
+                data[atomicAdd(&counters[0], 1ull)]
+                    = static_cast<unsigned int>(index);
+            }
+        }
+    }
+
+    // Runs the engine loop of a uniform float fill but folds the values
+    // into their first four power sums instead of storing them. Each
+    // wavefront reduces its partial sums with shuffles and only the
+    // leading lane touches the global accumulators, so the kernel does
+    // no global stores besides the four doubles. The reduced multiset
+    // is exactly the first n values of the sequence, the same values a
+    // generate_uniform() call of size n would write.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void statistics_kernel(philox4x32_10_device_engine engine,
+                           const size_t n,
+                           double * sums)
+    {
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        const unsigned int tail_size = n % 4;
+        const size_t vec_n = n / 4;
+
+        engine.discard(4 * thread_id);
+
+        double s1 = 0.0;
+        double s2 = 0.0;
+        double s3 = 0.0;
+        double s4 = 0.0;
+
+        size_t index = thread_id;
+        while(index < vec_n)
+        {
+            const uint4 v = engine.next4_leap(stride);
+            const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+            for(unsigned int s = 0; s < 4; s++)
+            {
+                const double x = rocrand_device::detail::uniform_distribution(vs[s]);
+                const double xx = x * x;
+                s1 += x;
+                s2 += xx;
+                s3 += xx * x;
+                s4 += xx * xx;
+            }
+            index += stride;
+        }
+
+        // The thread whose position reached the end accumulates the
+        // values that do not fill a whole quad
+        if(index == vec_n && tail_size > 0)
+        {
+            for(unsigned int s = 0; s < tail_size; s++)
+            {
+                const double x = rocrand_device::detail::uniform_distribution(engine());
+                const double xx = x * x;
+                s1 += x;
+                s2 += xx;
+                s3 += xx * x;
+                s4 += xx * xx;
+            }
+        }
+
+        for(unsigned int offset = warpSize >> 1; offset > 0; offset >>= 1)
+        {
+            s1 += __shfl_down(s1, offset);
+            s2 += __shfl_down(s2, offset);
+            s3 += __shfl_down(s3, offset);
+            s4 += __shfl_down(s4, offset);
+        }
+        if((threadIdx.x & (warpSize - 1)) == 0)
+        {
+            atomicAdd(&sums[0], s1);
+            atomicAdd(&sums[1], s2);
+            atomicAdd(&sums[2], s3);
+            atomicAdd(&sums[3], s4);
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
+    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+
+    rocrand_philox4x32_10(unsigned long long seed   = 0,
+                          unsigned long long offset = 0,
+                          rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                          hipStream_t        stream = 0,
+                          bool               host_generation = false)
+        : base_type(order, seed, offset, stream)
+        , m_engines_initialized(false)
+        , m_dynamic_blocks(0)
+        , m_concurrent(false)
+        , m_host(host_generation)
+        , m_claimed(0)
+        , m_remainder(NULL)
+        , m_remainder_tag(NULL)
+        , m_remainder_count(0)
+        , m_remainder_offset(0)
+        , m_batch_capacity(0)
+        , m_batch_descriptors(NULL)
+        , m_staging(NULL)
+        , m_blocks(s_blocks)
+        , m_resident(false)
+        , m_resident_engines(NULL)
+    {
+        // A tuned entry for this architecture overrides the compiled
+        // grid; the values do not depend on the grid shape, so any
+        // block count is valid, but the thread count is a scheduling
+        // invariant and entries changing it are ignored
+        rocrand_host::detail::tuning_entry tuned;
+        if(rocrand_host::detail::tuning_table::instance().lookup("philox4x32_10", &tuned)
+           && tuned.threads == s_threads)
+        {
+            m_blocks = tuned.blocks;
+        }
+    }
+
+    ~rocrand_philox4x32_10()
+    {
+        if(m_remainder != NULL)
+        {
+            rocrand_host::detail::device_free(m_remainder);
+        }
+        if(m_batch_descriptors != NULL)
+        {
+            rocrand_host::detail::device_free(m_batch_descriptors);
+        }
+        if(m_staging != NULL)
+        {
+            rocrand_host::detail::device_free(m_staging);
+        }
+        if(m_resident_engines != NULL)
+        {
+            rocrand_host::detail::device_free(m_resident_engines);
+        }
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    // Advances the sequence by \p n values from the current position
+    // with a constant-cost counter skip
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard(n);
+        // The banked values precede the new position
+        m_remainder_count = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Advances the sequence by \p n subsequences from the current
+    // position. Subsequences are 2^66 values apart, so generators
+    // placed on distinct subsequences cannot overlap
+    rocrand_status skip_ahead_subsequence(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard_subsequence(n);
+        m_remainder_count = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with one value per element of \p seeds: value i is
+    // drawn from the stream that seeds[i] keys, positioned at the
+    // generator's offset, so it depends only on seeds[i] and is stable
+    // under reordering of the elements. Generator state is not consumed
+    // (see seeded.hpp).
+    rocrand_status generate_seeded(unsigned int * data, size_t data_size,
+                                   const unsigned long long * seeds)
+    {
+        return rocrand_host::detail::generate_seeded<engine_type>(
+            seeds, data, data_size, m_offset, m_stream);
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order               = order;
+        m_engines_initialized = false;
+    }
+
+    // Enables or disables concurrent generation. While enabled,
+    // generate() calls from different threads claim disjoint ranges of
+    // the sequence with an atomic counter instead of advancing the
+    // shared engine, so the union of their outputs is the prefix of the
+    // sequence a single thread would produce. Disabling folds the
+    // claimed ranges back into the engine, so sequential generation
+    // continues where the concurrent fills ended.
+    rocrand_status set_concurrent_generation(bool enabled)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_concurrent && !enabled)
+        {
+            m_engine.discard(m_claimed.load());
+        }
+        m_claimed.store(0);
+        m_remainder_count = 0;
+        m_concurrent = enabled;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with \p data_size values of the sequence the seed
+    // and offset configure, starting at absolute position \p offset,
+    // without consuming generator state: the fill's engine is
+    // positioned with a constant-cost counter skip and dropped after
+    // the launch. Calls are therefore independent of previous generate
+    // calls and of each other, so host threads can fill disjoint
+    // regions of one logical sequence concurrently and a failed fill
+    // can simply be retried (see rocrand_generate_at). \p offset must
+    // fall on an application boundary of the distribution; for the
+    // default uniform distribution every offset qualifies. Statistics
+    // are skipped like in concurrent mode because the calls may come
+    // from several threads.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(unsigned long long offset, T * data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(offset % Distribution::output_width != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Positioned from the configured start of the sequence, not
+        // from the current engine position, so the call is idempotent
+        engine_type engine{m_seed, 0, m_offset};
+        engine.discard(offset / Distribution::output_width * Distribution::input_width);
+
+        if(m_host)
+        {
+            return generate_host_from(engine, data, data_size, distribution);
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+            engine, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_engine = engine_type{m_seed, 0, m_offset};
+        m_remainder_count = 0;
+
+        // Allocated up front so that initialized generate() calls stay
+        // allocation-free (required to capture fills into a hipGraph);
+        // banking is simply skipped if the allocation failed
+        if(!m_host)
+        {
+            remainder_buffer();
+        }
+
+        if(rocrand_host::detail::uses_device_occupancy(m_order) && m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            m_dynamic_blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type, unsigned int *, const size_t,
+                                     uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<unsigned int,
+                                                          uniform_distribution<unsigned int>>),
+                s_threads);
+            if(m_dynamic_blocks == 0)
+            {
+                m_dynamic_blocks = m_blocks;
+            }
+        }
+
+        // Seed, offset and ordering changes reach here with the flag
+        // cleared, so the resident states follow them
+        if(m_resident)
+        {
+            const rocrand_status status = init_resident_engines();
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Enables or disables resident engine states. While enabled,
+    // per-thread engine states live in device memory (as mt19937 keeps
+    // them) and generate() advances them in place, so repeated small
+    // fills carry only a pointer into the kernel and replay no discard
+    // on the host. Each resident thread draws from its own subsequence,
+    // so the mode changes which values a fill receives, and the
+    // by-value engine on subsequence 0 is not advanced by resident
+    // fills: disabling the mode resumes the regular sequence where it
+    // was left.
+    rocrand_status set_resident_states(bool enabled)
+    {
+        if(enabled == m_resident)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(!enabled)
+        {
+            m_resident = false;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        if(m_resident_engines == NULL)
+        {
+            if(rocrand_host::detail::device_malloc(
+                   reinterpret_cast<void**>(&m_resident_engines),
+                   s_resident_blocks * s_threads * sizeof(engine_type))
+               != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+        }
+        const rocrand_status status = init_resident_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        // Banked tail values belong to the by-value sequence
+        m_remainder_count = 0;
+        m_resident        = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_host)
+        {
+            return generate_host(data, data_size, distribution);
+        }
+
+        // The kernels take any device-accessible destination: pinned
+        // host and managed allocations are written directly through
+        // their device-visible mapping, so host-bound output needs no
+        // scratch buffer and copy out (the kernels' coalesced streaming
+        // stores never read the destination, which suits the
+        // write-combined host window). Destinations the runtime does
+        // not know are pageable host memory that device code cannot
+        // access; those fills are staged through a cached device buffer
+        // with one copy out per chunk.
+        {
+            void * const view = device_destination(data);
+            if(view == NULL)
+            {
+                return generate_to_host(data, data_size, distribution);
+            }
+            data = static_cast<T *>(view);
+        }
+
+        // Resident mode advances the per-thread engines in device
+        // memory, so the call is a single launch without state
+        // marshaling or sequence bookkeeping. Concurrent mode and the
+        // index-mapped ordering define their output in terms of the
+        // by-value sequence, so they keep the regular path.
+        if(m_resident && !m_concurrent
+           && m_order != ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            return generate_resident(data, data_size, distribution);
+        }
+
+        // Fills past s_chunk_size_bytes split into sub-launches with
+        // exact sequence continuation (see generate_chunked), so no
+        // single kernel runs long enough to trip a device watchdog on
+        // shared nodes
+        if(data_size > s_chunk_size_bytes / sizeof(T))
+        {
+            return generate_chunked(data, data_size, distribution);
+        }
+
+        // Banking needs exclusive sequence accounting and per-call
+        // engine positions, which concurrent mode and the index-mapped
+        // ordering do not provide
+        const bool bankable = !m_concurrent
+            && m_order != ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT;
+
+        if(bankable && m_remainder_count > 0)
+        {
+            if(m_remainder_tag == remainder_tag<T, Distribution>())
+            {
+                // The banked values of the previous call's last
+                // application precede the engine position, so they come
+                // first
+                const size_t take = std::min<size_t>(m_remainder_count, data_size);
+                const T * remainder =
+                    reinterpret_cast<const T *>(m_remainder) + m_remainder_offset;
+                if(hipMemcpyAsync(data, remainder, take * sizeof(T),
+                                  hipMemcpyDeviceToDevice, m_stream) != hipSuccess)
+                {
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                m_remainder_count -= static_cast<unsigned int>(take);
+                m_remainder_offset += static_cast<unsigned int>(take);
+                data += take;
+                data_size -= take;
+                if(data_size == 0)
+                {
+                    return ROCRAND_STATUS_SUCCESS;
+                }
+            }
+            else
+            {
+                // A different distribution cannot consume the banked
+                // values; drop them like the kernels used to
+                m_remainder_count = 0;
+            }
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators =
+            (data_size + Distribution::output_width - 1) /
+            Distribution::output_width * Distribution::input_width;
+
+        // In concurrent mode each call claims its range of the sequence
+        // up front and leaves the shared engine untouched; statistics
+        // are skipped because their event pool is not thread-safe
+        engine_type engine = m_engine;
+        if(m_concurrent)
+        {
+            engine.discard(m_claimed.fetch_add(num_applied_generators));
+        }
+        else
+        {
+            statistics.begin_launch(m_stream);
+        }
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            // The index-mapped kernel ties every output index to a fixed
+            // sequence position, so the grid only has to cover the fill
+            const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                (data_size + s_threads - 1) / s_threads, launch_blocks(data_size)));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        else if(data_size * sizeof(T) <= s_small_size_bytes)
+        {
+            // For launch-latency-bound fills a few waves without the
+            // vectorization machinery beat the full grid
+            const uint32_t blocks = static_cast<uint32_t>(
+                std::min<size_t>((data_size + s_threads - 1) / s_threads, s_small_blocks));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(!m_concurrent)
+        {
+            statistics.end_launch(data_size * sizeof(T), m_stream);
+
+            // Bank the values of the last application that the fill did
+            // not consume; the engine advance below skips past them, so
+            // the next call reads them from the buffer instead of
+            // regenerating the whole application
+            const unsigned int used =
+                static_cast<unsigned int>(data_size % Distribution::output_width);
+            if(bankable && used != 0 && remainder_buffer() != NULL)
+            {
+                engine_type tail_engine = engine;
+                tail_engine.discard(num_applied_generators - Distribution::input_width);
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_remainder_kernel),
+                    dim3(1), dim3(1), 0, m_stream,
+                    tail_engine, reinterpret_cast<T *>(m_remainder), used, distribution
+                );
+                if(hipGetLastError() == hipSuccess)
+                {
+                    m_remainder_tag = remainder_tag<T, Distribution>();
+                    m_remainder_count = Distribution::output_width - used;
+                    m_remainder_offset = 0;
+                }
+            }
+
+            m_engine.discard(num_applied_generators);
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+
+    // Fills num_streams contiguous extents of the output with one
+    // launch per extent on the corresponding caller stream, each
+    // launch's engine skipped to the exact sequence position of its
+    // extent. The extents hold the same values as num_streams
+    // sequential generate() calls of the same sizes, and the
+    // generator's own stream waits on all of them, so work queued on it
+    // afterwards sees the whole fill.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_partitioned(T * data, size_t data_size,
+                                        const hipStream_t * streams,
+                                        unsigned int num_streams,
+                                        Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        // Extents split on application boundaries, so every launch
+        // starts at an exact engine position
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+        const hipStream_t stream = m_stream;
+        size_t app_start = 0;
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            const size_t apps = applications / num_streams
+                                + (k < applications % num_streams ? 1 : 0);
+            if(apps == 0)
+            {
+                break;
+            }
+            const size_t start = app_start * output_width;
+            const size_t count = std::min<size_t>(apps * output_width, data_size - start);
+            m_stream = streams[k];
+            const rocrand_status status = generate(data + start, count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_stream = stream;
+                return status;
+            }
+            app_start += apps;
+        }
+        m_stream = stream;
+
+        // Join the extents into the generator's stream
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            hipEvent_t event;
+            if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            if(hipEventRecord(event, streams[k]) != hipSuccess
+               || hipStreamWaitEvent(m_stream, event, 0) != hipSuccess)
+            {
+                hipEventDestroy(event);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipEventDestroy(event);
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Fills \p n_buffers output buffers with uniformly distributed
+    /// floats in a single launch; buffer \p b receives
+    /// <tt>sizes[b]</tt> values. The buffers hold the same values as
+    /// sequential generate_uniform() calls of the same sizes, so a
+    /// caller batching many small fills pays one call and one launch
+    /// instead of one of each per buffer.
+    rocrand_status generate_uniform_batched(float * const * buffers,
+                                            const size_t * sizes,
+                                            unsigned int n_buffers)
+    {
+        if(buffers == NULL || sizes == NULL || n_buffers == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        std::vector<unsigned long long> prefix(n_buffers + 1);
+        prefix[0] = 0;
+        for(unsigned int b = 0; b < n_buffers; b++)
+        {
+            prefix[b + 1] = prefix[b] + sizes[b];
+        }
+        const unsigned long long total = prefix[n_buffers];
+        if(total == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_host)
+        {
+            const engine_type start_engine = m_engine;
+            for(unsigned int b = 0; b < n_buffers; b++)
+            {
+                float * buffer = buffers[b];
+                const unsigned long long offset = prefix[b];
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+                for(size_t j = 0; j < sizes[b]; j++)
+                {
+                    engine_type engine = start_engine;
+                    engine.discard(offset + j);
+                    buffer[j] = rocrand_device::detail::uniform_distribution(engine());
+                }
+            }
+            m_engine.discard(total);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // One descriptor upload per call; the device copy is cached on
+        // the generator and grown on demand
+        const size_t pointers_bytes = sizeof(float *) * n_buffers;
+        const size_t prefix_bytes = sizeof(unsigned long long) * (n_buffers + 1);
+        if(m_batch_capacity < n_buffers)
+        {
+            void * descriptors;
+            if(rocrand_host::detail::device_malloc(&descriptors, pointers_bytes + prefix_bytes) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_batch_descriptors);
+            m_batch_descriptors = descriptors;
+            m_batch_capacity = n_buffers;
+            statistics.count_reallocation();
+        }
+        float ** buffers_device = reinterpret_cast<float **>(m_batch_descriptors);
+        unsigned long long * prefix_device = reinterpret_cast<unsigned long long *>(
+            reinterpret_cast<char *>(m_batch_descriptors) + pointers_bytes);
+        if(hipMemcpy(buffers_device, buffers, pointers_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess
+           || hipMemcpy(prefix_device, prefix.data(), prefix_bytes,
+                        hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_uniform_batched_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, buffers_device, prefix_device, n_buffers
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(total * sizeof(float), m_stream);
+
+        m_engine.discard(total);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p n_buffers output buffers with raw 32-bit values in a
+    /// single launch; buffer \p b receives <tt>sizes[b]</tt> values.
+    /// The buffers hold the same values as sequential generate() calls
+    /// of the same sizes, so a caller batching many small fills pays
+    /// one call and one launch instead of one of each per buffer.
+    rocrand_status generate_batch(unsigned int * const * buffers,
+                                  const size_t * sizes,
+                                  unsigned int n_buffers)
+    {
+        if(buffers == NULL || sizes == NULL || n_buffers == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        std::vector<unsigned long long> prefix(n_buffers + 1);
+        prefix[0] = 0;
+        for(unsigned int b = 0; b < n_buffers; b++)
+        {
+            if(buffers[b] == NULL && sizes[b] > 0)
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            prefix[b + 1] = prefix[b] + sizes[b];
+        }
+        const unsigned long long total = prefix[n_buffers];
+        if(total == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_host)
+        {
+            const engine_type start_engine = m_engine;
+            for(unsigned int b = 0; b < n_buffers; b++)
+            {
+                unsigned int * buffer = buffers[b];
+                const unsigned long long offset = prefix[b];
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+                for(size_t j = 0; j < sizes[b]; j++)
+                {
+                    engine_type engine = start_engine;
+                    engine.discard(offset + j);
+                    buffer[j] = engine();
+                }
+            }
+            m_engine.discard(total);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // One descriptor upload per call; the device copy is cached on
+        // the generator and grown on demand, shared with the uniform
+        // batched path
+        const size_t pointers_bytes = sizeof(unsigned int *) * n_buffers;
+        const size_t prefix_bytes = sizeof(unsigned long long) * (n_buffers + 1);
+        if(m_batch_capacity < n_buffers)
+        {
+            void * descriptors;
+            if(rocrand_host::detail::device_malloc(&descriptors, pointers_bytes + prefix_bytes) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_batch_descriptors);
+            m_batch_descriptors = descriptors;
+            m_batch_capacity = n_buffers;
+            statistics.count_reallocation();
+        }
+        unsigned int ** buffers_device = reinterpret_cast<unsigned int **>(m_batch_descriptors);
+        unsigned long long * prefix_device = reinterpret_cast<unsigned long long *>(
+            reinterpret_cast<char *>(m_batch_descriptors) + pointers_bytes);
+        if(hipMemcpy(buffers_device, buffers, pointers_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess
+           || hipMemcpy(prefix_device, prefix.data(), prefix_bytes,
+                        hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_batch_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, buffers_device, prefix_device, n_buffers
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(total * sizeof(unsigned int), m_stream);
+
+        m_engine.discard(total);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Runs the generation loop of a uniform float fill of size \p n
+    /// but reduces the values into their first four moments on the
+    /// device, so a validation pass needs no n-element buffer at all.
+    /// Consumes the sequence exactly like generate_uniform() of the
+    /// same size.
+    rocrand_status generate_statistics(size_t n, rocrand_moments * moments)
+    {
+        if(moments == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        moments->mean = 0.0;
+        moments->variance = 0.0;
+        moments->skewness = 0.0;
+        moments->kurtosis = 0.0;
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        double host_sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+        if(m_host)
+        {
+            const engine_type start_engine = m_engine;
+            double s1 = 0.0;
+            double s2 = 0.0;
+            double s3 = 0.0;
+            double s4 = 0.0;
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) reduction(+ : s1, s2, s3, s4)
+#endif
+            for(size_t index = 0; index < n; index++)
+            {
+                engine_type engine = start_engine;
+                engine.discard(index);
+                const double x = rocrand_device::detail::uniform_distribution(engine());
+                const double xx = x * x;
+                s1 += x;
+                s2 += xx;
+                s3 += xx * x;
+                s4 += xx * xx;
+            }
+            m_engine.discard(n);
+            host_sums[0] = s1;
+            host_sums[1] = s2;
+            host_sums[2] = s3;
+            host_sums[3] = s4;
+        }
+        else
+        {
+            double * sums;
+            if(rocrand_host::detail::device_malloc(
+                   reinterpret_cast<void **>(&sums), 4 * sizeof(double)) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipMemsetAsync(sums, 0, 4 * sizeof(double), m_stream) != hipSuccess)
+            {
+                rocrand_host::detail::device_free(sums);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+
+            // Claim the range of the sequence like generate() does
+            engine_type engine = m_engine;
+            if(m_concurrent)
+            {
+                engine.discard(m_claimed.fetch_add(n));
+            }
+            else
+            {
+                statistics.begin_launch(m_stream);
+            }
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::statistics_kernel),
+                dim3(launch_blocks(n)), dim3(s_threads), 0, m_stream,
+                engine, n, sums
+            );
+            // Check kernel status
+            if(launch_failed())
+            {
+                rocrand_host::detail::device_free(sums);
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+
+            if(!m_concurrent)
+            {
+                // No buffer is written; only the launch is recorded
+                statistics.end_launch(0, m_stream);
+                m_engine.discard(n);
+            }
+
+            if(hipMemcpy(host_sums, sums, 4 * sizeof(double),
+                         hipMemcpyDeviceToHost) != hipSuccess)
+            {
+                rocrand_host::detail::device_free(sums);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            rocrand_host::detail::device_free(sums);
+        }
+
+        const double inv_n = 1.0 / static_cast<double>(n);
+        const double m1 = host_sums[0] * inv_n;
+        const double r2 = host_sums[1] * inv_n;
+        const double r3 = host_sums[2] * inv_n;
+        const double r4 = host_sums[3] * inv_n;
+        const double m2 = r2 - m1 * m1;
+        const double m3 = r3 - 3.0 * m1 * r2 + 2.0 * m1 * m1 * m1;
+        const double m4 = r4 - 4.0 * m1 * r3 + 6.0 * m1 * m1 * r2
+            - 3.0 * m1 * m1 * m1 * m1;
+
+        moments->mean = m1;
+        moments->variance = m2;
+        if(m2 > 0.0)
+        {
+            moments->skewness = m3 / (m2 * std::sqrt(m2));
+            moments->kurtosis = m4 / (m2 * m2);
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Fills the payload of a column-major \p rows x \p cols matrix with
+    /// leading dimension \p pitch (in elements, >= \p rows) with normal
+    /// values, leaving the padding between the columns untouched. Element
+    /// (i, j) receives the value its dense index j * rows + i receives
+    /// from an index-mapped fill of \p rows * \p cols values, and the
+    /// sequence advances exactly as that fill would, so pitched and
+    /// dense calls can be mixed freely.
+    template<class T>
+    rocrand_status generate_normal_2d(T * data, size_t rows, size_t cols,
+                                      size_t pitch, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate_2d(data, rows, cols, pitch, distribution);
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_2d(T * data, size_t rows, size_t cols,
+                               size_t pitch, Distribution distribution)
+    {
+        if(pitch < rows)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        // Without padding the dense path keeps its vectorized stores
+        // and remainder banking
+        if(pitch == rows)
+            return generate(data, rows * cols, distribution);
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const size_t data_size = rows * cols;
+        if(data_size == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // The pitched fill starts at the current engine position, so
+        // values banked before it would be returned out of sequence
+        // order by a later dense call; drop them
+        m_remainder_count = 0;
+
+        if(m_host)
+        {
+            return generate_2d_host(data, rows, cols, pitch, distribution);
+        }
+
+        const auto num_applied_generators =
+            (data_size + Distribution::output_width - 1) /
+            Distribution::output_width * Distribution::input_width;
+
+        engine_type engine = m_engine;
+        if(m_concurrent)
+        {
+            engine.discard(m_claimed.fetch_add(num_applied_generators));
+        }
+
+        // The kernel is index-mapped, so the grid only has to cover the
+        // fill
+        const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+            (data_size + s_threads - 1) / s_threads, launch_blocks(data_size)));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_2d_kernel),
+            dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+            engine, data, rows, cols, pitch, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(!m_concurrent)
+        {
+            m_engine.discard(num_applied_generators);
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p n_vectors correlated normal vectors of \p dim elements
+    /// each; \p cholesky_factor is a row-major lower triangular dim x dim
+    /// matrix in device memory. Supported for dimensions up to 32.
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dim,
+                                                const float * cholesky_factor)
+    {
+        if(dim == 0 || dim > s_max_mvn_dim)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, data, n_vectors, dim, cholesky_factor
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engine.discard(n_vectors * ((dim + 1) & ~1u));
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates \p n_vectors Dirichlet(alpha) vectors of \p k components
+    /// each, stored contiguously; \p alphas is a device array of \p k
+    /// positive concentration parameters. Supported for dimensions up
+    /// to 32.
+    rocrand_status generate_dirichlet(float * data, size_t n_vectors,
+                                      unsigned int k, const float * alphas)
+    {
+        if(k == 0 || k > s_max_dirichlet_dim)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_dirichlet_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, data, n_vectors, k, alphas
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Two engine values per gamma draw, k draws per vector
+        m_engine.discard(n_vectors * 2 * k);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with a Latin hypercube design of \p n_samples
+    /// samples in \p n_dims dimensions, stored dimension major
+    /// (dimension d occupies data[d * n_samples] onward). Every
+    /// dimension assigns its samples an independent random permutation
+    /// of the n_samples strata with a uniform jitter inside each
+    /// stratum, so each one-dimensional projection hits every stratum
+    /// exactly once. The permutations are keyed Feistel bijections like
+    /// generate_permutation(), so no shuffle or sort runs anywhere.
+    rocrand_status generate_latin_hypercube(float * data, size_t n_samples,
+                                            size_t n_dims)
+    {
+        // Stratum indexes pass through the 32-bit-value Feistel domain
+        if(n_samples > (1ull << 32) || n_dims == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(n_samples == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        unsigned int total_bits = 1;
+        while((1ull << total_bits) < static_cast<unsigned long long>(n_samples))
+        {
+            total_bits++;
+        }
+        const unsigned int half_bits = (total_bits + 1) / 2;
+        const unsigned int half_mask =
+            static_cast<unsigned int>((1ull << half_bits) - 1);
+
+        // Per-dimension round keys come off the main sequence like the
+        // permutation entry points, so the design is reproducible per
+        // seed and fresh per call
+        constexpr unsigned int rounds =
+            rocrand_host::detail::feistel_permutation::rounds;
+        std::vector<unsigned int> host_keys(n_dims * rounds);
+        for(size_t i = 0; i < host_keys.size(); i++)
+        {
+            host_keys[i] = m_engine();
+        }
+
+        // The jitter fill starts at the engine position the keys left
+        // behind; values banked before it would come back out of order
+        m_remainder_count = 0;
+
+        const engine_type jitter_engine = m_engine;
+        m_engine.discard(n_samples * n_dims);
+
+        if(m_host)
+        {
+            return generate_latin_hypercube_host(data, n_samples, n_dims,
+                                                 host_keys.data(), half_bits,
+                                                 half_mask, jitter_engine);
+        }
+
+        unsigned int * keys;
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&keys),
+                     host_keys.size() * sizeof(unsigned int)) != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipMemcpy(keys, host_keys.data(),
+                     host_keys.size() * sizeof(unsigned int),
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            rocrand_host::detail::device_free(keys);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_latin_hypercube_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            jitter_engine, data, n_samples, n_dims, keys, half_bits, half_mask
+        );
+        // Check kernel status
+        if(launch_failed())
+        {
+            rocrand_host::detail::device_free(keys);
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        // hipFree synchronizes with the device, so the scratch keys stay
+        // alive until the kernel has read them
+        rocrand_host::detail::device_free(keys);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    /// Generates \p data_size Poisson-distributed values whose rates are
+    /// read per element from \p lambdas, a device array of \p data_size
+    /// doubles; heterogeneous-rate workloads take one launch instead of
+    /// one call per rate.
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size,
+                                    const double * lambdas)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_host)
+        {
+            return generate_poisson_array_host(data, data_size, lambdas);
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, data, data_size, lambdas
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Move the main sequence past every subsequence the fill used
+        m_engine.discard_subsequence(data_size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Writes a random permutation of the integers [0, \p n) to \p data
+    /// in one pass, with no sort; the permutation is keyed off the main
+    /// sequence, so it is reproducible per seed and fresh per call.
+    rocrand_status generate_permutation(unsigned int * data, size_t n)
+    {
+        // Values are written as 32-bit integers
+        if(n > (1ull << 32))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        return generate_permutation_prefix(data, n, n);
+    }
+
+    /// Writes the indexes of \p k items drawn without replacement from
+    /// [0, \p n) to \p data. With \p weights NULL the sample is uniform
+    /// and costs O(k) work: the first \p k values of a keyed Feistel
+    /// permutation of [0, n). With \p weights pointing at \p n positive
+    /// doubles the sample follows the A-ES scheme of Efraimidis and
+    /// Spirakis: every item draws an exponential key at its weight's
+    /// rate, the k smallest keys win, and the k-th smallest key is
+    /// located with a byte-wise radix walk over the key buffer, so
+    /// nothing is sorted and the candidate set never leaves the device.
+    /// The output order carries no meaning.
+    rocrand_status sample_without_replacement(unsigned int * data, size_t k,
+                                              size_t n, const double * weights)
+    {
+        // Indexes are written as 32-bit integers
+        if(k > n || n > (1ull << 32))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(weights == NULL)
+        {
+            return generate_permutation_prefix(data, k, n);
+        }
+
+        if(m_host)
+        {
+            return sample_without_replacement_host(data, k, n, weights);
+        }
+
+        unsigned int * keys;
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&keys),
+                     n * sizeof(unsigned int)) != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        unsigned long long * counters;
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&counters),
+                     256 * sizeof(unsigned long long)) != hipSuccess)
+        {
+            (void)rocrand_host::detail::device_free(keys);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        status = sample_without_replacement_device(data, k, n, weights,
+                                                   keys, counters);
+        (void)rocrand_host::detail::device_free(counters);
+        (void)rocrand_host::detail::device_free(keys);
+        return status;
+    }
+
+    /// Packs \p n_bits Bernoulli draws of probability \p p into
+    /// \p data, 32 mask bits per word, the unused high bits of a
+    /// partial last word zero. Bit \p i of the mask is
+    /// <tt>data[i / 32] >> (i % 32) & 1</tt>.
+    rocrand_status generate_bernoulli_packed(unsigned int * data, size_t n_bits,
+                                             float p)
+    {
+        if(!(p >= 0.0f && p <= 1.0f))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(n_bits == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // 2^32 for p == 1, so the comparison is exact over the whole
+        // 32-bit range of an engine value
+        const unsigned long long threshold = static_cast<unsigned long long>(
+            static_cast<double>(p) * 4294967296.0);
+        const size_t n_words = (n_bits + 31) / 32;
+
+        if(m_host)
+        {
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+            for(size_t index = 0; index < n_words; index++)
+            {
+                engine_type engine = m_engine;
+                engine.discard_subsequence(index);
+
+                const unsigned int word_bits =
+                    index == n_words - 1 && n_bits % 32 != 0
+                        ? static_cast<unsigned int>(n_bits % 32)
+                        : 32u;
+                unsigned int word = 0;
+                for(unsigned int b = 0; b < word_bits; b++)
+                {
+                    word |= (static_cast<unsigned long long>(engine()) < threshold
+                                 ? 1u : 0u) << b;
+                }
+                data[index] = word;
+            }
+            m_engine.discard_subsequence(n_words);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_bernoulli_packed_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, data, n_bits, threshold
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Move the main sequence past every subsequence the fill used
+        m_engine.discard_subsequence(n_words);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Grid size of the next launch. The engine is counter-based, so the
+    // generated sequence does not depend on the grid; under
+    // ROCRAND_ORDERING_PSEUDO_DYNAMIC and ROCRAND_ORDERING_PSEUDO_FASTEST
+    // the grid follows the device's
+    // occupancy and shrinks for fills that can't fill it.
+    // (Re)derives the resident engines from the seed and offset
+    rocrand_status init_resident_engines()
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_resident_engines_kernel),
+            dim3(s_resident_blocks), dim3(s_threads), 0, m_stream,
+            m_resident_engines, m_seed, m_offset
+        );
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_resident(T * data, size_t data_size,
+                                     Distribution distribution)
+    {
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_resident_kernel),
+            dim3(s_resident_blocks), dim3(s_threads), 0, m_stream,
+            m_resident_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    uint32_t launch_blocks(size_t data_size) const
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order) || m_dynamic_blocks == 0)
+        {
+            return m_blocks;
+        }
+        const size_t needed_blocks = (data_size + s_threads - 1) / s_threads;
+        return static_cast<uint32_t>(
+            std::min<size_t>(m_dynamic_blocks, std::max<size_t>(needed_blocks, 1)));
+    }
+
+    // Splits a fill larger than s_chunk_size_bytes into sub-launches on
+    // application boundaries with exact sequence continuation, so a
+    // multi-terabyte request writes the same values as one launch
+    // would. Managed-memory destinations are prefetched chunk by chunk
+    // on the generator's stream, so the kernels do not fault the pages
+    // in one at a time. In concurrent mode the whole fill is claimed up
+    // front, which keeps it one contiguous range of the sequence even
+    // when other threads claim between the sub-launches.
+    template<class T, class Distribution>
+    rocrand_status generate_chunked(T * data, size_t data_size, Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        // Chunks are multiples of the output width, so every sub-launch
+        // starts at an exact engine position
+        const size_t chunk =
+            s_chunk_size_bytes / sizeof(T) / output_width * output_width;
+
+        bool managed = false;
+        int device = 0;
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, data) == hipSuccess)
+        {
+            managed = attributes.isManaged != 0;
+            device = attributes.device;
+        }
+        else
+        {
+            // Clear the error the query leaves for pointers the runtime
+            // does not know
+            (void)hipGetLastError();
+        }
+
+        if(m_concurrent)
+        {
+            const size_t applications =
+                (data_size + output_width - 1) / output_width;
+            engine_type engine = m_engine;
+            engine.discard(m_claimed.fetch_add(applications * input_width));
+
+            size_t start = 0;
+            while(start < data_size)
+            {
+                const size_t count = std::min<size_t>(chunk, data_size - start);
+                if(managed)
+                {
+                    (void)hipMemPrefetchAsync(data + start, count * sizeof(T),
+                                              device, m_stream);
+                }
+                if(m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+                {
+                    const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                        (count + s_threads - 1) / s_threads, launch_blocks(count)));
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                        dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+                        engine, data + start, count, distribution
+                    );
+                }
+                else
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                        dim3(launch_blocks(count)), dim3(s_threads), 0, m_stream,
+                        engine, data + start, count, distribution
+                    );
+                }
+                // Check kernel status
+                if(launch_failed())
+                    return ROCRAND_STATUS_LAUNCH_FAILURE;
+                engine.discard(count / output_width * input_width);
+                start += count;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Sequential chunks go through generate(), so banking and the
+        // engine advance work exactly as for separate calls
+        size_t start = 0;
+        while(start < data_size)
+        {
+            const size_t count = std::min<size_t>(chunk, data_size - start);
+            if(managed)
+            {
+                (void)hipMemPrefetchAsync(data + start, count * sizeof(T),
+                                          device, m_stream);
+            }
+            const rocrand_status status = generate(data + start, count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            start += count;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Returns the pointer the kernels should write for a destination:
+    // the destination itself for device and managed memory, the
+    // device-visible mapping for pinned host memory, and NULL when the
+    // runtime does not know the pointer (pageable host memory). The
+    // query is a runtime hash lookup, far below the cost of a launch.
+    static void * device_destination(void * data)
+    {
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, data) != hipSuccess)
+        {
+            // Clear the error the query leaves for pointers the runtime
+            // does not know
+            (void)hipGetLastError();
+            return NULL;
+        }
+        // Set for device and managed memory and for pinned host memory
+        // mapped into the device address space; hipHostMalloc maps by
+        // default
+        return attributes.devicePointer;
+    }
+
+    // Fills a pageable host destination through a cached device staging
+    // buffer, chunk by chunk. Each chunk delegates to generate(), so
+    // banking and the engine advance make the values exactly those of a
+    // device-memory fill of the same size. The copies out of the
+    // staging buffer cannot be observed without a synchronization, so
+    // unlike the device paths the call returns only once the values are
+    // in the buffer.
+    template<class T, class Distribution>
+    rocrand_status generate_to_host(T * data, size_t data_size, Distribution distribution)
+    {
+        if(staging_buffer() == NULL)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        const size_t chunk = s_staging_bytes / sizeof(T);
+        size_t start = 0;
+        while(start < data_size)
+        {
+            const size_t count = std::min<size_t>(chunk, data_size - start);
+            const rocrand_status status =
+                generate(reinterpret_cast<T *>(m_staging), count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            if(hipMemcpyAsync(data + start, m_staging, count * sizeof(T),
+                              hipMemcpyDeviceToHost, m_stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            start += count;
+        }
+
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host-side implementation of generate() used by generators created
+    // with rocrand_create_generator_host(). Writes the same values to
+    // \p data as a device generator under the
+    // ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT ordering: every
+    // distribution application consumes the engine values of its own
+    // output index, so the result depends on neither the grid shape nor
+    // the number of host threads. The loop is parallelized with OpenMP
+    // when the library is built with it; positioning the engine is a
+    // counter add, so iterations are independent and the inner Philox
+    // rounds are plain integer arithmetic the compiler can vectorize.
+    template<class T, class Distribution>
+    rocrand_status generate_host(T * data, size_t data_size, Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+        const rocrand_status status =
+            generate_host_from(m_engine, data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_engine.discard(applications * input_width);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // The loop of generate_host from an explicit engine position; also
+    // the host-generation path of generate_at, which must not touch
+    // m_engine
+    template<class T, class Distribution>
+    rocrand_status generate_host_from(const engine_type& start_engine, T * data,
+                                      size_t data_size, Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+        for(size_t index = 0; index < applications; index++)
+        {
+            engine_type engine = start_engine;
+            engine.discard(input_width * index);
+
+            unsigned int input[input_width];
+            T output[output_width];
+
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < data_size)
+                {
+                    data[j] = output[o];
+                }
+            }
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host-side counterpart of generate_2d_kernel; writes the same
+    // values to the same pitched addresses with the generate_host loop.
+    template<class T, class Distribution>
+    rocrand_status generate_2d_host(T * data, size_t rows, size_t cols,
+                                    size_t pitch, Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const size_t n = rows * cols;
+        const size_t applications = (n + output_width - 1) / output_width;
+        const engine_type start_engine = m_engine;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+        for(size_t index = 0; index < applications; index++)
+        {
+            engine_type engine = start_engine;
+            engine.discard(input_width * index);
+
+            unsigned int input[input_width];
+            T output[output_width];
+
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < n)
+                {
+                    data[(j / rows) * pitch + j % rows] = output[o];
+                }
+            }
+        }
+
+        m_engine.discard(applications * input_width);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host-side counterpart of generate_poisson_array_kernel. Writes the
+    // same values: every output index draws from its own subsequence, so
+    // the result depends on neither the grid shape nor the number of
+    // host threads. The per-sample work varies with lambda, hence the
+    // dynamic schedule.
+    rocrand_status generate_poisson_array_host(unsigned int * data, size_t data_size,
+                                               const double * lambdas)
+    {
+        const engine_type start_engine = m_engine;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(size_t index = 0; index < data_size; index++)
+        {
+            engine_type engine = start_engine;
+            engine.discard_subsequence(index);
+            rocrand_state_philox4x32_10 * state = &engine;
+            data[index] = rocrand_device::detail::poisson_distribution<
+                rocrand_state_philox4x32_10 *>(state, lambdas[index]);
+        }
+
+        m_engine.discard_subsequence(data_size);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Writes the first k values of a keyed Feistel permutation of
+    // [0, n). The round keys come off the main sequence, so the prefix
+    // is reproducible per seed and fresh per call. The caller has run
+    // init().
+    rocrand_status generate_permutation_prefix(unsigned int * data, size_t k,
+                                               size_t n)
+    {
+        rocrand_host::detail::feistel_permutation permutation;
+
+        unsigned int total_bits = 1;
+        while((1ull << total_bits) < static_cast<unsigned long long>(n))
+        {
+            total_bits++;
+        }
+        permutation.half_bits = (total_bits + 1) / 2;
+        permutation.half_mask =
+            static_cast<unsigned int>((1ull << permutation.half_bits) - 1);
+
+        for(unsigned int r = 0; r < rocrand_host::detail::feistel_permutation::rounds; r++)
+        {
+            permutation.keys[r] = m_engine();
+        }
+
+        if(m_host)
+        {
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+            for(size_t index = 0; index < k; index++)
+            {
+                unsigned long long x = index;
+                do
+                {
+                    x = permutation(x);
+                }
+                while(x >= n);
+                data[index] = static_cast<unsigned int>(x);
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_permutation_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            permutation, data, k, n
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host backend of generate_latin_hypercube(); the engine copy sits
+    // at the first jitter value and the caller has already advanced the
+    // main engine past the fill.
+    rocrand_status generate_latin_hypercube_host(float * data, size_t n_samples,
+                                                 size_t n_dims,
+                                                 const unsigned int * round_keys,
+                                                 unsigned int half_bits,
+                                                 unsigned int half_mask,
+                                                 const engine_type& jitter_engine)
+    {
+        constexpr unsigned int rounds =
+            rocrand_host::detail::feistel_permutation::rounds;
+        const size_t n = n_samples * n_dims;
+        const float inv_n = 1.0f / n_samples;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+        for(size_t index = 0; index < n; index++)
+        {
+            const size_t dimension = index / n_samples;
+
+            rocrand_host::detail::feistel_permutation permutation;
+            permutation.half_bits = half_bits;
+            permutation.half_mask = half_mask;
+            for(unsigned int r = 0; r < rounds; r++)
+            {
+                permutation.keys[r] = round_keys[dimension * rounds + r];
+            }
+
+            unsigned long long x = index % n_samples;
+            do
+            {
+                x = permutation(x);
+            }
+            while(x >= n_samples);
+
+            engine_type engine = jitter_engine;
+            engine.discard(index);
+            const float u = rocrand_device::detail::uniform_distribution(engine());
+
+            data[index] = (static_cast<unsigned int>(x) + u) * inv_n;
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Weighted selection on the device: one launch to draw the keys,
+    // four histogram launches to radix-walk to the k-th smallest key,
+    // one launch to emit the winners. Only the 256-bin histograms cross
+    // to the host; the keys stay in the caller-provided scratch.
+    rocrand_status sample_without_replacement_device(unsigned int * data, size_t k,
+                                                     size_t n, const double * weights,
+                                                     unsigned int * keys,
+                                                     unsigned long long * counters)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::sample_keys_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, keys, n, weights
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Move the main sequence past every subsequence the keys used
+        m_engine.discard_subsequence(n);
+
+        // After each pass 'prefix' holds the located high bytes of the
+        // k-th smallest key and 'remaining' the rank still to find among
+        // the keys matching it
+        unsigned int prefix = 0;
+        unsigned int fixed_mask = 0;
+        unsigned long long remaining = k;
+        unsigned long long histogram[256];
+        for(unsigned int shift = 24; ; shift -= 8)
+        {
+            if(hipMemsetAsync(counters, 0,
+                              256 * sizeof(unsigned long long),
+                              m_stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::sample_histogram_kernel),
+                dim3(m_blocks), dim3(s_threads), 0, m_stream,
+                keys, n, fixed_mask, prefix, shift, counters
+            );
+            // Check kernel status
+            if(launch_failed())
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            if(hipMemcpy(histogram, counters,
+                         256 * sizeof(unsigned long long),
+                         hipMemcpyDeviceToHost) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+
+            unsigned int bin = 0;
+            while(histogram[bin] < remaining)
+            {
+                remaining -= histogram[bin];
+                bin++;
+            }
+            prefix |= bin << shift;
+            fixed_mask |= 255u << shift;
+
+            if(shift == 0)
+                break;
+        }
+
+        // 'prefix' is now the k-th smallest key and 'remaining' how many
+        // of its occurrences complete the selection
+        if(hipMemsetAsync(counters, 0,
+                          2 * sizeof(unsigned long long),
+                          m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::sample_select_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            keys, n, prefix, remaining, counters, data
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // The scratch is freed on return; the selection must be done
+        // reading it
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host-side counterpart of the weighted selection. The keys follow
+    // the same per-index subsequences as the device path; the k smallest
+    // are found with a partial selection instead of the radix walk, so
+    // the selected set matches the device backend up to ties on the
+    // k-th smallest key (the order within it carries no meaning on
+    // either).
+    rocrand_status sample_without_replacement_host(unsigned int * data, size_t k,
+                                                   size_t n, const double * weights)
+    {
+        const engine_type start_engine = m_engine;
+
+        std::vector<std::pair<unsigned int, unsigned int>> keyed(n);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+        for(size_t index = 0; index < n; index++)
+        {
+            engine_type engine = start_engine;
+            engine.discard_subsequence(index);
+            rocrand_state_philox4x32_10 * state = &engine;
+            keyed[index] = std::make_pair(
+                rocrand_host::detail::sample_key_bits(static_cast<float>(
+                    -log(rocrand_uniform_double(state)) / weights[index])),
+                static_cast<unsigned int>(index));
+        }
+
+        std::nth_element(keyed.begin(), keyed.begin() + (k - 1), keyed.end());
+        for(size_t i = 0; i < k; i++)
+        {
+            data[i] = keyed[i].second;
+        }
+
+        m_engine.discard_subsequence(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Lazily allocated; only fills into pageable host memory need it
+    // (see generate_to_host)
+    void * staging_buffer()
+    {
+        if(m_staging == NULL)
+        {
+            if(rocrand_host::detail::device_malloc(&m_staging, s_staging_bytes) != hipSuccess)
+            {
+                m_staging = NULL;
+            }
+        }
+        return m_staging;
+    }
+
+    // Lazily allocated; banking is skipped when the allocation fails
+    void * remainder_buffer()
+    {
+        if(m_remainder == NULL)
+        {
+            if(rocrand_host::detail::device_malloc(&m_remainder, s_remainder_bytes) != hipSuccess)
+            {
+                m_remainder = NULL;
+            }
+        }
+        return m_remainder;
+    }
+
+    // Identifies the distribution that produced the banked values; a
+    // call with any other distribution discards them
+    template<class T, class Distribution>
+    static const void * remainder_tag()
+    {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    bool m_engines_initialized;
     engine_type  m_engine;
+    uint32_t m_dynamic_blocks;
+    // Concurrent mode; m_claimed counts the values claimed by
+    // generate() calls since the mode was enabled
+    bool m_concurrent;
+    // Host generation mode; generate() runs its loops on the CPU
+    // instead of launching kernels
+    bool m_host;
+    std::atomic<unsigned long long> m_claimed;
+    // Unconsumed tail values of the last application of the previous
+    // fill, banked in device memory and consumed first by the next call
+    // with the same distribution
+    void * m_remainder;
+    const void * m_remainder_tag;
+    unsigned int m_remainder_count;
+    unsigned int m_remainder_offset;
+    // Device-side copy of the batched-fill buffer descriptors, grown on
+    // demand
+    unsigned int m_batch_capacity;
+    void * m_batch_descriptors;
+    // Device staging buffer for fills into pageable host memory
+    void * m_staging;
+    // Block count of the generation grid, overridden by the launch
+    // tuning table
+    uint32_t m_blocks;
+    // Resident mode; the per-thread engine states live in device memory
+    // and generate() advances them in place
+    bool m_resident;
+    engine_type * m_resident_engines;
 
     const static uint32_t s_threads = 256;
     const static uint32_t s_blocks = 1024;
+    // Fixed grid of the resident-state kernels; the engine array is
+    // sized to it, so it cannot follow the fill size
+    const static uint32_t s_resident_blocks = 64;
+    const static unsigned int s_max_mvn_dim = 32;
+    const static unsigned int s_max_dirichlet_dim = 32;
+    // Fills up to this many bytes take the low-latency small kernel
+    const static size_t   s_small_size_bytes = 64 * 1024;
+    // Fills past this many bytes split into sub-launches of at most
+    // this size (see generate_chunked)
+    const static size_t   s_chunk_size_bytes = size_t(4) << 30;
+    const static uint32_t s_small_blocks = 8;
+    // Large enough for one application's output of every distribution
+    const static size_t   s_remainder_bytes = 64;
+    // Chunk size of fills staged into pageable host memory; large
+    // enough to amortize the per-copy cost, small enough that the
+    // buffer is cheap to keep for the generator's lifetime
+    const static size_t   s_staging_bytes = size_t(16) << 20;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     // m_seed from base_type
     // m_offset from base_type
 };
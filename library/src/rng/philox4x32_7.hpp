@@ -0,0 +1,991 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_RNG_PHILOX4X32_7_H_
+#define ROCRAND_RNG_PHILOX4X32_7_H_
+
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "seeded.hpp"
+
+namespace rocrand_host {
+namespace detail {
+    struct philox4x32_7_device_engine : public ::rocrand_device::philox4x32_7_engine
+    {
+        typedef ::rocrand_device::philox4x32_7_engine base_type;
+        typedef base_type::philox4x32_state state_type;
+
+        __forceinline__ __device__ __host__
+        philox4x32_7_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        philox4x32_7_device_engine(const unsigned long long seed,
+                                    const unsigned long long subsequence,
+                                    const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~philox4x32_7_device_engine () {}
+
+        __forceinline__ __device__ __host__
+        uint4 next4_leap(unsigned int leap)
+        {
+            uint4 ret = m_state.result;
+            if(m_state.substate > 0) {
+                const uint4 next_counter = this->bump_counter(m_state.counter);
+                const uint4 next = this->philox_rounds(next_counter, m_state.key);
+                ret = this->interleave(ret, next);
+            }
+
+            this->discard_state(leap);
+            m_state.result = this->philox_rounds(m_state.counter, m_state.key);
+            return ret;
+        }
+
+        // m_state from base class
+    };
+
+
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_kernel(philox4x32_7_device_engine engine,
+                         T * data, const size_t n,
+                         Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        static_assert(4 % input_width == 0 && input_width <= 4, "Incorrect input_width");
+        constexpr unsigned int output_per_thread = 4 / input_width;
+        constexpr unsigned int full_output_width = output_per_thread * output_width;
+
+        using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        unsigned int input[input_width];
+        T output[output_per_thread][output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            (
+                full_output_width - uintptr / sizeof(T) % full_output_width
+            ) % full_output_width;
+        const unsigned int head_size = min(n, misalignment);
+        const unsigned int tail_size = (n - head_size) % full_output_width;
+        const size_t vec_n = (n - head_size) / full_output_width;
+
+        // The head is served by the first threads, one application each,
+        // instead of a serial loop in thread 0; every application consumes
+        // the engine values the serial loop would have, so the output is
+        // unchanged
+        const unsigned int head_applications = (head_size + output_width - 1) / output_width;
+        if(head_size > 0 && thread_id < head_applications) {
+            philox4x32_7_device_engine head_engine = engine;
+            head_engine.discard(thread_id * input_width);
+            for(unsigned int i = 0; i < input_width; ++i) {
+                input[i] = head_engine();
+            }
+            distribution(input, output[0]);
+            for(unsigned int o = 0; o < output_width; ++o) {
+                if(thread_id * output_width + o < head_size) {
+                    data[thread_id * output_width + o] = output[0][o];
+                }
+            }
+        }
+
+        const unsigned int engine_offset = 4 * thread_id +
+            (thread_id == 0 ? head_applications * input_width : head_size);
+        engine.discard(engine_offset);
+
+        // Save multiple values as one vec_type
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        size_t index = thread_id;
+        while(index < vec_n)
+        {
+            const uint4 v = engine.next4_leap(stride);
+            const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+            for(unsigned int s = 0; s < output_per_thread; s++)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = vs[s * input_width + i];
+                }
+                distribution(input, output[s]);
+            }
+            vec_data[index] = *reinterpret_cast<vec_type *>(output);
+            // Next position
+            index += stride;
+        }
+
+        // Check if we need to save tail.
+        // Those numbers should be generated by the thread that would
+        // save next vec_type.
+        if(index == vec_n && tail_size > 0)
+        {
+            for(unsigned int s = 0; s < output_per_thread; ++s) {
+                if(s * output_width >= tail_size) {
+                    break;
+                }
+
+                for(unsigned int i = 0; i < input_width; ++i) {
+                    input[i] = engine();
+                }
+                distribution(input, output[s]);
+
+                for(unsigned int o = 0; o < output_width; ++o) {
+                    if(s * output_width + o < tail_size) {
+                        data[n - tail_size + s * output_width + o] = output[s][o];
+                    }
+                }
+            }
+        }
+    }
+
+    // Low-latency variant for small fills. Skips the vectorized stores
+    // and the alignment head/tail handling of generate_kernel, which are
+    // pure overhead when the launch latency dominates the fill. Consumes
+    // input_width engine values per distribution application, the same
+    // accounting as generate_kernel, so the host-side discard after the
+    // launch stays correct. Every application consumes the engine values
+    // of its own index, so the output does not depend on the grid shape;
+    // ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT reuses this kernel for
+    // fills of any size.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_small_kernel(philox4x32_7_device_engine engine,
+                               T * data, const size_t n,
+                               Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const size_t applications = (n + output_width - 1) / output_width;
+
+        engine.discard(input_width * thread_id);
+        size_t index = thread_id;
+        while(index < applications)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                const size_t j = index * output_width + o;
+                if(j < n)
+                {
+                    data[j] = output[o];
+                }
+            }
+            index += stride;
+            engine.discard(input_width * (stride - 1));
+        }
+    }
+
+    // Regenerates the last application of a fill and stores the values
+    // past the end of the output, which generate_kernel and
+    // generate_small_kernel discard. The host side banks them for the
+    // next call instead of wasting them. Launched with a single thread,
+    // with \p engine positioned at the last application; \p used is the
+    // number of its values the fill consumed.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    void generate_remainder_kernel(philox4x32_7_device_engine engine,
+                                   T * remainder, const unsigned int used,
+                                   Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        for(unsigned int o = used; o < output_width; o++)
+        {
+            remainder[o - used] = output[o];
+        }
+    }
+
+    // Generates whole output vectors per thread and applies the lower
+    // triangular Cholesky factor to the normal variates while they are
+    // still in registers, so correlated vectors are produced in a single
+    // pass over the output buffer (no separate trmm-style transform).
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_multivariate_normal_kernel(philox4x32_7_device_engine engine,
+                                             float * data, const size_t n_vectors,
+                                             const unsigned int dim,
+                                             const float * cholesky_factor)
+    {
+        constexpr unsigned int max_dim = 32;
+
+        __shared__ float factor[max_dim * max_dim];
+        for(unsigned int i = threadIdx.x; i < dim * dim; i += blockDim.x)
+        {
+            factor[i] = cholesky_factor[i];
+        }
+        __syncthreads();
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        // Box-Muller produces pairs, so odd dimensions discard one value
+        const unsigned int draws_per_vector = (dim + 1) & ~1u;
+
+        for(size_t index = thread_id; index < n_vectors; index += stride)
+        {
+            philox4x32_7_device_engine e = engine;
+            e.discard(index * draws_per_vector);
+
+            float z[max_dim];
+            for(unsigned int i = 0; i < dim; i += 2)
+            {
+                const unsigned int x = e();
+                const unsigned int y = e();
+                const float2 v = rocrand_device::detail::normal_distribution2(x, y);
+                z[i] = v.x;
+                if(i + 1 < dim)
+                {
+                    z[i + 1] = v.y;
+                }
+            }
+
+            float * out = data + index * dim;
+            for(unsigned int r = 0; r < dim; r++)
+            {
+                float sum = 0.0f;
+                for(unsigned int c = 0; c <= r; c++)
+                {
+                    sum += factor[r * dim + c] * z[c];
+                }
+                out[r] = sum;
+            }
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_philox4x32_7 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_7>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_7>;
+    using engine_type = ::rocrand_host::detail::philox4x32_7_device_engine;
+
+    rocrand_philox4x32_7(unsigned long long seed   = 0,
+                          unsigned long long offset = 0,
+                          rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                          hipStream_t        stream = 0)
+        : base_type(order, seed, offset, stream)
+        , m_engines_initialized(false)
+        , m_dynamic_blocks(0)
+        , m_concurrent(false)
+        , m_claimed(0)
+        , m_remainder(NULL)
+        , m_remainder_tag(NULL)
+        , m_remainder_count(0)
+        , m_remainder_offset(0)
+    {
+    }
+
+    ~rocrand_philox4x32_7()
+    {
+        if(m_remainder != NULL)
+        {
+            rocrand_host::detail::device_free(m_remainder);
+        }
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    // Advances the sequence by \p n values from the current position
+    // with a constant-cost counter skip
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard(n);
+        // The banked values precede the new position
+        m_remainder_count = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Advances the sequence by \p n subsequences from the current
+    // position. Subsequences are 2^66 values apart, so generators
+    // placed on distinct subsequences cannot overlap
+    rocrand_status skip_ahead_subsequence(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard_subsequence(n);
+        m_remainder_count = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with one value per element of \p seeds: value i is
+    // drawn from the stream that seeds[i] keys, positioned at the
+    // generator's offset, so it depends only on seeds[i] and is stable
+    // under reordering of the elements. Generator state is not consumed
+    // (see seeded.hpp).
+    rocrand_status generate_seeded(unsigned int * data, size_t data_size,
+                                   const unsigned long long * seeds)
+    {
+        return rocrand_host::detail::generate_seeded<engine_type>(
+            seeds, data, data_size, m_offset, m_stream);
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order               = order;
+        m_engines_initialized = false;
+    }
+
+    // Enables or disables concurrent generation. While enabled,
+    // generate() calls from different threads claim disjoint ranges of
+    // the sequence with an atomic counter instead of advancing the
+    // shared engine, so the union of their outputs is the prefix of the
+    // sequence a single thread would produce. Disabling folds the
+    // claimed ranges back into the engine, so sequential generation
+    // continues where the concurrent fills ended.
+    rocrand_status set_concurrent_generation(bool enabled)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_concurrent && !enabled)
+        {
+            m_engine.discard(m_claimed.load());
+        }
+        m_claimed.store(0);
+        m_remainder_count = 0;
+        m_concurrent = enabled;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with \p data_size values of the sequence the seed
+    // and offset configure, starting at absolute position \p offset,
+    // without consuming generator state: the fill's engine is
+    // positioned with a constant-cost counter skip and dropped after
+    // the launch. Calls are therefore independent of previous generate
+    // calls and of each other, so host threads can fill disjoint
+    // regions of one logical sequence concurrently and a failed fill
+    // can simply be retried (see rocrand_generate_at). \p offset must
+    // fall on an application boundary of the distribution; for the
+    // default uniform distribution every offset qualifies. Statistics
+    // are skipped like in concurrent mode because the calls may come
+    // from several threads.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(unsigned long long offset, T * data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(offset % Distribution::output_width != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Positioned from the configured start of the sequence, not
+        // from the current engine position, so the call is idempotent
+        engine_type engine{m_seed, 0, m_offset};
+        engine.discard(offset / Distribution::output_width * Distribution::input_width);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+            engine, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_engine = engine_type{m_seed, 0, m_offset};
+        m_remainder_count = 0;
+
+        // Allocated up front so that initialized generate() calls stay
+        // allocation-free (required to capture fills into a hipGraph);
+        // banking is simply skipped if the allocation failed
+        remainder_buffer();
+
+        if(rocrand_host::detail::uses_device_occupancy(m_order) && m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            m_dynamic_blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type, unsigned int *, const size_t,
+                                     uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<unsigned int,
+                                                          uniform_distribution<unsigned int>>),
+                s_threads);
+            if(m_dynamic_blocks == 0)
+            {
+                m_dynamic_blocks = s_blocks;
+            }
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Banking needs exclusive sequence accounting and per-call
+        // engine positions, which concurrent mode and the index-mapped
+        // ordering do not provide
+        const bool bankable = !m_concurrent
+            && m_order != ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT;
+
+        if(bankable && m_remainder_count > 0)
+        {
+            if(m_remainder_tag == remainder_tag<T, Distribution>())
+            {
+                // The banked values of the previous call's last
+                // application precede the engine position, so they come
+                // first
+                const size_t take = std::min<size_t>(m_remainder_count, data_size);
+                const T * remainder =
+                    reinterpret_cast<const T *>(m_remainder) + m_remainder_offset;
+                if(hipMemcpyAsync(data, remainder, take * sizeof(T),
+                                  hipMemcpyDeviceToDevice, m_stream) != hipSuccess)
+                {
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                m_remainder_count -= static_cast<unsigned int>(take);
+                m_remainder_offset += static_cast<unsigned int>(take);
+                data += take;
+                data_size -= take;
+                if(data_size == 0)
+                {
+                    return ROCRAND_STATUS_SUCCESS;
+                }
+            }
+            else
+            {
+                // A different distribution cannot consume the banked
+                // values; drop them like the kernels used to
+                m_remainder_count = 0;
+            }
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators =
+            (data_size + Distribution::output_width - 1) /
+            Distribution::output_width * Distribution::input_width;
+
+        // In concurrent mode each call claims its range of the sequence
+        // up front and leaves the shared engine untouched; statistics
+        // are skipped because their event pool is not thread-safe
+        engine_type engine = m_engine;
+        if(m_concurrent)
+        {
+            engine.discard(m_claimed.fetch_add(num_applied_generators));
+        }
+        else
+        {
+            statistics.begin_launch(m_stream);
+        }
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            // The index-mapped kernel ties every output index to a fixed
+            // sequence position, so the grid only has to cover the fill
+            const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                (data_size + s_threads - 1) / s_threads, launch_blocks(data_size)));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        else if(data_size * sizeof(T) <= s_small_size_bytes)
+        {
+            // For launch-latency-bound fills a few waves without the
+            // vectorization machinery beat the full grid
+            const uint32_t blocks = static_cast<uint32_t>(
+                std::min<size_t>((data_size + s_threads - 1) / s_threads, s_small_blocks));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                dim3(std::max(blocks, 1u)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+                engine, data, data_size, distribution
+            );
+        }
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(!m_concurrent)
+        {
+            statistics.end_launch(data_size * sizeof(T), m_stream);
+
+            // Bank the values of the last application that the fill did
+            // not consume; the engine advance below skips past them, so
+            // the next call reads them from the buffer instead of
+            // regenerating the whole application
+            const unsigned int used =
+                static_cast<unsigned int>(data_size % Distribution::output_width);
+            if(bankable && used != 0 && remainder_buffer() != NULL)
+            {
+                engine_type tail_engine = engine;
+                tail_engine.discard(num_applied_generators - Distribution::input_width);
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::generate_remainder_kernel),
+                    dim3(1), dim3(1), 0, m_stream,
+                    tail_engine, reinterpret_cast<T *>(m_remainder), used, distribution
+                );
+                if(hipGetLastError() == hipSuccess)
+                {
+                    m_remainder_tag = remainder_tag<T, Distribution>();
+                    m_remainder_count = Distribution::output_width - used;
+                    m_remainder_offset = 0;
+                }
+            }
+
+            m_engine.discard(num_applied_generators);
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+
+    // Fills num_streams contiguous extents of the output with one
+    // launch per extent on the corresponding caller stream, each
+    // launch's engine skipped to the exact sequence position of its
+    // extent. The extents hold the same values as num_streams
+    // sequential generate() calls of the same sizes, and the
+    // generator's own stream waits on all of them, so work queued on it
+    // afterwards sees the whole fill.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_partitioned(T * data, size_t data_size,
+                                        const hipStream_t * streams,
+                                        unsigned int num_streams,
+                                        Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        // Extents split on application boundaries, so every launch
+        // starts at an exact engine position
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+        const hipStream_t stream = m_stream;
+        size_t app_start = 0;
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            const size_t apps = applications / num_streams
+                                + (k < applications % num_streams ? 1 : 0);
+            if(apps == 0)
+            {
+                break;
+            }
+            const size_t start = app_start * output_width;
+            const size_t count = std::min<size_t>(apps * output_width, data_size - start);
+            m_stream = streams[k];
+            const rocrand_status status = generate(data + start, count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_stream = stream;
+                return status;
+            }
+            app_start += apps;
+        }
+        m_stream = stream;
+
+        // Join the extents into the generator's stream
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            hipEvent_t event;
+            if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            if(hipEventRecord(event, streams[k]) != hipSuccess
+               || hipStreamWaitEvent(m_stream, event, 0) != hipSuccess)
+            {
+                hipEventDestroy(event);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipEventDestroy(event);
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p n_vectors correlated normal vectors of \p dim elements
+    /// each; \p cholesky_factor is a row-major lower triangular dim x dim
+    /// matrix in device memory. Supported for dimensions up to 32.
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dim,
+                                                const float * cholesky_factor)
+    {
+        if(dim == 0 || dim > s_max_mvn_dim)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multivariate_normal_kernel),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engine, data, n_vectors, dim, cholesky_factor
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engine.discard(n_vectors * ((dim + 1) & ~1u));
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Grid size of the next launch. The engine is counter-based, so the
+    // generated sequence does not depend on the grid; under
+    // ROCRAND_ORDERING_PSEUDO_DYNAMIC and ROCRAND_ORDERING_PSEUDO_FASTEST
+    // the grid follows the device's
+    // occupancy and shrinks for fills that can't fill it.
+    uint32_t launch_blocks(size_t data_size) const
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order) || m_dynamic_blocks == 0)
+        {
+            return s_blocks;
+        }
+        const size_t needed_blocks = (data_size + s_threads - 1) / s_threads;
+        return static_cast<uint32_t>(
+            std::min<size_t>(m_dynamic_blocks, std::max<size_t>(needed_blocks, 1)));
+    }
+
+    // Lazily allocated; banking is skipped when the allocation fails
+    void * remainder_buffer()
+    {
+        if(m_remainder == NULL)
+        {
+            if(rocrand_host::detail::device_malloc(&m_remainder, s_remainder_bytes) != hipSuccess)
+            {
+                m_remainder = NULL;
+            }
+        }
+        return m_remainder;
+    }
+
+    // Identifies the distribution that produced the banked values; a
+    // call with any other distribution discards them
+    template<class T, class Distribution>
+    static const void * remainder_tag()
+    {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    bool m_engines_initialized;
+    engine_type  m_engine;
+    uint32_t m_dynamic_blocks;
+    // Concurrent mode; m_claimed counts the values claimed by
+    // generate() calls since the mode was enabled
+    bool m_concurrent;
+    std::atomic<unsigned long long> m_claimed;
+    // Unconsumed tail values of the last application of the previous
+    // fill, banked in device memory and consumed first by the next call
+    // with the same distribution
+    void * m_remainder;
+    const void * m_remainder_tag;
+    unsigned int m_remainder_count;
+    unsigned int m_remainder_offset;
+
+    const static uint32_t s_threads = 256;
+    const static uint32_t s_blocks = 1024;
+    const static unsigned int s_max_mvn_dim = 32;
+    // Fills up to this many bytes take the low-latency small kernel
+    const static size_t   s_small_size_bytes = 64 * 1024;
+    const static uint32_t s_small_blocks = 8;
+    // Large enough for one application's output of every distribution
+    const static size_t   s_remainder_bytes = 64;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_PHILOX4X32_7_H_
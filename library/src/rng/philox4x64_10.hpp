@@ -0,0 +1,718 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PHILOX4X64_10_H_
+#define ROCRAND_RNG_PHILOX4X64_10_H_
+
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "seeded.hpp"
+
+namespace rocrand_host
+{
+namespace detail
+{
+struct philox4x64_10_device_engine : public ::rocrand_device::philox4x64_10_engine
+{
+    typedef ::rocrand_device::philox4x64_10_engine base_type;
+    typedef base_type::philox4x64_state            state_type;
+
+    __forceinline__ __device__ __host__ philox4x64_10_device_engine() {}
+
+    __forceinline__ __device__ __host__
+        philox4x64_10_device_engine(const unsigned long long seed,
+                                    const unsigned long long subsequence,
+                                    const unsigned long long offset)
+        : base_type(seed, subsequence, offset)
+    {}
+
+    __forceinline__ __device__ __host__ ulonglong4 next4_leap(unsigned int leap)
+    {
+        ulonglong4 ret = m_state.result;
+        if(m_state.substate > 0)
+        {
+            const ulonglong4 next_counter = this->bump_counter(m_state.counter);
+            const ulonglong4 next         = this->philox_rounds(next_counter, m_state.key);
+            ret                           = this->interleave(ret, next);
+        }
+
+        this->discard_state(leap);
+        m_state.result = this->philox_rounds(m_state.counter, m_state.key);
+        return ret;
+    }
+
+    // m_state from base class
+};
+
+template<class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_kernel(
+    philox4x64_10_device_engine engine, T* data, const size_t n, Distribution distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    static_assert(4 % input_width == 0 && input_width <= 4, "Incorrect input_width");
+    constexpr unsigned int output_per_thread = 4 / input_width;
+    constexpr unsigned int full_output_width = output_per_thread * output_width;
+
+    using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
+
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+
+    unsigned long long input[input_width];
+    T                  output[output_per_thread][output_width];
+
+    const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+    const size_t    misalignment
+        = (full_output_width - uintptr / sizeof(T) % full_output_width) % full_output_width;
+    const unsigned int head_size = min(n, misalignment);
+    const unsigned int tail_size = (n - head_size) % full_output_width;
+    const size_t       vec_n     = (n - head_size) / full_output_width;
+
+    // The head is served by the first threads, one application each,
+    // instead of a serial loop in thread 0; every application consumes
+    // the engine values the serial loop would have, so the output is
+    // unchanged
+    const unsigned int head_applications = (head_size + output_width - 1) / output_width;
+    if(head_size > 0 && thread_id < head_applications)
+    {
+        philox4x64_10_device_engine head_engine = engine;
+        head_engine.discard(thread_id * input_width);
+        for(unsigned int i = 0; i < input_width; ++i)
+        {
+            input[i] = head_engine();
+        }
+        distribution(input, output[0]);
+        for(unsigned int o = 0; o < output_width; ++o)
+        {
+            if(thread_id * output_width + o < head_size)
+            {
+                data[thread_id * output_width + o] = output[0][o];
+            }
+        }
+    }
+
+    const unsigned int engine_offset
+        = 4 * thread_id + (thread_id == 0 ? head_applications * input_width : head_size);
+    engine.discard(engine_offset);
+
+    // Save multiple values as one vec_type
+    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
+    size_t    index    = thread_id;
+    while(index < vec_n)
+    {
+        const ulonglong4         v     = engine.next4_leap(stride);
+        const unsigned long long vs[4] = {v.x, v.y, v.z, v.w};
+        for(unsigned int s = 0; s < output_per_thread; s++)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = vs[s * input_width + i];
+            }
+            distribution(input, output[s]);
+        }
+        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        // Next position
+        index += stride;
+    }
+
+    // Check if we need to save tail.
+    // Those numbers should be generated by the thread that would
+    // save next vec_type.
+    if(index == vec_n && tail_size > 0)
+    {
+        for(unsigned int s = 0; s < output_per_thread; ++s)
+        {
+            if(s * output_width >= tail_size)
+            {
+                break;
+            }
+
+            for(unsigned int i = 0; i < input_width; ++i)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output[s]);
+
+            for(unsigned int o = 0; o < output_width; ++o)
+            {
+                if(s * output_width + o < tail_size)
+                {
+                    data[n - tail_size + s * output_width + o] = output[s][o];
+                }
+            }
+        }
+    }
+}
+
+
+// Index-mapped variant for ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+// Every application consumes the engine values of its own index, so the
+// output is the same for any grid shape; the constant-cost discard of
+// the counter-based engine keeps the per-iteration skip free.
+template<class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void
+    generate_device_independent_kernel(philox4x64_10_device_engine engine,
+                                       T* data,
+                                       const size_t n,
+                                       Distribution distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+
+    unsigned long long input[input_width];
+    T output[output_width];
+
+    const size_t applications = (n + output_width - 1) / output_width;
+
+    engine.discard(input_width * thread_id);
+    size_t index = thread_id;
+    while(index < applications)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        for(unsigned int o = 0; o < output_width; o++)
+        {
+            const size_t j = index * output_width + o;
+            if(j < n)
+            {
+                data[j] = output[o];
+            }
+        }
+        index += stride;
+        engine.discard(input_width * (stride - 1));
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_philox4x64_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_64_10>
+{
+public:
+    using base_type   = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_64_10>;
+    using engine_type = ::rocrand_host::detail::philox4x64_10_device_engine;
+
+    rocrand_philox4x64_10(unsigned long long seed   = 0,
+                          unsigned long long offset = 0,
+                          rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                          hipStream_t        stream = 0)
+        : base_type(order, seed, offset, stream), m_engines_initialized(false)
+        , m_dynamic_blocks(0)
+        , m_concurrent(false)
+        , m_claimed(0)
+    {}
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed                = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset              = offset;
+        m_engines_initialized = false;
+    }
+
+    // Advances the sequence by \p n values from the current position
+    // with a constant-cost counter skip
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Advances the sequence by \p n subsequences from the current
+    // position. Subsequences are 2^130 values apart, so generators
+    // placed on distinct subsequences cannot overlap
+    rocrand_status skip_ahead_subsequence(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard_subsequence(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with one value per element of \p seeds: value i is
+    // drawn from the stream that seeds[i] keys, positioned at the
+    // generator's offset, so it depends only on seeds[i] and is stable
+    // under reordering of the elements. Generator state is not consumed
+    // (see seeded.hpp).
+    rocrand_status generate_seeded(unsigned int* data, size_t data_size,
+                                   const unsigned long long* seeds)
+    {
+        return rocrand_host::detail::generate_seeded<engine_type>(seeds,
+                                                                  data,
+                                                                  data_size,
+                                                                  m_offset,
+                                                                  m_stream);
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order               = order;
+        m_engines_initialized = false;
+    }
+
+    // Enables or disables concurrent generation. While enabled,
+    // generate() calls from different threads claim disjoint ranges of
+    // the sequence with an atomic counter instead of advancing the
+    // shared engine, so the union of their outputs is the prefix of the
+    // sequence a single thread would produce. Disabling folds the
+    // claimed ranges back into the engine, so sequential generation
+    // continues where the concurrent fills ended.
+    rocrand_status set_concurrent_generation(bool enabled)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_concurrent && !enabled)
+        {
+            m_engine.discard(m_claimed.load());
+        }
+        m_claimed.store(0);
+        m_concurrent = enabled;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with \p data_size values of the sequence the seed
+    // and offset configure, starting at absolute position \p offset,
+    // without consuming generator state: the fill's engine is
+    // positioned with a constant-cost counter skip and dropped after
+    // the launch. Calls are therefore independent of previous generate
+    // calls and of each other, so host threads can fill disjoint
+    // regions of one logical sequence concurrently and a failed fill
+    // can simply be retried (see rocrand_generate_at). \p offset must
+    // fall on an application boundary of the distribution; for the
+    // default uniform distribution every offset qualifies. Statistics
+    // are skipped like in concurrent mode because the calls may come
+    // from several threads.
+    template<class T, class Distribution = uniform_distribution<T, unsigned long long>>
+    rocrand_status generate_at(unsigned long long offset, T* data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(offset % Distribution::output_width != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Positioned from the configured start of the sequence, not
+        // from the current engine position, so the call is idempotent
+        engine_type engine{m_seed, 0, m_offset};
+        engine.discard(offset / Distribution::output_width * Distribution::input_width);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+            engine, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_engine = engine_type{m_seed, 0, m_offset};
+
+        if(rocrand_host::detail::uses_device_occupancy(m_order) && m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            m_dynamic_blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type, unsigned long long*, const size_t, uniform_distribution<unsigned long long, unsigned long long>)>(
+                    rocrand_host::detail::generate_kernel<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>),
+                s_threads);
+            if(m_dynamic_blocks == 0)
+            {
+                m_dynamic_blocks = s_blocks;
+            }
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T, unsigned long long>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
+                                            / Distribution::output_width
+                                            * Distribution::input_width;
+
+        // In concurrent mode each call claims its range of the sequence
+        // up front and leaves the shared engine untouched; statistics
+        // are skipped because their event pool is not thread-safe
+        engine_type engine = m_engine;
+        if(m_concurrent)
+        {
+            engine.discard(m_claimed.fetch_add(num_applied_generators));
+        }
+        else
+        {
+            statistics.begin_launch(m_stream);
+        }
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            // The index-mapped kernel ties every output index to a fixed
+            // sequence position, so the grid only has to cover the fill
+            const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                (data_size + s_threads - 1) / s_threads, launch_blocks(data_size)));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_device_independent_kernel),
+                dim3(std::max(blocks, 1u)),
+                dim3(s_threads),
+                0,
+                m_stream,
+                engine,
+                data,
+                data_size,
+                distribution);
+        }
+        else
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                               dim3(launch_blocks(data_size)),
+                               dim3(s_threads),
+                               0,
+                               m_stream,
+                               engine,
+                               data,
+                               data_size,
+                               distribution);
+        }
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(!m_concurrent)
+        {
+            statistics.end_launch(data_size * sizeof(T), m_stream);
+
+            m_engine.discard(num_applied_generators);
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+
+    // Fills num_streams contiguous extents of the output with one
+    // launch per extent on the corresponding caller stream, each
+    // launch's engine skipped to the exact sequence position of its
+    // extent. The extents hold the same values as num_streams
+    // sequential generate() calls of the same sizes, and the
+    // generator's own stream waits on all of them, so work queued on it
+    // afterwards sees the whole fill.
+    template<class T, class Distribution = uniform_distribution<T, unsigned long long>>
+    rocrand_status generate_partitioned(T* data,
+                                        size_t data_size,
+                                        const hipStream_t* streams,
+                                        unsigned int num_streams,
+                                        Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        // Extents split on application boundaries, so every launch
+        // starts at an exact engine position
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+        const hipStream_t stream    = m_stream;
+        size_t            app_start = 0;
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            const size_t apps
+                = applications / num_streams + (k < applications % num_streams ? 1 : 0);
+            if(apps == 0)
+            {
+                break;
+            }
+            const size_t start = app_start * output_width;
+            const size_t count = std::min<size_t>(apps * output_width, data_size - start);
+            m_stream                    = streams[k];
+            const rocrand_status status = generate(data + start, count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_stream = stream;
+                return status;
+            }
+            app_start += apps;
+        }
+        m_stream = stream;
+
+        // Join the extents into the generator's stream
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            hipEvent_t event;
+            if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            if(hipEventRecord(event, streams[k]) != hipSuccess
+               || hipStreamWaitEvent(m_stream, event, 0) != hipSuccess)
+            {
+                hipEventDestroy(event);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipEventDestroy(event);
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T* data, size_t data_size)
+    {
+        uniform_distribution<T, unsigned long long> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T, unsigned long long> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T* data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T, unsigned long long> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T, unsigned long long> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T, unsigned long long> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T, unsigned long long> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2, unsigned long long> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3, unsigned long long> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4, unsigned long long> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T, unsigned long long> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T, unsigned long long> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int* data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T* data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T, unsigned long long> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char* data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char* data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
+    template<class T>
+    rocrand_status generate_poisson(T* data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int* data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Grid size of the next launch. The engine is counter-based, so the
+    // generated sequence does not depend on the grid; under
+    // ROCRAND_ORDERING_PSEUDO_DYNAMIC and ROCRAND_ORDERING_PSEUDO_FASTEST
+    // the grid follows the device's
+    // occupancy and shrinks for fills that can't fill it.
+    uint32_t launch_blocks(size_t data_size) const
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order) || m_dynamic_blocks == 0)
+        {
+            return s_blocks;
+        }
+        const size_t needed_blocks = (data_size + s_threads - 1) / s_threads;
+        return static_cast<uint32_t>(
+            std::min<size_t>(m_dynamic_blocks, std::max<size_t>(needed_blocks, 1)));
+    }
+
+    bool        m_engines_initialized;
+    engine_type m_engine;
+    uint32_t    m_dynamic_blocks;
+    // Concurrent mode; m_claimed counts the values claimed by
+    // generate() calls since the mode was enabled
+    bool                            m_concurrent;
+    std::atomic<unsigned long long> m_claimed;
+
+    const static uint32_t s_threads = 256;
+    const static uint32_t s_blocks  = 1024;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_PHILOX4X64_10_H_
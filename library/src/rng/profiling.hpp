@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PROFILING_H_
+#define ROCRAND_RNG_PROFILING_H_
+
+#include <cstdio>
+
+#include <rocrand/rocrand.h>
+
+#include "generator_type.hpp"
+
+#if !defined(_WIN32)
+    #include <dlfcn.h>
+#endif
+
+namespace rocrand_host {
+namespace detail {
+
+// roctx marker entry points, resolved from libroctx64 the first time
+// they are needed so the library annotates profiler traces when a
+// tracer is attached without linking against roctracer
+class roctx_api
+{
+public:
+    static const roctx_api& instance()
+    {
+        static const roctx_api api;
+        return api;
+    }
+
+    bool available() const
+    {
+        return m_range_push != NULL && m_range_pop != NULL;
+    }
+
+    void range_push(const char * name) const
+    {
+        m_range_push(name);
+    }
+
+    void range_pop() const
+    {
+        m_range_pop();
+    }
+
+private:
+    roctx_api()
+    {
+#if !defined(_WIN32)
+        // The handle is kept for the lifetime of the process
+        void * handle = dlopen("libroctx64.so", RTLD_NOW | RTLD_LOCAL);
+        if (handle == NULL)
+        {
+            handle = dlopen("libroctx64.so.4", RTLD_NOW | RTLD_LOCAL);
+        }
+        if (handle != NULL)
+        {
+            m_range_push
+                = reinterpret_cast<int (*)(const char *)>(dlsym(handle, "roctxRangePushA"));
+            m_range_pop = reinterpret_cast<int (*)()>(dlsym(handle, "roctxRangePop"));
+        }
+#endif
+    }
+
+    int (*m_range_push)(const char *) = NULL;
+    int (*m_range_pop)() = NULL;
+};
+
+// Short generator name used in profiler range labels
+inline const char * rng_type_name(rocrand_rng_type rng_type)
+{
+    switch(rng_type)
+    {
+        case ROCRAND_RNG_PSEUDO_XORWOW: return "xorwow";
+        case ROCRAND_RNG_PSEUDO_MRG32K3A: return "mrg32k3a";
+        case ROCRAND_RNG_PSEUDO_MTGP32: return "mtgp32";
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_10: return "philox4x32_10";
+        case ROCRAND_RNG_PSEUDO_MRG31K3P: return "mrg31k3p";
+        case ROCRAND_RNG_PSEUDO_LFSR113: return "lfsr113";
+        case ROCRAND_RNG_PSEUDO_MT19937: return "mt19937";
+        case ROCRAND_RNG_PSEUDO_THREEFRY2_32_20: return "threefry2x32_20";
+        case ROCRAND_RNG_PSEUDO_THREEFRY2_64_20: return "threefry2x64_20";
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20: return "threefry4x32_20";
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_64_20: return "threefry4x64_20";
+        case ROCRAND_RNG_PSEUDO_PCG64: return "pcg64";
+        case ROCRAND_RNG_PSEUDO_XOSHIRO256PP: return "xoshiro256pp";
+        case ROCRAND_RNG_PSEUDO_CHACHA20: return "chacha20";
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_7: return "philox4x32_7";
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_64_13: return "threefry4x64_13";
+        case ROCRAND_RNG_PSEUDO_SQUARES32: return "squares32";
+        case ROCRAND_RNG_PSEUDO_PHILOX4_64_10: return "philox4x64_10";
+        case ROCRAND_RNG_PSEUDO_WELL19937: return "well19937";
+        case ROCRAND_RNG_PSEUDO_ADAPTIVE: return "adaptive";
+        case ROCRAND_RNG_QUASI_SOBOL32: return "sobol32";
+        case ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32: return "scrambled_sobol32";
+        case ROCRAND_RNG_QUASI_SOBOL64: return "sobol64";
+        case ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64: return "scrambled_sobol64";
+        case ROCRAND_RNG_QUASI_SOBOL32_OWEN: return "sobol32_owen";
+        case ROCRAND_RNG_QUASI_HALTON: return "halton";
+        case ROCRAND_RNG_QUASI_LATTICE: return "lattice";
+        case ROCRAND_RNG_TAPE: return "tape";
+        default: return "unknown";
+    }
+}
+
+// Covers one C API call on a generator with a roctx range named after
+// the call and the generator type (see rocrand_set_profiling). The
+// range spans every kernel launch and copy the call issues on the host
+// thread, so a profiler attributes them to a readable name instead of a
+// mangled generate_kernel instantiation.
+class profile_range
+{
+public:
+    profile_range(const rocrand_generator_base_type * generator, const char * function)
+    {
+        if (generator == NULL || !generator->profiling)
+            return;
+        const roctx_api& api = roctx_api::instance();
+        if (!api.available())
+            return;
+
+        char name[128];
+        std::snprintf(name, sizeof(name), "%s [%s]",
+                      function, rng_type_name(generator->rng_type));
+        api.range_push(name);
+        m_open = true;
+    }
+
+    profile_range(const profile_range&) = delete;
+    profile_range& operator=(const profile_range&) = delete;
+
+    ~profile_range()
+    {
+        if (m_open)
+        {
+            roctx_api::instance().range_pop();
+        }
+    }
+
+private:
+    bool m_open = false;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PROFILING_H_
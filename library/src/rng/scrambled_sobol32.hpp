@@ -60,14 +60,21 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     size_t             index     = engine_id;
 
     // Each thread of the current block uses the same direction vectors and scrambling constant
-    // (the dimension is determined by blockIdx.y)
+    // (the dimension is determined by blockIdx.y); both are staged through
+    // LDS at block start so generation never rereads them from global
+    // memory, which matters when many dimensions thrash the cache
     __shared__ unsigned int vectors[32];
+    __shared__ unsigned int staged_constant;
     if(threadIdx.x < 32)
     {
         vectors[threadIdx.x] = direction_vectors[dimension * 32 + threadIdx.x];
     }
+    if(threadIdx.x == 0)
+    {
+        staged_constant = scramble_constants[dimension];
+    }
     __syncthreads();
-    const unsigned int scramble_constant = scramble_constants[dimension];
+    const unsigned int scramble_constant = staged_constant;
 
     data += dimension * n;
 
@@ -99,18 +106,16 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
         const size_t       vec_n     = (n - head_size) / output_per_thread;
 
         const unsigned int engine_offset
-            = engine_id * output_per_thread
-              + (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
+            = engine_id * output_per_thread + head_size;
         scrambled_sobol32_device_engine engine(vectors, scramble_constant, offset + engine_offset);
 
-        if(engine_id == 0)
+        // If data is not aligned by sizeof(vec_type): the head values
+        // are written by the first engines, one each, instead of
+        // serially by engine 0
+        if(engine_id < head_size)
         {
-            // If data is not aligned by sizeof(vec_type)
-            for(unsigned int o = 0; o < head_size; o++)
-            {
-                data[o] = distribution(engine.current());
-                engine.discard();
-            }
+            scrambled_sobol32_device_engine head_engine(vectors, scramble_constant, offset + engine_id);
+            data[engine_id] = distribution(head_engine.current());
         }
 
         vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
@@ -157,45 +162,19 @@ public:
     rocrand_scrambled_sobol32(unsigned long long offset = 0,
                               rocrand_ordering   order  = ROCRAND_ORDERING_QUASI_DEFAULT,
                               hipStream_t        stream = 0)
-        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_loaded_dimensions(0), m_direction_vectors(NULL), m_scramble_constants(NULL)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(reinterpret_cast<void**>(&m_direction_vectors),
-                          sizeof(unsigned int) * SCRAMBLED_SOBOL32_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors,
-                          rocrand_h_scrambled_sobol32_direction_vectors,
-                          sizeof(unsigned int) * SCRAMBLED_SOBOL32_N,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
-        // Allocate scramble constants
-        error = hipMalloc(reinterpret_cast<void**>(&m_scramble_constants),
-                          sizeof(unsigned int) * SCRAMBLED_SOBOL_DIM);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_scramble_constants,
-                          h_scrambled_sobol32_constants,
-                          sizeof(unsigned int) * SCRAMBLED_SOBOL_DIM,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
+        // Direction vectors and scramble constants are uploaded
+        // lazily by init() and sized to the dimensions in use, so
+        // only the used part of the precomputed tables is ever
+        // touched
     }
 
     ~rocrand_scrambled_sobol32()
     {
-        hipFree(m_direction_vectors);
-        hipFree(m_scramble_constants);
+        rocrand_host::detail::device_free(m_direction_vectors);
+        rocrand_host::detail::device_free(m_scramble_constants);
     }
 
     void reset()
@@ -209,6 +188,19 @@ public:
         m_initialized = false;
     }
 
+    // Advances the sequence by \p n points per dimension from the
+    // current position. The engines re-derive their state with the
+    // Gray-code skip at the next generate call, so the cost does not
+    // scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     void set_order(rocrand_ordering order)
     {
         m_order       = order;
@@ -233,6 +225,13 @@ public:
         if(m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_direction_vectors();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
         m_current_offset = static_cast<unsigned int>(m_offset);
         m_initialized    = true;
 
@@ -252,6 +251,8 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        statistics.begin_launch(m_stream);
+
         constexpr uint32_t threads    = 256;
         constexpr uint32_t max_blocks = 4096;
 
@@ -278,9 +279,11 @@ public:
             m_current_offset,
             distribution);
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         m_current_offset += size;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -307,6 +310,27 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         try
@@ -320,10 +344,68 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Uploads the direction vectors and scramble constants of the first
+    // m_dimensions rows of the precomputed tables to the device, so only
+    // the dimensions in use are allocated and faulted in
+    rocrand_status load_direction_vectors()
+    {
+        unsigned int* direction_vectors;
+        unsigned int* scramble_constants;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&direction_vectors),
+                          sizeof(unsigned int) * 32 * m_dimensions);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&scramble_constants),
+                          sizeof(unsigned int) * m_dimensions);
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMemcpy(direction_vectors,
+                          rocrand_h_scrambled_sobol32_direction_vectors,
+                          sizeof(unsigned int) * 32 * m_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error == hipSuccess)
+        {
+            error = hipMemcpy(scramble_constants,
+                              h_scrambled_sobol32_constants,
+                              sizeof(unsigned int) * m_dimensions,
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            rocrand_host::detail::device_free(scramble_constants);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free(m_direction_vectors);
+        rocrand_host::detail::device_free(m_scramble_constants);
+        m_direction_vectors = direction_vectors;
+        m_scramble_constants = scramble_constants;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool          m_initialized;
     unsigned int  m_dimensions;
     unsigned int  m_current_offset;
+    // Dimensions held on the device
+    unsigned int  m_loaded_dimensions;
     unsigned int* m_direction_vectors;
     unsigned int* m_scramble_constants;
 
@@ -21,6 +21,7 @@
 #ifndef ROCRAND_RNG_SCRAMBLED_SOBOL64_H_
 #define ROCRAND_RNG_SCRAMBLED_SOBOL64_H_
 
+#include "brownian_bridge.hpp"
 #include "common.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
@@ -34,6 +35,7 @@
 #include <hip/hip_runtime.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace rocrand_host
 {
@@ -42,6 +44,55 @@ namespace detail
 
 typedef ::rocrand_device::scrambled_sobol64_engine<true> scrambled_sobol64_device_engine;
 
+// Per-thread engine state that persists in device memory between
+// generate calls, so incremental draws resume where the previous call
+// stopped instead of re-deriving the state with the 64-step Gray-code
+// skip. The scramble constant and direction vectors are per dimension
+// and stay in their own arrays.
+struct sobol64_engine_state
+{
+    unsigned long long int d;
+    unsigned long long int i;
+};
+
+// Exposes loading and saving of the protected engine state, so that
+// per-thread engines can be stored in and restored from device memory
+class sobol64_persistent_engine : public ::rocrand_device::sobol64_engine<true>
+{
+public:
+    __forceinline__ __device__ sobol64_persistent_engine(const unsigned long long int* vectors,
+                                                         const unsigned int            offset)
+        : ::rocrand_device::sobol64_engine<true>(vectors, offset)
+    {}
+
+    __forceinline__ __device__ sobol64_persistent_engine(const unsigned long long int* vectors,
+                                                         const sobol64_engine_state&   state)
+    {
+        m_state.d       = state.d;
+        m_state.i       = state.i;
+        m_state.vectors = vectors;
+    }
+
+    __forceinline__ __device__ sobol64_engine_state save() const
+    {
+        return sobol64_engine_state{m_state.d, m_state.i};
+    }
+
+    __forceinline__ __device__ unsigned long long int index() const
+    {
+        return m_state.i;
+    }
+};
+
+// Number of persistent engines per dimension; the generation stride
+// must not change between calls for the stored states to line up
+constexpr unsigned int scrambled_sobol64_persistent_threads = 1024;
+
+// Batches of up to this many points per dimension go through the
+// persistent kernel, where the setup cost matters; larger batches use
+// the stateless kernel with vectorized stores
+constexpr size_t scrambled_sobol64_persistent_max_size = 16384;
+
 template<unsigned int OutputPerThread, class T, class Distribution>
 ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_kernel_64(
     T*                            data,
@@ -60,14 +111,21 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     size_t             index     = engine_id;
 
     // Each thread of the current block uses the same direction vectors and scrambling constant
-    // (the dimension is determined by blockIdx.y)
+    // (the dimension is determined by blockIdx.y); both are staged through
+    // LDS at block start so generation never rereads them from global
+    // memory, which matters when many dimensions thrash the cache
     __shared__ unsigned long long int vectors[64];
+    __shared__ unsigned long long int staged_constant;
     if(threadIdx.x < 64)
     {
         vectors[threadIdx.x] = direction_vectors[dimension * 64 + threadIdx.x];
     }
+    if(threadIdx.x == 0)
+    {
+        staged_constant = scramble_constants[dimension];
+    }
     __syncthreads();
-    const unsigned long long int scramble_constant = scramble_constants[dimension];
+    const unsigned long long int scramble_constant = staged_constant;
 
     data += dimension * n;
 
@@ -99,18 +157,16 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
         const size_t       vec_n     = (n - head_size) / output_per_thread;
 
         const unsigned int engine_offset
-            = engine_id * output_per_thread
-              + (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
+            = engine_id * output_per_thread + head_size;
         scrambled_sobol64_device_engine engine(vectors, scramble_constant, offset + engine_offset);
 
-        if(engine_id == 0)
+        // If data is not aligned by sizeof(vec_type): the head values
+        // are written by the first engines, one each, instead of
+        // serially by engine 0
+        if(engine_id < head_size)
         {
-            // If data is not aligned by sizeof(vec_type)
-            for(unsigned int o = 0; o < head_size; o++)
-            {
-                data[o] = distribution(engine.current());
-                engine.discard();
-            }
+            scrambled_sobol64_device_engine head_engine(vectors, scramble_constant, offset + engine_id);
+            data[engine_id] = distribution(head_engine.current());
         }
 
         vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
@@ -145,6 +201,133 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     }
 }
 
+template<class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_persistent_kernel_64(
+    T*                            data,
+    const size_t                  n,
+    const unsigned long long int* direction_vectors,
+    const unsigned long long int* scramble_constants,
+    sobol64_engine_state*         engine_states,
+    const bool                    resume,
+    const unsigned int            offset,
+    Distribution                  distribution)
+{
+    const unsigned int dimension = blockIdx.y;
+    const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+    size_t             index     = engine_id;
+
+    __shared__ unsigned long long int vectors[64];
+    __shared__ unsigned long long int staged_constant;
+    if(threadIdx.x < 64)
+    {
+        vectors[threadIdx.x] = direction_vectors[dimension * 64 + threadIdx.x];
+    }
+    if(threadIdx.x == 0)
+    {
+        staged_constant = scramble_constants[dimension];
+    }
+    __syncthreads();
+    const unsigned long long int scramble_constant = staged_constant;
+
+    sobol64_engine_state* state_slot = engine_states + dimension * stride + engine_id;
+
+    // Resuming restores the engine where the previous call left it,
+    // which skips the 64-step Gray-code state derivation entirely
+    sobol64_persistent_engine engine
+        = resume ? sobol64_persistent_engine(vectors, *state_slot)
+                 : sobol64_persistent_engine(vectors, offset + engine_id);
+
+    data += dimension * n;
+
+    while(index < n)
+    {
+        data[index] = distribution(engine.current() ^ scramble_constant);
+        engine.discard_stride(stride);
+        index += stride;
+    }
+
+    // Leave the engine at the next call's position. When \p n is a
+    // multiple of the stride the strided discards have already put it
+    // there; otherwise one full Gray-code skip realigns it, which costs
+    // no more than the setup the next call would otherwise pay.
+    const unsigned long long int target
+        = static_cast<unsigned long long int>(offset) + n + engine_id;
+    if(engine.index() != target)
+    {
+        engine.discard(target - engine.index());
+    }
+    *state_slot = engine.save();
+}
+
+// Emits Brownian paths with the bridge construction fused into the
+// generation kernel; see the sobol32 variant for the full description.
+// Each thread builds one path (one point) in registers from the plan
+// staged in shared memory and writes it out point major in a single
+// pass. Every value is derived directly from its dimension's direction
+// vectors and scramble constant, as consecutive values of a thread
+// belong to different dimensions and cannot share state.
+template<class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_brownian_bridge_kernel_64(
+    float*                        data,
+    const size_t                  n_paths,
+    const unsigned int            n_steps,
+    const unsigned long long int* direction_vectors,
+    const unsigned long long int* scramble_constants,
+    const unsigned int            offset,
+    const unsigned int*           bridge_nodes,
+    const float*                  bridge_values,
+    Distribution                  distribution)
+{
+    constexpr unsigned int max_steps = 64;
+
+    // The construction plan is the same for all paths
+    __shared__ unsigned int nodes[3 * max_steps];
+    __shared__ float        values[3 * max_steps];
+    for(unsigned int i = threadIdx.x; i < 3 * n_steps; i += blockDim.x)
+    {
+        nodes[i]  = bridge_nodes[i];
+        values[i] = bridge_values[i];
+    }
+    __syncthreads();
+
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+
+    for(size_t path = thread_id; path < n_paths; path += stride)
+    {
+        float w[max_steps];
+        for(unsigned int k = 0; k < n_steps; k++)
+        {
+            scrambled_sobol64_device_engine engine(direction_vectors + k * 64,
+                                                   scramble_constants[k],
+                                                   offset + path);
+            const float z = distribution(engine.current());
+
+            // An endpoint index of n_steps stands for time zero, where
+            // the path is fixed at 0
+            float              value = values[2 * n_steps + k] * z;
+            const unsigned int left  = nodes[n_steps + k];
+            const unsigned int right = nodes[2 * n_steps + k];
+            if(left != n_steps)
+            {
+                value += values[k] * w[left];
+            }
+            if(right != n_steps)
+            {
+                value += values[n_steps + k] * w[right];
+            }
+            w[nodes[k]] = value;
+        }
+
+        float* path_data = data + path * n_steps;
+        for(unsigned int k = 0; k < n_steps; k++)
+        {
+            path_data[k] = w[k];
+        }
+    }
+}
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -157,45 +340,24 @@ public:
     rocrand_scrambled_sobol64(unsigned long long offset = 0,
                               rocrand_ordering   order  = ROCRAND_ORDERING_QUASI_DEFAULT,
                               hipStream_t        stream = 0)
-        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_loaded_dimensions(0), m_direction_vectors(NULL), m_scramble_constants(NULL),
+          m_engine_states(NULL), m_engine_states_dimensions(0), m_engine_states_valid(false),
+          m_bridge_nodes(NULL), m_bridge_values(NULL)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(reinterpret_cast<void**>(&m_direction_vectors),
-                          sizeof(unsigned long long int) * SCRAMBLED_SOBOL64_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors,
-                          rocrand_h_scrambled_sobol64_direction_vectors,
-                          sizeof(unsigned long long int) * SCRAMBLED_SOBOL64_N,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
-        // Allocate scramble constants
-        error = hipMalloc(reinterpret_cast<void**>(&m_scramble_constants),
-                          sizeof(unsigned long long int) * SCRAMBLED_SOBOL_DIM);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_scramble_constants,
-                          h_scrambled_sobol64_constants,
-                          sizeof(unsigned long long int) * SCRAMBLED_SOBOL_DIM,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
+        // Direction vectors and scramble constants are uploaded
+        // lazily by init() and sized to the dimensions in use, so
+        // only the used part of the precomputed tables is ever
+        // touched
     }
 
     ~rocrand_scrambled_sobol64()
     {
-        hipFree(m_direction_vectors);
-        hipFree(m_scramble_constants);
+        rocrand_host::detail::device_free(m_direction_vectors);
+        rocrand_host::detail::device_free(m_scramble_constants);
+        rocrand_host::detail::device_free(m_engine_states);
+        rocrand_host::detail::device_free(m_bridge_nodes);
+        rocrand_host::detail::device_free(m_bridge_values);
     }
 
     void reset()
@@ -209,6 +371,19 @@ public:
         m_initialized = false;
     }
 
+    // Advances the sequence by \p n points per dimension from the
+    // current position. The engines re-derive their state with the
+    // Gray-code skip at the next generate call, so the cost does not
+    // scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     void set_order(rocrand_ordering order)
     {
         m_order       = order;
@@ -233,6 +408,13 @@ public:
         if(m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_direction_vectors();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
         m_current_offset = static_cast<unsigned int>(m_offset);
         m_initialized    = true;
 
@@ -242,8 +424,13 @@ public:
     template<class T, class Distribution = sobol_uniform_distribution<T>>
     rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
     {
+        // 8-byte outputs (double, unsigned long long) are packed two per
+        // thread so they are written with 16-byte vector stores; smaller
+        // outputs are packed into 4 bytes as before
         constexpr unsigned int output_per_thread
-            = sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
+            = sizeof(T) == sizeof(unsigned long long)
+                  ? 2
+                  : sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
 
         if(data_size % m_dimensions != 0)
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
@@ -252,10 +439,21 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        const size_t size = data_size / m_dimensions;
+
+        // Small batches are setup-bound: the per-thread state
+        // derivation costs more than the few values each thread
+        // produces, so they resume from engines kept on the device
+        if(size <= rocrand_host::detail::scrambled_sobol64_persistent_max_size)
+        {
+            return generate_persistent(data, data_size, size, distribution);
+        }
+
+        statistics.begin_launch(m_stream);
+
         constexpr uint32_t threads    = 256;
         constexpr uint32_t max_blocks = 4096;
 
-        const size_t   size             = data_size / m_dimensions;
         const uint32_t output_per_block = threads * output_per_thread;
         const uint32_t blocks
             = std::min(max_blocks,
@@ -278,9 +476,11 @@ public:
             m_current_offset,
             distribution);
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         m_current_offset += size;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -307,6 +507,27 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_poisson(T* data, size_t data_size, double lambda)
     {
@@ -321,12 +542,281 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    // Generates \p n_paths discrete Brownian motion paths over the time
+    // grid \p times (a host array of \p n_steps strictly increasing
+    // positive times) with the Brownian-bridge construction fused into
+    // the generation kernel. Path i is written point major to
+    // data[i * n_steps]. The call sets the generator to n_steps
+    // dimensions and advances the sequence by n_paths points.
+    rocrand_status generate_brownian_bridge(float*       data,
+                                            size_t       n_paths,
+                                            unsigned int n_steps,
+                                            const float* times)
+    {
+        if(n_steps == 0 || n_steps > s_max_bridge_steps || times == NULL)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // The construction consumes one dimension per time step
+        if(m_dimensions != n_steps)
+        {
+            const rocrand_status dim_status = set_dimensions(n_steps);
+            if(dim_status != ROCRAND_STATUS_SUCCESS)
+                return dim_status;
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = upload_bridge_plan(n_steps, times);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        constexpr uint32_t threads    = 256;
+        constexpr uint32_t max_blocks = 4096;
+        const uint32_t     blocks
+            = std::min(max_blocks, static_cast<uint32_t>((n_paths + threads - 1) / threads));
+        sobol_normal_distribution<float> distribution(0.0f, 1.0f);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_brownian_bridge_kernel_64),
+            dim3(blocks),
+            dim3(threads),
+            0,
+            m_stream,
+            data,
+            n_paths,
+            n_steps,
+            m_direction_vectors,
+            m_scramble_constants,
+            m_current_offset,
+            static_cast<const unsigned int*>(m_bridge_nodes),
+            static_cast<const float*>(m_bridge_values),
+            distribution);
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(n_paths * n_steps * sizeof(float), m_stream);
+
+        m_current_offset += n_paths;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 private:
+    // Generates through per-thread engines that persist in device
+    // memory, resuming them in place when the generator's position
+    // matches where the previous call left them
+    template<class T, class Distribution>
+    rocrand_status generate_persistent(T* data, size_t data_size, size_t size,
+                                       Distribution distribution)
+    {
+        constexpr uint32_t threads = 256;
+
+        if(m_engine_states_dimensions < m_dimensions)
+        {
+            rocrand_host::detail::sobol64_engine_state* engine_states;
+            hipError_t error = rocrand_host::detail::device_malloc(
+                reinterpret_cast<void**>(&engine_states),
+                sizeof(rocrand_host::detail::sobol64_engine_state)
+                    * rocrand_host::detail::scrambled_sobol64_persistent_threads * m_dimensions);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_engine_states);
+            m_engine_states            = engine_states;
+            m_engine_states_dimensions = m_dimensions;
+            m_engine_states_valid      = false;
+            statistics.count_reallocation();
+        }
+
+        // The stored states continue the sequence only from the exact
+        // position they were saved at; set_offset, skip_ahead and
+        // generate through the stateless kernel all move
+        // m_current_offset, which this comparison detects
+        const bool resume = m_engine_states_valid && m_engine_states_offset == m_current_offset;
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t blocks_x
+            = rocrand_host::detail::scrambled_sobol64_persistent_threads / threads;
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_persistent_kernel_64),
+            dim3(blocks_x, blocks_y),
+            dim3(threads),
+            0,
+            m_stream,
+            data,
+            size,
+            m_direction_vectors,
+            m_scramble_constants,
+            m_engine_states,
+            resume,
+            m_current_offset,
+            distribution);
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        m_current_offset += size;
+        m_engine_states_offset = m_current_offset;
+        m_engine_states_valid  = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Builds the Brownian-bridge construction plan on the host and
+    // uploads it, reusing the device copy when the time grid has not
+    // changed since the last call (the common case of a pricing loop
+    // generating batch after batch over one grid)
+    rocrand_status upload_bridge_plan(unsigned int n_steps, const float* times)
+    {
+        if(m_bridge_nodes != NULL && m_bridge_times.size() == n_steps
+           && std::equal(m_bridge_times.begin(), m_bridge_times.end(), times))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_host::detail::brownian_bridge_plan plan;
+        const rocrand_status status
+            = rocrand_host::detail::build_brownian_bridge_plan(times, n_steps, plan);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(m_bridge_times.size() != n_steps)
+        {
+            rocrand_host::detail::device_free(m_bridge_nodes);
+            rocrand_host::detail::device_free(m_bridge_values);
+            m_bridge_nodes  = NULL;
+            m_bridge_values = NULL;
+            m_bridge_times.clear();
+
+            hipError_t error
+                = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_bridge_nodes),
+                                                      sizeof(unsigned int) * 3 * n_steps);
+            if(error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(
+                    reinterpret_cast<void**>(&m_bridge_values), sizeof(float) * 3 * n_steps);
+            }
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(m_bridge_nodes);
+                m_bridge_nodes = NULL;
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            statistics.count_reallocation();
+        }
+
+        hipError_t error = hipMemcpy(m_bridge_nodes,
+                                     plan.nodes.data(),
+                                     sizeof(unsigned int) * 3 * n_steps,
+                                     hipMemcpyHostToDevice);
+        if(error == hipSuccess)
+        {
+            error = hipMemcpy(m_bridge_values,
+                              plan.values.data(),
+                              sizeof(float) * 3 * n_steps,
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            m_bridge_times.clear();
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        m_bridge_times.assign(times, times + n_steps);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Uploads the direction vectors and scramble constants of the first
+    // m_dimensions rows of the precomputed tables to the device, so only
+    // the dimensions in use are allocated and faulted in
+    rocrand_status load_direction_vectors()
+    {
+        unsigned long long int* direction_vectors;
+        unsigned long long int* scramble_constants;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&direction_vectors),
+                          sizeof(unsigned long long int) * 64 * m_dimensions);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&scramble_constants),
+                          sizeof(unsigned long long int) * m_dimensions);
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMemcpy(direction_vectors,
+                          rocrand_h_scrambled_sobol64_direction_vectors,
+                          sizeof(unsigned long long int) * 64 * m_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error == hipSuccess)
+        {
+            error = hipMemcpy(scramble_constants,
+                              h_scrambled_sobol64_constants,
+                              sizeof(unsigned long long int) * m_dimensions,
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            rocrand_host::detail::device_free(scramble_constants);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free(m_direction_vectors);
+        rocrand_host::detail::device_free(m_scramble_constants);
+        m_direction_vectors = direction_vectors;
+        m_scramble_constants = scramble_constants;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool                    m_initialized;
     unsigned int            m_dimensions;
     unsigned int            m_current_offset;
+    // Dimensions held on the device
+    unsigned int            m_loaded_dimensions;
     unsigned long long int* m_direction_vectors;
     unsigned long long int* m_scramble_constants;
+    // Per-thread engine states persisting between generate calls, the
+    // point index they were saved at and whether they have been seeded
+    rocrand_host::detail::sobol64_engine_state* m_engine_states;
+    unsigned int                                m_engine_states_dimensions;
+    unsigned int                                m_engine_states_offset;
+    bool                                        m_engine_states_valid;
+
+    // Device copy of the Brownian-bridge construction plan and the time
+    // grid it was built from; the register budget of the bridge
+    // kernel's per-path array caps the step count
+    static const unsigned int s_max_bridge_steps = 64;
+    unsigned int*             m_bridge_nodes;
+    float*                    m_bridge_values;
+    std::vector<float>        m_bridge_times;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
@@ -0,0 +1,96 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SEEDED_H_
+#define ROCRAND_RNG_SEEDED_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+
+namespace rocrand_host
+{
+namespace detail
+{
+
+// Seed-array generation (see rocrand_generate_seeded): value i is drawn
+// from the stream that seeds[i] keys, so it depends on seeds[i] and the
+// generator's offset only, not on the position of i in the fill. The
+// counter-based engines initialize in constant time, which makes a fresh
+// engine per element no more expensive than the constant-cost skip the
+// sequential kernels already pay per iteration. Engines with 64-bit
+// output are truncated to the low word, matching the 32-bit output type
+// of the C entry point.
+template<class EngineType>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void
+    generate_seeded_kernel(const unsigned long long* seeds,
+                           unsigned int*             data,
+                           const size_t              n,
+                           const unsigned long long  offset)
+{
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+
+    for(size_t i = thread_id; i < n; i += stride)
+    {
+        EngineType engine(seeds[i], 0, offset);
+        data[i] = static_cast<unsigned int>(engine());
+    }
+}
+
+// Out-of-line target of the generators' generate_seeded() methods. The
+// fill does not consume generator state: every element is positioned by
+// its own seed, so calls are independent of previous generate calls and
+// of each other.
+template<class EngineType>
+inline rocrand_status generate_seeded(const unsigned long long* seeds,
+                                      unsigned int*             data,
+                                      size_t                    data_size,
+                                      unsigned long long        offset,
+                                      hipStream_t               stream)
+{
+    const uint32_t threads = 256;
+    const uint32_t blocks  = static_cast<uint32_t>(
+        std::min<size_t>((data_size + threads - 1) / threads, 1024));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(generate_seeded_kernel<EngineType>),
+                       dim3(std::max(blocks, 1u)),
+                       dim3(threads),
+                       0,
+                       stream,
+                       seeds,
+                       data,
+                       data_size,
+                       offset);
+    // Check kernel status
+    if(hipGetLastError() != hipSuccess)
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SEEDED_H_
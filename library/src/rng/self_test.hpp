@@ -0,0 +1,71 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SELF_TEST_H_
+#define ROCRAND_RNG_SELF_TEST_H_
+
+#include <cstddef>
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Position-weighted digest of a generated block, used by
+// rocrand_self_test(). The per-element contributions are summed, so
+// the digest is independent of the thread schedule, while the odd
+// position weights make it sensitive to reordered or swapped values.
+__host__ __device__ inline unsigned long long
+    self_test_digest_term(unsigned int value, size_t index)
+{
+    return static_cast<unsigned long long>(value) * (2ULL * index + 1ULL);
+}
+
+__global__ __launch_bounds__(256) void self_test_digest_kernel(const unsigned int * data,
+                                                               size_t n,
+                                                               unsigned long long * digest)
+{
+    const size_t id     = blockIdx.x * blockDim.x + threadIdx.x;
+    const size_t stride = gridDim.x * blockDim.x;
+
+    unsigned long long sum = 0;
+    for(size_t i = id; i < n; i += stride)
+    {
+        sum += self_test_digest_term(data[i], i);
+    }
+    atomicAdd(digest, sum);
+}
+
+// The same digest computed by the host compiler, so a device
+// miscompilation of the digest itself cannot mask a corrupt block
+inline unsigned long long self_test_digest_host(const unsigned int * data, size_t n)
+{
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        sum += self_test_digest_term(data[i], i);
+    }
+    return sum;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SELF_TEST_H_
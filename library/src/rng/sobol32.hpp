@@ -27,10 +27,14 @@
 #include <rocrand/rocrand.h>
 #include <rocrand/rocrand_sobol32_precomputed.h>
 
+#include "brownian_bridge.hpp"
 #include "common.hpp"
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "sobol_direction_vectors.hpp"
+
+#include <vector>
 
 namespace rocrand_host {
 namespace detail {
@@ -94,18 +98,16 @@ namespace detail {
             const size_t vec_n = (n - head_size) / output_per_thread;
 
             const unsigned int engine_offset =
-                engine_id * output_per_thread +
-                (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
+                engine_id * output_per_thread + head_size;
             sobol32_device_engine engine(vectors, offset + engine_offset);
 
-            if(engine_id == 0)
+            // If data is not aligned by sizeof(vec_type): the head values
+            // are written by the first engines, one each, instead of
+            // serially by engine 0
+            if(engine_id < head_size)
             {
-                // If data is not aligned by sizeof(vec_type)
-                for(unsigned int o = 0; o < head_size; o++)
-                {
-                    data[o] = distribution(engine.current());
-                    engine.discard();
-                }
+                sobol32_device_engine head_engine(vectors, offset + engine_id);
+                data[engine_id] = distribution(head_engine.current());
             }
 
             vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
@@ -140,6 +142,219 @@ namespace detail {
         }
     }
 
+    // Writes point-major output: all dimensions of point i are
+    // contiguous at data[i * dimensions]. Every block computes a tile of
+    // blockDim.x points for a chunk of dimensions into LDS, then the
+    // tile is written out cooperatively so that consecutive threads
+    // store consecutive dimensions of the same point. Each value is
+    // derived directly from the direction vectors (the engine
+    // constructor performs the Gray-code skip), as consecutive values of
+    // a thread belong to different dimensions and cannot share state.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_point_major_kernel(T * data, const size_t n,
+                                     const unsigned int dimensions,
+                                     const unsigned int * direction_vectors,
+                                     const unsigned int offset,
+                                     Distribution distribution)
+    {
+        constexpr unsigned int tile_dimensions = 16;
+        __shared__ T tile[256][tile_dimensions + 1]; // +1 avoids bank conflicts
+
+        for(size_t point_base = blockIdx.x * blockDim.x;
+            point_base < n;
+            point_base += gridDim.x * blockDim.x)
+        {
+            for(unsigned int dimension_base = 0;
+                dimension_base < dimensions;
+                dimension_base += tile_dimensions)
+            {
+                const unsigned int tile_size
+                    = min(tile_dimensions, dimensions - dimension_base);
+                for(unsigned int d = 0; d < tile_size; d++)
+                {
+                    sobol32_device_engine engine(
+                        direction_vectors + (dimension_base + d) * 32,
+                        offset + point_base + threadIdx.x);
+                    tile[threadIdx.x][d] = distribution(engine.current());
+                }
+                __syncthreads();
+
+                for(unsigned int i = threadIdx.x;
+                    i < blockDim.x * tile_size;
+                    i += blockDim.x)
+                {
+                    const unsigned int p = i / tile_size;
+                    if(point_base + p < n)
+                    {
+                        data[(point_base + p) * dimensions + dimension_base + i % tile_size]
+                            = tile[p][i % tile_size];
+                    }
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    // Writes blocked output: consecutive points are grouped into tiles
+    // of tile_points, and within a tile each dimension's values are
+    // contiguous, so all dimensions of one point span one tile instead
+    // of the whole buffer. The host sizes the tiles so one tile stays
+    // resident in the L2 cache while a consumer walks it. When
+    // padded_dimensions exceeds dimensions, the tiles are laid out with
+    // the padded stride and the padding values are left unwritten. As
+    // in the point-major kernel each value is derived directly from the
+    // direction vectors; a fixed dimension is stored by consecutive
+    // threads to consecutive addresses, so the stores coalesce without
+    // a shared memory transpose.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_blocked_kernel(T * data, const size_t n,
+                                 const unsigned int dimensions,
+                                 const unsigned int padded_dimensions,
+                                 const unsigned int tile_points,
+                                 const unsigned int * direction_vectors,
+                                 const unsigned int offset,
+                                 Distribution distribution)
+    {
+        for(size_t point = blockIdx.x * blockDim.x + threadIdx.x;
+            point < n;
+            point += gridDim.x * blockDim.x)
+        {
+            const size_t tile_start = (point / tile_points) * tile_points;
+            // The last tile holds the remaining points with a matching
+            // smaller width, so the output stays dense
+            const unsigned int width = n - tile_start < tile_points
+                ? static_cast<unsigned int>(n - tile_start)
+                : tile_points;
+            T * tile_data = data + tile_start * padded_dimensions;
+            const unsigned int p = static_cast<unsigned int>(point - tile_start);
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                sobol32_device_engine engine(direction_vectors + d * 32,
+                                             offset + point);
+                tile_data[d * width + p] = distribution(engine.current());
+            }
+        }
+    }
+
+    // Writes a float view and a double view of the same integer
+    // sequence in one pass. Generating the views separately would read
+    // the direction vectors and derive the engine states twice; here
+    // both conversions share one engine, so the second view costs only
+    // its stores.
+    template<class FloatDistribution, class DoubleDistribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_dual_kernel(float * float_data, double * double_data,
+                              const size_t n,
+                              const unsigned int * direction_vectors,
+                              const unsigned int offset,
+                              FloatDistribution float_distribution,
+                              DoubleDistribution double_distribution)
+    {
+        const unsigned int dimension = blockIdx.y;
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+        size_t index = engine_id;
+
+        // Each thread of the current block use the same direction vectors
+        // (the dimension is determined by blockIdx.y)
+        __shared__ unsigned int vectors[32];
+        if(threadIdx.x < 32)
+        {
+            vectors[threadIdx.x] = direction_vectors[dimension * 32 + threadIdx.x];
+        }
+        __syncthreads();
+
+        float_data += dimension * n;
+        double_data += dimension * n;
+
+        sobol32_device_engine engine(vectors, offset + engine_id);
+
+        while(index < n)
+        {
+            const unsigned int v = engine.current();
+            float_data[index] = float_distribution(v);
+            double_data[index] = double_distribution(v);
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+    // Emits Brownian paths with the bridge construction fused into the
+    // generation kernel. Construction step k of the plan (see
+    // brownian_bridge.hpp) consumes dimension k of a point, so the
+    // lowest dimensions carry the largest variances of the path — the
+    // pairing the bridge construction exists for with low-discrepancy
+    // points. Each thread builds one path (one point) in registers and
+    // writes it out point major in a single pass, so no separate gather
+    // or reordering pass over the output remains. Like the point-major
+    // kernel, every value is derived directly from its dimension's
+    // direction vectors (the engine constructor performs the Gray-code
+    // skip), as consecutive values of a thread belong to different
+    // dimensions and cannot share state.
+    template<class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_brownian_bridge_kernel(float * data, const size_t n_paths,
+                                         const unsigned int n_steps,
+                                         const unsigned int * direction_vectors,
+                                         const unsigned int offset,
+                                         const unsigned int * bridge_nodes,
+                                         const float * bridge_values,
+                                         Distribution distribution)
+    {
+        constexpr unsigned int max_steps = 64;
+
+        // The construction plan is the same for all paths
+        __shared__ unsigned int nodes[3 * max_steps];
+        __shared__ float values[3 * max_steps];
+        for(unsigned int i = threadIdx.x; i < 3 * n_steps; i += blockDim.x)
+        {
+            nodes[i] = bridge_nodes[i];
+            values[i] = bridge_values[i];
+        }
+        __syncthreads();
+
+        const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        for(size_t path = thread_id; path < n_paths; path += stride)
+        {
+            float w[max_steps];
+            for(unsigned int k = 0; k < n_steps; k++)
+            {
+                sobol32_device_engine engine(direction_vectors + k * 32,
+                                             offset + path);
+                const float z = distribution(engine.current());
+
+                // An endpoint index of n_steps stands for time zero,
+                // where the path is fixed at 0
+                float value = values[2 * n_steps + k] * z;
+                const unsigned int left  = nodes[n_steps + k];
+                const unsigned int right = nodes[2 * n_steps + k];
+                if(left != n_steps)
+                {
+                    value += values[k] * w[left];
+                }
+                if(right != n_steps)
+                {
+                    value += values[n_steps + k] * w[right];
+                }
+                w[nodes[k]] = value;
+            }
+
+            float * path_data = data + path * n_steps;
+            for(unsigned int k = 0; k < n_steps; k++)
+            {
+                path_data[k] = w[k];
+            }
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -152,29 +367,20 @@ public:
     rocrand_sobol32(unsigned long long offset = 0,
                     rocrand_ordering   order  = ROCRAND_ORDERING_QUASI_DEFAULT,
                     hipStream_t        stream = 0)
-        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_layout(ROCRAND_QUASI_LAYOUT_DIMENSION_MAJOR), m_l2_bytes(0), m_loaded_dimensions(0),
+          m_direction_vectors(NULL), m_bridge_nodes(NULL), m_bridge_values(NULL)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(reinterpret_cast<void**>(&m_direction_vectors),
-                          sizeof(unsigned int) * SOBOL32_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors,
-                          rocrand_h_sobol32_direction_vectors,
-                          sizeof(unsigned int) * SOBOL32_N,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
+        // Direction vectors are uploaded lazily by init() and sized to
+        // the dimensions in use, so only the used part of the
+        // precomputed table is ever touched
     }
 
     ~rocrand_sobol32()
     {
-        hipFree(m_direction_vectors);
+        rocrand_host::detail::device_free_async(m_direction_vectors, m_stream);
+        rocrand_host::detail::device_free_async(m_bridge_nodes, m_stream);
+        rocrand_host::detail::device_free_async(m_bridge_values, m_stream);
     }
 
     void reset()
@@ -188,6 +394,19 @@ public:
         m_initialized = false;
     }
 
+    // Advances the sequence by \p n points per dimension from the
+    // current position. The engines re-derive their state with the
+    // Gray-code skip at the next generate call, so the cost does not
+    // scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     void set_order(rocrand_ordering order)
     {
         m_order       = order;
@@ -196,22 +415,47 @@ public:
 
     rocrand_status set_dimensions(unsigned int dimensions)
     {
-        if(dimensions < 1 || dimensions > SOBOL_DIM)
+        if(dimensions < 1)
         {
             return ROCRAND_STATUS_OUT_OF_RANGE;
         }
 
+        // Dimensions beyond the precomputed table are constructed on
+        // demand, so the dimension count is not capped by its size
+        if(dimensions > SOBOL_DIM)
+        {
+            const rocrand_status status = extend_direction_vectors(dimensions);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
         m_dimensions = dimensions;
         m_initialized = false;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    // The layout only selects the generation kernel, so it does not
+    // reset the generator's state
+    void set_layout(rocrand_quasi_layout layout)
+    {
+        m_layout = layout;
+    }
+
     rocrand_status init()
     {
         if (m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_direction_vectors();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
         m_current_offset = static_cast<unsigned int>(m_offset);
         m_initialized = true;
 
@@ -225,13 +469,31 @@ public:
         constexpr unsigned int output_per_thread =
             sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
 
-        if (data_size % m_dimensions != 0)
+        // The padded blocked layout stores (and counts) a power-of-two
+        // number of values per point
+        const unsigned int stride_dimensions
+            = m_layout == ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED
+                  ? static_cast<unsigned int>(next_power2(m_dimensions))
+                  : m_dimensions;
+        if (data_size % stride_dimensions != 0)
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
 
         rocrand_status status = init();
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        if(m_layout == ROCRAND_QUASI_LAYOUT_POINT_MAJOR)
+        {
+            return generate_point_major(data, data_size, distribution);
+        }
+        if(m_layout == ROCRAND_QUASI_LAYOUT_BLOCKED
+           || m_layout == ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED)
+        {
+            return generate_blocked(data, data_size, stride_dimensions, distribution);
+        }
+
+        statistics.begin_launch(m_stream);
+
         const uint32_t threads = 256;
         const uint32_t max_blocks = 4096;
 
@@ -254,9 +516,11 @@ public:
             distribution
         );
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         m_current_offset += size;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -269,6 +533,58 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    // Generates a float view and a double view of the same points in
+    // one launch; both buffers receive data_size values and the offset
+    // advances as for a single generate call
+    template<class FloatDistribution = sobol_uniform_distribution<float>,
+             class DoubleDistribution = sobol_uniform_distribution<double> >
+    rocrand_status generate_uniform_dual(float * float_data, double * double_data,
+                                         size_t data_size,
+                                         FloatDistribution float_distribution
+                                             = FloatDistribution(),
+                                         DoubleDistribution double_distribution
+                                             = DoubleDistribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + threads - 1) / threads)
+        );
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_dual_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            float_data, double_data, size,
+            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            float_distribution, double_distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * (sizeof(float) + sizeof(double)), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
@@ -283,6 +599,27 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
@@ -296,11 +633,341 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    // Generates \p n_paths discrete Brownian motion paths over the time
+    // grid \p times (a host array of \p n_steps strictly increasing
+    // positive times) with the Brownian-bridge construction fused into
+    // the generation kernel. Path i is written point major to
+    // data[i * n_steps]. The call sets the generator to n_steps
+    // dimensions and advances the sequence by n_paths points.
+    rocrand_status generate_brownian_bridge(float * data, size_t n_paths,
+                                            unsigned int n_steps,
+                                            const float * times)
+    {
+        if(n_steps == 0 || n_steps > s_max_bridge_steps || times == NULL)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // The construction consumes one dimension per time step
+        if(m_dimensions != n_steps)
+        {
+            const rocrand_status dim_status = set_dimensions(n_steps);
+            if(dim_status != ROCRAND_STATUS_SUCCESS)
+                return dim_status;
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = upload_bridge_plan(n_steps, times);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((n_paths + threads - 1) / threads)
+        );
+        sobol_normal_distribution<float> distribution(0.0f, 1.0f);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_brownian_bridge_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, n_paths, n_steps,
+            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            static_cast<const unsigned int*>(m_bridge_nodes),
+            static_cast<const float*>(m_bridge_values),
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(n_paths * n_steps * sizeof(float), m_stream);
+
+        m_current_offset += n_paths;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 private:
+    // Extends the host-side cache to \p dimensions rows by streaming
+    // further rows from consecutive primitive polynomials. The cached
+    // rows are kept so extending again continues where the last call
+    // stopped; crossing the precomputed table for the first time
+    // enumerates all earlier polynomials once, which takes a few seconds.
+    rocrand_status extend_direction_vectors(unsigned int dimensions)
+    {
+        try
+        {
+            const unsigned int generated
+                = SOBOL_DIM + static_cast<unsigned int>(m_extended_vectors.size() / 32);
+            if(dimensions > generated)
+            {
+                rocrand_host::detail::sobol32_direction_vectors(generated,
+                                                                dimensions - generated,
+                                                                m_extended_vectors);
+            }
+        }
+        catch(const std::bad_alloc&)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Uploads the direction vectors of the first m_dimensions rows to
+    // the device, taking rows from the precomputed table and, past its
+    // end, from the host-side cache of streamed rows. Only the
+    // dimensions in use are allocated and faulted in.
+    rocrand_status load_direction_vectors()
+    {
+        const unsigned int table_dimensions = std::min(m_dimensions, SOBOL_DIM + 0u);
+
+        unsigned int * direction_vectors;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc_async(
+                          reinterpret_cast<void**>(&direction_vectors),
+                          sizeof(unsigned int) * 32 * m_dimensions,
+                          m_stream);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        // The vectors were allocated in the stream's order; make them
+        // visible to the null-stream uploads below
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+        {
+            rocrand_host::detail::device_free_async(direction_vectors, m_stream);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        error = hipMemcpy(direction_vectors,
+                          rocrand_h_sobol32_direction_vectors,
+                          sizeof(unsigned int) * 32 * table_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error == hipSuccess && m_dimensions > table_dimensions)
+        {
+            error = hipMemcpy(direction_vectors + 32 * table_dimensions,
+                              m_extended_vectors.data(),
+                              sizeof(unsigned int) * 32 * (m_dimensions - table_dimensions),
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free_async(direction_vectors, m_stream);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free_async(m_direction_vectors, m_stream);
+        m_direction_vectors = direction_vectors;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Builds the Brownian-bridge construction plan on the host and
+    // uploads it, reusing the device copy when the time grid has not
+    // changed since the last call (the common case of a pricing loop
+    // generating batch after batch over one grid)
+    rocrand_status upload_bridge_plan(unsigned int n_steps, const float * times)
+    {
+        if(m_bridge_nodes != NULL && m_bridge_times.size() == n_steps
+           && std::equal(m_bridge_times.begin(), m_bridge_times.end(), times))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_host::detail::brownian_bridge_plan plan;
+        const rocrand_status status
+            = rocrand_host::detail::build_brownian_bridge_plan(times, n_steps, plan);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(m_bridge_times.size() != n_steps)
+        {
+            rocrand_host::detail::device_free_async(m_bridge_nodes, m_stream);
+            rocrand_host::detail::device_free_async(m_bridge_values, m_stream);
+            m_bridge_nodes = NULL;
+            m_bridge_values = NULL;
+            m_bridge_times.clear();
+
+            hipError_t error = rocrand_host::detail::device_malloc_async(
+                reinterpret_cast<void**>(&m_bridge_nodes),
+                sizeof(unsigned int) * 3 * n_steps,
+                m_stream);
+            if(error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc_async(
+                    reinterpret_cast<void**>(&m_bridge_values),
+                    sizeof(float) * 3 * n_steps,
+                    m_stream);
+            }
+            if(error == hipSuccess)
+            {
+                // Make the stream-ordered allocations visible to the
+                // null-stream uploads below
+                error = hipStreamSynchronize(m_stream);
+            }
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free_async(m_bridge_nodes, m_stream);
+                rocrand_host::detail::device_free_async(m_bridge_values, m_stream);
+                m_bridge_nodes = NULL;
+                m_bridge_values = NULL;
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            statistics.count_reallocation();
+        }
+
+        hipError_t error = hipMemcpy(m_bridge_nodes, plan.nodes.data(),
+                                     sizeof(unsigned int) * 3 * n_steps,
+                                     hipMemcpyHostToDevice);
+        if(error == hipSuccess)
+        {
+            error = hipMemcpy(m_bridge_values, plan.values.data(),
+                              sizeof(float) * 3 * n_steps,
+                              hipMemcpyHostToDevice);
+        }
+        if(error != hipSuccess)
+        {
+            m_bridge_times.clear();
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        m_bridge_times.assign(times, times + n_steps);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_point_major(T * data, size_t data_size,
+                                        Distribution distribution)
+    {
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + threads - 1) / threads)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_point_major_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, size, m_dimensions,
+            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution>
+    rocrand_status generate_blocked(T * data, size_t data_size,
+                                    unsigned int padded_dimensions,
+                                    Distribution distribution)
+    {
+        const size_t size = data_size / padded_dimensions;
+
+        // Size the tiles so one tile of (points x dimensions) fits in
+        // half of the L2 cache; the floor of 64 points keeps the
+        // per-dimension stores coalesced even for very many dimensions
+        if(m_l2_bytes == 0)
+        {
+            int device;
+            int l2_size = 0;
+            if(hipGetDevice(&device) != hipSuccess
+               || hipDeviceGetAttribute(&l2_size, hipDeviceAttributeL2CacheSize, device)
+                      != hipSuccess
+               || l2_size <= 0)
+            {
+                l2_size = 4 << 20;
+            }
+            m_l2_bytes = static_cast<size_t>(l2_size);
+        }
+        const size_t tile_target = m_l2_bytes / 2;
+        unsigned int tile_points = 64;
+        while(tile_points < 16384
+              && static_cast<size_t>(tile_points) * 2 * padded_dimensions * sizeof(T)
+                     <= tile_target)
+        {
+            tile_points *= 2;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + threads - 1) / threads)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_blocked_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, size, m_dimensions, padded_dimensions, tile_points,
+            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // The padding values are laid out but never generated
+        statistics.end_launch(size * m_dimensions * sizeof(T), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool m_initialized;
     unsigned int m_dimensions;
+    rocrand_quasi_layout m_layout;
+    // L2 size of the device, queried lazily for sizing blocked tiles
+    size_t m_l2_bytes;
     unsigned int m_current_offset;
+    // Dimensions held in m_direction_vectors on the device
+    unsigned int m_loaded_dimensions;
     unsigned int * m_direction_vectors;
+    // Host-side cache of the rows streamed past the precomputed table
+    std::vector<unsigned int> m_extended_vectors;
+
+    // Device copy of the Brownian-bridge construction plan and the time
+    // grid it was built from; the register budget of the bridge
+    // kernel's per-path array caps the step count
+    static const unsigned int s_max_bridge_steps = 64;
+    unsigned int * m_bridge_nodes;
+    float * m_bridge_values;
+    std::vector<float> m_bridge_times;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
@@ -0,0 +1,571 @@
+// Copyright (c) 2017-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL32_OWEN_H_
+#define ROCRAND_RNG_SOBOL32_OWEN_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_sobol32_precomputed.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    typedef ::rocrand_device::sobol32_engine<true> sobol32_owen_device_engine;
+
+    // Hash-based Owen scrambling (Laine-Karras style). Applied in the
+    // bit-reversed domain the hash only lets lower bits perturb higher
+    // ones, which is exactly a random traversal of the Owen scrambling
+    // tree: every sample falling into the same dyadic interval is
+    // permuted the same way.
+    __forceinline__ __device__ __host__
+    unsigned int sobol32_owen_scramble(unsigned int x, const unsigned int seed)
+    {
+        #if defined(__HIP_DEVICE_COMPILE__)
+        x = __brev(x);
+        #else
+        unsigned int r = 0;
+        for(unsigned int bit = 0; bit < 32; bit++)
+        {
+            r = (r << 1) | ((x >> bit) & 1);
+        }
+        x = r;
+        #endif
+
+        x += seed;
+        x ^= x * 0x6c50b47cU;
+        x ^= x * 0xb82f1e52U;
+        x ^= x * 0xc7afe638U;
+        x ^= x * 0x8d22f6e6U;
+
+        #if defined(__HIP_DEVICE_COMPILE__)
+        return __brev(x);
+        #else
+        r = 0;
+        for(unsigned int bit = 0; bit < 32; bit++)
+        {
+            r = (r << 1) | ((x >> bit) & 1);
+        }
+        return r;
+        #endif
+    }
+
+    // Derives an independent scramble seed for every dimension from the
+    // generator's seed (splitmix64 finalizer)
+    __forceinline__ __device__ __host__
+    unsigned int sobol32_owen_dimension_seed(const unsigned long long seed,
+                                             const unsigned int dimension)
+    {
+        unsigned long long s = seed + 0x9e3779b97f4a7c15ULL * (dimension + 1);
+        s = (s ^ (s >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        s = (s ^ (s >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<unsigned int>(s >> 32);
+    }
+
+    template<unsigned int OutputPerThread, class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_kernel(T * data, const size_t n,
+                         const unsigned int * direction_vectors,
+                         const unsigned long long seed,
+                         const unsigned int offset,
+                         Distribution distribution)
+    {
+        constexpr unsigned int output_per_thread = OutputPerThread;
+        using vec_type = aligned_vec_type<T, output_per_thread>;
+
+        const unsigned int dimension = blockIdx.y;
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+        size_t index = engine_id;
+
+        // Each thread of the current block use the same direction vectors
+        // and scramble seed (the dimension is determined by blockIdx.y)
+        __shared__ unsigned int vectors[32];
+        if(threadIdx.x < 32)
+        {
+            vectors[threadIdx.x] = direction_vectors[dimension * 32 + threadIdx.x];
+        }
+        __syncthreads();
+        const unsigned int scramble_seed = sobol32_owen_dimension_seed(seed, dimension);
+
+        data += dimension * n;
+
+        // All distributions generate one output from one input
+        // Generation of, for example, 2 shorts from 1 uint or
+        // 2 floats from 2 uints using Box-Muller transformation
+        // is impossible because the resulting sequence is not
+        // quasi-random anymore.
+
+        if(output_per_thread == 1)
+        {
+            const unsigned int engine_offset = engine_id * output_per_thread;
+            sobol32_owen_device_engine engine(vectors, offset + engine_offset);
+
+            while(index < n)
+            {
+                data[index] = distribution(sobol32_owen_scramble(engine.current(), scramble_seed));
+                engine.discard_stride(stride);
+                index += stride;
+            }
+        }
+        else
+        {
+            const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+            const size_t misalignment =
+                (
+                    output_per_thread - uintptr / sizeof(T) % output_per_thread
+                ) % output_per_thread;
+            const unsigned int head_size = min(n, misalignment);
+            const unsigned int tail_size = (n - head_size) % output_per_thread;
+            const size_t vec_n = (n - head_size) / output_per_thread;
+
+            const unsigned int engine_offset =
+                engine_id * output_per_thread + head_size;
+            sobol32_owen_device_engine engine(vectors, offset + engine_offset);
+
+            // If data is not aligned by sizeof(vec_type): the head values
+            // are written by the first engines, one each, instead of
+            // serially by engine 0
+            if(engine_id < head_size)
+            {
+                sobol32_owen_device_engine head_engine(vectors, offset + engine_id);
+                data[engine_id] = distribution(sobol32_owen_scramble(head_engine.current(), scramble_seed));
+            }
+
+            vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+            while(index < vec_n)
+            {
+                sobol32_owen_device_engine engine_copy = engine;
+
+                T output[output_per_thread];
+                for(unsigned int i = 0; i < output_per_thread; i++)
+                {
+                    output[i] = distribution(sobol32_owen_scramble(engine.current(), scramble_seed));
+                    engine.discard();
+                }
+
+                vec_data[index] = *reinterpret_cast<vec_type *>(output);
+
+                // Restore from a copy and use fast discard_stride with power of 2 stride
+                engine = engine_copy;
+                engine.discard_stride(stride * output_per_thread);
+                index += stride;
+            }
+
+            if(index == vec_n)
+            {
+                // Fill tail values (up to output_per_thread-1)
+                for(unsigned int o = 0; o < tail_size; o++)
+                {
+                    data[n - tail_size + o]
+                        = distribution(sobol32_owen_scramble(engine.current(), scramble_seed));
+                    engine.discard();
+                }
+            }
+        }
+    }
+
+    // Generates \p n_replicates independently scrambled copies of the
+    // same point set in one launch. The direction vectors loaded into
+    // LDS and the initialized engine state are reused by every
+    // replicate, which is the dominant cost of generating the
+    // replicates with one call per scramble.
+    template<class T, class Distribution>
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_replicates_kernel(T * data, const size_t n,
+                                    const unsigned int * direction_vectors,
+                                    const unsigned long long * seeds,
+                                    const unsigned int n_replicates,
+                                    const unsigned int offset,
+                                    Distribution distribution)
+    {
+        const unsigned int dimension = blockIdx.y;
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride    = gridDim.x * blockDim.x;
+
+        __shared__ unsigned int vectors[32];
+        if(threadIdx.x < 32)
+        {
+            vectors[threadIdx.x] = direction_vectors[dimension * 32 + threadIdx.x];
+        }
+        __syncthreads();
+
+        const sobol32_owen_device_engine engine_start(vectors, offset + engine_id);
+        for(unsigned int r = 0; r < n_replicates; r++)
+        {
+            const unsigned int scramble_seed = sobol32_owen_dimension_seed(seeds[r], dimension);
+            T * replicate_data = data + r * (gridDim.y * n) + dimension * n;
+
+            sobol32_owen_device_engine engine = engine_start;
+            size_t index = engine_id;
+            while(index < n)
+            {
+                replicate_data[index]
+                    = distribution(sobol32_owen_scramble(engine.current(), scramble_seed));
+                engine.discard_stride(stride);
+                index += stride;
+            }
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_sobol32_owen : public rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL32_OWEN>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL32_OWEN>;
+    using engine_type = ::rocrand_host::detail::sobol32_owen_device_engine;
+
+    rocrand_sobol32_owen(unsigned long long offset = 0,
+                         rocrand_ordering   order  = ROCRAND_ORDERING_QUASI_DEFAULT,
+                         hipStream_t        stream = 0)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_loaded_dimensions(0), m_direction_vectors(NULL), m_replicate_seeds_count(0),
+          m_replicate_seeds(NULL)
+    {
+        // Direction vectors are uploaded lazily by init() and sized to
+        // the dimensions in use, so only the used part of the
+        // precomputed table is ever touched
+    }
+
+    ~rocrand_sobol32_owen()
+    {
+        rocrand_host::detail::device_free(m_direction_vectors);
+        rocrand_host::detail::device_free(m_replicate_seeds);
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    // Advances the sequence by \p n points per dimension from the
+    // current position. The engines re-derive their state with the
+    // Gray-code skip at the next generate call, so the cost does not
+    // scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Selects the random Owen permutation; reseeding draws an
+    // independent randomization of the same point set
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_initialized = false;
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order       = order;
+        m_initialized = false;
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions)
+    {
+        if(dimensions < 1 || dimensions > SOBOL_DIM)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_dimensions = dimensions;
+        m_initialized = false;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_direction_vectors();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
+        m_current_offset = static_cast<unsigned int>(m_offset);
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_per_thread =
+            sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
+
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t output_per_block = threads * output_per_thread;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + output_per_block - 1) / output_per_block)
+        );
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<output_per_thread>),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const unsigned int*>(m_direction_vectors), m_seed, m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate_replicates(T * data, size_t data_size,
+                                       unsigned int n_replicates,
+                                       const unsigned long long * seeds,
+                                       Distribution distribution = Distribution())
+    {
+        if (n_replicates < 1)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_replicate_seeds_count < n_replicates)
+        {
+            unsigned long long * replicate_seeds;
+            if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&replicate_seeds),
+                         sizeof(unsigned long long) * n_replicates) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_replicate_seeds);
+            m_replicate_seeds = replicate_seeds;
+            m_replicate_seeds_count = n_replicates;
+            statistics.count_reallocation();
+        }
+        if(hipMemcpy(m_replicate_seeds, seeds,
+                     sizeof(unsigned long long) * n_replicates,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        const uint32_t threads = 256;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + threads - 1) / threads)
+        );
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_replicates_kernel),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const unsigned int*>(m_direction_vectors),
+            static_cast<const unsigned long long*>(m_replicate_seeds), n_replicates,
+            m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        statistics.end_launch(data_size * n_replicates * sizeof(T), m_stream);
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        sobol_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Uploads the direction vectors of the first m_dimensions rows of
+    // the precomputed table to the device, so only the dimensions in
+    // use are allocated and faulted in
+    rocrand_status load_direction_vectors()
+    {
+        unsigned int * direction_vectors;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&direction_vectors),
+                          sizeof(unsigned int) * 32 * m_dimensions);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMemcpy(direction_vectors,
+                          rocrand_h_sobol32_direction_vectors,
+                          sizeof(unsigned int) * 32 * m_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free(m_direction_vectors);
+        m_direction_vectors = direction_vectors;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    bool m_initialized;
+    unsigned int m_dimensions;
+    unsigned int m_current_offset;
+    // Dimensions held in m_direction_vectors on the device
+    unsigned int m_loaded_dimensions;
+    unsigned int * m_direction_vectors;
+    // Device-side copy of the replicate seeds, grown on demand
+    unsigned int m_replicate_seeds_count;
+    unsigned long long * m_replicate_seeds;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+
+    // m_offset and m_seed from base_type
+
+    size_t next_power2(size_t x)
+    {
+        size_t power = 1;
+        while (power < x)
+        {
+            power *= 2;
+        }
+        return power;
+    }
+};
+
+#endif // ROCRAND_RNG_SOBOL32_OWEN_H_
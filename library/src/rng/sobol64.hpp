@@ -95,18 +95,16 @@ namespace detail {
             const size_t vec_n = (n - head_size) / output_per_thread;
 
             const unsigned int engine_offset =
-                engine_id * output_per_thread +
-                (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
+                engine_id * output_per_thread + head_size;
             sobol64_device_engine engine(vectors, offset + engine_offset);
 
-            if(engine_id == 0)
+            // If data is not aligned by sizeof(vec_type): the head values
+            // are written by the first engines, one each, instead of
+            // serially by engine 0
+            if(engine_id < head_size)
             {
-                // If data is not aligned by sizeof(vec_type)
-                for(unsigned int o = 0; o < head_size; o++)
-                {
-                    data[o] = distribution(engine.current());
-                    engine.discard();
-                }
+                sobol64_device_engine head_engine(vectors, offset + engine_id);
+                data[engine_id] = distribution(head_engine.current());
             }
 
             vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
@@ -153,29 +151,17 @@ public:
     rocrand_sobol64(unsigned long long int offset = 0,
                     rocrand_ordering       order  = ROCRAND_ORDERING_QUASI_DEFAULT,
                     hipStream_t            stream = 0)
-        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1)
+        : base_type(order, 0, offset, stream), m_initialized(false), m_dimensions(1),
+          m_loaded_dimensions(0), m_direction_vectors(NULL)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(reinterpret_cast<void**>(&m_direction_vectors),
-                          sizeof(unsigned long long int) * SOBOL64_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors,
-                          rocrand_h_sobol64_direction_vectors,
-                          sizeof(unsigned long long int) * SOBOL64_N,
-                          hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
+        // Direction vectors are uploaded lazily by init() and sized to
+        // the dimensions in use, so only the used part of the
+        // precomputed table is ever touched
     }
 
     ~rocrand_sobol64()
     {
-        hipFree(m_direction_vectors);
+        rocrand_host::detail::device_free(m_direction_vectors);
     }
 
     void reset()
@@ -189,6 +175,19 @@ public:
         m_initialized = false;
     }
 
+    // Advances the sequence by \p n points per dimension from the
+    // current position. The engines re-derive their state with the
+    // Gray-code skip at the next generate call, so the cost does not
+    // scale with \p n.
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_current_offset += static_cast<unsigned int>(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     void set_order(rocrand_ordering order)
     {
         m_order       = order;
@@ -213,6 +212,13 @@ public:
         if (m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        if(m_loaded_dimensions < m_dimensions)
+        {
+            const rocrand_status status = load_direction_vectors();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+
         m_current_offset = static_cast<unsigned int>(m_offset);
         m_initialized = true;
 
@@ -223,7 +229,11 @@ public:
     rocrand_status generate(T * data, size_t data_size,
                             Distribution distribution = Distribution())
     {
+        // 8-byte outputs (double, unsigned long long) are packed two per
+        // thread so they are written with 16-byte vector stores; smaller
+        // outputs are packed into 4 bytes as before
         constexpr unsigned int output_per_thread =
+            sizeof(T) == sizeof(unsigned long long) ? 2 :
             sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
 
         if (data_size % m_dimensions != 0)
@@ -233,6 +243,8 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        statistics.begin_launch(m_stream);
+
         const uint32_t threads = 256;
         const uint32_t max_blocks = 4096;
 
@@ -255,9 +267,11 @@ public:
             distribution
         );
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
         m_current_offset += size;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -284,6 +298,27 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        sobol_cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        sobol_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_poisson(T * data, size_t data_size, double lambda)
     {
@@ -298,10 +333,50 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Uploads the direction vectors of the first m_dimensions rows of
+    // the precomputed table to the device, so only the dimensions in
+    // use are allocated and faulted in
+    rocrand_status load_direction_vectors()
+    {
+        unsigned long long int * direction_vectors;
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&direction_vectors),
+                          sizeof(unsigned long long int) * 64 * m_dimensions);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        error = hipMemcpy(direction_vectors,
+                          rocrand_h_sobol64_direction_vectors,
+                          sizeof(unsigned long long int) * 64 * m_dimensions,
+                          hipMemcpyHostToDevice);
+        if(error != hipSuccess)
+        {
+            rocrand_host::detail::device_free(direction_vectors);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::device_free(m_direction_vectors);
+        m_direction_vectors = direction_vectors;
+        m_loaded_dimensions = m_dimensions;
+        statistics.count_reallocation();
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool m_initialized;
     unsigned int m_dimensions;
     unsigned int m_current_offset;
+    // Dimensions held in m_direction_vectors on the device
+    unsigned int m_loaded_dimensions;
     unsigned long long int * m_direction_vectors;
 
     // For caching of Poisson for consecutive generations with the same lambda
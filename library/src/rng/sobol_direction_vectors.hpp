@@ -0,0 +1,207 @@
+// Copyright (c) 2017-2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL_DIRECTION_VECTORS_H_
+#define ROCRAND_RNG_SOBOL_DIRECTION_VECTORS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <rocrand/rocrand.h>
+
+// Streaming construction of sobol32 direction vectors.
+//
+// The precomputed table ships expanded direction vectors for its first
+// dimensions; the functions below construct further dimensions on
+// demand by continuing the same enumeration of primitive polynomials
+// over GF(2) in (degree, coefficients) order, so the dimension count is
+// not capped by the size of the static table. The constructed rows use
+// unit initial direction numbers, which are valid initial values for
+// every polynomial; the tabulated dimensions instead use searched
+// initial values with better low-dimensional uniformity, so this
+// construction is only meant to extend the table past its last
+// dimension, never to replace it.
+
+namespace rocrand_host {
+namespace detail {
+
+// Multiplies two polynomials over GF(2) modulo \p p of degree \p degree
+inline unsigned int sobol_polynomial_mulmod(unsigned int a,
+                                            unsigned int b,
+                                            unsigned int p,
+                                            int degree)
+{
+    unsigned long long product = 0;
+    unsigned long long shifted = a;
+    while(b != 0)
+    {
+        if(b & 1)
+        {
+            product ^= shifted;
+        }
+        shifted <<= 1;
+        b >>= 1;
+    }
+    for(int bit = 62; bit >= degree; bit--)
+    {
+        if((product >> bit) & 1)
+        {
+            product ^= static_cast<unsigned long long>(p) << (bit - degree);
+        }
+    }
+    return static_cast<unsigned int>(product);
+}
+
+// Raises a polynomial over GF(2) to a power modulo \p p of degree \p degree
+inline unsigned int sobol_polynomial_powmod(unsigned int base,
+                                            unsigned int exponent,
+                                            unsigned int p,
+                                            int degree)
+{
+    unsigned int result = 1;
+    while(exponent != 0)
+    {
+        if(exponent & 1)
+        {
+            result = sobol_polynomial_mulmod(result, base, p, degree);
+        }
+        base = sobol_polynomial_mulmod(base, base, p, degree);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Distinct prime factors of \p n by trial division; \p n fits in 32 bits
+// so the division bound is at most 2^16
+inline std::vector<unsigned int> sobol_distinct_prime_factors(unsigned int n)
+{
+    std::vector<unsigned int> factors;
+    for(unsigned int factor = 2; factor * factor <= n; factor++)
+    {
+        if(n % factor == 0)
+        {
+            factors.push_back(factor);
+            do
+            {
+                n /= factor;
+            }
+            while(n % factor == 0);
+        }
+    }
+    if(n > 1)
+    {
+        factors.push_back(n);
+    }
+    return factors;
+}
+
+// A polynomial of degree d over GF(2) is primitive exactly when x has
+// order 2^d - 1 in GF(2)[x]/(p). The order test also rules out
+// reducible polynomials: modulo a product of smaller factors the order
+// of x is always less than 2^d - 1.
+inline bool sobol_polynomial_is_primitive(unsigned int p,
+                                          int degree,
+                                          const std::vector<unsigned int>& prime_factors)
+{
+    const unsigned int order = (1u << degree) - 1;
+    if(sobol_polynomial_powmod(2, order, p, degree) != 1)
+    {
+        return false;
+    }
+    for(unsigned int factor : prime_factors)
+    {
+        if(sobol_polynomial_powmod(2, order / factor, p, degree) == 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Appends 32-word direction-vector rows for \p dimensions consecutive
+// sobol32 dimensions starting at the 0-based index \p first_dimension,
+// which must be at least 1. Dimension n uses the (n - 1)-th primitive
+// polynomial in (degree, coefficients) order, the enumeration the
+// precomputed table follows; dimension 0 is the degenerate van der
+// Corput dimension which has no polynomial. Throws
+// ROCRAND_STATUS_OUT_OF_RANGE if the requested dimensions exhaust the
+// polynomial degrees representable in 32 bits.
+inline void sobol32_direction_vectors(unsigned int first_dimension,
+                                      unsigned int dimensions,
+                                      std::vector<unsigned int>& vectors)
+{
+    vectors.reserve(vectors.size() + dimensions * std::size_t(32));
+
+    const unsigned int skip = first_dimension - 1;
+    unsigned int index = 0;
+    for(int degree = 1; dimensions > 0; degree++)
+    {
+        if(degree > 31)
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        const std::vector<unsigned int> prime_factors
+            = sobol_distinct_prime_factors((1u << degree) - 1);
+
+        // Candidates are x^degree + (interior terms) + 1; the interior
+        // bits match the coefficient encoding of the precomputed table,
+        // the most significant bit being the x^(degree - 1) coefficient
+        for(unsigned int interior = 0; interior < (1u << (degree - 1)); interior++)
+        {
+            const unsigned int p = (1u << degree) | (interior << 1) | 1;
+            if(!sobol_polynomial_is_primitive(p, degree, prime_factors))
+            {
+                continue;
+            }
+            if(index++ < skip)
+            {
+                continue;
+            }
+
+            // Expand with unit initial direction numbers, so
+            // v_j = 1 << (31 - j) for the first degree values
+            unsigned int v[32];
+            for(int j = 0; j < degree; j++)
+            {
+                v[j] = 1u << (31 - j);
+            }
+            for(int j = degree; j < 32; j++)
+            {
+                v[j] = v[j - degree] ^ (v[j - degree] >> degree);
+                for(int k = 1; k < degree; k++)
+                {
+                    v[j] ^= ((interior >> (degree - 1 - k)) & 1) * v[j - k];
+                }
+            }
+            vectors.insert(vectors.end(), v, v + 32);
+
+            if(--dimensions == 0)
+            {
+                break;
+            }
+        }
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SOBOL_DIRECTION_VECTORS_H_
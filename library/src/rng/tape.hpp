@@ -0,0 +1,242 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TAPE_H_
+#define ROCRAND_RNG_TAPE_H_
+
+#include <cstring>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #include <cstdio>
+    #include <new>
+    #include <vector>
+#endif
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "generator_type.hpp"
+
+namespace rocrand_host
+{
+namespace detail
+{
+
+// On-disk layout of a tape file (see rocrand_write_tape). The header
+// records where the payload came from; replay only needs the payload
+// size, so tapes stay readable across library versions by design.
+struct tape_header
+{
+    char               magic[8];
+    unsigned int       version;  // ROCRAND_VERSION of the writing library
+    unsigned int       rng_type; // generator that produced the payload
+    unsigned long long seed;     // seed the payload was generated with
+    unsigned long long n_bytes;  // payload size following the header
+};
+
+static const char tape_magic[8]
+    = {'R', 'O', 'C', 'R', 'T', 'A', 'P', 'E'};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Tape-replay generator: serves generate() calls from a tape file
+// written by rocrand_write_tape(). On POSIX systems the file is
+// memory-mapped and advised into the page cache on creation, so replay
+// runs copy host-to-device from resident pages instead of re-reading
+// the file; on Windows, which has no mmap, the payload is read into a
+// host buffer up front, which costs the same memory as a fully
+// resident mapping. Either way the served stream is the recorded bytes
+// regardless of the library version that wrote them.
+class rocrand_tape : public rocrand_generator_type<ROCRAND_RNG_TAPE>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_TAPE>;
+
+    rocrand_tape(const char * path, hipStream_t stream = 0)
+        : base_type(0, 0, stream),
+#if !defined(_WIN32)
+          m_fd(-1), m_map(NULL), m_map_size(0),
+#endif
+          m_position(0)
+    {
+#if !defined(_WIN32)
+        m_fd = open(path, O_RDONLY);
+        if(m_fd < 0)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        struct stat file_stat;
+        if(fstat(m_fd, &file_stat) != 0
+           || static_cast<size_t>(file_stat.st_size)
+                  < sizeof(rocrand_host::detail::tape_header))
+        {
+            close(m_fd);
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_map_size = file_stat.st_size;
+
+        void * map = mmap(NULL, m_map_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if(map == MAP_FAILED)
+        {
+            close(m_fd);
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_map = static_cast<const unsigned char *>(map);
+
+        std::memcpy(&m_header, m_map, sizeof(m_header));
+        if(std::memcmp(m_header.magic, rocrand_host::detail::tape_magic,
+                       sizeof(m_header.magic)) != 0
+           || m_header.n_bytes > m_map_size - sizeof(m_header))
+        {
+            munmap(const_cast<unsigned char *>(m_map), m_map_size);
+            close(m_fd);
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // Prime the page cache; readahead proceeds in the background,
+        // so a cold start overlaps the first generate calls instead of
+        // paying fread latency per call
+        madvise(const_cast<unsigned char *>(m_map), m_map_size, MADV_WILLNEED);
+#else
+        std::FILE * file = std::fopen(path, "rb");
+        if(file == NULL)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(std::fread(&m_header, sizeof(m_header), 1, file) != 1
+           || std::memcmp(m_header.magic, rocrand_host::detail::tape_magic,
+                          sizeof(m_header.magic)) != 0)
+        {
+            std::fclose(file);
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        try
+        {
+            m_data.resize(static_cast<size_t>(m_header.n_bytes));
+        }
+        catch(const std::bad_alloc&)
+        {
+            std::fclose(file);
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(std::fread(m_data.data(), 1, m_data.size(), file) != m_data.size())
+        {
+            std::fclose(file);
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        std::fclose(file);
+#endif
+
+        m_seed = m_header.seed;
+    }
+
+    ~rocrand_tape()
+    {
+#if !defined(_WIN32)
+        munmap(const_cast<unsigned char *>(m_map), m_map_size);
+        close(m_fd);
+#endif
+    }
+
+    /// Copies the next \p data_size values off the tape into \p data on
+    /// the generator's stream. The copy is asynchronous when the pages
+    /// are resident; a tape exhausted mid-call writes nothing.
+    template<class T>
+    rocrand_status generate(T * data, size_t data_size)
+    {
+        const size_t bytes = data_size * sizeof(T);
+        // The position can sit past the end after a large set_offset
+        if(m_position > m_header.n_bytes || bytes > m_header.n_bytes - m_position)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        statistics.begin_launch(m_stream);
+        if(hipMemcpyAsync(data, payload() + m_position, bytes,
+                          hipMemcpyHostToDevice, m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        statistics.end_launch(bytes, m_stream);
+
+        m_position += bytes;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        // The mapping is established and advised in the constructor;
+        // nothing is left to initialize lazily
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Repositions the tape at 32-bit value \p offset, matching the
+    /// offset unit of the engine that wrote it
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_position = offset * sizeof(unsigned int);
+    }
+
+    /// Generator type the tape was recorded from
+    rocrand_rng_type get_source_rng_type() const
+    {
+        return static_cast<rocrand_rng_type>(m_header.rng_type);
+    }
+
+    /// ROCRAND_VERSION of the library that wrote the tape
+    unsigned int get_source_version() const
+    {
+        return m_header.version;
+    }
+
+private:
+    const unsigned char * payload() const
+    {
+#if !defined(_WIN32)
+        return m_map + sizeof(m_header);
+#else
+        return m_data.data();
+#endif
+    }
+
+#if !defined(_WIN32)
+    int                   m_fd;
+    const unsigned char * m_map;
+    size_t                m_map_size;
+#else
+    std::vector<unsigned char> m_data;
+#endif
+    size_t                m_position;
+
+    rocrand_host::detail::tape_header m_header;
+};
+
+#endif // ROCRAND_RNG_TAPE_H_
@@ -22,6 +22,7 @@
 #define ROCRAND_RNG_THREEFRY2X32_20_H_
 
 #include <algorithm>
+#include <atomic>
 #include <hip/hip_runtime.h>
 
 #include <rocrand/rocrand.h>
@@ -30,6 +31,7 @@
 #include "device_engines.hpp"
 #include "distributions.hpp"
 #include "generator_type.hpp"
+#include "seeded.hpp"
 
 namespace rocrand_host
 {
@@ -106,35 +108,33 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     const unsigned int tail_size = (n - head_size) % full_output_width;
     const size_t       vec_n     = (n - head_size) / full_output_width;
 
-    const unsigned int engine_offset = 2 * thread_id + (thread_id == 0 ? 0 : head_size);
-    engine.discard(engine_offset);
-
-    // If data is not aligned by sizeof(vec_type)
-    if(thread_id == 0 && head_size > 0)
+    // The head is served by the first threads, one application each,
+    // instead of a serial loop in thread 0; every application consumes
+    // the engine values the serial loop would have, so the output is
+    // unchanged
+    const unsigned int head_applications = (head_size + output_width - 1) / output_width;
+    if(head_size > 0 && thread_id < head_applications)
     {
-        for(unsigned int s = 0; s < output_per_thread; ++s)
+        threefry2x32_20_device_engine head_engine = engine;
+        head_engine.discard(thread_id * input_width);
+        for(unsigned int i = 0; i < input_width; ++i)
         {
-            if(s * output_width >= head_size)
-            {
-                break;
-            }
-
-            for(unsigned int i = 0; i < input_width; ++i)
-            {
-                input[i] = engine();
-            }
-            distribution(input, output[s]);
-
-            for(unsigned int o = 0; o < output_width; ++o)
+            input[i] = head_engine();
+        }
+        distribution(input, output[0]);
+        for(unsigned int o = 0; o < output_width; ++o)
+        {
+            if(thread_id * output_width + o < head_size)
             {
-                if(s * output_width + o < head_size)
-                {
-                    data[s * output_width + o] = output[s][o];
-                }
+                data[thread_id * output_width + o] = output[0][o];
             }
         }
     }
 
+    const unsigned int engine_offset
+        = 2 * thread_id + (thread_id == 0 ? head_applications * input_width : head_size);
+    engine.discard(engine_offset);
+
     // Save multiple values as one vec_type
     vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
     size_t    index    = thread_id;
@@ -184,6 +184,52 @@ ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_k
     }
 }
 
+
+// Index-mapped variant for ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT.
+// Every application consumes the engine values of its own index, so the
+// output is the same for any grid shape; the constant-cost discard of
+// the counter-based engine keeps the per-iteration skip free.
+template<class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void
+    generate_device_independent_kernel(threefry2x32_20_device_engine engine,
+                                       T* data,
+                                       const size_t n,
+                                       Distribution distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    const unsigned int thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int stride    = gridDim.x * blockDim.x;
+
+    unsigned int input[input_width];
+    T output[output_width];
+
+    const size_t applications = (n + output_width - 1) / output_width;
+
+    engine.discard(input_width * thread_id);
+    size_t index = thread_id;
+    while(index < applications)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        for(unsigned int o = 0; o < output_width; o++)
+        {
+            const size_t j = index * output_width + o;
+            if(j < n)
+            {
+                data[j] = output[o];
+            }
+        }
+        index += stride;
+        engine.discard(input_width * (stride - 1));
+    }
+}
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -198,6 +244,9 @@ public:
                             rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
                             hipStream_t        stream = 0)
         : base_type(order, seed, offset, stream), m_engines_initialized(false)
+        , m_dynamic_blocks(0)
+        , m_concurrent(false)
+        , m_claimed(0)
     {}
 
     void reset()
@@ -218,12 +267,99 @@ public:
         m_engines_initialized = false;
     }
 
+    // Advances the sequence by \p n values from the current position
+    // with a constant-cost counter skip
+    rocrand_status skip_ahead(unsigned long long n)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engine.discard(n);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with one value per element of \p seeds: value i is
+    // drawn from the stream that seeds[i] keys, positioned at the
+    // generator's offset, so it depends only on seeds[i] and is stable
+    // under reordering of the elements. Generator state is not consumed
+    // (see seeded.hpp).
+    rocrand_status generate_seeded(unsigned int* data, size_t data_size,
+                                   const unsigned long long* seeds)
+    {
+        return rocrand_host::detail::generate_seeded<engine_type>(seeds,
+                                                                  data,
+                                                                  data_size,
+                                                                  m_offset,
+                                                                  m_stream);
+    }
+
     void set_order(rocrand_ordering order)
     {
         m_order               = order;
         m_engines_initialized = false;
     }
 
+    // Enables or disables concurrent generation. While enabled,
+    // generate() calls from different threads claim disjoint ranges of
+    // the sequence with an atomic counter instead of advancing the
+    // shared engine, so the union of their outputs is the prefix of the
+    // sequence a single thread would produce. Disabling folds the
+    // claimed ranges back into the engine, so sequential generation
+    // continues where the concurrent fills ended.
+    rocrand_status set_concurrent_generation(bool enabled)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_concurrent && !enabled)
+        {
+            m_engine.discard(m_claimed.load());
+        }
+        m_claimed.store(0);
+        m_concurrent = enabled;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Fills \p data with \p data_size values of the sequence the seed
+    // and offset configure, starting at absolute position \p offset,
+    // without consuming generator state: the fill's engine is
+    // positioned with a constant-cost counter skip and dropped after
+    // the launch. Calls are therefore independent of previous generate
+    // calls and of each other, so host threads can fill disjoint
+    // regions of one logical sequence concurrently and a failed fill
+    // can simply be retried (see rocrand_generate_at). \p offset must
+    // fall on an application boundary of the distribution; for the
+    // default uniform distribution every offset qualifies. Statistics
+    // are skipped like in concurrent mode because the calls may come
+    // from several threads.
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate_at(unsigned long long offset, T* data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(offset % Distribution::output_width != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Positioned from the configured start of the sequence, not
+        // from the current engine position, so the call is idempotent
+        engine_type engine{m_seed, 0, m_offset};
+        engine.discard(offset / Distribution::output_width * Distribution::input_width);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(launch_blocks(data_size)), dim3(s_threads), 0, m_stream,
+            engine, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if(m_engines_initialized)
@@ -231,6 +367,20 @@ public:
 
         m_engine = engine_type{m_seed, 0, m_offset};
 
+        if(rocrand_host::detail::uses_device_occupancy(m_order) && m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            m_dynamic_blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type, unsigned int*, const size_t, uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<unsigned int, uniform_distribution<unsigned int>>),
+                s_threads);
+            if(m_dynamic_blocks == 0)
+            {
+                m_dynamic_blocks = s_blocks;
+            }
+        }
+
         m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -238,33 +388,140 @@ public:
     template<class T, class Distribution = uniform_distribution<T>>
     rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
     {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
         rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-                           dim3(s_blocks),
-                           dim3(s_threads),
-                           0,
-                           m_stream,
-                           m_engine,
-                           data,
-                           data_size,
-                           distribution);
-        // Check kernel status
-        if(hipGetLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
         // Generating data_size values will use this many distributions
         const auto num_applied_generators = (data_size + Distribution::output_width - 1)
                                             / Distribution::output_width
                                             * Distribution::input_width;
 
-        m_engine.discard(num_applied_generators);
+        // In concurrent mode each call claims its range of the sequence
+        // up front and leaves the shared engine untouched; statistics
+        // are skipped because their event pool is not thread-safe
+        engine_type engine = m_engine;
+        if(m_concurrent)
+        {
+            engine.discard(m_claimed.fetch_add(num_applied_generators));
+        }
+        else
+        {
+            statistics.begin_launch(m_stream);
+        }
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT)
+        {
+            // The index-mapped kernel ties every output index to a fixed
+            // sequence position, so the grid only has to cover the fill
+            const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                (data_size + s_threads - 1) / s_threads, launch_blocks(data_size)));
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_device_independent_kernel),
+                dim3(std::max(blocks, 1u)),
+                dim3(s_threads),
+                0,
+                m_stream,
+                engine,
+                data,
+                data_size,
+                distribution);
+        }
+        else
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+                               dim3(launch_blocks(data_size)),
+                               dim3(s_threads),
+                               0,
+                               m_stream,
+                               engine,
+                               data,
+                               data_size,
+                               distribution);
+        }
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        if(!m_concurrent)
+        {
+            statistics.end_launch(data_size * sizeof(T), m_stream);
+
+            m_engine.discard(num_applied_generators);
+        }
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+
+    // Fills num_streams contiguous extents of the output with one
+    // launch per extent on the corresponding caller stream, each
+    // launch's engine skipped to the exact sequence position of its
+    // extent. The extents hold the same values as num_streams
+    // sequential generate() calls of the same sizes, and the
+    // generator's own stream waits on all of them, so work queued on it
+    // afterwards sees the whole fill.
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate_partitioned(T* data,
+                                        size_t data_size,
+                                        const hipStream_t* streams,
+                                        unsigned int num_streams,
+                                        Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        // Extents split on application boundaries, so every launch
+        // starts at an exact engine position
+        const size_t applications = (data_size + output_width - 1) / output_width;
+
+        const hipStream_t stream    = m_stream;
+        size_t            app_start = 0;
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            const size_t apps
+                = applications / num_streams + (k < applications % num_streams ? 1 : 0);
+            if(apps == 0)
+            {
+                break;
+            }
+            const size_t start = app_start * output_width;
+            const size_t count = std::min<size_t>(apps * output_width, data_size - start);
+            m_stream                    = streams[k];
+            const rocrand_status status = generate(data + start, count, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_stream = stream;
+                return status;
+            }
+            app_start += apps;
+        }
+        m_stream = stream;
+
+        // Join the extents into the generator's stream
+        for(unsigned int k = 0; k < num_streams; k++)
+        {
+            hipEvent_t event;
+            if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            if(hipEventRecord(event, streams[k]) != hipSuccess
+               || hipStreamWaitEvent(m_stream, event, 0) != hipSuccess)
+            {
+                hipEventDestroy(event);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipEventDestroy(event);
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T>
     rocrand_status generate_uniform(T* data, size_t data_size)
     {
@@ -276,7 +533,15 @@ public:
     rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
     {
         normal_distribution<T, unsigned int, rocrand_host::detail::max_input_width<T>()>
-            distribution(mean, stddev);
+            distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T* data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
@@ -284,10 +549,96 @@ public:
     rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
     {
         log_normal_distribution<T, unsigned int, rocrand_host::detail::max_input_width<T>()>
-            distribution(mean, stddev);
+            distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T, unsigned int, rocrand_host::detail::max_input_width<T>()>
+            distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int* data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T* data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char* data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char* data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         try
@@ -301,9 +652,57 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int* data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Grid size of the next launch. The engine is counter-based, so the
+    // generated sequence does not depend on the grid; under
+    // ROCRAND_ORDERING_PSEUDO_DYNAMIC and ROCRAND_ORDERING_PSEUDO_FASTEST
+    // the grid follows the device's
+    // occupancy and shrinks for fills that can't fill it.
+    uint32_t launch_blocks(size_t data_size) const
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order) || m_dynamic_blocks == 0)
+        {
+            return s_blocks;
+        }
+        const size_t needed_blocks = (data_size + s_threads - 1) / s_threads;
+        return static_cast<uint32_t>(
+            std::min<size_t>(m_dynamic_blocks, std::max<size_t>(needed_blocks, 1)));
+    }
+
     bool        m_engines_initialized;
     engine_type m_engine;
+    uint32_t    m_dynamic_blocks;
+    // Concurrent mode; m_claimed counts the values claimed by
+    // generate() calls since the mode was enabled
+    bool                            m_concurrent;
+    std::atomic<unsigned long long> m_claimed;
 
     const static uint32_t s_threads = 256;
     const static uint32_t s_blocks  = 1024;
@@ -311,6 +710,10 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
     // m_seed from base_type
     // m_offset from base_type
 };
@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TUNING_H_
+#define ROCRAND_RNG_TUNING_H_
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// One tuned launch configuration
+struct tuning_entry
+{
+    unsigned int threads;
+    unsigned int blocks;
+};
+
+// Launch tuning table loaded from disk, so a new GPU generation gets
+// tuned launches from a data file instead of a library rebuild.
+//
+// The file holds one entry per line:
+//
+//     # architecture  generator      threads  blocks
+//     gfx90a          xorwow         256      2048
+//     *               philox4x32_10  256      1024
+//
+// A line whose third field is not a number is a named option instead of
+// a launch configuration, used for per-architecture defaults that are
+// not thread/block counts:
+//
+//     gfx1100         normal_method  marsaglia_polar
+//
+// The architecture is the gcnArchName of the device without its feature
+// suffixes; '*' matches any architecture but loses to an exact entry.
+// '#' starts a comment and malformed lines are skipped. The file named
+// by the ROCRAND_TUNING_FILE environment variable takes precedence over
+// the table shipped with the library; generators look entries up at
+// construction and ignore entries that break their scheduling
+// invariants.
+class tuning_table
+{
+public:
+    static const tuning_table & instance()
+    {
+        static const tuning_table table;
+        return table;
+    }
+
+    // Returns the tuned launch configuration for \p generator on the
+    // current device, preferring an exact architecture entry over a
+    // wildcard one
+    bool lookup(const std::string & generator, tuning_entry * out) const
+    {
+        if(m_entries.empty())
+        {
+            return false;
+        }
+        std::string base;
+        if(!device_base_arch(&base))
+        {
+            return false;
+        }
+        auto match = m_entries.find(base + " " + generator);
+        if(match == m_entries.end())
+        {
+            match = m_entries.find("* " + generator);
+        }
+        if(match == m_entries.end())
+        {
+            return false;
+        }
+        *out = match->second;
+        return true;
+    }
+
+    // Returns the named option \p name for the current device, with the
+    // same exact-over-wildcard architecture precedence as lookup()
+    bool lookup_option(const std::string & name, std::string * out) const
+    {
+        if(m_options.empty())
+        {
+            return false;
+        }
+        std::string base;
+        if(!device_base_arch(&base))
+        {
+            return false;
+        }
+        auto match = m_options.find(base + " " + name);
+        if(match == m_options.end())
+        {
+            match = m_options.find("* " + name);
+        }
+        if(match == m_options.end())
+        {
+            return false;
+        }
+        *out = match->second;
+        return true;
+    }
+
+private:
+    static bool device_base_arch(std::string * out)
+    {
+        int device = 0;
+        hipDeviceProp_t properties;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipGetDeviceProperties(&properties, device) != hipSuccess)
+        {
+            return false;
+        }
+        // gcnArchName carries feature suffixes (gfx90a:sramecc+:xnack-)
+        const std::string arch = properties.gcnArchName;
+        *out = arch.substr(0, arch.find(':'));
+        return true;
+    }
+
+    tuning_table()
+    {
+        const char * path = std::getenv("ROCRAND_TUNING_FILE");
+        if(path != NULL && load(path))
+        {
+            return;
+        }
+        const char * rocm = std::getenv("ROCM_PATH");
+        const std::string prefix = rocm != NULL ? rocm : "/opt/rocm";
+        load(prefix + "/share/rocrand/rocrand_tuning.txt");
+    }
+
+    bool load(const std::string & path)
+    {
+        std::ifstream file(path.c_str());
+        if(!file.is_open())
+        {
+            return false;
+        }
+        std::string line;
+        while(std::getline(file, line))
+        {
+            const size_t comment = line.find('#');
+            if(comment != std::string::npos)
+            {
+                line.resize(comment);
+            }
+            std::istringstream fields(line);
+            std::string arch;
+            std::string name;
+            std::string value;
+            if(!(fields >> arch >> name >> value))
+            {
+                continue;
+            }
+            tuning_entry entry;
+            std::istringstream threads_field(value);
+            if(threads_field >> entry.threads && threads_field.eof())
+            {
+                if(!(fields >> entry.blocks) || entry.threads == 0 || entry.blocks == 0)
+                {
+                    continue;
+                }
+                m_entries[arch + " " + name] = entry;
+            }
+            else
+            {
+                // Non-numeric third field: a named option
+                m_options[arch + " " + name] = value;
+            }
+        }
+        return true;
+    }
+
+    std::map<std::string, tuning_entry> m_entries;
+    std::map<std::string, std::string> m_options;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TUNING_H_
@@ -0,0 +1,893 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_WELL19937_H_
+#define ROCRAND_RNG_WELL19937_H_
+
+#define WELL_FQUALIFIERS __forceinline__ __device__
+#define WELL_FQUALIFIERS_HOST __host__
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "well19937_precomputed.hpp"
+
+namespace
+{
+/// Number of independent generators. Value is fixed to produce deterministic number stream.
+static constexpr unsigned int well19937_generator_count = 8192;
+/// Number of threads per block. Can be tweaked for performance.
+static constexpr unsigned int well19937_thread_count = 256;
+} // namespace
+
+namespace rocrand_host
+{
+namespace detail
+{
+
+namespace
+{
+// WELL19937 constants, see Panneton, L'Ecuyer and Matsumoto,
+// "Improved Long-Period Generators Based on Linear Recurrences Modulo 2",
+// ACM Transactions on Mathematical Software, 2006.
+
+/// Number of elements in the state ring buffer.
+static constexpr unsigned int well_n = 624;
+/// Feedback pick distances of the recurrence, relative to the ring pointer.
+static constexpr unsigned int well_m1 = 70;
+static constexpr unsigned int well_m2 = 179;
+static constexpr unsigned int well_m3 = 449;
+/// Mask to select the most significant <tt>w - r mod w</tt> bits from a \p w bits word,
+/// where \p w is the number of bits per generated word (32) and \p r is an
+/// algorithm constant (19937 mod 32 = 1 bit).
+static constexpr unsigned int well_upper_mask = 0x80000000U;
+/// Mask to select the least significant <tt>r mod w</tt> bits from a \p w bits word.
+static constexpr unsigned int well_lower_mask = 0x7FFFFFFFU;
+} // namespace
+
+struct well19937_engine
+{
+    // Jumping constants.
+    static constexpr unsigned int qq = 7;
+    static constexpr unsigned int ll = 1U << qq;
+
+    struct well19937_state
+    {
+        unsigned int v[well_n];
+        // ring position of the element the next output is computed from;
+        // unlike MT19937 the pointer moves backwards through the array
+        unsigned int ptr;
+    };
+
+    well19937_state m_state;
+
+    WELL_FQUALIFIERS_HOST well19937_engine(unsigned long long seed)
+    {
+        const unsigned int seedu = (seed >> 32) ^ seed;
+        m_state.v[0]             = seedu;
+        for(unsigned int i = 1; i < well_n; i++)
+        {
+            m_state.v[i] = 1812433253 * (m_state.v[i - 1] ^ (m_state.v[i - 1] >> 30)) + i;
+        }
+        m_state.ptr = 0;
+    }
+
+    /// Advances the internal state to skip a single subsequence, which is <tt>2 ^ 1000</tt> states long.
+    WELL_FQUALIFIERS_HOST void discard_subsequence()
+    {
+        m_state = discard_subsequence_impl(well19937_jump, m_state);
+    }
+
+    // Generates the next state.
+    static WELL_FQUALIFIERS_HOST void gen_next(well19937_state& state)
+    {
+        const unsigned int v0   = state.v[state.ptr];
+        const unsigned int vm1  = state.v[(state.ptr + well_m1) % well_n];
+        const unsigned int vm2  = state.v[(state.ptr + well_m2) % well_n];
+        const unsigned int vm3  = state.v[(state.ptr + well_m3) % well_n];
+        const unsigned int prev = state.ptr == 0 ? well_n - 1 : state.ptr - 1;
+        const unsigned int vrm1 = state.v[prev];
+        const unsigned int vrm2 = state.v[prev == 0 ? well_n - 1 : prev - 1];
+
+        const unsigned int z0 = (vrm1 & well_upper_mask) | (vrm2 & well_lower_mask);
+        const unsigned int z1 = (v0 ^ (v0 << 25)) ^ (vm1 ^ (vm1 >> 27));
+        const unsigned int z2 = (vm2 >> 9) ^ (vm3 ^ (vm3 >> 1));
+
+        const unsigned int new_v1 = z1 ^ z2;
+        const unsigned int new_v0
+            = z0 ^ (z1 ^ (z1 << 9)) ^ (z2 ^ (z2 << 21)) ^ (new_v1 ^ (new_v1 >> 21));
+
+        state.v[state.ptr] = new_v1;
+        state.v[prev]      = new_v0;
+        state.ptr          = prev;
+    }
+
+    /// Return coefficient \p deg of the polynomial <tt>pf</tt>.
+    static WELL_FQUALIFIERS_HOST unsigned int get_coef(const unsigned int pf[well19937_p_size],
+                                                       unsigned int       deg)
+    {
+        constexpr unsigned int log_w_size  = 5;
+        constexpr unsigned int w_size_mask = (1U << log_w_size) - 1;
+        return (pf[deg >> log_w_size] & (1U << (deg & w_size_mask))) != 0;
+    }
+
+    /// Copy state \p ss into state <tt>ts</tt>.
+    static WELL_FQUALIFIERS_HOST void copy_state(well19937_state& ts, const well19937_state& ss)
+    {
+        for(unsigned int i = 0; i < well_n; i++)
+        {
+            ts.v[i] = ss.v[i];
+        }
+
+        ts.ptr = ss.ptr;
+    }
+
+    /// Add state \p s2 to state <tt>s1</tt>. States are aligned on their ring
+    /// pointers; the sum is a valid state because the transition function is
+    /// linear in the pointer-aligned representation.
+    static WELL_FQUALIFIERS_HOST void add_state(well19937_state& s1, const well19937_state& s2)
+    {
+        if(s2.ptr >= s1.ptr)
+        {
+            unsigned int i = 0;
+            for(; i < well_n - s2.ptr; i++)
+            {
+                s1.v[i + s1.ptr] ^= s2.v[i + s2.ptr];
+            }
+            for(; i < well_n - s1.ptr; i++)
+            {
+                s1.v[i + s1.ptr] ^= s2.v[i - (well_n - s2.ptr)];
+            }
+            for(; i < well_n; i++)
+            {
+                s1.v[i - (well_n - s1.ptr)] ^= s2.v[i - (well_n - s2.ptr)];
+            }
+        }
+        else
+        {
+            unsigned int i = 0;
+            for(; i < well_n - s1.ptr; i++)
+            {
+                s1.v[i + s1.ptr] ^= s2.v[i + s2.ptr];
+            }
+            for(; i < well_n - s2.ptr; i++)
+            {
+                s1.v[i - (well_n - s1.ptr)] ^= s2.v[i + s2.ptr];
+            }
+            for(; i < well_n; i++)
+            {
+                s1.v[i - (well_n - s1.ptr)] ^= s2.v[i - (well_n - s2.ptr)];
+            }
+        }
+    }
+
+    /// Generate Gray code.
+    static WELL_FQUALIFIERS_HOST void gray_code(unsigned int h[ll])
+    {
+        h[0U] = 0U;
+
+        unsigned int l    = 1;
+        unsigned int term = ll;
+        unsigned int j    = 1;
+        for(unsigned int i = 1; i <= qq; i++)
+        {
+            l    = (l << 1);
+            term = (term >> 1);
+            for(; j < l; j++)
+            {
+                h[j] = h[l - j - 1] ^ term;
+            }
+        }
+    }
+
+    /// Compute \p h(f)ss where \p h(t) are exact <tt>q</tt>-degree polynomials,
+    /// \p f is the transition function, and \p ss is the initial state
+    /// the results are stored in <tt>vec_h[0] , ... , vec_h[ll - 1]</tt>.
+    static WELL_FQUALIFIERS_HOST void gen_vec_h(const well19937_state& ss,
+                                                well19937_state        vec_h[ll])
+    {
+        well19937_state v{};
+        unsigned int    h[ll];
+
+        gray_code(h);
+
+        copy_state(vec_h[0], ss);
+
+        for(unsigned int i = 0; i < qq; i++)
+        {
+            gen_next(vec_h[0]);
+        }
+
+        for(unsigned int i = 1; i < ll; i++)
+        {
+            copy_state(v, ss);
+            unsigned int g = h[i] ^ h[i - 1];
+            for(unsigned int k = 1; k < g; k = (k << 1))
+            {
+                gen_next(v);
+            }
+            copy_state(vec_h[h[i]], vec_h[h[i - 1]]);
+            add_state(vec_h[h[i]], v);
+        }
+    }
+
+    /// Compute pf(ss) using Sliding window algorithm.
+    static WELL_FQUALIFIERS_HOST well19937_state calc_state(const unsigned int pf[well19937_p_size],
+                                                            const well19937_state& ss,
+                                                            const well19937_state  vec_h[ll])
+    {
+        well19937_state tmp{};
+        int             i = well19937_mexp - 1;
+
+        while(get_coef(pf, i) == 0)
+        {
+            i--;
+        }
+
+        for(; i >= static_cast<int>(qq); i--)
+        {
+            if(get_coef(pf, i) != 0)
+            {
+                for(unsigned int j = 0; j < qq + 1; j++)
+                {
+                    gen_next(tmp);
+                }
+                unsigned int digit = 0;
+                for(int j = 0; j < static_cast<int>(qq); j++)
+                {
+                    digit = (digit << 1) ^ get_coef(pf, i - j - 1);
+                }
+                add_state(tmp, vec_h[digit]);
+                i -= qq;
+            }
+            else
+            {
+                gen_next(tmp);
+            }
+        }
+
+        for(; i > -1; i--)
+        {
+            gen_next(tmp);
+            if(get_coef(pf, i) == 1)
+            {
+                add_state(tmp, ss);
+            }
+        }
+
+        return tmp;
+    }
+
+    /// Computes jumping ahead with Sliding window algorithm.
+    static WELL_FQUALIFIERS_HOST well19937_state
+        discard_subsequence_impl(const unsigned int pf[well19937_p_size], const well19937_state& ss)
+    {
+        // skip state
+        well19937_state vec_h[ll];
+        gen_vec_h(ss, vec_h);
+        well19937_state new_state = calc_state(pf, ss, vec_h);
+
+        // rotate the array to align ptr with the array boundary
+        if(new_state.ptr != 0)
+        {
+            unsigned int tmp[well_n];
+            for(unsigned int i = 0; i < well_n; i++)
+            {
+                tmp[i] = new_state.v[(i + new_state.ptr) % well_n];
+            }
+
+            for(unsigned int i = 0; i < well_n; i++)
+            {
+                new_state.v[i] = tmp[i];
+            }
+        }
+
+        // set to 0, which is the position the next output is computed from
+        new_state.ptr = 0;
+
+        return new_state;
+    }
+};
+
+/// Advances one WELL19937 generator per thread.
+///
+/// The state is too large for registers, so the ring buffers of all
+/// generators stay in global memory, interleaved word-major: word \p w of
+/// generator \p g lives at <tt>w * generator_count + g</tt>. One step loads
+/// six words and stores two, and threads of a warp access consecutive
+/// addresses as long as their ring pointers agree (they only diverge
+/// while handling unaligned heads and tails), so the state traffic is
+/// coalesced without the cross-thread shuffling that MT19937 needs to
+/// split its state over eight threads.
+struct well19937_device_engine
+{
+    /// This generator's column in the interleaved state array.
+    unsigned int* v;
+    /// Ring position of the element the next output is computed from.
+    unsigned int ptr;
+
+    WELL_FQUALIFIERS well19937_device_engine(unsigned int* state,
+                                             unsigned int  gen_id,
+                                             unsigned int  ptr)
+        : v(state + gen_id), ptr(ptr)
+    {}
+
+    /// Global memory offset of the element \p k positions after the ring pointer.
+    WELL_FQUALIFIERS unsigned int index(unsigned int k) const
+    {
+        const unsigned int w = ptr + k;
+        return (w < well_n ? w : w - well_n) * well19937_generator_count;
+    }
+
+    WELL_FQUALIFIERS unsigned int operator()()
+    {
+        const unsigned int v0   = v[index(0)];
+        const unsigned int vm1  = v[index(well_m1)];
+        const unsigned int vm2  = v[index(well_m2)];
+        const unsigned int vm3  = v[index(well_m3)];
+        const unsigned int vrm1 = v[index(well_n - 1)];
+        const unsigned int vrm2 = v[index(well_n - 2)];
+
+        const unsigned int z0 = (vrm1 & well_upper_mask) | (vrm2 & well_lower_mask);
+        const unsigned int z1 = (v0 ^ (v0 << 25)) ^ (vm1 ^ (vm1 >> 27));
+        const unsigned int z2 = (vm2 >> 9) ^ (vm3 ^ (vm3 >> 1));
+
+        const unsigned int new_v1 = z1 ^ z2;
+        const unsigned int new_v0
+            = z0 ^ (z1 ^ (z1 << 9)) ^ (z2 ^ (z2 << 21)) ^ (new_v1 ^ (new_v1 >> 21));
+
+        v[index(0)]          = new_v1;
+        v[index(well_n - 1)] = new_v0;
+        ptr                  = ptr == 0 ? well_n - 1 : ptr - 1;
+
+        // perform WELL19937c tempering on the new output
+
+        constexpr unsigned int tempering_mask_b = 0xE46E1700U;
+        constexpr unsigned int tempering_mask_c = 0x9B868000U;
+
+        unsigned int y = new_v0;
+        y ^= (y << 7) & tempering_mask_b;
+        y ^= (y << 15) & tempering_mask_c;
+
+        return y;
+    }
+};
+
+ROCRAND_KERNEL
+__launch_bounds__(well19937_thread_count) void init_engines_kernel(
+    unsigned int* state, unsigned int* state_ptrs, const well19937_engine* engines)
+{
+    const unsigned int gen_id = blockIdx.x * blockDim.x + threadIdx.x;
+    // scatter the array-of-structs host engines into the interleaved layout
+    for(unsigned int w = 0; w < well_n; w++)
+    {
+        state[w * well19937_generator_count + gen_id] = engines[gen_id].m_state.v[w];
+    }
+    // the host engines are rotated to ptr == 0 after jumping
+    state_ptrs[gen_id] = 0;
+}
+
+template<class T, class Distribution>
+ROCRAND_KERNEL __launch_bounds__(well19937_thread_count) void generate_kernel(
+    unsigned int* state, unsigned int* state_ptrs, T* data, const size_t size,
+    Distribution distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    using vec_type = aligned_vec_type<T, output_width>;
+
+    const unsigned int     id     = blockIdx.x * blockDim.x + threadIdx.x;
+    constexpr unsigned int stride = well19937_generator_count;
+
+    well19937_device_engine engine(state, id, state_ptrs[id]);
+
+    unsigned int input[input_width];
+    T            output[output_width];
+
+    const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+    const size_t misalignment =
+        (
+            output_width - uintptr / sizeof(T) % output_width
+        ) % output_width;
+    const unsigned int head_size = min(size, misalignment);
+    const unsigned int tail_size = (size - head_size) % output_width;
+    const size_t vec_n = (size - head_size) / output_width;
+
+    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
+    size_t index = id;
+    while(index < vec_n)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = engine();
+        }
+        distribution(input, output);
+
+        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        // Next position
+        index += stride;
+    }
+
+    // Check if we need to save head and tail.
+    // Those numbers should be generated by the thread that would
+    // save next vec_type.
+    if(output_width > 1 && index == vec_n)
+    {
+        // If data is not aligned by sizeof(vec_type)
+        if(head_size > 0)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                if(o < head_size)
+                {
+                    data[o] = output[o];
+                }
+            }
+        }
+
+        if(tail_size > 0)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                if(o < tail_size)
+                {
+                    data[size - tail_size + o] = output[o];
+                }
+            }
+        }
+    }
+
+    // Save the ring pointer; the state words are already in global memory
+    state_ptrs[id] = engine.ptr;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_well19937 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_WELL19937>
+{
+public:
+    using base_type   = rocrand_generator_type<ROCRAND_RNG_PSEUDO_WELL19937>;
+    using engine_type = ::rocrand_host::detail::well19937_engine;
+
+    rocrand_well19937(unsigned long long seed = 0, hipStream_t stream = 0)
+        : base_type(seed, 0, stream)
+        , m_state_initialized(false)
+        , m_state(NULL)
+        , m_state_owned(true)
+    {
+        // Allocate interleaved device state and per-generator ring pointers
+        auto error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_state), state_size());
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    rocrand_well19937(const rocrand_well19937&) = delete;
+
+    rocrand_well19937(rocrand_well19937&&) = delete;
+
+    rocrand_well19937& operator=(const rocrand_well19937&) = delete;
+
+    rocrand_well19937& operator=(rocrand_well19937&&) = delete;
+
+    ~rocrand_well19937()
+    {
+        if(m_state_owned)
+        {
+            rocrand_host::detail::device_free(m_state);
+        }
+    }
+
+    void reset()
+    {
+        m_state_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed              = seed;
+        m_state_initialized = false;
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order             = order;
+        m_state_initialized = false;
+    }
+
+    // Returns the number of bytes of device memory the generator needs
+    // for its interleaved state and the staging buffer used while
+    // initializing it.
+    size_t get_workspace_size() const
+    {
+        return state_size() + well19937_generator_count * sizeof(engine_type);
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void* ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_state_owned)
+            {
+                m_state    = NULL;
+                auto error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_state), state_size());
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_state_owned       = true;
+                m_state_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_state_owned)
+        {
+            rocrand_host::detail::device_free(m_state);
+        }
+        m_state             = static_cast<unsigned int*>(ptr);
+        m_state_owned       = false;
+        m_state_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        hipError_t err;
+
+        if(m_state_initialized)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // initialize the engines on the host due to high memory requirement
+        // for jumping subsequences
+        std::vector<engine_type> h_engines;
+        h_engines.reserve(well19937_generator_count);
+        // initialize the first engine with the seed and no skips
+        h_engines.emplace_back(m_seed);
+        for(size_t i = 1; i < well19937_generator_count; i++)
+        {
+            // every consecutive engine is one subsequence away from the previous
+            h_engines.push_back(h_engines.back());
+            h_engines[i].discard_subsequence();
+        }
+
+        // a caller-provided workspace already reserves room for the
+        // staging buffer behind the state
+        engine_type* d_engines{};
+        if(m_state_owned)
+        {
+            err = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&d_engines),
+                            well19937_generator_count * sizeof(engine_type));
+            if(err != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+        }
+        else
+        {
+            d_engines = reinterpret_cast<engine_type*>(
+                reinterpret_cast<unsigned char*>(m_state) + state_size());
+        }
+
+        err = hipMemcpy(d_engines,
+                        h_engines.data(),
+                        well19937_generator_count * sizeof(engine_type),
+                        hipMemcpyHostToDevice);
+
+        if(err != hipSuccess)
+        {
+            if(m_state_owned)
+            {
+                rocrand_host::detail::device_free(d_engines);
+            }
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        hipLaunchKernelGGL(rocrand_host::detail::init_engines_kernel,
+                           dim3(block_count),
+                           dim3(well19937_thread_count),
+                           0,
+                           m_stream,
+                           m_state,
+                           state_ptrs(),
+                           d_engines);
+
+        err = hipStreamSynchronize(m_stream);
+        if(err != hipSuccess)
+        {
+            if(m_state_owned)
+            {
+                rocrand_host::detail::device_free(d_engines);
+            }
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        if(m_state_owned)
+        {
+            err = rocrand_host::detail::device_free(d_engines);
+            if(err != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        m_state_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(rocrand_host::detail::generate_kernel,
+                           dim3(block_count),
+                           dim3(well19937_thread_count),
+                           0,
+                           m_stream,
+                           m_state,
+                           state_ptrs(),
+                           data,
+                           data_size,
+                           distribution);
+
+        // check kernel status
+        if(launch_failed())
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T* data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T* data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T* data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T* data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T* data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char* data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char* data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
+    rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int* data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int* data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Bytes of the interleaved state words plus the ring pointer array
+    static size_t state_size()
+    {
+        return (::rocrand_host::detail::well_n + 1) * well19937_generator_count
+               * sizeof(unsigned int);
+    }
+
+    // The per-generator ring pointers live behind the state words
+    unsigned int* state_ptrs() const
+    {
+        return m_state + ::rocrand_host::detail::well_n * well19937_generator_count;
+    }
+
+    bool          m_state_initialized;
+    unsigned int* m_state;
+    // Engine states may live in a caller-provided workspace
+    bool          m_state_owned;
+
+    static constexpr unsigned int block_count = well19937_generator_count / well19937_thread_count;
+    static_assert(well19937_generator_count % well19937_thread_count == 0,
+                  "generator count must be a multiple of the block size");
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_WELL19937_H_
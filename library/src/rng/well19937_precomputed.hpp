@@ -0,0 +1,113 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef WELL19937_PRECOMPUTED_HPP_
+#define WELL19937_PRECOMPUTED_HPP_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/well19937_precomputed_generator
+
+constexpr unsigned int well19937_mexp   = 19938;
+constexpr unsigned int well19937_p_size = 624;
+
+// clang-format off
+static constexpr unsigned int well19937_jump[well19937_p_size] = {
+    3763599576U, 2678751948U,  778830241U,  903394568U,  495138998U, 2848693729U, 1843260293U, 4275101499U, 
+    3026643952U, 2868183003U, 2450379055U, 1894032138U,  938280957U, 1632118656U, 1986501006U, 3279172356U, 
+    2011275607U, 1451737669U,  339960615U, 1522887627U, 1183769833U,  772349367U, 2430897096U, 3658933483U, 
+    3107273287U, 2069769276U, 1549602763U,  330079140U, 2394504295U, 1634798446U, 2513173294U, 2274254115U, 
+    3477663627U, 3405164889U, 1583221081U, 1439683827U, 3018188169U, 2903462042U, 2454502534U, 1939434407U, 
+    2397411598U, 2323837205U, 1286913839U, 2994685000U, 3607551903U, 4188055492U,  728154808U, 3525753571U, 
+     950813827U, 2167921223U, 3768340358U, 4189291689U, 1159586771U,  751960645U, 1409491395U,   70804833U, 
+    1253867162U,  616624613U,  158600329U, 2480757887U, 3181817192U, 3282228570U,  851207330U,  448494740U, 
+    1494942955U, 2243844642U, 2228985221U, 2415348445U, 3909701515U, 1110820266U, 1575297963U, 2690834941U, 
+    3521628782U, 4053244911U, 3599609311U, 1265846019U, 3231746859U, 3128296572U, 3026361537U, 1754678472U, 
+    3959560020U,  219697585U, 4248297510U, 1840564527U, 2357774942U,   28319211U,  771383772U, 2343541167U, 
+    2487130705U, 4281899384U, 2928533573U, 1605807591U, 3571235899U, 2020599550U,  206899299U,  445053892U, 
+    2392428631U, 3069615770U, 1513386005U, 1810099472U, 1147679166U, 4018825534U, 1473293435U, 3940570366U, 
+     668268212U, 1368137396U,    9604458U, 3699736621U,  917030495U,  218877246U, 3445444363U, 2715359505U, 
+    3577076792U, 3212067165U, 1010720777U, 4036619804U, 3253373823U, 2986887515U, 3649229601U, 3489547599U, 
+    3046230362U, 3831242120U, 1065230427U, 3289774098U, 1675006131U, 3426838447U,  283351995U, 2157977731U, 
+    3362010864U,   77569461U,  621784398U, 2863079309U, 2388837631U,  373483531U, 2418570196U, 1924499477U, 
+     832655332U, 3651866228U, 4139381154U, 4009308021U, 2620779755U, 2227260477U, 2511644435U, 1705903477U, 
+    3320376787U, 3197104924U,  299255726U, 1771206686U,  133519175U, 2535936903U, 2617808660U, 4038818981U, 
+    2971077926U,  452121194U, 3663524083U, 1030548029U, 4235629284U,  506302251U, 3198357690U, 3638180521U, 
+    1209661977U,  478095699U, 2302330276U, 3092939962U, 2608693897U, 1707801022U, 1614330363U, 4119548471U, 
+    1455281966U, 1060362704U,  360026806U, 2745986998U,  393046950U, 1940597228U,  590602349U, 3729320668U, 
+    3961997116U, 2865339267U, 2015788398U, 3841666485U,  283927583U, 1744663060U, 2011137311U, 4140105004U, 
+    3408750166U,  743125997U,  513043568U, 3906461960U, 3404966077U, 4145834617U, 4242784560U,  670613471U, 
+     874302068U, 1441499612U, 2515239557U,  873277600U, 3544708228U, 3657605075U,  552511778U, 2206076295U, 
+    3839095324U,  523783043U, 1936352850U, 1109116964U, 3702545270U, 3735003619U, 4008630277U, 4135477658U, 
+    1508944341U, 2892709089U, 3459216266U, 3446519777U,    6784464U, 1805688452U, 3449965159U, 2115482685U, 
+    2521886844U,  557080840U, 3857243902U, 1436998567U, 4208382223U, 1567036984U,  164071836U, 3040115505U, 
+    4161274634U, 3144714434U, 1306482232U, 1636411936U, 4277252637U, 2168141315U,  790652909U, 3094231901U, 
+    2893105988U, 3786927143U,  671622308U,  623374069U,  167015426U, 1291183043U,  673913425U, 3813576077U, 
+     515077286U, 1609789154U, 1966779514U, 1708180280U, 1891746595U, 3810337211U, 1599135910U, 1175493788U, 
+    3007287314U,  676269622U, 1429002132U, 3621230393U, 1437658788U,   12537513U, 1948901507U, 1709495436U, 
+    1466040981U,  661746632U, 1016550320U, 3859034211U,  322677307U, 3916215681U,  694049232U,  666216044U, 
+    1999827360U,   60940616U,  225795467U, 1003593458U, 3330564538U, 2460142158U, 4090950632U, 3940592377U, 
+    2209882325U,  247400154U, 2246573519U,  696197475U, 2972421120U, 1558304152U, 3535542375U,   51355468U, 
+    2591525690U, 1205994402U,  786203996U,  502891043U, 2510129372U, 2826434389U, 1763214085U, 3955866333U, 
+    2805811268U, 3249107716U, 2526165591U,  845233506U, 4250244752U, 3934639588U, 1886036573U,  625434194U, 
+    1309441474U, 1022989874U, 2841805902U, 1444144775U, 3839291937U, 2706288461U,  280457993U, 1166170899U, 
+     554778387U, 1205065838U, 2596380572U, 1100102192U, 2377336394U, 3379944142U, 3176343770U, 4057601600U, 
+    3377687697U, 4139999081U,   82699362U, 2958579298U,  954576728U, 2037361889U, 3100494717U,  823857883U, 
+    3873409614U, 4147020527U, 2995948838U, 1470255063U,   50349116U,  684129701U, 3689448338U,  272246838U, 
+    2157915345U, 1890575513U, 3809205925U, 1897418427U, 1869172291U, 2358718226U,  331487960U, 2095320065U, 
+    2597823255U, 2294839151U, 2825280811U,  249464281U,  784428927U, 2909498888U, 1606005279U, 3824200091U, 
+    1358805603U, 1259871451U, 2874834199U, 1290121145U,  464288187U, 2980851957U,  497622747U,  281251482U, 
+    1713653924U, 3334208865U, 1201798193U, 1963470964U, 3195541561U, 2631892572U,  116983992U, 1273749577U, 
+     166629307U,  581522191U, 1122165875U,  844952681U,  450919198U,   48664814U, 1692258616U, 1373581267U, 
+    1116962252U,  769298235U, 2897161185U, 1638171438U, 2247597908U,  664075979U, 1952807386U,  790728805U, 
+    1737022720U,  531141120U,  577175583U, 3827718816U, 2089098847U, 1695088330U, 1465899778U, 3478814363U, 
+    1388402134U, 2435070755U, 1190756812U,  387742247U, 4082484531U, 4269571126U, 2691188069U,  853177887U, 
+    4146041225U,  881864132U, 2866720144U, 2471740776U, 3047516818U, 3026993960U, 1118976666U, 1187427092U, 
+    1345578064U, 3256155154U,  487877519U,  604111044U,  439952811U, 3244727326U, 1385808572U, 2385974887U, 
+    1657865690U, 1140996777U, 1078120789U, 3898409453U, 2453448441U,  604357221U, 3485447252U,  334803665U, 
+    3174777943U, 2590777680U, 1275999285U, 2089223625U, 3366300814U, 3651938812U,  475425027U, 3612884898U, 
+    1295803955U,  889476687U, 2477995325U, 2079210576U,  119624156U, 2110412062U, 4081218545U, 1592421372U, 
+    1573783919U, 2944572994U,  499463715U,  147170808U, 2814353067U, 2825358432U, 1042604099U, 1486719692U, 
+    2065116750U,   12148923U,   37962924U,  405959210U,  940206945U, 2584505347U, 2490050979U, 2599264818U, 
+    2556220182U, 3280252986U,   20785109U, 3338929308U, 3919811125U, 2626028400U, 3119109798U, 3267141679U, 
+    4014713725U, 1118676200U, 1366322061U, 4215376210U,  504636796U, 2659816302U, 1067718013U, 1887148330U, 
+    1503635131U,  702792392U,  789504777U, 3719782907U,  377661999U, 1257636501U, 2746608887U, 2847819821U, 
+    2511538866U, 3908003337U, 3439587918U, 1571401282U, 2982036056U, 3526138931U, 1946533836U, 3384750352U, 
+    2274372634U,  798350948U, 2109034318U, 3515651203U,  610716232U,  231199096U, 2704266457U, 3981947214U, 
+    2954540987U, 4075282512U, 2589048151U, 1048946807U, 2776376927U, 2413750563U, 1450507833U,  504961897U, 
+     107579691U, 4121531371U,   36977721U,  685373927U, 3049792157U, 2960328341U, 2091902423U, 3054877796U, 
+    4280271749U, 3711276043U, 2262836621U, 3424380209U,  447847713U, 1269164117U, 2080539392U, 3997376491U, 
+    2836359329U, 4210930606U, 3752426015U, 4049500032U, 2904988912U,  765885340U, 2076407194U, 1990581326U, 
+    2494401824U,  830443906U, 3761341560U, 2535757162U, 1193156222U,  419806092U, 3485452999U, 1479677319U, 
+    1759770159U,  567501910U, 2723144283U, 2749098938U, 1851518591U, 2437853354U,  664454184U, 1625492175U, 
+     945292844U, 1815882254U, 1575932869U, 2107644168U, 1643783194U,  719546458U,   69729645U, 2465279452U, 
+    3171583905U, 3005277418U, 1389819736U, 3881297919U, 3737702907U, 3271727139U, 3405937096U, 2788467239U, 
+    3088967088U,   42432337U, 1340808829U, 3916088949U, 3590180021U, 2279065638U, 2464283708U, 2719588111U, 
+    4183025531U, 1426970623U, 4221684852U, 3690467244U,  527469994U, 2396507782U, 3501547418U, 3742327674U, 
+     866868576U, 4045778406U, 4050477358U, 1709609736U, 1615122580U, 1404236148U, 2449499994U,  820165988U, 
+    1308291514U,  574791441U,  727236310U, 2946572874U, 3764099919U, 2394528169U,  738921715U, 4237687631U, 
+    1045133694U, 3598699662U, 3480796664U, 2604970935U, 3866846967U, 2252782108U,  848881766U, 1460437731U, 
+    2197849126U, 3205801202U, 1236712377U, 2750734869U, 1024317336U, 3225390352U, 1067830057U, 3678543990U, 
+    1323004706U,   77645049U,  517209018U, 3058763730U, 3262585228U,  756905595U, 2864105160U,   58794523U, 
+     979544343U,  959019222U, 2074510614U,  405602024U,  343894021U,  572483549U, 3865651348U,  214791212U, 
+     107223960U, 1516979773U, 4006507105U, 2630406710U,  937601208U, 3250651473U,   73730553U,          0U
+};
+// clang-format on
+
+#endif // WELL19937_PRECOMPUTED_HPP_
@@ -22,6 +22,7 @@
 #define ROCRAND_RNG_XORWOW_H_
 
 #include <algorithm>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand/rocrand.h>
@@ -30,6 +31,8 @@
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "persistent.hpp"
+#include "tuning.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -47,7 +50,36 @@ namespace detail {
         engines[engine_id] = xorwow_device_engine(seed, engine_id, offset + (engine_id < start_engine_id ? 1 : 0));
     }
 
-    template<class T, class Distribution>
+    // Moves already initialized engines from one offset to a later one
+    // by the difference instead of rebuilding them from the seed. delta
+    // is the difference of the per-engine base offsets; the start ids
+    // adjust it for the engines before the rotation point.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void advance_engines_kernel(xorwow_device_engine * engines,
+                                const unsigned int old_start_engine_id,
+                                const unsigned int new_start_engine_id,
+                                const unsigned long long delta)
+    {
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        unsigned long long d = delta;
+        if(engine_id < new_start_engine_id)
+        {
+            d++;
+        }
+        // Never underflows: a zero delta means the rotation point only
+        // moved forward, so this engine is also before the new one
+        if(engine_id < old_start_engine_id)
+        {
+            d--;
+        }
+        if(d > 0)
+        {
+            engines[engine_id].discard(d);
+        }
+    }
+
+    template<unsigned int ValuesPerThread, class T, class Distribution>
     ROCRAND_KERNEL
     __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
     void generate_kernel(xorwow_device_engine * engines,
@@ -81,6 +113,28 @@ namespace detail {
 
         vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
         size_t index = id;
+        // Each iteration produces ValuesPerThread vectors at strided
+        // positions before storing any of them; the engine is consumed
+        // in the same order as with one value per thread, so the output
+        // does not depend on the batching factor
+        while(index + (ValuesPerThread - 1) * static_cast<size_t>(stride) < vec_n)
+        {
+            vec_type batch[ValuesPerThread];
+            for(unsigned int v = 0; v < ValuesPerThread; v++)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = engine();
+                }
+                distribution(input, output);
+                batch[v] = *reinterpret_cast<vec_type *>(output);
+            }
+            for(unsigned int v = 0; v < ValuesPerThread; v++)
+            {
+                vec_data[index + v * static_cast<size_t>(stride)] = batch[v];
+            }
+            index += ValuesPerThread * static_cast<size_t>(stride);
+        }
         while(index < vec_n)
         {
             for(unsigned int i = 0; i < input_width; i++)
@@ -139,6 +193,149 @@ namespace detail {
         engines[engine_id] = engine;
     }
 
+    // Fills several equally sized buffers in one launch: each engine
+    // feeds its successive outputs through the distributions of the
+    // descriptors in turn, so a simulation step that needs a handful of
+    // buffers pays one launch and one engine load/store instead of one
+    // of each per buffer. Scalar stores only; the win is the launches,
+    // not the memory path.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_multi_kernel(xorwow_device_engine * engines,
+                               const unsigned int start_engine_id,
+                               const rocrand_multi_descriptor * fills,
+                               const unsigned int n_fills,
+                               const size_t n)
+    {
+        const unsigned int id     = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride = gridDim.x * blockDim.x;
+
+        // Stride MUST be a power of two
+        const unsigned int engine_id = (id + start_engine_id) & (stride - 1);
+        xorwow_device_engine engine = engines[engine_id];
+
+        for(unsigned int f = 0; f < n_fills; f++)
+        {
+            const rocrand_multi_descriptor fill = fills[f];
+            if(fill.kind == ROCRAND_CALL_UNIFORM_INT)
+            {
+                unsigned int * data = static_cast<unsigned int *>(fill.data);
+                for(size_t i = id; i < n; i += stride)
+                {
+                    data[i] = engine();
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_UNIFORM_FLOAT)
+            {
+                float * data = static_cast<float *>(fill.data);
+                for(size_t i = id; i < n; i += stride)
+                {
+                    data[i] = rocrand_device::detail::uniform_distribution(engine());
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_UNIFORM_DOUBLE)
+            {
+                double * data = static_cast<double *>(fill.data);
+                for(size_t i = id; i < n; i += stride)
+                {
+                    const unsigned int x = engine();
+                    const unsigned int y = engine();
+                    data[i] = rocrand_device::detail::uniform_distribution_double(x, y);
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_NORMAL_FLOAT)
+            {
+                float * data = static_cast<float *>(fill.data);
+                normal_distribution<float> distribution(
+                    static_cast<float>(fill.mean), static_cast<float>(fill.stddev));
+                for(size_t i = 2 * id; i < n; i += 2 * static_cast<size_t>(stride))
+                {
+                    const unsigned int input[2] = { engine(), engine() };
+                    float output[2];
+                    distribution(input, output);
+                    data[i] = output[0];
+                    if(i + 1 < n)
+                    {
+                        data[i + 1] = output[1];
+                    }
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_NORMAL_DOUBLE)
+            {
+                double * data = static_cast<double *>(fill.data);
+                normal_distribution<double> distribution(fill.mean, fill.stddev);
+                for(size_t i = 2 * id; i < n; i += 2 * static_cast<size_t>(stride))
+                {
+                    const unsigned int input[4] = { engine(), engine(), engine(), engine() };
+                    double output[2];
+                    distribution(input, output);
+                    data[i] = output[0];
+                    if(i + 1 < n)
+                    {
+                        data[i + 1] = output[1];
+                    }
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_EXPONENTIAL_FLOAT)
+            {
+                float * data = static_cast<float *>(fill.data);
+                exponential_distribution<float> distribution(static_cast<float>(fill.lambda));
+                for(size_t i = id; i < n; i += stride)
+                {
+                    const unsigned int input[1] = { engine() };
+                    float output[1];
+                    distribution(input, output);
+                    data[i] = output[0];
+                }
+            }
+            else if(fill.kind == ROCRAND_CALL_EXPONENTIAL_DOUBLE)
+            {
+                double * data = static_cast<double *>(fill.data);
+                exponential_distribution<double> distribution(fill.lambda);
+                for(size_t i = id; i < n; i += stride)
+                {
+                    const unsigned int input[2] = { engine(), engine() };
+                    double output[1];
+                    distribution(input, output);
+                    data[i] = output[0];
+                }
+            }
+        }
+
+        engines[engine_id] = engine;
+    }
+
+    // Variant of generate_multi_kernel for rocrand_generate_batch():
+    // raw 32-bit fills of independent sizes. Each engine feeds its
+    // successive outputs into the buffers in turn, so no values repeat
+    // between the buffers.
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void generate_batch_kernel(xorwow_device_engine * engines,
+                               const unsigned int start_engine_id,
+                               const batch_fill * fills,
+                               const unsigned int n_fills)
+    {
+        const unsigned int id     = blockIdx.x * blockDim.x + threadIdx.x;
+        const unsigned int stride = gridDim.x * blockDim.x;
+
+        // Stride MUST be a power of two
+        const unsigned int engine_id = (id + start_engine_id) & (stride - 1);
+        xorwow_device_engine engine = engines[engine_id];
+
+        for(unsigned int f = 0; f < n_fills; f++)
+        {
+            unsigned int * const data = fills[f].data;
+            const size_t size = fills[f].size;
+            for(size_t i = id; i < size; i += stride)
+            {
+                data[i] = engine();
+            }
+        }
+
+        engines[engine_id] = engine;
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -156,10 +353,30 @@ public:
         , m_engines_initialized(false)
         , m_engines(NULL)
         , m_engines_size(s_threads * s_blocks)
+        , m_dynamic_blocks(0)
+        , m_engines_owned(true)
+        , m_workspace_size(0)
+        , m_engines_at_offset(false)
+        , m_applied_offset(0)
+        , m_multi_capacity(0)
+        , m_multi_descriptors(NULL)
+        , m_batch_capacity(0)
+        , m_batch_descriptors(NULL)
     {
+        // A tuned entry for this architecture overrides the compiled
+        // grid; the thread count and the power-of-two engine count are
+        // scheduling invariants, so entries breaking them are ignored
+        rocrand_host::detail::tuning_entry tuned;
+        if(rocrand_host::detail::tuning_table::instance().lookup("xorwow", &tuned)
+           && tuned.threads == s_threads
+           && (tuned.blocks & (tuned.blocks - 1)) == 0)
+        {
+            m_engines_size = s_threads * tuned.blocks;
+        }
+
         // Allocate device random number engines
         auto error
-            = hipMalloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
+            = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -168,7 +385,18 @@ public:
 
     ~rocrand_xorwow()
     {
-        hipFree(m_engines);
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+        if(m_multi_descriptors != NULL)
+        {
+            rocrand_host::detail::device_free(m_multi_descriptors);
+        }
+        if(m_batch_descriptors != NULL)
+        {
+            rocrand_host::detail::device_free(m_batch_descriptors);
+        }
     }
 
     /// Changes seed to \p seed and resets generator state.
@@ -176,6 +404,14 @@ public:
     {
         m_seed = seed;
         m_engines_initialized = false;
+        m_engines_at_offset = false;
+        // The queue engines are seeded at start, so a running queue is
+        // restarted to pick up the new seed
+        if(m_persistent.active())
+        {
+            m_persistent.stop();
+            m_persistent.start(m_seed, s_threads * s_blocks, s_threads);
+        }
     }
 
     void set_offset(unsigned long long offset)
@@ -188,6 +424,54 @@ public:
     {
         m_order               = order;
         m_engines_initialized = false;
+        m_engines_at_offset   = false;
+    }
+
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states under the current configuration; the size
+    // can change when the ordering changes.
+    size_t get_workspace_size()
+    {
+        return sizeof(engine_type) * target_engines_size();
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void * ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * m_engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned = true;
+                m_workspace_size = 0;
+                m_engines_initialized = false;
+                m_engines_at_offset = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+        m_engines = static_cast<engine_type *>(ptr);
+        m_engines_size = target_engines_size();
+        m_workspace_size = size;
+        m_engines_owned = false;
+        m_engines_initialized = false;
+        m_engines_at_offset = false;
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     rocrand_status init()
@@ -195,11 +479,68 @@ public:
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        const size_t engines_size = target_engines_size();
+
+        // The engines still sit exactly at the offset they were last
+        // initialized to when nothing was generated since; a later
+        // offset is then reached by advancing them by the difference,
+        // skipping the full rebuild from the seed. Consecutive
+        // rocrand_set_offset calls collapse into one advance here.
+        if(m_engines_at_offset && engines_size == m_engines_size
+           && m_offset >= m_applied_offset)
+        {
+            if(m_offset == m_applied_offset)
+            {
+                m_engines_initialized = true;
+                return ROCRAND_STATUS_SUCCESS;
+            }
+
+            const unsigned long long delta
+                = m_offset / m_engines_size - m_applied_offset / m_engines_size;
+            const unsigned int new_start_engine_id = m_offset % m_engines_size;
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::advance_engines_kernel),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, new_start_engine_id, delta
+            );
+            if(hipGetLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            m_start_engine_id = new_start_engine_id;
+            m_applied_offset = m_offset;
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        if(engines_size != m_engines_size)
+        {
+            if(!m_engines_owned)
+            {
+                // A caller-provided workspace is only resized within
+                // the capacity it was registered with
+                if(sizeof(engine_type) * engines_size > m_workspace_size)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+            }
+            else
+            {
+                rocrand_host::detail::device_free(m_engines);
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+                statistics.count_reallocation();
+            }
+        }
+
         m_start_engine_id = m_offset % m_engines_size;
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
             m_engines, m_start_engine_id, m_seed, m_offset / m_engines_size
         );
         // Check kernel status
@@ -207,37 +548,116 @@ public:
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
         m_engines_initialized = true;
+        m_applied_offset = m_offset;
+        m_engines_at_offset = true;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    // Starts or stops the resident fill kernel (see
+    // rocrand_set_persistent_mode). The queue's engines take the
+    // subsequences above the largest grid, so queued fills never repeat
+    // values of launched fills.
+    rocrand_status set_persistent_mode(bool enabled)
+    {
+        if(enabled)
+        {
+            return m_persistent.start(m_seed, s_threads * s_blocks, s_threads);
+        }
+        return m_persistent.stop();
+    }
+
+    rocrand_status persistent_fence()
+    {
+        m_persistent.fence();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T, class Distribution = uniform_distribution<T> >
     rocrand_status generate(T * data, size_t data_size,
                             Distribution distribution = Distribution())
     {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
         rocrand_status status = init();
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_start_engine_id, data, data_size, distribution
-        );
+        statistics.begin_launch(m_stream);
+
+        // Batching factor picked from the fill size and the grid in use
+        // on this device; the generated sequence is the same for all
+        const unsigned int values_per_thread = rocrand_host::detail::generate_values_per_thread(
+            data_size / Distribution::output_width, m_engines_size);
+        if(values_per_thread == 8)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<8>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
+        else if(values_per_thread == 4)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<4>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<1>),
+                dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+                m_engines, m_start_engine_id, data, data_size, distribution
+            );
+        }
         // Check kernel status
-        if(hipGetLastError() != hipSuccess)
+        if(launch_failed())
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        // The engines no longer sit at a known offset
+        m_engines_at_offset = false;
+
         // Generating data_size values will use this many distributions
         const auto touched_engines =
             (data_size + Distribution::output_width - 1) /
             Distribution::output_width;
 
-        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        // Under ROCRAND_ORDERING_PSEUDO_FASTEST the deterministic
+        // engine rotation is dropped; engines keep their own state, so
+        // no values repeat, but the sequence layout is not reproducible
+        if (m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    // Non-template overloads route the fill types the persistent
+    // kernel understands through the queue while it is active
+    rocrand_status generate(unsigned int * data, size_t data_size)
+    {
+        if(!antithetic && try_persistent(data, data_size,
+                          rocrand_host::detail::persistent_op_uniform_uint,
+                          0.0f, 0.0f))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        uniform_distribution<unsigned int> distribution;
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_uniform(T * data, size_t data_size)
     {
@@ -245,20 +665,336 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_uniform(float * data, size_t data_size)
+    {
+        if(!antithetic && try_persistent(data, data_size,
+                          rocrand_host::detail::persistent_op_uniform_float,
+                          0.0f, 0.0f))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        uniform_distribution<float> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform(double * data, size_t data_size)
+    {
+        if(!antithetic && try_persistent(data, data_size,
+                          rocrand_host::detail::persistent_op_uniform_double,
+                          0.0f, 0.0f))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        uniform_distribution<double> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Fills each of the \p n_fills buffers described in \p fills with
+    /// \p n values of its distribution in a single launch; each engine
+    /// feeds its successive outputs through the distributions of the
+    /// descriptors in turn, so no values repeat between the buffers.
+    rocrand_status generate_multi(const rocrand_multi_descriptor * fills,
+                                  unsigned int n_fills, size_t n)
+    {
+        if(fills == NULL && n_fills > 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        // Validate every descriptor up front so a bad one cannot leave
+        // the fill half done
+        size_t touched_engines = 0;
+        size_t bytes = 0;
+        for(unsigned int f = 0; f < n_fills; f++)
+        {
+            switch(fills[f].kind)
+            {
+                case ROCRAND_CALL_UNIFORM_INT:
+                case ROCRAND_CALL_UNIFORM_FLOAT:
+                case ROCRAND_CALL_EXPONENTIAL_FLOAT:
+                    touched_engines += n;
+                    bytes += n * sizeof(unsigned int);
+                    break;
+                case ROCRAND_CALL_UNIFORM_DOUBLE:
+                case ROCRAND_CALL_EXPONENTIAL_DOUBLE:
+                    touched_engines += n;
+                    bytes += n * sizeof(double);
+                    break;
+                case ROCRAND_CALL_NORMAL_FLOAT:
+                    touched_engines += (n + 1) / 2;
+                    bytes += n * sizeof(float);
+                    break;
+                case ROCRAND_CALL_NORMAL_DOUBLE:
+                    touched_engines += (n + 1) / 2;
+                    bytes += n * sizeof(double);
+                    break;
+                default:
+                    return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            if(fills[f].data == NULL)
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            if((fills[f].kind == ROCRAND_CALL_EXPONENTIAL_FLOAT
+                || fills[f].kind == ROCRAND_CALL_EXPONENTIAL_DOUBLE)
+               && fills[f].lambda <= 0.0)
+            {
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+        }
+        if(n_fills == 0 || n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // One descriptor upload per call; the device copy is cached on
+        // the generator and grown on demand
+        if(m_multi_capacity < n_fills)
+        {
+            void * descriptors;
+            if(rocrand_host::detail::device_malloc(
+                   &descriptors, sizeof(rocrand_multi_descriptor) * n_fills) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_multi_descriptors);
+            m_multi_descriptors = descriptors;
+            m_multi_capacity = n_fills;
+            statistics.count_reallocation();
+        }
+        if(hipMemcpy(m_multi_descriptors, fills,
+                     sizeof(rocrand_multi_descriptor) * n_fills,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multi_kernel),
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+            m_engines, m_start_engine_id,
+            static_cast<const rocrand_multi_descriptor *>(m_multi_descriptors),
+            n_fills, n
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // The engines no longer sit at a known offset
+        m_engines_at_offset = false;
+
+        statistics.end_launch(bytes, m_stream);
+
+        if (m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills each of the \p n_buffers buffers with its own number of
+    /// raw 32-bit values in a single launch; buffer \p b receives
+    /// <tt>sizes[b]</tt> values. Like generate_multi(), the values are
+    /// not the same values sequential generate() calls would produce,
+    /// but every value is consumed from the engines exactly once, so no
+    /// values repeat between the buffers.
+    rocrand_status generate_batch(unsigned int * const * buffers,
+                                  const size_t * sizes,
+                                  unsigned int n_buffers)
+    {
+        if(buffers == NULL || sizes == NULL || n_buffers == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        size_t touched_engines = 0;
+        for(unsigned int b = 0; b < n_buffers; b++)
+        {
+            if(buffers[b] == NULL && sizes[b] > 0)
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            touched_engines += sizes[b];
+        }
+        if(touched_engines == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // One descriptor upload per call; the device copy is cached on
+        // the generator and grown on demand
+        std::vector<rocrand_host::detail::batch_fill> fills(n_buffers);
+        for(unsigned int b = 0; b < n_buffers; b++)
+        {
+            fills[b].data = buffers[b];
+            fills[b].size = sizes[b];
+        }
+        if(m_batch_capacity < n_buffers)
+        {
+            void * descriptors;
+            if(rocrand_host::detail::device_malloc(
+                   &descriptors, sizeof(rocrand_host::detail::batch_fill) * n_buffers)
+               != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_batch_descriptors);
+            m_batch_descriptors = descriptors;
+            m_batch_capacity = n_buffers;
+            statistics.count_reallocation();
+        }
+        if(hipMemcpy(m_batch_descriptors, fills.data(),
+                     sizeof(rocrand_host::detail::batch_fill) * n_buffers,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_batch_kernel),
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+            m_engines, m_start_engine_id,
+            static_cast<const rocrand_host::detail::batch_fill *>(m_batch_descriptors),
+            n_buffers
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // The engines no longer sit at a known offset
+        m_engines_at_offset = false;
+
+        statistics.end_launch(touched_engines * sizeof(unsigned int), m_stream);
+
+        if (m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        normal_distribution<T> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_normal(float * data, size_t data_size,
+                                   float mean, float stddev)
+    {
+        if(!antithetic && try_persistent(data, data_size,
+                          rocrand_host::detail::persistent_op_normal_float,
+                          mean, stddev))
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        normal_distribution<float> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        log_normal_distribution<T> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
         return generate(data, data_size, distribution);
     }
 
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
@@ -272,10 +1008,94 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    bool try_persistent(void * data, size_t data_size,
+                        rocrand_host::detail::persistent_op op,
+                        float mean, float stddev)
+    {
+        if(!m_persistent.active())
+        {
+            return false;
+        }
+        rocrand_host::detail::persistent_descriptor desc;
+        desc.data = data;
+        desc.n = data_size;
+        desc.op = op;
+        desc.mean = mean;
+        desc.stddev = stddev;
+        return m_persistent.enqueue(desc);
+    }
+
+    // Number of engines (and with it the grid) used for generation.
+    // Under ROCRAND_ORDERING_PSEUDO_DYNAMIC and
+    // ROCRAND_ORDERING_PSEUDO_FASTEST it follows the device's
+    // occupancy, rounded down to a power of two because generate_kernel
+    // computes engine ids with & (stride - 1).
+    size_t target_engines_size()
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order))
+        {
+            return s_threads * s_blocks;
+        }
+        if(m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            const unsigned int blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type *, const unsigned int, unsigned int *,
+                                     const size_t, uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<1, unsigned int, uniform_distribution<unsigned int>>),
+                s_threads);
+            m_dynamic_blocks
+                = blocks == 0 ? s_blocks
+                              : rocrand_host::detail::previous_power_of_two(blocks);
+        }
+        return s_threads * static_cast<size_t>(m_dynamic_blocks);
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
+    uint32_t m_dynamic_blocks;
+    // Engine states may live in a caller-provided workspace
+    bool m_engines_owned;
+    size_t m_workspace_size;
+    // True while the engine states sit exactly at m_applied_offset,
+    // allowing init() to reach a later offset by a delta advance
+    bool m_engines_at_offset;
+    unsigned long long m_applied_offset;
+    // Device-side copy of the multi-fill descriptors, grown on demand
+    unsigned int m_multi_capacity;
+    void * m_multi_descriptors;
+    unsigned int m_batch_capacity;
+    void * m_batch_descriptors;
 
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
@@ -283,6 +1103,14 @@ private:
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
 
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // Resident fill kernel and its descriptor ring (see
+    // rocrand_set_persistent_mode)
+    rocrand_host::detail::persistent_generator_queue<engine_type> m_persistent;
+
     // m_seed from base_type
     // m_offset from base_type
 
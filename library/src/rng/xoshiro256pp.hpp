@@ -0,0 +1,452 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_XOSHIRO256PP_H_
+#define ROCRAND_RNG_XOSHIRO256PP_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    typedef ::rocrand_device::xoshiro256pp_engine xoshiro256pp_device_engine;
+
+    ROCRAND_KERNEL
+    __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+    void init_engines_kernel(xoshiro256pp_device_engine * engines,
+                             const unsigned int start_engine_id,
+                             unsigned long long seed,
+                             unsigned long long offset)
+    {
+        const unsigned int engine_id = blockIdx.x * blockDim.x + threadIdx.x;
+        engines[engine_id] = xoshiro256pp_device_engine(seed, engine_id, offset + (engine_id < start_engine_id ? 1 : 0));
+    }
+
+    // Generation uses the shared engine-array generate_kernel from
+    // common.hpp.
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_xoshiro256pp : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_XOSHIRO256PP>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_XOSHIRO256PP>;
+    using engine_type = ::rocrand_host::detail::xoshiro256pp_device_engine;
+
+    rocrand_xoshiro256pp(unsigned long long seed   = 0,
+                         unsigned long long offset = 0,
+                         rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                         hipStream_t        stream = 0)
+        : base_type(order, seed, offset, stream)
+        , m_engines_initialized(false)
+        , m_engines(NULL)
+        , m_engines_size(s_threads * s_blocks)
+        , m_dynamic_blocks(0)
+        , m_engines_owned(true)
+        , m_workspace_size(0)
+    {
+        // Allocate device random number engines
+        auto error
+            = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines), sizeof(engine_type) * m_engines_size);
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    ~rocrand_xoshiro256pp()
+    {
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    void set_order(rocrand_ordering order)
+    {
+        m_order               = order;
+        m_engines_initialized = false;
+    }
+
+    // Returns the number of bytes of device memory the generator needs
+    // for its engine states under the current configuration; the size
+    // can change when the ordering changes.
+    size_t get_workspace_size()
+    {
+        return sizeof(engine_type) * target_engines_size();
+    }
+
+    // Places the engine states in caller-provided device memory of at
+    // least get_workspace_size() bytes instead of an allocation owned
+    // by the generator; a NULL \p ptr returns the generator to its own
+    // allocation. The caller keeps ownership of the memory and must
+    // keep it alive until the generator is destroyed or the workspace
+    // is reset.
+    rocrand_status set_workspace(void * ptr, size_t size)
+    {
+        if(ptr == NULL)
+        {
+            if(!m_engines_owned)
+            {
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * m_engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_owned = true;
+                m_workspace_size = 0;
+                m_engines_initialized = false;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(size < get_workspace_size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_engines_owned)
+        {
+            rocrand_host::detail::device_free(m_engines);
+        }
+        m_engines = static_cast<engine_type *>(ptr);
+        m_engines_size = target_engines_size();
+        m_workspace_size = size;
+        m_engines_owned = false;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const size_t engines_size = target_engines_size();
+        if(engines_size != m_engines_size)
+        {
+            if(!m_engines_owned)
+            {
+                // A caller-provided workspace is only resized within
+                // the capacity it was registered with
+                if(sizeof(engine_type) * engines_size > m_workspace_size)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+            }
+            else
+            {
+                rocrand_host::detail::device_free(m_engines);
+                m_engines = NULL;
+                hipError_t error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&m_engines),
+                                             sizeof(engine_type) * engines_size);
+                if(error != hipSuccess)
+                    return ROCRAND_STATUS_ALLOCATION_FAILED;
+                m_engines_size = engines_size;
+                statistics.count_reallocation();
+            }
+        }
+
+        m_start_engine_id = m_offset % m_engines_size;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+            m_engines, m_start_engine_id, m_seed, m_offset / m_engines_size
+        );
+        // Check kernel status
+        if(hipGetLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T, unsigned long long> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        // Antithetic mode pairs every value with its antithetic mate
+        // by wrapping the distribution (see distribution/antithetic.hpp)
+        if(antithetic && !is_antithetic<Distribution>::value)
+        {
+            return rocrand_host::detail::generate_antithetic(*this, data,
+                                                             data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        statistics.begin_launch(m_stream);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(m_engines_size / s_threads), dim3(s_threads), 0, m_stream,
+            m_engines, m_start_engine_id, data, data_size, distribution
+        );
+        // Check kernel status
+        if(launch_failed())
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Generating data_size values will use this many distributions
+        const auto touched_engines =
+            (data_size + Distribution::output_width - 1) /
+            Distribution::output_width;
+
+        statistics.end_launch(data_size * sizeof(T), m_stream);
+
+        // Under ROCRAND_ORDERING_PSEUDO_FASTEST the deterministic
+        // engine rotation is dropped; engines keep their own state, so
+        // no values repeat, but the sequence layout is not reproducible
+        if (m_order != ROCRAND_ORDERING_PSEUDO_FASTEST)
+        {
+            m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        }
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T, unsigned long long> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T, unsigned long long> distribution(mean, stddev, math_mode, normal_method);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T, unsigned long long> distribution(mean, stddev, lo, hi);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T, unsigned long long> distribution(mean, stddev, math_mode);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T, unsigned long long> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T sigma)
+    {
+        cauchy_distribution<T, unsigned long long> distribution(median, sigma);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_unit_vector2(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<2, unsigned long long> distribution;
+        return generate(data, n_vectors * 2, distribution);
+    }
+
+    rocrand_status generate_unit_vector3(float * data, size_t n_vectors)
+    {
+        // Directions are padded to four floats per vector (w = 0)
+        unit_vector_distribution<3, unsigned long long> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    rocrand_status generate_unit_vector4(float * data, size_t n_vectors)
+    {
+        unit_vector_distribution<4, unsigned long long> distribution;
+        return generate(data, n_vectors * 4, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T, unsigned long long> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T, unsigned long long> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int_range(unsigned int * data, size_t data_size,
+                                              unsigned int start, unsigned int range)
+    {
+        uniform_int_range_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T low, T high)
+    {
+        uniform_range_distribution<T, unsigned long long> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int8(signed char * data, size_t data_size,
+                                         int start, unsigned int range)
+    {
+        uniform_int8_range_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_uniform_int4_packed(unsigned char * data, size_t data_size,
+                                                int start, unsigned int range)
+    {
+        uniform_int4_packed_distribution<unsigned long long> distribution(start, range);
+        return generate(data, data_size, distribution);
+    }
+
+    size_t get_reclaimable_memory_size() const
+    {
+        return m_binomial.memory_size();
+    }
+
+    void trim()
+    {
+        m_binomial.trim();
+    }
+
+    template<class T>
+    rocrand_status generate_poisson(T * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& discrete_dis)
+    {
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(
+            discrete_dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int t, double probability)
+    {
+        if(t <= binomial_histogram_threshold)
+        {
+            try
+            {
+                m_binomial.set_params(t, probability, m_stream);
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+            return generate(data, data_size, m_binomial.dis);
+        }
+        binomial_approx_distribution distribution(t, probability);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Number of engines (and with it the grid) used for generation.
+    // Under ROCRAND_ORDERING_PSEUDO_DYNAMIC and
+    // ROCRAND_ORDERING_PSEUDO_FASTEST it follows the device's
+    // occupancy, rounded down to a power of two because generate_kernel
+    // computes engine ids with & (stride - 1).
+    size_t target_engines_size()
+    {
+        if(!rocrand_host::detail::uses_device_occupancy(m_order))
+        {
+            return s_threads * s_blocks;
+        }
+        if(m_dynamic_blocks == 0)
+        {
+            // Queried once per generator; the uniform kernel is
+            // representative for the other distributions
+            const unsigned int blocks = rocrand_host::detail::max_resident_blocks(
+                static_cast<void (*)(engine_type *, const unsigned int, unsigned long long *,
+                                     const size_t, uniform_distribution<unsigned long long, unsigned long long>)>(
+                    rocrand_host::detail::generate_kernel<engine_type, unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>),
+                s_threads);
+            m_dynamic_blocks
+                = blocks == 0 ? s_blocks
+                              : rocrand_host::detail::previous_power_of_two(blocks);
+        }
+        return s_threads * static_cast<size_t>(m_dynamic_blocks);
+    }
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    size_t m_engines_size;
+    uint32_t m_dynamic_blocks;
+    // Engine states may live in a caller-provided workspace
+    bool m_engines_owned;
+    size_t m_workspace_size;
+
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_blocks = 512;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+
+    // For caching of binomial histograms for consecutive generations with the
+    // same parameters
+    binomial_distribution_manager<> m_binomial;
+
+    // m_seed from base_type
+    // m_offset from base_type
+
+    unsigned int m_start_engine_id;
+};
+
+#endif // ROCRAND_RNG_XOSHIRO256PP_H_
@@ -21,9 +21,435 @@
 #include <hip/hip_runtime.h>
 
 #include "rng/generators.hpp"
+#include "rng/instantiations.hpp"
+#include "rng/profiling.hpp"
+#include "rng/self_test.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <new>
+#include <random>
 #include <rocrand/rocrand.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace rocrand_host {
+namespace detail {
+
+// Installed with rocrand_set_allocator(); read by device_malloc() and
+// device_free() in common.hpp
+rocrand_alloc_func device_alloc_hook          = NULL;
+rocrand_free_func  device_free_hook           = NULL;
+void *             device_alloc_hook_user_data = NULL;
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// A pool keeps released generators of one type so a later acquisition
+// can reuse them together with their device allocations
+struct rocrand_generator_pool_st
+{
+    rocrand_rng_type               rng_type;
+    std::mutex                     mutex;
+    std::vector<rocrand_generator> idle;
+};
+
+// A double-buffered generation-to-host pipeline: while one device
+// buffer copies to the host sink on the copy stream, the other buffer
+// is refilled by a generation kernel on the generator's stream
+struct rocrand_stream_st
+{
+    rocrand_generator generator;
+    hipStream_t       generate_stream;
+    hipStream_t       copy_stream;
+    unsigned int *    sink;
+    size_t            chunk_size;
+    unsigned int *    buffers[2];
+    hipEvent_t        generated[2];
+    hipEvent_t        copied[2];
+    unsigned int      current;
+};
+
+// A speculative pre-generation cache installed with
+// rocrand_set_prefetch(): the next chunks of the sequence are generated
+// ahead into two device buffers on a low-priority stream, so a matching
+// rocrand_generate() call is served by a device-to-device copy
+struct rocrand_prefetch_st
+{
+    size_t         chunk_size;
+    hipStream_t    prefetch_stream;
+    unsigned int * buffers[2];
+    hipEvent_t     ready[2];
+    hipEvent_t     released[2];
+    unsigned int   current;
+    // Buffer lent out by rocrand_acquire_buffer(), -1 when none; it is
+    // refilled at the next consuming call, after the reads the caller
+    // enqueued in between
+    int            handed_out;
+    // Set around the cache's own refill calls so they are not served
+    // from the cache they are filling
+    bool           filling;
+};
+
+static std::mutex                                        prefetch_mutex;
+static std::map<rocrand_generator, rocrand_prefetch_st*> prefetch_caches;
+
+// One logical Philox sequence partitioned across several devices: each
+// device holds its own generator and stream, and every fill positions
+// the per-device generators on the shared counter with offset
+// arithmetic, so the concatenated output equals the single-device
+// sequence
+struct rocrand_generator_multi_gpu_st
+{
+    std::vector<int>               devices;
+    std::vector<rocrand_generator> generators;
+    std::vector<hipStream_t>       streams;
+    // Position of the next value of the logical sequence
+    unsigned long long             offset;
+};
+
+// Returns the stream the generator launches its kernels on
+static hipStream_t rocrand_generator_stream(rocrand_generator generator)
+{
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->get_stream();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        return static_cast<rocrand_tape*>(generator)->get_stream();
+    }
+    return 0;
+}
+
+// Returns the seed the generator was created or reseeded with, for the
+// tape header written by rocrand_write_tape(): the 64-bit seed of the
+// pseudorandom types, the folded seed words of the uint4-seeded
+// LFSR113, and 0 for the seedless quasirandom types
+static unsigned long long rocrand_generator_seed(rocrand_generator generator)
+{
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        const uint4 seed = static_cast<rocrand_lfsr113*>(generator)->get_seed();
+        return ((static_cast<unsigned long long>(seed.x) << 32) | seed.y)
+               ^ ((static_cast<unsigned long long>(seed.z) << 32) | seed.w);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->get_seed();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->get_seed();
+    }
+    return 0;
+}
+
+// Releases whatever resources of a partially or fully constructed
+// pipeline are present
+static void rocrand_stream_free(rocrand_stream stream)
+{
+    for(int i = 0; i < 2; i++)
+    {
+        if(stream->buffers[i] != NULL)
+        {
+            rocrand_host::detail::device_free(stream->buffers[i]);
+        }
+        if(stream->generated[i] != NULL)
+        {
+            hipEventDestroy(stream->generated[i]);
+        }
+        if(stream->copied[i] != NULL)
+        {
+            hipEventDestroy(stream->copied[i]);
+        }
+    }
+    if(stream->copy_stream != NULL)
+    {
+        hipStreamDestroy(stream->copy_stream);
+    }
+    delete stream;
+}
+
+// Returns the prefetch cache of the generator, or NULL when prefetching
+// is not enabled
+static rocrand_prefetch_st* rocrand_prefetch_cache(rocrand_generator generator)
+{
+    std::lock_guard<std::mutex> lock(prefetch_mutex);
+    std::map<rocrand_generator, rocrand_prefetch_st*>::iterator it
+        = prefetch_caches.find(generator);
+    return it == prefetch_caches.end() ? NULL : it->second;
+}
+
+// Releases whatever resources of a partially or fully constructed
+// cache are present
+static void rocrand_prefetch_free(rocrand_prefetch_st* prefetch)
+{
+    for(int i = 0; i < 2; i++)
+    {
+        if(prefetch->buffers[i] != NULL)
+        {
+            rocrand_host::detail::device_free(prefetch->buffers[i]);
+        }
+        if(prefetch->ready[i] != NULL)
+        {
+            hipEventDestroy(prefetch->ready[i]);
+        }
+        if(prefetch->released[i] != NULL)
+        {
+            hipEventDestroy(prefetch->released[i]);
+        }
+    }
+    if(prefetch->prefetch_stream != NULL)
+    {
+        hipStreamDestroy(prefetch->prefetch_stream);
+    }
+    delete prefetch;
+}
+
+// Refills buffer i of the cache on the low-priority stream, ordered
+// behind everything enqueued on the generator's stream so far; the
+// previous refill serializes on the same stream, so the engine state is
+// only ever advanced by one chunk generation at a time
+static rocrand_status rocrand_prefetch_fill(rocrand_generator generator,
+                                            rocrand_prefetch_st* prefetch,
+                                            unsigned int i)
+{
+    hipStream_t generator_stream = rocrand_generator_stream(generator);
+    if(hipEventRecord(prefetch->released[i], generator_stream) != hipSuccess
+       || hipStreamWaitEvent(prefetch->prefetch_stream, prefetch->released[i], 0) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    rocrand_status status = rocrand_set_stream(generator, prefetch->prefetch_stream);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    prefetch->filling = true;
+    status = rocrand_generate(generator, prefetch->buffers[i], prefetch->chunk_size);
+    prefetch->filling = false;
+    const rocrand_status restored = rocrand_set_stream(generator, generator_stream);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    if(restored != ROCRAND_STATUS_SUCCESS)
+    {
+        return restored;
+    }
+
+    if(hipEventRecord(prefetch->ready[i], prefetch->prefetch_stream) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Detaches and releases the prefetch cache of the generator, if any
+static rocrand_status rocrand_prefetch_release(rocrand_generator generator)
+{
+    rocrand_prefetch_st* prefetch;
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        std::map<rocrand_generator, rocrand_prefetch_st*>::iterator it
+            = prefetch_caches.find(generator);
+        if(it == prefetch_caches.end())
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        prefetch = it->second;
+        prefetch_caches.erase(it);
+    }
+
+    // A refill may still be generating into the buffers
+    if(hipStreamSynchronize(prefetch->prefetch_stream) != hipSuccess)
+    {
+        rocrand_prefetch_free(prefetch);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    rocrand_prefetch_free(prefetch);
+    return ROCRAND_STATUS_SUCCESS;
+}
 
 #if defined(__cplusplus)
 extern "C" {
@@ -38,6 +464,10 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
         {
             *generator = new rocrand_philox4x32_10();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        {
+            *generator = new rocrand_philox4x32_7();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
         {
             *generator = new rocrand_mrg31k3p();
@@ -58,6 +488,18 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
         {
             *generator = new rocrand_scrambled_sobol32();
         }
+        else if(rng_type == ROCRAND_RNG_QUASI_HALTON)
+        {
+            *generator = new rocrand_halton();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_LATTICE)
+        {
+            *generator = new rocrand_lattice();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+        {
+            *generator = new rocrand_sobol32_owen();
+        }
         else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
         {
             *generator = new rocrand_sobol64();
@@ -70,6 +512,10 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
         {
             *generator = new rocrand_mtgp32();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+        {
+            *generator = new rocrand_adaptive();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
         {
             *generator = new rocrand_lfsr113();
@@ -78,10 +524,18 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
         {
             *generator = new rocrand_mt19937();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+        {
+            *generator = new rocrand_well19937();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
         {
             *generator = new rocrand_threefry2x32_20();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+        {
+            *generator = new rocrand_squares32();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
         {
             *generator = new rocrand_threefry2x64_20();
@@ -94,6 +548,26 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
         {
             *generator = new rocrand_threefry4x64_20();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+        {
+            *generator = new rocrand_threefry4x64_13();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            *generator = new rocrand_philox4x64_10();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+        {
+            *generator = new rocrand_pcg64();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+        {
+            *generator = new rocrand_xoshiro256pp();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+        {
+            *generator = new rocrand_chacha20();
+        }
         else
         {
             return ROCRAND_STATUS_TYPE_ERROR;
@@ -110,11 +584,31 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
     return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_destroy_generator(rocrand_generator generator)
+rocrand_status ROCRANDAPI rocrand_create_generator_host(rocrand_generator* generator,
+                                                        rocrand_rng_type   rng_type)
 {
     try
     {
-        delete(generator);
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            // Host generation reproduces the index-mapped ordering, so the
+            // generator is created with it
+            *generator = new rocrand_philox4x32_10(0,
+                                                   0,
+                                                   ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT,
+                                                   0,
+                                                   true);
+        }
+        else
+        {
+            // Only counter-based engines can position their state at an
+            // output index without walking device state
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
     catch(rocrand_status status)
     {
@@ -123,614 +617,7707 @@ rocrand_status ROCRANDAPI rocrand_destroy_generator(rocrand_generator generator)
     return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate(rocrand_generator generator,
-                                           unsigned int*     output_data,
-                                           size_t            n)
+rocrand_status ROCRANDAPI rocrand_create_generator_entropy_seeded(rocrand_generator*  generator,
+                                                                  rocrand_rng_type    rng_type,
+                                                                  unsigned long long* seed)
 {
-    if(generator == NULL)
+    unsigned long long entropy_seed;
+    try
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        // std::random_device reads the operating system's entropy source
+        // (getrandom, rdrand or equivalent); two 32-bit words make the
+        // 64-bit seed
+        std::random_device source;
+        entropy_seed = (static_cast<unsigned long long>(source()) << 32) | source();
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    catch(const std::exception&)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+
+    rocrand_generator g      = NULL;
+    rocrand_status    status = rocrand_create_generator(&g, rng_type);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    // Quasi-random types have no seed; they are returned in their
+    // initial state like rocrand_create_generator() would return them
+    status = rocrand_set_seed(g, entropy_seed);
+    if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_TYPE_ERROR)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        rocrand_destroy_generator(g);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    if(seed != NULL)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        *seed = entropy_seed;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    *generator = g;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_create_generator_async(rocrand_generator* generator,
+                                                         rocrand_rng_type   rng_type,
+                                                         hipStream_t        stream)
+{
+    rocrand_generator g      = NULL;
+    rocrand_status    status = rocrand_create_generator(&g, rng_type);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+
+    status = rocrand_set_stream(g, stream);
+    if(status == ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+        if(g->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+        {
+            // The MT19937 engine build is host-side work; the stream-ordered
+            // path moves it into a host callback on the stream instead of
+            // running it before returning
+            status = static_cast<rocrand_mt19937*>(g)->init_async();
+        }
+        else
+        {
+            status = rocrand_initialize_generator(g);
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate(output_data, n);
+        rocrand_destroy_generator(g);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+
+    *generator = g;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Copies the forkable configuration of \p parent into the freshly
+// created \p child and places the child at the start of subsequence
+// block \p block (see rocrand_clone_generator)
+template<class Generator>
+static rocrand_status rocrand_clone_into(Generator*               parent,
+                                         Generator*               child,
+                                         const unsigned long long block)
+{
+    child->set_seed(parent->get_seed());
+    child->set_offset(parent->get_offset());
+    child->set_order(parent->get_order());
+    child->set_stream(parent->get_stream());
+    return child->skip_ahead_subsequence(block << 48);
+}
+
+rocrand_status ROCRANDAPI rocrand_clone_generator(rocrand_generator  parent,
+                                                  rocrand_generator* child)
+{
+    const rocrand_host::detail::profile_range profile(parent, "rocrand_clone_generator");
+
+    if(parent == NULL)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    log_call(parent, "clone", 0);
+
+    if(parent->rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+       && parent->rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+       && parent->rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    // Every clone in the process takes the next block of 2^48
+    // subsequences, so any two clones are disjoint no matter which
+    // generator they were forked from and forks may be nested freely;
+    // an unforked generator occupies block 0
+    static std::atomic<unsigned long long> next_fork_block(1);
+    const unsigned long long block = next_fork_block.fetch_add(1);
+    if(block >= (1ULL << 16))
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+
+    rocrand_generator g      = NULL;
+    rocrand_status    status = rocrand_create_generator(&g, parent->rng_type);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+
+    if(parent->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        status = rocrand_clone_into(static_cast<rocrand_philox4x32_10*>(parent),
+                                    static_cast<rocrand_philox4x32_10*>(g),
+                                    block);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(parent->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        status = rocrand_clone_into(static_cast<rocrand_philox4x32_7*>(parent),
+                                    static_cast<rocrand_philox4x32_7*>(g),
+                                    block);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    else
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        status = rocrand_clone_into(static_cast<rocrand_philox4x64_10*>(parent),
+                                    static_cast<rocrand_philox4x64_10*>(g),
+                                    block);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        rocrand_destroy_generator(g);
+        return status;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    // The distribution-level settings travel with the fork
+    g->math_mode     = parent->math_mode;
+    g->normal_method = parent->normal_method;
+    g->antithetic    = parent->antithetic;
+
+    *child = g;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       generator,
-                                                     unsigned long long int* output_data,
-                                                     size_t                  n)
+rocrand_status ROCRANDAPI rocrand_write_tape(rocrand_generator generator,
+                                             const char *      path,
+                                             size_t            n_bytes)
 {
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_write_tape");
+
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    if(path == NULL || n_bytes == 0 || n_bytes % sizeof(unsigned int) != 0)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+
+    // Generate-and-drain in fixed chunks, so tapes larger than device
+    // memory can be recorded
+    const size_t chunk_bytes  = std::min<size_t>(n_bytes, 16u << 20);
+    const size_t chunk_values = chunk_bytes / sizeof(unsigned int);
+
+    unsigned int* chunk;
+    if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&chunk), chunk_bytes)
+       != hipSuccess)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+
+    std::vector<unsigned int> host_chunk;
+    try
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        host_chunk.resize(chunk_values);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    catch(const std::bad_alloc& e)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        rocrand_host::detail::device_free(chunk);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
-
-rocrand_status ROCRANDAPI rocrand_generate_char(rocrand_generator generator,
-                                                unsigned char*    output_data,
-                                                size_t            n)
-{
-    if(generator == NULL)
+    std::FILE* file = std::fopen(path, "wb");
+    if(file == NULL)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        rocrand_host::detail::device_free(chunk);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    rocrand_host::detail::tape_header header;
+    std::memcpy(header.magic, rocrand_host::detail::tape_magic, sizeof(header.magic));
+    header.version  = ROCRAND_VERSION;
+    header.rng_type = generator->rng_type;
+    header.seed     = rocrand_generator_seed(generator);
+    header.n_bytes  = n_bytes;
+
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    if(std::fwrite(&header, sizeof(header), 1, file) != 1)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+
+    size_t remaining = n_bytes / sizeof(unsigned int);
+    while(status == ROCRAND_STATUS_SUCCESS && remaining > 0)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate(output_data, n);
+        const size_t values = std::min(remaining, chunk_values);
+        status = rocrand_generate(generator, chunk, values);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            break;
+        }
+        // The generation kernel runs on the generator's stream; the
+        // copy must not start draining the chunk before it finishes
+        if(hipStreamSynchronize(rocrand_generator_stream(generator)) != hipSuccess
+           || hipMemcpy(host_chunk.data(), chunk, values * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        if(std::fwrite(host_chunk.data(), sizeof(unsigned int), values, file) != values)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        remaining -= values;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    rocrand_host::detail::device_free(chunk);
+    if(std::fclose(file) != 0 && status == ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        // A partial tape must not be mistaken for a complete one later
+        std::remove(path);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_create_tape_generator(rocrand_generator* generator,
+                                                        const char *       path)
+{
+    if(generator == NULL || path == NULL)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+
+    try
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+        *generator = new rocrand_tape(path);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    catch(const std::bad_alloc& e)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate(output_data, n);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    catch(rocrand_status status)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_destroy_generator(rocrand_generator generator)
+{
+    // Refills in flight in a prefetch cache use the generator; wait for
+    // them and release the cache first
+    const rocrand_status status = rocrand_prefetch_release(generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    try
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate(output_data, n);
+        delete(generator);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    catch(rocrand_status status)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_create_generator_pool(rocrand_generator_pool* pool,
+                                                        rocrand_rng_type        rng_type)
+{
+    if(pool == NULL)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+
+    // Creating the first generator eagerly validates rng_type and warms
+    // the pool for the first acquisition
+    rocrand_generator generator = NULL;
+    const rocrand_status status = rocrand_create_generator(&generator, rng_type);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    try
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        rocrand_generator_pool_st* p = new rocrand_generator_pool_st();
+        // The generator stores the concrete type, so pools created with
+        // a default type recognize their generators on release
+        p->rng_type = generator->rng_type;
+        p->idle.push_back(generator);
+        *pool = p;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    catch(const std::bad_alloc& e)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        rocrand_destroy_generator(generator);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-
-    return ROCRAND_STATUS_TYPE_ERROR;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_short(rocrand_generator generator,
-                                                 unsigned short*   output_data,
-                                                 size_t            n)
+rocrand_status ROCRANDAPI rocrand_destroy_generator_pool(rocrand_generator_pool pool)
 {
-    if(generator == NULL)
+    if(pool == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    for(rocrand_generator generator : pool->idle)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        const rocrand_status s = rocrand_destroy_generator(generator);
+        if(s != ROCRAND_STATUS_SUCCESS)
+        {
+            status = s;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    delete pool;
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_acquire_generator(rocrand_generator_pool pool,
+                                                    rocrand_generator*     generator,
+                                                    unsigned long long     seed)
+{
+    if(pool == NULL)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    if(generator == NULL)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    rocrand_generator g = NULL;
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->idle.empty())
+        {
+            g = pool->idle.back();
+            pool->idle.pop_back();
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(g == NULL)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        const rocrand_status status = rocrand_create_generator(&g, pool->rng_type);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+
+    // Reseeding is the only per-acquisition work on a recycled
+    // generator; types without a seed or an offset (some quasi-random
+    // types) are handed out in their initial state
+    rocrand_status status = rocrand_set_seed(g, seed);
+    if(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_TYPE_ERROR)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+        status = rocrand_set_offset(g, 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_TYPE_ERROR)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate(output_data, n);
+        rocrand_destroy_generator(g);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+
+    *generator = g;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_release_generator(rocrand_generator_pool pool,
+                                                    rocrand_generator      generator)
+{
+    if(pool == NULL || generator == NULL)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(generator->rng_type != pool->rng_type)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    try
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate(output_data, n);
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->idle.push_back(generator);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    catch(const std::bad_alloc& e)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate(output_data, n);
+        // The pool could not take the generator back; destroying it
+        // still leaves the caller's contract intact
+        return rocrand_destroy_generator(generator);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_create_generator_multi_gpu(rocrand_generator_multi_gpu* generator,
+                                                             rocrand_rng_type             rng_type,
+                                                             const int*                   devices,
+                                                             unsigned int                 n_devices)
+{
+    if(generator == NULL || devices == NULL || n_devices == 0)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    // Only a counter-based engine can place every shard at an exact
+    // value position of one logical sequence
+    if(rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    int current_device;
+    if(hipGetDevice(&current_device) != hipSuccess)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+
+    rocrand_generator_multi_gpu_st* g = new(std::nothrow) rocrand_generator_multi_gpu_st();
+    if(g == NULL)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate(output_data, n);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
+    g->offset = 0;
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    try
+    {
+        for(unsigned int k = 0; k < n_devices; k++)
+        {
+            if(hipSetDevice(devices[k]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_OUT_OF_RANGE;
+                break;
+            }
+            hipStream_t stream;
+            if(hipStreamCreate(&stream) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            g->streams.push_back(stream);
+            rocrand_generator child = NULL;
+            status = rocrand_create_generator(&child, rng_type);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                break;
+            }
+            g->generators.push_back(child);
+            status = rocrand_set_stream(child, stream);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                break;
+            }
+            g->devices.push_back(devices[k]);
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        status = ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        for(size_t k = 0; k < g->generators.size(); k++)
+        {
+            (void)rocrand_destroy_generator(g->generators[k]);
+        }
+        for(size_t k = 0; k < g->streams.size(); k++)
+        {
+            (void)hipStreamDestroy(g->streams[k]);
+        }
+        delete g;
+        (void)hipSetDevice(current_device);
+        return status;
+    }
+
+    if(hipSetDevice(current_device) != hipSuccess)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    *generator = g;
+    return status;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_uniform(rocrand_generator generator,
-                                                   float*            output_data,
-                                                   size_t            n)
+rocrand_status ROCRANDAPI rocrand_destroy_generator_multi_gpu(rocrand_generator_multi_gpu generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    int current_device;
+    const bool restore = hipGetDevice(&current_device) == hipSuccess;
+
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    for(size_t k = 0; k < generator->generators.size(); k++)
+    {
+        (void)hipSetDevice(generator->devices[k]);
+        const rocrand_status s = rocrand_destroy_generator(generator->generators[k]);
+        if(s != ROCRAND_STATUS_SUCCESS)
+        {
+            status = s;
+        }
+        if(hipStreamDestroy(generator->streams[k]) != hipSuccess
+           && status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+    if(restore)
+    {
+        (void)hipSetDevice(current_device);
+    }
+    delete generator;
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_seed_multi_gpu(rocrand_generator_multi_gpu generator,
+                                                     unsigned long long          seed)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    for(size_t k = 0; k < generator->generators.size(); k++)
+    {
+        const rocrand_status status = rocrand_set_seed(generator->generators[k], seed);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    generator->offset = 0;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_offset_multi_gpu(rocrand_generator_multi_gpu generator,
+                                                       unsigned long long          offset)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // The per-device generators are positioned at the next fill
+    generator->offset = offset;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_multi_gpu(rocrand_generator_multi_gpu generator,
+                                                     unsigned int* const*        outputs,
+                                                     const size_t*               sizes)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(outputs == NULL || sizes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    const size_t n_devices = generator->generators.size();
+    size_t total = 0;
+    for(size_t k = 0; k < n_devices; k++)
+    {
+        if(outputs[k] == NULL && sizes[k] > 0)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        total += sizes[k];
+    }
+    if(total == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    int current_device;
+    if(hipGetDevice(&current_device) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Every shard is an exact extent of the logical sequence; the
+    // launches land on per-device streams and run concurrently
+    rocrand_status     status = ROCRAND_STATUS_SUCCESS;
+    unsigned long long start  = generator->offset;
+    for(size_t k = 0; k < n_devices; k++)
+    {
+        if(sizes[k] == 0)
+        {
+            continue;
+        }
+        if(hipSetDevice(generator->devices[k]) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        status = rocrand_set_offset(generator->generators[k], start);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            break;
+        }
+        status = rocrand_generate(generator->generators[k], outputs[k], sizes[k]);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            break;
+        }
+        start += sizes[k];
+    }
+
+    // Join all shards before returning so the caller sees one completed
+    // logical fill
+    for(size_t k = 0; k < n_devices; k++)
+    {
+        if(hipStreamSynchronize(generator->streams[k]) != hipSuccess
+           && status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+    (void)hipSetDevice(current_device);
+
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        generator->offset += total;
+    }
+    return status;
+}
+
+// Per-device default generators backing the rocrand_fill_* calls,
+// created lazily and kept for the lifetime of the process. They are
+// deliberately not destroyed at exit: the HIP runtime may be torn down
+// before static destructors run, and the device allocations go away
+// with the process anyway. Philox is used because it keeps no device
+// state, so an idle default generator costs nothing on the device.
+static std::mutex                      default_generator_mutex;
+static std::map<int, rocrand_generator> default_generators;
+
+// Returns the default generator of the current device with its stream
+// bound, creating it on first use. Must be called with
+// default_generator_mutex held; the caller keeps holding it across the
+// generation call so concurrent fills on one device serialize instead
+// of racing on the generator's state
+static rocrand_status default_generator(hipStream_t stream, rocrand_generator* generator)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    rocrand_generator g = NULL;
+    const std::map<int, rocrand_generator>::iterator it = default_generators.find(device);
+    if(it != default_generators.end())
+    {
+        g = it->second;
+    }
+    else
+    {
+        const rocrand_status status
+            = rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        try
+        {
+            default_generators[device] = g;
+        }
+        catch(const std::bad_alloc& e)
+        {
+            rocrand_destroy_generator(g);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    // The stream is a per-call parameter of the fill functions
+    const rocrand_status status = rocrand_set_stream(g, stream);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    *generator = g;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_fill(unsigned int* output_data, size_t n, hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(default_generator_mutex);
+    rocrand_generator generator = NULL;
+    const rocrand_status status = default_generator(stream, &generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_generate(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI rocrand_fill_uniform(float* output_data, size_t n, hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(default_generator_mutex);
+    rocrand_generator generator = NULL;
+    const rocrand_status status = default_generator(stream, &generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_generate_uniform(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI rocrand_fill_uniform_double(double*     output_data,
+                                                      size_t      n,
+                                                      hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(default_generator_mutex);
+    rocrand_generator generator = NULL;
+    const rocrand_status status = default_generator(stream, &generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_generate_uniform_double(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+    rocrand_fill_normal(float* output_data, size_t n, float mean, float stddev, hipStream_t stream)
 {
+    std::lock_guard<std::mutex> lock(default_generator_mutex);
+    rocrand_generator generator = NULL;
+    const rocrand_status status = default_generator(stream, &generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_generate_normal(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_fill_normal_double(
+    double* output_data, size_t n, double mean, double stddev, hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(default_generator_mutex);
+    rocrand_generator generator = NULL;
+    const rocrand_status status = default_generator(stream, &generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_generate_normal_double(generator, output_data, n, mean, stddev);
+}
+
+// Engine name used in call logs, matching the vocabulary of the trace
+// files benchmark_rocrand_trace_replay consumes; types the benchmarks
+// do not name fall back to the profiler range name
+static const char* trace_engine_name(rocrand_rng_type rng_type)
+{
+    switch(rng_type)
+    {
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_10: return "philox";
+        case ROCRAND_RNG_PSEUDO_THREEFRY2_32_20: return "threefry2x32";
+        case ROCRAND_RNG_PSEUDO_THREEFRY2_64_20: return "threefry2x64";
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20: return "threefry4x32";
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_64_20: return "threefry4x64";
+        default: return rocrand_host::detail::rng_type_name(rng_type);
+    }
+}
+
+// Appends one call to the generator's log (see rocrand_set_log); a
+// negative lambda means the call has no lambda column
+static void log_call(rocrand_generator generator,
+                     const char*       distribution,
+                     size_t            size,
+                     double            lambda = -1.0)
+{
+    if(generator == NULL || generator->log == NULL)
+    {
+        return;
+    }
+    if(lambda < 0.0)
+    {
+        fprintf(generator->log,
+                "%s %s %zu 0\n",
+                trace_engine_name(generator->rng_type),
+                distribution,
+                size);
+    }
+    else
+    {
+        fprintf(generator->log,
+                "%s %s %zu 0 %.17g\n",
+                trace_engine_name(generator->rng_type),
+                distribution,
+                size,
+                lambda);
+    }
+}
+
+// Appends a state change as a comment, ignored by the benchmark replay
+// tool but honored by rocrand_replay()
+static void log_state(rocrand_generator generator, const char* what, unsigned long long value)
+{
+    if(generator == NULL || generator->log == NULL)
+    {
+        return;
+    }
+    fprintf(generator->log,
+            "# %s %s %llu\n",
+            trace_engine_name(generator->rng_type),
+            what,
+            value);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate(rocrand_generator generator,
+                                           unsigned int*     output_data,
+                                           size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate");
+    log_call(generator, "uniform-uint", n);
+
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    // A prefetch cache serves calls of the configured size with the
+    // chunk generated ahead on the low-priority stream; see
+    // rocrand_set_prefetch()
+    rocrand_prefetch_st* prefetch = rocrand_prefetch_cache(generator);
+    if(prefetch != NULL && !prefetch->filling)
+    {
+        hipStream_t generator_stream = rocrand_generator_stream(generator);
+        if(n == prefetch->chunk_size)
+        {
+            const unsigned int current = prefetch->current;
+            if(hipStreamWaitEvent(generator_stream, prefetch->ready[current], 0) != hipSuccess
+               || hipMemcpyAsync(output_data,
+                                 prefetch->buffers[current],
+                                 n * sizeof(unsigned int),
+                                 hipMemcpyDeviceToDevice,
+                                 generator_stream)
+                      != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+
+            if(prefetch->handed_out != -1)
+            {
+                const rocrand_status status
+                    = rocrand_prefetch_fill(generator,
+                                            prefetch,
+                                            static_cast<unsigned int>(prefetch->handed_out));
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+                prefetch->handed_out = -1;
+            }
+            // The copy above releases the buffer; generate the chunk
+            // after next into it while the caller's step computes
+            const rocrand_status status = rocrand_prefetch_fill(generator, prefetch, current);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            prefetch->current = current ^ 1;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        // Calls of other sizes continue the sequence after the chunks
+        // generated ahead, once the refill in flight is done with the
+        // engine state
+        if(hipStreamWaitEvent(generator_stream, prefetch->ready[0], 0) != hipSuccess
+           || hipStreamWaitEvent(generator_stream, prefetch->ready[1], 0) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10* philox4x32_10_generator
             = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
         rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_uniform(output_data, n);
+        return mrg31k3p_generator->generate(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
         rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return mrg32k3a_generator->generate(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
         rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return rocrand_sobol32_generator->generate(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
         rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
             = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
             = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        rocrand_tape* rocrand_tape_generator = static_cast<rocrand_tape*>(generator);
+        return rocrand_tape_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_at(rocrand_generator  generator,
+                                              unsigned long long offset,
+                                              unsigned int*      output_data,
+                                              size_t             n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_at");
+    log_call(generator, "uniform-uint-at", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_at(offset,
+                                                                           output_data,
+                                                                           n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_at(offset,
+                                                                          output_data,
+                                                                          n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_at(offset,
+                                                                             output_data,
+                                                                             n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_at(offset,
+                                                                       output_data,
+                                                                       n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_at(offset,
+                                                                             output_data,
+                                                                             n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_at(offset,
+                                                                             output_data,
+                                                                             n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_at(offset,
+                                                                      output_data,
+                                                                      n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_at(offset,
+                                                                             output_data,
+                                                                             n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_at(offset,
+                                                                             output_data,
+                                                                             n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_at(offset,
+                                                                           output_data,
+                                                                           n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_at(offset, output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_seeded(rocrand_generator         generator,
+                                                  unsigned int*             output_data,
+                                                  size_t                    n,
+                                                  const unsigned long long* seeds)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_seeded");
+    log_call(generator, "uniform-uint-seeded", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_seeded(output_data,
+                                                                               n,
+                                                                               seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_seeded(output_data,
+                                                                              n,
+                                                                              seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_seeded(output_data,
+                                                                                 n,
+                                                                                 seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_seeded(output_data,
+                                                                           n,
+                                                                           seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_seeded(output_data,
+                                                                                 n,
+                                                                                 seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_seeded(output_data,
+                                                                                 n,
+                                                                                 seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_seeded(output_data,
+                                                                          n,
+                                                                          seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_seeded(output_data,
+                                                                                 n,
+                                                                                 seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_seeded(output_data,
+                                                                                 n,
+                                                                                 seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_seeded(output_data,
+                                                                               n,
+                                                                               seeds);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_seeded(output_data, n, seeds);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       generator,
+                                                     unsigned long long int* output_data,
+                                                     size_t                  n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_long_long");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        return static_cast<rocrand_tape*>(generator)->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_char(rocrand_generator generator,
+                                                unsigned char*    output_data,
+                                                size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_char");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        rocrand_tape* rocrand_tape_generator = static_cast<rocrand_tape*>(generator);
+        return rocrand_tape_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_short(rocrand_generator generator,
+                                                 unsigned short*   output_data,
+                                                 size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_short");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        rocrand_tape* rocrand_tape_generator = static_cast<rocrand_tape*>(generator);
+        return rocrand_tape_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+    rocrand_generate_bits(rocrand_generator generator, void* output_data, size_t n, unsigned int bit_width)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_bits");
+    log_call(generator, "bits", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(bit_width < 1 || bit_width > 32)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Contiguously packed uniform bit_width-bit symbols are bit_width-bit
+    // slices of a uniform bit stream, so the packed buffer is the byte
+    // stream itself - generated in one pass with the byte-slicing path,
+    // which consumes every engine word fully and stores vectorized
+    const size_t bytes = (n * bit_width + 7) / 8;
+    if(bytes == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return rocrand_generate_char(generator, static_cast<unsigned char*>(output_data), bytes);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform(rocrand_generator generator,
+                                                   float*            output_data,
+                                                   size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform");
+    log_call(generator, "uniform-float", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_partitioned(rocrand_generator  generator,
+                                                               float*             output_data,
+                                                               size_t             n,
+                                                               const hipStream_t* streams,
+                                                               unsigned int       num_streams)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_partitioned");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(streams == NULL || num_streams == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_partitioned(output_data, n, streams, num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_partitioned(output_data, n, streams, num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_partitioned(output_data,
+                                                                n,
+                                                                streams,
+                                                                num_streams);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_batched(rocrand_generator generator,
+                                                           float* const*     buffers,
+                                                           const size_t*     sizes,
+                                                           unsigned int      n_buffers)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_batched");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_uniform_batched(buffers, sizes, n_buffers);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_batch(rocrand_generator    generator,
+                                                 unsigned int* const* buffers,
+                                                 const size_t*        sizes,
+                                                 unsigned int         n_buffers)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_batch");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_batch(buffers, sizes, n_buffers);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return xorwow_generator->generate_batch(buffers, sizes, n_buffers);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_double(rocrand_generator generator,
+                                                          double*           output_data,
+                                                          size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_double");
+    log_call(generator, "uniform-double", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_half(rocrand_generator generator,
+                                                        half*             output_data,
+                                                        size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_half");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_bf16(rocrand_generator generator,
+                                                        hip_bfloat16*     output_data,
+                                                        size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_bf16");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_int_range(
+    rocrand_generator generator, unsigned int* output_data, size_t n,
+    unsigned int lo, unsigned int hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_int_range");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lo >= hi)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_int_range(output_data, n, lo, hi - lo);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_range(
+    rocrand_generator generator, float* output_data, size_t n,
+    float lo, float hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_range");
+    log_call(generator, "uniform-range-float", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_range_double(
+    rocrand_generator generator, double* output_data, size_t n,
+    double lo, double hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_range_double");
+    log_call(generator, "uniform-range-double", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_range_half(
+    rocrand_generator generator, half* output_data, size_t n,
+    half lo, half hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_range_half");
+    log_call(generator, "uniform-range-half", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(__half2float(lo) < __half2float(hi)))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_range(output_data, n, lo, hi);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_int8(
+    rocrand_generator generator, signed char* output_data, size_t n,
+    signed char lo, signed char hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_int8");
+    log_call(generator, "uniform-int8", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lo > hi)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const int start = lo;
+    const unsigned int range = static_cast<unsigned int>(hi - lo) + 1;
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_int8(output_data, n, start, range);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_int4_packed(
+    rocrand_generator generator, unsigned char* output_data, size_t n,
+    signed char lo, signed char hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_int4_packed");
+    log_call(generator, "uniform-int4-packed", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lo > hi || lo < -8 || hi > 7)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const int start = lo;
+    const unsigned int range = static_cast<unsigned int>(hi - lo) + 1;
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_uniform_int4_packed(output_data, n, start, range);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_quasi_replicates(rocrand_generator generator,
+                                                            float*            output_data,
+                                                            size_t            n,
+                                                            unsigned int      n_replicates,
+                                                            const unsigned long long* seeds)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_quasi_replicates");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(output_data == NULL || seeds == NULL || n_replicates < 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_replicates(output_data,
+                                                                   n,
+                                                                   n_replicates,
+                                                                   seeds);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_float_double(rocrand_generator generator,
+                                                                float*  float_output_data,
+                                                                double* double_output_data,
+                                                                size_t  n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_uniform_float_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(float_output_data == NULL || double_output_data == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_uniform_dual(float_output_data,
+                                                                double_output_data,
+                                                                n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal(
+    rocrand_generator generator, float* output_data, size_t n, float mean, float stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_normal");
+    log_call(generator, "normal-float", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_float2(
+    rocrand_generator generator, float* output_data, size_t n_vectors, float mean, float stddev)
+{
+    // The scalar path already stores the two outputs of each Box-Muller
+    // transform next to each other with aligned vector stores, so the
+    // (x, y) layout falls out of the element count; this entry point
+    // moves the count-to-vector bookkeeping behind the API
+    return rocrand_generate_normal(generator, output_data, 2 * n_vectors, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_float4(
+    rocrand_generator generator, float* output_data, size_t n_vectors, float mean, float stddev)
+{
+    // See rocrand_generate_normal_float2; a quadruple is the output of
+    // two transforms
+    return rocrand_generate_normal(generator, output_data, 4 * n_vectors, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_double(
+    rocrand_generator generator, double* output_data, size_t n, double mean, double stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_normal_double");
+    log_call(generator, "normal-double", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_half(
+    rocrand_generator generator, half* output_data, size_t n, half mean, half stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_normal_half");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_bf16(rocrand_generator generator,
+                                                       hip_bfloat16*     output_data,
+                                                       size_t            n,
+                                                       hip_bfloat16      mean,
+                                                       hip_bfloat16      stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_normal_bf16");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_normal(output_data, n, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_log_normal(
+    rocrand_generator generator, float* output_data, size_t n, float mean, float stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_log_normal");
+    log_call(generator, "log-normal-float", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_log_normal_double(
+    rocrand_generator generator, double* output_data, size_t n, double mean, double stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_log_normal_double");
+    log_call(generator, "log-normal-double", n);
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_log_normal_half(
+    rocrand_generator generator, half* output_data, size_t n, half mean, half stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_log_normal_half");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
+                                                                        n,
+                                                                        mean,
+                                                                        stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_log_normal(output_data, n, mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_truncated_normal(rocrand_generator generator,
+                                                             float*            output_data,
+                                                             size_t            n,
+                                                             float             mean,
+                                                             float             stddev,
+                                                             float             lo,
+                                                             float             hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_truncated_normal");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                                                    double*           output_data,
+                                                                    size_t            n,
+                                                                    double            mean,
+                                                                    double            stddev,
+                                                                    double            lo,
+                                                                    double            hi)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_truncated_normal_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_truncated_normal(output_data, n, mean, stddev, lo, hi);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_gamma(
+    rocrand_generator generator, float* output_data, size_t n, float shape, float scale)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_gamma");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0f || scale <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_gamma_double(
+    rocrand_generator generator, double* output_data, size_t n, double shape, double scale)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_gamma_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0 || scale <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_gamma(output_data, n, shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                                                float*            output_data,
+                                                                size_t            n_vectors,
+                                                                unsigned int      dim,
+                                                                const float*      cholesky_factor)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_multivariate_normal");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)
+            ->generate_multivariate_normal(output_data, n_vectors, dim, cholesky_factor);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)
+            ->generate_multivariate_normal(output_data, n_vectors, dim, cholesky_factor);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_dirichlet(rocrand_generator generator,
+                                                     float*            output_data,
+                                                     size_t            n_vectors,
+                                                     unsigned int      k,
+                                                     const float*      alphas)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_dirichlet");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)
+            ->generate_dirichlet(output_data, n_vectors, k, alphas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)
+            ->generate_dirichlet(output_data, n_vectors, k, alphas);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_2d(rocrand_generator generator,
+                                                     float*            output_data,
+                                                     size_t            rows,
+                                                     size_t            cols,
+                                                     size_t            pitch,
+                                                     float             mean,
+                                                     float             stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_normal_2d");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)
+            ->generate_normal_2d(output_data, rows, cols, pitch, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)
+            ->generate_normal_2d(output_data, rows, cols, pitch, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                                            double*           output_data,
+                                                            size_t            rows,
+                                                            size_t            cols,
+                                                            size_t            pitch,
+                                                            double            mean,
+                                                            double            stddev)
+{
+    const rocrand_host::detail::profile_range profile(generator,
+                                                      "rocrand_generate_normal_double_2d");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)
+            ->generate_normal_2d(output_data, rows, cols, pitch, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)
+            ->generate_normal_2d(output_data, rows, cols, pitch, mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            n_paths,
+                                                           unsigned int      n_steps,
+                                                           const float*      times)
+{
+    const rocrand_host::detail::profile_range profile(generator,
+                                                      "rocrand_generate_brownian_bridge");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)
+            ->generate_brownian_bridge(output_data, n_paths, n_steps, times);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)
+            ->generate_brownian_bridge(output_data, n_paths, n_steps, times);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_unit_vector2(
+    rocrand_generator generator, float* output_data, size_t n_vectors)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_unit_vector2");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_unit_vector2(output_data, n_vectors);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_unit_vector3(
+    rocrand_generator generator, float* output_data, size_t n_vectors)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_unit_vector3");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_unit_vector3(output_data, n_vectors);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_unit_vector4(
+    rocrand_generator generator, float* output_data, size_t n_vectors)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_unit_vector4");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_unit_vector4(output_data, n_vectors);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_exponential(
+    rocrand_generator generator, float* output_data, size_t n, float lambda)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_exponential");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_exponential_double(
+    rocrand_generator generator, double* output_data, size_t n, double lambda)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_exponential_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_exponential(output_data, n, lambda);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_cauchy(
+    rocrand_generator generator, float* output_data, size_t n, float median, float sigma)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_cauchy");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(sigma <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_cauchy_double(
+    rocrand_generator generator, double* output_data, size_t n, double median, double sigma)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_cauchy_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(sigma <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_cauchy(output_data, n, median, sigma);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_weibull(
+    rocrand_generator generator, float* output_data, size_t n, float shape, float scale)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_weibull");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0f || scale <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_weibull_double(
+    rocrand_generator generator, double* output_data, size_t n, double shape, double scale)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_weibull_double");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0 || scale <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_weibull(output_data, n, shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_poisson(rocrand_generator generator,
+                                                   unsigned int*     output_data,
+                                                   size_t            n,
+                                                   double            lambda)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_poisson");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    log_call(generator, "poisson", n, lambda);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_poisson(output_data, n, lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_poisson(output_data, n, lambda);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_poisson_array(rocrand_generator generator,
+                                                         unsigned int*     output_data,
+                                                         size_t            n,
+                                                         const double*     lambdas)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_poisson_array");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n, lambdas);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_permutation(rocrand_generator generator,
+                                                       unsigned int*     output_data,
+                                                       size_t            n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_permutation");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_permutation(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_sample_without_replacement(rocrand_generator generator,
+                                                             unsigned int*     output_data,
+                                                             size_t            k,
+                                                             size_t            n,
+                                                             const double*     weights)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->sample_without_replacement(output_data, k, n, weights);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            n_samples,
+                                                           size_t            n_dims)
+{
+    const rocrand_host::detail::profile_range profile(generator,
+                                                      "rocrand_generate_latin_hypercube");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_latin_hypercube(output_data, n_samples, n_dims);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_bernoulli_packed(rocrand_generator generator,
+                                                            unsigned int*     mask_words,
+                                                            size_t            n_bits,
+                                                            float             p)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_bernoulli_packed");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_bernoulli_packed(mask_words, n_bits, p);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_discrete(rocrand_generator             generator,
+                                                    unsigned int*                 output_data,
+                                                    size_t                        n,
+                                                    rocrand_discrete_distribution discrete_distribution)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_discrete");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Only the small distribution header is copied back; the probability,
+    // alias and cdf tables stay in device memory.
+    rocrand_discrete_distribution_st h_dis;
+    hipError_t error = hipMemcpy(&h_dis,
+                                 discrete_distribution,
+                                 sizeof(rocrand_discrete_distribution_st),
+                                 hipMemcpyDefault);
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_10*>(generator);
+        return philox4x32_10_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7* philox4x32_10_generator
+            = static_cast<rocrand_philox4x32_7*>(generator);
+        return philox4x32_10_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
+        return mrg31k3p_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
+        return mrg32k3a_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        rocrand_xoshiro256pp* rocrand_xoshiro256pp_generator = static_cast<rocrand_xoshiro256pp*>(generator);
+        return rocrand_xoshiro256pp_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
+        return rocrand_sobol32_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
+            = static_cast<rocrand_scrambled_sobol32*>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        rocrand_halton* rocrand_halton_generator = static_cast<rocrand_halton*>(generator);
+        return rocrand_halton_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        rocrand_lattice* rocrand_lattice_generator = static_cast<rocrand_lattice*>(generator);
+        return rocrand_lattice_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        rocrand_sobol32_owen* rocrand_sobol32_owen_generator
+            = static_cast<rocrand_sobol32_owen*>(generator);
+        return rocrand_sobol32_owen_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
+        return rocrand_sobol64_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
+            = static_cast<rocrand_scrambled_sobol64*>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
+        return rocrand_mtgp32_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        rocrand_adaptive* rocrand_adaptive_generator = static_cast<rocrand_adaptive*>(generator);
+        return rocrand_adaptive_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
+        return rocrand_lfsr113_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
+        return rocrand_mt19937_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        rocrand_well19937* rocrand_well19937_generator = static_cast<rocrand_well19937*>(generator);
+        return rocrand_well19937_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        rocrand_threefry2x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x32_20*>(generator);
+        return rocrand_threefry_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        rocrand_squares32* rocrand_squares32_generator
+            = static_cast<rocrand_squares32*>(generator);
+        return rocrand_squares32_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry2x64_20*>(generator);
+        return rocrand_threefry_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        rocrand_threefry4x32_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x32_20*>(generator);
+        return rocrand_threefry_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        rocrand_chacha20* rocrand_chacha20_generator
+            = static_cast<rocrand_chacha20*>(generator);
+        return rocrand_chacha20_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_20*>(generator);
+        return rocrand_threefry_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        rocrand_threefry4x64_13* rocrand_threefry_generator
+            = static_cast<rocrand_threefry4x64_13*>(generator);
+        return rocrand_threefry_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10* philox4x64_10_generator
+            = static_cast<rocrand_philox4x64_10*>(generator);
+        return philox4x64_10_generator->generate_discrete(output_data, n, h_dis);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        rocrand_pcg64* rocrand_pcg64_generator
+            = static_cast<rocrand_pcg64*>(generator);
+        return rocrand_pcg64_generator->generate_discrete(output_data, n, h_dis);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_binomial(rocrand_generator generator,
+                                                    unsigned int*     output_data,
+                                                    size_t            n,
+                                                    unsigned int      t,
+                                                    double            probability)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_binomial");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(t == 0 || probability <= 0.0 || probability >= 1.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->generate_binomial(output_data, n, t, probability);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_initialize_generator(rocrand_generator generator)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_initialize_generator");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        return static_cast<rocrand_xoshiro256pp*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        return static_cast<rocrand_adaptive*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        return static_cast<rocrand_lfsr113*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        return static_cast<rocrand_mt19937*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        return static_cast<rocrand_well19937*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        return static_cast<rocrand_threefry2x32_20*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        return static_cast<rocrand_squares32*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
+    {
+        return static_cast<rocrand_tape*>(generator)->init();
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_warmup(rocrand_generator              generator,
+                                         const rocrand_call_descriptor* calls,
+                                         size_t                         n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_warmup");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(calls == NULL && n > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Validate all descriptors and size the scratch buffer up front so
+    // a bad descriptor cannot leave the warm-up half done
+    size_t scratch_bytes = 1;
+    for(size_t i = 0; i < n; i++)
+    {
+        size_t value_bytes;
+        switch(calls[i].kind)
+        {
+            case ROCRAND_CALL_UNIFORM_CHAR: value_bytes = sizeof(unsigned char); break;
+            case ROCRAND_CALL_UNIFORM_SHORT: value_bytes = sizeof(unsigned short); break;
+            case ROCRAND_CALL_UNIFORM_HALF:
+            case ROCRAND_CALL_NORMAL_HALF:
+            case ROCRAND_CALL_LOG_NORMAL_HALF: value_bytes = sizeof(half); break;
+            case ROCRAND_CALL_UNIFORM_BF16:
+            case ROCRAND_CALL_NORMAL_BF16: value_bytes = sizeof(hip_bfloat16); break;
+            case ROCRAND_CALL_UNIFORM_INT:
+            case ROCRAND_CALL_UNIFORM_FLOAT:
+            case ROCRAND_CALL_NORMAL_FLOAT:
+            case ROCRAND_CALL_LOG_NORMAL_FLOAT:
+            case ROCRAND_CALL_EXPONENTIAL_FLOAT:
+            case ROCRAND_CALL_POISSON: value_bytes = sizeof(unsigned int); break;
+            case ROCRAND_CALL_UNIFORM_LONG_LONG:
+            case ROCRAND_CALL_UNIFORM_DOUBLE:
+            case ROCRAND_CALL_NORMAL_DOUBLE:
+            case ROCRAND_CALL_LOG_NORMAL_DOUBLE:
+            case ROCRAND_CALL_EXPONENTIAL_DOUBLE: value_bytes = sizeof(unsigned long long); break;
+            default: return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        if((calls[i].kind == ROCRAND_CALL_POISSON
+            || calls[i].kind == ROCRAND_CALL_EXPONENTIAL_FLOAT
+            || calls[i].kind == ROCRAND_CALL_EXPONENTIAL_DOUBLE)
+           && calls[i].lambda <= 0.0)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        if(calls[i].size * value_bytes > scratch_bytes)
+        {
+            scratch_bytes = calls[i].size * value_bytes;
+        }
+    }
+
+    // A warm-up with no calls still initializes the generator's state
+    if(n == 0)
+    {
+        return rocrand_initialize_generator(generator);
+    }
+
+    void* scratch;
+    if(rocrand_host::detail::device_malloc(&scratch, scratch_bytes) != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+
+    rocrand_status status = ROCRAND_STATUS_SUCCESS;
+    for(size_t i = 0; i < n && status == ROCRAND_STATUS_SUCCESS; i++)
+    {
+        const size_t size = calls[i].size;
+        switch(calls[i].kind)
+        {
+            case ROCRAND_CALL_UNIFORM_INT:
+                status = rocrand_generate(generator, static_cast<unsigned int*>(scratch), size);
+                break;
+            case ROCRAND_CALL_UNIFORM_LONG_LONG:
+                status = rocrand_generate_long_long(generator,
+                                                    static_cast<unsigned long long*>(scratch),
+                                                    size);
+                break;
+            case ROCRAND_CALL_UNIFORM_CHAR:
+                status
+                    = rocrand_generate_char(generator, static_cast<unsigned char*>(scratch), size);
+                break;
+            case ROCRAND_CALL_UNIFORM_SHORT:
+                status = rocrand_generate_short(generator,
+                                                static_cast<unsigned short*>(scratch),
+                                                size);
+                break;
+            case ROCRAND_CALL_UNIFORM_FLOAT:
+                status = rocrand_generate_uniform(generator, static_cast<float*>(scratch), size);
+                break;
+            case ROCRAND_CALL_UNIFORM_DOUBLE:
+                status = rocrand_generate_uniform_double(generator,
+                                                         static_cast<double*>(scratch),
+                                                         size);
+                break;
+            case ROCRAND_CALL_UNIFORM_HALF:
+                status = rocrand_generate_uniform_half(generator, static_cast<half*>(scratch), size);
+                break;
+            case ROCRAND_CALL_UNIFORM_BF16:
+                status = rocrand_generate_uniform_bf16(generator,
+                                                       static_cast<hip_bfloat16*>(scratch),
+                                                       size);
+                break;
+            case ROCRAND_CALL_NORMAL_FLOAT:
+                status = rocrand_generate_normal(generator,
+                                                 static_cast<float*>(scratch),
+                                                 size,
+                                                 0.0f,
+                                                 1.0f);
+                break;
+            case ROCRAND_CALL_NORMAL_DOUBLE:
+                status = rocrand_generate_normal_double(generator,
+                                                        static_cast<double*>(scratch),
+                                                        size,
+                                                        0.0,
+                                                        1.0);
+                break;
+            case ROCRAND_CALL_NORMAL_HALF:
+                status = rocrand_generate_normal_half(generator,
+                                                      static_cast<half*>(scratch),
+                                                      size,
+                                                      __float2half(0.0f),
+                                                      __float2half(1.0f));
+                break;
+            case ROCRAND_CALL_NORMAL_BF16:
+                status = rocrand_generate_normal_bf16(generator,
+                                                      static_cast<hip_bfloat16*>(scratch),
+                                                      size,
+                                                      hip_bfloat16(0.0f),
+                                                      hip_bfloat16(1.0f));
+                break;
+            case ROCRAND_CALL_LOG_NORMAL_FLOAT:
+                status = rocrand_generate_log_normal(generator,
+                                                     static_cast<float*>(scratch),
+                                                     size,
+                                                     0.0f,
+                                                     1.0f);
+                break;
+            case ROCRAND_CALL_LOG_NORMAL_DOUBLE:
+                status = rocrand_generate_log_normal_double(generator,
+                                                            static_cast<double*>(scratch),
+                                                            size,
+                                                            0.0,
+                                                            1.0);
+                break;
+            case ROCRAND_CALL_LOG_NORMAL_HALF:
+                status = rocrand_generate_log_normal_half(generator,
+                                                          static_cast<half*>(scratch),
+                                                          size,
+                                                          __float2half(0.0f),
+                                                          __float2half(1.0f));
+                break;
+            case ROCRAND_CALL_POISSON:
+                status = rocrand_generate_poisson(generator,
+                                                  static_cast<unsigned int*>(scratch),
+                                                  size,
+                                                  calls[i].lambda);
+                break;
+            case ROCRAND_CALL_EXPONENTIAL_FLOAT:
+                status = rocrand_generate_exponential(generator,
+                                                      static_cast<float*>(scratch),
+                                                      size,
+                                                      static_cast<float>(calls[i].lambda));
+                break;
+            case ROCRAND_CALL_EXPONENTIAL_DOUBLE:
+                status = rocrand_generate_exponential_double(generator,
+                                                             static_cast<double*>(scratch),
+                                                             size,
+                                                             calls[i].lambda);
+                break;
+        }
+    }
+
+    // The warm-up kernels must have finished before the scratch buffer
+    // is freed
+    if(hipDeviceSynchronize() != hipSuccess && status == ROCRAND_STATUS_SUCCESS)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    (void)rocrand_host::detail::device_free(scratch);
+
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_benchmark_generator(rocrand_generator generator,
+                                                      size_t size,
+                                                      unsigned int n_trials,
+                                                      double* gbps_out)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_benchmark_generator");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(size == 0 || n_trials == 0 || gbps_out == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const size_t bytes = size * sizeof(unsigned int);
+    void* scratch;
+    if(rocrand_host::detail::device_malloc(&scratch, bytes) != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+
+    hipEvent_t start;
+    hipEvent_t stop;
+    if(hipEventCreate(&start) != hipSuccess)
+    {
+        (void)rocrand_host::detail::device_free(scratch);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    if(hipEventCreate(&stop) != hipSuccess)
+    {
+        (void)hipEventDestroy(start);
+        (void)rocrand_host::detail::device_free(scratch);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // One untimed call covers lazy state initialization and scratch
+    // reallocations inside the generator, so the trials measure the
+    // steady-state generate path
+    rocrand_status status
+        = rocrand_generate(generator, static_cast<unsigned int*>(scratch), size);
+    if(status == ROCRAND_STATUS_SUCCESS && hipDeviceSynchronize() != hipSuccess)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    float ms = 0.0f;
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        // The generator's stream is not reachable here, so the device
+        // is drained before the stop event is recorded; the elapsed
+        // time then covers the trials no matter which stream the
+        // generator launches on
+        if(hipEventRecord(start, 0) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        for(unsigned int trial = 0; trial < n_trials && status == ROCRAND_STATUS_SUCCESS; trial++)
+        {
+            status = rocrand_generate(generator, static_cast<unsigned int*>(scratch), size);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS && hipDeviceSynchronize() != hipSuccess)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS
+           && (hipEventRecord(stop, 0) != hipSuccess || hipEventSynchronize(stop) != hipSuccess
+               || hipEventElapsedTime(&ms, start, stop) != hipSuccess || ms <= 0.0f))
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        *gbps_out = (static_cast<double>(bytes) * n_trials) / (ms * 1e-3) / 1e9;
+    }
+
+    (void)hipEventDestroy(start);
+    (void)hipEventDestroy(stop);
+    (void)rocrand_host::detail::device_free(scratch);
+
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_get_expected_throughput(rocrand_generator generator,
+                                                          rocrand_call_kind kind,
+                                                          size_t size,
+                                                          double* bytes_per_sec)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(size == 0 || bytes_per_sec == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    size_t value_bytes;
+    switch(kind)
+    {
+        case ROCRAND_CALL_UNIFORM_CHAR: value_bytes = sizeof(unsigned char); break;
+        case ROCRAND_CALL_UNIFORM_SHORT: value_bytes = sizeof(unsigned short); break;
+        case ROCRAND_CALL_UNIFORM_HALF:
+        case ROCRAND_CALL_NORMAL_HALF:
+        case ROCRAND_CALL_LOG_NORMAL_HALF: value_bytes = sizeof(half); break;
+        case ROCRAND_CALL_UNIFORM_BF16:
+        case ROCRAND_CALL_NORMAL_BF16: value_bytes = sizeof(hip_bfloat16); break;
+        case ROCRAND_CALL_UNIFORM_INT:
+        case ROCRAND_CALL_UNIFORM_FLOAT:
+        case ROCRAND_CALL_NORMAL_FLOAT:
+        case ROCRAND_CALL_LOG_NORMAL_FLOAT:
+        case ROCRAND_CALL_EXPONENTIAL_FLOAT:
+        case ROCRAND_CALL_POISSON: value_bytes = sizeof(unsigned int); break;
+        case ROCRAND_CALL_UNIFORM_LONG_LONG:
+        case ROCRAND_CALL_UNIFORM_DOUBLE:
+        case ROCRAND_CALL_NORMAL_DOUBLE:
+        case ROCRAND_CALL_LOG_NORMAL_DOUBLE:
+        case ROCRAND_CALL_EXPONENTIAL_DOUBLE: value_bytes = sizeof(unsigned long long); break;
+        default: return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(!generator->throughput_calibrated)
+    {
+        // Fit the two model parameters from a small and a large
+        // in-place measurement: the small one is dominated by the
+        // per-call overhead, the large one by bandwidth. The probe
+        // generator leaves the caller's sequence untouched
+        const size_t small_size = 1 << 14;
+        const size_t large_size = 1 << 22;
+
+        rocrand_generator probe  = NULL;
+        rocrand_status    status = rocrand_create_generator(&probe, generator->rng_type);
+        double            small_gbps = 0.0;
+        double            large_gbps = 0.0;
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_benchmark_generator(probe, small_size, 10, &small_gbps);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_benchmark_generator(probe, large_size, 5, &large_gbps);
+        }
+        if(probe != NULL)
+        {
+            (void)rocrand_destroy_generator(probe);
+        }
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const double small_bytes = static_cast<double>(small_size) * sizeof(unsigned int);
+        const double large_bytes = static_cast<double>(large_size) * sizeof(unsigned int);
+        const double small_s     = small_bytes / (small_gbps * 1e9);
+        const double large_s     = large_bytes / (large_gbps * 1e9);
+        if(large_s > small_s)
+        {
+            const double bandwidth = (large_bytes - small_bytes) / (large_s - small_s);
+            double       overhead  = small_s - small_bytes / bandwidth;
+            if(overhead < 0.0)
+            {
+                overhead = 0.0;
+            }
+            generator->throughput_bandwidth_bps = bandwidth;
+            generator->throughput_overhead_s    = overhead;
+        }
+        else
+        {
+            // The small call was not faster; overhead is not
+            // observable, so the model degrades to a pure roofline
+            generator->throughput_bandwidth_bps = large_bytes / large_s;
+            generator->throughput_overhead_s    = 0.0;
+        }
+        generator->throughput_calibrated = true;
+    }
+
+    const double bytes = static_cast<double>(size) * value_bytes;
+    const double seconds
+        = generator->throughput_overhead_s + bytes / generator->throughput_bandwidth_bps;
+    *bytes_per_sec = bytes / seconds;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_self_test(rocrand_generator generator)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_self_test");
+
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const size_t n = 1 << 16;
+
+    // Two fresh generators with the default seed leave the caller's
+    // generator untouched; both must produce the same block
+    rocrand_generator reference = NULL;
+    rocrand_generator repeat    = NULL;
+    rocrand_status    status    = rocrand_create_generator(&reference, generator->rng_type);
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        status = rocrand_create_generator(&repeat, generator->rng_type);
+    }
+
+    unsigned int*       blocks  = NULL;
+    unsigned long long* digests = NULL;
+    if(status == ROCRAND_STATUS_SUCCESS
+       && rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&blocks),
+                                              2 * n * sizeof(unsigned int))
+              != hipSuccess)
+    {
+        status = ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    if(status == ROCRAND_STATUS_SUCCESS
+       && rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&digests),
+                                              2 * sizeof(unsigned long long))
+              != hipSuccess)
+    {
+        status = ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    if(status == ROCRAND_STATUS_SUCCESS
+       && hipMemset(digests, 0, 2 * sizeof(unsigned long long)) != hipSuccess)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        status = rocrand_generate(reference, blocks, n);
+    }
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        status = rocrand_generate(repeat, blocks + n, n);
+    }
+
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::self_test_digest_kernel),
+                           dim3(256), dim3(256), 0, 0,
+                           blocks, n, &digests[0]);
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_host::detail::self_test_digest_kernel),
+                           dim3(256), dim3(256), 0, 0,
+                           blocks + n, n, &digests[1]);
+        if(hipGetLastError() != hipSuccess)
+        {
+            status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+    }
+
+    unsigned long long device_digests[2] = {0, 1};
+    if(status == ROCRAND_STATUS_SUCCESS
+       && hipMemcpy(device_digests, digests, sizeof(device_digests), hipMemcpyDeviceToHost)
+              != hipSuccess)
+    {
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    // Two identically seeded generators must agree on the device
+    if(status == ROCRAND_STATUS_SUCCESS && device_digests[0] != device_digests[1])
+    {
+        status = ROCRAND_STATUS_SELF_TEST_FAILED;
+    }
+
+    // The host compilation of the digest must agree with the device
+    // one on the transferred block, so a miscompiled digest kernel or
+    // a corrupt transfer cannot go unnoticed
+    if(status == ROCRAND_STATUS_SUCCESS)
+    {
+        try
+        {
+            std::vector<unsigned int> host_block(n);
+            if(hipMemcpy(host_block.data(), blocks, n * sizeof(unsigned int),
+                         hipMemcpyDeviceToHost)
+               != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            else if(rocrand_host::detail::self_test_digest_host(host_block.data(), n)
+                    != device_digests[0])
+            {
+                status = ROCRAND_STATUS_SELF_TEST_FAILED;
+            }
+        }
+        catch(const std::bad_alloc&)
+        {
+            status = ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    // Counter-based engines with a host generation path get a full
+    // cross-backend known-answer check: the device block under the
+    // device-independent ordering must match the block the host
+    // compiler computes from the same engine code
+    if(status == ROCRAND_STATUS_SUCCESS
+       && generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_generator device_generator = NULL;
+        rocrand_generator host_generator   = NULL;
+        status = rocrand_create_generator(&device_generator, generator->rng_type);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_set_ordering(device_generator,
+                                          ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_create_generator_host(&host_generator, generator->rng_type);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = rocrand_generate(device_generator, blocks, n);
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            try
+            {
+                std::vector<unsigned int> expected(n);
+                std::vector<unsigned int> actual(n);
+                status = rocrand_generate(host_generator, expected.data(), n);
+                if(status == ROCRAND_STATUS_SUCCESS
+                   && hipMemcpy(actual.data(), blocks, n * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost)
+                          != hipSuccess)
+                {
+                    status = ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                if(status == ROCRAND_STATUS_SUCCESS && expected != actual)
+                {
+                    status = ROCRAND_STATUS_SELF_TEST_FAILED;
+                }
+            }
+            catch(const std::bad_alloc&)
+            {
+                status = ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+        }
+        if(device_generator != NULL)
+        {
+            (void)rocrand_destroy_generator(device_generator);
+        }
+        if(host_generator != NULL)
+        {
+            (void)rocrand_destroy_generator(host_generator);
+        }
+    }
+
+    // Any in-flight work must have finished before the blocks are freed
+    (void)hipDeviceSynchronize();
+    if(digests != NULL)
+    {
+        (void)rocrand_host::detail::device_free(digests);
+    }
+    if(blocks != NULL)
+    {
+        (void)rocrand_host::detail::device_free(blocks);
+    }
+    if(repeat != NULL)
+    {
+        (void)rocrand_destroy_generator(repeat);
+    }
+    if(reference != NULL)
+    {
+        (void)rocrand_destroy_generator(reference);
+    }
+
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_allocator(rocrand_alloc_func alloc_fn,
+                                                rocrand_free_func  free_fn,
+                                                void*              user_data)
+{
+    if((alloc_fn == NULL) != (free_fn == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_host::detail::device_alloc_hook           = alloc_fn;
+    rocrand_host::detail::device_free_hook            = free_fn;
+    rocrand_host::detail::device_alloc_hook_user_data = user_data;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        static_cast<rocrand_mrg31k3p*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        static_cast<rocrand_xoshiro256pp*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        static_cast<rocrand_sobol32_owen*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        static_cast<rocrand_adaptive*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        static_cast<rocrand_lfsr113*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        static_cast<rocrand_mt19937*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        static_cast<rocrand_well19937*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        static_cast<rocrand_threefry2x32_20*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        static_cast<rocrand_squares32*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        static_cast<rocrand_chacha20*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        static_cast<rocrand_threefry4x64_20*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        static_cast<rocrand_threefry4x64_13*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_pcg64*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_tape*>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_record_event(rocrand_generator generator, hipEvent_t event)
+{
+    if(generator == NULL)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+
+    // The stream runs in order, so the event completes exactly when the
+    // fills enqueued before this call have completed
+    if(hipEventRecord(event, rocrand_generator_stream(generator)) != hipSuccess)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_query(rocrand_generator generator)
+{
+    if(generator == NULL)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    const hipError_t error = hipStreamQuery(rocrand_generator_stream(generator));
+    if(error == hipSuccess)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    if(error == hipErrorNotReady)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_NOT_READY;
     }
-
-    return ROCRAND_STATUS_TYPE_ERROR;
+    return ROCRAND_STATUS_INTERNAL_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_uniform_double(rocrand_generator generator,
-                                                          double*           output_data,
-                                                          size_t            n)
+rocrand_status ROCRANDAPI rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    log_state(generator, "set-seed", seed);
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_philox4x32_10*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_uniform(output_data, n);
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg31k3p*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg32k3a*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_xorwow*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_xoshiro256pp*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mtgp32*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_adaptive*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_lfsr113*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mt19937*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_well19937*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry2x32_20*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_squares32*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry2x64_20*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry4x32_20*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        static_cast<rocrand_chacha20*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry4x64_20*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        static_cast<rocrand_threefry4x64_13*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        static_cast<rocrand_pcg64*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        // The seed selects the random Owen permutation of the point set
+        static_cast<rocrand_sobol32_owen*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_uniform_half(rocrand_generator generator,
-                                                        half*             output_data,
-                                                        size_t            n)
+rocrand_status ROCRANDAPI rocrand_set_seed_uint4(rocrand_generator generator, uint4 seed)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        static_cast<rocrand_lfsr113*>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    log_state(generator, "set-offset", offset);
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_philox4x32_10*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mrg31k3p*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mrg32k3a*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_xorwow*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
+    {
+        static_cast<rocrand_xoshiro256pp*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_sobol32*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_scrambled_sobol32*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        static_cast<rocrand_halton*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        static_cast<rocrand_lattice*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        static_cast<rocrand_sobol32_owen*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_sobol64*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_scrambled_sobol64*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mtgp32*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        static_cast<rocrand_adaptive*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    {
+        // Can't set offset for LFSR113
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        // Can't set offset for MT19937
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        // Can't set offset for WELL19937
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    {
+        static_cast<rocrand_threefry2x32_20*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        static_cast<rocrand_squares32*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_chacha20*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry4x64_20*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_threefry4x64_13*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_philox4x64_10*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_pcg64*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_TAPE)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_tape*>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_normal(
-    rocrand_generator generator, float* output_data, size_t n, float mean, float stddev)
+rocrand_status ROCRANDAPI rocrand_skipahead(rocrand_generator generator, unsigned long long n)
 {
     if(generator == NULL)
     {
@@ -739,1130 +8326,1677 @@ rocrand_status ROCRANDAPI rocrand_generate_normal(
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_10*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_7*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry2x32_20*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_squares32*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry2x64_20*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry4x32_20*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_chacha20*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry4x64_20*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry4x64_13*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x64_10*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_pcg64*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_sobol32*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_scrambled_sobol32*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_halton*>(generator)->skip_ahead(n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_lattice*>(generator)->skip_ahead(n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->skip_ahead(n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64*>(generator)->skip_ahead(n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64*>(generator)->skip_ahead(n);
     }
+
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_normal_double(
-    rocrand_generator generator, double* output_data, size_t n, double mean, double stddev)
+rocrand_status ROCRANDAPI rocrand_partition_sequence(rocrand_generator  generator,
+                                                     unsigned int       rank,
+                                                     unsigned int       n_ranks,
+                                                     unsigned long long draws_per_rank_hint)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(n_ranks == 0 || rank >= n_ranks)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+
+    // Philox counters have native subsequences spaced further apart
+    // than any possible draw count, so each rank gets its own
+    // subsequence and the hint does not matter
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_10*>(generator)->skip_ahead_subsequence(rank);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_7*>(generator)->skip_ahead_subsequence(rank);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x64_10*>(generator)->skip_ahead_subsequence(rank);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    // The remaining generators are positioned by offset: the 2^64-value
+    // offset space is split into equal per-rank slices, and a hint that
+    // does not fit in a slice is rejected because the next rank's
+    // stream would overlap it
+    const unsigned long long stride = ~0ULL / n_ranks;
+    if(draws_per_rank_hint > stride)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    return rocrand_set_offset(generator, stride * rank);
+}
+
+rocrand_status ROCRANDAPI rocrand_set_resident_states(rocrand_generator generator,
+                                                      unsigned int      enabled)
+{
+    if(generator == NULL)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_10*>(generator)->set_resident_states(enabled != 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_concurrent_generation(rocrand_generator generator,
+                                                            unsigned int enabled)
+{
+    if(generator == NULL)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_10*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_philox4x32_7*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry2x32_20*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_squares32*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry2x64_20*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry4x32_20*>(generator)->set_concurrent_generation(
+            enabled != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        return static_cast<rocrand_chacha20*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_threefry4x64_20*>(generator)->set_concurrent_generation(
+            enabled != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        return static_cast<rocrand_threefry4x64_13*>(generator)->set_concurrent_generation(
+            enabled != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10*>(generator)->set_concurrent_generation(
+            enabled != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        return static_cast<rocrand_pcg64*>(generator)->set_concurrent_generation(
+            enabled != 0);
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_normal_half(
-    rocrand_generator generator, half* output_data, size_t n, half mean, half stddev)
+rocrand_status ROCRANDAPI rocrand_get_workspace_size(rocrand_generator generator, size_t * size)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(size == NULL)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_mrg31k3p*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_mrg32k3a*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
-    {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
-    {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_xorwow*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_xoshiro256pp*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_mtgp32*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_adaptive*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_lfsr113*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
-    {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
-    {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
-    {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_mt19937*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_well19937*>(generator)->get_workspace_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_log_normal(
-    rocrand_generator generator, float* output_data, size_t n, float mean, float stddev)
+rocrand_status ROCRANDAPI
+rocrand_set_workspace(rocrand_generator generator, void * workspace, size_t size)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_mrg31k3p*>(generator)->set_workspace(workspace, size);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_mrg32k3a*>(generator)->set_workspace(workspace, size);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_xorwow*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_xoshiro256pp*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        return static_cast<rocrand_mtgp32*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_adaptive*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        return static_cast<rocrand_lfsr113*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_mt19937*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+        return static_cast<rocrand_well19937*>(generator)->set_workspace(workspace, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_get_state_size(rocrand_generator generator, size_t * size)
+{
+    if(generator == NULL)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    if(size == NULL)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        *size = static_cast<rocrand_mt19937*>(generator)->get_state_size();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state, size_t size)
+{
+    if(generator == NULL)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    if(state == NULL)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        rocrand_mt19937 * mt19937 = static_cast<rocrand_mt19937*>(generator);
+        if(size < mt19937->get_state_size())
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        return mt19937->save_state(state);
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_log_normal_double(
-    rocrand_generator generator, double* output_data, size_t n, double mean, double stddev)
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state, size_t size)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+        rocrand_mt19937 * mt19937 = static_cast<rocrand_mt19937*>(generator);
+        if(size < mt19937->get_state_size())
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        return mt19937->load_state(state);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_get_memory_info(rocrand_generator generator,
+                                                  size_t * state_bytes,
+                                                  size_t * reclaimable_bytes)
+{
+    if(generator == NULL)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_philox4x32_10*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_philox4x32_7*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_mrg31k3p*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_mrg31k3p*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_mrg32k3a*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_mrg32k3a*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_xorwow*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_xorwow*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_xoshiro256pp*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_xoshiro256pp*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_mtgp32*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_mtgp32*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_adaptive*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_adaptive*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_lfsr113*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_lfsr113*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_mt19937*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_mt19937*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = static_cast<rocrand_well19937*>(generator)->get_workspace_size();
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_well19937*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_threefry2x32_20*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_squares32*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_threefry2x64_20*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_threefry4x32_20*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_chacha20*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_threefry4x64_20*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_threefry4x64_13*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_philox4x64_10*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        if(state_bytes != NULL)
+        {
+            *state_bytes = 0;
+        }
+        if(reclaimable_bytes != NULL)
+        {
+            *reclaimable_bytes = static_cast<rocrand_pcg64*>(generator)->get_reclaimable_memory_size();
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_log_normal_half(
-    rocrand_generator generator, half* output_data, size_t n, half mean, half stddev)
+rocrand_status ROCRANDAPI rocrand_trim(rocrand_generator generator)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_philox4x32_10*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_mrg31k3p*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_mrg32k3a*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_xorwow*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_xoshiro256pp*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        static_cast<rocrand_mtgp32*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_adaptive*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data,
-                                                                        n,
-                                                                        mean,
-                                                                        stddev);
+        static_cast<rocrand_lfsr113*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_mt19937*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_well19937*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_threefry2x32_20*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_squares32*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_threefry2x64_20*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_threefry4x32_20*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
+    {
+        static_cast<rocrand_chacha20*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_log_normal(output_data, n, mean, stddev);
+        static_cast<rocrand_threefry4x64_20*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
+    {
+        static_cast<rocrand_threefry4x64_13*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
     }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
+    {
+        static_cast<rocrand_pcg64*>(generator)->trim();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_generate_poisson(rocrand_generator generator,
-                                                   unsigned int*     output_data,
-                                                   size_t            n,
-                                                   double            lambda)
+rocrand_status ROCRANDAPI rocrand_stream_open(rocrand_stream * stream,
+                                              rocrand_generator generator,
+                                              unsigned int * host_sink,
+                                              size_t chunk_size)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if(lambda <= 0.0)
+    if(stream == NULL || host_sink == NULL || chunk_size == 0)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        rocrand_philox4x32_10* philox4x32_10_generator
-            = static_cast<rocrand_philox4x32_10*>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n, lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
-    {
-        rocrand_mrg31k3p* mrg31k3p_generator = static_cast<rocrand_mrg31k3p*>(generator);
-        return mrg31k3p_generator->generate_poisson(output_data, n, lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        rocrand_mrg32k3a* mrg32k3a_generator = static_cast<rocrand_mrg32k3a*>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n, lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    rocrand_stream_st* s = new(std::nothrow) rocrand_stream_st();
+    if(s == NULL)
     {
-        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    s->generator       = generator;
+    s->generate_stream = rocrand_generator_stream(generator);
+    s->sink            = host_sink;
+    s->chunk_size      = chunk_size;
+
+    if(hipStreamCreate(&s->copy_stream) != hipSuccess)
     {
-        rocrand_sobol32* rocrand_sobol32_generator = static_cast<rocrand_sobol32*>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n, lambda);
+        rocrand_stream_free(s);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    for(int i = 0; i < 2; i++)
     {
-        rocrand_scrambled_sobol32* rocrand_scrambled_sobol32_generator
-            = static_cast<rocrand_scrambled_sobol32*>(generator);
-        return rocrand_scrambled_sobol32_generator->generate_poisson(output_data, n, lambda);
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&s->buffers[i]),
+                     chunk_size * sizeof(unsigned int))
+           != hipSuccess)
+        {
+            rocrand_stream_free(s);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipEventCreateWithFlags(&s->generated[i], hipEventDisableTiming) != hipSuccess
+           || hipEventCreateWithFlags(&s->copied[i], hipEventDisableTiming) != hipSuccess)
+        {
+            rocrand_stream_free(s);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+
+    // Fill both buffers up front so the first read only waits for the
+    // first chunk while the second is already generating
+    for(int i = 0; i < 2; i++)
     {
-        rocrand_sobol64* rocrand_sobol64_generator = static_cast<rocrand_sobol64*>(generator);
-        return rocrand_sobol64_generator->generate_poisson(output_data, n, lambda);
+        const rocrand_status status = rocrand_generate(generator, s->buffers[i], chunk_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            rocrand_stream_free(s);
+            return status;
+        }
+        if(hipEventRecord(s->generated[i], s->generate_stream) != hipSuccess)
+        {
+            rocrand_stream_free(s);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+
+    s->current = 0;
+    *stream    = s;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_stream_read(rocrand_stream stream)
+{
+    if(stream == NULL)
     {
-        rocrand_scrambled_sobol64* rocrand_scrambled_sobol64_generator
-            = static_cast<rocrand_scrambled_sobol64*>(generator);
-        return rocrand_scrambled_sobol64_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    const unsigned int current = stream->current;
+
+    // Copy the oldest generated chunk to the sink on the copy stream;
+    // the chunk pending in the other buffer keeps generating meanwhile
+    if(hipStreamWaitEvent(stream->copy_stream, stream->generated[current], 0) != hipSuccess
+       || hipMemcpyAsync(stream->sink,
+                         stream->buffers[current],
+                         stream->chunk_size * sizeof(unsigned int),
+                         hipMemcpyDeviceToHost,
+                         stream->copy_stream)
+              != hipSuccess
+       || hipEventRecord(stream->copied[current], stream->copy_stream) != hipSuccess)
     {
-        rocrand_mtgp32* rocrand_mtgp32_generator = static_cast<rocrand_mtgp32*>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    // Refill the buffer once its copy is out; the generation overlaps
+    // with the caller consuming the sink
+    if(hipStreamWaitEvent(stream->generate_stream, stream->copied[current], 0) != hipSuccess)
     {
-        rocrand_lfsr113* rocrand_lfsr113_generator = static_cast<rocrand_lfsr113*>(generator);
-        return rocrand_lfsr113_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    const rocrand_status status
+        = rocrand_generate(stream->generator, stream->buffers[current], stream->chunk_size);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mt19937* rocrand_mt19937_generator = static_cast<rocrand_mt19937*>(generator);
-        return rocrand_mt19937_generator->generate_poisson(output_data, n, lambda);
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    if(hipEventRecord(stream->generated[current], stream->generate_stream) != hipSuccess)
     {
-        rocrand_threefry2x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x32_20*>(generator);
-        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+
+    // The sink holds the chunk once the copy completes
+    if(hipEventSynchronize(stream->copied[current]) != hipSuccess)
     {
-        rocrand_threefry2x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry2x64_20*>(generator);
-        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    stream->current = current ^ 1;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_stream_close(rocrand_stream stream)
+{
+    if(stream == NULL)
     {
-        rocrand_threefry4x32_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x32_20*>(generator);
-        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+
+    // Chunks generated ahead may still be in flight; finish them before
+    // releasing the buffers they target
+    if(hipStreamSynchronize(stream->generate_stream) != hipSuccess
+       || hipStreamSynchronize(stream->copy_stream) != hipSuccess)
     {
-        rocrand_threefry4x64_20* rocrand_threefry_generator
-            = static_cast<rocrand_threefry4x64_20*>(generator);
-        return rocrand_threefry_generator->generate_poisson(output_data, n, lambda);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    rocrand_stream_free(stream);
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_initialize_generator(rocrand_generator generator)
+rocrand_status ROCRANDAPI rocrand_set_prefetch(rocrand_generator generator, size_t n)
 {
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_set_prefetch");
+    log_call(generator, "set-prefetch", n);
+
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        return static_cast<rocrand_philox4x32_10*>(generator)->init();
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
-    {
-        return static_cast<rocrand_mrg31k3p*>(generator)->init();
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        return static_cast<rocrand_mrg32k3a*>(generator)->init();
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    // Disabling or changing the chunk size starts from a clean cache
+    rocrand_status status = rocrand_prefetch_release(generator);
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        return static_cast<rocrand_xorwow*>(generator)->init();
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(n == 0)
     {
-        return static_cast<rocrand_sobol32*>(generator)->init();
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+
+    rocrand_prefetch_st* prefetch = new(std::nothrow) rocrand_prefetch_st();
+    if(prefetch == NULL)
     {
-        return static_cast<rocrand_scrambled_sobol32*>(generator)->init();
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
-    {
-        return static_cast<rocrand_sobol64*>(generator)->init();
+    prefetch->chunk_size = n;
+    prefetch->current    = 0;
+    prefetch->handed_out = -1;
+
+    // The refills run at the lowest priority, so they only occupy the
+    // device when the caller's own kernels leave it idle
+    int least_priority    = 0;
+    int greatest_priority = 0;
+    if(hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority) != hipSuccess
+       || hipStreamCreateWithPriority(&prefetch->prefetch_stream, hipStreamDefault, least_priority)
+              != hipSuccess)
+    {
+        rocrand_prefetch_free(prefetch);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    for(int i = 0; i < 2; i++)
     {
-        return static_cast<rocrand_scrambled_sobol64*>(generator)->init();
+        if(rocrand_host::detail::device_malloc(reinterpret_cast<void**>(&prefetch->buffers[i]),
+                                               n * sizeof(unsigned int))
+           != hipSuccess)
+        {
+            rocrand_prefetch_free(prefetch);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipEventCreateWithFlags(&prefetch->ready[i], hipEventDisableTiming) != hipSuccess
+           || hipEventCreateWithFlags(&prefetch->released[i], hipEventDisableTiming) != hipSuccess)
+        {
+            rocrand_prefetch_free(prefetch);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+
+    // Generate both chunks ahead so the first two matching calls are
+    // already covered
+    for(unsigned int i = 0; i < 2; i++)
     {
-        return static_cast<rocrand_mtgp32*>(generator)->init();
+        status = rocrand_prefetch_fill(generator, prefetch, i);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            hipStreamSynchronize(prefetch->prefetch_stream);
+            rocrand_prefetch_free(prefetch);
+            return status;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    try
     {
-        return static_cast<rocrand_lfsr113*>(generator)->init();
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        prefetch_caches[generator] = prefetch;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    catch(const std::bad_alloc& e)
     {
-        return static_cast<rocrand_mt19937*>(generator)->init();
+        hipStreamSynchronize(prefetch->prefetch_stream);
+        rocrand_prefetch_free(prefetch);
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_acquire_buffer(rocrand_generator generator,
+                                                 unsigned int ** output_data)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_acquire_buffer");
+
+    if(generator == NULL)
     {
-        return static_cast<rocrand_threefry2x32_20*>(generator)->init();
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    if(output_data == NULL)
     {
-        return static_cast<rocrand_threefry2x64_20*>(generator)->init();
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    rocrand_prefetch_st* prefetch = rocrand_prefetch_cache(generator);
+    if(prefetch == NULL)
     {
-        return static_cast<rocrand_threefry4x32_20*>(generator)->init();
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    log_call(generator, "acquire-buffer", prefetch->chunk_size);
+
+    hipStream_t generator_stream = rocrand_generator_stream(generator);
+    const unsigned int current = prefetch->current;
+    if(hipStreamWaitEvent(generator_stream, prefetch->ready[current], 0) != hipSuccess)
     {
-        return static_cast<rocrand_threefry4x64_20*>(generator)->init();
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    // The buffer lent out by the previous acquisition is free again
+    // once the reads enqueued since then have drained
+    if(prefetch->handed_out != -1)
+    {
+        const rocrand_status status
+            = rocrand_prefetch_fill(generator,
+                                    prefetch,
+                                    static_cast<unsigned int>(prefetch->handed_out));
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    *output_data         = prefetch->buffers[current];
+    prefetch->handed_out = static_cast<int>(current);
+    prefetch->current    = current ^ 1;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT && order != ROCRAND_ORDERING_PSEUDO_LEGACY
+       && order != ROCRAND_ORDERING_PSEUDO_DYNAMIC && order != ROCRAND_ORDERING_PSEUDO_FASTEST
+       && order != ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT
+       && order != ROCRAND_ORDERING_QUASI_DEFAULT)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const bool pseudo_type = order != ROCRAND_ORDERING_QUASI_DEFAULT;
+    // Only the counter-based generators can fix the mapping from output
+    // index to sequence position at no cost
+    const bool counter_based_order = order == ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT;
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        static_cast<rocrand_philox4x32_10*>(generator)->set_stream(stream);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_philox4x32_10*>(generator)->set_order(order);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_philox4x32_7*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
     {
-        static_cast<rocrand_mrg31k3p*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_mrg31k3p*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        static_cast<rocrand_mrg32k3a*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_mrg32k3a*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_xorwow*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_xorwow*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO256PP)
     {
-        static_cast<rocrand_sobol32*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_xoshiro256pp*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        static_cast<rocrand_scrambled_sobol32*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_mt19937*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_WELL19937)
     {
-        static_cast<rocrand_sobol64*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_well19937*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        static_cast<rocrand_scrambled_sobol64*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_sobol32*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        static_cast<rocrand_mtgp32*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_scrambled_sobol32*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
     {
-        static_cast<rocrand_lfsr113*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_halton*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
     {
-        static_cast<rocrand_mt19937*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_lattice*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
     {
-        static_cast<rocrand_threefry2x32_20*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_sobol32_owen*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        static_cast<rocrand_threefry2x64_20*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_sobol64*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        static_cast<rocrand_threefry4x32_20*>(generator)->set_stream(stream);
+        if(pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_scrambled_sobol64*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        static_cast<rocrand_threefry4x64_20*>(generator)->set_stream(stream);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_mtgp32*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
-
-rocrand_status ROCRANDAPI rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
-{
-    if(generator == NULL)
-    {
-        return ROCRAND_STATUS_NOT_CREATED;
-    }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_ADAPTIVE)
     {
-        static_cast<rocrand_philox4x32_10*>(generator)->set_seed(seed);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_adaptive*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
     {
-        if(seed == 0ULL)
-        {
-            seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
-        }
-        static_cast<rocrand_mrg31k3p*>(generator)->set_seed(seed);
+        if(!pseudo_type || counter_based_order)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_lfsr113*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
     {
-        if(seed == 0ULL)
-        {
-            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
-        static_cast<rocrand_mrg32k3a*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_threefry2x32_20*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_SQUARES32)
     {
-        static_cast<rocrand_xorwow*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_squares32*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
     {
-        static_cast<rocrand_mtgp32*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_threefry2x64_20*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        static_cast<rocrand_lfsr113*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_threefry4x32_20*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_CHACHA20)
     {
-        static_cast<rocrand_mt19937*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_chacha20*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
     {
-        static_cast<rocrand_threefry2x32_20*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_threefry4x64_20*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13)
     {
-        static_cast<rocrand_threefry2x64_20*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_threefry4x64_13*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        static_cast<rocrand_threefry4x32_20*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_philox4x64_10*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG64)
     {
-        static_cast<rocrand_threefry4x64_20*>(generator)->set_seed(seed);
+        if(!pseudo_type)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        static_cast<rocrand_pcg64*>(generator)->set_order(order);
         return ROCRAND_STATUS_SUCCESS;
     }
 
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI rocrand_set_seed_uint4(rocrand_generator generator, uint4 seed)
+rocrand_status ROCRANDAPI rocrand_set_math_mode(rocrand_generator  generator,
+                                                rocrand_math_mode mode)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    if(mode != ROCRAND_MATH_PRECISE && mode != ROCRAND_MATH_FAST)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    generator->math_mode = mode;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_normal_method(rocrand_generator     generator,
+                                                    rocrand_normal_method method)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_lfsr113*>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(method != ROCRAND_NORMAL_METHOD_BOX_MULLER && method != ROCRAND_NORMAL_METHOD_ZIGGURAT
+       && method != ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR
+       && method != ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    generator->normal_method = method;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+rocrand_status ROCRANDAPI rocrand_set_antithetic(rocrand_generator generator,
+                                                 unsigned int      enabled)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    // Quasi-random dimension assignment requires one value per engine
+    // output, and the MRG engines emit raw values in [1, m1) for which
+    // the bit complement is not a valid engine output, so the coupling
+    // is limited to the remaining pseudo-random generators
+    if(generator->rng_type >= ROCRAND_RNG_QUASI_DEFAULT
+       || generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P
+       || generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    generator->antithetic = enabled != 0;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_error_mode(rocrand_generator  generator,
+                                                 rocrand_error_mode mode)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_philox4x32_10*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    if(mode != ROCRAND_ERRORS_IMMEDIATE && mode != ROCRAND_ERRORS_DEFERRED)
     {
-        static_cast<rocrand_mrg31k3p*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    generator->error_mode = mode;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_query_status(rocrand_generator generator)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_query_status");
+
+    if(generator == NULL)
     {
-        static_cast<rocrand_mrg32k3a*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    log_call(generator, "query-status", 0);
+
+    if(hipStreamSynchronize(rocrand_generator_stream(generator)) != hipSuccess)
     {
-        static_cast<rocrand_xorwow*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        (void)hipGetLastError();
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(hipGetLastError() != hipSuccess)
     {
-        static_cast<rocrand_sobol32*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_persistent_mode(rocrand_generator generator,
+                                                      unsigned int      enabled)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_scrambled_sobol32*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_sobol64*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->set_persistent_mode(enabled != 0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_persistent_fence(rocrand_generator generator)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_scrambled_sobol64*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        // Can't set offset for MTGP32
-        return ROCRAND_STATUS_TYPE_ERROR;
+        rocrand_xorwow* rocrand_xorwow_generator = static_cast<rocrand_xorwow*>(generator);
+        return rocrand_xorwow_generator->persistent_fence();
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_statistics_enabled(rocrand_generator generator,
+                                                         unsigned int enabled)
+{
+    if(generator == NULL)
     {
-        // Can't set offset for LFSR113
-        return ROCRAND_STATUS_TYPE_ERROR;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+
+    generator->statistics.set_enabled(enabled != 0);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_get_statistics(rocrand_generator generator,
+                                                 rocrand_stats * stats)
+{
+    if(generator == NULL)
     {
-        // Can't set offset for MT19937
-        return ROCRAND_STATUS_TYPE_ERROR;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    if(stats == NULL)
     {
-        static_cast<rocrand_threefry2x32_20*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+
+    generator->statistics.get(stats);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_set_profiling(rocrand_generator generator,
+                                                unsigned int enabled)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_threefry2x64_20*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    generator->profiling = enabled != 0;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI rocrand_dump_latency_histogram(rocrand_generator generator, FILE* out)
+{
+    if(generator == NULL)
     {
-        static_cast<rocrand_threefry4x32_20*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    if(out == NULL)
     {
-        static_cast<rocrand_threefry4x64_20*>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    return ROCRAND_STATUS_TYPE_ERROR;
+    generator->statistics.dump_latency_histogram(out);
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order)
+rocrand_status ROCRANDAPI rocrand_set_log(rocrand_generator generator, const char* path)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(order != ROCRAND_ORDERING_PSEUDO_DEFAULT && order != ROCRAND_ORDERING_PSEUDO_LEGACY
-       && order != ROCRAND_ORDERING_QUASI_DEFAULT)
+    if(generator->log != NULL)
     {
-        return ROCRAND_STATUS_OUT_OF_RANGE;
+        fclose(generator->log);
+        generator->log = NULL;
+    }
+    if(path == NULL)
+    {
+        return ROCRAND_STATUS_SUCCESS;
     }
 
-    const bool pseudo_type = order != ROCRAND_ORDERING_QUASI_DEFAULT;
+    generator->log = fopen(path, "w");
+    if(generator->log == NULL)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    fprintf(generator->log, "# rocrand call log\n");
+    return ROCRAND_STATUS_SUCCESS;
+}
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+// Engine vocabulary accepted by rocrand_replay(): the names written by
+// the call logs and used by the benchmark trace files
+static bool replay_engine_type(const std::string& engine, rocrand_rng_type* rng_type)
+{
+    static const struct
+    {
+        const char*      name;
+        rocrand_rng_type type;
+    } engines[] = {
+        {"xorwow", ROCRAND_RNG_PSEUDO_XORWOW},
+        {"mrg31k3p", ROCRAND_RNG_PSEUDO_MRG31K3P},
+        {"mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A},
+        {"mtgp32", ROCRAND_RNG_PSEUDO_MTGP32},
+        {"philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10},
+        {"philox4x32_10", ROCRAND_RNG_PSEUDO_PHILOX4_32_10},
+        {"philox4x32_7", ROCRAND_RNG_PSEUDO_PHILOX4_32_7},
+        {"philox4x64_10", ROCRAND_RNG_PSEUDO_PHILOX4_64_10},
+        {"threefry2x32", ROCRAND_RNG_PSEUDO_THREEFRY2_32_20},
+        {"threefry2x64", ROCRAND_RNG_PSEUDO_THREEFRY2_64_20},
+        {"threefry4x32", ROCRAND_RNG_PSEUDO_THREEFRY4_32_20},
+        {"threefry4x64", ROCRAND_RNG_PSEUDO_THREEFRY4_64_20},
+        {"threefry4x64_13", ROCRAND_RNG_PSEUDO_THREEFRY4_64_13},
+        {"lfsr113", ROCRAND_RNG_PSEUDO_LFSR113},
+        {"mt19937", ROCRAND_RNG_PSEUDO_MT19937},
+        {"pcg64", ROCRAND_RNG_PSEUDO_PCG64},
+        {"xoshiro256pp", ROCRAND_RNG_PSEUDO_XOSHIRO256PP},
+        {"chacha20", ROCRAND_RNG_PSEUDO_CHACHA20},
+        {"squares32", ROCRAND_RNG_PSEUDO_SQUARES32},
+        {"well19937", ROCRAND_RNG_PSEUDO_WELL19937},
+        {"adaptive", ROCRAND_RNG_PSEUDO_ADAPTIVE},
+        {"sobol32", ROCRAND_RNG_QUASI_SOBOL32},
+        {"scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32},
+        {"sobol32_owen", ROCRAND_RNG_QUASI_SOBOL32_OWEN},
+        {"sobol64", ROCRAND_RNG_QUASI_SOBOL64},
+        {"scrambled_sobol64", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64},
+        {"halton", ROCRAND_RNG_QUASI_HALTON},
+        {"lattice", ROCRAND_RNG_QUASI_LATTICE},
+    };
+    for(const auto& e : engines)
+    {
+        if(engine == e.name)
+        {
+            *rng_type = e.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+static rocrand_status replay_one_call(rocrand_generator  generator,
+                                      const std::string& distribution,
+                                      size_t             size,
+                                      double             lambda,
+                                      void*              data)
+{
+    if(distribution == "uniform-uint")
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_philox4x32_10*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate(generator, static_cast<unsigned int*>(data), size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    else if(distribution == "uniform-float")
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_mrg31k3p*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_uniform(generator, static_cast<float*>(data), size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(distribution == "uniform-double")
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_mrg32k3a*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_uniform_double(generator, static_cast<double*>(data), size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(distribution == "normal-float")
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_xorwow*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_normal(generator, static_cast<float*>(data), size, 0.0f, 1.0f);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    else if(distribution == "normal-double")
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_mt19937*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_normal_double(generator, static_cast<double*>(data), size, 0.0, 1.0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(distribution == "log-normal-float")
     {
-        if(pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_sobol32*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_log_normal(generator, static_cast<float*>(data), size, 0.0f, 1.0f);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    else if(distribution == "log-normal-double")
     {
-        if(pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_scrambled_sobol32*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_log_normal_double(generator,
+                                                  static_cast<double*>(data),
+                                                  size,
+                                                  0.0,
+                                                  1.0);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    else if(distribution == "poisson")
     {
-        if(pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_sobol64*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return rocrand_generate_poisson(generator, static_cast<unsigned int*>(data), size, lambda);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    return ROCRAND_STATUS_OUT_OF_RANGE;
+}
+
+rocrand_status ROCRANDAPI rocrand_replay(const char* path)
+{
+    if(path == NULL)
     {
-        if(pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_scrambled_sobol64*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    std::ifstream file(path);
+    if(!file)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_mtgp32*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_LFSR113)
+
+    rocrand_status                           status = ROCRAND_STATUS_SUCCESS;
+    std::map<std::string, rocrand_generator> generators;
+    void*                                    data     = NULL;
+    size_t                                   capacity = 0;
+
+    std::string line;
+    while(status == ROCRAND_STATUS_SUCCESS && std::getline(file, line))
+    {
+        // State changes are logged as comments so the benchmark replay
+        // tool keeps ignoring them; any other comment is noise
+        const size_t       comment = line.find('#');
+        std::string        engine;
+        std::string        what;
+        unsigned long long value    = 0;
+        bool               is_state = false;
+        if(comment != std::string::npos)
+        {
+            std::istringstream c(line.substr(comment + 1));
+            is_state = static_cast<bool>(c >> engine >> what >> value)
+                       && (what == "set-seed" || what == "set-offset");
+            line = line.substr(0, comment);
+        }
+
+        std::string distribution;
+        size_t      size   = 0;
+        size_t      stream = 0;
+        double      lambda = 10.0;
+        if(!is_state)
+        {
+            std::istringstream s(line);
+            if(!(s >> engine))
+            {
+                continue; // blank line or plain comment
+            }
+            if(!(s >> distribution >> size >> stream))
+            {
+                status = ROCRAND_STATUS_OUT_OF_RANGE;
+                break;
+            }
+            s >> lambda;
+        }
+
+        rocrand_rng_type rng_type;
+        if(!replay_engine_type(engine, &rng_type))
+        {
+            status = ROCRAND_STATUS_OUT_OF_RANGE;
+            break;
+        }
+        // Calls to the same engine share one generator like the
+        // recording run did
+        rocrand_generator& generator = generators[engine];
+        if(generator == NULL)
+        {
+            status = rocrand_create_generator(&generator, rng_type);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        if(is_state)
+        {
+            status = what == "set-seed" ? rocrand_set_seed(generator, value)
+                                        : rocrand_set_offset(generator, value);
+            continue;
+        }
+
+        const size_t bytes = size * sizeof(double);
+        if(bytes > capacity)
+        {
+            if(data != NULL)
+            {
+                (void)hipDeviceSynchronize();
+                (void)rocrand_host::detail::device_free(data);
+                data = NULL;
+            }
+            if(rocrand_host::detail::device_malloc(&data, bytes) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_ALLOCATION_FAILED;
+                break;
+            }
+            capacity = bytes;
+        }
+
+        status = replay_one_call(generator, distribution, size, lambda, data);
+    }
+
+    (void)hipDeviceSynchronize();
+    if(data != NULL)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_lfsr113*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        (void)rocrand_host::detail::device_free(data);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20)
+    for(auto& entry : generators)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_threefry2x32_20*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        if(entry.second != NULL)
+        {
+            (void)rocrand_destroy_generator(entry.second);
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    return status;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_multi(rocrand_generator generator,
+                                                 const rocrand_multi_descriptor * fills,
+                                                 unsigned int n_fills,
+                                                 size_t n)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_multi");
+
+    if(generator == NULL)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_threefry2x64_20*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_threefry4x32_20*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        rocrand_xorwow * xorwow_generator = static_cast<rocrand_xorwow *>(generator);
+        return xorwow_generator->generate_multi(fills, n_fills, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_statistics(rocrand_generator generator,
+                                                      size_t n,
+                                                      rocrand_moments * moments)
+{
+    const rocrand_host::detail::profile_range profile(generator, "rocrand_generate_statistics");
+
+    if(generator == NULL)
     {
-        if(!pseudo_type)
-            return ROCRAND_STATUS_OUT_OF_RANGE;
-        static_cast<rocrand_threefry4x64_20*>(generator)->set_order(order);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox_generator->generate_statistics(n, moments);
+    }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
@@ -1882,6 +10016,18 @@ rocrand_status ROCRANDAPI rocrand_set_quasi_random_generator_dimensions(rocrand_
     {
         return static_cast<rocrand_scrambled_sobol32*>(generator)->set_dimensions(dimensions);
     }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON)
+    {
+        return static_cast<rocrand_halton*>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE)
+    {
+        return static_cast<rocrand_lattice*>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN)
+    {
+        return static_cast<rocrand_sobol32_owen*>(generator)->set_dimensions(dimensions);
+    }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
         return static_cast<rocrand_sobol64*>(generator)->set_dimensions(dimensions);
@@ -1894,6 +10040,28 @@ rocrand_status ROCRANDAPI rocrand_set_quasi_random_generator_dimensions(rocrand_
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
+rocrand_status ROCRANDAPI rocrand_set_quasi_random_generator_layout(rocrand_generator    generator,
+                                                                    rocrand_quasi_layout layout)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(layout != ROCRAND_QUASI_LAYOUT_DIMENSION_MAJOR && layout != ROCRAND_QUASI_LAYOUT_POINT_MAJOR
+       && layout != ROCRAND_QUASI_LAYOUT_BLOCKED && layout != ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32*>(generator)->set_layout(layout);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
 rocrand_status ROCRANDAPI rocrand_get_version(int* version)
 {
     if(version == NULL)
@@ -1932,7 +10100,7 @@ rocrand_status ROCRANDAPI rocrand_create_poisson_distribution(
     }
 
     hipError_t error;
-    error = hipMalloc(reinterpret_cast<void**>(discrete_distribution),
+    error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(discrete_distribution),
                       sizeof(rocrand_discrete_distribution_st));
     if(error != hipSuccess)
     {
@@ -1982,7 +10150,55 @@ rocrand_status ROCRANDAPI
     }
 
     hipError_t error;
-    error = hipMalloc(reinterpret_cast<void**>(discrete_distribution),
+    error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(discrete_distribution),
+                      sizeof(rocrand_discrete_distribution_st));
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    error = hipMemcpy(*discrete_distribution,
+                      &h_dis,
+                      sizeof(rocrand_discrete_distribution_st),
+                      hipMemcpyDefault);
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+    rocrand_create_discrete_distribution_device(const double* probabilities,
+                                                unsigned int  size,
+                                                unsigned int  offset,
+                                                rocrand_discrete_distribution* discrete_distribution)
+{
+    if(probabilities == NULL || discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
+    try
+    {
+        h_dis.init_from_device(probabilities, size, offset);
+    }
+    catch(const std::exception& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+
+    hipError_t error;
+    error = rocrand_host::detail::device_malloc(reinterpret_cast<void**>(discrete_distribution),
                       sizeof(rocrand_discrete_distribution_st));
     if(error != hipSuccess)
     {
@@ -2029,7 +10245,7 @@ rocrand_status ROCRANDAPI
         return status;
     }
 
-    error = hipFree(discrete_distribution);
+    error = rocrand_host::detail::device_free(discrete_distribution);
     if(error != hipSuccess)
     {
         return ROCRAND_STATUS_INTERNAL_ERROR;
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <hip/hip_runtime.h>
+
+#include "rng/sobol32_owen.hpp"
+
+// Explicit instantiations of the generation methods called from the C API.
+// Keeping them in a separate translation unit per generator places each
+// generator's kernels in its own code object, so the HIP runtime only loads
+// the device code of the generators a process actually uses.
+
+template rocrand_status rocrand_sobol32_owen::generate<unsigned char, sobol_uniform_distribution<unsigned char>>(unsigned char*, size_t, sobol_uniform_distribution<unsigned char>);
+template rocrand_status rocrand_sobol32_owen::generate<unsigned short, sobol_uniform_distribution<unsigned short>>(unsigned short*, size_t, sobol_uniform_distribution<unsigned short>);
+template rocrand_status rocrand_sobol32_owen::generate<unsigned int, sobol_uniform_distribution<unsigned int>>(unsigned int*, size_t, sobol_uniform_distribution<unsigned int>);
+template rocrand_status rocrand_sobol32_owen::generate_replicates<float, sobol_uniform_distribution<float>>(float*, size_t, unsigned int, const unsigned long long*, sobol_uniform_distribution<float>);
+template rocrand_status rocrand_sobol32_owen::generate_uniform<__half>(__half*, size_t);
+template rocrand_status rocrand_sobol32_owen::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+template rocrand_status rocrand_sobol32_owen::generate_uniform<float>(float*, size_t);
+template rocrand_status rocrand_sobol32_owen::generate_uniform<double>(double*, size_t);
+template rocrand_status rocrand_sobol32_owen::generate_normal<__half>(__half*, size_t, __half, __half);
+template rocrand_status rocrand_sobol32_owen::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+template rocrand_status rocrand_sobol32_owen::generate_normal<float>(float*, size_t, float, float);
+template rocrand_status rocrand_sobol32_owen::generate_normal<double>(double*, size_t, double, double);
+template rocrand_status rocrand_sobol32_owen::generate_log_normal<__half>(__half*, size_t, __half, __half);
+template rocrand_status rocrand_sobol32_owen::generate_log_normal<float>(float*, size_t, float, float);
+template rocrand_status rocrand_sobol32_owen::generate_log_normal<double>(double*, size_t, double, double);
+template rocrand_status rocrand_sobol32_owen::generate_exponential<float>(float*, size_t, float);
+template rocrand_status rocrand_sobol32_owen::generate_exponential<double>(double*, size_t, double);
+template rocrand_status rocrand_sobol32_owen::generate_cauchy<float>(float*, size_t, float, float);
+template rocrand_status rocrand_sobol32_owen::generate_cauchy<double>(double*, size_t, double, double);
+template rocrand_status rocrand_sobol32_owen::generate_weibull<float>(float*, size_t, float, float);
+template rocrand_status rocrand_sobol32_owen::generate_weibull<double>(double*, size_t, double, double);
@@ -0,0 +1,55 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <hip/hip_runtime.h>
+
+#include "rng/threefry4x64_20.hpp"
+
+// Explicit instantiations of the generation methods called from the C API.
+// Keeping them in a separate translation unit per generator places each
+// generator's kernels in its own code object, so the HIP runtime only loads
+// the device code of the generators a process actually uses.
+
+template rocrand_status rocrand_threefry4x64_20::generate<unsigned char, uniform_distribution<unsigned char, unsigned long long>>(unsigned char*, size_t, uniform_distribution<unsigned char, unsigned long long>);
+template rocrand_status rocrand_threefry4x64_20::generate<unsigned short, uniform_distribution<unsigned short, unsigned long long>>(unsigned short*, size_t, uniform_distribution<unsigned short, unsigned long long>);
+template rocrand_status rocrand_threefry4x64_20::generate<unsigned int, uniform_distribution<unsigned int, unsigned long long>>(unsigned int*, size_t, uniform_distribution<unsigned int, unsigned long long>);
+template rocrand_status rocrand_threefry4x64_20::generate<unsigned long long, uniform_distribution<unsigned long long, unsigned long long>>(unsigned long long*, size_t, uniform_distribution<unsigned long long, unsigned long long>);
+template rocrand_status rocrand_threefry4x64_20::generate_uniform<__half>(__half*, size_t);
+template rocrand_status rocrand_threefry4x64_20::generate_uniform<hip_bfloat16>(hip_bfloat16*, size_t);
+template rocrand_status rocrand_threefry4x64_20::generate_uniform<float>(float*, size_t);
+template rocrand_status rocrand_threefry4x64_20::generate_uniform<double>(double*, size_t);
+template rocrand_status rocrand_threefry4x64_20::generate_normal<__half>(__half*, size_t, __half, __half);
+template rocrand_status rocrand_threefry4x64_20::generate_normal<hip_bfloat16>(hip_bfloat16*, size_t, hip_bfloat16, hip_bfloat16);
+template rocrand_status rocrand_threefry4x64_20::generate_normal<float>(float*, size_t, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_normal<double>(double*, size_t, double, double);
+template rocrand_status rocrand_threefry4x64_20::generate_log_normal<__half>(__half*, size_t, __half, __half);
+template rocrand_status rocrand_threefry4x64_20::generate_log_normal<float>(float*, size_t, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_log_normal<double>(double*, size_t, double, double);
+template rocrand_status rocrand_threefry4x64_20::generate_truncated_normal<float>(float*, size_t, float, float, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_truncated_normal<double>(double*, size_t, double, double, double, double);
+template rocrand_status rocrand_threefry4x64_20::generate_gamma<float>(float*, size_t, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_gamma<double>(double*, size_t, double, double);
+template rocrand_status rocrand_threefry4x64_20::generate_exponential<float>(float*, size_t, float);
+template rocrand_status rocrand_threefry4x64_20::generate_exponential<double>(double*, size_t, double);
+template rocrand_status rocrand_threefry4x64_20::generate_cauchy<float>(float*, size_t, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_cauchy<double>(double*, size_t, double, double);
+template rocrand_status rocrand_threefry4x64_20::generate_weibull<float>(float*, size_t, float, float);
+template rocrand_status rocrand_threefry4x64_20::generate_weibull<double>(double*, size_t, double, double);
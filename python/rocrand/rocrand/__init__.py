@@ -19,4 +19,4 @@
 # THE SOFTWARE.
 
 from .rocrand import RocRandError, PRNG, QRNG, get_version
-from .hip import HipError, DeviceNDArray, empty
+from .hip import HipError, DeviceNDArray, empty, wrap_device_array
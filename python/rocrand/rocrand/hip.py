@@ -101,6 +101,19 @@ class MemoryPointer(object):
     def _finalize(cls, ptr):
         check_hip(hip.hipFree(ptr))
 
+class ExternalMemoryPointer(object):
+    def __init__(self, ptr, owner):
+        """Pointer to device memory owned by another object.
+
+        A reference to **owner** is kept so the memory outlives this pointer.
+        The memory is not freed on finalization.
+
+        :param ptr:   raw device pointer (an integer)
+        :param owner: object owning the memory behind **ptr**
+        """
+        self.ptr = c_void_p(ptr)
+        self._owner = owner
+
 def device_pointer(dary):
     return dary.data.ptr
 
@@ -134,6 +147,21 @@ class DeviceNDArray(object):
         else:
             self.data = data
 
+    @property
+    def __cuda_array_interface__(self):
+        """CUDA Array Interface of the array.
+
+        Allows the array to be consumed without copies by other libraries
+        implementing the protocol (CuPy, Numba, PyTorch).
+        """
+        return {
+            "shape": self.shape,
+            "typestr": self.dtype.str,
+            "data": (self.data.ptr.value, False),
+            "strides": None,
+            "version": 3,
+        }
+
     def copy_to_host(self, ary=None):
         """Copy from data device memory to host memory.
 
@@ -185,3 +213,37 @@ def empty(shape, dtype):
     :param dtype: Type of the array (see :attr:`numpy.ndarray.dtype`)
     """
     return DeviceNDArray(shape, dtype)
+
+def wrap_device_array(ary):
+    """Create a :class:`DeviceNDArray` view of an external device-side array.
+
+    **ary** can be any object exposing the ``__cuda_array_interface__``
+    protocol, for example a CuPy array, a Numba device array or a PyTorch
+    CUDA tensor. The view shares memory with **ary**: no copy is made and
+    writes through the view are visible in **ary**.
+
+    Only writable C-contiguous arrays are supported.
+
+    :param ary: object exposing ``__cuda_array_interface__``
+
+    :returns: a new :class:`DeviceNDArray` sharing memory with **ary**
+    """
+    interface = ary.__cuda_array_interface__
+
+    ptr, read_only = interface["data"]
+    if read_only:
+        raise ValueError("ary is read-only")
+
+    dtype = np.dtype(interface["typestr"])
+    shape = tuple(interface["shape"])
+
+    # None means C-contiguous; explicit strides must describe the same layout
+    strides = interface.get("strides")
+    if strides is not None:
+        contiguous_strides = [dtype.itemsize]
+        for dim in reversed(shape[1:]):
+            contiguous_strides.insert(0, contiguous_strides[0] * dim)
+        if tuple(strides) != tuple(contiguous_strides):
+            raise ValueError("only C-contiguous arrays are supported")
+
+    return DeviceNDArray(shape, dtype, data=ExternalMemoryPointer(ptr, ary))
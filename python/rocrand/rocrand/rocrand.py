@@ -29,7 +29,7 @@ import numbers
 import numpy as np
 
 from .hip import load_hip, HIP_PATHS
-from .hip import empty, DeviceNDArray, device_pointer
+from .hip import empty, DeviceNDArray, device_pointer, wrap_device_array
 
 from .utils import find_library, expand_paths
 
@@ -76,6 +76,15 @@ ROCRAND_RNG_PSEUDO_THREEFRY2_32_20 = 408
 ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 409
 ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 410
 ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 411
+ROCRAND_RNG_PSEUDO_PCG64 = 412
+ROCRAND_RNG_PSEUDO_XOSHIRO256PP = 413
+ROCRAND_RNG_PSEUDO_CHACHA20 = 414
+ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 415
+ROCRAND_RNG_PSEUDO_THREEFRY4_64_13 = 416
+ROCRAND_RNG_PSEUDO_SQUARES32 = 417
+ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 418
+ROCRAND_RNG_PSEUDO_WELL19937 = 419
+ROCRAND_RNG_PSEUDO_ADAPTIVE = 420
 ROCRAND_RNG_QUASI_DEFAULT = 500
 ROCRAND_RNG_QUASI_SOBOL32 = 501
 ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
@@ -192,6 +201,17 @@ class RNG(object):
         check_rocrand(rocrand.rocrand_set_stream(self._gen, stream))
         self._stream = stream
 
+    @staticmethod
+    def _wrap_ary(ary):
+        """Returns **ary**, or a :class:`DeviceNDArray` view sharing its memory
+        if **ary** is an external device-side array (see :func:`wrap_device_array`).
+        """
+        if isinstance(ary, (np.ndarray, DeviceNDArray)):
+            return ary
+        if hasattr(ary, "__cuda_array_interface__"):
+            return wrap_device_array(ary)
+        raise TypeError("unsupported type {}".format(type(ary)))
+
     def _generate(self, gen_func, ary, size, *args):
         if size is not None:
             if size > ary.size:
@@ -219,10 +239,13 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     an object exposing ``__cuda_array_interface__``
+                     (e.g. a CuPy array); device arrays are filled in place
         :param size: Number of samples to generate, default to **ary.size**
         """
+        ary = self._wrap_ary(ary)
         if ary.dtype in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate,
@@ -241,10 +264,13 @@ class RNG(object):
         Generated numbers are between 0.0 and 1.0, excluding 0.0 and
         including 1.0.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     an object exposing ``__cuda_array_interface__``
+                     (e.g. a CuPy array); device arrays are filled in place
         :param size: Number of samples to generate, default to **ary.size**
         """
+        ary = self._wrap_ary(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_uniform,
@@ -264,12 +290,15 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       an object exposing ``__cuda_array_interface__``
+                       (e.g. a CuPy array); device arrays are filled in place
         :param mean:   Mean value of normal distribution
         :param stddev: Standard deviation value of normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
+        ary = self._wrap_ary(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_normal,
@@ -291,12 +320,15 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       an object exposing ``__cuda_array_interface__``
+                       (e.g. a CuPy array); device arrays are filled in place
         :param mean:   Mean value of log normal distribution
         :param stddev: Standard deviation value of log normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
+        ary = self._wrap_ary(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_log_normal,
@@ -318,11 +350,14 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:   NumPy array (:class:`numpy.ndarray`) or
-                      HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:   NumPy array (:class:`numpy.ndarray`),
+                      HIP device-side array (:class:`DeviceNDArray`) or
+                      an object exposing ``__cuda_array_interface__``
+                      (e.g. a CuPy array); device arrays are filled in place
         :param lmbd:  lambda for the Poisson distribution
         :param size:  Number of samples to generate, default to **ary.size**
         """
+        ary = self._wrap_ary(ary)
         if ary.dtype in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate_poisson,
@@ -357,6 +392,32 @@ class PRNG(RNG):
     """THREEFRY4_32_20 pseudo-random generator type"""
     THREEFRY4_64_20 = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
     """THREEFRY4_64_20 pseudo-random generator type"""
+    PCG64           = ROCRAND_RNG_PSEUDO_PCG64
+    """PCG64 (XSL-RR) pseudo-random generator type"""
+
+    XOSHIRO256PP    = ROCRAND_RNG_PSEUDO_XOSHIRO256PP
+    """XOSHIRO256++ pseudo-random generator type"""
+
+    CHACHA20        = ROCRAND_RNG_PSEUDO_CHACHA20
+    """ChaCha20 cryptographically-strong pseudo-random generator type"""
+
+    PHILOX4_32_7    = ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+    """Reduced-round PHILOX4_32_7 pseudo-random generator type"""
+
+    THREEFRY4_64_13 = ROCRAND_RNG_PSEUDO_THREEFRY4_64_13
+    """Reduced-round THREEFRY4_64_13 pseudo-random generator type"""
+
+    SQUARES32       = ROCRAND_RNG_PSEUDO_SQUARES32
+    """Squares counter-based pseudo-random generator type"""
+
+    PHILOX4_64_10   = ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+    """PHILOX4_64_10 pseudo-random generator type"""
+
+    WELL19937       = ROCRAND_RNG_PSEUDO_WELL19937
+    """WELL19937c pseudo-random generator type"""
+
+    ADAPTIVE        = ROCRAND_RNG_PSEUDO_ADAPTIVE
+    """Hybrid generator routing between PHILOX4_32_10 and MTGP32 by fill size"""
 
     def __init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None):
         """Creates a new pseudo-random number generator.
@@ -378,6 +439,15 @@ class PRNG(RNG):
         * :const:`THREEFRY2_64_20`
         * :const:`THREEFRY4_32_20`
         * :const:`THREEFRY4_64_20`
+        * :const:`PCG64`
+        * :const:`XOSHIRO256PP`
+        * :const:`CHACHA20`
+        * :const:`PHILOX4_32_7`
+        * :const:`THREEFRY4_64_13`
+        * :const:`SQUARES32`
+        * :const:`PHILOX4_64_10`
+        * :const:`WELL19937`
+        * :const:`ADAPTIVE`
 
         :param rngtype: Type of pseudo-random number generator to create
         :param seed:    Initial seed value
@@ -67,6 +67,14 @@ make_test(TestCtorPRNG, "THREEFRY2_32_20", rngtype=PRNG.THREEFRY2_32_20)
 make_test(TestCtorPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
 make_test(TestCtorPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
 make_test(TestCtorPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestCtorPRNG, "PCG64", rngtype=PRNG.PCG64)
+make_test(TestCtorPRNG, "XOSHIRO256PP", rngtype=PRNG.XOSHIRO256PP)
+make_test(TestCtorPRNG, "CHACHA20", rngtype=PRNG.CHACHA20)
+make_test(TestCtorPRNG, "PHILOX4_32_7", rngtype=PRNG.PHILOX4_32_7)
+make_test(TestCtorPRNG, "THREEFRY4_64_13", rngtype=PRNG.THREEFRY4_64_13)
+make_test(TestCtorPRNG, "SQUARES32", rngtype=PRNG.SQUARES32)
+make_test(TestCtorPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestCtorPRNG, "ADAPTIVE", rngtype=PRNG.ADAPTIVE)
 
 class TestCtorPRNGMT(TestRNGBase):
     def test_ctor(self):
@@ -79,6 +87,7 @@ class TestCtorPRNGMT(TestRNGBase):
 
 make_test(TestCtorPRNGMT, "MTGP32",  rngtype=PRNG.MTGP32)
 make_test(TestCtorPRNGMT, "MT19937", rngtype=PRNG.MT19937)
+make_test(TestCtorPRNGMT, "WELL19937", rngtype=PRNG.WELL19937)
 
 class TestCtorPRNGLFSR113(TestRNGBase):
     rngtype = PRNG.LFSR113
@@ -135,6 +144,14 @@ make_test(TestParamsPRNG, "THREEFRY2_32_20", rngtype=PRNG.THREEFRY2_32_20)
 make_test(TestParamsPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
 make_test(TestParamsPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
 make_test(TestParamsPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestParamsPRNG, "PCG64", rngtype=PRNG.PCG64)
+make_test(TestParamsPRNG, "XOSHIRO256PP", rngtype=PRNG.XOSHIRO256PP)
+make_test(TestParamsPRNG, "CHACHA20", rngtype=PRNG.CHACHA20)
+make_test(TestParamsPRNG, "PHILOX4_32_7", rngtype=PRNG.PHILOX4_32_7)
+make_test(TestParamsPRNG, "THREEFRY4_64_13", rngtype=PRNG.THREEFRY4_64_13)
+make_test(TestParamsPRNG, "SQUARES32", rngtype=PRNG.SQUARES32)
+make_test(TestParamsPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestParamsPRNG, "ADAPTIVE", rngtype=PRNG.ADAPTIVE)
 
 class TestParamsPRNGMT(TestRNGBase):
     def setUp(self):
@@ -158,6 +175,7 @@ class TestParamsPRNGMT(TestRNGBase):
 
 make_test(TestParamsPRNGMT, "MTGP32",  rngtype=PRNG.MTGP32)
 make_test(TestParamsPRNGMT, "MT19937", rngtype=PRNG.MT19937)
+make_test(TestParamsPRNGMT, "WELL19937", rngtype=PRNG.WELL19937)
 
 class TestParamsPRNGLFSR113(TestRNGBase):
     rngtype = PRNG.LFSR113
@@ -306,8 +324,8 @@ class TestGenerate(TestRNGBase):
         self._test_lognormal_real(np.float64)
 
     def test_poisson(self):
-        if self.rngtype == PRNG.THREEFRY2_64_20 or self.rngtype == PRNG.THREEFRY4_64_20:
-            self.skipTest("64-bits Threefry cannot generate 32-bits Poisson numbers")
+        if self.rngtype in (PRNG.THREEFRY2_64_20, PRNG.THREEFRY4_64_20, PRNG.PCG64, PRNG.XOSHIRO256PP, PRNG.THREEFRY4_64_13, PRNG.PHILOX4_64_10):
+            self.skipTest("64-bits generators cannot generate 32-bits Poisson numbers")
         for lambda_value in [1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0]:
             output = np.empty(OUTPUT_SIZE, np.uint32)
             self.rng.poisson(output, lambda_value)
@@ -339,6 +357,78 @@ make_test(TestGenerate, "PRNG" + "THREEFRY2_32_20",   klass=PRNG, rngtype=PRNG.T
 make_test(TestGenerate, "PRNG" + "THREEFRY2_64_20",   klass=PRNG, rngtype=PRNG.THREEFRY2_64_20)
 make_test(TestGenerate, "PRNG" + "THREEFRY4_32_20",   klass=PRNG, rngtype=PRNG.THREEFRY4_32_20)
 make_test(TestGenerate, "PRNG" + "THREEFRY4_64_20",   klass=PRNG, rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestGenerate, "PRNG" + "PCG64",            klass=PRNG, rngtype=PRNG.PCG64)
+make_test(TestGenerate, "PRNG" + "XOSHIRO256PP",     klass=PRNG, rngtype=PRNG.XOSHIRO256PP)
+make_test(TestGenerate, "PRNG" + "CHACHA20",         klass=PRNG, rngtype=PRNG.CHACHA20)
+make_test(TestGenerate, "PRNG" + "PHILOX4_32_7",     klass=PRNG, rngtype=PRNG.PHILOX4_32_7)
+make_test(TestGenerate, "PRNG" + "THREEFRY4_64_13",  klass=PRNG, rngtype=PRNG.THREEFRY4_64_13)
+make_test(TestGenerate, "PRNG" + "SQUARES32",        klass=PRNG, rngtype=PRNG.SQUARES32)
+make_test(TestGenerate, "PRNG" + "PHILOX4_64_10",    klass=PRNG, rngtype=PRNG.PHILOX4_64_10)
+make_test(TestGenerate, "PRNG" + "WELL19937",        klass=PRNG, rngtype=PRNG.WELL19937)
+make_test(TestGenerate, "PRNG" + "ADAPTIVE",         klass=PRNG, rngtype=PRNG.ADAPTIVE)
+
+class ArrayInterfaceStub(object):
+    """Minimal stand-in for an external device array (a CuPy array, a PyTorch
+    tensor): exposes only __cuda_array_interface__ over existing device memory.
+    """
+    def __init__(self, dary):
+        self._dary = dary
+        self.__cuda_array_interface__ = dary.__cuda_array_interface__
+
+class TestArrayInterface(unittest.TestCase):
+    def setUp(self):
+        self.rng = PRNG(PRNG.PHILOX4_32_10)
+
+    def tearDown(self):
+        del self.rng
+
+    def test_uniform_in_place(self):
+        dary = empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(ArrayInterfaceStub(dary))
+
+        output = dary.copy_to_host()
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+
+    def test_generate_in_place(self):
+        dary = empty(OUTPUT_SIZE, np.uint32)
+        self.rng.generate(ArrayInterfaceStub(dary))
+
+        output = dary.copy_to_host().astype(np.float64) / 4294967295.0
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+
+    def test_matches_device_array(self):
+        # The same seed produces the same numbers whether the output array
+        # is passed directly or through the interface
+        dary0 = empty(OUTPUT_SIZE, np.float32)
+        dary1 = empty(OUTPUT_SIZE, np.float32)
+
+        self.rng.seed = 123456
+        self.rng.uniform(dary0)
+        self.rng.seed = 123456
+        self.rng.uniform(ArrayInterfaceStub(dary1))
+
+        self.assertTrue((dary0.copy_to_host() == dary1.copy_to_host()).all())
+
+    def test_read_only(self):
+        dary = empty(OUTPUT_SIZE, np.float32)
+        stub = ArrayInterfaceStub(dary)
+        interface = dict(stub.__cuda_array_interface__)
+        interface["data"] = (interface["data"][0], True)
+        stub.__cuda_array_interface__ = interface
+
+        with self.assertRaises(ValueError):
+            self.rng.uniform(stub)
+
+    def test_non_contiguous(self):
+        dary = empty((10, 100), np.float32)
+        stub = ArrayInterfaceStub(dary)
+        interface = dict(stub.__cuda_array_interface__)
+        # Strides of a transposed (Fortran-order) array
+        interface["strides"] = (4, 40)
+        stub.__cuda_array_interface__ = interface
+
+        with self.assertRaises(ValueError):
+            self.rng.uniform(stub)
 
 
 if __name__ == "__main__":
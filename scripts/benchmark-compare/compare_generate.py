@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+"""Side-by-side rocRAND/cuRAND comparison report.
+
+Runs benchmark_rocrand_generate and benchmark_curand_generate with an
+identical engine/distribution/size matrix, merges their CSV output into
+one JSON schema and prints a summary table of throughput normalized per
+dollar and per watt. Both benchmarks must have been built first; the
+cuRAND one runs on a machine with an NVIDIA GPU, so the two binaries may
+also be run separately with --load to merge previously captured output:
+
+    compare_generate.py --rocrand-binary .../benchmark_rocrand_generate \\
+                        --curand-binary .../benchmark_curand_generate \\
+                        --engines philox xorwow --distributions all \\
+                        --rocrand-price 13500 --rocrand-tdp 560 \\
+                        --curand-price 30000 --curand-tdp 700 \\
+                        --output report.json
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+
+CSV_COLUMNS = [
+    "engine",
+    "distribution",
+    "gb_per_second",
+    "gsamples_per_second",
+    "avg_ms",
+    "total_ms",
+    "size",
+    "lambda",
+]
+
+
+def run_benchmark(binary, engines, distributions, size, trials):
+    """Runs one benchmark binary in CSV mode and returns its raw output."""
+    command = [
+        binary,
+        "--engine"] + engines + [
+        "--dis"] + distributions + [
+        "--size", str(size),
+        "--trials", str(trials),
+        "--format", "csv",
+    ]
+    result = subprocess.run(command, stdout=subprocess.PIPE, check=True,
+                            universal_newlines=True)
+    return result.stdout
+
+
+def parse_output(library, text):
+    """Parses the CSV output of one benchmark into result dictionaries."""
+    device = None
+    results = []
+    for line in text.splitlines():
+        line = line.strip()
+        if "Device:" in line:
+            device = line.split("Device:", 1)[1].strip()
+            continue
+        fields = line.split(",")
+        if len(fields) != len(CSV_COLUMNS):
+            continue
+        try:
+            gb_per_second = float(fields[2])
+        except ValueError:
+            continue  # the header rows
+        result = {
+            "library": library,
+            "engine": fields[0],
+            "distribution": fields[1],
+            "gb_per_second": gb_per_second,
+            "gsamples_per_second": float(fields[3]),
+            "avg_ms": float(fields[4]),
+            "total_ms": float(fields[5]),
+            "size": int(fields[6]),
+            "lambda": float(fields[7]) if fields[7] else None,
+        }
+        results.append(result)
+    return device, results
+
+
+def normalize(results, price, tdp):
+    """Adds per-dollar and per-watt throughput where the rates are known."""
+    for result in results:
+        result["gb_per_second_per_dollar"] = (
+            result["gb_per_second"] / price if price else None)
+        result["gb_per_second_per_watt"] = (
+            result["gb_per_second"] / tdp if tdp else None)
+
+
+def summary_table(rocrand_results, curand_results):
+    """Yields one row per engine/distribution pair present in both suites."""
+    curand_index = {(r["engine"], r["distribution"], r["lambda"]): r
+                    for r in curand_results}
+    for rocrand in rocrand_results:
+        key = (rocrand["engine"], rocrand["distribution"], rocrand["lambda"])
+        curand = curand_index.get(key)
+        if curand is None:
+            continue
+        yield rocrand, curand
+
+
+def print_summary(rocrand_results, curand_results):
+    header = ("engine", "distribution",
+              "roc GB/s", "cu GB/s", "ratio",
+              "roc GB/s/$", "cu GB/s/$",
+              "roc GB/s/W", "cu GB/s/W")
+    rows = [header]
+    for rocrand, curand in summary_table(rocrand_results, curand_results):
+        def fmt(value, scale=1.0):
+            return "-" if value is None else "%.3f" % (value * scale)
+        rows.append((
+            rocrand["engine"],
+            rocrand["distribution"],
+            fmt(rocrand["gb_per_second"]),
+            fmt(curand["gb_per_second"]),
+            fmt(rocrand["gb_per_second"] / curand["gb_per_second"])
+                if curand["gb_per_second"] else "-",
+            # per-dollar numbers are small; report them per kilodollar
+            fmt(rocrand["gb_per_second_per_dollar"], 1000.0),
+            fmt(curand["gb_per_second_per_dollar"], 1000.0),
+            fmt(rocrand["gb_per_second_per_watt"]),
+            fmt(curand["gb_per_second_per_watt"]),
+        ))
+    widths = [max(len(row[i]) for row in rows) for i in range(len(header))]
+    for row in rows:
+        print("  ".join(field.rjust(width)
+                        for field, width in zip(row, widths)))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--rocrand-binary",
+                        help="path to benchmark_rocrand_generate")
+    parser.add_argument("--curand-binary",
+                        help="path to benchmark_curand_generate")
+    parser.add_argument("--rocrand-load",
+                        help="previously captured rocRAND CSV output to parse "
+                             "instead of running the binary")
+    parser.add_argument("--curand-load",
+                        help="previously captured cuRAND CSV output to parse "
+                             "instead of running the binary")
+    parser.add_argument("--engines", nargs="+", default=["all"],
+                        help="engines passed to both benchmarks")
+    parser.add_argument("--distributions", nargs="+", default=["all"],
+                        help="distributions passed to both benchmarks")
+    parser.add_argument("--size", type=int, default=1024 * 1024 * 128,
+                        help="number of values per measurement")
+    parser.add_argument("--trials", type=int, default=20,
+                        help="number of trials per measurement")
+    parser.add_argument("--rocrand-price", type=float,
+                        help="price of the rocRAND device in your currency")
+    parser.add_argument("--curand-price", type=float,
+                        help="price of the cuRAND device in your currency")
+    parser.add_argument("--rocrand-tdp", type=float,
+                        help="TDP of the rocRAND device in watts")
+    parser.add_argument("--curand-tdp", type=float,
+                        help="TDP of the cuRAND device in watts")
+    parser.add_argument("--output", help="path of the JSON report")
+    arguments = parser.parse_args()
+
+    outputs = {}
+    for library, binary, load in (
+            ("rocrand", arguments.rocrand_binary, arguments.rocrand_load),
+            ("curand", arguments.curand_binary, arguments.curand_load)):
+        if load:
+            with open(load) as captured:
+                outputs[library] = captured.read()
+        elif binary:
+            outputs[library] = run_benchmark(
+                binary, arguments.engines, arguments.distributions,
+                arguments.size, arguments.trials)
+        else:
+            parser.error("give --%s-binary or --%s-load" % (library, library))
+
+    rocrand_device, rocrand_results = parse_output("rocrand", outputs["rocrand"])
+    curand_device, curand_results = parse_output("curand", outputs["curand"])
+    normalize(rocrand_results, arguments.rocrand_price, arguments.rocrand_tdp)
+    normalize(curand_results, arguments.curand_price, arguments.curand_tdp)
+
+    report = {
+        "size": arguments.size,
+        "trials": arguments.trials,
+        "devices": {
+            "rocrand": {"name": rocrand_device,
+                        "price": arguments.rocrand_price,
+                        "tdp": arguments.rocrand_tdp},
+            "curand": {"name": curand_device,
+                       "price": arguments.curand_price,
+                       "tdp": arguments.curand_tdp},
+        },
+        "results": rocrand_results + curand_results,
+    }
+    if arguments.output:
+        with open(arguments.output, "w") as output:
+            json.dump(report, output, indent=2)
+            output.write("\n")
+
+    print_summary(rocrand_results, curand_results)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
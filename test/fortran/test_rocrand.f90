@@ -82,6 +82,31 @@ contains
         call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
     end subroutine test_rocrand_generate_uniform
 
+    !> Test stream-ordered generation: the generator fills on an explicit
+    !> stream and the host only waits on that stream, so generation and the
+    !> copy back can overlap work queued on other streams.
+    subroutine test_rocrand_generate_async()
+        integer(kind =8) :: gen
+        integer(c_size_t) :: stream
+        real, target, dimension(128) :: h_x
+        type(c_ptr) :: d_x
+        integer(c_size_t), parameter :: output_size = 128
+        real, parameter :: mean = 0.5, delta = 0.1
+        call assert_equals(hipSuccess, hipStreamCreate(stream))
+        call assert_equals(hipSuccess, hipMalloc(d_x, output_size * sizeof(h_x(1))))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_DEFAULT))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_set_stream(gen, stream))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_uniform(gen, d_x, output_size))
+        call assert_equals(hipSuccess, hipMemcpyAsync(c_loc(h_x), d_x, &
+        output_size * sizeof(h_x(1)), hipMemcpyDeviceToHost, stream))
+        call assert_equals(hipSuccess, hipStreamSynchronize(stream))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals(hipSuccess, hipFree(d_x))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+        call assert_equals(hipSuccess, hipStreamDestroy(stream))
+    end subroutine test_rocrand_generate_async
+
     !> Test rocrand_generate_uniform_double.
     subroutine test_rocrand_generate_uniform_double()
         integer(kind =8) :: gen
@@ -223,6 +248,9 @@ contains
     call run_fruit_test_case(test_rocrand_generate_uniform,'test_rocrand_generate_uniform',&
         setup,teardown,suite_name)
 
+    call run_fruit_test_case(test_rocrand_generate_async,'test_rocrand_generate_async',&
+        setup,teardown,suite_name)
+
     call run_fruit_test_case(test_rocrand_generate_uniform_double, &
         'test_rocrand_generate_uniform_double',setup,teardown,suite_name)
 
@@ -0,0 +1,373 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Statistical quality tests that consume engine output on the device
+// and copy only a few counters back, so a quality check after a driver
+// or compiler upgrade takes minutes instead of shipping gigabytes to a
+// CPU battery. Each test reduces the stream into the statistic of one
+// of the classic battery tests (frequency, serial correlation, binary
+// rank, gap) and checks the resulting p-value.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand/rocrand_kernel.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+
+// Threads consuming the stream; every thread reads its own subsequence
+constexpr unsigned int blocks = 256;
+constexpr unsigned int threads = 256;
+constexpr unsigned int total_threads = blocks * threads;
+
+// A p-value outside this interval fails; with a fixed seed the tests
+// are deterministic, so the bound only has to reject real defects
+constexpr double p_min = 1e-4;
+
+// Regularized upper incomplete gamma function Q(a, x): the series for
+// x < a + 1 and Lentz's continued fraction otherwise, both of which
+// converge fast in their half
+double gamma_q(double a, double x)
+{
+    if(x <= 0.0)
+    {
+        return 1.0;
+    }
+    if(x < a + 1.0)
+    {
+        double term = 1.0 / a;
+        double sum = term;
+        for(int i = 1; i < 200; i++)
+        {
+            term *= x / (a + i);
+            sum += term;
+            if(term < sum * 1e-15)
+            {
+                break;
+            }
+        }
+        return 1.0 - sum * std::exp(-x + a * std::log(x) - std::lgamma(a));
+    }
+    double b = x + 1.0 - a;
+    double c = 1e300;
+    double d = 1.0 / b;
+    double h = d;
+    for(int i = 1; i < 200; i++)
+    {
+        const double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if(std::fabs(d) < 1e-300)
+        {
+            d = 1e-300;
+        }
+        c = b + an / c;
+        if(std::fabs(c) < 1e-300)
+        {
+            c = 1e-300;
+        }
+        d = 1.0 / d;
+        const double delta = d * c;
+        h *= delta;
+        if(std::fabs(delta - 1.0) < 1e-15)
+        {
+            break;
+        }
+    }
+    return h * std::exp(-x + a * std::log(x) - std::lgamma(a));
+}
+
+double chi_square_p(double chi_square, double dof)
+{
+    return gamma_q(0.5 * dof, 0.5 * chi_square);
+}
+
+double normal_p(double z)
+{
+    return std::erfc(std::fabs(z) / std::sqrt(2.0));
+}
+
+// Counts the set bits of the stream
+__global__
+void frequency_kernel(unsigned long long * ones,
+                      const size_t draws_per_thread,
+                      const unsigned long long seed)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    rocrand_state_philox4_32_10 state;
+    rocrand_init(seed, state_id, 0, &state);
+
+    unsigned long long count = 0;
+    for(size_t i = 0; i < draws_per_thread; i++)
+    {
+        count += __popc(rocrand(&state));
+    }
+    atomicAdd(ones, count);
+}
+
+// Accumulates the lag-1 products of the centered uniform values; each
+// thread correlates within its own run, so no pairs cross threads
+__global__
+void serial_correlation_kernel(double * sum,
+                               const size_t run_length,
+                               const unsigned long long seed)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    rocrand_state_philox4_32_10 state;
+    rocrand_init(seed, state_id, 0, &state);
+
+    double previous = rocrand_uniform(&state) - 0.5;
+    double products = 0.0;
+    for(size_t i = 1; i < run_length; i++)
+    {
+        const double x = rocrand_uniform(&state) - 0.5;
+        products += previous * x;
+        previous = x;
+    }
+    atomicAdd(sum, products);
+}
+
+// Ranks 32x32 matrices over GF(2) built from 32 draws each and counts
+// full rank, one below and the rest
+__global__
+void binary_rank_kernel(unsigned long long * counts,
+                        const size_t matrices_per_thread,
+                        const unsigned long long seed)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    rocrand_state_philox4_32_10 state;
+    rocrand_init(seed, state_id, 0, &state);
+
+    unsigned long long full = 0;
+    unsigned long long one_below = 0;
+    unsigned long long rest = 0;
+    for(size_t m = 0; m < matrices_per_thread; m++)
+    {
+        unsigned int rows[32];
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            rows[i] = rocrand(&state);
+        }
+
+        // Gaussian elimination over GF(2)
+        unsigned int rank = 0;
+        for(int column = 31; column >= 0 && rank < 32; column--)
+        {
+            const unsigned int bit = 1u << column;
+            unsigned int pivot = rank;
+            while(pivot < 32 && (rows[pivot] & bit) == 0)
+            {
+                pivot++;
+            }
+            if(pivot == 32)
+            {
+                continue;
+            }
+            const unsigned int pivot_row = rows[pivot];
+            rows[pivot] = rows[rank];
+            rows[rank] = pivot_row;
+            for(unsigned int i = rank + 1; i < 32; i++)
+            {
+                if((rows[i] & bit) != 0)
+                {
+                    rows[i] ^= pivot_row;
+                }
+            }
+            rank++;
+        }
+
+        if(rank == 32)
+        {
+            full++;
+        }
+        else if(rank == 31)
+        {
+            one_below++;
+        }
+        else
+        {
+            rest++;
+        }
+    }
+    atomicAdd(&counts[0], full);
+    atomicAdd(&counts[1], one_below);
+    atomicAdd(&counts[2], rest);
+}
+
+// Histograms the gaps between values below one half; the trailing
+// incomplete gap of each thread is dropped
+__global__
+void gap_kernel(unsigned long long * histogram,
+                const unsigned int bins,
+                const size_t draws_per_thread,
+                const unsigned long long seed)
+{
+    const unsigned int state_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+    rocrand_state_philox4_32_10 state;
+    rocrand_init(seed, state_id, 0, &state);
+
+    unsigned int gap = 0;
+    for(size_t i = 0; i < draws_per_thread; i++)
+    {
+        if(rocrand_uniform(&state) < 0.5f)
+        {
+            const unsigned int bin = gap < bins - 1 ? gap : bins - 1;
+            atomicAdd(&histogram[bin], 1ull);
+            gap = 0;
+        }
+        else
+        {
+            gap++;
+        }
+    }
+}
+
+TEST(rocrand_statistical_tests, frequency_test)
+{
+    const size_t draws_per_thread = 256;
+    const unsigned long long bits =
+        static_cast<unsigned long long>(total_threads) * draws_per_thread * 32;
+
+    unsigned long long * ones;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&ones), sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(ones, 0, sizeof(unsigned long long)));
+
+    hipLaunchKernelGGL(frequency_kernel, dim3(blocks), dim3(threads), 0, 0,
+                       ones, draws_per_thread, 0xdeadbeefULL);
+    HIP_CHECK(hipGetLastError());
+
+    unsigned long long host_ones;
+    HIP_CHECK(hipMemcpy(&host_ones, ones, sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(ones));
+
+    const double z = (2.0 * host_ones - static_cast<double>(bits))
+        / std::sqrt(static_cast<double>(bits));
+    const double p = normal_p(z);
+    EXPECT_GT(p, p_min) << "where z = " << z;
+}
+
+TEST(rocrand_statistical_tests, serial_correlation_test)
+{
+    const size_t run_length = 4096;
+    const unsigned long long pairs =
+        static_cast<unsigned long long>(total_threads) * (run_length - 1);
+
+    double * sum;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&sum), sizeof(double)));
+    HIP_CHECK(hipMemset(sum, 0, sizeof(double)));
+
+    hipLaunchKernelGGL(serial_correlation_kernel, dim3(blocks), dim3(threads), 0, 0,
+                       sum, run_length, 0x12345678ULL);
+    HIP_CHECK(hipGetLastError());
+
+    double host_sum;
+    HIP_CHECK(hipMemcpy(&host_sum, sum, sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(sum));
+
+    // Centered lag-1 products of iid uniforms have mean 0 and variance
+    // 1/144, and the shared-element covariances vanish
+    const double z = 12.0 * host_sum / std::sqrt(static_cast<double>(pairs));
+    const double p = normal_p(z);
+    EXPECT_GT(p, p_min) << "where z = " << z;
+}
+
+TEST(rocrand_statistical_tests, binary_rank_test)
+{
+    const size_t matrices_per_thread = 4;
+    const double matrices =
+        static_cast<double>(total_threads) * matrices_per_thread;
+
+    unsigned long long * counts;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&counts), 3 * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(counts, 0, 3 * sizeof(unsigned long long)));
+
+    hipLaunchKernelGGL(binary_rank_kernel, dim3(blocks), dim3(threads), 0, 0,
+                       counts, matrices_per_thread, 0xcafef00dULL);
+    HIP_CHECK(hipGetLastError());
+
+    unsigned long long host_counts[3];
+    HIP_CHECK(hipMemcpy(host_counts, counts, 3 * sizeof(unsigned long long),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(counts));
+
+    // Rank probabilities of random 32x32 matrices over GF(2)
+    const double probabilities[3] = { 0.2887880951, 0.5775761902, 0.1336357147 };
+    double chi_square = 0.0;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        const double expected = matrices * probabilities[i];
+        const double difference = host_counts[i] - expected;
+        chi_square += difference * difference / expected;
+    }
+    const double p = chi_square_p(chi_square, 2.0);
+    EXPECT_GT(p, p_min) << "where chi_square = " << chi_square;
+}
+
+TEST(rocrand_statistical_tests, gap_test)
+{
+    const unsigned int bins = 17;
+    const size_t draws_per_thread = 4096;
+
+    unsigned long long * histogram;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&histogram), bins * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(histogram, 0, bins * sizeof(unsigned long long)));
+
+    hipLaunchKernelGGL(gap_kernel, dim3(blocks), dim3(threads), 0, 0,
+                       histogram, bins, draws_per_thread, 0x87654321ULL);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned long long> host_histogram(bins);
+    HIP_CHECK(hipMemcpy(host_histogram.data(), histogram,
+                        bins * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(histogram));
+
+    double gaps = 0.0;
+    for(unsigned int i = 0; i < bins; i++)
+    {
+        gaps += host_histogram[i];
+    }
+
+    // A gap of length k has probability 2^-(k + 1); the last bin
+    // collects the tail
+    double chi_square = 0.0;
+    for(unsigned int i = 0; i < bins; i++)
+    {
+        const double probability =
+            i < bins - 1 ? std::ldexp(1.0, -static_cast<int>(i) - 1)
+                         : std::ldexp(1.0, -static_cast<int>(bins) + 1);
+        const double expected = gaps * probability;
+        const double difference = host_histogram[i] - expected;
+        chi_square += difference * difference / expected;
+    }
+    const double p = chi_square_p(chi_square, bins - 1.0);
+    EXPECT_GT(p, p_min) << "where chi_square = " << chi_square;
+}
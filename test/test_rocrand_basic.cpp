@@ -18,7 +18,13 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -52,6 +58,50 @@ TEST_P(rocrand_basic_tests, rocrand_create_destroy_generator_test)
     ROCRAND_CHECK(rocrand_destroy_generator(g));
 }
 
+TEST_P(rocrand_basic_tests, rocrand_create_generator_entropy_seeded_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator  g    = NULL;
+    unsigned long long seed = 0;
+    ROCRAND_CHECK(rocrand_create_generator_entropy_seeded(&g, rng_type, &seed));
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data0.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // The reported seed reproduces the run on a regularly created
+    // generator; quasi-random types have no seed and start in their
+    // initial state either way
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    const rocrand_status status = rocrand_set_seed(g, seed);
+    EXPECT_TRUE(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ASSERT_EQ(host_data0, host_data1);
+
+    HIP_CHECK(hipFree(data));
+
+    // The seed pointer is optional
+    ROCRAND_CHECK(rocrand_create_generator_entropy_seeded(&g, rng_type, NULL));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
 TEST_P(rocrand_basic_tests, rocrand_set_stream_test)
 {
     const rocrand_rng_type rng_type = GetParam();
@@ -83,6 +133,3222 @@ TEST_P(rocrand_basic_tests, rocrand_initialize_generator_test)
     ROCRAND_CHECK(rocrand_destroy_generator(g));
 }
 
+TEST_P(rocrand_basic_tests, rocrand_set_ordering_dynamic_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const bool quasi = rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                       || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                       || rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                       || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                       || rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN
+                       || rng_type == ROCRAND_RNG_QUASI_HALTON
+                       || rng_type == ROCRAND_RNG_QUASI_LATTICE;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    const rocrand_status status = rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DYNAMIC);
+    if(quasi)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    else
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_SUCCESS);
+
+        const size_t  size = 12563;
+        unsigned int* data;
+        HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_ordering_fastest_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const bool quasi = rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                       || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                       || rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                       || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                       || rng_type == ROCRAND_RNG_QUASI_SOBOL32_OWEN
+                       || rng_type == ROCRAND_RNG_QUASI_HALTON
+                       || rng_type == ROCRAND_RNG_QUASI_LATTICE;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    const rocrand_status status = rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_FASTEST);
+    if(quasi)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    else
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_SUCCESS);
+
+        const size_t  size = 12563;
+        unsigned int* data;
+        HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_ordering_device_independent_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const bool supports_it = rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+                             || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_32_20
+                             || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+                             || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+                             || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+                             || rng_type == ROCRAND_RNG_PSEUDO_PCG64
+                             || rng_type == ROCRAND_RNG_PSEUDO_CHACHA20
+                             || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+                             || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_13
+                             || rng_type == ROCRAND_RNG_PSEUDO_SQUARES32
+                             || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    const rocrand_status status
+        = rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT);
+    if(!supports_it)
+    {
+        EXPECT_EQ(status, ROCRAND_STATUS_OUT_OF_RANGE);
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+    EXPECT_EQ(status, ROCRAND_STATUS_SUCCESS);
+
+    // A multiple of four so the second launch starts on an application
+    // boundary for every output width
+    const size_t  size = 12564;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The whole span generated in one launch as reference; the launch
+    // covers 2 * size values, so its grid differs from the half launches
+    std::vector<unsigned int> reference(2 * size);
+    ROCRAND_CHECK(rocrand_generate(g, data, 2 * size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Two half-sized launches produce the same values at the same
+    // indices; under the default ordering they would not, because the
+    // output layout would follow the changed grid
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data + size, size));
+
+    std::vector<unsigned int> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < 2 * size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_statistics_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_statistics_enabled(g, 1), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_get_statistics(g, NULL), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_get_statistics(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Collection is off by default
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    rocrand_stats stats;
+    ROCRAND_CHECK(rocrand_get_statistics(g, &stats));
+    EXPECT_EQ(stats.kernel_launches, 0ULL);
+    EXPECT_EQ(stats.bytes_generated, 0ULL);
+
+    ROCRAND_CHECK(rocrand_set_statistics_enabled(g, 1));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_get_statistics(g, &stats));
+    EXPECT_EQ(stats.kernel_launches, 2ULL);
+    EXPECT_EQ(stats.bytes_generated, 2ULL * size * sizeof(unsigned int));
+    EXPECT_GT(stats.kernel_time_ms, 0.0);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_dump_latency_histogram_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_dump_latency_histogram(g, stdout), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_dump_latency_histogram(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_set_statistics_enabled(g, 1));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    FILE* out = tmpfile();
+    ASSERT_NE(out, nullptr);
+    ROCRAND_CHECK(rocrand_dump_latency_histogram(g, out));
+
+    // The completed launches must show up as timed entries
+    rewind(out);
+    char header[128] = {};
+    ASSERT_NE(fgets(header, sizeof(header), out), nullptr);
+    unsigned long long timed    = 0;
+    size_t             in_flight = 0;
+    ASSERT_EQ(sscanf(header,
+                          "rocrand latency histogram: %llu timed launches, %zu still in flight",
+                          &timed,
+                          &in_flight),
+              2);
+    EXPECT_EQ(timed + in_flight, 2ULL);
+    fclose(out);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_set_profiling_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_profiling(g, 1), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generation must behave identically with the annotations on,
+    // whether or not a profiler (and roctx) is present
+    ROCRAND_CHECK(rocrand_set_profiling(g, 1));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_set_profiling(g, 0));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_sobol32_extended_dimensions_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_set_quasi_random_generator_dimensions(g, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Dimensions beyond the precomputed table are constructed on demand
+    const unsigned int dimensions = 20010;
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    const size_t size = dimensions * 2;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The second value of every dimension of an unshifted Sobol
+    // sequence is the first direction vector, which is never zero
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(unsigned int d = dimensions - 8; d < dimensions; d++)
+    {
+        EXPECT_NE(host_data[d * 2 + 1], 0U) << "dimension " << d;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Other quasi-random generators keep the precomputed-table cap
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32));
+    EXPECT_EQ(rocrand_set_quasi_random_generator_dimensions(g, dimensions),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_sobol32_owen_seed_test)
+{
+    const unsigned int dimensions = 8;
+    const size_t       size       = dimensions * 256;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32_OWEN));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+
+    // The seed selects the Owen permutation; the same seed must
+    // reproduce the same sequence, a different seed must not
+    ROCRAND_CHECK(rocrand_set_seed(g, 123456789ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data0.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(rocrand_set_seed(g, 123456789ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    EXPECT_EQ(host_data0, host_data1);
+
+    ROCRAND_CHECK(rocrand_set_seed(g, 987654321ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    EXPECT_NE(host_data0, host_data1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Unscrambled Sobol still does not accept a seed
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_set_seed(g, 123456789ULL), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_skipahead_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_skipahead(g, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_skipahead(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t             size = 12563;
+    const unsigned long long skip = 1ULL << 36;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data_offset(size);
+    std::vector<unsigned int> host_data_skipped(size);
+
+    // Skipping ahead from the start must match setting the offset
+    const rocrand_rng_type skip_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                           ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                           ROCRAND_RNG_QUASI_SOBOL32};
+    for(const rocrand_rng_type rng_type : skip_types)
+    {
+        SCOPED_TRACE(testing::Message() << "rng_type = " << rng_type);
+
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_set_offset(g, skip));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(host_data_offset.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_skipahead(g, skip));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(host_data_skipped.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        ASSERT_EQ(host_data_offset, host_data_skipped);
+    }
+
+    // Skipping ahead composes with previous generate calls
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_skipahead(g, skip));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_skipped.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_offset(g, size + skip));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_offset.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ASSERT_EQ(host_data_offset, host_data_skipped);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_partition_sequence_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_partition_sequence(g, 0, 4, 100), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_partition_sequence(g, 0, 0, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_partition_sequence(g, 4, 4, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    // A hint larger than a rank's slice of the offset space would
+    // overlap the next rank
+    EXPECT_EQ(rocrand_partition_sequence(g, 0, 2, ~0ULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_LFSR113));
+    EXPECT_EQ(rocrand_partition_sequence(g, 0, 4, 100), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 12563;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data_rank0(size);
+    std::vector<unsigned int> host_data_rank1(size);
+    std::vector<unsigned int> host_data_plain(size);
+
+    const rocrand_rng_type partition_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                ROCRAND_RNG_PSEUDO_XORWOW,
+                                                ROCRAND_RNG_PSEUDO_MRG32K3A};
+    for(const rocrand_rng_type rng_type : partition_types)
+    {
+        SCOPED_TRACE(testing::Message() << "rng_type = " << rng_type);
+
+        // Rank 0 draws the start of the unpartitioned sequence
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_partition_sequence(g, 0, 4, size));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(host_data_rank0.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(host_data_plain.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        ASSERT_EQ(host_data_rank0, host_data_plain);
+
+        // Another rank's stream does not repeat rank 0's
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_partition_sequence(g, 1, 4, size));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(host_data_rank1.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        ASSERT_NE(host_data_rank0, host_data_rank1);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_quasi_layout_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_quasi_random_generator_layout(g, ROCRAND_QUASI_LAYOUT_POINT_MAJOR),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_quasi_random_generator_layout(g, ROCRAND_QUASI_LAYOUT_POINT_MAJOR),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const unsigned int dimensions = 5;
+    const size_t       size       = dimensions * 100;
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    EXPECT_EQ(rocrand_set_quasi_random_generator_layout(g, static_cast<rocrand_quasi_layout>(0)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> dimension_major(size);
+    std::vector<unsigned int> point_major(size);
+
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(dimension_major.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(rocrand_set_offset(g, 0));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_layout(g, ROCRAND_QUASI_LAYOUT_POINT_MAJOR));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(point_major.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // The point-major output is the transpose of the dimension-major output
+    const size_t points = size / dimensions;
+    for(size_t i = 0; i < points; i++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(point_major[i * dimensions + d], dimension_major[d * points + i])
+                << "point " << i << " dimension " << d;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_quasi_blocked_layout_test)
+{
+    const unsigned int dimensions        = 301;
+    const unsigned int padded_dimensions = 512;
+    const size_t       points            = 32768;
+    const size_t       padded_points     = 1024;
+    const size_t       size              = points * dimensions;
+    const size_t       padded_size       = padded_points * padded_dimensions;
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> dimension_major(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(dimension_major.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(rocrand_set_offset(g, 0));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_layout(g, ROCRAND_QUASI_LAYOUT_BLOCKED));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    std::vector<unsigned int> blocked(size);
+    HIP_CHECK(hipMemcpy(blocked.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    // The tile width is sized to the device's L2 cache; recover it from
+    // the run of dimension-0 values opening the first tile
+    size_t width = 0;
+    while(width < points && blocked[width] == dimension_major[width])
+    {
+        width++;
+    }
+    ASSERT_GT(width, 0u);
+    ASSERT_TRUE(width == points || (width & (width - 1)) == 0) << "width " << width;
+
+    // The blocked output is the dimension-major output retiled
+    for(size_t i = 0; i < points; i++)
+    {
+        const size_t tile_start = (i / width) * width;
+        const size_t w          = std::min(width, points - tile_start);
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(blocked[tile_start * dimensions + d * w + (i - tile_start)],
+                      dimension_major[d * points + i])
+                << "point " << i << " dimension " << d;
+        }
+    }
+
+    // With padding the tiles are laid out with a power-of-two dimension
+    // stride and the length counts the padded values
+    ROCRAND_CHECK(rocrand_set_offset(g, 0));
+    ROCRAND_CHECK(
+        rocrand_set_quasi_random_generator_layout(g, ROCRAND_QUASI_LAYOUT_BLOCKED_PADDED));
+    EXPECT_EQ(rocrand_generate(g, data, dimensions), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    ROCRAND_CHECK(rocrand_generate(g, data, padded_size));
+    std::vector<unsigned int> padded(padded_size);
+    HIP_CHECK(
+        hipMemcpy(padded.data(), data, padded_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    size_t padded_width = 0;
+    while(padded_width < padded_points && padded[padded_width] == dimension_major[padded_width])
+    {
+        padded_width++;
+    }
+    ASSERT_GT(padded_width, 0u);
+
+    for(size_t i = 0; i < padded_points; i++)
+    {
+        const size_t tile_start = (i / padded_width) * padded_width;
+        const size_t w          = std::min(padded_width, padded_points - tile_start);
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(padded[tile_start * padded_dimensions + d * w + (i - tile_start)],
+                      dimension_major[d * points + i])
+                << "point " << i << " dimension " << d;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_quasi_replicates_test)
+{
+    const unsigned int dimensions   = 4;
+    const size_t       size         = dimensions * 256;
+    const unsigned int n_replicates = 3;
+    const unsigned long long seeds[n_replicates] = {1ULL, 2ULL, 1ULL};
+
+    rocrand_generator g    = NULL;
+    float*            data = NULL;
+    EXPECT_EQ(rocrand_generate_quasi_replicates(g, data, size, n_replicates, seeds),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only the Owen-scrambled type has per-seed scrambling
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_replicates * size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(rocrand_generate_quasi_replicates(g, data, size, n_replicates, seeds),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32_OWEN));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    EXPECT_EQ(rocrand_generate_quasi_replicates(g, data, size, 0, seeds),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_quasi_replicates(g, data, size, n_replicates, seeds));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_replicates * size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        n_replicates * size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Equal seeds must reproduce the same replicate, different seeds must not
+    size_t matches01 = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_data[2 * size + i]) << "at " << i;
+        matches01 += host_data[i] == host_data[size + i] ? 1 : 0;
+    }
+    EXPECT_LT(matches01, size);
+
+    // A replicate must match a generator seeded with the replicate's seed
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32_OWEN));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    ROCRAND_CHECK(rocrand_set_seed(g, seeds[1]));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+
+    std::vector<float> host_data_seeded(size);
+    HIP_CHECK(hipMemcpy(host_data_seeded.data(),
+                        data,
+                        size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data_seeded[i], host_data[size + i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_halton_test)
+{
+    const unsigned int dimensions = 2;
+    const size_t       size       = 512;
+    const size_t       n          = size / dimensions;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_HALTON));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // The Halton sequence is the radical inverse of the point index in
+    // the dimension's prime base (2, 3, ...), as a fixed point fraction
+    const unsigned int bases[dimensions] = {2, 3};
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            const unsigned int base      = bases[d];
+            const double       inv_base  = 1.0 / base;
+            double             factor    = inv_base;
+            double             value     = 0.0;
+            size_t             index     = i;
+            while(index > 0)
+            {
+                value += static_cast<double>(index % base) * factor;
+                index /= base;
+                factor *= inv_base;
+            }
+            const unsigned int expected = static_cast<unsigned int>(value * 4294967296.0);
+            ASSERT_EQ(host_data[d * n + i], expected) << "at " << i << ", dimension " << d;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_lattice_test)
+{
+    const unsigned int dimensions = 3;
+    const size_t       size       = 3 * 256;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_LATTICE));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 2 * size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+    // Two consecutive generate calls cover points 0..511 of the sequence
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data + size, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        2 * size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    for(size_t i = 0; i < 2 * size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f) << "at " << i;
+        ASSERT_LE(host_data[i], 1.0f) << "at " << i;
+    }
+
+    // A generator whose offset points at the second batch must
+    // reproduce it, so consecutive calls continue the sequence
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_LATTICE));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    ROCRAND_CHECK(rocrand_set_offset(g, size / dimensions));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data_offset(size);
+    HIP_CHECK(hipMemcpy(host_data_offset.data(),
+                        data,
+                        size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data_offset[i], host_data[size + i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_scrambled_sobol64_incremental_test)
+{
+    // Incremental draws resume device-resident engine states; they must
+    // produce exactly the points a single larger draw produces
+    const unsigned int dimensions = 3;
+    const size_t       batch_n    = 250;
+    const size_t       batches    = 4;
+    const size_t       n          = batch_n * batches;
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              dimensions * n * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_incremental(batches * dimensions * batch_n);
+    for(size_t b = 0; b < batches; b++)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform(g, data, dimensions * batch_n));
+        HIP_CHECK(hipMemcpy(host_incremental.data() + b * dimensions * batch_n,
+                            data,
+                            dimensions * batch_n * sizeof(float),
+                            hipMemcpyDeviceToHost));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, dimensions * n));
+
+    std::vector<float> host_data(dimensions * n);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        dimensions * n * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Both layouts are dimension-major within their own call
+    for(size_t b = 0; b < batches; b++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            for(size_t i = 0; i < batch_n; i++)
+            {
+                ASSERT_EQ(host_incremental[b * dimensions * batch_n + d * batch_n + i],
+                          host_data[d * n + b * batch_n + i])
+                    << "at " << i << ", dimension " << d << ", batch " << b;
+            }
+        }
+    }
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_uniform_float_double_test)
+{
+    const unsigned int dimensions = 2;
+    const size_t       size       = 512;
+
+    float*  float_data  = NULL;
+    double* double_data = NULL;
+    EXPECT_EQ(rocrand_generate_uniform_float_double(NULL, float_data, double_data, size),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&float_data), size * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&double_data), size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(rocrand_generate_uniform_float_double(g, float_data, double_data, size),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    EXPECT_EQ(rocrand_generate_uniform_float_double(g, NULL, double_data, size),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_uniform_float_double(g, float_data, double_data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float>  host_float(size);
+    std::vector<double> host_double(size);
+    HIP_CHECK(hipMemcpy(host_float.data(),
+                        float_data,
+                        size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_double.data(),
+                        double_data,
+                        size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Both views must equal what separate calls from the same offset produce
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(g, dimensions));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate_uniform(g, float_data, size));
+    ROCRAND_CHECK(rocrand_set_offset(g, 0));
+    ROCRAND_CHECK(rocrand_generate_uniform_double(g, double_data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float>  host_float_single(size);
+    std::vector<double> host_double_single(size);
+    HIP_CHECK(hipMemcpy(host_float_single.data(),
+                        float_data,
+                        size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_double_single.data(),
+                        double_data,
+                        size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_float[i], host_float_single[i]) << "at " << i;
+        ASSERT_EQ(host_double[i], host_double_single[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(float_data));
+    HIP_CHECK(hipFree(double_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_concurrent_generation_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_concurrent_generation(g, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    // Generators whose state lives in a per-thread device array do not
+    // support concurrent generation
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_concurrent_generation(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 12563;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 3 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Three sequential segments of the sequence as the reference
+    std::vector<unsigned int> reference(3 * size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data + size, size));
+    ROCRAND_CHECK(rocrand_generate(g, data + 2 * size, size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        3 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Two threads fill two buffers concurrently; each call claims one
+    // of the first two segments, in arrival order
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_concurrent_generation(g, 1));
+
+    rocrand_status statuses[2] = {ROCRAND_STATUS_SUCCESS, ROCRAND_STATUS_SUCCESS};
+    std::thread threads[2];
+    for(int t = 0; t < 2; t++)
+    {
+        threads[t] = std::thread(
+            [&, t]() { statuses[t] = rocrand_generate(g, data + t * size, size); });
+    }
+    for(int t = 0; t < 2; t++)
+    {
+        threads[t].join();
+        ROCRAND_CHECK(statuses[t]);
+    }
+
+    std::vector<unsigned int> host_data(3 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    const bool in_order = host_data[0] == reference[0];
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[(in_order ? 0 : size) + i]) << "at " << i;
+        ASSERT_EQ(host_data[size + i], reference[(in_order ? size : 0) + i]) << "at " << i;
+    }
+
+    // Disabling the mode folds the claims back into the generator, so
+    // sequential generation continues with the third segment
+    ROCRAND_CHECK(rocrand_set_concurrent_generation(g, 0));
+    ROCRAND_CHECK(rocrand_generate(g, data + 2 * size, size));
+    HIP_CHECK(hipMemcpy(host_data.data() + 2 * size,
+                        data + 2 * size,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[2 * size + i], reference[2 * size + i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_resident_states_test)
+{
+    EXPECT_EQ(rocrand_set_resident_states(NULL, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_resident_states(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 16384;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 11111ULL));
+    ROCRAND_CHECK(rocrand_set_resident_states(g, 1));
+
+    std::vector<unsigned int> first(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(first.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    // The states advance in place, so a second fill continues the
+    // threads' subsequences
+    std::vector<unsigned int> second(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(second.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(first[i] == second[i])
+        {
+            same++;
+        }
+    }
+    EXPECT_LT(same, size / 16);
+
+    // Typed distributions run through the same path
+    float* float_data = reinterpret_cast<float*>(data);
+    ROCRAND_CHECK(rocrand_generate_uniform(g, float_data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<float> host_floats(size);
+    HIP_CHECK(
+        hipMemcpy(host_floats.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    double sum = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_floats[i], 0.0f);
+        ASSERT_LE(host_floats[i], 1.0f);
+        sum += host_floats[i];
+    }
+    EXPECT_NEAR(sum / size, 0.5, 0.05);
+
+    // Resident fills are reproducible for a given seed
+    rocrand_generator h;
+    ROCRAND_CHECK(rocrand_create_generator(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 11111ULL));
+    ROCRAND_CHECK(rocrand_set_resident_states(h, 1));
+    std::vector<unsigned int> replay(size);
+    ROCRAND_CHECK(rocrand_generate(h, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(replay.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ASSERT_EQ(replay, first);
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    // The regular sequence is not consumed by resident fills, so
+    // disabling the mode starts it from the top
+    ROCRAND_CHECK(rocrand_set_resident_states(g, 0));
+    std::vector<unsigned int> regular(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(regular.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 11111ULL));
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(reference.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ASSERT_EQ(regular, reference);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_graph_capture_test)
+{
+    const size_t size = 16384;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 22222ULL));
+    ROCRAND_CHECK(rocrand_set_resident_states(g, 1));
+    ROCRAND_CHECK(rocrand_set_stream(g, stream));
+
+    // Warmed up, the captured call performs no allocations
+    rocrand_call_descriptor call;
+    call.kind   = ROCRAND_CALL_UNIFORM_INT;
+    call.size   = size;
+    call.lambda = 0.0;
+    ROCRAND_CHECK(rocrand_warmup(g, &call, 1));
+
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    hipGraphExec_t graph_exec;
+    HIP_CHECK(hipGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+
+    std::vector<unsigned int> replay0(size);
+    std::vector<unsigned int> replay1(size);
+    HIP_CHECK(hipGraphLaunch(graph_exec, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(
+        hipMemcpy(replay0.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipGraphLaunch(graph_exec, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(
+        hipMemcpy(replay1.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    // The resident states advance in place, so the replays continue the
+    // sequence exactly as uncaptured calls after the same warm-up would
+    rocrand_generator h;
+    ROCRAND_CHECK(rocrand_create_generator(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 22222ULL));
+    ROCRAND_CHECK(rocrand_set_resident_states(h, 1));
+    ROCRAND_CHECK(rocrand_warmup(h, &call, 1));
+
+    std::vector<unsigned int> expected0(size);
+    std::vector<unsigned int> expected1(size);
+    ROCRAND_CHECK(rocrand_generate(h, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(expected0.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_generate(h, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(expected1.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ASSERT_EQ(replay0, expected0);
+    ASSERT_EQ(replay1, expected1);
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    HIP_CHECK(hipGraphExecDestroy(graph_exec));
+    HIP_CHECK(hipGraphDestroy(graph));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_generator_pool_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator_pool pool = NULL;
+    rocrand_generator      g    = NULL;
+    EXPECT_EQ(rocrand_acquire_generator(pool, &g, 1ULL), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_create_generator_pool(NULL, rng_type), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_create_generator_pool(&pool, rng_type));
+    EXPECT_EQ(rocrand_acquire_generator(pool, NULL, 1ULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+
+    // An acquired generator behaves like a freshly created and seeded one
+    ROCRAND_CHECK(rocrand_acquire_generator(pool, &g, 1ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data0.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_release_generator(pool, g));
+
+    // A recycled generator with the same seed reproduces the sequence
+    ROCRAND_CHECK(rocrand_acquire_generator(pool, &g, 1ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data1.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_release_generator(pool, g));
+    ASSERT_EQ(host_data0, host_data1);
+
+    // Acquiring twice hands out two distinct generators
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_acquire_generator(pool, &g0, 1ULL));
+    ROCRAND_CHECK(rocrand_acquire_generator(pool, &g1, 2ULL));
+    EXPECT_NE(g0, g1);
+    ROCRAND_CHECK(rocrand_release_generator(pool, g0));
+    ROCRAND_CHECK(rocrand_release_generator(pool, g1));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator_pool(pool));
+
+    // Releasing into a pool of a different type is rejected
+    const rocrand_rng_type other_type = rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+                                            ? ROCRAND_RNG_PSEUDO_XORWOW
+                                            : ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    ROCRAND_CHECK(rocrand_create_generator_pool(&pool, other_type));
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_release_generator(pool, g), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator_pool(pool));
+}
+
+TEST(rocrand_basic_tests, rocrand_workspace_test)
+{
+    rocrand_generator g = NULL;
+    size_t workspace_size;
+    EXPECT_EQ(rocrand_get_workspace_size(g, &workspace_size), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_set_workspace(g, NULL, 0), ROCRAND_STATUS_NOT_CREATED);
+
+    // Counter-based generators keep no persistent device state and do
+    // not use a workspace
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_get_workspace_size(g, &workspace_size), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_set_workspace(g, NULL, 0), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The sequence of a generator with its own allocations as reference
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_get_workspace_size(g, &workspace_size));
+    EXPECT_GT(workspace_size, 0u);
+    EXPECT_EQ(rocrand_get_workspace_size(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    void* workspace;
+    HIP_CHECK(hipMallocHelper(&workspace, workspace_size));
+
+    // A workspace smaller than reported is rejected
+    EXPECT_EQ(rocrand_set_workspace(g, workspace, workspace_size - 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // A generator running in caller memory produces the same sequence
+    ROCRAND_CHECK(rocrand_set_workspace(g, workspace, workspace_size));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    // Returning to an internal allocation restarts the (unseeded)
+    // sequence in memory the generator owns; the workspace can be freed
+    ROCRAND_CHECK(rocrand_set_workspace(g, NULL, 0));
+    HIP_CHECK(hipFree(workspace));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_state_checkpoint_test)
+{
+    rocrand_generator g = NULL;
+    size_t state_size;
+    EXPECT_EQ(rocrand_get_state_size(g, &state_size), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_save_state(g, NULL, 0), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_load_state(g, NULL, 0), ROCRAND_STATUS_NOT_CREATED);
+
+    // Counter-based generators rebuild from the seed instantly and do
+    // not support checkpoints
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_get_state_size(g, &state_size), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MT19937));
+    ROCRAND_CHECK(rocrand_set_seed(g, 45678ULL));
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    EXPECT_GT(state_size, 0u);
+    EXPECT_EQ(rocrand_get_state_size(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Snapshot mid-sequence, then generate the values the restored
+    // generator must reproduce
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    std::vector<unsigned char> checkpoint(state_size);
+    EXPECT_EQ(rocrand_save_state(g, checkpoint.data(), state_size - 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_save_state(g, checkpoint.data(), state_size));
+
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // A fresh generator restored from the checkpoint continues the
+    // sequence from where it was taken, regardless of its own seed
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MT19937));
+    ROCRAND_CHECK(rocrand_set_seed(g, 999ULL));
+    ROCRAND_CHECK(rocrand_load_state(g, checkpoint.data(), state_size));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_stream_test)
+{
+    rocrand_stream stream = NULL;
+    EXPECT_EQ(rocrand_stream_read(stream), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_stream_close(stream), ROCRAND_STATUS_NOT_CREATED);
+
+    const size_t chunk_size = 12563;
+    const size_t chunks     = 4;
+
+    unsigned int* sink;
+    HIP_CHECK(hipHostMalloc(reinterpret_cast<void**>(&sink), chunk_size * sizeof(unsigned int)));
+
+    EXPECT_EQ(rocrand_stream_open(&stream, NULL, sink, chunk_size), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_stream_open(NULL, g, sink, chunk_size), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_stream_open(&stream, g, NULL, chunk_size), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_stream_open(&stream, g, sink, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // The same span of the sequence generated in one go as reference
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              chunks * chunk_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> reference(chunks * chunk_size);
+    ROCRAND_CHECK(rocrand_generate(g, data, chunks * chunk_size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        chunks * chunk_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Reading the stream chunk by chunk replays the sequence
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_stream_open(&stream, g, sink, chunk_size));
+    for(size_t c = 0; c < chunks; c++)
+    {
+        ROCRAND_CHECK(rocrand_stream_read(stream));
+        for(size_t i = 0; i < chunk_size; i++)
+        {
+            ASSERT_EQ(sink[i], reference[c * chunk_size + i]) << "at " << c << ", " << i;
+        }
+    }
+    ROCRAND_CHECK(rocrand_stream_close(stream));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipHostFree(sink));
+}
+
+// Generator state and tables are allocated in the order of the
+// generator's stream; the whole lifecycle on a private stream must
+// produce the same values as on the default stream
+TEST(rocrand_basic_tests, rocrand_stream_ordered_alloc_test)
+{
+    const rocrand_rng_type types[] = { ROCRAND_RNG_PSEUDO_MTGP32,
+                                       ROCRAND_RNG_PSEUDO_MT19937,
+                                       ROCRAND_RNG_QUASI_SOBOL32 };
+
+    const size_t  size = 12564;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(const rocrand_rng_type type : types)
+    {
+        rocrand_generator g;
+        std::vector<unsigned int> reference(size);
+        ROCRAND_CHECK(rocrand_create_generator(&g, type));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipMemcpy(reference.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        hipStream_t stream;
+        HIP_CHECK(hipStreamCreate(&stream));
+        ROCRAND_CHECK(rocrand_create_generator(&g, type));
+        ROCRAND_CHECK(rocrand_set_stream(g, stream));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(host_data[i], reference[i]) << "at " << i << " for type " << type;
+        }
+
+        // Destruction frees the state in the stream's order; the stream
+        // outlives the generator
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_prefetch_test)
+{
+    EXPECT_EQ(rocrand_set_prefetch(NULL, 4000), ROCRAND_STATUS_NOT_CREATED);
+    unsigned int* chunk_ptr;
+    EXPECT_EQ(rocrand_acquire_buffer(NULL, &chunk_ptr), ROCRAND_STATUS_NOT_CREATED);
+
+    const size_t chunk_size = 4000;
+    const size_t extra      = 1111;
+    // The cache runs two chunks ahead; by the time the mismatched call
+    // below is made, six chunks have been generated
+    const size_t reference_size = 6 * chunk_size + extra;
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_acquire_buffer(g, &chunk_ptr), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // The same span of the sequence generated in one go as reference
+    unsigned int* data;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&data), reference_size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, reference_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> reference(reference_size);
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        reference_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_prefetch(g, chunk_size));
+    EXPECT_EQ(rocrand_acquire_buffer(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Matching generates consume the chunks generated ahead in order
+    std::vector<unsigned int> host_chunk(chunk_size);
+    for(size_t c = 0; c < 2; c++)
+    {
+        ROCRAND_CHECK(rocrand_generate(g, data, chunk_size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_chunk.data(),
+                            data,
+                            chunk_size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < chunk_size; i++)
+        {
+            ASSERT_EQ(host_chunk[i], reference[c * chunk_size + i]) << "at " << c << ", " << i;
+        }
+    }
+
+    // The zero-copy handoff serves the next chunk without the copy
+    ROCRAND_CHECK(rocrand_acquire_buffer(g, &chunk_ptr));
+    HIP_CHECK(hipMemcpy(host_chunk.data(),
+                        chunk_ptr,
+                        chunk_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < chunk_size; i++)
+    {
+        ASSERT_EQ(host_chunk[i], reference[2 * chunk_size + i]) << "at " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_generate(g, data, chunk_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(host_chunk.data(), data, chunk_size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < chunk_size; i++)
+    {
+        ASSERT_EQ(host_chunk[i], reference[3 * chunk_size + i]) << "at " << i;
+    }
+
+    // A call of a different size continues after the chunks generated
+    // ahead (two more chunks are in the buffers at this point)
+    ROCRAND_CHECK(rocrand_generate(g, data, extra));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> host_extra(extra);
+    HIP_CHECK(
+        hipMemcpy(host_extra.data(), data, extra * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < extra; i++)
+    {
+        ASSERT_EQ(host_extra[i], reference[6 * chunk_size + i]) << "at " << i;
+    }
+
+    // Disabling drains the refills in flight
+    ROCRAND_CHECK(rocrand_set_prefetch(g, 0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_uniform_partitioned_test)
+{
+    rocrand_generator g = NULL;
+    hipStream_t streams[3];
+    EXPECT_EQ(rocrand_generate_uniform_partitioned(g, NULL, 0, streams, 3),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Generators whose state lives in a per-thread device array cannot
+    // run extents concurrently
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_uniform_partitioned(g, NULL, 0, streams, 3),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 3 * 12564;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Under the device-independent ordering the values at each index do
+    // not depend on how the fill is split, so a single launch serves as
+    // the reference for the partitioned fill
+    std::vector<float> reference(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    HIP_CHECK(hipMemcpy(reference.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+    EXPECT_EQ(rocrand_generate_uniform_partitioned(g, data, size, NULL, 3),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_uniform_partitioned(g, data, size, streams, 0),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    for(int k = 0; k < 3; k++)
+    {
+        HIP_CHECK(hipStreamCreate(&streams[k]));
+    }
+    ROCRAND_CHECK(rocrand_generate_uniform_partitioned(g, data, size, streams, 3));
+    // The generator's stream has waited on all extents
+    HIP_CHECK(hipStreamSynchronize(0));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    for(int k = 0; k < 3; k++)
+    {
+        HIP_CHECK(hipStreamDestroy(streams[k]));
+    }
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_multi_gpu_test)
+{
+    EXPECT_EQ(rocrand_destroy_generator_multi_gpu(NULL), ROCRAND_STATUS_NOT_CREATED);
+
+    // Two shards on the available devices; doubled ids keep the test
+    // meaningful on a single-device node
+    int device_count = 0;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+    const int devices[2] = { 0, device_count > 1 ? 1 : 0 };
+    const size_t sizes[2] = { 12563, 7431 };
+    const size_t total = sizes[0] + sizes[1];
+
+    rocrand_generator_multi_gpu mg = NULL;
+    EXPECT_EQ(rocrand_create_generator_multi_gpu(&mg, ROCRAND_RNG_PSEUDO_XORWOW, devices, 2),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_create_generator_multi_gpu(&mg, ROCRAND_RNG_PSEUDO_PHILOX4_32_10, NULL, 2),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(
+        rocrand_create_generator_multi_gpu(&mg, ROCRAND_RNG_PSEUDO_PHILOX4_32_10, devices, 2));
+    ROCRAND_CHECK(rocrand_set_seed_multi_gpu(mg, 20222ULL));
+
+    unsigned int* outputs[2];
+    for(int k = 0; k < 2; k++)
+    {
+        HIP_CHECK(hipSetDevice(devices[k]));
+        HIP_CHECK(
+            hipMallocHelper(reinterpret_cast<void**>(&outputs[k]), sizes[k] * sizeof(unsigned int)));
+    }
+    HIP_CHECK(hipSetDevice(0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Two consecutive logical fills
+    std::vector<unsigned int> concatenated(2 * total);
+    for(int fill = 0; fill < 2; fill++)
+    {
+        ROCRAND_CHECK(rocrand_generate_multi_gpu(mg, outputs, sizes));
+        size_t offset = fill * total;
+        for(int k = 0; k < 2; k++)
+        {
+            HIP_CHECK(hipMemcpy(concatenated.data() + offset,
+                                outputs[k],
+                                sizes[k] * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            offset += sizes[k];
+        }
+    }
+
+    // The concatenation equals the single-device sequence
+    rocrand_generator g;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 2 * total * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 20222ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, 2 * total));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> reference(2 * total);
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        2 * total * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    for(size_t i = 0; i < 2 * total; i++)
+    {
+        ASSERT_EQ(concatenated[i], reference[i]) << "at " << i;
+    }
+
+    // Repositioning replays the first fill
+    ROCRAND_CHECK(rocrand_set_offset_multi_gpu(mg, 0));
+    ROCRAND_CHECK(rocrand_generate_multi_gpu(mg, outputs, sizes));
+    std::vector<unsigned int> replay(sizes[0]);
+    HIP_CHECK(hipMemcpy(replay.data(),
+                        outputs[0],
+                        sizes[0] * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < sizes[0]; i++)
+    {
+        ASSERT_EQ(replay[i], reference[i]) << "at " << i;
+    }
+
+    for(int k = 0; k < 2; k++)
+    {
+        HIP_CHECK(hipSetDevice(devices[k]));
+        HIP_CHECK(hipFree(outputs[k]));
+    }
+    HIP_CHECK(hipSetDevice(0));
+    ROCRAND_CHECK(rocrand_destroy_generator_multi_gpu(mg));
+}
+
+TEST(rocrand_basic_tests, rocrand_host_destination_test)
+{
+    const size_t size = 131072 + 13;
+
+    // Device-memory reference of the same seed
+    rocrand_generator g;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 34567ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(reference.data(), data,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+
+    // Pinned host destination: written directly by the kernels
+    unsigned int* pinned;
+    HIP_CHECK(hipHostMalloc(reinterpret_cast<void**>(&pinned), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 34567ULL));
+    ROCRAND_CHECK(rocrand_generate(g, pinned, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(pinned[i], reference[i]) << "at " << i;
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipHostFree(pinned));
+
+    // Pageable host destination: staged through an internal device
+    // buffer and complete when the call returns, with the same values
+    std::vector<unsigned int> pageable(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 34567ULL));
+    ROCRAND_CHECK(rocrand_generate(g, pageable.data(), size));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(pageable[i], reference[i]) << "at " << i;
+    }
+    // A fill split across two calls continues the sequence exactly
+    std::fill(pageable.begin(), pageable.end(), 0u);
+    ROCRAND_CHECK(rocrand_set_seed(g, 34567ULL));
+    ROCRAND_CHECK(rocrand_generate(g, pageable.data(), size / 2));
+    ROCRAND_CHECK(rocrand_generate(g, pageable.data() + size / 2, size - size / 2));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(pageable[i], reference[i]) << "at " << i;
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_record_event_query_test)
+{
+    EXPECT_EQ(rocrand_query(NULL), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_record_event(NULL, NULL), ROCRAND_STATUS_NOT_CREATED);
+
+    const size_t size = 1 << 22;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    // An idle generator reports completion
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(rocrand_query(g), ROCRAND_STATUS_SUCCESS);
+
+    // The event completes with the fill it was recorded after, so
+    // waiting on it implies the fill is done
+    hipEvent_t done;
+    HIP_CHECK(hipEventCreate(&done));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_record_event(g, done));
+    HIP_CHECK(hipEventSynchronize(done));
+    EXPECT_EQ(rocrand_query(g), ROCRAND_STATUS_SUCCESS);
+
+    HIP_CHECK(hipEventDestroy(done));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_poisson_table_registry_test)
+{
+    const size_t size = 12563;
+    const double lambdas[3] = {10.0, 100.0, 500.0};
+
+    // A single generator as the reference for the first lambda
+    rocrand_generator g;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 1ULL));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, lambdas[0]));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+
+    // Four threads with private generators draw from the same lambdas;
+    // the table registry is shared between them and the reference above
+    rocrand_status statuses[4];
+    std::vector<std::vector<unsigned int>> host_data(4, std::vector<unsigned int>(size));
+    std::thread threads[4];
+    for(int t = 0; t < 4; t++)
+    {
+        threads[t] = std::thread(
+            [&, t]()
+            {
+                rocrand_generator generator;
+                unsigned int* d;
+                statuses[t] = rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+                if(statuses[t] != ROCRAND_STATUS_SUCCESS)
+                    return;
+                statuses[t] = rocrand_set_seed(generator, 1ULL);
+                if(statuses[t] != ROCRAND_STATUS_SUCCESS)
+                    return;
+                if(hipMallocHelper(reinterpret_cast<void**>(&d), size * sizeof(unsigned int))
+                   != hipSuccess)
+                {
+                    statuses[t] = ROCRAND_STATUS_ALLOCATION_FAILED;
+                    return;
+                }
+                for(int l = 0; l < 3 && statuses[t] == ROCRAND_STATUS_SUCCESS; l++)
+                {
+                    statuses[t] = rocrand_generate_poisson(generator, d, size, lambdas[l]);
+                }
+                if(statuses[t] == ROCRAND_STATUS_SUCCESS
+                   && hipMemcpy(host_data[t].data(),
+                                d,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost)
+                          != hipSuccess)
+                {
+                    statuses[t] = ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                hipFree(d);
+                rocrand_destroy_generator(generator);
+            });
+    }
+    for(int t = 0; t < 4; t++)
+    {
+        threads[t].join();
+        ROCRAND_CHECK(statuses[t]);
+    }
+
+    // Shared tables produce the same values as privately built ones
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 1ULL));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, lambdas[0]));
+    std::vector<unsigned int> shared_data(size);
+    HIP_CHECK(hipMemcpy(shared_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(shared_data[i], reference[i]) << "at " << i;
+    }
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_poisson_lambda_switch_test)
+{
+    const size_t size = 12563;
+    const double lambdas[3] = {4.0, 40.0, 400.0};
+
+    rocrand_generator g;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Alternating between a fixed set of lambdas serves the switches
+    // from the manager's recent list; the values must keep following
+    // each lambda
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 313ULL));
+    std::vector<unsigned int> host_data(size);
+    for(int round = 0; round < 4; round++)
+    {
+        for(int l = 0; l < 3; l++)
+        {
+            ROCRAND_CHECK(rocrand_generate_poisson(g, data, size, lambdas[l]));
+            HIP_CHECK(hipMemcpy(host_data.data(),
+                                data,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            double sum = 0.0;
+            for(size_t i = 0; i < size; i++)
+            {
+                sum += host_data[i];
+            }
+            const double mean = sum / size;
+            EXPECT_NEAR(mean, lambdas[l], std::max(1.0, 0.05 * lambdas[l]))
+                << "lambda " << lambdas[l] << " round " << round;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_memory_info_trim_test)
+{
+    rocrand_generator g = NULL;
+    size_t state_bytes;
+    size_t reclaimable_bytes;
+    EXPECT_EQ(rocrand_get_memory_info(g, &state_bytes, &reclaimable_bytes),
+              ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_trim(g), ROCRAND_STATUS_NOT_CREATED);
+
+    // Quasi-random generators keep no reclaimable caches
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_get_memory_info(g, &state_bytes, &reclaimable_bytes),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_trim(g), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Two sequential segments without trimming as the reference
+    std::vector<unsigned int> reference(2 * size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data + size, size));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    // The engine states count as state, and nothing is cached yet
+    ROCRAND_CHECK(rocrand_get_memory_info(g, &state_bytes, &reclaimable_bytes));
+    EXPECT_GT(state_bytes, 0u);
+    EXPECT_EQ(reclaimable_bytes, 0u);
+
+    // A binomial draw builds tables that are reported as reclaimable
+    ROCRAND_CHECK(rocrand_generate_binomial(g, data, size, 100, 0.25));
+    ROCRAND_CHECK(rocrand_get_memory_info(g, NULL, &reclaimable_bytes));
+    EXPECT_GT(reclaimable_bytes, 0u);
+
+    // Trimming releases the tables but not the sequence position
+    ROCRAND_CHECK(rocrand_trim(g));
+    ROCRAND_CHECK(rocrand_get_memory_info(g, NULL, &reclaimable_bytes));
+    EXPECT_EQ(reclaimable_bytes, 0u);
+
+    ROCRAND_CHECK(rocrand_generate_binomial(g, data, size, 100, 0.25));
+    ROCRAND_CHECK(rocrand_get_memory_info(g, NULL, &reclaimable_bytes));
+    EXPECT_GT(reclaimable_bytes, 0u);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // A trim between two generate calls does not change the sequence
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_trim(g));
+    ROCRAND_CHECK(rocrand_generate(g, data + size, size));
+
+    std::vector<unsigned int> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < 2 * size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_table_upload_stream_test)
+{
+    const size_t size = 12563;
+
+    rocrand_generator g;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Tables built and consumed on the default stream as the reference
+    std::vector<unsigned int> reference(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate_binomial(g, data, size, 100, 0.25));
+    HIP_CHECK(hipMemcpy(reference.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // The table upload is issued asynchronously on the generator's
+    // stream, so the draw kernel on the same stream must see the
+    // complete tables
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_stream(g, stream));
+    ROCRAND_CHECK(rocrand_generate_binomial(g, data, size, 100, 0.25));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], reference[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_create_generator_async_test)
+{
+    EXPECT_EQ(rocrand_create_generator_async(NULL, static_cast<rocrand_rng_type>(0), NULL),
+              ROCRAND_STATUS_TYPE_ERROR);
+
+    const size_t size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The setup is enqueued on the stream, so a fill on the same stream
+    // sees the fully built engines and matches a synchronously created
+    // generator of the same seed
+    const rocrand_rng_type types[] = { ROCRAND_RNG_PSEUDO_MT19937, ROCRAND_RNG_PSEUDO_XORWOW };
+    for(const rocrand_rng_type type : types)
+    {
+        rocrand_generator g;
+        ROCRAND_CHECK(rocrand_create_generator(&g, type));
+        std::vector<unsigned int> reference(size);
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(reference.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+        hipStream_t stream;
+        HIP_CHECK(hipStreamCreate(&stream));
+        ROCRAND_CHECK(rocrand_create_generator_async(&g, type, stream));
+        ROCRAND_CHECK(rocrand_generate(g, data, size));
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        HIP_CHECK(hipStreamDestroy(stream));
+        ASSERT_EQ(host_data, reference) << "type " << type;
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+namespace {
+
+size_t counting_alloc_calls = 0;
+size_t counting_free_calls = 0;
+
+void* counting_alloc(size_t size, void* user_data)
+{
+    *static_cast<size_t*>(user_data) += 1;
+    void* ptr = NULL;
+    if(hipMalloc(&ptr, size) != hipSuccess)
+    {
+        return NULL;
+    }
+    return ptr;
+}
+
+void counting_free(void* ptr, void* /*user_data*/)
+{
+    counting_free_calls++;
+    (void)hipFree(ptr);
+}
+
+} // end anonymous namespace
+
+TEST(rocrand_basic_tests, rocrand_set_allocator_test)
+{
+    // Exactly one NULL callback is rejected
+    EXPECT_EQ(rocrand_set_allocator(counting_alloc, NULL, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_allocator(NULL, counting_free, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    counting_alloc_calls = 0;
+    counting_free_calls = 0;
+    ROCRAND_CHECK(rocrand_set_allocator(counting_alloc,
+                                        counting_free,
+                                        &counting_alloc_calls));
+
+    // XORWOW keeps its engines in device memory, so creating, using and
+    // destroying a generator must route every byte through the hooks
+    const size_t size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    EXPECT_GT(counting_alloc_calls, 0u);
+    EXPECT_EQ(counting_alloc_calls, counting_free_calls);
+
+    // Both NULL restores the default hipMalloc/hipFree pair
+    ROCRAND_CHECK(rocrand_set_allocator(NULL, NULL, NULL));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_math_mode_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_math_mode(g, ROCRAND_MATH_FAST),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_set_math_mode(g, static_cast<rocrand_math_mode>(12345)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_math_mode(g, ROCRAND_MATH_FAST));
+
+    // The fast path trades a few ulps per value, not distribution shape,
+    // so the sample moments must still match the requested ones
+    const size_t size = 131072;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 5.0f, 2.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+    double stddev = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        stddev += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    stddev = std::sqrt(stddev / size);
+    EXPECT_NEAR(mean, 5.0, 0.1);
+    EXPECT_NEAR(stddev, 2.0, 0.1);
+
+    // The mode may be changed between calls without resetting the state
+    ROCRAND_CHECK(rocrand_set_math_mode(g, ROCRAND_MATH_PRECISE));
+    ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 5.0f, 2.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_normal_method_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_normal_method(g, ROCRAND_NORMAL_METHOD_ZIGGURAT),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_normal_method(g, static_cast<rocrand_normal_method>(12345)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_normal_method(g, ROCRAND_NORMAL_METHOD_ZIGGURAT));
+
+    // The ziggurat consumes engine output differently than Box-Muller
+    // but draws from the same distribution, so the sample moments and
+    // the 3-sigma tail mass must match the requested parameters
+    const size_t size = 262144;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 0.0f, 1.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    size_t tail = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+        if(std::abs(host_data[i]) > 3.0f)
+        {
+            tail++;
+        }
+    }
+    mean /= size;
+    double stddev = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        stddev += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    stddev = std::sqrt(stddev / size);
+    EXPECT_NEAR(mean, 0.0, 0.02);
+    EXPECT_NEAR(stddev, 1.0, 0.02);
+    EXPECT_NEAR(static_cast<double>(tail) / size, 0.0027, 0.001);
+
+    // The method may be switched back between calls
+    ROCRAND_CHECK(rocrand_set_normal_method(g, ROCRAND_NORMAL_METHOD_BOX_MULLER));
+    ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 0.0f, 1.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_normal_method_double_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    const size_t size = 262144;
+    double* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(double)));
+
+    // Both double-precision methods draw from the same distribution as
+    // Box-Muller, so the sample moments and the 3-sigma tail mass must
+    // match the requested parameters for each of them
+    const rocrand_normal_method methods[]
+        = {ROCRAND_NORMAL_METHOD_MARSAGLIA_POLAR, ROCRAND_NORMAL_METHOD_DOUBLE_VIA_FLOAT};
+    for(size_t m = 0; m < 2; m++)
+    {
+        ROCRAND_CHECK(rocrand_set_normal_method(g, methods[m]));
+        ROCRAND_CHECK(rocrand_generate_normal_double(g, data, size, 0.0, 1.0));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<double> host_data(size);
+        HIP_CHECK(
+            hipMemcpy(host_data.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+
+        double mean = 0.0;
+        size_t tail = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            mean += host_data[i];
+            if(std::abs(host_data[i]) > 3.0)
+            {
+                tail++;
+            }
+        }
+        mean /= size;
+        double stddev = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            stddev += (host_data[i] - mean) * (host_data[i] - mean);
+        }
+        stddev = std::sqrt(stddev / size);
+        EXPECT_NEAR(mean, 0.0, 0.02) << "where method = " << methods[m];
+        EXPECT_NEAR(stddev, 1.0, 0.02) << "where method = " << methods[m];
+        EXPECT_NEAR(static_cast<double>(tail) / size, 0.0027, 0.001)
+            << "where method = " << methods[m];
+    }
+
+    // The methods may be switched back between calls
+    ROCRAND_CHECK(rocrand_set_normal_method(g, ROCRAND_NORMAL_METHOD_BOX_MULLER));
+    ROCRAND_CHECK(rocrand_generate_normal_double(g, data, size, 0.0, 1.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_error_mode_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_error_mode(g, ROCRAND_ERRORS_DEFERRED), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_query_status(g), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_error_mode(g, static_cast<rocrand_error_mode>(12345)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // In deferred mode generation calls skip the per-call launch poll;
+    // a clean run must still report success at the collection point
+    ROCRAND_CHECK(rocrand_set_error_mode(g, ROCRAND_ERRORS_DEFERRED));
+
+    const size_t size = 8192;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_query_status(g));
+
+    // The mode may be switched back between calls
+    ROCRAND_CHECK(rocrand_set_error_mode(g, ROCRAND_ERRORS_IMMEDIATE));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_fill_test)
+{
+    const size_t size = 8192;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+
+    // The fill calls manage the per-device default generator themselves;
+    // repeated calls must reuse it and continue its sequence
+    ROCRAND_CHECK(rocrand_fill_uniform(data, size, 0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+    }
+
+    // A second fill continues the default generator's sequence rather
+    // than restarting it
+    ROCRAND_CHECK(rocrand_fill_uniform(data, size, 0));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<float> host_data2(size);
+    HIP_CHECK(hipMemcpy(host_data2.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] == host_data2[i])
+        {
+            same++;
+        }
+    }
+    EXPECT_LT(same, size / 16);
+
+    // The stream is a per-call parameter
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    ROCRAND_CHECK(rocrand_fill(reinterpret_cast<unsigned int*>(data), size, stream));
+    ROCRAND_CHECK(rocrand_fill_normal(data, size, 0.0f, 1.0f, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(hipStreamDestroy(stream));
+
+    double* ddata;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&ddata), size * sizeof(double)));
+    ROCRAND_CHECK(rocrand_fill_uniform_double(ddata, size, 0));
+    ROCRAND_CHECK(rocrand_fill_normal_double(ddata, size, 0.0, 1.0, 0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(ddata));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_char_short_packing_test)
+{
+    // Char and short output slice each 32-bit engine draw into 4 and 2
+    // elements; a fill of 4n chars (2n shorts) must consume the same
+    // draws as a fill of n uints and contain the same bits
+    const size_t size = 8192;
+
+    unsigned int* uint_data;
+    unsigned char* char_data;
+    unsigned short* short_data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&uint_data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&char_data), 4 * size * sizeof(unsigned char)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&short_data), 2 * size * sizeof(unsigned short)));
+
+    rocrand_generator g;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_seed(g, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate(g, uint_data, size));
+
+    ROCRAND_CHECK(rocrand_set_seed(g, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate_char(g, char_data, 4 * size));
+
+    ROCRAND_CHECK(rocrand_set_seed(g, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate_short(g, short_data, 2 * size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_uint(size);
+    std::vector<unsigned int> host_char(size);
+    std::vector<unsigned int> host_short(size);
+    HIP_CHECK(hipMemcpy(host_uint.data(), uint_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_char.data(), char_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_short.data(), short_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_uint[i], host_char[i]) << "where index = " << i;
+        ASSERT_EQ(host_uint[i], host_short[i]) << "where index = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(uint_data));
+    HIP_CHECK(hipFree(char_data));
+    HIP_CHECK(hipFree(short_data));
+}
+
+TEST(rocrand_basic_tests, rocrand_persistent_mode_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_persistent_mode(g, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    // Only XORWOW implements the resident kernel
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_set_persistent_mode(g, 1), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_persistent_fence(g), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_persistent_mode(g, 1));
+
+    const size_t size = 4096;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipMemset(data, 0, size * sizeof(float)));
+
+    // Many small fills cost one descriptor each instead of one launch;
+    // the fence waits for the resident kernel, not for the stream
+    for(size_t offset = 0; offset < size; offset += 256)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform(g, data + offset, 256));
+    }
+    ROCRAND_CHECK(rocrand_persistent_fence(g));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f) << "where index = " << i;
+        ASSERT_LE(host_data[i], 1.0f) << "where index = " << i;
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    // Distributions the kernel does not understand still launch and the
+    // mode can be disabled and the generator used normally afterwards
+    unsigned int* idata;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&idata), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_poisson(g, idata, size, 10.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_set_persistent_mode(g, 0));
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(idata));
+}
+
+TEST(rocrand_basic_tests, rocrand_persistent_large_fills_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_persistent_mode(g, 1));
+
+    // Repeated same-size large fills: on devices with cooperative
+    // launch support the whole resident grid serves each one, so the
+    // distribution must hold at sizes far beyond one block's reach
+    const size_t size = 1 << 22;
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+
+    for(int iteration = 0; iteration < 4; iteration++)
+    {
+        ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 0.0f, 1.0f));
+    }
+    ROCRAND_CHECK(rocrand_persistent_fence(g));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+    double variance = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        variance += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    variance /= size;
+    EXPECT_NEAR(mean, 0.0, 0.01);
+    EXPECT_NEAR(variance, 1.0, 0.01);
+
+    ROCRAND_CHECK(rocrand_set_persistent_mode(g, 0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_at_test)
+{
+    const size_t size = 65536;
+
+    unsigned int* data;
+    unsigned int* data_at;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data_at), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The whole sequence generated sequentially
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // The same sequence assembled from positional fills in a different
+    // order; the generator never advances, so the order cannot matter
+    rocrand_generator g_at = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_at, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g_at, 54321ULL));
+
+    const size_t chunk = size / 4;
+    for(size_t c = 4; c-- > 0;)
+    {
+        ROCRAND_CHECK(rocrand_generate_at(g_at, c * chunk, data_at + c * chunk, chunk));
+    }
+    // Retrying a region must be idempotent
+    ROCRAND_CHECK(rocrand_generate_at(g_at, chunk, data_at + chunk, chunk));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data_at(size);
+    HIP_CHECK(hipMemcpy(host_data_at.data(),
+                        data_at,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data_at[i], host_data[i]) << "where index = " << i;
+    }
+
+    // Positional fills do not disturb sequential generation either:
+    // the sequential generator is still at position size
+    ROCRAND_CHECK(rocrand_generate_at(g, 0, data_at, chunk));
+    ROCRAND_CHECK(rocrand_generate(g, data, chunk));
+    HIP_CHECK(hipMemcpy(host_data_at.data(),
+                        data,
+                        chunk * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    rocrand_generator g_skip = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_skip, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g_skip, 54321ULL));
+    ROCRAND_CHECK(rocrand_skipahead(g_skip, size));
+    ROCRAND_CHECK(rocrand_generate(g_skip, data, chunk));
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        chunk * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < chunk; i++)
+    {
+        ASSERT_EQ(host_data_at[i], host_data[i]) << "where index = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator(g_at));
+    ROCRAND_CHECK(rocrand_destroy_generator(g_skip));
+
+    // A 64-bit engine emits two values per draw, so odd offsets do not
+    // fall on an output boundary
+    rocrand_generator g64 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g64, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20));
+    EXPECT_EQ(rocrand_generate_at(g64, 1, data_at, 2), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_at(g64, 2, data_at, 2));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(g64));
+
+    // State-array generators cannot position without mutation
+    rocrand_generator g_mtgp = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_mtgp, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_generate_at(g_mtgp, 0, data_at, 2), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g_mtgp));
+
+    EXPECT_EQ(rocrand_generate_at(NULL, 0, data_at, 2), ROCRAND_STATUS_NOT_CREATED);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_at));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_seeded_test)
+{
+    const size_t size = 4096;
+
+    unsigned int* data;
+    unsigned int* data2;
+    unsigned long long* seeds;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data2), size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&seeds), size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Adjacent elements share a seed, so they must receive equal values
+    std::vector<unsigned long long> host_seeds(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        host_seeds[i] = 0x9E3779B97F4A7C15ULL * (i / 2);
+    }
+    HIP_CHECK(hipMemcpy(seeds,
+                        host_seeds.data(),
+                        size * sizeof(unsigned long long),
+                        hipMemcpyHostToDevice));
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate_seeded(g, data, size, seeds));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i += 2)
+    {
+        ASSERT_EQ(host_data[i], host_data[i + 1]) << "where index = " << i;
+    }
+
+    // Reversing the seed array must reverse the outputs with it
+    std::vector<unsigned long long> reversed_seeds(host_seeds.rbegin(), host_seeds.rend());
+    HIP_CHECK(hipMemcpy(seeds,
+                        reversed_seeds.data(),
+                        size * sizeof(unsigned long long),
+                        hipMemcpyHostToDevice));
+    ROCRAND_CHECK(rocrand_generate_seeded(g, data2, size, seeds));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data2(size);
+    HIP_CHECK(hipMemcpy(host_data2.data(),
+                        data2,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data2[i], host_data[size - 1 - i]) << "where index = " << i;
+    }
+
+    // The generator's own seed does not participate: a generator with a
+    // different seed produces the same values for the same seed array
+    rocrand_generator g_other = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_other, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g_other, 999ULL));
+    ROCRAND_CHECK(rocrand_generate_seeded(g_other, data, size, seeds));
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_data2[i]) << "where index = " << i;
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g_other));
+
+    // Nor is generator state consumed: sequential generation after the
+    // seeded fills starts at the beginning of the sequence
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    rocrand_generator g_fresh = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_fresh, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g_fresh, 54321ULL));
+    ROCRAND_CHECK(rocrand_generate(g_fresh, data2, size));
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data2.data(),
+                        data2,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_data2[i]) << "where index = " << i;
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g_fresh));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // State-array generators cannot seed per element
+    rocrand_generator g_mtgp = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_mtgp, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_generate_seeded(g_mtgp, data, 2, seeds), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g_mtgp));
+
+    EXPECT_EQ(rocrand_generate_seeded(NULL, data, 2, seeds), ROCRAND_STATUS_NOT_CREATED);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data2));
+    HIP_CHECK(hipFree(seeds));
+}
+
+TEST(rocrand_basic_tests, rocrand_offset_resume_test)
+{
+    const size_t             size = 12563;
+    const unsigned long long skip = 1234;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data_resumed(size);
+    std::vector<unsigned int> host_data_fresh(size);
+
+    // Moving an already initialized generator to a later offset takes
+    // the delta-advance path and must match a fresh generator that was
+    // fully initialized at that offset
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_initialize_generator(g));
+    ROCRAND_CHECK(rocrand_set_offset(g, skip));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_resumed.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_offset(g, skip));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_fresh.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ASSERT_EQ(host_data_resumed, host_data_fresh);
+
+    // Consecutive set_offset calls without generating in between
+    // collapse into a single advance at the next generate
+    const unsigned long long skip2 = 5000000000ULL;
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_initialize_generator(g));
+    ROCRAND_CHECK(rocrand_set_offset(g, skip));
+    ROCRAND_CHECK(rocrand_initialize_generator(g));
+    ROCRAND_CHECK(rocrand_set_offset(g, skip2));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_resumed.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_offset(g, skip2));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_fresh.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ASSERT_EQ(host_data_resumed, host_data_fresh);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_clone_generator_test)
+{
+    rocrand_generator child = NULL;
+    EXPECT_EQ(rocrand_clone_generator(NULL, &child), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_clone_generator(g, &child), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g, 999ULL));
+
+    // The parent, two clones and a clone of a clone share the seed but
+    // sit on disjoint subsequence blocks, so their fills must be
+    // pairwise different
+    rocrand_generator child2     = NULL;
+    rocrand_generator grandchild = NULL;
+    ROCRAND_CHECK(rocrand_clone_generator(g, &child));
+    ROCRAND_CHECK(rocrand_clone_generator(g, &child2));
+    ROCRAND_CHECK(rocrand_clone_generator(child, &grandchild));
+
+    rocrand_generator generators[] = {g, child, child2, grandchild};
+    std::vector<std::vector<unsigned int>> host_data(4, std::vector<unsigned int>(size));
+    for(size_t i = 0; i < 4; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate(generators[i], data, size));
+        HIP_CHECK(hipMemcpy(host_data[i].data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+    }
+    for(size_t i = 0; i < 4; i++)
+    {
+        for(size_t j = i + 1; j < 4; j++)
+        {
+            ASSERT_NE(host_data[i], host_data[j]) << "where pair = " << i << ", " << j;
+        }
+    }
+
+    // A clone owns its state and outlives its parent
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_generate(child, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(child));
+    ROCRAND_CHECK(rocrand_destroy_generator(child2));
+    ROCRAND_CHECK(rocrand_destroy_generator(grandchild));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_statistics_test)
+{
+    rocrand_generator g = NULL;
+    rocrand_moments moments;
+    EXPECT_EQ(rocrand_generate_statistics(g, 100, &moments), ROCRAND_STATUS_NOT_CREATED);
+
+    // Only Philox implements the moment reduction
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_generate_statistics(g, 100, &moments), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 1 << 20;
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The moments must match the ones computed from the buffer a
+    // generate_uniform() call of the same size writes
+    rocrand_generator g_buffer = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_buffer, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate_uniform(g_buffer, data, size));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    double s4 = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const double x = host_data[i];
+        s1 += x;
+        s2 += x * x;
+        s3 += x * x * x;
+        s4 += x * x * x * x;
+    }
+    const double m1 = s1 / size;
+    const double m2 = s2 / size - m1 * m1;
+    const double m3 = s3 / size - 3.0 * m1 * s2 / size + 2.0 * m1 * m1 * m1;
+    const double m4 = s4 / size - 4.0 * m1 * s3 / size + 6.0 * m1 * m1 * s2 / size
+        - 3.0 * m1 * m1 * m1 * m1;
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_statistics(g, size, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_statistics(g, size, &moments));
+
+    // Not bit-exact: the device sums in a different association order
+    EXPECT_NEAR(moments.mean, m1, 1e-9);
+    EXPECT_NEAR(moments.variance, m2, 1e-9);
+    EXPECT_NEAR(moments.skewness, m3 / (m2 * std::sqrt(m2)), 1e-6);
+    EXPECT_NEAR(moments.kurtosis, m4 / (m2 * m2), 1e-6);
+
+    // Sanity against the exact uniform moments
+    EXPECT_NEAR(moments.mean, 0.5, 0.01);
+    EXPECT_NEAR(moments.variance, 1.0 / 12.0, 0.005);
+    EXPECT_NEAR(moments.skewness, 0.0, 0.02);
+    EXPECT_NEAR(moments.kurtosis, 9.0 / 5.0, 0.05);
+
+    // The call advances the sequence exactly like a fill of that size
+    std::vector<float> host_data_after(size);
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    HIP_CHECK(hipMemcpy(host_data_after.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_generate_uniform(g_buffer, data, size));
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    ASSERT_EQ(host_data_after, host_data);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_destroy_generator(g_buffer));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_basic_tests, rocrand_generate_multi_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_generate_multi(g, NULL, 0, 0), ROCRAND_STATUS_NOT_CREATED);
+
+    // Only XORWOW implements multi-buffer generation
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_generate_multi(g, NULL, 0, 0), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    const size_t size = 1 << 16;
+
+    float* uniform_data;
+    float* normal_data;
+    float* exponential_data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&uniform_data), size * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&normal_data), size * sizeof(float)));
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&exponential_data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_multi_descriptor fills[3] = {};
+    fills[0].data = uniform_data;
+    fills[0].kind = ROCRAND_CALL_UNIFORM_FLOAT;
+    fills[1].data = normal_data;
+    fills[1].kind = ROCRAND_CALL_NORMAL_FLOAT;
+    fills[1].mean = 5.0;
+    fills[1].stddev = 2.0;
+    fills[2].data = exponential_data;
+    fills[2].kind = ROCRAND_CALL_EXPONENTIAL_FLOAT;
+    fills[2].lambda = 2.0;
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_multi(g, NULL, 3, size), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Unsupported kind, missing buffer and bad lambda are rejected
+    // before anything is written
+    rocrand_multi_descriptor bad = fills[0];
+    bad.kind = ROCRAND_CALL_POISSON;
+    EXPECT_EQ(rocrand_generate_multi(g, &bad, 1, size), ROCRAND_STATUS_OUT_OF_RANGE);
+    bad = fills[0];
+    bad.data = NULL;
+    EXPECT_EQ(rocrand_generate_multi(g, &bad, 1, size), ROCRAND_STATUS_OUT_OF_RANGE);
+    bad = fills[2];
+    bad.lambda = 0.0;
+    EXPECT_EQ(rocrand_generate_multi(g, &bad, 1, size), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_generate_multi(g, fills, 3, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(
+        hipMemcpy(host_data.data(), uniform_data, size * sizeof(float), hipMemcpyDeviceToHost));
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f) << "where index = " << i;
+        ASSERT_LE(host_data[i], 1.0f) << "where index = " << i;
+        mean += host_data[i];
+    }
+    EXPECT_NEAR(mean / size, 0.5, 0.01);
+
+    HIP_CHECK(
+        hipMemcpy(host_data.data(), normal_data, size * sizeof(float), hipMemcpyDeviceToHost));
+    mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+    double variance = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        variance += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    EXPECT_NEAR(mean, 5.0, 0.1);
+    EXPECT_NEAR(std::sqrt(variance / size), 2.0, 0.1);
+
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        exponential_data,
+                        size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GE(host_data[i], 0.0f) << "where index = " << i;
+        mean += host_data[i];
+    }
+    EXPECT_NEAR(mean / size, 0.5, 0.02);
+
+    // The new exponential call kinds are also valid for warm-up
+    rocrand_call_descriptor warmup_call = {};
+    warmup_call.kind = ROCRAND_CALL_EXPONENTIAL_FLOAT;
+    warmup_call.size = 256;
+    warmup_call.lambda = 2.0;
+    ROCRAND_CHECK(rocrand_warmup(g, &warmup_call, 1));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(uniform_data));
+    HIP_CHECK(hipFree(normal_data));
+    HIP_CHECK(hipFree(exponential_data));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_benchmark_generator_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    double gbps = 0.0;
+    EXPECT_EQ(rocrand_benchmark_generator(g, 1024, 4, &gbps), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_benchmark_generator(g, 0, 4, &gbps), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_benchmark_generator(g, 1024, 0, &gbps), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_benchmark_generator(g, 1024, 4, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_benchmark_generator(g, 1 << 16, 4, &gbps));
+    EXPECT_GT(gbps, 0.0);
+
+    // The measurement advances the sequence like the equivalent
+    // generate calls, so later output stays reproducible
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_self_test_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_self_test(g), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    ROCRAND_CHECK(rocrand_self_test(g));
+
+    // The test runs on internal generators, so the caller's sequence
+    // is not advanced by it
+    const size_t  size = 12563;
+    unsigned int* data;
+    unsigned int* reference_data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&reference_data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator reference = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(reference, reference_data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    std::vector<unsigned int> host_reference(size);
+    HIP_CHECK(hipMemcpy(
+        host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_reference.data(),
+                        reference_data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_reference[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(reference_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_get_expected_throughput_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    double throughput = 0.0;
+    EXPECT_EQ(rocrand_get_expected_throughput(g, ROCRAND_CALL_UNIFORM_INT, 1024, &throughput),
+              ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_get_expected_throughput(g, ROCRAND_CALL_UNIFORM_INT, 0, &throughput),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_get_expected_throughput(g, ROCRAND_CALL_UNIFORM_INT, 1024, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_get_expected_throughput(g, static_cast<rocrand_call_kind>(12345), 1024,
+                                              &throughput),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // The first query calibrates; larger calls amortize the per-call
+    // overhead, so the prediction must not decrease with size
+    double small_throughput = 0.0;
+    double large_throughput = 0.0;
+    ROCRAND_CHECK(
+        rocrand_get_expected_throughput(g, ROCRAND_CALL_UNIFORM_INT, 1024, &small_throughput));
+    ROCRAND_CHECK(rocrand_get_expected_throughput(g,
+                                                  ROCRAND_CALL_UNIFORM_INT,
+                                                  1 << 24,
+                                                  &large_throughput));
+    EXPECT_GT(small_throughput, 0.0);
+    EXPECT_GE(large_throughput, small_throughput);
+
+    // Calibration runs on an internal generator, so the caller's
+    // sequence stays aligned with an untouched generator of the type
+    const size_t  size = 12563;
+    unsigned int* data;
+    unsigned int* reference_data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&reference_data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator reference = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+    ROCRAND_CHECK(rocrand_generate(g, data, size));
+    ROCRAND_CHECK(rocrand_generate(reference, reference_data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    std::vector<unsigned int> host_reference(size);
+    HIP_CHECK(
+        hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_reference.data(),
+                        reference_data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_reference[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(reference_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_basic_tests, rocrand_set_log_replay_test)
+{
+    EXPECT_EQ(rocrand_replay(NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_replay("rocrand_test_no_such_log.txt"), ROCRAND_STATUS_INTERNAL_ERROR);
+
+    rocrand_generator g = NULL;
+    const char* path = "rocrand_test_call_log.txt";
+    EXPECT_EQ(rocrand_set_log(g, path), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_log(g, path));
+
+    const size_t size = 12563;
+    float*       data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_set_seed(g, 707ULL));
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data, size));
+    ROCRAND_CHECK(rocrand_generate_normal(g, data, size, 0.0f, 1.0f));
+    ROCRAND_CHECK(
+        rocrand_generate_poisson(g, reinterpret_cast<unsigned int*>(data), size, 10.5));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_set_log(g, NULL));
+
+    // The log holds the calls in the shared trace format plus the seed
+    // change as a comment
+    std::ifstream            log(path);
+    ASSERT_TRUE(log.is_open());
+    std::vector<std::string> lines;
+    std::string              line;
+    while(std::getline(log, line))
+    {
+        lines.push_back(line);
+    }
+    log.close();
+    ASSERT_EQ(lines.size(), 5u);
+    EXPECT_EQ(lines[1], "# xorwow set-seed 707");
+    EXPECT_EQ(lines[2], "xorwow uniform-float 12563 0");
+    EXPECT_EQ(lines[3], "xorwow normal-float 12563 0");
+    EXPECT_EQ(lines[4], "xorwow poisson 12563 0 10.5");
+
+    ROCRAND_CHECK(rocrand_replay(path));
+
+    std::remove(path);
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST_P(rocrand_basic_tests, rocrand_warmup_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator g = NULL;
+    rocrand_call_descriptor calls[4] = {};
+    EXPECT_EQ(rocrand_warmup(g, calls, 4), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    EXPECT_EQ(rocrand_warmup(g, NULL, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // An empty call set only initializes the generator's state
+    ROCRAND_CHECK(rocrand_warmup(g, NULL, 0));
+
+    const size_t size = 12564;
+    calls[0] = {ROCRAND_CALL_UNIFORM_INT, size, 0.0};
+    calls[1] = {ROCRAND_CALL_UNIFORM_FLOAT, size, 0.0};
+    calls[2] = {ROCRAND_CALL_NORMAL_FLOAT, size, 0.0};
+    calls[3] = {ROCRAND_CALL_POISSON, size, 10.0};
+    ROCRAND_CHECK(rocrand_warmup(g, calls, 4));
+
+    // A non-positive lambda must fail before any call is run
+    calls[3].lambda = 0.0;
+    EXPECT_EQ(rocrand_warmup(g, calls, 4), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
 INSTANTIATE_TEST_SUITE_P(rocrand_basic_tests,
                         rocrand_basic_tests,
                         ::testing::ValuesIn(rng_types));
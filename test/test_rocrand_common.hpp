@@ -37,10 +37,38 @@ constexpr rocrand_rng_type rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
                                           ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
                                           ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
                                           ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                          ROCRAND_RNG_PSEUDO_PCG64,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                          ROCRAND_RNG_PSEUDO_CHACHA20,
+                                          ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+                                          ROCRAND_RNG_PSEUDO_THREEFRY4_64_13,
+                                          ROCRAND_RNG_PSEUDO_SQUARES32,
+                                          ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
                                           ROCRAND_RNG_QUASI_SOBOL32,
                                           ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
                                           ROCRAND_RNG_QUASI_SOBOL64,
-                                          ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64};
+                                          ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64,
+                                          ROCRAND_RNG_QUASI_SOBOL32_OWEN,
+                                          ROCRAND_RNG_QUASI_HALTON,
+                                          ROCRAND_RNG_QUASI_LATTICE};
+
+constexpr rocrand_rng_type pseudo_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                 ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                 ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                                 ROCRAND_RNG_PSEUDO_XORWOW,
+                                                 ROCRAND_RNG_PSEUDO_MTGP32,
+                                                 ROCRAND_RNG_PSEUDO_LFSR113,
+                                                 ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                                 ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                                 ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                                 ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                 ROCRAND_RNG_PSEUDO_PCG64,
+                                                 ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                                 ROCRAND_RNG_PSEUDO_CHACHA20,
+                                                 ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+                                                 ROCRAND_RNG_PSEUDO_THREEFRY4_64_13,
+                                                 ROCRAND_RNG_PSEUDO_SQUARES32,
+                                                 ROCRAND_RNG_PSEUDO_PHILOX4_64_10};
 
 constexpr rocrand_rng_type int_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
                                               ROCRAND_RNG_PSEUDO_MRG31K3P,
@@ -50,11 +78,29 @@ constexpr rocrand_rng_type int_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
                                               ROCRAND_RNG_PSEUDO_LFSR113,
                                               ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
                                               ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                              ROCRAND_RNG_PSEUDO_CHACHA20,
+                                              ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+                                              ROCRAND_RNG_PSEUDO_SQUARES32,
                                               ROCRAND_RNG_QUASI_SOBOL32,
-                                              ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32};
+                                              ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+                                              ROCRAND_RNG_QUASI_SOBOL32_OWEN,
+                                              ROCRAND_RNG_QUASI_HALTON,
+                                              ROCRAND_RNG_QUASI_LATTICE};
 
-constexpr rocrand_rng_type long_long_rng_types[] = {ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+constexpr rocrand_rng_type long_long_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                    ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                    ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                                    ROCRAND_RNG_PSEUDO_XORWOW,
+                                                    ROCRAND_RNG_PSEUDO_MTGP32,
+                                                    ROCRAND_RNG_PSEUDO_LFSR113,
+                                                    ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                                    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                                    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
                                                     ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                    ROCRAND_RNG_PSEUDO_PCG64,
+                                                    ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                                    ROCRAND_RNG_PSEUDO_THREEFRY4_64_13,
+                                                    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
                                                     ROCRAND_RNG_QUASI_SOBOL64,
                                                     ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64};
 
@@ -0,0 +1,257 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.hpp>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// The same kernel is instantiated for different engines and distributions;
+// both are selected purely at compile time.
+template<class GeneratorState, class Distribution>
+__global__ __launch_bounds__(32) void device_distribution_kernel(
+    typename Distribution::result_type* output, const size_t size, Distribution distribution)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    GeneratorState     state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(12345, subsequence, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = distribution(state);
+        index += global_size;
+    }
+}
+
+template<class GeneratorState, class Distribution>
+double device_distribution_mean(Distribution distribution)
+{
+    typedef typename Distribution::result_type result_type;
+
+    const size_t output_size = 8192;
+    result_type* output;
+    HIP_CHECK(hipMallocHelper(&output, output_size * sizeof(result_type)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(device_distribution_kernel<GeneratorState, Distribution>),
+                       dim3(4),
+                       dim3(64),
+                       0,
+                       0,
+                       output,
+                       output_size,
+                       distribution);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<result_type> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(result_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    return mean / output_size;
+}
+
+TEST(rocrand_cpp_device, uniform_real_distribution)
+{
+    rocrand_cpp::device::uniform_real_distribution<float> distribution;
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_philox4x32_10>(distribution), 0.5, 0.1);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_xorwow>(distribution), 0.5, 0.1);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_threefry2x32_20>(distribution), 0.5, 0.1);
+}
+
+TEST(rocrand_cpp_device, uniform_real_distribution_double)
+{
+    rocrand_cpp::device::uniform_real_distribution<double> distribution;
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_philox4x32_10>(distribution), 0.5, 0.1);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_xorwow>(distribution), 0.5, 0.1);
+}
+
+TEST(rocrand_cpp_device, normal_distribution)
+{
+    rocrand_cpp::device::normal_distribution<float> distribution(2.0f, 5.0f);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_philox4x32_10>(distribution), 2.0, 0.4);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_xorwow>(distribution), 2.0, 0.4);
+}
+
+TEST(rocrand_cpp_device, lognormal_distribution)
+{
+    rocrand_cpp::device::lognormal_distribution<float> distribution(1.6f, 0.25f);
+    const double expected_mean = std::exp(1.6 + 0.25 * 0.25 / 2);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_philox4x32_10>(distribution),
+                expected_mean,
+                expected_mean * 0.1);
+}
+
+TEST(rocrand_cpp_device, poisson_distribution)
+{
+    rocrand_cpp::device::poisson_distribution<unsigned int> distribution(20.0);
+    EXPECT_NEAR(device_distribution_mean<rocrand_state_philox4x32_10>(distribution),
+                20.0,
+                20.0 * 0.1);
+}
+
+// Consumes the iterator the way an algorithm taking a random-access input
+// range would: the iterator is passed by value and dereferenced in-register,
+// no buffer of random values exists anywhere
+template<class Iterator>
+__global__ __launch_bounds__(32) void random_iterator_kernel(
+    typename Iterator::value_type* output, const size_t size, Iterator begin)
+{
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    while(index < size)
+    {
+        output[index] = begin[index];
+        index += global_size;
+    }
+}
+
+template<class Iterator>
+std::vector<typename Iterator::value_type> random_iterator_output(Iterator begin, size_t size)
+{
+    typedef typename Iterator::value_type result_type;
+
+    result_type* output;
+    HIP_CHECK(hipMallocHelper(&output, size * sizeof(result_type)));
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(random_iterator_kernel<Iterator>),
+                       dim3(4),
+                       dim3(64),
+                       0,
+                       0,
+                       output,
+                       size,
+                       begin);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<result_type> output_host(size);
+    HIP_CHECK(hipMemcpy(output_host.data(), output, size * sizeof(result_type), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    return output_host;
+}
+
+TEST(rocrand_cpp_device, random_iterator_uniform)
+{
+    typedef rocrand_cpp::random_iterator<rocrand_state_philox4x32_10,
+                                         rocrand_cpp::device::uniform_real_distribution<float>>
+        iterator;
+
+    const size_t size = 8192;
+    const iterator begin(12345);
+    const std::vector<float> output = random_iterator_output(begin, size);
+
+    double mean = 0.0;
+    for(float v : output)
+    {
+        ASSERT_GT(v, 0.0f);
+        ASSERT_LE(v, 1.0f);
+        mean += v;
+    }
+    EXPECT_NEAR(mean / size, 0.5, 0.1);
+
+    // Positions are pure functions of (seed, index): replaying the range
+    // reproduces it, and an offset iterator sees the same values shifted
+    const std::vector<float> replay = random_iterator_output(begin, size);
+    ASSERT_EQ(output, replay);
+
+    const std::vector<float> shifted = random_iterator_output(begin + 100, size - 100);
+    for(size_t i = 0; i < size - 100; i++)
+    {
+        ASSERT_EQ(output[i + 100], shifted[i]);
+    }
+
+    // A different seed produces a different range
+    const std::vector<float> reseeded = random_iterator_output(iterator(54321), size);
+    ASSERT_NE(output, reseeded);
+}
+
+TEST(rocrand_cpp_device, random_iterator_normal)
+{
+    // The normal distribution consumes two engine outputs per value; each
+    // position draws from its own subsequence, so neighboring positions
+    // must not share draws
+    rocrand_cpp::device::normal_distribution<float> distribution(2.0f, 5.0f);
+    const auto begin = rocrand_cpp::make_random_iterator<rocrand_state_philox4x32_10>(12345, distribution);
+
+    const size_t size = 8192;
+    const std::vector<float> output = random_iterator_output(begin, size);
+
+    double mean = 0.0;
+    for(float v : output)
+    {
+        mean += v;
+    }
+    mean /= size;
+    double stddev = 0.0;
+    for(float v : output)
+    {
+        stddev += (v - mean) * (v - mean);
+    }
+    stddev = std::sqrt(stddev / size);
+    EXPECT_NEAR(mean, 2.0, 0.4);
+    EXPECT_NEAR(stddev, 5.0, 0.4);
+}
+
+TEST(rocrand_cpp_device, random_iterator_arithmetic)
+{
+    // FQUALIFIERS is host-callable in this file, so the iterator contract
+    // can be checked on the host
+    typedef rocrand_cpp::random_iterator<rocrand_state_philox4x32_10,
+                                         rocrand_cpp::device::uniform_real_distribution<float>>
+        iterator;
+
+    iterator it(12345);
+    const iterator begin = it;
+    ++it;
+    it += 9;
+    EXPECT_EQ(it - begin, 10);
+    EXPECT_TRUE(begin < it);
+    EXPECT_TRUE(it != begin);
+    EXPECT_EQ(it - 10, begin);
+    EXPECT_EQ(begin + 10, it);
+    EXPECT_EQ(10 + begin, it);
+    --it;
+    it -= 9;
+    EXPECT_EQ(it, begin);
+}
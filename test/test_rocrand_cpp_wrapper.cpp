@@ -19,6 +19,9 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -639,3 +642,80 @@ TEST(rocrand_cpp_wrapper, rocrand_poisson_dist_param)
     d3.param(d1.param());
     ASSERT_TRUE(d1.param() == d3.param());
 }
+
+template<class Engine>
+void rocrand_host_buffered_engine_template()
+{
+    rocrand_cpp::host_buffered_engine<Engine> engine;
+
+    const size_t size = 131072;
+    double mean = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += static_cast<double>(engine()) / static_cast<double>(engine.max());
+    }
+    mean = mean / size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_host_buffered_engine)
+{
+    ASSERT_NO_THROW(rocrand_host_buffered_engine_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_host_buffered_engine_template<rocrand_cpp::xorwow>());
+    ASSERT_NO_THROW(rocrand_host_buffered_engine_template<rocrand_cpp::mtgp32>());
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_host_buffered_engine_continuity)
+{
+    // Draws crossing refill boundaries continue the sequence exactly like
+    // one large fill of the wrapped engine
+    const size_t buffer_size = 1024;
+    const size_t size = 4 * buffer_size + 37;
+
+    rocrand_cpp::host_buffered_engine<rocrand_cpp::philox4x32_10> engine(11ULL, buffer_size);
+    std::vector<unsigned int> host_results(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        host_results[i] = engine();
+    }
+
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    rocrand_cpp::philox4x32_10 device_engine(11ULL);
+    rocrand_cpp::uniform_int_distribution<unsigned int> dist;
+    dist(device_engine, data, size);
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> device_results(size);
+    HIP_CHECK(hipMemcpy(device_results.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_results[i], device_results[i]) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_host_buffered_engine_shuffle)
+{
+    std::vector<int> values(1 << 16);
+    std::iota(values.begin(), values.end(), 0);
+
+    rocrand_cpp::host_buffered_engine<rocrand_cpp::philox4x32_10> engine;
+    std::shuffle(values.begin(), values.end(), engine);
+
+    // The result must be a permutation of the input, and not the identity
+    size_t moved = 0;
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        moved += values[i] != static_cast<int>(i) ? 1 : 0;
+        sum += values[i];
+    }
+    const unsigned long long n = values.size();
+    EXPECT_EQ(sum, n * (n - 1) / 2);
+    EXPECT_GT(moved, values.size() / 2);
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <cstring>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+namespace
+{
+
+// Expose the engine state so a checkpoint blob can be synthesized from a
+// rocRAND state and compared after a round trip through the import.
+struct xorwow_accessor : public rocrand_state_xorwow
+{
+    __host__ xorwow_state internal_state() const
+    {
+        return m_state;
+    }
+};
+
+struct philox_accessor : public rocrand_state_philox4x32_10
+{
+    __host__ philox4x32_state internal_state() const
+    {
+        return m_state;
+    }
+};
+
+} // end anonymous namespace
+
+TEST(rocrand_curand_import_tests, xorwow_sequence_test)
+{
+    // Advance a reference state, pack its fields the way cuRAND lays them
+    // out on disk, import that blob into a fresh state and check that both
+    // states produce the identical continuation of the sequence.
+    rocrand_state_xorwow reference;
+    rocrand_init(0xdeadbeefbeefdeadULL, 456ULL, 234ULL, &reference);
+    for(unsigned int i = 0; i < 100; i++)
+    {
+        (void)rocrand(&reference);
+    }
+
+    const rocrand_state_xorwow::xorwow_state snapshot
+        = reinterpret_cast<const xorwow_accessor&>(reference).internal_state();
+
+    rocrand_device::detail::curand_state_xorwow_layout blob;
+    std::memset(&blob, 0, sizeof(blob));
+    blob.d = snapshot.d;
+    for(unsigned int j = 0; j < 5; j++)
+    {
+        blob.v[j] = snapshot.x[j];
+    }
+    blob.boxmuller_flag  = 1;
+    blob.boxmuller_extra = 0.25f;
+
+    rocrand_state_xorwow imported;
+    rocrand_import_curand_state_xorwow(&blob, &imported, 1);
+
+    for(unsigned int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(rocrand(&imported), rocrand(&reference)) << "where index = " << i;
+    }
+
+    // The banked Box-Muller value must survive the import too
+    const rocrand_state_xorwow::xorwow_state imported_state
+        = reinterpret_cast<const xorwow_accessor&>(imported).internal_state();
+    EXPECT_EQ(imported_state.boxmuller_float_state, 1U);
+    EXPECT_EQ(imported_state.boxmuller_float, 0.25f);
+    EXPECT_EQ(imported_state.boxmuller_double_state, 0U);
+}
+
+TEST(rocrand_curand_import_tests, philox4x32_10_sequence_test)
+{
+    rocrand_state_philox4x32_10 reference;
+    rocrand_init(0xdeadbeefbeefdeadULL, 456ULL, 234ULL, &reference);
+    // Draw a count that is not a multiple of four so the imported state
+    // must resume mid-block from the transferred sub-state index
+    for(unsigned int i = 0; i < 101; i++)
+    {
+        (void)rocrand(&reference);
+    }
+
+    const rocrand_state_philox4x32_10::philox4x32_state snapshot
+        = reinterpret_cast<const philox_accessor&>(reference).internal_state();
+
+    rocrand_device::detail::curand_state_philox4x32_10_layout blob;
+    std::memset(&blob, 0, sizeof(blob));
+    blob.ctr    = snapshot.counter;
+    blob.output = snapshot.result;
+    blob.key    = snapshot.key;
+    blob.state  = snapshot.substate;
+
+    rocrand_state_philox4x32_10 imported;
+    rocrand_import_curand_state_philox4x32_10(&blob, &imported, 1);
+
+    for(unsigned int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(rocrand(&imported), rocrand(&reference)) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_curand_import_tests, xorwow_batch_test)
+{
+    // Each state in a batch must be converted independently
+    const size_t n = 64;
+    std::vector<rocrand_device::detail::curand_state_xorwow_layout> blobs(n);
+    std::vector<rocrand_state_xorwow> references(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        rocrand_init(0x12345678ULL + i, i, 0ULL, &references[i]);
+        const rocrand_state_xorwow::xorwow_state snapshot
+            = reinterpret_cast<const xorwow_accessor&>(references[i]).internal_state();
+        std::memset(&blobs[i], 0, sizeof(blobs[i]));
+        blobs[i].d = snapshot.d;
+        for(unsigned int j = 0; j < 5; j++)
+        {
+            blobs[i].v[j] = snapshot.x[j];
+        }
+    }
+
+    std::vector<rocrand_state_xorwow> imported(n);
+    rocrand_import_curand_state_xorwow(blobs.data(), imported.data(), n);
+
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(rocrand(&imported[i]), rocrand(&references[i])) << "where index = " << i;
+    }
+}
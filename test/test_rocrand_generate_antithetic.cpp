@@ -0,0 +1,193 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// The pseudo-random generators supporting antithetic mode (all except
+// the MRG-based ones, whose raw outputs have no valid bit-complement
+// reflection)
+constexpr rocrand_rng_type antithetic_rng_types[]
+    = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+       ROCRAND_RNG_PSEUDO_XORWOW,
+       ROCRAND_RNG_PSEUDO_MTGP32,
+       ROCRAND_RNG_PSEUDO_LFSR113,
+       ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+       ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+       ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+       ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+       ROCRAND_RNG_PSEUDO_PCG64,
+       ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+       ROCRAND_RNG_PSEUDO_CHACHA20,
+       ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+       ROCRAND_RNG_PSEUDO_THREEFRY4_64_13,
+       ROCRAND_RNG_PSEUDO_SQUARES32,
+       ROCRAND_RNG_PSEUDO_PHILOX4_64_10};
+
+class rocrand_generate_antithetic_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_antithetic_tests, uniform_pair_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_antithetic(generator, 1));
+
+    const size_t size = 131072;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Each value and its mate reflect around 1/2, so consecutive pairs
+    // sum to one (up to one ulp of the uniform conversion)
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i += 2)
+    {
+        ASSERT_NEAR(host_data[i] + host_data[i + 1], 1.0f, 1e-6f)
+            << "where index = " << i;
+        mean += host_data[i] + host_data[i + 1];
+    }
+    EXPECT_NEAR(mean / size, 0.5, 1e-6);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_antithetic_tests, normal_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_antithetic(generator, 1));
+
+    const size_t size = 131072;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 2.0f, 1.5f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+    double variance = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        variance += (host_data[i] - mean) * (host_data[i] - mean);
+    }
+    variance /= size;
+
+    EXPECT_NEAR(mean, 2.0, 0.05);
+    EXPECT_NEAR(variance, 2.25, 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_antithetic_tests, toggle_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 4096;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Disabling the mode again must restore plain generation; pairs no
+    // longer reflect
+    ROCRAND_CHECK(rocrand_set_antithetic(generator, 1));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    ROCRAND_CHECK(rocrand_set_antithetic(generator, 0));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t reflecting = 0;
+    for(size_t i = 0; i < size; i += 2)
+    {
+        if(std::fabs(host_data[i] + host_data[i + 1] - 1.0f) < 1e-6f)
+        {
+            reflecting++;
+        }
+    }
+    EXPECT_LT(reflecting, size / 4);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_antithetic_tests,
+                         rocrand_generate_antithetic_tests,
+                         ::testing::ValuesIn(antithetic_rng_types));
+
+TEST(rocrand_generate_antithetic_tests, type_error_test)
+{
+    const rocrand_rng_type unsupported[] = {ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                            ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                            ROCRAND_RNG_QUASI_SOBOL32};
+    for(const rocrand_rng_type rng_type : unsupported)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        EXPECT_EQ(rocrand_set_antithetic(generator, 1), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+TEST(rocrand_generate_antithetic_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_set_antithetic(generator, 1), ROCRAND_STATUS_NOT_CREATED);
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// A Philox batched fill holds the same values as sequential
+// rocrand_generate() calls of the same sizes, and the generator
+// continues from the same sequence position afterwards
+TEST(rocrand_generate_batch_tests, philox_match_sequential_test)
+{
+    const size_t sizes[] = { 1000, 4096, 37 };
+    const unsigned int n_buffers = sizeof(sizes) / sizeof(sizes[0]);
+    const size_t follow_up = 512;
+    const unsigned long long seed = 11111ULL;
+
+    size_t total = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        total += sizes[b];
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              (total + follow_up) * sizeof(unsigned int)));
+    unsigned int* buffers[n_buffers];
+    size_t offset = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        buffers[b] = data + offset;
+        offset += sizes[b];
+    }
+    ROCRAND_CHECK(rocrand_generate_batch(generator, buffers, sizes, n_buffers));
+    ROCRAND_CHECK(rocrand_generate(generator, data + total, follow_up));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> batched(total + follow_up);
+    HIP_CHECK(hipMemcpy(batched.data(), data, (total + follow_up) * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // The reference runs the same fills as separate calls
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    offset = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, data + offset, sizes[b]));
+        offset += sizes[b];
+    }
+    ROCRAND_CHECK(rocrand_generate(generator, data + total, follow_up));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> sequential(total + follow_up);
+    HIP_CHECK(hipMemcpy(sequential.data(), data, (total + follow_up) * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < total + follow_up; i++)
+    {
+        ASSERT_EQ(batched[i], sequential[i]) << "where index = " << i;
+    }
+}
+
+// XORWOW batched fills are reproducible for a given seed and advance
+// the engines, so the next batch holds different values
+TEST(rocrand_generate_batch_tests, xorwow_test)
+{
+    const size_t sizes[] = { 2048, 0, 16384, 129 };
+    const unsigned int n_buffers = sizeof(sizes) / sizeof(sizes[0]);
+    const unsigned long long seed = 54321ULL;
+
+    size_t total = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        total += sizes[b];
+    }
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), total * sizeof(unsigned int)));
+    unsigned int* buffers[n_buffers];
+    size_t offset = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        buffers[b] = sizes[b] > 0 ? data + offset : NULL;
+        offset += sizes[b];
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate_batch(generator, buffers, sizes, n_buffers));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> first(total);
+    HIP_CHECK(hipMemcpy(first.data(), data, total * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // The engines advanced, so the next batch differs
+    ROCRAND_CHECK(rocrand_generate_batch(generator, buffers, sizes, n_buffers));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> second(total);
+    HIP_CHECK(hipMemcpy(second.data(), data, total * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    size_t same = 0;
+    for(size_t i = 0; i < total; i++)
+    {
+        if(first[i] == second[i])
+        {
+            same++;
+        }
+    }
+    EXPECT_LT(same, total / 16);
+
+    // A generator with the same seed reproduces the batch
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate_batch(generator, buffers, sizes, n_buffers));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> replay(total);
+    HIP_CHECK(hipMemcpy(replay.data(), data, total * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ASSERT_EQ(replay, first);
+}
+
+TEST(rocrand_generate_batch_tests, neg_test)
+{
+    const size_t sizes[] = { 256 };
+    unsigned int* buffers[] = { NULL };
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_batch(generator, buffers, sizes, 1),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only PHILOX4_32_10 and XORWOW generators are supported
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MTGP32));
+    EXPECT_EQ(rocrand_generate_batch(generator, buffers, sizes, 1),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_batch(generator, NULL, sizes, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_batch(generator, buffers, NULL, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_batch(generator, buffers, sizes, 0),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    // A NULL buffer pointer with a non-zero size is rejected
+    EXPECT_EQ(rocrand_generate_batch(generator, buffers, sizes, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
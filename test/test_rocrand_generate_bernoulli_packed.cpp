@@ -0,0 +1,151 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+void generate_bernoulli_packed(std::vector<unsigned int>& mask_words,
+                               const size_t n_bits,
+                               const float p,
+                               const unsigned long long seed)
+{
+    const size_t n_words = (n_bits + 31) / 32;
+    mask_words.resize(n_words);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), n_words * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_bernoulli_packed(generator, data, n_bits, p));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(mask_words.data(), data, n_words * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+size_t count_set_bits(const std::vector<unsigned int>& mask_words)
+{
+    size_t count = 0;
+    for(size_t i = 0; i < mask_words.size(); i++)
+    {
+        unsigned int word = mask_words[i];
+        while(word != 0)
+        {
+            count += word & 1u;
+            word >>= 1;
+        }
+    }
+    return count;
+}
+
+TEST(rocrand_generate_bernoulli_packed_tests, frequency_test)
+{
+    const float probabilities[] = { 0.1f, 0.5f, 0.9f };
+    // Not a multiple of 32, so the partial last word is exercised
+    const size_t n_bits = 1 << 20 | 17;
+
+    for(const float p : probabilities)
+    {
+        std::vector<unsigned int> mask_words;
+        generate_bernoulli_packed(mask_words, n_bits, p, 11111ULL);
+
+        const double frequency =
+            static_cast<double>(count_set_bits(mask_words)) / n_bits;
+        EXPECT_NEAR(frequency, p, 0.01) << "where p = " << p;
+    }
+}
+
+TEST(rocrand_generate_bernoulli_packed_tests, edge_probability_test)
+{
+    const size_t n_bits = 4096 + 7;
+    const size_t n_words = (n_bits + 31) / 32;
+
+    std::vector<unsigned int> mask_words;
+    generate_bernoulli_packed(mask_words, n_bits, 0.0f, 22222ULL);
+    for(size_t i = 0; i < n_words; i++)
+    {
+        ASSERT_EQ(mask_words[i], 0u) << "where index = " << i;
+    }
+
+    generate_bernoulli_packed(mask_words, n_bits, 1.0f, 22222ULL);
+    for(size_t i = 0; i < n_words - 1; i++)
+    {
+        ASSERT_EQ(mask_words[i], ~0u) << "where index = " << i;
+    }
+    // The unused high bits of the partial last word are zero
+    ASSERT_EQ(mask_words[n_words - 1], (1u << (n_bits % 32)) - 1);
+}
+
+// The host backend packs the same engine subsequences, so host and
+// device generators of the same seed produce the same mask
+TEST(rocrand_generate_bernoulli_packed_tests, host_device_match_test)
+{
+    const size_t n_bits = 65536 + 13;
+    const size_t n_words = (n_bits + 31) / 32;
+    std::vector<unsigned int> device_words;
+    generate_bernoulli_packed(device_words, n_bits, 0.25f, 987654321ULL);
+
+    rocrand_generator h = NULL;
+    std::vector<unsigned int> host_words(n_words);
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 987654321ULL));
+    ROCRAND_CHECK(rocrand_generate_bernoulli_packed(h, host_words.data(), n_bits, 0.25f));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    for(size_t i = 0; i < n_words; i++)
+    {
+        ASSERT_EQ(host_words[i], device_words[i]) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_generate_bernoulli_packed_tests, neg_test)
+{
+    const size_t n_bits = 256;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_bernoulli_packed(generator, NULL, n_bits, 0.5f),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only PHILOX4_32_10 generators are supported
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_bernoulli_packed(generator, NULL, n_bits, 0.5f),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // The probability must be in [0, 1]
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_bernoulli_packed(generator, NULL, n_bits, -0.5f),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_bernoulli_packed(generator, NULL, n_bits, 1.5f),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void binomial_mean_test(rocrand_rng_type rng_type, unsigned int t, double probability)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_binomial(generator, data, 1, t, probability)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_binomial(generator, data, size, t, probability)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_LE(host_data[i], t);
+        mean += host_data[i];
+    }
+    mean /= size;
+    const double expected = t * probability;
+    EXPECT_NEAR(mean, expected, std::max(1.0, 0.1 * expected));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_binomial_tests, histogram_path_test)
+{
+    // Small number of trials uses the precomputed histogram
+    binomial_mean_test(GetParam(), 100, 0.3);
+}
+
+TEST_P(rocrand_generate_binomial_tests, approximation_path_test)
+{
+    // Large number of trials uses the normal approximation
+    binomial_mean_test(GetParam(), 1000000, 0.4);
+}
+
+TEST(rocrand_generate_binomial_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 0, 0.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 10, 1.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_binomial_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, (unsigned int *) data, size, 10, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_binomial_tests,
+                        rocrand_generate_binomial_tests,
+                        ::testing::ValuesIn(pseudo_rng_types));
@@ -0,0 +1,139 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+void generate_bits(std::vector<unsigned char>& bytes,
+                   const size_t n_symbols,
+                   const unsigned int bit_width,
+                   const unsigned long long seed)
+{
+    const size_t n_bytes = (n_symbols * bit_width + 7) / 8;
+    bytes.resize(n_bytes);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned char* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), n_bytes));
+    ROCRAND_CHECK(rocrand_generate_bits(generator, data, n_symbols, bit_width));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(bytes.data(), data, n_bytes, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Reads symbol i from the packed stream: bits [i * bit_width,
+// (i + 1) * bit_width), counting from the least significant bit of the
+// first byte, so symbols may straddle byte boundaries
+unsigned int unpack_symbol(const std::vector<unsigned char>& bytes,
+                           const size_t i,
+                           const unsigned int bit_width)
+{
+    unsigned int symbol = 0;
+    for(unsigned int b = 0; b < bit_width; b++)
+    {
+        const size_t bit = i * bit_width + b;
+        symbol |= static_cast<unsigned int>((bytes[bit / 8] >> (bit % 8)) & 1u) << b;
+    }
+    return symbol;
+}
+
+TEST(rocrand_generate_bits_tests, frequency_test)
+{
+    // 3, 5 and 6 bit symbols straddle byte boundaries
+    const unsigned int bit_widths[] = { 2, 3, 4, 5, 6 };
+    const size_t n_symbols = 1 << 18 | 13;
+
+    for(const unsigned int bit_width : bit_widths)
+    {
+        std::vector<unsigned char> bytes;
+        generate_bits(bytes, n_symbols, bit_width, 22222ULL);
+
+        const unsigned int n_values = 1u << bit_width;
+        std::vector<size_t> counts(n_values, 0);
+        for(size_t i = 0; i < n_symbols; i++)
+        {
+            counts[unpack_symbol(bytes, i, bit_width)]++;
+        }
+
+        const double expected = static_cast<double>(n_symbols) / n_values;
+        for(unsigned int v = 0; v < n_values; v++)
+        {
+            EXPECT_NEAR(static_cast<double>(counts[v]), expected, expected * 0.1)
+                << "where bit_width = " << bit_width << ", symbol = " << v;
+        }
+    }
+}
+
+TEST(rocrand_generate_bits_tests, byte_stream_equivalence_test)
+{
+    // The packed symbols are slices of the generator's byte stream, so
+    // the buffer matches a raw byte fill from the same seed
+    const size_t n_symbols = 4096;
+    const unsigned int bit_width = 6;
+    const size_t n_bytes = (n_symbols * bit_width + 7) / 8;
+
+    std::vector<unsigned char> packed;
+    generate_bits(packed, n_symbols, bit_width, 33333ULL);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 33333ULL));
+
+    unsigned char* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), n_bytes));
+    ROCRAND_CHECK(rocrand_generate_char(generator, data, n_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> raw(n_bytes);
+    HIP_CHECK(hipMemcpy(raw.data(), data, n_bytes, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ASSERT_EQ(packed, raw);
+}
+
+TEST(rocrand_generate_bits_tests, invalid_arguments_test)
+{
+    rocrand_generator generator = NULL;
+    unsigned char dummy[4];
+    EXPECT_EQ(rocrand_generate_bits(generator, dummy, 4, 4), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    unsigned char* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 4));
+    EXPECT_EQ(rocrand_generate_bits(generator, data, 4, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_bits(generator, data, 4, 33), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_bits(generator, data, 0, 4));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
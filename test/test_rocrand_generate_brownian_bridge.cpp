@@ -0,0 +1,219 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// A Brownian path over the grid t_0 < ... < t_{n-1} must have
+// E[W(t_k)] = 0, Var[W(t_k)] = t_k and independent increments
+// (Var[W(t_k) - W(t_{k-1})] = t_k - t_{k-1}), regardless of the
+// order the bridge construction draws the values in.
+
+class rocrand_generate_brownian_bridge_tests
+    : public ::testing::TestWithParam<rocrand_rng_type>
+{
+};
+
+TEST_P(rocrand_generate_brownian_bridge_tests, path_statistics_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n_paths = 16384;
+    const unsigned int n_steps = 8;
+    float times[n_steps];
+    for(unsigned int k = 0; k < n_steps; k++)
+    {
+        times[k] = 0.125f * (k + 1);
+    }
+
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_paths * n_steps * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_brownian_bridge(generator, data, n_paths, n_steps, times)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_paths * n_steps);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        n_paths * n_steps * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(unsigned int k = 0; k < n_steps; k++)
+    {
+        double mean = 0.0;
+        double variance = 0.0;
+        double increment_variance = 0.0;
+        for(size_t i = 0; i < n_paths; i++)
+        {
+            const float v = host_data[i * n_steps + k];
+            mean += v;
+            variance += static_cast<double>(v) * v;
+            const float prev = k == 0 ? 0.0f : host_data[i * n_steps + k - 1];
+            increment_variance
+                += static_cast<double>(v - prev) * (v - prev);
+        }
+        mean /= n_paths;
+        variance /= n_paths;
+        increment_variance /= n_paths;
+
+        EXPECT_NEAR(mean, 0.0, 0.05) << "where step = " << k;
+        EXPECT_NEAR(variance, times[k], 0.05 * times[k]) << "where step = " << k;
+        const double dt = k == 0 ? times[0] : times[k] - times[k - 1];
+        EXPECT_NEAR(increment_variance, dt, 0.05) << "where step = " << k;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_brownian_bridge_tests, repeated_grid_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n_paths = 4096;
+    const unsigned int n_steps = 5;
+    const float times[n_steps] = {0.1f, 0.3f, 0.35f, 0.8f, 1.0f};
+
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_paths * n_steps * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Consecutive batches over the same grid reuse the cached bridge
+    // coefficients and must continue the sequence, not repeat it
+    ROCRAND_CHECK(
+        rocrand_generate_brownian_bridge(generator, data, n_paths, n_steps, times)
+    );
+    std::vector<float> first_batch(n_paths * n_steps);
+    HIP_CHECK(hipMemcpy(first_batch.data(), data,
+                        n_paths * n_steps * sizeof(float),
+                        hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(
+        rocrand_generate_brownian_bridge(generator, data, n_paths, n_steps, times)
+    );
+    std::vector<float> second_batch(n_paths * n_steps);
+    HIP_CHECK(hipMemcpy(second_batch.data(), data,
+                        n_paths * n_steps * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t different = 0;
+    for(size_t i = 0; i < n_paths * n_steps; i++)
+    {
+        if(first_batch[i] != second_batch[i])
+        {
+            different++;
+        }
+    }
+    EXPECT_GT(different, (n_paths * n_steps) / 2);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_brownian_bridge_tests, out_of_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    float * data = NULL;
+    const float good_times[2] = {0.5f, 1.0f};
+    const float zero_start[2] = {0.0f, 1.0f};
+    const float not_increasing[2] = {1.0f, 1.0f};
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 0, good_times),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 65, good_times),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 2, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 2, zero_start),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 2, not_increasing),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_brownian_bridge_tests,
+                         rocrand_generate_brownian_bridge_tests,
+                         ::testing::Values(ROCRAND_RNG_QUASI_SOBOL32,
+                                           ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64));
+
+TEST(rocrand_generate_brownian_bridge_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    float * data = NULL;
+    const float times[2] = {0.5f, 1.0f};
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, data, 16, 2, times),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_brownian_bridge_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    const float times[2] = {0.5f, 1.0f};
+    EXPECT_EQ(
+        rocrand_generate_brownian_bridge(generator, NULL, 16, 2, times),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_cauchy_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The Cauchy distribution has no mean, so the tests check the sample
+// median and the fraction of values within one scale of the median
+// (exactly one half for the Cauchy distribution).
+
+TEST_P(rocrand_generate_cauchy_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    const float median = 2.0f;
+    const float sigma = 0.5f;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_cauchy(generator, data, 1, median, sigma)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_cauchy(generator, data, size, median, sigma)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t below_median = 0;
+    size_t within_sigma = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] < median)
+            below_median++;
+        if(std::abs(host_data[i] - median) < sigma)
+            within_sigma++;
+    }
+    EXPECT_NEAR(static_cast<double>(below_median) / size, 0.5, 0.05);
+    EXPECT_NEAR(static_cast<double>(within_sigma) / size, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_cauchy_tests, double_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    const double median = -1.0;
+    const double sigma = 2.0;
+    double * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_cauchy_double(generator, data, size, median, sigma)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t below_median = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] < median)
+            below_median++;
+    }
+    EXPECT_NEAR(static_cast<double>(below_median) / size, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_cauchy_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_cauchy(generator, data, 16, 0.0f, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_cauchy_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_cauchy(generator, (float *) data, size, 0.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_cauchy_tests,
+                        rocrand_generate_cauchy_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,200 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// Every vector must lie on the simplex (non-negative components summing
+// to one) and the component means of Dirichlet(alpha) are
+// alpha_i / sum(alpha).
+
+TEST(rocrand_generate_dirichlet_tests, mean_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t n_vectors = 65536;
+    const unsigned int k = 3;
+    const float h_alphas[k] = {2.0f, 3.0f, 5.0f};
+    const float alpha_sum = 10.0f;
+
+    float * data;
+    float * alphas;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * k * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&alphas),
+                              k * sizeof(float)));
+    HIP_CHECK(hipMemcpy(alphas, h_alphas, k * sizeof(float), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_dirichlet(generator, data, n_vectors, k, alphas)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * k);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * k * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean[k] = {0.0, 0.0, 0.0};
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        float sum = 0.0f;
+        for(unsigned int c = 0; c < k; c++)
+        {
+            const float v = host_data[i * k + c];
+            ASSERT_GE(v, 0.0f) << "where index = " << i;
+            ASSERT_LE(v, 1.0f) << "where index = " << i;
+            sum += v;
+            mean[c] += v;
+        }
+        ASSERT_NEAR(sum, 1.0f, 1e-4f) << "where index = " << i;
+    }
+    for(unsigned int c = 0; c < k; c++)
+    {
+        EXPECT_NEAR(mean[c] / n_vectors, h_alphas[c] / alpha_sum, 0.01);
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(alphas));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_dirichlet_tests, small_shape_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t n_vectors = 16384;
+    const unsigned int k = 4;
+    // Shapes below one exercise the boost step of the gamma sampler
+    const float h_alphas[k] = {0.5f, 0.5f, 0.5f, 0.5f};
+
+    float * data;
+    float * alphas;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * k * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&alphas),
+                              k * sizeof(float)));
+    HIP_CHECK(hipMemcpy(alphas, h_alphas, k * sizeof(float), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_dirichlet(generator, data, n_vectors, k, alphas)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * k);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * k * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        float sum = 0.0f;
+        for(unsigned int c = 0; c < k; c++)
+        {
+            const float v = host_data[i * k + c];
+            ASSERT_GE(v, 0.0f) << "where index = " << i;
+            sum += v;
+        }
+        ASSERT_NEAR(sum, 1.0f, 1e-4f) << "where index = " << i;
+        mean += host_data[i * k];
+    }
+    EXPECT_NEAR(mean / n_vectors, 0.25, 0.01);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(alphas));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_dirichlet_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data = NULL;
+    const float * alphas = NULL;
+    EXPECT_EQ(
+        rocrand_generate_dirichlet(generator, data, 16, 0, alphas),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_dirichlet(generator, data, 16, 33, alphas),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_dirichlet_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    float * data = NULL;
+    const float * alphas = NULL;
+    EXPECT_EQ(
+        rocrand_generate_dirichlet(generator, data, 16, 3, alphas),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_dirichlet_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_dirichlet(generator, NULL, 16, 3, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2017-2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_discrete_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+TEST_P(rocrand_generate_discrete_tests, generate_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const unsigned int  dis_size = 10;
+    const unsigned int  offset   = 100;
+    std::vector<double> probabilities(dis_size);
+    for(unsigned int i = 0; i < dis_size; i++)
+    {
+        // Unnormalized weights; the expected mean is offset + 6
+        probabilities[i] = i + 1;
+    }
+
+    double* d_probabilities;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&d_probabilities),
+                              dis_size * sizeof(double)));
+    HIP_CHECK(hipMemcpy(d_probabilities,
+                        probabilities.data(),
+                        dis_size * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution_device(d_probabilities,
+                                                              dis_size,
+                                                              offset,
+                                                              &discrete_distribution));
+    HIP_CHECK(hipFree(d_probabilities));
+
+    const size_t  size = 12563;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_discrete(generator, data, size, discrete_distribution));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GE(host_data[i], offset);
+        ASSERT_LT(host_data[i], offset + dis_size);
+        mean += host_data[i];
+    }
+    mean = mean / size;
+    EXPECT_NEAR(mean, offset + 6.0, 0.2);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_discrete_tests, host_device_match_test)
+{
+    const unsigned int  dis_size = 25;
+    const unsigned int  offset   = 0;
+    std::vector<double> probabilities(dis_size);
+    for(unsigned int i = 0; i < dis_size; i++)
+    {
+        probabilities[i] = 1.0 + (i % 7);
+    }
+
+    rocrand_discrete_distribution host_built;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(),
+                                                       dis_size,
+                                                       offset,
+                                                       &host_built));
+
+    double* d_probabilities;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&d_probabilities),
+                              dis_size * sizeof(double)));
+    HIP_CHECK(hipMemcpy(d_probabilities,
+                        probabilities.data(),
+                        dis_size * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    rocrand_discrete_distribution device_built;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution_device(d_probabilities,
+                                                              dis_size,
+                                                              offset,
+                                                              &device_built));
+    HIP_CHECK(hipFree(d_probabilities));
+
+    rocrand_discrete_distribution_st h_dis0;
+    rocrand_discrete_distribution_st h_dis1;
+    HIP_CHECK(hipMemcpy(&h_dis0,
+                        host_built,
+                        sizeof(rocrand_discrete_distribution_st),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(&h_dis1,
+                        device_built,
+                        sizeof(rocrand_discrete_distribution_st),
+                        hipMemcpyDeviceToHost));
+
+    // The CDFs must agree; the alias tables may differ in the order
+    // worklist entries are paired, so only the CDF is compared exactly.
+    std::vector<double> cdf0(dis_size);
+    std::vector<double> cdf1(dis_size);
+    HIP_CHECK(hipMemcpy(cdf0.data(), h_dis0.cdf, dis_size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(cdf1.data(), h_dis1.cdf, dis_size * sizeof(double), hipMemcpyDeviceToHost));
+
+    for(unsigned int i = 0; i < dis_size; i++)
+    {
+        EXPECT_NEAR(cdf0[i], cdf1[i], 1e-12);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(host_built));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(device_built));
+}
+
+TEST(rocrand_generate_discrete_tests, out_of_range_test)
+{
+    const unsigned int dis_size = 10;
+    double*            d_probabilities;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&d_probabilities),
+                              dis_size * sizeof(double)));
+
+    rocrand_discrete_distribution discrete_distribution;
+    EXPECT_EQ(rocrand_create_discrete_distribution_device(d_probabilities,
+                                                          0,
+                                                          0,
+                                                          &discrete_distribution),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_create_discrete_distribution_device(NULL,
+                                                          dis_size,
+                                                          0,
+                                                          &discrete_distribution),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(d_probabilities));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    const size_t  size = 256;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_discrete(generator, data, size, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_discrete_tests, neg_test)
+{
+    const size_t   size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_discrete(generator, (unsigned int *)data, size, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_discrete_tests,
+                         rocrand_generate_discrete_tests,
+                         ::testing::ValuesIn(rng_types));
@@ -0,0 +1,173 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_gamma_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_gamma_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    float shape = 2.0f;
+    float scale = 3.0f;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_gamma(generator, data, 1, shape, scale)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(
+        rocrand_generate_gamma(generator, data+1, 2, shape, scale)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_gamma(generator, data, size, shape, scale)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // All values must be positive and the sample mean close to shape * scale
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, shape * scale, 0.1 * shape * scale);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_gamma_tests, double_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    double shape = 0.5;
+    double scale = 2.0;
+    double * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_gamma_double(generator, data, size, shape, scale)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0);
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, shape * scale, 0.1 * shape * scale);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_gamma_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 256;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 1.0f, -1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_gamma_tests, neg_test)
+{
+    const size_t size = 256;
+    float shape = 2.0f;
+    float scale = 1.0f;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, (float *) data, size, shape, scale),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_gamma_tests,
+                        rocrand_generate_gamma_tests,
+                        ::testing::ValuesIn(pseudo_rng_types));
@@ -0,0 +1,168 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+TEST(rocrand_generate_latin_hypercube_tests, stratification_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                           ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    const size_t n_samples = 1000;
+    const size_t n_dims = 8;
+    const size_t size = n_samples * n_dims;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_latin_hypercube(generator, data,
+                                                   n_samples, n_dims));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Every one-dimensional projection must hit each of the n_samples
+    // strata of (0, 1] exactly once
+    for(size_t d = 0; d < n_dims; d++)
+    {
+        std::vector<unsigned int> counts(n_samples, 0);
+        double mean = 0.0;
+        for(size_t i = 0; i < n_samples; i++)
+        {
+            const float v = host_data[d * n_samples + i];
+            ASSERT_GT(v, 0.0f) << "where dimension = " << d << ", index = " << i;
+            ASSERT_LE(v, 1.0f) << "where dimension = " << d << ", index = " << i;
+            size_t stratum = static_cast<size_t>(v * n_samples);
+            if(stratum == n_samples)
+            {
+                stratum--;
+            }
+            counts[stratum]++;
+            mean += v;
+        }
+        for(size_t s = 0; s < n_samples; s++)
+        {
+            ASSERT_EQ(counts[s], 1u)
+                << "where dimension = " << d << ", stratum = " << s;
+        }
+        EXPECT_NEAR(mean / n_samples, 0.5, 0.01);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_latin_hypercube_tests, fresh_design_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                           ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    const size_t n_samples = 256;
+    const size_t n_dims = 4;
+    const size_t size = n_samples * n_dims;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              2 * size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_latin_hypercube(generator, data,
+                                                   n_samples, n_dims));
+    ROCRAND_CHECK(rocrand_generate_latin_hypercube(generator, data + size,
+                                                   n_samples, n_dims));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, 2 * size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Each call must produce a fresh design, not repeat the previous one
+    size_t equal = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] == host_data[size + i])
+        {
+            equal++;
+        }
+    }
+    EXPECT_LT(equal, size / 4);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_latin_hypercube_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                           ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 16 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_latin_hypercube(generator, data, 16, 0),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_latin_hypercube(generator, data,
+                                               (1ull << 32) + 1, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_latin_hypercube_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                           ROCRAND_RNG_PSEUDO_XORWOW));
+
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 16 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_latin_hypercube(generator, data, 16, 1),
+              ROCRAND_STATUS_TYPE_ERROR);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_latin_hypercube_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_latin_hypercube(generator, NULL, 16, 1),
+              ROCRAND_STATUS_NOT_CREATED);
+}
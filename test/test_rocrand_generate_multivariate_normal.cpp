@@ -0,0 +1,146 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+TEST(rocrand_generate_multivariate_normal_tests, correlation_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t n_vectors = 65536;
+    const unsigned int dim = 2;
+    const double rho = 0.5;
+
+    // Row-major lower triangular Cholesky factor of [[1, rho], [rho, 1]]
+    const float h_factor[dim * dim] = {
+        1.0f, 0.0f,
+        static_cast<float>(rho), static_cast<float>(std::sqrt(1.0 - rho * rho))
+    };
+
+    float * data;
+    float * factor;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * dim * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&factor),
+                              dim * dim * sizeof(float)));
+    HIP_CHECK(hipMemcpy(factor, h_factor, dim * dim * sizeof(float), hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_multivariate_normal(generator, data, n_vectors, dim, factor)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * dim);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * dim * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean0 = 0.0, mean1 = 0.0, cov = 0.0;
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        mean0 += host_data[i * dim];
+        mean1 += host_data[i * dim + 1];
+    }
+    mean0 /= n_vectors;
+    mean1 /= n_vectors;
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        cov += (host_data[i * dim] - mean0) * (host_data[i * dim + 1] - mean1);
+    }
+    cov /= n_vectors;
+
+    EXPECT_NEAR(mean0, 0.0, 0.05);
+    EXPECT_NEAR(mean1, 0.0, 0.05);
+    EXPECT_NEAR(cov, rho, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(factor));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multivariate_normal_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data = NULL;
+    const float * factor = NULL;
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 16, 0, factor),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 16, 33, factor),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multivariate_normal_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    float * data = NULL;
+    const float * factor = NULL;
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 16, 2, factor),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multivariate_normal_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, NULL, 16, 2, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -149,6 +150,114 @@ TEST_P(rocrand_generate_normal_tests, half_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST_P(rocrand_generate_normal_tests, bf16_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    hip_bfloat16 mean   = hip_bfloat16(5.0f);
+    hip_bfloat16 stddev = hip_bfloat16(2.0f);
+    hip_bfloat16 * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(hip_bfloat16)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_normal_bf16(generator, data, 1, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(
+        rocrand_generate_normal_bf16(generator, data+1, 2, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_bf16(generator, data, size, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_normal_tests, float2_float4_test)
+{
+    const size_t n_vectors = 6281;
+    float mean = 5.0f;
+    float stddev = 2.0f;
+
+    float * data;
+    float * data_vec;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              4 * n_vectors * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data_vec),
+                              4 * n_vectors * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The vector entry points expose the scalar sequence in (x, y) and
+    // (x, y, z, w) groups, so for equal seeds a vector fill must equal a
+    // scalar fill of the same element count
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 707ULL));
+    ROCRAND_CHECK(
+        rocrand_generate_normal(generator, data, 2 * n_vectors, mean, stddev)
+    );
+
+    rocrand_generator generator_vec;
+    ROCRAND_CHECK(rocrand_create_generator(&generator_vec, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator_vec, 707ULL));
+    ROCRAND_CHECK(
+        rocrand_generate_normal_float2(generator_vec, data_vec, n_vectors, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(4 * n_vectors);
+    std::vector<float> host_data_vec(4 * n_vectors);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        2 * n_vectors * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data_vec.data(), data_vec,
+                        2 * n_vectors * sizeof(float), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < 2 * n_vectors; i++)
+    {
+        ASSERT_EQ(host_data_vec[i], host_data[i]) << "where index = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_set_seed(generator, 707ULL));
+    ROCRAND_CHECK(
+        rocrand_generate_normal(generator, data, 4 * n_vectors, mean, stddev)
+    );
+    ROCRAND_CHECK(rocrand_set_seed(generator_vec, 707ULL));
+    ROCRAND_CHECK(
+        rocrand_generate_normal_float4(generator_vec, data_vec, n_vectors, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        4 * n_vectors * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data_vec.data(), data_vec,
+                        4 * n_vectors * sizeof(float), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < 4 * n_vectors; i++)
+    {
+        ASSERT_EQ(host_data_vec[i], host_data[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_vec));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator_vec));
+}
+
 TEST(rocrand_generate_normal_tests, neg_test)
 {
     const size_t size = 256;
@@ -0,0 +1,235 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// Under the device-independent ordering a dense fill uses the same
+// index-mapped value-to-element assignment as the pitched kernel, so the
+// payload of the pitched fill must match a dense fill exactly and the
+// padding must stay untouched.
+TEST(rocrand_generate_normal_2d_tests, dense_match_test)
+{
+    const size_t rows = 100;
+    const size_t cols = 64;
+    const size_t pitch = 128;
+    const float sentinel = 123.0f;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_ordering(generator,
+                                       ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+
+    rocrand_generator reference;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &reference,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_ordering(reference,
+                                       ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+
+    float * data;
+    float * dense;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              cols * pitch * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&dense),
+                              rows * cols * sizeof(float)));
+
+    const std::vector<float> sentinels(cols * pitch, sentinel);
+    HIP_CHECK(hipMemcpy(data, sentinels.data(), cols * pitch * sizeof(float),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_2d(generator, data, rows, cols, pitch, 0.0f, 1.0f)
+    );
+    ROCRAND_CHECK(
+        rocrand_generate_normal(reference, dense, rows * cols, 0.0f, 1.0f)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(cols * pitch);
+    std::vector<float> host_dense(rows * cols);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, cols * pitch * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_dense.data(), dense, rows * cols * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t col = 0; col < cols; col++)
+    {
+        for(size_t i = 0; i < pitch; i++)
+        {
+            if(i < rows)
+            {
+                ASSERT_EQ(host_data[col * pitch + i], host_dense[col * rows + i])
+                    << "where col = " << col << ", row = " << i;
+            }
+            else
+            {
+                ASSERT_EQ(host_data[col * pitch + i], sentinel)
+                    << "where col = " << col << ", row = " << i;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(dense));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+}
+
+// The pitched call advances the sequence exactly like a dense fill of
+// rows * cols values, so a generator that made a pitched call and one
+// that made an equivalent dense call continue identically.
+TEST(rocrand_generate_normal_2d_tests, sequence_advance_test)
+{
+    const size_t rows = 96;
+    const size_t cols = 32;
+    const size_t pitch = 112;
+    const size_t n = 12345;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    rocrand_generator reference;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &reference,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data;
+    float * expected;
+    float * actual;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              cols * pitch * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&expected),
+                              n * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&actual),
+                              n * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_2d(generator, data, rows, cols, pitch, 0.0f, 1.0f)
+    );
+    ROCRAND_CHECK(
+        rocrand_generate_normal(reference, data, rows * cols, 0.0f, 1.0f)
+    );
+
+    ROCRAND_CHECK(rocrand_generate_normal(generator, actual, n, 0.0f, 1.0f));
+    ROCRAND_CHECK(rocrand_generate_normal(reference, expected, n, 0.0f, 1.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_expected(n);
+    std::vector<float> host_actual(n);
+    HIP_CHECK(hipMemcpy(host_expected.data(), expected, n * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_actual.data(), actual, n * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(host_actual[i], host_expected[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(expected));
+    HIP_CHECK(hipFree(actual));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+}
+
+TEST(rocrand_generate_normal_2d_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_normal_2d(generator, data, 128, 16, 100, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_normal_2d_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_normal_2d(generator, data, 16, 16, 16, 0.0f, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_generate_normal_double_2d(generator, NULL, 16, 16, 16, 0.0, 1.0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_normal_2d_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_normal_2d(generator, NULL, 16, 16, 16, 0.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_normal_double_2d(generator, NULL, 16, 16, 16, 0.0, 1.0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
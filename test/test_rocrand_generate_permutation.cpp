@@ -0,0 +1,160 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+void generate_permutation(std::vector<unsigned int>& results,
+                          const unsigned long long seed)
+{
+    const size_t n = results.size();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), n * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, data, n));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(results.data(), data, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_permutation_tests, permutation_test)
+{
+    // Not a power of two, so the cycle-walking path is exercised
+    const size_t n = 100003;
+    std::vector<unsigned int> results(n);
+    generate_permutation(results, 11111ULL);
+
+    // Every value of [0, n) appears exactly once
+    std::vector<char> seen(n, 0);
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_LT(results[i], n) << "where index = " << i;
+        ASSERT_EQ(seen[results[i]], 0) << "where index = " << i;
+        seen[results[i]] = 1;
+    }
+
+    // And not in identity order
+    size_t moved = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        moved += results[i] != i ? 1 : 0;
+    }
+    EXPECT_GT(moved, n / 2);
+}
+
+TEST(rocrand_generate_permutation_tests, reproducibility_test)
+{
+    const size_t n = 4096;
+    std::vector<unsigned int> results0(n);
+    std::vector<unsigned int> results1(n);
+
+    generate_permutation(results0, 54321ULL);
+    generate_permutation(results1, 54321ULL);
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(results0[i], results1[i]) << "where index = " << i;
+    }
+
+    generate_permutation(results1, 54322ULL);
+    size_t different = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        different += results0[i] != results1[i] ? 1 : 0;
+    }
+    EXPECT_GT(different, n / 2);
+}
+
+TEST(rocrand_generate_permutation_tests, fresh_per_call_test)
+{
+    const size_t n = 4096;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), 2 * n * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, data, n));
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, data + n, n));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> results(2 * n);
+    HIP_CHECK(hipMemcpy(results.data(), data, 2 * n * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    size_t different = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        different += results[i] != results[n + i] ? 1 : 0;
+    }
+    EXPECT_GT(different, n / 2);
+}
+
+// The host backend keys the same Feistel network off the same sequence,
+// so host and device generators of the same seed produce the same
+// permutation
+TEST(rocrand_generate_permutation_tests, host_device_match_test)
+{
+    const size_t n = 65537;
+    std::vector<unsigned int> device_results(n);
+    generate_permutation(device_results, 987654321ULL);
+
+    rocrand_generator h = NULL;
+    std::vector<unsigned int> host_results(n);
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 987654321ULL));
+    ROCRAND_CHECK(rocrand_generate_permutation(h, host_results.data(), n));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(host_results[i], device_results[i]) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_generate_permutation_tests, neg_test)
+{
+    const size_t n = 256;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_permutation(generator, NULL, n),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only PHILOX4_32_10 generators are supported
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_permutation(generator, NULL, n),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
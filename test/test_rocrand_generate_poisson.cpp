@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <algorithm>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -97,6 +99,76 @@ TEST_P(rocrand_generate_poisson_tests, out_of_range_test)
         { return rocrand_generate_poisson(gen, data, size, lambda); });
 }
 
+TEST(rocrand_generate_poisson_tests, array_test)
+{
+    // Rates spanning all three sampling methods (inversion, rejection,
+    // normal approximation) interleaved in one call
+    const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
+    const size_t n_lambdas = sizeof(lambdas) / sizeof(lambdas[0]);
+    const size_t size = n_lambdas * 4096;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    double* lambdas_device;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&lambdas_device), size * sizeof(double)));
+    std::vector<double> lambdas_host(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        lambdas_host[i] = lambdas[i % n_lambdas];
+    }
+    HIP_CHECK(hipMemcpy(lambdas_device,
+                        lambdas_host.data(),
+                        size * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_poisson_array(generator, data, size, lambdas_device));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> results(size);
+    HIP_CHECK(
+        hipMemcpy(results.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(lambdas_device));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t l = 0; l < n_lambdas; l++)
+    {
+        const double lambda = lambdas[l];
+        double mean = 0;
+        for(size_t i = l; i < size; i += n_lambdas)
+        {
+            mean += results[i];
+        }
+        mean = mean / (size / n_lambdas);
+
+        double variance = 0;
+        for(size_t i = l; i < size; i += n_lambdas)
+        {
+            variance += (results[i] - mean) * (results[i] - mean);
+        }
+        variance = variance / (size / n_lambdas);
+
+        EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1)) << "where lambda = " << lambda;
+        EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1))
+            << "where lambda = " << lambda;
+    }
+}
+
+TEST(rocrand_generate_poisson_tests, array_unsupported_type_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    const size_t size = 256;
+    EXPECT_EQ(rocrand_generate_poisson_array(generator, NULL, size, NULL),
+              ROCRAND_STATUS_TYPE_ERROR);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
 INSTANTIATE_TEST_SUITE_P(rocrand_generate_poisson_tests,
                          rocrand_generate_poisson_tests,
                          ::testing::ValuesIn(rng_types));
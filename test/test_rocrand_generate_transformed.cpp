@@ -0,0 +1,130 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_transform.hpp>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// Keeps the low bits of every raw value; the expected output can be
+// recomputed on the host from rocrand_philox_at
+struct mask_op
+{
+    __host__ __device__ unsigned int operator()(unsigned int v) const
+    {
+        return v & 0xFFFFu;
+    }
+};
+
+// Scales a uniform float into a range and clamps it, the post-processing
+// pass the fused launch is meant to absorb
+struct scale_clamp_op
+{
+    float scale;
+
+    __host__ __device__ float operator()(float v) const
+    {
+        const float x = v * scale;
+        return x > 1.0f ? 1.0f : x;
+    }
+};
+
+// The raw value at index i is word i % 4 of the Philox block at
+// counter i / 4, so the host can recompute every transformed value
+TEST(rocrand_generate_transformed_tests, match_stateless_test)
+{
+    const size_t size = 4 * 4096 + 3;
+    const unsigned long long seed = 54321ULL;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_transformed(seed, data, size, mask_op()));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    const mask_op op;
+    for(size_t i = 0; i < size; i++)
+    {
+        const uint4 block = rocrand_philox_at(seed, i / 4);
+        const unsigned int words[4] = { block.x, block.y, block.z, block.w };
+        ASSERT_EQ(host_data[i], op(words[i % 4])) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_transformed_tests, uniform_transformed_test)
+{
+    const size_t size = 12563;
+    const unsigned long long seed = 98765ULL;
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const scale_clamp_op op{ 1.5f };
+    ROCRAND_CHECK(rocrand_generate_uniform_transformed(seed, data, size, op));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f) << "at " << i;
+        ASSERT_LE(host_data[i], 1.0f) << "at " << i;
+    }
+
+    // The mapping from (seed, index) to the value is fixed, so a replay
+    // reproduces the fill exactly
+    float* replay;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&replay), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_generate_uniform_transformed(seed, replay, size, op));
+
+    std::vector<float> host_replay(size);
+    HIP_CHECK(hipMemcpy(host_replay.data(), replay, size * sizeof(float), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_replay[i], host_data[i]) << "at " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(replay));
+}
+
+TEST(rocrand_generate_transformed_tests, neg_test)
+{
+    unsigned int* data = NULL;
+    EXPECT_EQ(rocrand_generate_transformed(0ULL, data, 100, mask_op()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    // A zero-size fill needs no buffer
+    ROCRAND_CHECK(rocrand_generate_transformed(0ULL, data, 0, mask_op()));
+}
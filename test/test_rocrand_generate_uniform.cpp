@@ -143,6 +143,44 @@ TEST_P(rocrand_generate_uniform_tests, half_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST_P(rocrand_generate_uniform_tests, bf16_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    hip_bfloat16 * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(hip_bfloat16)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_bf16(generator, data, 1)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_bf16(generator, data+1, 2)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_bf16(generator, data, size)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
 TEST(rocrand_generate_uniform_tests, neg_test)
 {
     const size_t size = 256;
@@ -0,0 +1,162 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// A batched fill holds the same values as sequential
+// rocrand_generate_uniform() calls of the same sizes, and the generator
+// continues from the same sequence position afterwards
+TEST(rocrand_generate_uniform_batched_tests, match_sequential_test)
+{
+    const size_t sizes[] = { 1000, 4096, 37 };
+    const unsigned int n_buffers = sizeof(sizes) / sizeof(sizes[0]);
+    const size_t follow_up = 512;
+    const unsigned long long seed = 11111ULL;
+
+    size_t total = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        total += sizes[b];
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              (total + follow_up) * sizeof(float)));
+    float* buffers[n_buffers];
+    size_t offset = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        buffers[b] = data + offset;
+        offset += sizes[b];
+    }
+    ROCRAND_CHECK(rocrand_generate_uniform_batched(generator, buffers, sizes, n_buffers));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data + total, follow_up));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> batched(total + follow_up);
+    HIP_CHECK(hipMemcpy(batched.data(), data, (total + follow_up) * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // The reference runs the same fills as separate calls
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    offset = 0;
+    for(unsigned int b = 0; b < n_buffers; b++)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform(generator, data + offset, sizes[b]));
+        offset += sizes[b];
+    }
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data + total, follow_up));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> sequential(total + follow_up);
+    HIP_CHECK(hipMemcpy(sequential.data(), data, (total + follow_up) * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < total + follow_up; i++)
+    {
+        ASSERT_EQ(batched[i], sequential[i]) << "where index = " << i;
+    }
+}
+
+// The host backend computes every element from the same sequence
+// position, so it matches the device generator of the same seed
+TEST(rocrand_generate_uniform_batched_tests, host_test)
+{
+    const size_t sizes[] = { 4096, 0, 1031 };
+    const unsigned int n_buffers = sizeof(sizes) / sizeof(sizes[0]);
+    const unsigned long long seed = 987654321ULL;
+
+    std::vector<float> buffer0(sizes[0]);
+    std::vector<float> buffer2(sizes[2]);
+    float* buffers[n_buffers] = { buffer0.data(), NULL, buffer2.data() };
+
+    rocrand_generator h = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, seed));
+    ROCRAND_CHECK(rocrand_generate_uniform_batched(h, buffers, sizes, n_buffers));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    const size_t total = sizes[0] + sizes[2];
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    float* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), total * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, total));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> reference(total);
+    HIP_CHECK(hipMemcpy(reference.data(), data, total * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < sizes[0]; i++)
+    {
+        ASSERT_EQ(buffer0[i], reference[i]) << "where index = " << i;
+    }
+    for(size_t i = 0; i < sizes[2]; i++)
+    {
+        ASSERT_EQ(buffer2[i], reference[sizes[0] + i]) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_generate_uniform_batched_tests, neg_test)
+{
+    const size_t sizes[] = { 256 };
+    float* buffers[] = { NULL };
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_generate_uniform_batched(generator, buffers, sizes, 1),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only PHILOX4_32_10 generators are supported
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_uniform_batched(generator, buffers, sizes, 1),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_uniform_batched(generator, NULL, sizes, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_uniform_batched(generator, buffers, NULL, 1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_uniform_batched(generator, buffers, sizes, 0),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
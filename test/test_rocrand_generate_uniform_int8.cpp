@@ -0,0 +1,295 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// Sign-extends a 4-bit two's complement nibble
+int unpack_nibble(unsigned int nibble)
+{
+    return nibble >= 8 ? static_cast<int>(nibble) - 16 : static_cast<int>(nibble);
+}
+
+class rocrand_generate_uniform_int8_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_uniform_int8_tests, int8_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 65536;
+    const signed char lo = -100;
+    const signed char hi = 25;
+    signed char * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(signed char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_int8(generator, data, 1, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_int8(generator, data, size, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<signed char> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(signed char),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GE(host_data[i], lo) << "where index = " << i;
+        ASSERT_LE(host_data[i], hi) << "where index = " << i;
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5 * (lo + hi), 0.05 * (hi - lo));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_int8_tests, int8_full_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 65536;
+    signed char * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(signed char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_int8(generator, data, size, -128, 127)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<signed char> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(signed char),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Every value of the full range must occur in 256 expected
+    // occurrences per value
+    std::vector<unsigned int> histogram(256, 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        histogram[static_cast<int>(host_data[i]) + 128]++;
+    }
+    for(size_t v = 0; v < 256; v++)
+    {
+        ASSERT_GT(histogram[v], 0u) << "where value = " << static_cast<int>(v) - 128;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_int8_tests, int4_packed_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 32768;
+    const signed char lo = -8;
+    const signed char hi = 7;
+    unsigned char * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_int4_packed(generator, data, size, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned char),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    std::vector<unsigned int> histogram(16, 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        const int first = unpack_nibble(host_data[i] & 0xFu);
+        const int second = unpack_nibble(host_data[i] >> 4);
+        ASSERT_GE(first, lo) << "where index = " << i;
+        ASSERT_LE(first, hi) << "where index = " << i;
+        ASSERT_GE(second, lo) << "where index = " << i;
+        ASSERT_LE(second, hi) << "where index = " << i;
+        histogram[first - lo]++;
+        histogram[second - lo]++;
+        mean += first + second;
+    }
+    mean /= 2 * size;
+    EXPECT_NEAR(mean, 0.5 * (lo + hi), 0.05 * (hi - lo));
+    for(size_t v = 0; v < 16; v++)
+    {
+        ASSERT_GT(histogram[v], 0u) << "where value = " << static_cast<int>(v) + lo;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_int8_tests, int4_packed_narrow_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 8192;
+    const signed char lo = -2;
+    const signed char hi = 1;
+    unsigned char * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_int4_packed(generator, data, size, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(unsigned char),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const int first = unpack_nibble(host_data[i] & 0xFu);
+        const int second = unpack_nibble(host_data[i] >> 4);
+        ASSERT_GE(first, lo) << "where index = " << i;
+        ASSERT_LE(first, hi) << "where index = " << i;
+        ASSERT_GE(second, lo) << "where index = " << i;
+        ASSERT_LE(second, hi) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_int8_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    signed char * data = NULL;
+    unsigned char * packed_data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_int8(generator, data, 16, 10, 5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_uniform_int4_packed(generator, packed_data, 16, 2, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // int4 bounds must fit in a signed nibble
+    EXPECT_EQ(
+        rocrand_generate_uniform_int4_packed(generator, packed_data, 16, -9, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_uniform_int4_packed(generator, packed_data, 16, 0, 8),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_int8_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+
+    signed char * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_int8(generator, data, 16, -8, 7),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_int8_tests, neg_test)
+{
+    const size_t size = 256;
+    signed char * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_int8(generator, (signed char *) data, size, -8, 7),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_uniform_int8_tests,
+                        rocrand_generate_uniform_int8_tests,
+                        ::testing::ValuesIn(pseudo_rng_types));
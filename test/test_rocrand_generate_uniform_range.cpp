@@ -0,0 +1,233 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_uniform_range_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_uniform_range_tests, float_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 131072;
+    const float lo = -3.0f;
+    const float hi = 5.0f;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_range(generator, data, 1, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_range(generator, data, size, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], lo) << "where index = " << i;
+        ASSERT_LE(host_data[i], hi) << "where index = " << i;
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5 * (lo + hi), 0.05 * (hi - lo));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_range_tests, double_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 131072;
+    const double lo = 10.0;
+    const double hi = 10.5;
+    double * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_range_double(generator, data, size, lo, hi)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], lo) << "where index = " << i;
+        ASSERT_LE(host_data[i], hi) << "where index = " << i;
+        mean += host_data[i];
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5 * (lo + hi), 0.05 * (hi - lo));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_range_tests, half_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 131072;
+    const float lo = 2.0f;
+    const float hi = 4.0f;
+    half * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_uniform_range_half(generator, data, size,
+                                            __float2half(lo), __float2half(hi))
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<half> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(half),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const float v = __half2float(host_data[i]);
+        // Half rounding can land a value exactly on the lower bound
+        ASSERT_GE(v, lo) << "where index = " << i;
+        ASSERT_LE(v, hi) << "where index = " << i;
+        mean += v;
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 0.5 * (lo + hi), 0.05 * (hi - lo));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_range_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_range(generator, data, 16, 10.0f, 10.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_uniform_range(generator, data, 16, 10.0f, 5.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // NaN bounds cannot define a range
+    EXPECT_EQ(
+        rocrand_generate_uniform_range(generator, data, 16, 0.0f / 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_range_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_range(generator, data, 16, 0.0f, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_uniform_range_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_range(generator, (float *) data, size, 0.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_uniform_range_tests,
+                        rocrand_generate_uniform_range_tests,
+                        ::testing::ValuesIn(pseudo_rng_types));
@@ -0,0 +1,232 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <cmath>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+class rocrand_generate_unit_vector_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Every vector must lie on the unit sphere of its dimension, and the
+// component means of a uniform direction sample must vanish.
+
+TEST_P(rocrand_generate_unit_vector_tests, vector2_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t n_vectors = 12563;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * 2 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_unit_vector2(generator, data, 1)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_unit_vector2(generator, data, n_vectors)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * 2);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * 2 * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean_x = 0.0, mean_y = 0.0;
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        const float x = host_data[i * 2];
+        const float y = host_data[i * 2 + 1];
+        ASSERT_NEAR(std::sqrt(x * x + y * y), 1.0f, 1e-3f) << "where index = " << i;
+        mean_x += x;
+        mean_y += y;
+    }
+    EXPECT_NEAR(mean_x / n_vectors, 0.0, 0.05);
+    EXPECT_NEAR(mean_y / n_vectors, 0.0, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_unit_vector_tests, vector3_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t n_vectors = 12563;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * 4 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_unit_vector3(generator, data, n_vectors)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * 4);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * 4 * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean_x = 0.0, mean_y = 0.0, mean_z = 0.0;
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        const float x = host_data[i * 4];
+        const float y = host_data[i * 4 + 1];
+        const float z = host_data[i * 4 + 2];
+        ASSERT_NEAR(std::sqrt(x * x + y * y + z * z), 1.0f, 1e-3f)
+            << "where index = " << i;
+        ASSERT_EQ(host_data[i * 4 + 3], 0.0f) << "where index = " << i;
+        mean_x += x;
+        mean_y += y;
+        mean_z += z;
+    }
+    EXPECT_NEAR(mean_x / n_vectors, 0.0, 0.05);
+    EXPECT_NEAR(mean_y / n_vectors, 0.0, 0.05);
+    EXPECT_NEAR(mean_z / n_vectors, 0.0, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_unit_vector_tests, vector4_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t n_vectors = 12563;
+    float * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              n_vectors * 4 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_unit_vector4(generator, data, n_vectors)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(n_vectors * 4);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, n_vectors * 4 * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean[4] = {0.0, 0.0, 0.0, 0.0};
+    for(size_t i = 0; i < n_vectors; i++)
+    {
+        float n2 = 0.0f;
+        for(size_t c = 0; c < 4; c++)
+        {
+            const float v = host_data[i * 4 + c];
+            n2 += v * v;
+            mean[c] += v;
+        }
+        ASSERT_NEAR(std::sqrt(n2), 1.0f, 1e-3f) << "where index = " << i;
+    }
+    for(size_t c = 0; c < 4; c++)
+    {
+        EXPECT_NEAR(mean[c] / n_vectors, 0.0, 0.05) << "where component = " << c;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_unit_vector_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+
+    float * data = NULL;
+    EXPECT_EQ(
+        rocrand_generate_unit_vector2(generator, data, 16),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_generate_unit_vector3(generator, data, 16),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_generate_unit_vector4(generator, data, 16),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_unit_vector_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_unit_vector2(generator, NULL, 16),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_unit_vector3(generator, NULL, 16),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_unit_vector4(generator, NULL, 16),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_unit_vector_tests,
+                        rocrand_generate_unit_vector_tests,
+                        ::testing::ValuesIn(pseudo_rng_types));
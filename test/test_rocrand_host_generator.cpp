@@ -0,0 +1,151 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+TEST(rocrand_host_generator_tests, create_destroy_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_host_generator_tests, create_unsupported_type_test)
+{
+    // Host generation is restricted to counter-based engines
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_MTGP32),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_XORWOW),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_create_generator_host(&g, ROCRAND_RNG_QUASI_SOBOL32),
+              ROCRAND_STATUS_TYPE_ERROR);
+}
+
+// The host generator writes to host memory and does not need a device
+TEST(rocrand_host_generator_tests, uniform_uint_test)
+{
+    const size_t size = 131313;
+    std::vector<unsigned int> data(size);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate(g, data.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+}
+
+// Checks that the host backend produces bit-identical sequences to a
+// device generator of the same type and seed under the
+// ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT ordering, for a
+// distribution of each input/output width
+template<class T, class GenerateFunc>
+void host_device_match_test(GenerateFunc generate_func)
+{
+    const unsigned long long seed = 543216789ULL;
+    // Not a multiple of any output width, so the tail path is exercised
+    const size_t size = 131071;
+
+    std::vector<T> host_results(size);
+    rocrand_generator h = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, seed));
+    ROCRAND_CHECK(generate_func(h, host_results.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    T* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(T)));
+    rocrand_generator d = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&d, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(d, ROCRAND_ORDERING_PSEUDO_DEVICE_INDEPENDENT));
+    ROCRAND_CHECK(rocrand_set_seed(d, seed));
+    ROCRAND_CHECK(generate_func(d, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> device_results(size);
+    HIP_CHECK(hipMemcpy(device_results.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(d));
+    HIP_CHECK(hipFree(data));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_results[i], device_results[i]) << "where index = " << i;
+    }
+}
+
+TEST(rocrand_host_generator_tests, device_match_uint_test)
+{
+    host_device_match_test<unsigned int>(
+        [](rocrand_generator g, unsigned int* data, size_t size)
+        { return rocrand_generate(g, data, size); });
+}
+
+TEST(rocrand_host_generator_tests, device_match_uniform_float_test)
+{
+    host_device_match_test<float>([](rocrand_generator g, float* data, size_t size)
+                                  { return rocrand_generate_uniform(g, data, size); });
+}
+
+TEST(rocrand_host_generator_tests, device_match_normal_double_test)
+{
+    host_device_match_test<double>(
+        [](rocrand_generator g, double* data, size_t size)
+        { return rocrand_generate_normal_double(g, data, size, -2.0, 3.0); });
+}
+
+// Consecutive host calls continue the sequence exactly like one big call
+TEST(rocrand_host_generator_tests, continuity_test)
+{
+    const size_t size = 10007;
+    const size_t split = 4999;
+
+    std::vector<unsigned int> data0(size);
+    std::vector<unsigned int> data1(size);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate(g, data0.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate(g, data1.data(), split));
+    ROCRAND_CHECK(rocrand_generate(g, data1.data() + split, size - split));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(data0[i], data1[i]) << "where index = " << i;
+    }
+}
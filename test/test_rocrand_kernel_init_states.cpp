@@ -0,0 +1,228 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+// Reference: the init loop every consumer writes by hand
+template<class StateType>
+__global__ __launch_bounds__(64) void reference_init_kernel(StateType*               states,
+                                                            const size_t             n,
+                                                            const unsigned long long seed)
+{
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    if(state_id < n)
+    {
+        StateType state;
+        rocrand_init(seed, state_id, 0, &state);
+        states[state_id] = state;
+    }
+}
+
+template<class StateType>
+__global__ __launch_bounds__(64) void generate_kernel(StateType*    states,
+                                                      unsigned int* output,
+                                                      const size_t  n)
+{
+    const size_t state_id = blockIdx.x * blockDim.x + threadIdx.x;
+    if(state_id < n)
+    {
+        StateType state  = states[state_id];
+        output[state_id] = rocrand(&state);
+        states[state_id] = state;
+    }
+}
+
+template<class StateType>
+void init_states_matches_rocrand_init()
+{
+    const size_t             n    = 1000;
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    StateType* states;
+    StateType* reference_states;
+    HIP_CHECK(hipMallocHelper((void**)&states, n * sizeof(StateType)));
+    HIP_CHECK(hipMallocHelper((void**)&reference_states, n * sizeof(StateType)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ASSERT_EQ(rocrand_init_states(states, n, seed), ROCRAND_STATUS_SUCCESS);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(reference_init_kernel<StateType>),
+                       dim3((n + 63) / 64),
+                       dim3(64),
+                       0,
+                       0,
+                       reference_states,
+                       n,
+                       seed);
+    HIP_CHECK(hipGetLastError());
+
+    unsigned int* output;
+    unsigned int* reference_output;
+    HIP_CHECK(hipMallocHelper((void**)&output, n * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper((void**)&reference_output, n * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(generate_kernel<StateType>),
+                       dim3((n + 63) / 64),
+                       dim3(64),
+                       0,
+                       0,
+                       states,
+                       output,
+                       n);
+    HIP_CHECK(hipGetLastError());
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(generate_kernel<StateType>),
+                       dim3((n + 63) / 64),
+                       dim3(64),
+                       0,
+                       0,
+                       reference_states,
+                       reference_output,
+                       n);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(n);
+    std::vector<unsigned int> reference_host(n);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        n * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(reference_host.data(),
+                        reference_output,
+                        n * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_EQ(output_host[i], reference_host[i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(reference_states));
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(reference_output));
+}
+
+TEST(rocrand_kernel_init_states, philox4x32_10)
+{
+    init_states_matches_rocrand_init<rocrand_state_philox4x32_10>();
+}
+
+TEST(rocrand_kernel_init_states, threefry2x32_20)
+{
+    init_states_matches_rocrand_init<rocrand_state_threefry2x32_20>();
+}
+
+// XORWOW and the MRGs take the block-cooperative skip-ahead path, so a
+// match against the per-thread rocrand_init also covers the shared
+// staging of the jump matrices
+
+TEST(rocrand_kernel_init_states, xorwow)
+{
+    init_states_matches_rocrand_init<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_kernel_init_states, mrg31k3p)
+{
+    init_states_matches_rocrand_init<rocrand_state_mrg31k3p>();
+}
+
+TEST(rocrand_kernel_init_states, mrg32k3a)
+{
+    init_states_matches_rocrand_init<rocrand_state_mrg32k3a>();
+}
+
+TEST(rocrand_kernel_init_states, lfsr113)
+{
+    const size_t n    = 1000;
+    const uint4  seed = {ROCRAND_LFSR113_DEFAULT_SEED_X,
+                         ROCRAND_LFSR113_DEFAULT_SEED_Y,
+                         ROCRAND_LFSR113_DEFAULT_SEED_Z,
+                         ROCRAND_LFSR113_DEFAULT_SEED_W};
+
+    rocrand_state_lfsr113* states;
+    HIP_CHECK(hipMallocHelper((void**)&states, n * sizeof(rocrand_state_lfsr113)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ASSERT_EQ(rocrand_init_states(states, n, seed), ROCRAND_STATUS_SUCCESS);
+
+    unsigned int* output;
+    HIP_CHECK(hipMallocHelper((void**)&output, n * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(generate_kernel<rocrand_state_lfsr113>),
+                       dim3((n + 63) / 64),
+                       dim3(64),
+                       0,
+                       0,
+                       states,
+                       output,
+                       n);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(n);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        n * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Different subsequences must not produce identical leading values
+    // across the board
+    size_t distinct = 0;
+    for(size_t i = 1; i < n; i++)
+    {
+        if(output_host[i] != output_host[0])
+        {
+            distinct++;
+        }
+    }
+    EXPECT_GT(distinct, n / 2);
+
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(output));
+}
+
+TEST(rocrand_kernel_init_states, neg_test)
+{
+    EXPECT_EQ(rocrand_init_states(static_cast<rocrand_state_philox4x32_10*>(nullptr),
+                                  10,
+                                  0ULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Zero states is a no-op
+    rocrand_state_philox4x32_10* states;
+    HIP_CHECK(hipMallocHelper((void**)&states, sizeof(rocrand_state_philox4x32_10)));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(rocrand_init_states(states, 0, 0ULL), ROCRAND_STATUS_SUCCESS);
+    HIP_CHECK(hipFree(states));
+}
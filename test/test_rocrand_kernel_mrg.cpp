@@ -78,6 +78,32 @@ __global__ __launch_bounds__(32) void rocrand_kernel(unsigned int* output, const
     }
 }
 
+__global__ __launch_bounds__(32) void rocrand_skipahead_constant_kernel(
+    unsigned int* output, unsigned int* output_constant, const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_mrg32k3a state;
+    rocrand_state_mrg32k3a state_constant;
+    const unsigned int     subsequence = state_id;
+    rocrand_init(12345, subsequence, 0, &state);
+    rocrand_init(12345, subsequence, 0, &state_constant);
+
+    skipahead(4096ULL, &state);
+    skipahead_subsequence(8ULL, &state);
+    skipahead<4096ULL>(&state_constant);
+    skipahead_subsequence<8ULL>(&state_constant);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index]          = rocrand(&state);
+        output_constant[index] = rocrand(&state_constant);
+        index += global_size;
+    }
+}
+
 template<class GeneratorState>
 __global__ __launch_bounds__(32) void rocrand_uniform_kernel(float* output, const size_t size)
 {
@@ -241,6 +267,48 @@ TYPED_TEST(rocrand_kernel_mrg, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_mrg32k3a, skipahead_constant)
+{
+    const size_t  output_size = 8192;
+    unsigned int* output;
+    unsigned int* output_constant;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&output_constant),
+                              output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_skipahead_constant_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_constant,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<unsigned int> output_host_constant(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(output_host_constant.data(),
+                        output_constant,
+                        output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_constant));
+
+    // The compile-time skip must land on the same state as the runtime skip
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host_constant[i], output_host[i]);
+    }
+}
+
 TYPED_TEST(rocrand_kernel_mrg, rocrand_uniform)
 {
     typedef typename TestFixture::state_type state_type;
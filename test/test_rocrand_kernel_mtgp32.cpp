@@ -61,6 +61,33 @@ void rocrand_kernel(GeneratorState * states, unsigned int * output, const size_t
     rocrand_mtgp32_block_copy(&state, &states[state_id]);
 }
 
+template <class GeneratorState>
+__global__
+__launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
+void rocrand_state_copy_kernel(GeneratorState * states, unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = blockIdx.x;
+    unsigned int       index    = blockIdx.x * blockDim.x + threadIdx.x;
+    unsigned int       stride   = gridDim.x * blockDim.x;
+
+    __shared__ GeneratorState state;
+    rocrand_mtgp32_block_copy(&states[state_id], &state);
+
+    const size_t r               = size % blockDim.x;
+    const size_t size_rounded_up = r == 0 ? size : size + (blockDim.x - r);
+    while(index < size_rounded_up)
+    {
+        auto value = rocrand(&state);
+        if(index < size)
+            output[index] = value;
+        // Next position
+        index += stride;
+    }
+
+    // Hand back only the recurrence state
+    rocrand_mtgp32_state_copy(&state, &states[state_id]);
+}
+
 template <class GeneratorState>
 __global__
 __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE)
@@ -237,6 +264,75 @@ TEST(rocrand_kernel_mtgp32, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_mtgp32, rocrand_state_copy)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    state_type * states;
+    hipMallocHelper(reinterpret_cast<void**>(&states), sizeof(state_type) * 8);
+    state_type * states_handoff;
+    hipMallocHelper(reinterpret_cast<void**>(&states_handoff), sizeof(state_type) * 8);
+
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states_handoff, mtgp32dc_params_fast_11213, 8, 0));
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    unsigned int * output_handoff;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output_handoff),
+                        output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The state-only hand-off must leave the states as usable as the
+    // full copy, so a second round continues the same sequences
+    for(int round = 0; round < 2; round++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+            dim3(8), dim3(256), 0, 0,
+            states, output, output_size
+        );
+        HIP_CHECK(hipGetLastError());
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_state_copy_kernel<state_type>),
+            dim3(8), dim3(256), 0, 0,
+            states_handoff, output_handoff, output_size
+        );
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        std::vector<unsigned int> output_host_handoff(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host_handoff.data(), output_handoff,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(size_t i = 0; i < output_size; i++)
+        {
+            ASSERT_EQ(output_host_handoff[i], output_host[i]);
+        }
+    }
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_handoff));
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(states_handoff));
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_uniform)
 {
     typedef rocrand_state_mtgp32 state_type;
@@ -167,6 +167,58 @@ void rocrand_poisson_kernel(unsigned int * output, const size_t size, double lam
     }
 }
 
+__global__
+__launch_bounds__(64)
+void rocrand_poisson4_kernel(unsigned int * output, const size_t size, double lambda)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_philox4x32_10 state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(456, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id * 4;
+    while(index + 3 < size)
+    {
+        const uint4 v = rocrand_poisson4(&state, lambda);
+        output[index] = v.x;
+        output[index + 1] = v.y;
+        output[index + 2] = v.z;
+        output[index + 3] = v.w;
+        index += global_size * 4;
+    }
+}
+
+template <class GeneratorState>
+__global__
+__launch_bounds__(64)
+void rocrand_poisson_from_table_kernel(unsigned int * output, const size_t size, double lambda,
+                                       double * cdf, unsigned int capacity)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    // Every thread builds its own table, as with per-element lambdas
+    rocrand_discrete_distribution_st discrete_distribution;
+    if(!rocrand_poisson_table_init(lambda, cdf + state_id * capacity, capacity,
+                                   &discrete_distribution))
+    {
+        return;
+    }
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(456, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_poisson_from_table(&state, &discrete_distribution);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 __launch_bounds__(64)
@@ -187,6 +239,38 @@ void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_d
     }
 }
 
+// Number of alias table entries the block-staged kernel below can hold in
+// shared memory; larger tables fall back to sampling from global memory
+#define DISCRETE_STAGE_CAPACITY 512
+
+template <class GeneratorState>
+__global__
+__launch_bounds__(64)
+void rocrand_discrete_block_stage_kernel(unsigned int * output, const size_t size, rocrand_discrete_distribution discrete_distribution)
+{
+    __shared__ double shared_probability[DISCRETE_STAGE_CAPACITY];
+    __shared__ unsigned int shared_alias[DISCRETE_STAGE_CAPACITY];
+
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_discrete_distribution_st staged
+        = rocrand_discrete_block_stage(discrete_distribution,
+                                       shared_probability, shared_alias,
+                                       DISCRETE_STAGE_CAPACITY);
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(456, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_discrete(&state, &staged);
+        index += global_size;
+    }
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_state_philox4x32_10_type)
 {
     typedef rocrand_state_philox4x32_10 state_type;
@@ -210,7 +294,7 @@ TEST(rocrand_kernel_philox4x32_10, rocrand_init)
     // Just get access to internal state
     class rocrand_state_philox4x32_10_test : public rocrand_state_philox4x32_10
     {
-        typedef rocrand_state_philox4x32_10::philox4x32_10_state internal_state_type;
+        typedef rocrand_state_philox4x32_10::philox4x32_state internal_state_type;
 
     public:
 
@@ -492,6 +576,52 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson)
     EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson4)
+{
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_poisson4_kernel),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, lambda
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+
+    double variance = 0;
+    for(auto v : output_host)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / output_size;
+
+    EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
+    EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
+}
+
 TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
 {
     typedef rocrand_state_philox4x32_10 state_type;
@@ -544,6 +674,125 @@ TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete)
     EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_discrete_block_stage)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    unsigned int * output_staged;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output_staged),
+                        output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, discrete_distribution
+    );
+    HIP_CHECK(hipGetLastError());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_discrete_block_stage_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output_staged, output_size, discrete_distribution
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    std::vector<unsigned int> output_staged_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_staged_host.data(), output_staged,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_staged));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    // Sampling from the staged table (or from global memory, when the table
+    // does not fit into DISCRETE_STAGE_CAPACITY entries) must produce exactly
+    // the same values as sampling from global memory.
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_staged_host[i], output_host[i]);
+    }
+}
+
+TEST_P(rocrand_kernel_philox4x32_10_poisson, rocrand_poisson_from_table)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+
+    const unsigned int capacity =
+        2 * static_cast<unsigned int>(16.0 * (2.0 + std::sqrt(lambda)));
+    const size_t states_size = 4 * 64;
+    double * cdf;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&cdf), states_size * capacity * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_poisson_from_table_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, lambda, cdf, capacity
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(cdf));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+
+    double variance = 0;
+    for(auto v : output_host)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / output_size;
+
+    EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
+    EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
+}
+
 const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 
 INSTANTIATE_TEST_SUITE_P(rocrand_kernel_philox4x32_10_poisson,
@@ -69,6 +69,25 @@ void rocrand_kernel(unsigned int * output, unsigned int * vectors, const size_t
     }
 }
 
+template <class GeneratorState>
+__global__
+__launch_bounds__(32)
+void rocrand_skipahead_kernel(unsigned int * output, unsigned int * vectors, const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    const unsigned int n = size / global_size;
+    GeneratorState state;
+    rocrand_init(vectors, 0, &state);
+    skipahead(1234 + state_id * n, &state);
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        output[state_id * n + i] = rocrand(&state);
+    }
+}
+
 template <class GeneratorState>
 __global__
 __launch_bounds__(32)
@@ -196,6 +215,68 @@ TEST(rocrand_kernel_sobol32, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_sobol32, skipahead)
+{
+    typedef rocrand_state_sobol32 state_type;
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int * m_vector;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&m_vector), sizeof(unsigned int) * 8 * 32));
+    HIP_CHECK(hipMemcpy(m_vector,
+                        rocrand_h_sobol32_direction_vectors,
+                        sizeof(unsigned int) * 8 * 32,
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, m_vector, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Skipping ahead from the start of the sequence must land on the same
+    // position as initializing with the offset
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_skipahead_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, m_vector, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host_skipahead(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host_skipahead.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(m_vector));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host_skipahead[i], output_host[i]);
+    }
+}
+
 TEST(rocrand_kernel_sobol32, rocrand_uniform)
 {
     typedef rocrand_state_sobol32 state_type;
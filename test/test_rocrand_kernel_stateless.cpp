@@ -0,0 +1,230 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+__global__ __launch_bounds__(32) void rocrand_stateless_kernel(unsigned int* output,
+                                                               const size_t  size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_stateless(12345, index);
+        index += global_size;
+    }
+}
+
+__global__ __launch_bounds__(32) void rocrand_stateless_long_long_kernel(unsigned long long* output,
+                                                                         const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_stateless_long_long(12345, index);
+        index += global_size;
+    }
+}
+
+__global__ __launch_bounds__(32) void rocrand_stateless_uniform_kernel(float*       output,
+                                                                       const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_stateless_uniform(12345, index);
+        index += global_size;
+    }
+}
+
+__global__ __launch_bounds__(32) void rocrand_stateless_uniform2_kernel(float*       output,
+                                                                        const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    unsigned int index = state_id;
+    while(index < size / 2)
+    {
+        const float2 v        = rocrand_stateless_uniform2(12345, index);
+        output[2 * index]     = v.x;
+        output[2 * index + 1] = v.y;
+        index += global_size;
+    }
+}
+
+TEST(rocrand_kernel_stateless, rocrand_stateless)
+{
+    const size_t  output_size = 8192;
+    unsigned int* output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_stateless_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The hash is stateless, so a second launch with a different grid
+    // must reproduce the values index by index.
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_stateless_kernel),
+                       dim3(4),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host2(output_size);
+    HIP_CHECK(hipMemcpy(output_host2.data(),
+                        output,
+                        output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], output_host2[i]);
+        mean += static_cast<double>(output_host[i]) / UINT_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_stateless, rocrand_stateless_long_long)
+{
+    const size_t        output_size = 8192;
+    unsigned long long* output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_stateless_long_long_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned long long> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(unsigned long long),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / ULLONG_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_stateless, rocrand_stateless_uniform)
+{
+    const size_t output_size = 8192;
+    float*       output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_stateless_uniform_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(output_host.data(), output, output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_stateless_uniform2_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host2(output_size);
+    HIP_CHECK(
+        hipMemcpy(output_host2.data(), output, output_size * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_GT(output_host[i], 0.0f);
+        ASSERT_LE(output_host[i], 1.0f);
+        // The first word of each hash is shared between the scalar and
+        // the two-value variants.
+        if(i % 2 == 0)
+        {
+            ASSERT_EQ(output_host2[i], output_host[i / 2]);
+        }
+        mean += static_cast<double>(output_host[i]);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
@@ -0,0 +1,295 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+__global__ __launch_bounds__(32) void stochastic_round_bf16_kernel(const float  value,
+                                                                   float*       output,
+                                                                   const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(0xdeadbeefdeadbeefULL, state_id, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = static_cast<float>(rocrand_stochastic_round_bf16(&state, value));
+        index += global_size;
+    }
+}
+
+__global__ __launch_bounds__(32) void stochastic_round_half_kernel(const float  value,
+                                                                   float*       output,
+                                                                   const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(0xdeadbeefdeadbeefULL, state_id, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = __half2float(rocrand_stochastic_round_half(&state, value));
+        index += global_size;
+    }
+}
+
+__global__ __launch_bounds__(32) void stochastic_round_bf16_4_kernel(const float  value,
+                                                                     float*       output,
+                                                                     const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(0xdeadbeefdeadbeefULL, state_id, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size / 4)
+    {
+        const float  input[4] = {value, value, value, value};
+        hip_bfloat16 rounded[4];
+        rocrand_stochastic_round_bf16_4(&state, input, rounded);
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            output[4 * index + i] = static_cast<float>(rounded[i]);
+        }
+        index += global_size;
+    }
+}
+
+// bfloat16 neighbours of v, computed by truncating the low 16 float bits
+void bf16_neighbours(const float value, float& lo, float& hi)
+{
+    unsigned int bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const unsigned int lo_bits = bits & 0xFFFF0000u;
+    const unsigned int hi_bits = lo_bits + 0x00010000u;
+    std::memcpy(&lo, &lo_bits, sizeof(lo));
+    std::memcpy(&hi, &hi_bits, sizeof(hi));
+}
+
+TEST(rocrand_kernel_stochastic_round, bf16_unbiased)
+{
+    // Sits a third of the way between two bfloat16 values
+    const float value = 1.0f + 1.0f / 3.0f;
+    float       lo, hi;
+    bf16_neighbours(value, lo, hi);
+
+    const size_t output_size = 65536;
+    float*       output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(stochastic_round_bf16_kernel),
+                       dim3(32),
+                       dim3(32),
+                       0,
+                       0,
+                       value,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    size_t ups = 0;
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_TRUE(output_host[i] == lo || output_host[i] == hi) << "where index = " << i;
+        if(output_host[i] == hi)
+        {
+            ups++;
+        }
+    }
+    // The round-up probability equals the dropped fraction of the value
+    const double expected = (value - lo) / (hi - lo);
+    EXPECT_NEAR(static_cast<double>(ups) / output_size, expected, 0.02);
+}
+
+TEST(rocrand_kernel_stochastic_round, half_unbiased)
+{
+    const float value = 1.0f + 1.0f / 3.0f;
+    // Neighbouring halfs around the value, which has an 11-bit spacing
+    // of 2^-10 at this magnitude
+    const float lo = __half2float(__float2half_rz(value));
+    const float hi = lo + 1.0f / 1024.0f;
+
+    const size_t output_size = 65536;
+    float*       output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(stochastic_round_half_kernel),
+                       dim3(32),
+                       dim3(32),
+                       0,
+                       0,
+                       value,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    size_t ups = 0;
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_TRUE(output_host[i] == lo || output_host[i] == hi) << "where index = " << i;
+        if(output_host[i] == hi)
+        {
+            ups++;
+        }
+    }
+    const double expected = (value - lo) / (hi - lo);
+    EXPECT_NEAR(static_cast<double>(ups) / output_size, expected, 0.02);
+}
+
+TEST(rocrand_kernel_stochastic_round, bf16_batched_unbiased)
+{
+    const float value = 2.0f + 2.0f / 3.0f;
+    float       lo, hi;
+    bf16_neighbours(value, lo, hi);
+
+    const size_t output_size = 65536;
+    float*       output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(stochastic_round_bf16_4_kernel),
+                       dim3(32),
+                       dim3(32),
+                       0,
+                       0,
+                       value,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    size_t ups = 0;
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_TRUE(output_host[i] == lo || output_host[i] == hi) << "where index = " << i;
+        if(output_host[i] == hi)
+        {
+            ups++;
+        }
+    }
+    const double expected = (value - lo) / (hi - lo);
+    EXPECT_NEAR(static_cast<double>(ups) / output_size, expected, 0.02);
+}
+
+TEST(rocrand_kernel_stochastic_round, exact_values_unchanged)
+{
+    // Values already representable in the target format must never be
+    // perturbed, whatever the drawn bits are
+    const float value = 0.75f;
+    float       lo, hi;
+    bf16_neighbours(value, lo, hi);
+    ASSERT_EQ(lo, value);
+
+    const size_t output_size = 4096;
+    float*       output;
+    HIP_CHECK(hipMallocHelper((void**)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(stochastic_round_bf16_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       value,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], value) << "where index = " << i;
+    }
+
+    // value is exact in half as well
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(stochastic_round_half_kernel),
+                       dim3(8),
+                       dim3(32),
+                       0,
+                       0,
+                       value,
+                       output,
+                       output_size);
+    HIP_CHECK(hipGetLastError());
+
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], value) << "where index = " << i;
+    }
+}
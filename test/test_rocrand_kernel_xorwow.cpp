@@ -72,6 +72,56 @@ void rocrand_kernel(unsigned int * output, const size_t size)
     }
 }
 
+__global__
+// __launch_bounds__(64) // Causes errors on MI200/HIP on Windows gfx1030
+void rocrand_init_block_kernel(unsigned int * output, const size_t size)
+{
+    __shared__ unsigned int shared_jump_matrix[XORWOW_SIZE];
+
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_xorwow state;
+    const unsigned int subsequence = state_id;
+    rocrand_init_block(0, subsequence, 123ULL, &state, shared_jump_matrix);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        index += global_size;
+    }
+}
+
+__global__
+// __launch_bounds__(64) // Causes errors on MI200/HIP on Windows gfx1030
+void rocrand_skipahead_constant_kernel(unsigned int * output,
+                                       unsigned int * output_constant,
+                                       const size_t size)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    rocrand_state_xorwow state;
+    rocrand_state_xorwow state_constant;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 123ULL, &state);
+    rocrand_init(0, subsequence, 123ULL, &state_constant);
+
+    skipahead(4096ULL, &state);
+    skipahead_subsequence(8ULL, &state);
+    skipahead<4096ULL>(&state_constant);
+    skipahead_subsequence<8ULL>(&state_constant);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        output_constant[index] = rocrand(&state_constant);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 // __launch_bounds__(64) // Causes errors on MI200/HIP on Windows gfx1030
@@ -189,6 +239,12 @@ TEST(rocrand_kernel_xorwow, rocrand_state_xorwow_type)
     EXPECT_EQ(sizeof(state_type[32]), 32 * sizeof(rocrand_state_xorwow));
     EXPECT_TRUE(std::is_trivially_copyable<state_type>::value);
     EXPECT_TRUE(std::is_trivially_destructible<state_type>::value);
+
+    // The raw state drops the Box-Muller bank and nothing else
+    typedef rocrand_state_xorwow_raw raw_state_type;
+    EXPECT_EQ(sizeof(raw_state_type), 6 * sizeof(unsigned int));
+    EXPECT_TRUE(std::is_trivially_copyable<raw_state_type>::value);
+    EXPECT_TRUE(std::is_trivially_destructible<raw_state_type>::value);
 }
 
 TEST(rocrand_kernel_xorwow, rocrand_init)
@@ -253,6 +309,104 @@ TEST(rocrand_kernel_xorwow, rocrand_init)
     }
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_init_block)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The cooperative init must produce the same states as the
+    // per-thread init
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_block_kernel),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host_block(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host_block.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host_block[i], output_host[i]);
+    }
+}
+
+TEST(rocrand_kernel_xorwow, skipahead_constant)
+{
+    const size_t output_size = 8192;
+    unsigned int * output;
+    unsigned int * output_constant;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&output_constant),
+                              output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_skipahead_constant_kernel),
+        dim3(4), dim3(64), 0, 0,
+        output, output_constant, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<unsigned int> output_host_constant(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(
+        hipMemcpy(
+            output_host_constant.data(), output_constant,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_constant));
+
+    // The compile-time skip must land on the same state as the runtime skip
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host_constant[i], output_host[i]);
+    }
+}
+
 TEST(rocrand_kernel_xorwow, rocrand)
 {
     typedef rocrand_state_xorwow state_type;
@@ -290,6 +444,58 @@ TEST(rocrand_kernel_xorwow, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_raw_state)
+{
+    // The raw state shares the generation functions and the integer
+    // sequence with the full state; only the normal bank is missing
+    const size_t output_size = 8192;
+    unsigned int * output;
+    unsigned int * output_raw;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output), output_size * sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&output_raw), output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<rocrand_state_xorwow>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<rocrand_state_xorwow_raw>),
+        dim3(4), dim3(64), 0, 0,
+        output_raw, output_size
+    );
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    std::vector<unsigned int> output_raw_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(
+        hipMemcpy(
+            output_raw_host.data(), output_raw,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_raw));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_raw_host[i], output_host[i]) << "where index = " << i;
+    }
+}
+
 TEST(rocrand_kernel_xorwow, rocrand_uniform)
 {
     typedef rocrand_state_xorwow state_type;
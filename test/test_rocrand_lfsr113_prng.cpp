@@ -287,6 +287,34 @@ TEST(rocrand_lfsr113_prng_tests, different_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// The 64-bit seed is expanded with splitmix64, so every component meets
+// the LFSR113 lower bound and nearby seeds produce unrelated states.
+TEST(rocrand_lfsr113_prng_tests, seed_expansion_test)
+{
+    const unsigned long long seeds[] = {0ULL, 1ULL, 2ULL, 0xFFFFFFFFFFFFFFFFULL};
+    for(const unsigned long long seed : seeds)
+    {
+        rocrand_lfsr113 g;
+        g.set_seed(seed);
+        const uint4 s = g.get_seed();
+        EXPECT_GE(s.x, static_cast<unsigned int>(ROCRAND_LFSR113_DEFAULT_SEED_X));
+        EXPECT_GE(s.y, static_cast<unsigned int>(ROCRAND_LFSR113_DEFAULT_SEED_Y));
+        EXPECT_GE(s.z, static_cast<unsigned int>(ROCRAND_LFSR113_DEFAULT_SEED_Z));
+        EXPECT_GE(s.w, static_cast<unsigned int>(ROCRAND_LFSR113_DEFAULT_SEED_W));
+    }
+
+    // Consecutive seeds expand to states that differ in every component
+    rocrand_lfsr113 g0, g1;
+    g0.set_seed(0ULL);
+    g1.set_seed(1ULL);
+    const uint4 s0 = g0.get_seed();
+    const uint4 s1 = g1.get_seed();
+    EXPECT_NE(s0.x, s1.x);
+    EXPECT_NE(s0.y, s1.y);
+    EXPECT_NE(s0.z, s1.z);
+    EXPECT_NE(s0.w, s1.w);
+}
+
 // Checks if generators with the same seed and in the same state generate
 // the same numbers
 TEST(rocrand_lfsr113_prng_tests, different_seed_uint4_test)
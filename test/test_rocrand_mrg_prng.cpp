@@ -440,6 +440,51 @@ TYPED_TEST(rocrand_mrg_prng_tests, different_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Zero is a regular seed since the splitmix64 seed expansion; it no
+// longer aliases the default seed.
+TYPED_TEST(rocrand_mrg_prng_tests, zero_seed_test)
+{
+    // Device side data
+    const size_t  size = 1024;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generators
+    typename TestFixture::mrg_type g0, g1;
+    // 12345 is the default seed of both MRG generators, which zero
+    // seeds used to be replaced with
+    g0.set_seed(0ULL);
+    g1.set_seed(12345ULL);
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(g1_host_data[i] == g0_host_data[i])
+            same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
 TYPED_TEST(rocrand_mrg_prng_tests, discard_test)
 {
     typedef typename TestFixture::mrg_type mrg_type;
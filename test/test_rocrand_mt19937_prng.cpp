@@ -326,6 +326,39 @@ __global__ __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_kerne
     engines[thread_id] = engine;
 }
 
+TEST(rocrand_mt19937_prng_tests, discard_subsequences_test)
+{
+    using engine_type = ::rocrand_host::detail::mt19937_engine;
+    constexpr unsigned long long int seed          = 12345678ULL;
+    constexpr unsigned int           state_size    = 624U;
+    constexpr unsigned int           jump_counts[] = {1U, 2U, 3U, 7U, 12U};
+
+    engine_type  chain(seed);
+    unsigned int chained = 0;
+    for(unsigned int count : jump_counts)
+    {
+        // advance the chain with single jumps up to count subsequences
+        while(chained < count)
+        {
+            chain.discard_subsequence();
+            chained++;
+        }
+
+        // jumping directly with the power-of-two jump polynomials must give
+        // the same state, except for the 31 low bits of the oldest element,
+        // which the recurrence never reads
+        engine_type direct(seed);
+        direct.discard_subsequences(count);
+
+        ASSERT_EQ(chain.m_state.ptr, direct.m_state.ptr);
+        ASSERT_EQ(chain.m_state.mt[0] & 0x80000000U, direct.m_state.mt[0] & 0x80000000U);
+        for(unsigned int i = 1; i < state_size; i++)
+        {
+            ASSERT_EQ(chain.m_state.mt[i], direct.m_state.mt[i]);
+        }
+    }
+}
+
 TEST(rocrand_mt19937_prng_tests, subsequence_test)
 {
     using engine_type      = ::rocrand_host::detail::mt19937_engine;
@@ -492,6 +492,13 @@ TEST(rocrand_philox_prng_tests, continuity_uniform_char_test)
     continuity_test<unsigned char>([](rocrand_philox4x32_10& g, unsigned char * data, size_t s) { g.generate(data, s); }, 4);
 }
 
+TEST(rocrand_philox_prng_tests, continuity_uniform_char_unaligned_test)
+{
+    // The banked remainder keeps the sequence gapless even when the
+    // sizes are not multiples of the output width
+    continuity_test<unsigned char>([](rocrand_philox4x32_10& g, unsigned char * data, size_t s) { g.generate(data, s); });
+}
+
 TEST(rocrand_philox_prng_tests, continuity_uniform_float_test)
 {
     continuity_test<float>([](rocrand_philox4x32_10& g, float * data, size_t s) { g.generate_uniform(data, s); });
@@ -507,6 +514,11 @@ TEST(rocrand_philox_prng_tests, continuity_normal_float_test)
     continuity_test<float>([](rocrand_philox4x32_10& g, float * data, size_t s) { g.generate_normal(data, s, 0.0f, 1.0f); }, 2);
 }
 
+TEST(rocrand_philox_prng_tests, continuity_normal_float_unaligned_test)
+{
+    continuity_test<float>([](rocrand_philox4x32_10& g, float * data, size_t s) { g.generate_normal(data, s, 0.0f, 1.0f); });
+}
+
 TEST(rocrand_philox_prng_tests, continuity_normal_double_test)
 {
     continuity_test<double>([](rocrand_philox4x32_10& g, double * data, size_t s) { g.generate_normal(data, s, 0.0, 1.0); }, 2);
@@ -526,3 +538,46 @@ TEST(rocrand_philox_prng_tests, continuity_poisson_test)
 {
     continuity_test<unsigned int>([](rocrand_philox4x32_10& g, unsigned int * data, size_t s) { g.generate_poisson(data, s, 100.0); });
 }
+
+// The reduced-round Philox4x32-7 generator shares the counter layout of
+// the 10-round generator but must produce a different stream.
+TEST(rocrand_philox_prng_tests, reduced_round_stream_test)
+{
+    const size_t  size = 1024;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    rocrand_philox4x32_10 g10;
+    g10.set_seed(seed);
+    ROCRAND_CHECK(g10.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data10[size];
+    HIP_CHECK(hipMemcpy(host_data10, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_philox4x32_7 g7;
+    g7.set_seed(seed);
+    ROCRAND_CHECK(g7.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data7[size];
+    HIP_CHECK(hipMemcpy(host_data7, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data10[i] == host_data7[i])
+            same++;
+        sum += host_data7[i];
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,207 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+void sample_without_replacement(std::vector<unsigned int>& results,
+                                const size_t n,
+                                const double* weights_device,
+                                const unsigned long long seed)
+{
+    const size_t k = results.size();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), k * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_sample_without_replacement(generator, data, k, n, weights_device));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(results.data(), data, k * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Every selected index is in range and no index is selected twice
+void assert_valid_sample(const std::vector<unsigned int>& results, const size_t n)
+{
+    std::vector<char> seen(n, 0);
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_LT(results[i], n) << "where index = " << i;
+        ASSERT_EQ(seen[results[i]], 0) << "where index = " << i;
+        seen[results[i]] = 1;
+    }
+}
+
+TEST(rocrand_sample_without_replacement_tests, uniform_test)
+{
+    // Not a power of two, so the cycle-walking path is exercised
+    const size_t n = 100003;
+    const size_t k = 10000;
+    std::vector<unsigned int> results(k);
+    sample_without_replacement(results, n, NULL, 11111ULL);
+
+    assert_valid_sample(results, n);
+}
+
+TEST(rocrand_sample_without_replacement_tests, weighted_test)
+{
+    const size_t n = 8192;
+    const size_t k = 1024;
+
+    // Even indexes weigh 100 times the odd ones; nearly the whole sample
+    // is expected to come from them (about 12 odd winners in expectation)
+    std::vector<double> weights_host(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        weights_host[i] = i % 2 == 0 ? 100.0 : 1.0;
+    }
+    double* weights;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&weights), n * sizeof(double)));
+    HIP_CHECK(hipMemcpy(weights, weights_host.data(), n * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    std::vector<unsigned int> results(k);
+    sample_without_replacement(results, n, weights, 22222ULL);
+    HIP_CHECK(hipFree(weights));
+
+    assert_valid_sample(results, n);
+
+    size_t heavy = 0;
+    for(size_t i = 0; i < k; i++)
+    {
+        heavy += results[i] % 2 == 0 ? 1 : 0;
+    }
+    EXPECT_GT(heavy, k * 9 / 10);
+}
+
+TEST(rocrand_sample_without_replacement_tests, reproducibility_test)
+{
+    const size_t n = 65537;
+    const size_t k = 4096;
+    std::vector<unsigned int> results0(k);
+    std::vector<unsigned int> results1(k);
+
+    // The same seed selects the same set; the order carries no meaning,
+    // so the sets are compared sorted
+    sample_without_replacement(results0, n, NULL, 54321ULL);
+    sample_without_replacement(results1, n, NULL, 54321ULL);
+    std::sort(results0.begin(), results0.end());
+    std::sort(results1.begin(), results1.end());
+    for(size_t i = 0; i < k; i++)
+    {
+        ASSERT_EQ(results0[i], results1[i]) << "where index = " << i;
+    }
+
+    sample_without_replacement(results1, n, NULL, 54322ULL);
+    std::sort(results1.begin(), results1.end());
+    size_t different = 0;
+    for(size_t i = 0; i < k; i++)
+    {
+        different += results0[i] != results1[i] ? 1 : 0;
+    }
+    EXPECT_GT(different, k / 2);
+}
+
+// The host backend keys the same Feistel network off the same sequence,
+// so a uniform sample of a host generator matches the device generator
+// of the same seed index by index
+TEST(rocrand_sample_without_replacement_tests, uniform_host_device_match_test)
+{
+    const size_t n = 65537;
+    const size_t k = 1000;
+    std::vector<unsigned int> device_results(k);
+    sample_without_replacement(device_results, n, NULL, 987654321ULL);
+
+    rocrand_generator h = NULL;
+    std::vector<unsigned int> host_results(k);
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 987654321ULL));
+    ROCRAND_CHECK(rocrand_sample_without_replacement(h, host_results.data(), k, n, NULL));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    for(size_t i = 0; i < k; i++)
+    {
+        ASSERT_EQ(host_results[i], device_results[i]) << "where index = " << i;
+    }
+}
+
+// For a host generator the weights are read from host memory
+TEST(rocrand_sample_without_replacement_tests, weighted_host_test)
+{
+    const size_t n = 8192;
+    const size_t k = 1024;
+    std::vector<double> weights(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        weights[i] = i % 2 == 0 ? 100.0 : 1.0;
+    }
+
+    rocrand_generator h = NULL;
+    std::vector<unsigned int> results(k);
+    ROCRAND_CHECK(rocrand_create_generator_host(&h, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(h, 33333ULL));
+    ROCRAND_CHECK(
+        rocrand_sample_without_replacement(h, results.data(), k, n, weights.data()));
+    ROCRAND_CHECK(rocrand_destroy_generator(h));
+
+    assert_valid_sample(results, n);
+
+    size_t heavy = 0;
+    for(size_t i = 0; i < k; i++)
+    {
+        heavy += results[i] % 2 == 0 ? 1 : 0;
+    }
+    EXPECT_GT(heavy, k * 9 / 10);
+}
+
+TEST(rocrand_sample_without_replacement_tests, neg_test)
+{
+    const size_t n = 256;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_sample_without_replacement(generator, NULL, n, n, NULL),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    // Only PHILOX4_32_10 generators are supported
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_sample_without_replacement(generator, NULL, n, n, NULL),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // A sample cannot be larger than the set it is drawn from
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_sample_without_replacement(generator, NULL, n + 1, n, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
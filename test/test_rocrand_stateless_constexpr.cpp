@@ -0,0 +1,109 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_kernel.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+#if __cplusplus >= 201402L
+// The whole point of the *_block functions: evaluable at compile time
+static_assert(rocrand_philox4x32_10_block(uint4{0, 0, 0, 0}, uint2{0, 0}).x == 0x6627e8d5u,
+              "Philox-4x32-10 must be constexpr-evaluable");
+static_assert(rocrand_threefry2x32_20_block(uint2{0, 0}, uint2{0, 0}).x == 0x6b200159u,
+              "Threefry-2x32-20 must be constexpr-evaluable");
+static_assert(rocrand_threefry2x64_20_block(ulonglong2{0, 0}, ulonglong2{0, 0}).x
+                  == 0xc2b6e3a8c2c69865ULL,
+              "Threefry-2x64-20 must be constexpr-evaluable");
+#endif
+
+// Known-answer vectors from the Random123 test suite
+TEST(rocrand_stateless_constexpr, philox4x32_10_kat)
+{
+    const uint4 zeros = rocrand_philox4x32_10_block(uint4{0, 0, 0, 0}, uint2{0, 0});
+    EXPECT_EQ(zeros.x, 0x6627e8d5u);
+    EXPECT_EQ(zeros.y, 0xe169c58du);
+    EXPECT_EQ(zeros.z, 0xbc57ac4cu);
+    EXPECT_EQ(zeros.w, 0x9b00dbd8u);
+
+    const uint4 ones
+        = rocrand_philox4x32_10_block(uint4{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                                      uint2{0xffffffffu, 0xffffffffu});
+    EXPECT_EQ(ones.x, 0x408f276du);
+    EXPECT_EQ(ones.y, 0x41c83b0eu);
+    EXPECT_EQ(ones.z, 0xa20bc7c6u);
+    EXPECT_EQ(ones.w, 0x6d5451fdu);
+}
+
+TEST(rocrand_stateless_constexpr, threefry2x32_20_kat)
+{
+    const uint2 zeros = rocrand_threefry2x32_20_block(uint2{0, 0}, uint2{0, 0});
+    EXPECT_EQ(zeros.x, 0x6b200159u);
+    EXPECT_EQ(zeros.y, 0x99ba4efeu);
+}
+
+TEST(rocrand_stateless_constexpr, threefry2x64_20_kat)
+{
+    const ulonglong2 zeros = rocrand_threefry2x64_20_block(ulonglong2{0, 0}, ulonglong2{0, 0});
+    EXPECT_EQ(zeros.x, 0xc2b6e3a8c2c69865ULL);
+    EXPECT_EQ(zeros.y, 0x6f81ed42f350084dULL);
+}
+
+// The constexpr restatements must track the engine-backed stateless
+// functions word for word
+TEST(rocrand_stateless_constexpr, matches_stateless)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+    for(unsigned long long index = 0; index < 1000; index++)
+    {
+        const uint2 expected = rocrand_stateless2(seed, index);
+        const uint2 actual   = rocrand_threefry_at(seed, index);
+        ASSERT_EQ(actual.x, expected.x) << "where index = " << index;
+        ASSERT_EQ(actual.y, expected.y) << "where index = " << index;
+
+        ASSERT_EQ(rocrand_threefry_long_long_at(seed, index).x,
+                  rocrand_stateless_long_long(seed, index))
+            << "where index = " << index;
+    }
+}
+
+// The (seed, index) mapping must equal what a Philox engine seeded the
+// same way produces for its first counter block
+TEST(rocrand_stateless_constexpr, philox_at_matches_engine)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(seed, 0, 0, &state);
+    const uint4 expected = rocrand4(&state);
+
+    const uint4 actual = rocrand_philox_at(seed, 0);
+    EXPECT_EQ(actual.x, expected.x);
+    EXPECT_EQ(actual.y, expected.y);
+    EXPECT_EQ(actual.z, expected.z);
+    EXPECT_EQ(actual.w, expected.w);
+}
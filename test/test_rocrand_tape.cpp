@@ -0,0 +1,194 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <string>
+#include <vector>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+static std::string tape_path(const char * name)
+{
+    return testing::TempDir() + name;
+}
+
+TEST(rocrand_tape_tests, round_trip_test)
+{
+    const std::string path = tape_path("rocrand_tape_round_trip.bin");
+    const size_t size = 65536;
+
+    // Record a tape and generate the same stream directly with a second
+    // generator of the same seed
+    rocrand_generator source;
+    ROCRAND_CHECK(rocrand_create_generator(&source, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(source, 0xdeadbeefdeadbeefULL));
+    ROCRAND_CHECK(rocrand_write_tape(source, path.c_str(), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_destroy_generator(source));
+
+    rocrand_generator reference;
+    ROCRAND_CHECK(rocrand_create_generator(&reference, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(reference, 0xdeadbeefdeadbeefULL));
+
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate(reference, data, size));
+
+    // Replay the tape in two chunks; the concatenation must be the
+    // byte-exact recorded stream
+    rocrand_generator tape;
+    ROCRAND_CHECK(rocrand_create_tape_generator(&tape, path.c_str()));
+    ROCRAND_CHECK(rocrand_generate(tape, data + size, size / 2));
+    ROCRAND_CHECK(rocrand_generate(tape, data + size + size / 2, size - size / 2));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, 2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_data[size + i]) << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(tape));
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+    remove(path.c_str());
+}
+
+TEST(rocrand_tape_tests, set_offset_test)
+{
+    const std::string path = tape_path("rocrand_tape_set_offset.bin");
+    const size_t size = 4096;
+    const size_t offset = 1000;
+
+    rocrand_generator source;
+    ROCRAND_CHECK(rocrand_create_generator(&source, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_write_tape(source, path.c_str(), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_destroy_generator(source));
+
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data),
+                              2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator tape;
+    ROCRAND_CHECK(rocrand_create_tape_generator(&tape, path.c_str()));
+    ROCRAND_CHECK(rocrand_generate(tape, data, size));
+
+    // Repositioning must serve the same recorded values again
+    ROCRAND_CHECK(rocrand_set_offset(tape, offset));
+    ROCRAND_CHECK(rocrand_generate(tape, data + size, size - offset));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(2 * size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, 2 * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size - offset; i++)
+    {
+        ASSERT_EQ(host_data[offset + i], host_data[size + i])
+            << "where index = " << i;
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(tape));
+    remove(path.c_str());
+}
+
+TEST(rocrand_tape_tests, exhausted_test)
+{
+    const std::string path = tape_path("rocrand_tape_exhausted.bin");
+    const size_t size = 256;
+
+    rocrand_generator source;
+    ROCRAND_CHECK(rocrand_create_generator(&source, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_write_tape(source, path.c_str(), size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_destroy_generator(source));
+
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator tape;
+    ROCRAND_CHECK(rocrand_create_tape_generator(&tape, path.c_str()));
+
+    // A call past the end of the tape fails without writing anything
+    EXPECT_EQ(rocrand_generate(tape, data, size + 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate(tape, data, size));
+    EXPECT_EQ(rocrand_generate(tape, data, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Typed distribution calls are not supported on tapes
+    float * float_data = reinterpret_cast<float *>(data);
+    EXPECT_EQ(rocrand_generate_uniform(tape, float_data, size), ROCRAND_STATUS_TYPE_ERROR);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(tape));
+    remove(path.c_str());
+}
+
+TEST(rocrand_tape_tests, bad_file_test)
+{
+    rocrand_generator tape = NULL;
+
+    // Missing file
+    EXPECT_EQ(rocrand_create_tape_generator(&tape,
+                                            tape_path("rocrand_tape_missing.bin").c_str()),
+              ROCRAND_STATUS_INTERNAL_ERROR);
+
+    // A file without the tape header is rejected
+    const std::string path = tape_path("rocrand_tape_garbage.bin");
+    FILE * file = fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    const char garbage[64] = "not a tape";
+    ASSERT_EQ(fwrite(garbage, 1, sizeof(garbage), file), sizeof(garbage));
+    fclose(file);
+    EXPECT_EQ(rocrand_create_tape_generator(&tape, path.c_str()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    remove(path.c_str());
+}
+
+TEST(rocrand_tape_tests, neg_test)
+{
+    const std::string path = tape_path("rocrand_tape_neg.bin");
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(rocrand_write_tape(generator, path.c_str(), 256),
+              ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_create_tape_generator(NULL, path.c_str()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_write_tape(generator, NULL, 256), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_write_tape(generator, path.c_str(), 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_write_tape(generator, path.c_str(), 7), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -617,3 +617,49 @@ TEST(rocrand_threefry_prng_tests, continuity_poisson_test)
                                  { g.generate_poisson(data, s, 100.); },
                                  rocrand_poisson_distribution<>::output_width);
 }
+
+// The reduced-round Threefry4x64-13 generator shares the counter layout
+// of the 20-round generator but must produce a different stream.
+TEST(rocrand_threefry_prng_tests, reduced_round_stream_test)
+{
+    const size_t        size = 1024;
+    unsigned long long* data;
+    HIP_CHECK(
+        hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned long long) * size));
+
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    rocrand_threefry4x64_20 g20;
+    g20.set_seed(seed);
+    ROCRAND_CHECK(g20.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned long long> host_data20(size);
+    HIP_CHECK(hipMemcpy(host_data20.data(),
+                        data,
+                        sizeof(unsigned long long) * size,
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_threefry4x64_13 g13;
+    g13.set_seed(seed);
+    ROCRAND_CHECK(g13.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned long long> host_data13(size);
+    HIP_CHECK(hipMemcpy(host_data13.data(),
+                        data,
+                        sizeof(unsigned long long) * size,
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data20[i] == host_data13[i])
+            same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,499 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+TEST(rocrand_well19937_prng_tests, uniform_uint_test)
+{
+    const size_t  size = 1313;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    rocrand_well19937 g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_well19937_prng_tests, uniform_float_test)
+{
+    const size_t size = 1313;
+    float*       data;
+    hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(float) * size);
+
+    rocrand_well19937 g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_well19937_prng_tests, normal_float_test)
+{
+    const size_t size = 1313;
+    float*       data;
+    hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(float) * size);
+
+    rocrand_well19937 g;
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0f, 5.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float mean = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+
+    float std = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0f, mean, 0.4f); // 20%
+    EXPECT_NEAR(5.0f, std, 1.0f); // 20%
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_well19937_prng_tests, poisson_test)
+{
+    const size_t  size = 1313;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    rocrand_well19937 g;
+    ROCRAND_CHECK(g.generate_poisson(data, size, 5.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean /= size;
+
+    double var = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        double x = host_data[i] - mean;
+        var += x * x;
+    }
+    var /= size;
+
+    EXPECT_NEAR(mean, 5.5, std::max(1.0, 5.5 * 1e-2));
+    EXPECT_NEAR(var, 5.5, std::max(1.0, 5.5 * 1e-2));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Check if the numbers generated by first generate() call are different from
+// the numbers generated by the 2nd call (same generator)
+TEST(rocrand_well19937_prng_tests, state_progress_test)
+{
+    // Device data
+    const size_t  size = 1025;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generator
+    rocrand_well19937 g0;
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data2[size];
+    HIP_CHECK(hipMemcpy(host_data2, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data1[i] == host_data2[i])
+            same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state
+// generate the same numbers
+TEST(rocrand_well19937_prng_tests, same_seed_test)
+{
+    const unsigned long long seed = 5ULL;
+
+    // Device side data
+    const size_t  size = 1024;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_well19937 g0, g1;
+    // Set same seeds
+    g0.set_seed(seed);
+    g1.set_seed(seed);
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Numbers generated using same generator with same
+    // seed should be the same
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state generate
+// the same numbers
+TEST(rocrand_well19937_prng_tests, different_seed_test)
+{
+    const unsigned long long seed0 = 5ULL;
+    const unsigned long long seed1 = 10ULL;
+
+    // Device side data
+    const size_t  size = 1024;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_well19937 g0, g1;
+    // Set different seeds
+    g0.set_seed(seed0);
+    g1.set_seed(seed1);
+    ASSERT_NE(g0.get_seed(), g1.get_seed());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(g1_host_data[i] == g0_host_data[i])
+            same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+/// Initialize the interleaved device state for both generators.
+/// Skip \p subsequence_size states for the first generator.
+__global__ __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void init_engines_kernel(
+    unsigned int*                             state,
+    unsigned int*                             state_ptrs,
+    ::rocrand_host::detail::well19937_engine* engines,
+    unsigned int                              subsequence_size)
+{
+    const unsigned int gen_id = blockIdx.x * blockDim.x + threadIdx.x;
+    for(unsigned int w = 0; w < ::rocrand_host::detail::well_n; w++)
+    {
+        state[w * well19937_generator_count + gen_id] = engines[gen_id].m_state.v[w];
+    }
+    state_ptrs[gen_id] = 0;
+
+    if(gen_id == 0)
+    {
+        ::rocrand_host::detail::well19937_device_engine engine(state, gen_id, 0);
+        for(unsigned int i = 0; i < subsequence_size; i++)
+        {
+            engine();
+        }
+        state_ptrs[gen_id] = engine.ptr;
+    }
+}
+
+/// Each generator produces \p n elements in its own \p data section.
+__global__ __launch_bounds__(ROCRAND_DEFAULT_MAX_BLOCK_SIZE) void generate_kernel(
+    unsigned int* state, unsigned int* state_ptrs, unsigned int* data, unsigned int n)
+{
+    const unsigned int gen_id = blockIdx.x * blockDim.x + threadIdx.x;
+    unsigned int*      ptr    = data + gen_id * n;
+
+    ::rocrand_host::detail::well19937_device_engine engine(state, gen_id, state_ptrs[gen_id]);
+
+    for(unsigned int index = 0; index < n; index++)
+    {
+        ptr[index] = engine();
+    }
+
+    state_ptrs[gen_id] = engine.ptr;
+}
+
+TEST(rocrand_well19937_prng_tests, subsequence_test)
+{
+    using engine_type = ::rocrand_host::detail::well19937_engine;
+    constexpr unsigned long long int seed             = 1ULL;
+    constexpr unsigned int           subsequence_size = 552552U;
+    constexpr unsigned int           generator_count  = 2U;
+    constexpr unsigned int           state_size       = 624U;
+
+    // Constants to skip subsequence_size states, reduced modulo the minimal
+    // polynomial computed by tools/well19937_precomputed_generator.cpp
+    // clang-format off
+    static constexpr unsigned int jump[well19937_p_size] = {
+        3731897264U, 3891207435U, 3411417693U, 3911042804U,  353803597U,  200182807U, 3135507148U, 4178412354U, 
+        4289414876U, 3927353866U, 2951114729U, 1838580741U, 1397553204U,  569395369U, 1336095599U, 3836930045U, 
+        1343479037U, 3754586668U, 2657461602U, 2545285239U, 4067531979U, 2276144246U,  389215642U, 4175217570U, 
+        2051556408U, 1573306801U, 1521690464U,  526179137U, 3559693519U,  325133323U, 2573727478U, 1622903598U, 
+         928358530U, 3687040955U, 2229821334U, 1924916232U, 2642740820U,  962131875U, 2292104428U, 1492599347U, 
+         179662610U, 2650840911U, 1238291622U, 1395934004U, 1429320134U, 4135486176U, 3288572610U,  766064643U, 
+        3389706690U, 1603962007U,  404728228U, 1033147146U, 2917594947U,  818199962U, 1062134016U, 1873522195U, 
+        2344213611U, 1334392601U, 3231136416U, 3154354408U,   53458237U,  326291319U, 1374637670U, 2527274061U, 
+        3275533190U, 1091471094U, 1608598215U, 3982837498U,  854523439U, 3980035710U, 3271332039U, 2084744958U, 
+        1257882606U, 3990752531U, 2244551115U, 2971749757U, 2769878206U, 1532033662U, 3905195280U, 3212333866U, 
+        3263150863U, 2850216744U, 3902925084U, 3896919631U, 1579961001U, 3140340507U, 2766051896U, 2081289887U, 
+        1750394304U, 3260616765U,  777337355U, 2488430918U, 3345704073U, 1658479668U, 1186871012U, 3010472997U, 
+        4064814508U,  401901000U, 1445914539U, 2126696012U, 1499282389U, 3227952053U, 1244367611U, 1363272425U, 
+        2993166825U, 3651626532U, 1277981208U, 1266477339U,  346174459U, 1979787254U, 1151610429U,  630376762U, 
+        3489397150U, 2456092277U, 2054460899U, 3046855093U, 4101998595U, 1511703859U, 3959158440U, 2844907792U, 
+        1337548427U,  169668442U, 2844642616U, 2123337557U,   42074966U, 3805726863U, 2382295811U, 1930143091U, 
+        3459576480U, 1284106412U, 1084159267U,   57243465U, 1453020353U,  548264765U, 1314541291U, 4181676980U, 
+         532924546U,  859503588U, 3183100102U, 3282102282U, 3923234710U, 2485794510U,  889659598U, 2689681731U, 
+         494733701U,  796011755U, 1518655116U, 4250902702U, 2430082559U,  250042163U, 2749722912U, 2781300494U, 
+        4262823799U, 2636729576U, 1936982458U, 2816339644U,  566014132U, 3052118462U, 2279145581U, 1353045238U, 
+        1489036855U, 1972583413U,  871585926U, 3112602059U, 4022854532U,  486561137U,  514471063U, 2308799802U, 
+        3021218604U, 1932935329U, 2686735447U, 2085763519U,  452998226U,  427127052U, 4236784439U, 1151364549U, 
+         756265135U, 1213043247U,  838329127U, 3881676241U, 3869517333U, 2157280219U, 2343464420U,  671883217U, 
+        2890769053U, 1083424001U, 2087733987U, 2978388938U, 3512513479U,  475027588U,  104357547U, 1665705864U, 
+         716789302U, 1811350741U, 1779450327U, 4053512797U, 3199948173U,  123481387U, 3143283710U, 2341035483U, 
+        2927502700U,  182773163U, 3917282312U,  753365079U, 1045159160U, 2501465972U,  184993237U, 1337305965U, 
+        4286237144U, 3281245056U, 1825992938U,  875362512U, 1260590860U, 1841506491U, 3158533437U, 2318164518U, 
+        3978751060U, 1962530015U, 1964969668U,   63802116U, 2878534737U, 2710509506U,  907968416U, 2691272446U, 
+        3092154729U,  604901187U, 1797877713U, 1506202511U, 1211365822U, 1641213906U,  385604187U, 3312287705U, 
+        3432134964U, 1801947180U,   44452533U, 2521823472U, 1225767792U, 1668077779U, 1526960899U, 2881588266U, 
+        4166305764U,  117794374U,   91723963U, 3297277904U, 4217795193U, 3234208493U, 1506438342U,   96103857U, 
+        2725586566U, 3442372810U, 1500513901U,  399787375U, 2923308260U, 1017297708U, 2446528401U, 2586021947U, 
+        1579616133U, 2897755542U, 2396905047U, 3258182661U, 3103743829U,  548313168U, 2353918383U, 1340716784U, 
+         749092155U, 2766526177U, 2599169750U, 3174384362U,   65704834U, 2580233623U,  997964456U, 2339629234U, 
+        1200804606U, 2685558424U, 3297346213U, 3532589784U,  753166051U, 1133565816U, 1620901171U, 3403553592U, 
+         431939481U, 2367525402U, 2653767278U,  967645754U,  542535164U, 3475522244U, 3605480236U, 3377253116U, 
+          86774776U, 2347749569U, 4010846644U,  612575330U,  684352025U, 3284147690U,  796942750U, 3280464980U, 
+        3342546013U, 1906203539U, 3986093888U,  816176768U, 3361590201U, 1060543997U, 1346657544U, 1359447913U, 
+        2293963230U,   71290513U, 1249698366U, 3052039855U, 2091357253U,  810137767U, 2205841679U, 1283534803U, 
+         994260947U, 3936287416U, 3832137857U,  179730652U, 3929281972U, 2172784260U, 2348566878U, 1594002070U, 
+         436365499U, 2616678645U, 1580412724U, 2857041740U, 1789732633U, 2435747181U, 3637288650U, 2924839773U, 
+        2169082285U, 2095068493U,  228764419U, 3078317076U, 3523640229U, 1050740060U,  137363925U, 2819803025U, 
+        1182026006U,  847861523U, 1835038718U, 2801247511U, 1465499347U, 3588341374U, 2682071059U,  138309685U, 
+        2935084300U, 4266206543U, 3849796339U, 1708044391U,  980316746U, 3018980709U, 4256251947U, 3941848550U, 
+        3677741347U,  721724014U,  662685921U, 3353131070U, 1197381318U, 2437850464U, 3548170687U, 3214726798U, 
+        3755742456U, 2971208642U, 2127306752U, 2083243037U, 3575713077U, 4074141477U, 1585819012U,  745340102U, 
+        2980486813U,  347029727U, 3183193599U, 4265354003U,  747743228U,  784494494U, 2692073096U,  928926255U, 
+        3865530041U, 1779563913U, 3788913594U, 3085336255U, 2298128624U, 3096155991U, 1604437163U, 1148178400U, 
+        3663759737U, 2305887249U, 1298871247U, 2543629225U, 4151419860U, 2511932216U, 3579283843U, 2425780672U, 
+        4052897948U, 1339498939U, 1600268008U, 2656298195U, 1273458829U, 2800508424U, 2226427659U, 2527167537U, 
+        3953813355U, 1047872006U, 1167531460U, 1128187831U, 1319809424U, 2444488477U, 3111931531U, 4091897708U, 
+        2394910848U, 1078710480U, 2498450932U, 3178809517U, 2110001756U, 3333981441U,  381877564U, 2311384749U, 
+        2720035236U, 1346721904U,  730900420U,  625494473U, 1191860162U, 3401367640U,  909161370U, 2357281982U, 
+        2890039979U, 3557729991U, 4080405120U, 2814483995U, 4100318142U, 4171876996U, 3038267094U,  897098365U, 
+        1843692768U, 2520859750U, 2410642846U, 3554208557U, 3017584076U, 1652306172U, 3643659724U, 3176737589U, 
+         648091214U, 2737498662U, 4233417769U, 3831493184U, 1133061432U, 1142712066U, 3572384192U,  951778186U, 
+        3006053375U, 2859958748U, 2960185592U, 2210763820U, 2323083597U, 2019338471U,  349033938U, 2017864636U, 
+          71125151U, 2469211292U,  866482202U,  598435361U, 3818433599U, 3185243685U, 1178104701U,  262931958U, 
+        4187771988U,   20151591U, 2166588422U, 3729953826U,   72003242U,  124260321U,  626049368U, 1145048311U, 
+        2321282346U,  171795601U, 2607971925U, 1786636618U,  849659033U, 1536171498U,  767534485U,  805027940U, 
+        1786065049U, 1008571464U, 1287752905U, 1259545105U,  536117286U, 1348113196U, 1689662994U, 3058538596U, 
+        3935237281U,   25640055U, 3204263978U, 1543377373U, 2783785920U, 2100549808U,   39367080U, 2740281907U, 
+        4103746216U, 2941303482U, 1674030135U, 3493203711U, 2298257987U, 1583338769U, 2689804323U, 2029023450U, 
+        2023246524U, 2857365769U, 3877257850U,  199494593U, 2732886762U, 2630403384U, 2223640289U, 1237607652U, 
+        1578316267U,  527370767U,  382831330U, 2762048789U,  970171823U,  525550760U, 1815603497U, 3264795178U, 
+        3519734573U, 2069152156U, 2569540918U,  199113572U, 3319176476U, 3770278452U, 2956094115U, 3673130609U, 
+        3374424096U,  573447791U, 1507967799U, 3454995525U, 3017038631U, 2951867994U, 2612197641U,  889525975U, 
+         310669146U, 3612462368U, 2728474688U, 1893802268U, 1280520366U, 1184222956U, 1642775610U, 3732535551U, 
+        4266207283U,  332511408U, 1692004163U, 1367301130U, 4183507314U, 2323278962U, 2915727744U, 3025376571U, 
+        3825327144U, 2519505474U, 3660355818U, 3944322473U,  543155253U,  442958549U, 3842842101U, 2240042838U, 
+        3386056552U, 2344411982U,  115110582U, 2036875984U, 3490937046U, 1708488305U, 2492569330U, 3587911885U, 
+        2196407073U, 2253108831U, 3186592284U, 4145727520U, 1410038845U, 1327647718U, 1254895773U, 2132398133U, 
+        1118022286U, 3984369181U, 1413851891U,  727955630U, 3429383234U, 3903516479U,  208142585U,  688966762U, 
+        3398855413U, 1354014611U, 3134577292U, 3358667447U, 1600989294U,  319955679U, 3465904235U, 3441744457U, 
+        1304273814U,  317960022U, 1627463283U,  566069773U, 1424821198U, 3259956139U,  662476690U, 1413538487U, 
+        1937031465U, 3406064669U, 3548240634U, 3693827272U,  752123984U,  809048824U, 2789636148U, 2261259740U, 
+        1727683005U,  596993763U,  561649026U, 2218598952U, 1671687092U, 3729783172U, 4157870600U,  658896693U, 
+         728309492U, 2640403062U,  645422487U, 1213727100U,  333598496U,  570495208U, 1181987941U,          0U
+    };
+    // clang-format on
+
+    std::vector<engine_type> h_engines;
+    h_engines.reserve(generator_count);
+    h_engines.emplace_back(seed);
+    h_engines.push_back(h_engines.back());
+    h_engines[1].m_state = engine_type::discard_subsequence_impl(jump, h_engines[1].m_state);
+
+    engine_type* d_engines{};
+    HIP_CHECK(
+        hipMalloc(reinterpret_cast<void**>(&d_engines), generator_count * sizeof(engine_type)));
+    HIP_CHECK(hipMemcpy(d_engines,
+                        h_engines.data(),
+                        generator_count * sizeof(engine_type),
+                        hipMemcpyHostToDevice));
+
+    // The device engine strides the state by the full generator count, so the
+    // state of all generators must be allocated even though only two are used
+    unsigned int* d_state{};
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_state),
+                        state_size * well19937_generator_count * sizeof(unsigned int)));
+    unsigned int* d_state_ptrs{};
+    HIP_CHECK(hipMalloc(reinterpret_cast<void**>(&d_state_ptrs),
+                        generator_count * sizeof(unsigned int)));
+
+    // Initialize the device state from the two engines.
+    // Generate subsequence_size elements from the first engine.
+    hipLaunchKernelGGL(init_engines_kernel,
+                       dim3(1),
+                       dim3(generator_count),
+                       0,
+                       0,
+                       d_state,
+                       d_state_ptrs,
+                       d_engines,
+                       subsequence_size);
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(d_engines));
+
+    // Device side data
+    constexpr unsigned int elements_per_generator = 1234567U;
+    static_assert(elements_per_generator > subsequence_size,
+                  "the generated sequences must overlap");
+    constexpr size_t bytes_per_generator = elements_per_generator * sizeof(unsigned int);
+    unsigned int*    d_data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&d_data), 2 * bytes_per_generator));
+
+    // Generate the data
+    hipLaunchKernelGGL(generate_kernel,
+                       dim3(1),
+                       dim3(generator_count),
+                       0,
+                       0,
+                       d_state,
+                       d_state_ptrs,
+                       d_data,
+                       elements_per_generator);
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(d_state));
+    HIP_CHECK(hipFree(d_state_ptrs));
+
+    unsigned int* h_data = static_cast<unsigned int*>(malloc(2 * bytes_per_generator));
+    HIP_CHECK(hipMemcpy(h_data, d_data, 2 * bytes_per_generator, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_data));
+
+    // Output of the two generators
+    const unsigned int* data0 = h_data;
+    const unsigned int* data1 = h_data + elements_per_generator;
+
+    // Unlike MT19937, every generator emits its sequence in order, so the
+    // jumped generator must reproduce the first generator's output with a
+    // plain offset of subsequence_size elements
+    for(unsigned int i = 0; i < elements_per_generator - subsequence_size; i++)
+    {
+        SCOPED_TRACE(testing::Message() << "i = " << i);
+        ASSERT_EQ(data0[subsequence_size + i], data1[i]);
+    }
+
+    free(h_data);
+}
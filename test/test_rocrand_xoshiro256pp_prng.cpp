@@ -0,0 +1,478 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cstdint>
+#include <numeric>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+TEST(rocrand_xoshiro256pp_prng_tests, init_test)
+{
+    rocrand_xoshiro256pp generator; // offset = 0
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset(1);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset(1337);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset(1048576);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset(1 << 24);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset(1 << 28);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    generator.set_offset((1ULL << 36) + 1234567ULL);
+    ROCRAND_CHECK(generator.init());
+    HIP_CHECK(hipDeviceSynchronize());
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, uniform_ulonglong_test)
+{
+    const size_t size = 1313;
+    unsigned long long * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned long long) * size));
+
+    rocrand_xoshiro256pp g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned long long) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i] / static_cast<double>(size);
+    }
+    ASSERT_NEAR(mean, static_cast<double>(ULLONG_MAX / 2), static_cast<double>(ULLONG_MAX / 20));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, uniform_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(float) * size);
+
+    rocrand_xoshiro256pp g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Check if the numbers generated by first generate() call are different from
+// the numbers generated by the 2nd call (same generator)
+TEST(rocrand_xoshiro256pp_prng_tests, state_progress_test)
+{
+    // Device data
+    const size_t size = 1025;
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generator
+    rocrand_xoshiro256pp g0;
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data2[size];
+    HIP_CHECK(hipMemcpy(host_data2, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data1[i] == host_data2[i]) same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state
+// generate the same numbers
+TEST(rocrand_xoshiro256pp_prng_tests, same_seed_test)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    // Device side data
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_xoshiro256pp g0, g1;
+    // Set same seeds
+    g0.set_seed(seed);
+    g1.set_seed(seed);
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Numbers generated using same generator with same
+    // seed should be the same
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state generate
+// the same numbers
+TEST(rocrand_xoshiro256pp_prng_tests, different_seed_test)
+{
+    const unsigned long long seed0 = 0xdeadbeefdeadbeefULL;
+    const unsigned long long seed1 = 0xbeefdeadbeefdeadULL;
+
+    // Device side data
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMallocHelper(reinterpret_cast<void**>(&data), sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_xoshiro256pp g0, g1;
+    // Set different seeds
+    g0.set_seed(seed0);
+    g1.set_seed(seed1);
+    ASSERT_NE(g0.get_seed(), g1.get_seed());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(g1_host_data[i] == g0_host_data[i]) same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, discard_test)
+{
+    const unsigned long long seed = 1234567890123ULL;
+    rocrand_xoshiro256pp::engine_type engine1(seed, 0, 678ULL);
+    rocrand_xoshiro256pp::engine_type engine2(seed, 0, 677ULL);
+
+    (void)engine2.next();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned long long ds[] = {
+        1ULL, 4ULL, 37ULL, 583ULL, 7452ULL,
+        21032ULL, 35678ULL, 66778ULL, 10313475ULL, 82120230ULL
+    };
+
+    for (auto d : ds)
+    {
+        for (unsigned long long i = 0; i < d; i++)
+        {
+            (void)engine1.next();
+        }
+        engine2.discard(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, discard_sequence_test)
+{
+    const unsigned long long seed = ~1234567890123ULL;
+    rocrand_xoshiro256pp::engine_type engine1(seed, 0, 444ULL);
+    rocrand_xoshiro256pp::engine_type engine2(seed, 123ULL, 444ULL);
+
+    engine1.discard_subsequence(123ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Jumps compose with each other and commute with in-sequence skips.
+    // The jump costs a fixed number of state updates per subsequence, so
+    // the counts are kept small here.
+    engine1.discard(5356ULL);
+    engine1.discard_subsequence(123ULL);
+    engine1.discard(30006ULL);
+
+    engine2.discard_subsequence(3ULL);
+    engine2.discard(35362ULL);
+    engine2.discard_subsequence(120ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_subsequence(345ULL);
+    engine1.discard_subsequence(160ULL);
+
+    engine2.discard_subsequence(505ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+}
+
+template <typename T>
+class rocrand_xoshiro256pp_prng_offset : public ::testing::Test {
+public:
+  using output_type = T;
+};
+
+using RocrandXoshiro256ppPrngOffsetTypes = ::testing::Types<unsigned int, float>;
+TYPED_TEST_SUITE(rocrand_xoshiro256pp_prng_offset, RocrandXoshiro256ppPrngOffsetTypes);
+
+TYPED_TEST(rocrand_xoshiro256pp_prng_offset, offsets_test)
+{
+    using T = typename TestFixture::output_type;
+    const size_t size = 131313;
+
+    constexpr size_t offsets[] = { 0, 1, 11, 112233 };
+
+    for(const auto offset : offsets)
+    {
+        const size_t size0 = size;
+        const size_t size1 = (size + offset);
+        T* data0;
+        T* data1;
+        hipMalloc(reinterpret_cast<void**>(&data0), sizeof(T) * size0);
+        hipMalloc(reinterpret_cast<void**>(&data1), sizeof(T) * size1);
+
+        rocrand_xoshiro256pp g0;
+        g0.set_offset(offset);
+        g0.generate(data0, size0);
+
+        rocrand_xoshiro256pp g1;
+        g1.generate(data1, size1);
+
+        std::vector<T> host_data0(size0);
+        std::vector<T> host_data1(size1);
+        hipMemcpy(host_data0.data(), data0, sizeof(T) * size0, hipMemcpyDeviceToHost);
+        hipMemcpy(host_data1.data(), data1, sizeof(T) * size1, hipMemcpyDeviceToHost);
+        hipDeviceSynchronize();
+
+        for(size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(host_data0[i], host_data1[i + offset]);
+        }
+
+        hipFree(data0);
+        hipFree(data1);
+    }
+}
+
+// Check that subsequent generations of different sizes produce one
+// sequence without gaps, no matter how many values are generated per call.
+template<typename T, typename GenerateFunc>
+void continuity_test(GenerateFunc generate_func, unsigned int divisor = 1)
+{
+    std::vector<size_t> sizes0({ 100, 1, 24783, 3, 2, 776543 });
+    std::vector<size_t> sizes1({ 1024, 55, 65536, 623456, 30, 111331 });
+    if (divisor > 1)
+    {
+        for (size_t& s : sizes0) s = (s + divisor - 1) & ~static_cast<size_t>(divisor - 1);
+        for (size_t& s : sizes1) s = (s + divisor - 1) & ~static_cast<size_t>(divisor - 1);
+    }
+
+    const auto size0 = std::accumulate(sizes0.cbegin(), sizes0.cend(), std::size_t{0});
+    const auto size1 = std::accumulate(sizes1.cbegin(), sizes1.cend(), std::size_t{0});
+
+    T * data0;
+    T * data1;
+    hipMalloc(reinterpret_cast<void**>(&data0), sizeof(T) * size0);
+    hipMalloc(reinterpret_cast<void**>(&data1), sizeof(T) * size1);
+
+    rocrand_xoshiro256pp g0;
+    rocrand_xoshiro256pp g1;
+
+    std::vector<T> host_data0(size0);
+    std::vector<T> host_data1(size1);
+
+    size_t current0 = 0;
+    for (size_t s : sizes0)
+    {
+        generate_func(g0, data0, s);
+        hipMemcpy(
+            host_data0.data() + current0,
+            data0,
+            sizeof(T) * s, hipMemcpyDefault);
+        current0 += s;
+    }
+    size_t current1 = 0;
+    for (size_t s : sizes1)
+    {
+        generate_func(g1, data1, s);
+        hipMemcpy(
+            host_data1.data() + current1,
+            data1,
+            sizeof(T) * s, hipMemcpyDefault);
+        current1 += s;
+    }
+
+    for(size_t i = 0; i < std::min(size0, size1); i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]);
+    }
+
+    hipFree(data0);
+    hipFree(data1);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_uniform_ullong_test)
+{
+    typedef unsigned long long output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate(data, s); },
+                                 uniform_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_uniform_uint_test)
+{
+    typedef unsigned int output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate(data, s); },
+                                 uniform_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_uniform_char_test)
+{
+    typedef unsigned char output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate(data, s); },
+                                 uniform_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_uniform_float_test)
+{
+    typedef float output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_uniform(data, s); },
+                                 uniform_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_uniform_double_test)
+{
+    typedef double output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_uniform(data, s); },
+                                 uniform_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_normal_float_test)
+{
+    typedef float output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_normal(data, s, 0.0f, 1.0f); },
+                                 normal_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_normal_double_test)
+{
+    typedef double output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_normal(data, s, 0.0, 1.0); },
+                                 normal_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_log_normal_float_test)
+{
+    typedef float output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_log_normal(data, s, 0.0f, 1.0f); },
+                                 normal_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_log_normal_double_test)
+{
+    typedef double output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_log_normal(data, s, 0.0, 1.0); },
+                                 normal_distribution<output_type, unsigned long long>::output_width);
+}
+
+TEST(rocrand_xoshiro256pp_prng_tests, continuity_poisson_test)
+{
+    typedef unsigned int output_type;
+    continuity_test<output_type>([](rocrand_xoshiro256pp& g, output_type * data, size_t s) { g.generate_poisson(data, s, 100.0); },
+                                 rocrand_poisson_distribution<>::output_width);
+}
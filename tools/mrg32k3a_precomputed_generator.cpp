@@ -124,17 +124,25 @@ void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, u
 void write_matrices(std::ofstream& fout, const std::string name, unsigned long long * a, int n, int bits, bool is_device)
 {
     fout << "static const ";
-    fout << (is_device ? "__device__ " : "") << "unsigned long long " << name << "[MRG323A_N] = {"
-         << std::endl;
+    fout << (is_device ? "__device__ " : "") << "unsigned long long " << name
+         << "[9 * ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED] = {" << std::endl;
     fout << "    // clang-format off" << std::endl;
-    fout << "    ";
-    for (int k = 0; k < n; k++)
+    for (int k = 0; k < n; k += bits)
     {
-        fout << a[k] << ", ";
-        if ((k + 1) % bits == 0 && k != 1)
-            fout << std::endl << "    ";
+        // Guarding every 3x3 matrix separately keeps the truncated table
+        // a prefix of the full one
+        if (k > 0)
+            fout << "#if ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED > " << k / bits << std::endl;
+        fout << "    ";
+        for (int j = 0; j < bits; j++)
+        {
+            fout << a[k + j] << ", ";
+        }
+        fout << std::endl;
+        if (k > 0)
+            fout << "#endif" << std::endl;
     }
-    fout << "// clang-format on" << std::endl;
+    fout << "    // clang-format on" << std::endl;
     fout << "};" << std::endl;
     fout << std::endl;
 }
@@ -196,6 +204,17 @@ int main(int argc, char const *argv[])
     fout << "#define MRG323A_DIM " << MRG323A_DIM << std::endl;
     fout << "#define MRG323A_N " << MRG323A_N << std::endl;
     fout << std::endl;
+    fout << R"(// Number of 3x3 skip-ahead matrices compiled into each table below, one
+// per bit of the skip distance. Defining a smaller value (directly or
+// through the ROCRAND_MRG32K3A_JUMP_MATRICES CMake option) drops the
+// matrices for the largest skips from every translation unit including
+// this header. Offsets and subsequence/sequence counts passed to the
+// engine must then stay below 2^ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED.
+#ifndef ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED
+    #define ROCRAND_MRG32K3A_JUMP_MATRICES_COMPILED MRG323A_DIM
+#endif
+
+)";
 
     write_matrices(fout, "d_A1", A1, MRG323A_N, 9, true);
     write_matrices(fout, "h_A1", A1, MRG323A_N, 9, false);
@@ -30,6 +30,10 @@ constexpr unsigned int mexp = 19937;
 constexpr unsigned int w_size = 32;
 /// Minimum number of unsigned ints to represent mexp bits.
 constexpr unsigned int p_size = (mexp + w_size - 1) / w_size;
+/// Number of precomputed power-of-two jump polynomials. Entry \p k skips
+/// <tt>2 ^ 1000 * 2 ^ k</tt> states; thirteen entries cover direct jumps to
+/// any of the 8192 subsequences used by the generator.
+constexpr unsigned int pow2_count = 13;
 
 /// String in this array contains the constants to skip <tt>2 ^ 1000</tt> states.
 /// Values are produced using minipoly_mt19937.c as distributed in:
@@ -38,14 +42,22 @@ constexpr unsigned int p_size = (mexp + w_size - 1) / w_size;
 namespace
 {
 extern const char jump[mexp + 1];
+/// Characteristic polynomial of the MT19937 transition function (degree
+/// \p mexp, most significant coefficient first), recovered from the output
+/// sequence with the Berlekamp-Massey algorithm. <tt>x ^ (2 ^ 1000)</tt>
+/// modulo this polynomial reproduces \p jump above, which cross-checks both
+/// tables. Products of jump polynomials are reduced modulo this polynomial
+/// when the power-of-two jump table is computed.
+extern const char charpoly[mexp + 2];
 } // namespace
 
-/// Set the coefficients of polynomial \p pf based on <tt>p</tt>.
-void set_coef(const char p[mexp + 1], unsigned int pf[p_size])
+/// Set the coefficients of polynomial \p pf based on the
+/// <tt>degree + 1</tt> character string \p p (most significant first).
+void set_coef(const char* p, unsigned int degree, unsigned int* pf)
 {
-    for(size_t i = 0; i < mexp; i++)
+    for(size_t i = 0; i <= degree; i++)
     {
-        size_t j = mexp - i - 1;
+        size_t j = degree - i;
         if(p[i] == '1')
         {
             // Set coefficient j of the polynomial pf.
@@ -56,6 +68,54 @@ void set_coef(const char p[mexp + 1], unsigned int pf[p_size])
     }
 }
 
+/// Square polynomial \p a over GF(2) into \p r, which holds
+/// <tt>2 * p_size</tt> words.
+void poly_square(const unsigned int a[p_size], unsigned int r[2 * p_size])
+{
+    for(size_t i = 0; i < 2 * p_size; i++)
+    {
+        r[i] = 0;
+    }
+    for(size_t i = 0; i < p_size; i++)
+    {
+        for(unsigned int b = 0; b < w_size; b++)
+        {
+            if((a[i] >> b) & 1U)
+            {
+                const size_t j = 2 * (w_size * i + b);
+                r[j / w_size] ^= 1U << (j % w_size);
+            }
+        }
+    }
+}
+
+/// Reduce \p r modulo the characteristic polynomial \p cp (degree \p mexp)
+/// in place and copy the remainder to <tt>out</tt>.
+void poly_mod(unsigned int r[2 * p_size], const unsigned int cp[p_size], unsigned int out[p_size])
+{
+    for(int deg = 2 * (static_cast<int>(mexp) - 1); deg >= static_cast<int>(mexp); deg--)
+    {
+        if((r[deg / w_size] >> (deg % w_size)) & 1U)
+        {
+            const unsigned int shift  = deg - mexp;
+            const unsigned int offset = shift / w_size;
+            const unsigned int bits   = shift % w_size;
+            for(size_t k = 0; k < p_size; k++)
+            {
+                r[k + offset] ^= cp[k] << bits;
+                if(bits != 0)
+                {
+                    r[k + offset + 1] ^= cp[k] >> (w_size - bits);
+                }
+            }
+        }
+    }
+    for(size_t i = 0; i < p_size; i++)
+    {
+        out[i] = r[i];
+    }
+}
+
 int main(int argc, char const* argv[])
 {
     if(argc != 2 || std::string(argv[1]) == "--help")
@@ -100,13 +160,15 @@ int main(int argc, char const* argv[])
     fout << "constexpr unsigned int mt19937_mexp   = " << mexp << ";\n";
     fout << "constexpr unsigned int mt19937_p_size = " << p_size << ";\n";
 
+    fout << "constexpr unsigned int mt19937_jumps_pow2_count = " << pow2_count << ";\n";
+
     unsigned int pf[p_size] = {};
 
     fout << "\n"
             "// clang-format off\n"
             "static constexpr unsigned int mt19937_jump[mt19937_p_size] = {\n    ";
 
-    set_coef(jump, pf);
+    set_coef(jump, mexp - 1, pf);
 
     for(size_t i = 0; i < p_size; i++)
     {
@@ -122,7 +184,57 @@ int main(int argc, char const* argv[])
         }
     }
 
-    fout << "\n};\n"
+    fout << "\n};\n";
+
+    // Entry k skips 2 ^ 1000 * 2 ^ k states: the first entry is the plain
+    // jump polynomial, every next entry is the square of the previous one
+    // reduced modulo the characteristic polynomial.
+    unsigned int cp[p_size] = {};
+    set_coef(charpoly, mexp, cp);
+
+    static unsigned int jumps[pow2_count][p_size];
+    static unsigned int square[2 * p_size];
+    for(size_t i = 0; i < p_size; i++)
+    {
+        jumps[0][i] = pf[i];
+    }
+    for(size_t k = 1; k < pow2_count; k++)
+    {
+        poly_square(jumps[k - 1], square);
+        poly_mod(square, cp, jumps[k]);
+    }
+
+    fout << "\n"
+            "// mt19937_jumps_pow2[k] skips 2 ^ 1000 * 2 ^ k states;\n"
+            "// the first entry equals mt19937_jump\n"
+            "static constexpr unsigned int "
+            "mt19937_jumps_pow2[mt19937_jumps_pow2_count][mt19937_p_size] = {\n";
+
+    for(size_t k = 0; k < pow2_count; k++)
+    {
+        fout << "    {\n    ";
+        for(size_t i = 0; i < p_size; i++)
+        {
+            fout << std::setw(10);
+            fout << jumps[k][i] << "U";
+            if(i + 1 < p_size)
+            {
+                fout << ", ";
+                if((i + 1) % 8 == 0)
+                {
+                    fout << "\n    ";
+                }
+            }
+        }
+        fout << "\n    }";
+        if(k + 1 < pow2_count)
+        {
+            fout << ",";
+        }
+        fout << "\n";
+    }
+
+    fout << "};\n"
             "// clang-format on\n";
 
     fout << R"(
@@ -557,4 +669,430 @@ const char jump[mexp + 1] = "100101100001111001100111100110101111010011111011010
                             "1111000010100111011001001001011101000010001111100011111000011101100100"
                             "000111101010110001001100"
                             "111010101";
+
+const char charpoly[mexp + 2] = "1000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000010000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000100000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000100000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000001000000000000000000000000000000000000000000000"
+                                "000000000000100000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000001000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000010000000000000000000000000000000000000000000000000000000001000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000010000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000010000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000100000000000000000000000000000000000000000"
+                                "000000000000000010000000"
+                                "0000000000000000000000000000000000000000000000000010000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000010000"
+                                "0000000000000000000000000000000000000000000000001000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "100000000000000000000000"
+                                "0000000000000000000000000000000000100000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000001000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000100000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000001000"
+                                "0000000000000000000000000000000000000000000000000000001000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000100001000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000100001000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000100000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000010000000000000000000000000000000"
+                                "000000000000000000000100"
+                                "0010000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000100000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000001000010000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000100000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000100000000000000000000000000000000000000000000000"
+                                "000000000010000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000100000000000000000000000000000000000000000000"
+                                "000000001000000000000000"
+                                "0000000000000000000000000000000000000100000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000001000000000000000000000000000000000000000000000000000000000100000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000100001000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000001000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000010000000000000000000000000000000000000000000"
+                                "000000000000001000000000"
+                                "0000000000000000000000000000000000000000000100001000000000000000000000"
+                                "000000000000000000000000"
+                                "0010000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000100001000000"
+                                "0000000000000000000000000000000000000000000000100000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000010"
+                                "000000000000000000000000"
+                                "0000000000000000000000000001000010000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000100000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000001000"
+                                "010000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000100000"
+                                "0000000000000000000000000000000000000000000000000000100000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000100000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000100000000000000"
+                                "000000000000000000000000"
+                                "0000000000000010000000000000000000000000000000000000000000000000000100"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000001000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "1000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000001000010000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000001000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000010000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000010000000000000000000000000000000000000000000000000"
+                                "000100001000000000000000"
+                                "0000000000000000000000000000000010000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000001000010000000000000000000000000000000000000000000000"
+                                "000000100000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000100000000000000000000000000000000000000000000000000001000010000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000010000000000000000000000000000000000000000000"
+                                "000000000100000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0010000100000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000001000000000000000000000000000000000000000000000"
+                                "000000000000100000000000"
+                                "0000000000000000000000000000000000000000000000100000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000010000000000000000000000000"
+                                "000000000000000000000000"
+                                "0001000000000000000000000000000000000000000000000000000000000000001000"
+                                "000000000000000000000000"
+                                "0000000000000001000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000001000010000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000001000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000010000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000001"
+                                "0000000001000000000000000000000000000000000000000000000000000010000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000010000000000000000000"
+                                "0000000000000000000000000000000000000010000000001000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000001000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000001000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000100000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000010000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000001000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000100000000000000000000000000000000000000000000000000000000000000000"
+                                "001000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000010"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000001000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000010000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000010000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000100000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000100000000000000000000000000000000000000000000000100000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000001000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000010000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000100000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000100000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000010000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000010000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000100000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000100000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000100000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000001000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "001000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000010000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000010000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000001000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000100000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000100000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000100000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0001000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000001000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000000000000000000000000000000000000000000000000000000000000000000"
+                                "000000000000000000000000"
+                                "0000000001";
 } // namespace
@@ -0,0 +1,494 @@
+// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// Generates the precomputed jump polynomial for WELL19937.
+///
+/// Unlike mt19937_precomputed_generator, which embeds a polynomial computed
+/// with an external tool, everything is derived here from the recurrence
+/// itself:
+///  1. the minimal polynomial of the WELL19937 transition is recovered with
+///     the Berlekamp-Massey algorithm from output sequences of the linear
+///     state recurrence (several independent initial states and output
+///     functionals are combined with a polynomial lcm so that no factor of
+///     the minimal polynomial is missed),
+///  2. the result is validated by applying <tt>z ^ N mod minpoly</tt> to
+///     random states with a Horner scheme and comparing the full state
+///     against \p N direct steps,
+///  3. the jump polynomial <tt>z ^ (2 ^ 1000) mod minpoly</tt> is computed
+///     with repeated modular squaring and written as a coefficient table in
+///     the same format that the MT19937 jump table uses.
+
+namespace
+{
+
+// WELL19937 constants, see Panneton, L'Ecuyer and Matsumoto,
+// "Improved Long-Period Generators Based on Linear Recurrences Modulo 2".
+constexpr unsigned int r  = 624;
+constexpr unsigned int m1 = 70;
+constexpr unsigned int m2 = 179;
+constexpr unsigned int m3 = 449;
+
+constexpr unsigned int masku = 0x7FFFFFFFU;
+constexpr unsigned int maskl = ~masku;
+
+/// Number of bits in the state array; the effective state space of
+/// WELL19937 is 19937 bits of it.
+constexpr unsigned int state_bits = r * 32;
+
+/// Number of unsigned ints in the emitted coefficient table.
+constexpr unsigned int p_size = state_bits / 32;
+
+struct well_state
+{
+    unsigned int v[r];
+    unsigned int i;
+};
+
+/// Advances \p s by one step of the linear WELL19937 recurrence.
+/// Output tempering is an invertible function of the state and plays
+/// no role in jumping, so it is not applied here.
+void step(well_state& s)
+{
+    const unsigned int vi   = s.i;
+    const unsigned int v0   = s.v[vi];
+    const unsigned int vm1  = s.v[(vi + m1) % r];
+    const unsigned int vm2  = s.v[(vi + m2) % r];
+    const unsigned int vm3  = s.v[(vi + m3) % r];
+    const unsigned int vrm1 = s.v[(vi + r - 1) % r];
+    const unsigned int vrm2 = s.v[(vi + r - 2) % r];
+
+    const unsigned int z0 = (vrm1 & maskl) | (vrm2 & masku);
+    const unsigned int z1 = (v0 ^ (v0 << 25)) ^ (vm1 ^ (vm1 >> 27));
+    const unsigned int z2 = (vm2 >> 9) ^ (vm3 ^ (vm3 >> 1));
+
+    const unsigned int new_v1 = z1 ^ z2;
+    const unsigned int new_v0
+        = z0 ^ (z1 ^ (z1 << 9)) ^ (z2 ^ (z2 << 21)) ^ (new_v1 ^ (new_v1 >> 21));
+
+    s.v[vi]               = new_v1;
+    s.v[(vi + r - 1) % r] = new_v0;
+    s.i                   = (vi + r - 1) % r;
+}
+
+/// XORs state \p b onto state \p a, aligning the ring buffers on their
+/// respective pointers.
+void add_state(well_state& a, const well_state& b)
+{
+    for(unsigned int t = 0; t < r; t++)
+    {
+        a.v[(a.i + t) % r] ^= b.v[(b.i + t) % r];
+    }
+}
+
+/// Fills \p s with bits from a splitmix64 stream so that, with very high
+/// probability, the state excites every factor of the minimal polynomial.
+void random_state(well_state& s, unsigned long long seed)
+{
+    unsigned long long x = seed;
+    for(unsigned int j = 0; j < r; j++)
+    {
+        unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+        z                    = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z                    = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        s.v[j]               = static_cast<unsigned int>(z ^ (z >> 31));
+    }
+    s.i = 0;
+}
+
+/// Dense polynomial over GF(2), bit \p i is the coefficient of <tt>z ^ i</tt>.
+struct poly
+{
+    std::vector<unsigned long long> w;
+
+    bool get(size_t i) const
+    {
+        const size_t q = i / 64;
+        return q < w.size() && ((w[q] >> (i % 64)) & 1ULL) != 0;
+    }
+
+    void set(size_t i)
+    {
+        const size_t q = i / 64;
+        if(q >= w.size())
+        {
+            w.resize(q + 1, 0);
+        }
+        w[q] ^= 1ULL << (i % 64);
+    }
+
+    int degree() const
+    {
+        for(size_t q = w.size(); q-- > 0;)
+        {
+            if(w[q] != 0)
+            {
+                for(int b = 63; b >= 0; b--)
+                {
+                    if((w[q] >> b) & 1ULL)
+                    {
+                        return static_cast<int>(q * 64 + b);
+                    }
+                }
+            }
+        }
+        return -1;
+    }
+};
+
+/// a ^= b << shift
+void xor_shifted(poly& a, const poly& b, size_t shift)
+{
+    const size_t q = shift / 64;
+    const size_t s = shift % 64;
+    if(a.w.size() < b.w.size() + q + 1)
+    {
+        a.w.resize(b.w.size() + q + 1, 0);
+    }
+    if(s == 0)
+    {
+        for(size_t j = 0; j < b.w.size(); j++)
+        {
+            a.w[j + q] ^= b.w[j];
+        }
+    }
+    else
+    {
+        for(size_t j = 0; j < b.w.size(); j++)
+        {
+            a.w[j + q] ^= b.w[j] << s;
+            a.w[j + q + 1] ^= b.w[j] >> (64 - s);
+        }
+    }
+}
+
+/// a mod= m
+void mod(poly& a, const poly& m)
+{
+    const int md = m.degree();
+    for(int d = a.degree(); d >= md; d = a.degree())
+    {
+        xor_shifted(a, m, d - md);
+    }
+    // trim so that repeated reductions do not accumulate zero words
+    if(a.w.size() > static_cast<size_t>(md / 64 + 1))
+    {
+        a.w.resize(md / 64 + 1);
+    }
+}
+
+poly mul(const poly& a, const poly& b)
+{
+    poly p;
+    p.w.assign(a.w.size() + b.w.size() + 1, 0);
+    const int bd = b.degree();
+    for(int i = 0; i <= bd; i++)
+    {
+        if(b.get(i))
+        {
+            xor_shifted(p, a, i);
+        }
+    }
+    return p;
+}
+
+poly gcd(poly a, poly b)
+{
+    while(b.degree() >= 0)
+    {
+        mod(a, b);
+        std::swap(a, b);
+    }
+    return a;
+}
+
+poly lcm(const poly& a, const poly& b)
+{
+    poly p = mul(a, b);
+    poly g = gcd(a, b);
+    // divide p by g
+    poly q;
+    const int gd = g.degree();
+    for(int d = p.degree(); d >= gd; d = p.degree())
+    {
+        q.set(d - gd);
+        xor_shifted(p, g, d - gd);
+    }
+    assert(p.degree() < 0);
+    return q;
+}
+
+/// Minimal polynomial of the bit sequence \p seq with the Berlekamp-Massey
+/// algorithm. Returns the characteristic form, i.e. the reciprocal of the
+/// connection polynomial, which annihilates the recurrence when evaluated
+/// in the transition function.
+poly berlekamp_massey(const std::vector<unsigned char>& seq)
+{
+    const size_t n = seq.size();
+    poly         c;
+    poly         b;
+    c.set(0);
+    b.set(0);
+    size_t l = 0;
+    size_t m = 1;
+    for(size_t i = 0; i < n; i++)
+    {
+        // discrepancy
+        unsigned char d = seq[i];
+        for(size_t j = 1; j <= l; j++)
+        {
+            if(c.get(j))
+            {
+                d ^= seq[i - j];
+            }
+        }
+        if(d == 0)
+        {
+            m++;
+        }
+        else if(2 * l <= i)
+        {
+            poly t = c;
+            xor_shifted(c, b, m);
+            b = t;
+            l = i + 1 - l;
+            m = 1;
+        }
+        else
+        {
+            xor_shifted(c, b, m);
+            m++;
+        }
+    }
+    // reciprocal: minimal polynomial z^l * c(1/z)
+    poly mp;
+    for(size_t i = 0; i <= l; i++)
+    {
+        if(c.get(i))
+        {
+            mp.set(l - i);
+        }
+    }
+    return mp;
+}
+
+/// Minimal polynomial of the output bit <tt>v[(i + word) % r] & (1 << bit)</tt>
+/// for a random initial state.
+poly sequence_min_poly(unsigned long long seed, unsigned int word, unsigned int bit)
+{
+    well_state s;
+    random_state(s, seed);
+    std::vector<unsigned char> seq(2 * state_bits + 64);
+    for(size_t k = 0; k < seq.size(); k++)
+    {
+        seq[k] = (s.v[(s.i + word) % r] >> bit) & 1U;
+        step(s);
+    }
+    return berlekamp_massey(seq);
+}
+
+/// Computes <tt>p(f) ss</tt> with a Horner scheme, where \p f is the
+/// transition function.
+well_state apply_poly(const poly& p, const well_state& ss)
+{
+    well_state tmp = {};
+    for(int i = p.degree(); i >= 0; i--)
+    {
+        step(tmp);
+        if(p.get(i))
+        {
+            add_state(tmp, ss);
+        }
+    }
+    return tmp;
+}
+
+bool states_equal(const well_state& a, const well_state& b)
+{
+    for(unsigned int t = 0; t < r; t++)
+    {
+        if(a.v[(a.i + t) % r] != b.v[(b.i + t) % r])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// <tt>z ^ n mod m</tt> for small n.
+poly power_mod(unsigned long long n, const poly& m)
+{
+    poly p;
+    p.set(0);
+    for(unsigned long long k = 0; k < n; k++)
+    {
+        poly t;
+        xor_shifted(t, p, 1);
+        mod(t, m);
+        p = t;
+    }
+    return p;
+}
+
+/// <tt>z ^ (2 ^ e) mod m</tt> by repeated modular squaring.
+poly power_pow2_mod(unsigned int e, const poly& m)
+{
+    poly p;
+    p.set(1); // z
+    for(unsigned int k = 0; k < e; k++)
+    {
+        // square: spread the coefficients to even positions
+        poly      sq;
+        const int d = p.degree();
+        sq.w.assign((2 * d) / 64 + 2, 0);
+        for(int i = 0; i <= d; i++)
+        {
+            if(p.get(i))
+            {
+                sq.set(2 * static_cast<size_t>(i));
+            }
+        }
+        mod(sq, m);
+        p = sq;
+    }
+    return p;
+}
+
+} // namespace
+
+int main(int argc, char const* argv[])
+{
+    if(argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./well19937_precomputed_generator "
+                     "../../library/src/rng/well19937_precomputed.hpp"
+                  << std::endl;
+        return argc != 2 ? -1 : 0;
+    }
+
+    // Combine several projections so that no factor of the transition's
+    // minimal polynomial is missed.
+    std::cout << "computing minimal polynomial..." << std::endl;
+    poly mp = sequence_min_poly(0x853C49E6748FEA9BULL, 0, 0);
+    mp      = lcm(mp, sequence_min_poly(0xDA3E39CB94B95BDBULL, 0, 31));
+    mp      = lcm(mp, sequence_min_poly(0x2545F4914F6CDD1DULL, r - 1, 15));
+    const int mexp = mp.degree();
+    std::cout << "minimal polynomial degree: " << mexp << std::endl;
+    assert(mexp >= 19937 && mexp < static_cast<int>(state_bits));
+
+    // Validate jumping with the minimal polynomial against direct stepping.
+    std::cout << "validating small jumps..." << std::endl;
+    for(unsigned long long n : {1000ULL, 12345ULL})
+    {
+        const poly pn = power_mod(n, mp);
+        for(unsigned long long seed : {1ULL, 2ULL, 3ULL})
+        {
+            well_state s;
+            random_state(s, seed);
+            well_state jumped = apply_poly(pn, s);
+            for(unsigned long long k = 0; k < n; k++)
+            {
+                step(s);
+            }
+            assert(states_equal(jumped, s));
+        }
+    }
+
+    // The subsequence jump, 2 ^ 1000 states, like MT19937.
+    std::cout << "computing z ^ (2 ^ 1000) mod minimal polynomial..." << std::endl;
+    const poly jump = power_pow2_mod(1000, mp);
+
+    unsigned int pf[p_size] = {};
+    for(int i = 0; i <= jump.degree(); i++)
+    {
+        if(jump.get(i))
+        {
+            pf[i / 32] ^= 1U << (i % 32);
+        }
+    }
+
+    const std::string file_path(argv[1]);
+    std::ofstream     fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2022 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef WELL19937_PRECOMPUTED_HPP_
+#define WELL19937_PRECOMPUTED_HPP_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/well19937_precomputed_generator
+
+)";
+
+    fout << "constexpr unsigned int well19937_mexp   = " << mexp << ";\n";
+    fout << "constexpr unsigned int well19937_p_size = " << p_size << ";\n";
+
+    fout << "\n"
+            "// clang-format off\n"
+            "static constexpr unsigned int well19937_jump[well19937_p_size] = {\n    ";
+
+    for(size_t i = 0; i < p_size; i++)
+    {
+        fout << std::setw(10);
+        fout << pf[i] << "U";
+        if(i + 1 < p_size)
+        {
+            fout << ", ";
+            if((i + 1) % 8 == 0)
+            {
+                fout << "\n    ";
+            }
+        }
+    }
+
+    fout << "\n};\n"
+            "// clang-format on\n"
+            "\n"
+            "#endif // WELL19937_PRECOMPUTED_HPP_\n";
+
+    std::cout << "wrote " << file_path << std::endl;
+
+    return 0;
+}
@@ -173,9 +173,15 @@ void generate_matrices()
 
 void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, bool is_device)
 {
-    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name << "[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {" << std::endl;
+    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name << "[ROCRAND_XORWOW_JUMP_MATRICES_COMPILED][XORWOW_SIZE] = {" << std::endl;
     for (int k = 0; k < XORWOW_JUMP_MATRICES; k++)
     {
+        // Guarding every matrix separately keeps the truncated table a
+        // prefix of the full one
+        if (k > 0)
+        {
+            fout << "#if ROCRAND_XORWOW_JUMP_MATRICES_COMPILED > " << k << std::endl;
+        }
         fout << "    {" << std::endl;
         for (int i = 0; i < XORWOW_M; i++)
         {
@@ -187,6 +193,10 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned int *
             fout << std::endl;
         }
         fout << "    }," << std::endl;
+        if (k > 0)
+        {
+            fout << "#endif" << std::endl;
+        }
     }
     fout << "};" << std::endl;
     fout << std::endl;
@@ -239,6 +249,18 @@ int main(int argc, char const *argv[]) {
     fout << "#define XORWOW_JUMP_MATRICES " << XORWOW_JUMP_MATRICES << std::endl;
     fout << "#define XORWOW_JUMP_LOG2 " << XORWOW_JUMP_LOG2 << std::endl;
     fout << std::endl;
+    fout << R"(// Number of skip-ahead matrices compiled into the tables below. Defining
+// a smaller value (directly or through the ROCRAND_XORWOW_JUMP_MATRICES
+// CMake option) drops the matrices for the largest skips from every
+// translation unit including this header, cutting compile time and
+// kernel binary size. Offsets and subsequence counts passed to the
+// engine must then stay below
+// 2^(XORWOW_JUMP_LOG2 * ROCRAND_XORWOW_JUMP_MATRICES_COMPILED).
+#ifndef ROCRAND_XORWOW_JUMP_MATRICES_COMPILED
+    #define ROCRAND_XORWOW_JUMP_MATRICES_COMPILED XORWOW_JUMP_MATRICES
+#endif
+
+)";
 
     write_matrices(fout, "d_xorwow_jump_matrices",
         static_cast<unsigned int *>(&jump_matrices[0][0]), true);